@@ -4,16 +4,21 @@
 
 #include "bench.h"
 
+#include "init.h"
 #include "key.h"
 #include "main.h"
+#include "networks/netman.h"
 #include "util/util.h"
 
 int
 main(int argc, char** argv)
 {
     ECC_Start();
+    ECCVerifyHandle globalVerifyHandle;
     SetupEnvironment();
     g_logger->fPrintToDebugLog = false; // don't want to write to debug.log file
+    pnetMan = new CNetworkManager();
+    pnetMan->SetParams("REGTEST");
 
     benchmark::BenchRunner::RunAll();
 
@@ -0,0 +1,103 @@
+// Copyright (c) 2018 The Eccoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "bench.h"
+
+#include "checkqueue.h"
+#include "key.h"
+#include "pubkey.h"
+#include "random.h"
+#include "uint256.h"
+
+#include <assert.h>
+#include <utility>
+
+#include <boost/thread/thread.hpp>
+
+namespace
+{
+//! Signatures of a synthetic block, two inputs for each of its transactions
+const int NUM_SIGNATURES = 4000;
+const int INPUTS_PER_TX = 2;
+
+struct SignedHash
+{
+    CPubKey pubkey;
+    uint256 hash;
+    std::vector<unsigned char> vchSig;
+};
+
+const std::vector<SignedHash> &BlockSignatures()
+{
+    static std::vector<SignedHash> vSigs;
+    if (vSigs.empty())
+    {
+        vSigs.resize(NUM_SIGNATURES);
+        for (SignedHash &sig : vSigs)
+        {
+            CKey key;
+            key.MakeNewKey(true);
+            sig.pubkey = key.GetPubKey();
+            sig.hash = GetRandHash();
+            key.Sign(sig.hash, sig.vchSig);
+        }
+    }
+    return vSigs;
+}
+
+/** Verification of one signature, the part of a CScriptCheck that takes the time */
+class CSigCheck
+{
+private:
+    const SignedHash *sig;
+
+public:
+    CSigCheck() : sig(nullptr) {}
+    explicit CSigCheck(const SignedHash &sigIn) : sig(&sigIn) {}
+    bool operator()() { return sig->pubkey.Verify(sig->hash, sig->vchSig); }
+    void swap(CSigCheck &check) { std::swap(sig, check.sig); }
+};
+
+/**
+ * Verify all signatures of the block through a CCheckQueue with nThreads
+ * threads in total, adding them per transaction the way ConnectBlock does.
+ */
+void CheckQueueBlockSigs(benchmark::State &state, int nThreads)
+{
+    const std::vector<SignedHash> &vSigs = BlockSignatures();
+    CCheckQueue<CSigCheck> queue(128);
+    boost::thread_group threads;
+    for (int i = 0; i < nThreads - 1; i++)
+        threads.create_thread([&queue]() { queue.Thread(); });
+
+    while (state.KeepRunning())
+    {
+        CCheckQueueControl<CSigCheck> control(&queue);
+        for (size_t i = 0; i < vSigs.size(); i += INPUTS_PER_TX)
+        {
+            std::vector<CSigCheck> vChecks;
+            for (size_t j = i; j < i + INPUTS_PER_TX; j++)
+                vChecks.emplace_back(vSigs[j]);
+            control.Add(vChecks);
+        }
+        bool fOk = control.Wait();
+        assert(fOk);
+    }
+    queue.Interrupt();
+    threads.join_all();
+}
+}
+
+static void CheckQueueBlockSigs1(benchmark::State &state) { CheckQueueBlockSigs(state, 1); }
+static void CheckQueueBlockSigs2(benchmark::State &state) { CheckQueueBlockSigs(state, 2); }
+static void CheckQueueBlockSigs4(benchmark::State &state) { CheckQueueBlockSigs(state, 4); }
+static void CheckQueueBlockSigs8(benchmark::State &state) { CheckQueueBlockSigs(state, 8); }
+static void CheckQueueBlockSigs16(benchmark::State &state) { CheckQueueBlockSigs(state, 16); }
+static void CheckQueueBlockSigs32(benchmark::State &state) { CheckQueueBlockSigs(state, 32); }
+BENCHMARK(CheckQueueBlockSigs1);
+BENCHMARK(CheckQueueBlockSigs2);
+BENCHMARK(CheckQueueBlockSigs4);
+BENCHMARK(CheckQueueBlockSigs8);
+BENCHMARK(CheckQueueBlockSigs16);
+BENCHMARK(CheckQueueBlockSigs32);
@@ -0,0 +1,94 @@
+// Copyright (c) 2018 The Eccoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "bench.h"
+
+#include "args.h"
+#include "arith_uint256.h"
+#include "coins.h"
+#include "random.h"
+#include "script/script.h"
+#include "txdb.h"
+#include "util/util.h"
+#include "util/utiltime.h"
+
+// Flush one million fresh coins from a cache into an in-memory chainstate
+// database. Most of the time goes into CCoinsViewDB::BatchWrite and the
+// key/value serialization of CDBBatch; filling the cache is included in the
+// measurement but is the same on every run.
+static void CoinsViewDBFlush1M(benchmark::State &state)
+{
+    const int NUM_COINS = 1000000;
+
+    fs::path pathTemp =
+        GetTempPath() / strprintf("bench_bitcoin_%lu_%i", (unsigned long)GetTime(), (int)(GetRand(100000)));
+    fs::create_directories(pathTemp);
+    gArgs.ForceSetArg("-datadir", pathTemp.string());
+    ClearDatadirCache();
+
+    CScript scriptPubKey;
+    scriptPubKey << OP_DUP << OP_HASH160 << std::vector<uint8_t>(20, 0x42) << OP_EQUALVERIFY << OP_CHECKSIG;
+    std::vector<COutPoint> vOutpoints;
+    vOutpoints.reserve(NUM_COINS);
+    for (int i = 0; i < NUM_COINS; i++)
+        vOutpoints.emplace_back(ArithToUint256(arith_uint256(i / 4 + 1)), i % 4);
+
+    while (state.KeepRunning())
+    {
+        CCoinsViewDB db(1 << 23, true);
+        CCoinsViewCache cache(&db);
+        for (int i = 0; i < NUM_COINS; i++)
+            cache.AddCoin(vOutpoints[i], Coin(CTxOut(i + 1, scriptPubKey), 1, false, false, i), false);
+        cache.SetBestBlock(vOutpoints.back().hash);
+        cache.Flush();
+    }
+
+    ClearDatadirCache();
+    fs::remove_all(pathTemp);
+}
+
+// Look up coins one at a time from a chainstate database holding 100k coins,
+// which exercises CDBWrapper::Read.
+static void CoinsViewDBRead(benchmark::State &state)
+{
+    const int NUM_COINS = 100000;
+
+    fs::path pathTemp =
+        GetTempPath() / strprintf("bench_bitcoin_%lu_%i", (unsigned long)GetTime(), (int)(GetRand(100000)));
+    fs::create_directories(pathTemp);
+    gArgs.ForceSetArg("-datadir", pathTemp.string());
+    ClearDatadirCache();
+
+    CScript scriptPubKey;
+    scriptPubKey << OP_DUP << OP_HASH160 << std::vector<uint8_t>(20, 0x42) << OP_EQUALVERIFY << OP_CHECKSIG;
+    std::vector<COutPoint> vOutpoints;
+    vOutpoints.reserve(NUM_COINS);
+    for (int i = 0; i < NUM_COINS; i++)
+        vOutpoints.emplace_back(ArithToUint256(arith_uint256(i / 4 + 1)), i % 4);
+
+    {
+        CCoinsViewDB db(1 << 23, true);
+        CCoinsViewCache cache(&db);
+        for (int i = 0; i < NUM_COINS; i++)
+            cache.AddCoin(vOutpoints[i], Coin(CTxOut(i + 1, scriptPubKey), 1, false, false, i), false);
+        cache.SetBestBlock(vOutpoints.back().hash);
+        cache.Flush();
+
+        Coin coin;
+        uint64_t n = 0;
+        while (state.KeepRunning())
+        {
+            // step through the outpoints in an order unrelated to the key order
+            db.GetCoin(vOutpoints[(n * 7919) % NUM_COINS], coin);
+            n++;
+        }
+        assert(!coin.IsSpent());
+    }
+
+    ClearDatadirCache();
+    fs::remove_all(pathTemp);
+}
+
+BENCHMARK(CoinsViewDBFlush1M);
+BENCHMARK(CoinsViewDBRead);
@@ -0,0 +1,57 @@
+// Copyright (c) 2018 The Eccoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "bench.h"
+
+#include "arith_uint256.h"
+#include "chain/tx.h"
+#include "script/interpreter.h"
+#include "script/script.h"
+
+// Signature hashes of every input of a 500-input transaction, the case where
+// legacy signature hashing is quadratic in the number of inputs.
+static CTransaction ManyInputTransaction()
+{
+    const int NUM_INPUTS = 500;
+
+    CTransaction tx;
+    tx.vin.resize(NUM_INPUTS);
+    for (int i = 0; i < NUM_INPUTS; i++)
+    {
+        tx.vin[i].prevout = COutPoint(ArithToUint256(arith_uint256(i + 1)), i % 4);
+        // a typical pay-to-pubkey-hash scriptSig
+        tx.vin[i].scriptSig = CScript() << std::vector<uint8_t>(72, 0x30) << std::vector<uint8_t>(33, 0x02);
+    }
+    CScript scriptPubKey;
+    scriptPubKey << OP_DUP << OP_HASH160 << std::vector<uint8_t>(20, 0x42) << OP_EQUALVERIFY << OP_CHECKSIG;
+    tx.vout.emplace_back(1000000, scriptPubKey);
+    tx.vout.emplace_back(2000000, scriptPubKey);
+    return tx;
+}
+
+static void SignatureHashManyInputs(benchmark::State &state)
+{
+    const CTransaction tx = ManyInputTransaction();
+    const CScript &scriptCode = tx.vout[0].scriptPubKey;
+    while (state.KeepRunning())
+    {
+        for (unsigned int nIn = 0; nIn < tx.vin.size(); nIn++)
+            SignatureHash(scriptCode, tx, nIn, SIGHASH_ALL);
+    }
+}
+
+static void SignatureHashManyInputsPrecomputed(benchmark::State &state)
+{
+    const CTransaction tx = ManyInputTransaction();
+    const CScript &scriptCode = tx.vout[0].scriptPubKey;
+    while (state.KeepRunning())
+    {
+        const PrecomputedTransactionData txdata(tx);
+        for (unsigned int nIn = 0; nIn < tx.vin.size(); nIn++)
+            SignatureHash(scriptCode, tx, nIn, SIGHASH_ALL, &txdata);
+    }
+}
+
+BENCHMARK(SignatureHashManyInputs);
+BENCHMARK(SignatureHashManyInputsPrecomputed);
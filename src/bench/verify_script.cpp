@@ -0,0 +1,134 @@
+// Copyright (c) 2018 The Eccoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "bench.h"
+
+#include "chain/blockindex.h"
+#include "chain/chainman.h"
+#include "init.h"
+#include "key.h"
+#include "networks/netman.h"
+#include "policy/policy.h"
+#include "pubkey.h"
+#include "random.h"
+#include "script/interpreter.h"
+#include "script/script.h"
+#include "script/standard.h"
+
+#include <assert.h>
+
+namespace
+{
+/**
+ * Accepts every signature, so that the benchmarks measure the interpreter
+ * and not the ECDSA verification a real checker spends most of its time on.
+ */
+class CAcceptingSignatureChecker : public BaseSignatureChecker
+{
+public:
+    bool CheckSig(const std::vector<unsigned char> &scriptSig,
+        const std::vector<unsigned char> &vchPubKey,
+        const CScript &scriptCode) const
+    {
+        return true;
+    }
+};
+
+struct CSpend
+{
+    CScript scriptSig;
+    CScript scriptPubKey;
+};
+
+std::vector<CKey> Keys(int nKeys)
+{
+    std::vector<CKey> keys(nKeys);
+    for (CKey &key : keys)
+        key.MakeNewKey(true);
+    return keys;
+}
+
+//! A low-S DER signature of a random hash, followed by SIGHASH_ALL
+std::vector<unsigned char> Signature(const CKey &key)
+{
+    std::vector<unsigned char> vchSig;
+    key.Sign(GetRandHash(), vchSig);
+    vchSig.push_back((unsigned char)SIGHASH_ALL);
+    return vchSig;
+}
+
+CScript MultisigScript(const std::vector<CKey> &keys)
+{
+    CScript script;
+    script << OP_2;
+    for (const CKey &key : keys)
+        script << ToByteVector(key.GetPubKey());
+    script << OP_3 << OP_CHECKMULTISIG;
+    return script;
+}
+
+CSpend P2PKHSpend()
+{
+    const CKey key = Keys(1)[0];
+    const CPubKey pubkey = key.GetPubKey();
+    CSpend spend;
+    spend.scriptPubKey << OP_DUP << OP_HASH160 << ToByteVector(pubkey.GetID()) << OP_EQUALVERIFY << OP_CHECKSIG;
+    spend.scriptSig << Signature(key) << ToByteVector(pubkey);
+    return spend;
+}
+
+//! 2-of-3 multisig wrapped in P2SH
+CSpend P2SHMultisigSpend()
+{
+    const std::vector<CKey> keys = Keys(3);
+    const CScript redeemScript = MultisigScript(keys);
+    CSpend spend;
+    spend.scriptPubKey << OP_HASH160 << ToByteVector(CScriptID(redeemScript)) << OP_EQUAL;
+    spend.scriptSig << OP_0 << Signature(keys[0]) << Signature(keys[1])
+                    << std::vector<unsigned char>(redeemScript.begin(), redeemScript.end());
+    return spend;
+}
+
+//! Bare 2-of-3 multisig
+CSpend MultisigSpend()
+{
+    const std::vector<CKey> keys = Keys(3);
+    CSpend spend;
+    spend.scriptPubKey = MultisigScript(keys);
+    spend.scriptSig << OP_0 << Signature(keys[0]) << Signature(keys[1]);
+    return spend;
+}
+
+//! CHECKSIG looks at the tip to decide whether the signature encoding rules apply, which they do above it
+void SetTipAboveEncodingRules()
+{
+    static CBlockIndex tip;
+    CChain &chain = pnetMan->getChainActive()->chainActive;
+    if (chain.Tip() == nullptr)
+    {
+        tip.nHeight = 1600001;
+        chain.SetTip(&tip);
+    }
+}
+
+void VerifySpend(benchmark::State &state, const CSpend &spend)
+{
+    SetTipAboveEncodingRules();
+    const CAcceptingSignatureChecker checker;
+    while (state.KeepRunning())
+    {
+        ScriptError serror;
+        bool fOk =
+            VerifyScript(spend.scriptSig, spend.scriptPubKey, STANDARD_SCRIPT_VERIFY_FLAGS, checker, &serror);
+        assert(fOk);
+    }
+}
+}
+
+static void VerifyScriptP2PKH(benchmark::State &state) { VerifySpend(state, P2PKHSpend()); }
+static void VerifyScriptP2SHMultisig(benchmark::State &state) { VerifySpend(state, P2SHMultisigSpend()); }
+static void VerifyScriptMultisig(benchmark::State &state) { VerifySpend(state, MultisigSpend()); }
+BENCHMARK(VerifyScriptP2PKH);
+BENCHMARK(VerifyScriptP2SHMultisig);
+BENCHMARK(VerifyScriptMultisig);
@@ -176,3 +176,54 @@ bool UndoReadFromDisk(CBlockUndo &blockundo, const CDiskBlockPos &pos, const uin
 
     return true;
 }
+
+CUndoCache undoCache(DEFAULT_UNDO_CACHE_BLOCKS);
+
+void CUndoCache::Trim()
+{
+    while (vOrder.size() > nMaxBlocks)
+    {
+        mapUndo.erase(vOrder.front());
+        vOrder.pop_front();
+    }
+}
+
+void CUndoCache::SetMaxBlocks(size_t nMaxBlocksIn)
+{
+    LOCK(cs_undocache);
+    nMaxBlocks = nMaxBlocksIn;
+    Trim();
+}
+
+void CUndoCache::Add(const uint256 &hashBlock, CBlockUndo blockundo)
+{
+    LOCK(cs_undocache);
+    if (nMaxBlocks == 0)
+        return;
+    std::map<uint256, CBlockUndo>::iterator it = mapUndo.find(hashBlock);
+    if (it != mapUndo.end())
+    {
+        // A block connected again keeps its place in the order
+        it->second = std::move(blockundo);
+        return;
+    }
+    mapUndo.emplace(hashBlock, std::move(blockundo));
+    vOrder.push_back(hashBlock);
+    Trim();
+}
+
+bool CUndoCache::Get(const uint256 &hashBlock, CBlockUndo &blockundo) const
+{
+    LOCK(cs_undocache);
+    std::map<uint256, CBlockUndo>::const_iterator it = mapUndo.find(hashBlock);
+    if (it == mapUndo.end())
+        return false;
+    blockundo = it->second;
+    return true;
+}
+
+size_t CUndoCache::Size() const
+{
+    LOCK(cs_undocache);
+    return mapUndo.size();
+}
@@ -15,6 +15,12 @@
 #include "sync.h"
 #include "undo.h"
 
+#include <deque>
+#include <map>
+
+/** Default for -undocache, the number of recently connected blocks whose undo data is kept in memory */
+static const unsigned int DEFAULT_UNDO_CACHE_BLOCKS = 100;
+
 /** Translation to a filesystem path */
 fs::path GetBlockPosFilename(const CDiskBlockPos &pos, const char *prefix);
 /** Open a block file (blk?????.dat) */
@@ -35,4 +41,32 @@ bool UndoWriteToDisk(const CBlockUndo &blockundo,
 
 bool UndoReadFromDisk(CBlockUndo &blockundo, const CDiskBlockPos &pos, const uint256 &hashBlock);
 
+/**
+ * The undo data of the most recently connected blocks, so that disconnecting
+ * them again in a reorg does not have to read it back from disk. The oldest
+ * entry is dropped once the cache holds more than nMaxBlocks of them.
+ */
+class CUndoCache
+{
+private:
+    mutable CCriticalSection cs_undocache;
+    size_t nMaxBlocks;
+    std::map<uint256, CBlockUndo> mapUndo;
+    //! Hashes of the blocks in mapUndo, the oldest first
+    std::deque<uint256> vOrder;
+
+    void Trim();
+
+public:
+    explicit CUndoCache(size_t nMaxBlocksIn) : nMaxBlocks(nMaxBlocksIn) {}
+    void SetMaxBlocks(size_t nMaxBlocksIn);
+    //! Remember the undo data of block hashBlock
+    void Add(const uint256 &hashBlock, CBlockUndo blockundo);
+    //! Copy the undo data of block hashBlock to blockundo, if it is cached
+    bool Get(const uint256 &hashBlock, CBlockUndo &blockundo) const;
+    size_t Size() const;
+};
+
+extern CUndoCache undoCache;
+
 #endif
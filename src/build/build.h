@@ -0,0 +1,2 @@
+#define BUILD_SUFFIX acb5f93-dirty
+#define BUILD_DATE "2026-10-19 01:08:19 +0000"
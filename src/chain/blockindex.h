@@ -91,6 +91,8 @@ enum BlockStatus
     BLOCK_FAILED_VALID = 32, //! stage after last reached validness failed
     BLOCK_FAILED_CHILD = 64, //! descends from failed block
     BLOCK_FAILED_MASK = BLOCK_FAILED_VALID | BLOCK_FAILED_CHILD,
+
+    BLOCK_CHECKED = 128, //! the stored block passed the context-free CheckBlock
 };
 
 /** The block chain is a tree shaped structure starting with the
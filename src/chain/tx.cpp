@@ -234,11 +234,21 @@ uint64_t CTransaction::GetCoinAge(uint64_t nCoinAge, bool byValue) const
     if (IsCoinBase())
         return true;
 
+    // Look up the tx index entries of all inputs in one batch
+    std::vector<uint256> vPrevTxid;
+    vPrevTxid.reserve(vin.size());
     for (const CTxIn &txin : vin)
+        vPrevTxid.push_back(txin.prevout.hash);
+    std::vector<CDiskTxPos> vTxIndex;
+    std::vector<bool> vfFound;
+    pblocktree->ReadTxIndex(vPrevTxid, vTxIndex, vfFound);
+
+    for (size_t i = 0; i < vin.size(); i++)
     {
-        CDiskTxPos txindex;
-        if (!pblocktree->ReadTxIndex(txin.prevout.hash, txindex))
+        const CTxIn &txin = vin[i];
+        if (!vfFound[i])
             continue; // previous transaction not in main chain
+        const CDiskTxPos &txindex = vTxIndex[i];
 
         // Read block header
         CBlock block;
@@ -289,11 +299,21 @@ bool CTransaction::GetCoinAge(uint64_t &nCoinAge) const
     if (IsCoinBase())
         return true;
 
+    // Look up the tx index entries of all inputs in one batch
+    std::vector<uint256> vPrevTxid;
+    vPrevTxid.reserve(vin.size());
     for (const CTxIn &txin : vin)
+        vPrevTxid.push_back(txin.prevout.hash);
+    std::vector<CDiskTxPos> vTxIndex;
+    std::vector<bool> vfFound;
+    pblocktree->ReadTxIndex(vPrevTxid, vTxIndex, vfFound);
+
+    for (size_t i = 0; i < vin.size(); i++)
     {
-        CDiskTxPos txindex;
-        if (!pblocktree->ReadTxIndex(txin.prevout.hash, txindex))
+        const CTxIn &txin = vin[i];
+        if (!vfFound[i])
             continue; // previous transaction not in main chain
+        const CDiskTxPos &txindex = vTxIndex[i];
 
         // Read block header
         CBlock block;
@@ -7,7 +7,12 @@
 #ifndef BITCOIN_CHECKQUEUE_H
 #define BITCOIN_CHECKQUEUE_H
 
+#include "sync.h"
+
 #include <algorithm>
+#include <atomic>
+#include <deque>
+#include <memory>
 #include <vector>
 
 #include <boost/thread/condition_variable.hpp>
@@ -26,14 +31,30 @@ class CCheckQueueControl;
   * onto the queue, where they are processed by N-1 worker threads. When
   * the master is done adding work, it temporarily joins the worker pool
   * as an N'th worker, until all jobs are done.
+  *
+  * Every worker has a deque of its own, and Add spreads the checks over
+  * them. A worker takes checks from the back of its own deque and, once
+  * that is empty, steals half of the checks at the front of another one.
+  * Each deque has its own lock, so workers only ever wait for each other
+  * while stealing. The shared mutex is only taken to go to sleep and to
+  * wake up.
   */
 template <typename T>
 class CCheckQueue
 {
 private:
-    //!  Bool to signal to threads to end execution when they are done
+    //! Number of deques, the master's and up to MAX_WORKERS - 1 worker threads'
+    static const size_t MAX_WORKERS = 64;
+
+    struct WorkerDeque
+    {
+        boost::mutex cs;
+        std::deque<T> checks;
+    };
+
+    //! Bool to signal to threads to end execution when they are done
     std::atomic<bool> fShutdown;
-    //! Mutex to protect the inner state
+    //! Mutex that threads sleep on, it does not protect the checks
     boost::mutex mutex;
 
     //! Worker threads block on this when out of work
@@ -42,102 +63,136 @@ private:
     //! Master thread blocks on this when out of work
     boost::condition_variable condMaster;
 
-    //! The queue of elements to be processed.
-    //! As the order of booleans doesn't matter, it is used as a LIFO (stack)
-    std::vector<T> queue;
-
-    //! The number of workers (including the master) that are idle.
-    int nIdle;
+    //! The deque of the master is the first one, the workers' follow
+    std::vector<std::unique_ptr<WorkerDeque> > vDeques;
 
-    //! The total number of workers (including the master).
-    int nTotal;
+    //! Number of worker threads started, not counting the master
+    std::atomic<unsigned int> nWorkers;
 
-    //! The temporary evaluation result.
-    bool fAllOk;
+    //! Number of checks sitting in a deque
+    std::atomic<unsigned int> nQueued;
 
     /**
      * Number of verifications that haven't completed yet.
-     * This includes elements that are no longer queued, but still in the
-     * worker's own batches.
+     * This includes checks that are no longer queued, but still being run.
      */
-    unsigned int nTodo;
+    std::atomic<unsigned int> nTodo;
+
+    //! The temporary evaluation result, cleared by the first failing check
+    std::atomic<bool> fAllOk;
 
-    //! The maximum number of elements to be processed in one batch
+    //! The maximum number of elements taken in one steal
     unsigned int nBatchSize;
 
+    //! Deque the next batch starts on, only used by the master
+    size_t nNextDeque;
+
+    //! Number of deques in use
+    size_t DequeCount() const
+    {
+        // Copy MAX_WORKERS, std::min would bind a reference to it
+        return std::min<size_t>(nWorkers.load() + 1, (size_t)MAX_WORKERS);
+    }
+
+    //! Take a check from the back of deque nDeque
+    bool Pop(size_t nDeque, T &check)
+    {
+        WorkerDeque &deque = *vDeques[nDeque];
+        boost::unique_lock<boost::mutex> lock(deque.cs);
+        if (deque.checks.empty())
+            return false;
+        check.swap(deque.checks.back());
+        deque.checks.pop_back();
+        nQueued--;
+        return true;
+    }
+
+    /**
+     * Move half of the checks of another deque, but at most nBatchSize, to
+     * deque nDeque and take one of them. The victims are tried in turn
+     * starting after nDeque, so that the thieves spread over them.
+     */
+    bool Steal(size_t nDeque, T &check)
+    {
+        const size_t nDeques = DequeCount();
+        std::vector<T> vStolen;
+        for (size_t i = 1; i < nDeques && vStolen.empty(); i++)
+        {
+            WorkerDeque &victim = *vDeques[(nDeque + i) % nDeques];
+            boost::unique_lock<boost::mutex> lock(victim.cs);
+            size_t nSteal = std::min<size_t>(nBatchSize, (victim.checks.size() + 1) / 2);
+            vStolen.resize(nSteal);
+            for (T &stolen : vStolen)
+            {
+                stolen.swap(victim.checks.front());
+                victim.checks.pop_front();
+            }
+        }
+        if (vStolen.empty())
+            return false;
+
+        check.swap(vStolen.back());
+        vStolen.pop_back();
+        nQueued--;
+        if (!vStolen.empty())
+        {
+            WorkerDeque &deque = *vDeques[nDeque];
+            boost::unique_lock<boost::mutex> lock(deque.cs);
+            for (T &stolen : vStolen)
+            {
+                deque.checks.push_back(T());
+                deque.checks.back().swap(stolen);
+            }
+        }
+        return true;
+    }
+
+    //! Run check unless an earlier one failed, and count it as done
+    void Run(T &check)
+    {
+        if (fAllOk.load(std::memory_order_relaxed) && !check())
+            fAllOk.store(false, std::memory_order_relaxed);
+        // Release the resources of the check before it is counted
+        T().swap(check);
+        if (--nTodo == 0)
+        {
+            // We processed the last element; inform the master it can exit and return the result
+            boost::unique_lock<boost::mutex> lock(mutex);
+            condMaster.notify_one();
+        }
+    }
+
     /** Internal function that does bulk of the verification work. */
-    bool Loop(bool fMaster = false)
+    bool Loop(size_t nDeque, bool fMaster = false)
     {
-        boost::condition_variable &cond = fMaster ? condMaster : condWorker;
-        std::vector<T> vChecks;
-        vChecks.reserve(nBatchSize);
-        unsigned int nNow = 0;
-        bool fOk = true;
+        T check;
         do
         {
+            while (Pop(nDeque, check) || Steal(nDeque, check))
+                Run(check);
+
+            boost::unique_lock<boost::mutex> lock(mutex);
+            if (fMaster)
             {
-                boost::unique_lock<boost::mutex> lock(mutex);
-                // first do the clean-up of the previous loop run (allowing us to do it in the same critsect)
-                if (nNow)
-                {
-                    fAllOk &= fOk;
-                    nTodo -= nNow;
-                    if (nTodo == 0 && !fMaster)
-                        // We processed the last element; inform the master it can exit and return the result
-                        condMaster.notify_one();
-                }
-                else
-                {
-                    // first iteration
-                    nTotal++;
-                }
-                // logically, the do loop starts here
-                while (queue.empty())
-                {
-                    if (fMaster && nTodo == 0)
-                    {
-                        nTotal--;
-                        bool fRet = fAllOk;
-                        // reset the status for new work later
-                        if (fMaster)
-                            fAllOk = true;
-                        // return the current status
-                        return fRet;
-                    }
-                    nIdle++;
-                    cond.wait(lock); // wait
-                    nIdle--;
-                    if (nTodo == 0 && fShutdown.load() == true)
-                    {
-                        return true;
-                    }
-                }
-                // Decide how many work units to process now.
-                // * Do not try to do everything at once, but aim for increasingly smaller batches so
-                //   all workers finish approximately simultaneously.
-                // * Try to account for idle jobs which will instantly start helping.
-                // * Don't do batches smaller than 1 (duh), or larger than nBatchSize.
-                nNow = std::max(1U, std::min(nBatchSize, (unsigned int)queue.size() / (nTotal + nIdle + 1)));
-                vChecks.resize(nNow);
-                for (unsigned int i = 0; i < nNow; i++)
+                // The master adds all checks itself, so none can appear
+                // while it waits for the checks still being run
+                while (nTodo.load() != 0 && nQueued.load() == 0)
+                    condMaster.wait(lock);
+                if (nTodo.load() == 0)
                 {
-                    // We want the lock on the mutex to be as short as possible, so swap jobs from the global
-                    // queue to the local batch vector instead of copying.
-                    vChecks[i].swap(queue.back());
-                    queue.pop_back();
+                    // return the current status and reset it for new work later
+                    return fAllOk.exchange(true);
                 }
-                // Check whether we need to do work at all
-                fOk = fAllOk;
             }
-            // execute work
-            for (T &check : vChecks)
+            else
             {
-                if (fOk)
+                while (nQueued.load() == 0)
                 {
-                    fOk = check();
+                    if (fShutdown.load())
+                        return true;
+                    condWorker.wait(lock);
                 }
             }
-            vChecks.clear();
         } while (true);
     }
 
@@ -147,36 +202,58 @@ public:
 
     //! Create a new check queue
     explicit CCheckQueue(unsigned int nBatchSizeIn)
-        : nIdle(0), nTotal(0), fAllOk(true), nTodo(0), nBatchSize(nBatchSizeIn)
+        : fShutdown(false), nWorkers(0), nQueued(0), nTodo(0), fAllOk(true), nBatchSize(std::max(1U, nBatchSizeIn)),
+          nNextDeque(0)
     {
-        fShutdown.store(false);
+        for (size_t i = 0; i < MAX_WORKERS; i++)
+            vDeques.emplace_back(new WorkerDeque());
     }
 
     //! Worker thread
-    void Thread() { Loop(); }
+    void Thread()
+    {
+        // Threads beyond MAX_WORKERS share deques
+        size_t nDeque = 1 + nWorkers++ % (MAX_WORKERS - 1);
+        Loop(nDeque);
+    }
     //! Wait until execution finishes, and return whether all evaluations were successful.
-    bool Wait() { return Loop(true); }
+    bool Wait() { return Loop(0, true); }
     void Interrupt()
     {
         fShutdown.store(true);
+        boost::unique_lock<boost::mutex> lock(mutex);
         condWorker.notify_all();
         condMaster.notify_all();
     }
     //! Add a batch of checks to the queue
     void Add(std::vector<T> &vChecks)
     {
-        boost::unique_lock<boost::mutex> lock(mutex);
-        for (T &check : vChecks)
+        if (vChecks.empty())
+            return;
+        nTodo += vChecks.size();
+        nQueued += vChecks.size();
+
+        // Deal the checks out in contiguous runs, one per deque, continuing
+        // with the deque after the one the previous batch ended on
+        const size_t nDeques = DequeCount();
+        const size_t nPerDeque = (vChecks.size() + nDeques - 1) / nDeques;
+        for (size_t nStart = 0; nStart < vChecks.size(); nStart += nPerDeque)
         {
-            queue.push_back(T());
-            check.swap(queue.back());
+            WorkerDeque &deque = *vDeques[nNextDeque++ % nDeques];
+            boost::unique_lock<boost::mutex> lock(deque.cs);
+            for (size_t j = nStart; j < std::min(vChecks.size(), nStart + nPerDeque); j++)
+            {
+                deque.checks.push_back(T());
+                deque.checks.back().swap(vChecks[j]);
+            }
         }
-        nTodo += vChecks.size();
+
+        boost::unique_lock<boost::mutex> lock(mutex);
         if (vChecks.size() == 1)
         {
             condWorker.notify_one();
         }
-        else if (vChecks.size() > 1)
+        else
         {
             condWorker.notify_all();
         }
@@ -19,6 +19,19 @@ static const Coin emptyCoin;
 
 bool CCoinsView::GetCoin(const COutPoint &outpoint, Coin &coin) const { return false; }
 bool CCoinsView::HaveCoin(const COutPoint &outpoint) const { return false; }
+size_t CCoinsView::GetCoins(const std::vector<COutPoint> &outpoints, std::vector<Coin> &coins) const
+{
+    size_t nFound = 0;
+    coins.resize(outpoints.size());
+    for (size_t i = 0; i < outpoints.size(); i++)
+    {
+        if (GetCoin(outpoints[i], coins[i]))
+            nFound++;
+        else
+            coins[i].Clear();
+    }
+    return nFound;
+}
 uint256 CCoinsView::GetBestBlock() const { return uint256(); }
 bool CCoinsView::BatchWrite(CCoinsMap &mapCoins,
     const uint256 &hashBlock,
@@ -28,9 +41,15 @@ bool CCoinsView::BatchWrite(CCoinsMap &mapCoins,
     return false;
 }
 CCoinsViewCursor *CCoinsView::Cursor() const { return nullptr; }
+void CCoinsView::UpdateCommitment(const CUTXOCommitment &delta) {}
+bool CCoinsView::GetCommitment(CUTXOCommitment &commitment) const { return false; }
 CCoinsViewBacked::CCoinsViewBacked(CCoinsView *viewIn) : base(viewIn) {}
 bool CCoinsViewBacked::GetCoin(const COutPoint &outpoint, Coin &coin) const { return base->GetCoin(outpoint, coin); }
 bool CCoinsViewBacked::HaveCoin(const COutPoint &outpoint) const { return base->HaveCoin(outpoint); }
+size_t CCoinsViewBacked::GetCoins(const std::vector<COutPoint> &outpoints, std::vector<Coin> &coins) const
+{
+    return base->GetCoins(outpoints, coins);
+}
 uint256 CCoinsViewBacked::GetBestBlock() const { return base->GetBestBlock(); }
 void CCoinsViewBacked::SetBackend(CCoinsView &viewIn) { base = &viewIn; }
 bool CCoinsViewBacked::BatchWrite(CCoinsMap &mapCoins,
@@ -41,6 +60,8 @@ bool CCoinsViewBacked::BatchWrite(CCoinsMap &mapCoins,
     return base->BatchWrite(mapCoins, hashBlock, nBestCoinHeight, nChildCachedCoinsUsage);
 }
 CCoinsViewCursor *CCoinsViewBacked::Cursor() const { return base->Cursor(); }
+void CCoinsViewBacked::UpdateCommitment(const CUTXOCommitment &delta) { base->UpdateCommitment(delta); }
+bool CCoinsViewBacked::GetCommitment(CUTXOCommitment &commitment) const { return base->GetCommitment(commitment); }
 size_t CCoinsViewBacked::EstimateSize() const { return base->EstimateSize(); }
 SaltedOutpointHasher::SaltedOutpointHasher()
     : k0(GetRand(std::numeric_limits<uint64_t>::max())), k1(GetRand(std::numeric_limits<uint64_t>::max()))
@@ -115,6 +136,62 @@ CCoinsMap::iterator CCoinsViewCache::FetchCoin(const COutPoint &outpoint, CDefer
     return ret;
 }
 
+size_t CCoinsViewCache::GetCoins(const std::vector<COutPoint> &outpoints, std::vector<Coin> &coins) const
+{
+    size_t nFound = 0;
+    coins.resize(outpoints.size());
+    std::vector<COutPoint> vMissing;
+    std::vector<size_t> vMissingPos;
+    {
+        READLOCK(cs_utxo);
+        for (size_t i = 0; i < outpoints.size(); i++)
+        {
+            CCoinsMap::const_iterator it = cacheCoins.find(outpoints[i]);
+            if (it != cacheCoins.end())
+            {
+                coins[i] = it->second.coin;
+                if (!coins[i].IsSpent())
+                    nFound++;
+            }
+            else
+            {
+                vMissing.push_back(outpoints[i]);
+                vMissingPos.push_back(i);
+            }
+        }
+    }
+    if (vMissing.empty())
+        return nFound;
+
+    std::vector<Coin> vFetched;
+    base->GetCoins(vMissing, vFetched);
+
+    // Same as FetchCoin, but for the whole batch under a single exclusive lock
+    WRITELOCK(cs_utxo);
+    for (size_t j = 0; j < vMissing.size(); j++)
+    {
+        Coin &coin = coins[vMissingPos[j]];
+        if (vFetched[j].IsSpent())
+        {
+            coin.Clear();
+            continue;
+        }
+        CCoinsMap::iterator it;
+        bool inserted;
+        std::tie(it, inserted) = cacheCoins.emplace(std::piecewise_construct, std::forward_as_tuple(vMissing[j]),
+            std::forward_as_tuple(std::move(vFetched[j])));
+        if (inserted)
+        {
+            cachedCoinsUsage += it->second.coin.DynamicMemoryUsage();
+            if (nBestCoinHeight < it->second.coin.nHeight)
+                nBestCoinHeight = it->second.coin.nHeight;
+        }
+        coin = it->second.coin;
+        nFound++;
+    }
+    return nFound;
+}
+
 bool CCoinsViewCache::GetCoin(const COutPoint &outpoint, Coin &coin) const
 {
     CDeferredSharedLocker lock(cs_utxo);
@@ -131,7 +208,7 @@ void CCoinsViewCache::AddCoin(const COutPoint &outpoint, Coin &&coin, bool possi
 {
     WRITELOCK(cs_utxo);
     assert(!coin.IsSpent());
-    if (coin.out.scriptPubKey.IsUnspendable())
+    if (coin.out.IsUnspendable())
         return;
     CCoinsMap::iterator it;
     bool inserted;
@@ -150,6 +227,11 @@ void CCoinsViewCache::AddCoin(const COutPoint &outpoint, Coin &&coin, bool possi
         }
         fresh = !(it->second.flags & CCoinsCacheEntry::DIRTY);
     }
+    else if (!it->second.coin.IsSpent())
+    {
+        commitmentDelta.SpendCoin(outpoint, it->second.coin);
+    }
+    commitmentDelta.AddCoin(outpoint, coin);
     it->second.coin = std::move(coin);
     it->second.flags |= CCoinsCacheEntry::DIRTY | (fresh ? CCoinsCacheEntry::FRESH : 0);
     cachedCoinsUsage += it->second.coin.DynamicMemoryUsage();
@@ -163,6 +245,8 @@ bool CCoinsViewCache::SpendCoin(const COutPoint &outpoint, Coin *moveout)
     CCoinsMap::iterator it = FetchCoin(outpoint, nullptr);
     if (it == cacheCoins.end())
         return false;
+    if (!it->second.coin.IsSpent())
+        commitmentDelta.SpendCoin(outpoint, it->second.coin);
     cachedCoinsUsage -= it->second.coin.DynamicMemoryUsage();
     if (moveout)
     {
@@ -297,9 +381,26 @@ bool CCoinsViewCache::BatchWrite(CCoinsMap &mapCoins,
     return true;
 }
 
+void CCoinsViewCache::UpdateCommitment(const CUTXOCommitment &delta)
+{
+    WRITELOCK(cs_utxo);
+    commitmentDelta.Combine(delta);
+}
+
+bool CCoinsViewCache::GetCommitment(CUTXOCommitment &commitment) const
+{
+    READLOCK(cs_utxo);
+    if (!base->GetCommitment(commitment))
+        return false;
+    commitment.Combine(commitmentDelta);
+    return true;
+}
+
 bool CCoinsViewCache::Flush()
 {
     WRITELOCK(cs_utxo);
+    base->UpdateCommitment(commitmentDelta);
+    commitmentDelta.SetNull();
     bool fOk = base->BatchWrite(cacheCoins, hashBlock, nBestCoinHeight, cachedCoinsUsage);
     return fOk;
 }
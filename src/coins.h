@@ -25,6 +25,7 @@
 #include "serialize.h"
 #include "sync.h"
 #include "uint256.h"
+#include "utxocommitment.h"
 
 #include <assert.h>
 #include <stdint.h>
@@ -60,12 +61,15 @@ struct CCoinsStats
  * Serialized format:
  * - VARINT((coinbase ? 1 : 0) | (height << 1))
  * - the non-spent CTxOut (via CTxOutCompressor)
+ *
+ * In memory the output is held in compact form (see CCompactTxOut) so that
+ * the common script templates do not need a heap allocation.
  */
 class Coin
 {
 public:
-    //! unspent transaction output
-    CTxOut out;
+    //! unspent transaction output, in compact form
+    CCompactTxOut out;
 
     //! whether containing transaction was a coinbase
     uint8_t fCoinBase : 1;
@@ -117,7 +121,7 @@ public:
         ::Serialize(s, VARINT(code));
         ::Serialize(s, VARINT(nHeight));
         ::Serialize(s, VARINT(nTime));
-        ::Serialize(s, CTxOutCompressor(REF(out)));
+        ::Serialize(s, out);
     }
 
     template <typename Stream>
@@ -129,11 +133,11 @@ public:
         fCoinStake = code & 2;
         ::Unserialize(s, VARINT(nHeight));
         ::Unserialize(s, VARINT(nTime));
-        ::Unserialize(s, REF(CTxOutCompressor(out)));
+        ::Unserialize(s, out);
     }
 
     bool IsSpent() const { return out.IsNull(); }
-    size_t DynamicMemoryUsage() const { return memusage::DynamicUsage(out.scriptPubKey); }
+    size_t DynamicMemoryUsage() const { return out.DynamicMemoryUsage(); }
     std::string ToString()
     {
         return strprintf("%s, %u, %u, %u, %" PRIu64 "", out.ToString(), fCoinBase, fCoinStake, nHeight, nTime);
@@ -203,6 +207,10 @@ public:
     //! This may (but cannot always) return true for spent outputs.
     virtual bool HaveCoin(const COutPoint &outpoint) const;
 
+    //! Retrieve the Coins for several outpoints at once. coins[i] belongs to outpoints[i]
+    //! and is left spent if it was not found. Returns the number of coins found.
+    virtual size_t GetCoins(const std::vector<COutPoint> &outpoints, std::vector<Coin> &coins) const;
+
     //! Retrieve the block hash whose state this CCoinsView currently represents
     virtual uint256 GetBestBlock() const;
 
@@ -216,6 +224,13 @@ public:
     //! Get a cursor to iterate over the whole state
     virtual CCoinsViewCursor *Cursor() const;
 
+    //! Hand over the changes a child cache made to the UTXO set commitment. They
+    //! belong to the coins passed in by the BatchWrite call that follows.
+    virtual void UpdateCommitment(const CUTXOCommitment &delta);
+
+    //! Get the commitment to the coins represented by this view, if it is known
+    virtual bool GetCommitment(CUTXOCommitment &commitment) const;
+
     //! As we use CCoinsViews polymorphically, have a virtual destructor
     virtual ~CCoinsView() {}
     //! Estimate database size (0 if not implemented)
@@ -233,6 +248,7 @@ public:
     CCoinsViewBacked(CCoinsView *viewIn);
     bool GetCoin(const COutPoint &outpoint, Coin &coin) const override;
     bool HaveCoin(const COutPoint &outpoint) const override;
+    size_t GetCoins(const std::vector<COutPoint> &outpoints, std::vector<Coin> &coins) const override;
     uint256 GetBestBlock() const override;
     void SetBackend(CCoinsView &viewIn);
     bool BatchWrite(CCoinsMap &mapCoins,
@@ -240,6 +256,8 @@ public:
         const uint64_t nBestCoinHeight,
         size_t &nChildCachedCoinsUsage) override;
     CCoinsViewCursor *Cursor() const override;
+    void UpdateCommitment(const CUTXOCommitment &delta) override;
+    bool GetCommitment(CUTXOCommitment &commitment) const override;
     size_t EstimateSize() const override;
 };
 
@@ -261,6 +279,8 @@ protected:
     mutable CSharedCriticalSection csCacheInsert;
     /* Cached dynamic memory usage for the inner Coin objects. */
     mutable size_t cachedCoinsUsage;
+    /* Changes to the UTXO set commitment made through this cache since the last Flush. */
+    CUTXOCommitment commitmentDelta;
 
 
 public:
@@ -269,12 +289,19 @@ public:
     // Standard CCoinsView methods
     bool GetCoin(const COutPoint &outpoint, Coin &coin) const;
     bool HaveCoin(const COutPoint &outpoint) const;
+    /**
+     * Coins that are not in this cache yet are fetched from the backing view
+     * in one batch and added to the cache, so this doubles as a prefetch.
+     */
+    size_t GetCoins(const std::vector<COutPoint> &outpoints, std::vector<Coin> &coins) const;
     uint256 GetBestBlock() const;
     void SetBestBlock(const uint256 &hashBlock);
     bool BatchWrite(CCoinsMap &mapCoins,
         const uint256 &hashBlock,
         const uint64_t nBestCoinHeight,
         size_t &nChildCachedCoinsUsage);
+    void UpdateCommitment(const CUTXOCommitment &delta);
+    bool GetCommitment(CUTXOCommitment &commitment) const;
 
     /**
      * Check if we have the given utxo already loaded in this cache.
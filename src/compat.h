@@ -87,6 +87,11 @@ typedef u_int SOCKET;
 #define THREAD_PRIORITY_ABOVE_NORMAL (-2)
 #endif
 
+// Linux has epoll, which unlike select() is not limited to sockets below FD_SETSIZE
+#if defined(__linux__)
+#define USE_EPOLL
+#endif
+
 bool static inline IsSelectableSocket(SOCKET s)
 {
 #ifdef WIN32
@@ -84,7 +84,7 @@ bool CScriptCompressor::Compress(std::vector<unsigned char> &out) const
     return false;
 }
 
-unsigned int CScriptCompressor::GetSpecialSize(unsigned int nSize) const
+unsigned int CScriptCompressor::GetSpecialSize(unsigned int nSize)
 {
     if (nSize == 0 || nSize == 1)
         return 20;
@@ -94,6 +94,11 @@ unsigned int CScriptCompressor::GetSpecialSize(unsigned int nSize) const
 }
 
 bool CScriptCompressor::Decompress(unsigned int nSize, const std::vector<unsigned char> &in)
+{
+    return Decompress(nSize, &in[0]);
+}
+
+bool CScriptCompressor::Decompress(unsigned int nSize, const unsigned char *in)
 {
     switch (nSize)
     {
@@ -102,7 +107,7 @@ bool CScriptCompressor::Decompress(unsigned int nSize, const std::vector<unsigne
         script[0] = OP_DUP;
         script[1] = OP_HASH160;
         script[2] = 20;
-        memcpy(&script[3], &in[0], 20);
+        memcpy(&script[3], in, 20);
         script[23] = OP_EQUALVERIFY;
         script[24] = OP_CHECKSIG;
         return true;
@@ -110,7 +115,7 @@ bool CScriptCompressor::Decompress(unsigned int nSize, const std::vector<unsigne
         script.resize(23);
         script[0] = OP_HASH160;
         script[1] = 20;
-        memcpy(&script[2], &in[0], 20);
+        memcpy(&script[2], in, 20);
         script[22] = OP_EQUAL;
         return true;
     case 0x02:
@@ -118,14 +123,14 @@ bool CScriptCompressor::Decompress(unsigned int nSize, const std::vector<unsigne
         script.resize(35);
         script[0] = 33;
         script[1] = nSize;
-        memcpy(&script[2], &in[0], 32);
+        memcpy(&script[2], in, 32);
         script[34] = OP_CHECKSIG;
         return true;
     case 0x04:
     case 0x05:
         unsigned char vch[33] = {};
         vch[0] = nSize - 2;
-        memcpy(&vch[1], &in[0], 32);
+        memcpy(&vch[1], in, 32);
         CPubKey pubkey(&vch[0], &vch[33]);
         if (!pubkey.Decompress())
             return false;
@@ -200,3 +205,45 @@ uint64_t CTxOutCompressor::DecompressAmount(uint64_t x)
     }
     return n;
 }
+
+void CCompactTxOut::SetScriptPubKey(const CScript &script)
+{
+    CScriptCompressor compressor(const_cast<CScript &>(script));
+    CKeyID keyID;
+    if (compressor.IsToKeyID(keyID))
+    {
+        nScriptType = 0x00;
+        vchScript.assign(keyID.begin(), keyID.end());
+        return;
+    }
+    CScriptID scriptID;
+    if (compressor.IsToScriptID(scriptID))
+    {
+        nScriptType = 0x01;
+        vchScript.assign(scriptID.begin(), scriptID.end());
+        return;
+    }
+    // Only compressed pubkeys, uncompressed ones are expensive to rebuild
+    if (script.size() == 35 && script[0] == 33 && script[34] == OP_CHECKSIG && (script[1] == 0x02 || script[1] == 0x03))
+    {
+        nScriptType = script[1];
+        vchScript.assign(&script[2], &script[34]);
+        return;
+    }
+    nScriptType = SCRIPT_RAW;
+    vchScript.assign(script.begin(), script.end());
+}
+
+CScript CCompactTxOut::GetScriptPubKey() const
+{
+    CScript script;
+    if (nScriptType == SCRIPT_RAW)
+    {
+        script.assign(vchScript.begin(), vchScript.end());
+    }
+    else
+    {
+        CScriptCompressor(script).Decompress(nScriptType, vchScript.data());
+    }
+    return script;
+}
@@ -9,6 +9,8 @@
 #define BITCOIN_COMPRESSOR_H
 
 #include "chain/tx.h"
+#include "memusage.h"
+#include "prevector.h"
 #include "script/script.h"
 #include "serialize.h"
 
@@ -31,6 +33,8 @@ class CScriptID;
  */
 class CScriptCompressor
 {
+    friend class CCompactTxOut;
+
 private:
     /**
      * make this static for now (there are only 6 special scripts defined) this
@@ -55,8 +59,9 @@ protected:
     bool IsToPubKey(CPubKey &pubkey) const;
 
     bool Compress(std::vector<uint8_t> &out) const;
-    unsigned int GetSpecialSize(unsigned int nSize) const;
+    static unsigned int GetSpecialSize(unsigned int nSize);
     bool Decompress(unsigned int nSize, const std::vector<uint8_t> &out);
+    bool Decompress(unsigned int nSize, const uint8_t *in);
 
 public:
     CScriptCompressor(CScript &scriptIn) : script(scriptIn) {}
@@ -133,4 +138,126 @@ public:
     }
 };
 
+/**
+ * In-memory compact form of a CTxOut, used by the coins cache.
+ *
+ * Scripts matching one of the CScriptCompressor templates that are cheap to
+ * rebuild (pay to pubkey hash, pay to script hash and pay to compressed pubkey)
+ * are kept as their 20 or 32 byte payload, so they always fit inline without a
+ * heap allocation. The full script is rebuilt on access. All other scripts,
+ * including uncompressed pubkeys which would need an EC point decompression on
+ * every access, are kept verbatim.
+ *
+ * The serialization is identical to CTxOutCompressor.
+ */
+class CCompactTxOut
+{
+private:
+    //! script types 0x00-0x03 of CScriptCompressor are stored as payload only
+    static const uint8_t nCompactScripts = 4;
+    static const uint8_t SCRIPT_RAW = 0xff;
+
+    //! CScriptCompressor special script id, or SCRIPT_RAW
+    uint8_t nScriptType;
+    //! the template payload, or the whole script if nScriptType is SCRIPT_RAW
+    prevector<32, uint8_t> vchScript;
+
+public:
+    CAmount nValue;
+
+    CCompactTxOut() { SetNull(); }
+    explicit CCompactTxOut(const CTxOut &txout) { Set(txout); }
+    void Set(const CTxOut &txout)
+    {
+        nValue = txout.nValue;
+        SetScriptPubKey(txout.scriptPubKey);
+    }
+
+    void SetNull()
+    {
+        nValue = -1;
+        nScriptType = SCRIPT_RAW;
+        // prevector::clear() does not release memory
+        vchScript.clear();
+        vchScript.shrink_to_fit();
+    }
+
+    bool IsNull() const { return (nValue == -1); }
+    void SetScriptPubKey(const CScript &script);
+    CScript GetScriptPubKey() const;
+    CTxOut GetTxOut() const { return CTxOut(nValue, GetScriptPubKey()); }
+    //! Same as GetScriptPubKey().IsUnspendable() without rebuilding the script
+    bool IsUnspendable() const
+    {
+        return nScriptType == SCRIPT_RAW && !vchScript.empty() && vchScript[0] == OP_RETURN;
+    }
+
+    //! Same as GetScriptPubKey().IsPayToScriptHash() without rebuilding the script
+    bool IsPayToScriptHash() const { return nScriptType == 0x01; }
+    size_t DynamicMemoryUsage() const { return memusage::DynamicUsage(vchScript); }
+    std::string ToString() const { return GetTxOut().ToString(); }
+    friend bool operator==(const CCompactTxOut &a, const CCompactTxOut &b)
+    {
+        return (a.nValue == b.nValue && a.nScriptType == b.nScriptType && a.vchScript == b.vchScript);
+    }
+
+    friend bool operator!=(const CCompactTxOut &a, const CCompactTxOut &b) { return !(a == b); }
+    template <typename Stream>
+    void Serialize(Stream &s) const
+    {
+        uint64_t nVal = CTxOutCompressor::CompressAmount(nValue);
+        s << VARINT(nVal);
+        if (nScriptType != SCRIPT_RAW)
+        {
+            unsigned int nSize = nScriptType;
+            s << VARINT(nSize);
+            s << CFlatData((void *)vchScript.data(), (void *)(vchScript.data() + vchScript.size()));
+            return;
+        }
+        CScript script(vchScript.data(), vchScript.data() + vchScript.size());
+        s << CScriptCompressor(script);
+    }
+
+    template <typename Stream>
+    void Unserialize(Stream &s)
+    {
+        uint64_t nVal = 0;
+        s >> VARINT(nVal);
+        nValue = CTxOutCompressor::DecompressAmount(nVal);
+        unsigned int nSize = 0;
+        s >> VARINT(nSize);
+        if (nSize < nCompactScripts)
+        {
+            nScriptType = nSize;
+            vchScript.resize(CScriptCompressor::GetSpecialSize(nSize));
+            s >> REF(CFlatData(vchScript));
+            return;
+        }
+        // Everything else is rebuilt the same way CScriptCompressor does it
+        CScript script;
+        if (nSize < CScriptCompressor::nSpecialScripts)
+        {
+            std::vector<uint8_t> vch(CScriptCompressor::GetSpecialSize(nSize), 0x00);
+            s >> REF(CFlatData(vch));
+            CScriptCompressor(script).Decompress(nSize, vch);
+        }
+        else
+        {
+            nSize -= CScriptCompressor::nSpecialScripts;
+            if (nSize > MAX_SCRIPT_SIZE)
+            {
+                // Overly long script, replace with a short invalid one
+                script << OP_RETURN;
+                s.ignore(nSize);
+            }
+            else
+            {
+                script.resize(nSize);
+                s >> REF(CFlatData(script));
+            }
+        }
+        SetScriptPubKey(script);
+    }
+};
+
 #endif // BITCOIN_COMPRESSOR_H
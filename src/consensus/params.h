@@ -60,6 +60,8 @@ struct Params
     int64_t nTargetSpacing;
     int64_t nTargetTimespan;
     int64_t DifficultyAdjustmentInterval() const { return nTargetTimespan / nTargetSpacing; }
+    /** Scripts of this block and its ancestors are assumed valid, unless -assumevalid overrides it */
+    uint256 defaultAssumeValid;
 };
 } // namespace Consensus
 
@@ -188,8 +188,8 @@ unsigned int GetP2SHSigOpCount(const CTransaction &tx, const CCoinsViewCache &in
     {
         CoinAccessor coin(inputs, tx.vin[i].prevout);
         assert(!coin->IsSpent());
-        if (coin && coin->out.scriptPubKey.IsPayToScriptHash())
-            nSigOps += coin->out.scriptPubKey.GetSigOpCount(tx.vin[i].scriptSig);
+        if (coin && coin->out.IsPayToScriptHash())
+            nSigOps += coin->out.GetScriptPubKey().GetSigOpCount(tx.vin[i].scriptSig);
     }
     return nSigOps;
 }
@@ -0,0 +1,259 @@
+// This file is part of the Eccoin project
+// Copyright (c) 2016 Jeremy Rubin
+// Copyright (c) 2018 The Eccoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef BITCOIN_CUCKOOCACHE_H
+#define BITCOIN_CUCKOOCACHE_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdint.h>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * A fixed-size set of hashes used by the validation caches.
+ *
+ * Every element has eight possible slots, picked by eight hash functions. An
+ * insert puts the element into the first of its slots that may be reused and
+ * otherwise moves an older element on to one of its other slots, up to a depth
+ * limit. Nothing is ever allocated after setup(), so the memory use is exactly
+ * what was asked for.
+ *
+ * Lookups only read the table and erasing only flips an atomic bit, so any
+ * number of threads may call contains() at the same time. insert() and setup()
+ * need exclusive access; the callers guard the cache with a shared mutex.
+ *
+ * Elements are evicted by generation: the table keeps one epoch bit per slot,
+ * and once enough of the current generation is still in use the whole
+ * generation is aged and its slots become reusable. Elements are thereby
+ * evicted roughly in insertion order without keeping any ordering structure.
+ */
+namespace CuckooCache
+{
+/** Bit set of which every bit may be set or cleared concurrently */
+class bit_packed_atomic_flags
+{
+    std::unique_ptr<std::atomic<uint8_t>[]> mem;
+
+public:
+    bit_packed_atomic_flags() = delete;
+
+    //! All flags start set
+    explicit bit_packed_atomic_flags(uint32_t size)
+    {
+        size = (size + 7) / 8;
+        mem.reset(new std::atomic<uint8_t>[size]);
+        for (uint32_t i = 0; i < size; ++i)
+            mem[i].store(0xFF);
+    }
+
+    //! Replace the flags with size set ones, not thread safe
+    void setup(uint32_t size)
+    {
+        bit_packed_atomic_flags d(size);
+        std::swap(mem, d.mem);
+    }
+
+    void bit_set(uint32_t s) { mem[s >> 3].fetch_or(1 << (s & 7), std::memory_order_relaxed); }
+    void bit_unset(uint32_t s) { mem[s >> 3].fetch_and(~(1 << (s & 7)), std::memory_order_relaxed); }
+    bool bit_is_set(uint32_t s) const { return (1 << (s & 7)) & mem[s >> 3].load(std::memory_order_relaxed); }
+};
+
+/**
+ * The cache itself. Hash must provide operator()<0>() to operator()<7>() that
+ * map an element to independent, uniformly distributed 32-bit values. Since
+ * the elements stored here are salted hashes, that is just picking eight
+ * different words of the element.
+ */
+template <typename Element, typename Hash>
+class cache
+{
+    static_assert(std::is_trivially_destructible<Element>::value, "Elements are never destroyed");
+
+    //! Size of a cache line, the table starts on a line boundary
+    static const size_t CACHE_LINE_SIZE = 64;
+
+    std::unique_ptr<unsigned char[]> mem;
+    Element *table;
+    uint32_t size;
+
+    //! Slots that may be overwritten, set when an element was erased or aged
+    mutable bit_packed_atomic_flags collection_flags;
+    //! Generation of each slot, true for the current one
+    std::vector<bool> epoch_flags;
+    //! Inserts left before the current generation is looked at again
+    uint32_t epoch_heuristic_counter;
+    //! Number of live elements of the current generation that ages it
+    uint32_t epoch_size;
+    //! Maximum number of elements moved by one insert
+    uint8_t depth_limit;
+    const Hash hash_function;
+
+    //! Map the hashes of e onto [0, size) without a division
+    std::array<uint32_t, 8> compute_hashes(const Element &e) const
+    {
+        return {{(uint32_t)(((uint64_t)hash_function.template operator()<0>(e) * (uint64_t)size) >> 32),
+            (uint32_t)(((uint64_t)hash_function.template operator()<1>(e) * (uint64_t)size) >> 32),
+            (uint32_t)(((uint64_t)hash_function.template operator()<2>(e) * (uint64_t)size) >> 32),
+            (uint32_t)(((uint64_t)hash_function.template operator()<3>(e) * (uint64_t)size) >> 32),
+            (uint32_t)(((uint64_t)hash_function.template operator()<4>(e) * (uint64_t)size) >> 32),
+            (uint32_t)(((uint64_t)hash_function.template operator()<5>(e) * (uint64_t)size) >> 32),
+            (uint32_t)(((uint64_t)hash_function.template operator()<6>(e) * (uint64_t)size) >> 32),
+            (uint32_t)(((uint64_t)hash_function.template operator()<7>(e) * (uint64_t)size) >> 32)}};
+    }
+
+    static uint32_t invalid() { return ~(uint32_t)0; }
+    void allow_erase(uint32_t n) const { collection_flags.bit_set(n); }
+    void please_keep(uint32_t n) const { collection_flags.bit_unset(n); }
+
+    /**
+     * Age the current generation once enough of it is still in use. Counting
+     * is a scan over the whole table, so it is only done again after as many
+     * inserts as could have made the generation full.
+     */
+    void epoch_check()
+    {
+        if (epoch_heuristic_counter != 0)
+        {
+            --epoch_heuristic_counter;
+            return;
+        }
+        uint32_t epoch_unused_count = 0;
+        for (uint32_t i = 0; i < size; ++i)
+            epoch_unused_count += epoch_flags[i] && !collection_flags.bit_is_set(i);
+        if (epoch_unused_count >= epoch_size)
+        {
+            for (uint32_t i = 0; i < size; ++i)
+            {
+                if (epoch_flags[i])
+                {
+                    epoch_flags[i] = false;
+                    allow_erase(i);
+                }
+            }
+            epoch_heuristic_counter = epoch_size;
+        }
+        else
+        {
+            epoch_heuristic_counter = std::max(
+                (uint32_t)1, std::max(epoch_size / 16, epoch_size - std::min(epoch_size, epoch_unused_count)));
+        }
+    }
+
+public:
+    cache()
+        : table(nullptr), size(0), collection_flags(0), epoch_heuristic_counter(0), epoch_size(0), depth_limit(0),
+          hash_function()
+    {
+        setup(0);
+    }
+
+    /**
+     * Resize the cache to hold new_size elements (at least two) and drop all
+     * of its contents. Not thread safe.
+     * @returns the number of elements the cache holds
+     */
+    uint32_t setup(uint32_t new_size)
+    {
+        size = std::max<uint32_t>(2, new_size);
+        depth_limit = static_cast<uint8_t>(std::log2(static_cast<float>(size)));
+        mem.reset(new unsigned char[(size_t)size * sizeof(Element) + CACHE_LINE_SIZE - 1]);
+        void *p = mem.get();
+        size_t space = (size_t)size * sizeof(Element) + CACHE_LINE_SIZE - 1;
+        table = static_cast<Element *>(std::align(CACHE_LINE_SIZE, (size_t)size * sizeof(Element), p, space));
+        for (uint32_t i = 0; i < size; ++i)
+            new (&table[i]) Element();
+        collection_flags.setup(size);
+        epoch_flags.assign(size, false);
+        epoch_size = std::max((uint32_t)1, (uint32_t)((45 * (uint64_t)size) / 100));
+        epoch_heuristic_counter = epoch_size;
+        return size;
+    }
+
+    /**
+     * Resize the cache to the number of elements that fit into bytes,
+     * not counting the two bits of flags per element. Not thread safe.
+     * @returns the number of elements the cache holds
+     */
+    uint32_t setup_bytes(size_t bytes)
+    {
+        return setup(std::min<size_t>(bytes / sizeof(Element), std::numeric_limits<uint32_t>::max()));
+    }
+
+    /**
+     * Add e to the cache. Inserting an element that is present keeps it alive
+     * for another generation. When the eviction chain reaches the depth limit
+     * the element last moved is dropped, which is the oldest one touched.
+     */
+    void insert(Element e)
+    {
+        epoch_check();
+        uint32_t last_loc = invalid();
+        bool last_epoch = true;
+        std::array<uint32_t, 8> locs = compute_hashes(e);
+        for (const uint32_t loc : locs)
+        {
+            if (table[loc] == e)
+            {
+                please_keep(loc);
+                epoch_flags[loc] = last_epoch;
+                return;
+            }
+        }
+        for (uint8_t depth = 0; depth < depth_limit; ++depth)
+        {
+            for (const uint32_t loc : locs)
+            {
+                if (!collection_flags.bit_is_set(loc))
+                    continue;
+                table[loc] = std::move(e);
+                please_keep(loc);
+                epoch_flags[loc] = last_epoch;
+                return;
+            }
+            // All slots are taken: move the element in the slot after the one
+            // used last time, so a chain of moves does not go back and forth.
+            last_loc = locs[(1 + (std::find(locs.begin(), locs.end(), last_loc) - locs.begin())) & 7];
+            std::swap(table[last_loc], e);
+            bool epoch = last_epoch;
+            last_epoch = epoch_flags[last_loc];
+            epoch_flags[last_loc] = epoch;
+            locs = compute_hashes(e);
+        }
+    }
+
+    /**
+     * Check whether e is in the cache, marking its slot as reusable when
+     * erase is set. Safe to call from any number of threads at once.
+     */
+    bool contains(const Element &e, const bool erase) const
+    {
+        std::array<uint32_t, 8> locs = compute_hashes(e);
+        for (const uint32_t loc : locs)
+        {
+            if (table[loc] == e)
+            {
+                if (erase)
+                    allow_erase(loc);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    //! Number of elements the cache holds
+    uint32_t capacity() const { return size; }
+};
+}
+
+#endif // BITCOIN_CUCKOOCACHE_H
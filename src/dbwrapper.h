@@ -18,6 +18,9 @@
 #include <leveldb/db.h>
 #include <leveldb/write_batch.h>
 
+#include <algorithm>
+#include <memory>
+
 
 static const size_t DBWRAPPER_PREALLOC_KEY_SIZE = 64;
 static const size_t DBWRAPPER_PREALLOC_VALUE_SIZE = 1024;
@@ -46,6 +49,115 @@ void HandleError(const leveldb::Status &status);
  * specific database.
  */
 const std::vector<uint8_t> &GetObfuscateKey(const CDBWrapper &w);
+
+/**
+ * XOR a buffer in place with the obfuscation key, the same way
+ * CDataStream::Xor does.
+ */
+inline void Xor(char *pch, size_t nSize, const std::vector<uint8_t> &key)
+{
+    if (key.empty())
+        return;
+    for (size_t i = 0, j = 0; i != nSize; i++)
+    {
+        pch[i] ^= key[j++];
+        if (j == key.size())
+            j = 0;
+    }
+}
+};
+
+/**
+ * Serializes a database key into an inline buffer.
+ *
+ * Keys are a prefix byte followed by a hash and maybe a few integers, so
+ * they fit in DBWRAPPER_PREALLOC_KEY_SIZE bytes and never touch the heap.
+ * Longer keys still work, they just spill into an allocation.
+ */
+class CDBKeyWriter
+{
+private:
+    char vch[DBWRAPPER_PREALLOC_KEY_SIZE];
+    size_t nSize;
+    //! only used for keys that do not fit into vch
+    std::vector<char> vchLarge;
+
+public:
+    CDBKeyWriter() : nSize(0) {}
+    template <typename K>
+    explicit CDBKeyWriter(const K &key) : nSize(0)
+    {
+        *this << key;
+    }
+
+    int GetType() const { return SER_DISK; }
+    int GetVersion() const { return CLIENT_VERSION; }
+    void write(const char *pch, size_t nSizeIn)
+    {
+        if (vchLarge.empty() && nSize + nSizeIn <= sizeof(vch))
+        {
+            memcpy(vch + nSize, pch, nSizeIn);
+            nSize += nSizeIn;
+            return;
+        }
+        if (vchLarge.empty())
+            vchLarge.assign(vch, vch + nSize);
+        vchLarge.insert(vchLarge.end(), pch, pch + nSizeIn);
+    }
+    template <typename T>
+    CDBKeyWriter &operator<<(const T &obj)
+    {
+        ::Serialize(*this, obj);
+        return (*this);
+    }
+
+    void clear()
+    {
+        nSize = 0;
+        vchLarge.clear();
+    }
+    leveldb::Slice GetSlice() const
+    {
+        if (vchLarge.empty())
+            return leveldb::Slice(vch, nSize);
+        return leveldb::Slice(vchLarge.data(), vchLarge.size());
+    }
+};
+
+/**
+ * Deserializes a key or value straight out of a buffer owned by someone else
+ * (a leveldb slice, or a string returned by leveldb::DB::Get), so nothing
+ * needs to be copied into a CDataStream first.
+ */
+class CDBValueReader
+{
+private:
+    const char *pbegin;
+    const char *pend;
+
+public:
+    CDBValueReader(const char *pbeginIn, size_t nSize) : pbegin(pbeginIn), pend(pbeginIn + nSize) {}
+    int GetType() const { return SER_DISK; }
+    int GetVersion() const { return CLIENT_VERSION; }
+    void read(char *pch, size_t nSize)
+    {
+        if (nSize > (size_t)(pend - pbegin))
+            throw std::ios_base::failure("CDBValueReader::read(): end of data");
+        memcpy(pch, pbegin, nSize);
+        pbegin += nSize;
+    }
+    void ignore(size_t nSize)
+    {
+        if (nSize > (size_t)(pend - pbegin))
+            throw std::ios_base::failure("CDBValueReader::ignore(): end of data");
+        pbegin += nSize;
+    }
+    template <typename T>
+    CDBValueReader &operator>>(T &obj)
+    {
+        ::Unserialize(*this, obj);
+        return (*this);
+    }
 };
 
 /** Batch of changes queued to be written to a CDBWrapper */
@@ -57,7 +169,8 @@ private:
     const CDBWrapper &parent;
     leveldb::WriteBatch batch;
 
-    CDataStream ssKey;
+    //! scratch buffers reused by every Write and Erase on this batch
+    CDBKeyWriter ssKey;
     CDataStream ssValue;
 
     size_t size_estimate;
@@ -66,8 +179,7 @@ public:
     /**
      * @param[in] _parent   CDBWrapper that this batch is to be submitted to
      */
-    CDBBatch(const CDBWrapper &_parent)
-        : parent(_parent), ssKey(SER_DISK, CLIENT_VERSION), ssValue(SER_DISK, CLIENT_VERSION), size_estimate(0){};
+    CDBBatch(const CDBWrapper &_parent) : parent(_parent), ssValue(SER_DISK, CLIENT_VERSION), size_estimate(0){};
 
     void Clear()
     {
@@ -78,9 +190,8 @@ public:
     template <typename K, typename V>
     void Write(const K &key, const V &value)
     {
-        ssKey.reserve(DBWRAPPER_PREALLOC_KEY_SIZE);
         ssKey << key;
-        leveldb::Slice slKey(ssKey.data(), ssKey.size());
+        leveldb::Slice slKey = ssKey.GetSlice();
 
         ssValue.reserve(DBWRAPPER_PREALLOC_VALUE_SIZE);
         ssValue << value;
@@ -103,9 +214,8 @@ public:
     template <typename K>
     void Erase(const K &key)
     {
-        ssKey.reserve(DBWRAPPER_PREALLOC_KEY_SIZE);
         ssKey << key;
-        leveldb::Slice slKey(ssKey.data(), ssKey.size());
+        leveldb::Slice slKey = ssKey.GetSlice();
 
         batch.Delete(slKey);
         // LevelDB serializes erases as:
@@ -126,6 +236,9 @@ private:
     const CDBWrapper &parent;
     leveldb::Iterator *piter;
 
+    //! scratch buffer for deobfuscating values, reused across GetValue calls
+    std::vector<char> vchValue;
+
 public:
     /**
      * @param[in] _parent          Parent CDBWrapper instance.
@@ -141,11 +254,8 @@ public:
     template <typename K>
     void Seek(const K &key)
     {
-        CDataStream ssKey(SER_DISK, CLIENT_VERSION);
-        ssKey.reserve(DBWRAPPER_PREALLOC_KEY_SIZE);
-        ssKey << key;
-        leveldb::Slice slKey(ssKey.data(), ssKey.size());
-        piter->Seek(slKey);
+        CDBKeyWriter ssKey(key);
+        piter->Seek(ssKey.GetSlice());
     }
 
     void Next();
@@ -156,7 +266,7 @@ public:
         leveldb::Slice slKey = piter->key();
         try
         {
-            CDataStream ssKey(slKey.data(), slKey.data() + slKey.size(), SER_DISK, CLIENT_VERSION);
+            CDBValueReader ssKey(slKey.data(), slKey.size());
             ssKey >> key;
         }
         catch (const std::exception &)
@@ -173,8 +283,9 @@ public:
         leveldb::Slice slValue = piter->value();
         try
         {
-            CDataStream ssValue(slValue.data(), slValue.data() + slValue.size(), SER_DISK, CLIENT_VERSION);
-            ssValue.Xor(dbwrapper_private::GetObfuscateKey(parent));
+            vchValue.assign(slValue.data(), slValue.data() + slValue.size());
+            dbwrapper_private::Xor(vchValue.data(), vchValue.size(), dbwrapper_private::GetObfuscateKey(parent));
+            CDBValueReader ssValue(vchValue.data(), vchValue.size());
             ssValue >> value;
         }
         catch (const std::exception &)
@@ -246,13 +357,10 @@ public:
     template <typename K, typename V>
     bool Read(const K &key, V &value) const
     {
-        CDataStream ssKey(SER_DISK, CLIENT_VERSION);
-        ssKey.reserve(DBWRAPPER_PREALLOC_KEY_SIZE);
-        ssKey << key;
-        leveldb::Slice slKey(ssKey.data(), ssKey.size());
+        CDBKeyWriter ssKey(key);
 
         std::string strValue;
-        leveldb::Status status = pdb->Get(readoptions, slKey, &strValue);
+        leveldb::Status status = pdb->Get(readoptions, ssKey.GetSlice(), &strValue);
         if (!status.ok())
         {
             if (status.IsNotFound())
@@ -262,8 +370,9 @@ public:
         }
         try
         {
-            CDataStream ssValue(strValue.data(), strValue.data() + strValue.size(), SER_DISK, CLIENT_VERSION);
-            ssValue.Xor(obfuscate_key);
+            // strValue is ours, so deobfuscate and decode it in place
+            dbwrapper_private::Xor(&strValue[0], strValue.size(), obfuscate_key);
+            CDBValueReader ssValue(strValue.data(), strValue.size());
             ssValue >> value;
         }
         catch (const std::exception &)
@@ -273,6 +382,95 @@ public:
         return true;
     }
 
+    /**
+     * Read the values of several keys at once.
+     *
+     * The keys are serialized into one shared buffer and looked up in sorted
+     * order through a single iterator, so neighbouring keys are served from
+     * the same leveldb blocks instead of each doing a separate Get.
+     *
+     * @param[in]  keys     Keys to look up, in any order
+     * @param[out] values   values[i] holds the value of keys[i] if it was found,
+     *                      and a default constructed value otherwise
+     * @param[out] vfFound  vfFound[i] tells whether keys[i] was found
+     * @return the number of keys that were found
+     */
+    template <typename K, typename V>
+    size_t ReadMany(const std::vector<K> &keys, std::vector<V> &values, std::vector<bool> &vfFound) const
+    {
+        values.clear();
+        values.resize(keys.size());
+        vfFound.assign(keys.size(), false);
+        if (keys.empty())
+            return 0;
+
+        CDataStream ssKeys(SER_DISK, CLIENT_VERSION);
+        ssKeys.reserve(DBWRAPPER_PREALLOC_KEY_SIZE * keys.size());
+        std::vector<std::pair<size_t, size_t> > vKeyPos(keys.size());
+        for (size_t i = 0; i < keys.size(); i++)
+        {
+            vKeyPos[i].first = ssKeys.size();
+            ssKeys << keys[i];
+            vKeyPos[i].second = ssKeys.size() - vKeyPos[i].first;
+        }
+        std::vector<leveldb::Slice> vslKeys(keys.size());
+        std::vector<size_t> vOrder(keys.size());
+        for (size_t i = 0; i < keys.size(); i++)
+        {
+            vslKeys[i] = leveldb::Slice(&ssKeys[vKeyPos[i].first], vKeyPos[i].second);
+            vOrder[i] = i;
+        }
+        std::sort(vOrder.begin(), vOrder.end(),
+            [&vslKeys](size_t a, size_t b) { return vslKeys[a].compare(vslKeys[b]) < 0; });
+
+        size_t nFound = 0;
+        std::vector<char> vchValue;
+        vchValue.reserve(DBWRAPPER_PREALLOC_VALUE_SIZE);
+        std::unique_ptr<leveldb::Iterator> piter(pdb->NewIterator(readoptions));
+        bool fSeeked = false;
+        for (size_t i : vOrder)
+        {
+            const leveldb::Slice &slKey = vslKeys[i];
+            // The keys are sorted, so step forward from the previous position
+            // and only seek when the next key is not right behind it.
+            if (!fSeeked || !piter->Valid())
+            {
+                piter->Seek(slKey);
+                fSeeked = true;
+            }
+            else if (piter->key().compare(slKey) < 0)
+            {
+                piter->Next();
+                if (piter->Valid() && piter->key().compare(slKey) < 0)
+                    piter->Seek(slKey);
+            }
+            if (!piter->Valid() || piter->key().compare(slKey) != 0)
+                continue;
+
+            leveldb::Slice slValue = piter->value();
+            try
+            {
+                vchValue.assign(slValue.data(), slValue.data() + slValue.size());
+                dbwrapper_private::Xor(vchValue.data(), vchValue.size(), obfuscate_key);
+                CDBValueReader ssValue(vchValue.data(), vchValue.size());
+                ssValue >> values[i];
+            }
+            catch (const std::exception &)
+            {
+                values[i] = V();
+                continue;
+            }
+            vfFound[i] = true;
+            nFound++;
+        }
+        if (!piter->status().ok())
+        {
+            LogPrintf("LevelDB read failure: %s\n", piter->status().ToString());
+            dbwrapper_private::HandleError(piter->status());
+        }
+        return nFound;
+    }
+
     template <typename K, typename V>
     bool Write(const K &key, const V &value, bool fSync = false)
     {
@@ -284,13 +482,10 @@ public:
     template <typename K>
     bool Exists(const K &key) const
     {
-        CDataStream ssKey(SER_DISK, CLIENT_VERSION);
-        ssKey.reserve(DBWRAPPER_PREALLOC_KEY_SIZE);
-        ssKey << key;
-        leveldb::Slice slKey(ssKey.data(), ssKey.size());
+        CDBKeyWriter ssKey(key);
 
         std::string strValue;
-        leveldb::Status status = pdb->Get(readoptions, slKey, &strValue);
+        leveldb::Status status = pdb->Get(readoptions, ssKey.GetSlice(), &strValue);
         if (!status.ok())
         {
             if (status.IsNotFound())
@@ -328,13 +523,9 @@ public:
     template <typename K>
     size_t EstimateSize(const K &key_begin, const K &key_end) const
     {
-        CDataStream ssKey1(SER_DISK, CLIENT_VERSION), ssKey2(SER_DISK, CLIENT_VERSION);
-        ssKey1.reserve(DBWRAPPER_PREALLOC_KEY_SIZE);
-        ssKey2.reserve(DBWRAPPER_PREALLOC_KEY_SIZE);
-        ssKey1 << key_begin;
-        ssKey2 << key_end;
-        leveldb::Slice slKey1(ssKey1.data(), ssKey1.size());
-        leveldb::Slice slKey2(ssKey2.data(), ssKey2.size());
+        CDBKeyWriter ssKey1(key_begin), ssKey2(key_end);
+        leveldb::Slice slKey1 = ssKey1.GetSlice();
+        leveldb::Slice slKey2 = ssKey2.GetSlice();
         uint64_t size = 0;
         leveldb::Range range(slKey1, slKey2);
         pdb->GetApproximateSizes(&range, 1, &size);
@@ -347,13 +538,9 @@ public:
     template <typename K>
     void CompactRange(const K &key_begin, const K &key_end) const
     {
-        CDataStream ssKey1(SER_DISK, CLIENT_VERSION), ssKey2(SER_DISK, CLIENT_VERSION);
-        ssKey1.reserve(DBWRAPPER_PREALLOC_KEY_SIZE);
-        ssKey2.reserve(DBWRAPPER_PREALLOC_KEY_SIZE);
-        ssKey1 << key_begin;
-        ssKey2 << key_end;
-        leveldb::Slice slKey1(ssKey1.data(), ssKey1.size());
-        leveldb::Slice slKey2(ssKey2.data(), ssKey2.size());
+        CDBKeyWriter ssKey1(key_begin), ssKey2(key_end);
+        leveldb::Slice slKey1 = ssKey1.GetSlice();
+        leveldb::Slice slKey2 = ssKey2.GetSlice();
         pdb->CompactRange(&slKey1, &slKey2);
     }
 
@@ -169,6 +169,8 @@ void Interrupt(thread_group &threadGroup)
     InterruptRPC();
     InterruptTorControl();
     InterruptScriptCheck();
+    InterruptMempoolScriptCheck();
+    InterruptBlockCheck();
 }
 
 void Shutdown(thread_group &threadGroup)
@@ -341,6 +343,10 @@ std::string HelpMessage()
     std::string strUsage = HelpMessageGroup(("Options:"));
     strUsage += HelpMessageOpt("-?", ("This help message"));
     strUsage += HelpMessageOpt("-version", ("Print version and exit"));
+    strUsage += HelpMessageOpt("-assumevalid=<hex>",
+        strprintf("If this block is in the chain assume that it and its ancestors are valid and potentially skip "
+                  "their script verification (0 to verify all, default: %s)",
+                                   pnetMan->getActivePaymentNetwork()->GetConsensus().defaultAssumeValid.GetHex()));
     strUsage += HelpMessageOpt(
         "-blocknotify=<cmd>", ("Execute command when the best block changes (%s in cmd is replaced by block hash)"));
     strUsage += HelpMessageOpt("-checkblocks=<n>",
@@ -375,6 +381,9 @@ std::string HelpMessage()
     strUsage += HelpMessageOpt("-pid=<file>", strprintf(("Specify pid file (default: %s)"), PID_FILENAME));
 #endif
     strUsage += HelpMessageOpt("-reindex", ("Rebuild block chain index from current blk000??.dat files on startup"));
+    strUsage += HelpMessageOpt("-undocache=<n>",
+        strprintf(("Keep the undo data of the last <n> connected blocks in memory for reorgs (default: %u)"),
+                                   DEFAULT_UNDO_CACHE_BLOCKS));
 
     strUsage += HelpMessageGroup(("Connection options:"));
     strUsage += HelpMessageOpt("-addnode=<ip>", ("Add a node to connect to and attempt to keep the connection open"));
@@ -404,6 +413,10 @@ std::string HelpMessage()
         strprintf(("Maximum per-connection receive buffer, <n>*1000 bytes (default: %u)"), DEFAULT_MAXRECEIVEBUFFER));
     strUsage += HelpMessageOpt("-maxsendbuffer=<n>",
         strprintf(("Maximum per-connection send buffer, <n>*1000 bytes (default: %u)"), DEFAULT_MAXSENDBUFFER));
+    strUsage += HelpMessageOpt("-msghandlerthreads=<n>",
+        strprintf(("Set the number of threads processing peer messages (1 to %d, 0 = one per core up to %d, "
+                   "default: %d)"),
+            MAX_MESSAGE_HANDLER_THREADS, MAX_MESSAGE_HANDLER_THREADS, DEFAULT_MESSAGE_HANDLER_THREADS));
     strUsage += HelpMessageOpt("-onion=<ip:port>",
         strprintf(("Use separate SOCKS5 proxy to reach peers via Tor hidden services (default: %s)"), "-proxy"));
     strUsage += HelpMessageOpt("-onlynet=<net>", ("Only connect to nodes in network <net> (ipv4, ipv6 or onion)"));
@@ -564,7 +577,9 @@ std::string HelpMessage()
             strprintf("Continuously rate-limit free transactions to <n>*1000 bytes per minute (default: %u)",
                                        DEFAULT_LIMITFREERELAY));
         strUsage += HelpMessageOpt("-maxsigcachesize=<n>",
-            strprintf("Limit size of signature cache to <n> MiB (default: %u)", DEFAULT_MAX_SIG_CACHE_SIZE));
+            strprintf("Limit sum of signature cache and script execution cache sizes to <n> MiB (default: %u, "
+                      "maximum: %d)",
+                DEFAULT_MAX_SIG_CACHE_SIZE, MAX_MAX_SIG_CACHE_SIZE));
     }
     strUsage += HelpMessageOpt(
         "-minrelaytxfee=<amt>", strprintf(("Fees (in %s/kB) smaller than this are considered zero fee for relaying, "
@@ -960,13 +975,16 @@ bool AppInit2(thread_group &threadGroup)
     // also see: InitParameterInteraction()
 
     // Make sure enough file descriptors are available
-    int nBind = std::max((int)gArgs.IsArgSet("-bind") + (int)gArgs.IsArgSet("-whitebind"), 1);
     int nUserMaxConnections = gArgs.GetArg("-maxconnections", DEFAULT_MAX_PEER_CONNECTIONS);
     initMaxConnections = std::max(nUserMaxConnections, 0);
 
     // Trim requested connection counts, to fit into system limitations
+#ifndef USE_EPOLL
+    // select() cannot wait for sockets beyond FD_SETSIZE, epoll is only bound by the descriptor limit below
+    int nBind = std::max((int)gArgs.IsArgSet("-bind") + (int)gArgs.IsArgSet("-whitebind"), 1);
     initMaxConnections =
         std::max(std::min(initMaxConnections, (int)(FD_SETSIZE - nBind - MIN_CORE_FILEDESCRIPTORS)), 0);
+#endif
     int nFD = RaiseFileDescriptorLimit(initMaxConnections + MIN_CORE_FILEDESCRIPTORS);
     if (nFD < MIN_CORE_FILEDESCRIPTORS)
     {
@@ -1018,6 +1036,11 @@ bool AppInit2(thread_group &threadGroup)
     }
     fCheckBlockIndex = gArgs.GetBoolArg("-checkblockindex", chainparams.DefaultConsistencyChecks());
     fCheckpointsEnabled = gArgs.GetBoolArg("-checkpoints", DEFAULT_CHECKPOINTS_ENABLED);
+    hashAssumeValid = uint256S(gArgs.GetArg("-assumevalid", chainparams.GetConsensus().defaultAssumeValid.GetHex()));
+    if (!hashAssumeValid.IsNull())
+        LogPrintf("Assuming ancestors of block %s have valid signatures.\n", hashAssumeValid.GetHex());
+    else
+        LogPrintf("Validating signatures for all blocks.\n");
 
     // mempool limits
     int64_t nMempoolSizeMax = gArgs.GetArg("-maxmempool", DEFAULT_MAX_MEMPOOL_SIZE) * 1000000;
@@ -1184,12 +1207,18 @@ bool AppInit2(thread_group &threadGroup)
     LogPrintf("Using at most %i connections (%i file descriptors available)\n", initMaxConnections, initFD);
     std::ostringstream strErrors;
 
-    LogPrintf("Using %u threads for script verification\n", nScriptCheckThreads);
+    InitSignatureCache();
+    InitScriptExecutionCache();
+
+    LogPrintf("Using %u threads for script verification, for blocks and for the mempool each\n", nScriptCheckThreads);
+    LogPrintf("Using %u threads for context-free block checks\n", nScriptCheckThreads ? nScriptCheckThreads - 1 : 0);
     if (nScriptCheckThreads)
     {
         for (int i = 0; i < nScriptCheckThreads - 1; i++)
         {
             threadGroup.create_thread(&ThreadScriptCheck);
+            threadGroup.create_thread(&ThreadMempoolScriptCheck);
+            threadGroup.create_thread(&ThreadBlockCheck);
         }
     }
 
@@ -1442,6 +1471,9 @@ bool AppInit2(thread_group &threadGroup)
     LogPrintf("* Using %.1fMiB for block index database\n", nBlockTreeDBCache * (1.0 / 1024 / 1024));
     LogPrintf("* Using %.1fMiB for chain state database\n", nCoinDBCache * (1.0 / 1024 / 1024));
     LogPrintf("* Using %.1fMiB for in-memory UTXO set\n", nCoinCacheUsage * (1.0 / 1024 / 1024));
+    int64_t nUndoCacheBlocks = std::max<int64_t>(0, gArgs.GetArg("-undocache", DEFAULT_UNDO_CACHE_BLOCKS));
+    undoCache.SetMaxBlocks(nUndoCacheBlocks);
+    LogPrintf("* Keeping the undo data of %d blocks in memory\n", nUndoCacheBlocks);
 
     bool fLoaded = false;
     while (!fLoaded)
@@ -18,6 +18,7 @@
 #include "consensus/tx_verify.h"
 #include "consensus/validation.h"
 #include "crypto/hash.h"
+#include "cuckoocache.h"
 #include "init.h"
 #include "kernel.h"
 #include "merkleblock.h"
@@ -49,7 +50,9 @@
 #include <boost/math/distributions/poisson.hpp>
 #include <boost/random/mersenne_twister.hpp>
 #include <boost/random/uniform_int_distribution.hpp>
+#include <boost/thread/shared_mutex.hpp>
 
+#include <atomic>
 #include <random>
 #include <random>
 #include <sstream>
@@ -68,6 +71,7 @@ bool fRequireStandard = true;
 unsigned int nBytesPerSigOp = DEFAULT_BYTES_PER_SIGOP;
 bool fCheckBlockIndex = false;
 bool fCheckpointsEnabled = DEFAULT_CHECKPOINTS_ENABLED;
+uint256 hashAssumeValid;
 size_t nCoinCacheUsage = 5000 * 300;
 
 /** Fees smaller than this (in satoshi) are considered zero fee (for relaying, mining and transaction creation) */
@@ -125,7 +129,7 @@ std::set<CBlockIndex *> setDirtyBlockIndex;
 std::set<int> setDirtyFileInfo;
 
 /** Number of peers from which we're downloading blocks. */
-int nPeersWithValidatedDownloads = 0;
+std::atomic<int> nPeersWithValidatedDownloads{0};
 
 //////////////////////////////////////////////////////////////////////////////
 //
@@ -294,6 +298,12 @@ std::string FormatStateMessage(const CValidationState &state)
         state.GetDebugMessage().empty() ? "" : ", " + state.GetDebugMessage(), state.GetRejectCode());
 }
 
+static bool CheckInputsOnMempoolQueue(const CTransaction &tx,
+    CValidationState &state,
+    const CCoinsViewCache &view,
+    unsigned int flags,
+    bool cacheFullScriptStore);
+
 bool AcceptToMemoryPoolWorker(CTxMemPool &pool,
     CValidationState &state,
     const CTransactionRef &ptx,
@@ -572,7 +582,7 @@ bool AcceptToMemoryPoolWorker(CTxMemPool &pool,
 
         // Check against previous transactions
         // This is done last to help prevent CPU exhaustion denial-of-service attacks.
-        if (!CheckInputs(tx, state, view, true, STANDARD_SCRIPT_VERIFY_FLAGS, true, nullptr))
+        if (!CheckInputsOnMempoolQueue(tx, state, view, STANDARD_SCRIPT_VERIFY_FLAGS, false))
         {
             LogPrint("MEMPOOL", "CheckInputs failed for tx: %s\n", tx.GetHash().ToString().c_str());
             return false;
@@ -588,12 +598,22 @@ bool AcceptToMemoryPoolWorker(CTxMemPool &pool,
         // invalid blocks, however allowing such transactions into the mempool
         // can be exploited as a DoS attack.
 
-        if (!CheckInputs(tx, state, view, true, MANDATORY_SCRIPT_VERIFY_FLAGS, true, nullptr))
+        if (!CheckInputsOnMempoolQueue(tx, state, view, MANDATORY_SCRIPT_VERIFY_FLAGS, false))
         {
             return error(
                 "%s: BUG! PLEASE REPORT THIS! ConnectInputs failed against MANDATORY but not STANDARD flags %s, %s",
                 __func__, hash.ToString(), FormatStateMessage(state));
         }
+
+        // Check once more against the flags ConnectBlock uses, this time remembering the result so the
+        // scripts don't have to run again when the transaction is mined. The signatures are in the
+        // signature cache by now.
+        if (!CheckInputsOnMempoolQueue(tx, state, view, BLOCK_SCRIPT_VERIFY_FLAGS, true))
+        {
+            return error(
+                "%s: BUG! PLEASE REPORT THIS! ConnectInputs failed against block but not STANDARD flags %s, %s",
+                __func__, hash.ToString(), FormatStateMessage(state));
+        }
         {
             WRITELOCK(pool.cs);
             if (!pool._CalculateMemPoolAncestors(entry, setAncestors, nLimitAncestors, nLimitAncestorSize,
@@ -656,10 +676,89 @@ bool AcceptToMemoryPool(CTxMemPool &pool,
 // CBlock and CBlockIndex
 //
 
+namespace
+{
+/**
+ * Transactions whose scripts all passed with a given set of flags, so that the
+ * scripts of a transaction accepted to the memory pool don't run again when it
+ * shows up in a block. The txid commits to the scriptSigs and to the outputs
+ * being spent, so it and the flags are all a result depends on.
+ */
+class CScriptExecutionCache
+{
+private:
+    //! Entries are SHA256(nonce || txid || flags):
+    uint256 nonce;
+    typedef CuckooCache::cache<uint256, SignatureCacheHasher> map_type;
+    map_type setValid;
+    //! Lookups share the lock, inserts and resizing take it exclusively
+    boost::shared_mutex cs_scriptcache;
+    std::atomic<uint64_t> nLookups;
+    std::atomic<uint64_t> nHits;
+
+public:
+    CScriptExecutionCache() : nLookups(0), nHits(0) { GetRandBytes(nonce.begin(), 32); }
+    void ComputeEntry(uint256 &entry, const uint256 &txid, unsigned int flags)
+    {
+        CSHA256()
+            .Write(nonce.begin(), 32)
+            .Write(txid.begin(), 32)
+            .Write((const unsigned char *)&flags, sizeof(flags))
+            .Finalize(entry.begin());
+    }
+
+    //! Look up entry, letting it be evicted first when it is found and fErase is set
+    bool Get(const uint256 &entry, bool fErase)
+    {
+        boost::shared_lock<boost::shared_mutex> lock(cs_scriptcache);
+        nLookups.fetch_add(1, std::memory_order_relaxed);
+        if (!setValid.contains(entry, fErase))
+            return false;
+        nHits.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    void Set(const uint256 &entry)
+    {
+        boost::unique_lock<boost::shared_mutex> lock(cs_scriptcache);
+        setValid.insert(entry);
+    }
+
+    uint32_t Setup(size_t nBytes)
+    {
+        boost::unique_lock<boost::shared_mutex> lock(cs_scriptcache);
+        return setValid.setup_bytes(nBytes);
+    }
+
+    CValidationCacheStats GetStats()
+    {
+        CValidationCacheStats stats;
+        boost::shared_lock<boost::shared_mutex> lock(cs_scriptcache);
+        stats.nEntries = setValid.capacity();
+        stats.nBytes = (size_t)stats.nEntries * sizeof(uint256);
+        stats.nLookups = nLookups.load(std::memory_order_relaxed);
+        stats.nHits = nHits.load(std::memory_order_relaxed);
+        return stats;
+    }
+};
+
+CScriptExecutionCache scriptExecutionCache;
+}
+
+void InitScriptExecutionCache()
+{
+    size_t nMaxCacheSize = GetValidationCacheBytes();
+    uint32_t nEntries = scriptExecutionCache.Setup(nMaxCacheSize);
+    LogPrintf("Using %zu MiB out of %zu requested for script execution cache, able to store %u elements\n",
+        (nEntries * sizeof(uint256)) >> 20, nMaxCacheSize >> 20, nEntries);
+}
+
+CValidationCacheStats GetScriptExecutionCacheStats() { return scriptExecutionCache.GetStats(); }
+
 bool CScriptCheck::operator()()
 {
     const CScript &scriptSig = ptxTo->vin[nIn].scriptSig;
-    CachingTransactionSignatureChecker checker(ptxTo, nIn, cacheStore);
+    CachingTransactionSignatureChecker checker(ptxTo, nIn, cacheStore, txdata.get());
     if (!VerifyScript(scriptSig, scriptPubKey, nFlags, checker, &error))
     {
         return false;
@@ -673,6 +772,7 @@ bool CheckInputs(const CTransaction &tx,
     bool fScriptChecks,
     unsigned int flags,
     bool cacheStore,
+    bool cacheFullScriptStore,
     std::vector<CScriptCheck> *pvChecks)
 {
     if (!tx.IsCoinBase())
@@ -692,6 +792,14 @@ bool CheckInputs(const CTransaction &tx,
         // still computed and checked, and any change will be caught at the next checkpoint.
         if (fScriptChecks)
         {
+            uint256 hashCacheEntry;
+            scriptExecutionCache.ComputeEntry(hashCacheEntry, tx.GetHash(), flags);
+            if (scriptExecutionCache.Get(hashCacheEntry, !cacheFullScriptStore))
+                return true;
+
+            // The checks may outlive this call when they are handed out through pvChecks
+            std::shared_ptr<const PrecomputedTransactionData> txdata =
+                std::make_shared<const PrecomputedTransactionData>(tx);
             for (unsigned int i = 0; i < tx.vin.size(); i++)
             {
                 const COutPoint &prevout = tx.vin[i].prevout;
@@ -703,11 +811,11 @@ bool CheckInputs(const CTransaction &tx,
                 // a sanity check that our caching is not introducing consensus
                 // failures through additional data in, eg, the coins being
                 // spent being checked as a part of CScriptCheck.
-                const CScript &scriptPubKey = coin->out.scriptPubKey;
+                const CScript scriptPubKey = coin->out.GetScriptPubKey();
                 const CAmount amount = coin->out.nValue;
 
                 // Verify signature
-                CScriptCheck check(scriptPubKey, amount, tx, i, flags, cacheStore);
+                CScriptCheck check(scriptPubKey, amount, tx, i, flags, cacheStore, txdata);
                 if (pvChecks)
                 {
                     pvChecks->push_back(CScriptCheck());
@@ -723,8 +831,8 @@ bool CheckInputs(const CTransaction &tx,
                         // arguments; if so, don't trigger DoS protection to
                         // avoid splitting the network between upgraded and
                         // non-upgraded nodes.
-                        CScriptCheck check2(
-                            scriptPubKey, amount, tx, i, flags & ~STANDARD_NOT_MANDATORY_VERIFY_FLAGS, cacheStore);
+                        CScriptCheck check2(scriptPubKey, amount, tx, i, flags & ~STANDARD_NOT_MANDATORY_VERIFY_FLAGS,
+                            cacheStore, txdata);
                         if (check2())
                         {
                             return state.Invalid(
@@ -743,12 +851,71 @@ bool CheckInputs(const CTransaction &tx,
                                                                      ScriptErrorString(check.GetScriptError())));
                 }
             }
+
+            // Checks handed out through pvChecks have not run yet, so only an inline pass can be cached
+            if (cacheFullScriptStore && !pvChecks)
+                scriptExecutionCache.Set(hashCacheEntry);
         }
     }
 
     return true;
 }
 
+static CCheckQueue<CScriptCheck> mempoolscriptcheckqueue(128);
+
+void InterruptMempoolScriptCheck() { mempoolscriptcheckqueue.Interrupt(); }
+void ThreadMempoolScriptCheck()
+{
+    RenameThread("bitcoin-mempoolch");
+    mempoolscriptcheckqueue.Thread();
+}
+
+/**
+ * CheckInputs for AcceptToMemoryPoolWorker, with the scripts run on the mempool script check
+ * threads rather than one after another on the calling thread. The caller holds cs_main while it
+ * waits; the checks never take cs_main and the queue is not the one ConnectBlock uses, so the
+ * wait can neither deadlock nor hold up a block being connected.
+ */
+static bool CheckInputsOnMempoolQueue(const CTransaction &tx,
+    CValidationState &state,
+    const CCoinsViewCache &view,
+    unsigned int flags,
+    bool cacheFullScriptStore)
+{
+    if (!nScriptCheckThreads)
+        return CheckInputs(tx, state, view, true, flags, true, cacheFullScriptStore, nullptr);
+
+    std::vector<CScriptCheck> vChecks;
+    if (!CheckInputs(tx, state, view, true, flags, true, cacheFullScriptStore, &vChecks))
+        return false;
+    // Nothing to run when the script execution cache already knew the transaction
+    if (vChecks.empty())
+        return true;
+
+    bool fScriptsOk;
+    {
+        CCheckQueueControl<CScriptCheck> control(&mempoolscriptcheckqueue);
+        control.Add(vChecks);
+        fScriptsOk = control.Wait();
+    }
+    if (!fScriptsOk)
+    {
+        // The queue only tells that a check failed. Checking inline again sets the reject reason and
+        // DoS score, and is cheap since the signatures that passed are in the signature cache by now.
+        if (!CheckInputs(tx, state, view, true, flags, true, false, nullptr))
+            return false;
+        return state.Invalid(false, REJECT_INVALID, "script-verify-failed");
+    }
+
+    if (cacheFullScriptStore)
+    {
+        uint256 hashCacheEntry;
+        scriptExecutionCache.ComputeEntry(hashCacheEntry, tx.GetHash(), flags);
+        scriptExecutionCache.Set(hashCacheEntry);
+    }
+    return true;
+}
+
 /** Abort with a message */
 bool AbortNode(const std::string &strMessage, const std::string &userMessage)
 {
@@ -21,6 +21,7 @@
 #include <algorithm>
 #include <exception>
 #include <map>
+#include <memory>
 #include <set>
 #include <stdint.h>
 #include <string>
@@ -37,6 +38,8 @@ class CScriptCheck;
 class CTxMemPool;
 class CValidationInterface;
 class CValidationState;
+class PrecomputedTransactionData;
+struct CValidationCacheStats;
 
 struct LockPoints;
 /** Default for returning change from tx back an address we already owned instead of a new one (try to select address
@@ -144,6 +147,8 @@ extern bool fRequireStandard;
 extern unsigned int nBytesPerSigOp;
 extern bool fCheckBlockIndex;
 extern bool fCheckpointsEnabled;
+/** Block whose ancestors have their scripts assumed valid, null to check all scripts */
+extern uint256 hashAssumeValid;
 extern size_t nCoinCacheUsage;
 extern CFeeRate minRelayTxFee;
 
@@ -252,7 +257,7 @@ enum FlushStateMode
 bool FlushStateToDisk(CValidationState &state, FlushStateMode mode);
 extern std::atomic<int> nPreferredDownload;
 extern std::atomic<int64_t> nTimeBestReceived;
-extern int nPeersWithValidatedDownloads;
+extern std::atomic<int> nPeersWithValidatedDownloads;
 
 /** Flush all state, indexes and buffers to disk. */
 void FlushStateToDisk();
@@ -302,6 +307,10 @@ struct CDiskTxPos : public CDiskBlockPos
  * Check whether all inputs of this transaction are valid (no double spends, scripts & sigs, amounts)
  * This does not modify the UTXO set. If pvChecks is not NULL, script checks are pushed onto it
  * instead of being performed inline.
+ *
+ * Transactions whose scripts already passed with the same flags are found in the script
+ * execution cache and their scripts are not run again. With cacheFullScriptStore a pass
+ * that was checked inline is added to that cache, otherwise a cache hit is removed from it.
  */
 bool CheckInputs(const CTransaction &tx,
     CValidationState &state,
@@ -309,8 +318,17 @@ bool CheckInputs(const CTransaction &tx,
     bool fScriptChecks,
     unsigned int flags,
     bool cacheStore,
+    bool cacheFullScriptStore,
     std::vector<CScriptCheck> *pvChecks = nullptr);
 
+/** Size the script execution cache from -maxsigcachesize, before any script is checked */
+void InitScriptExecutionCache();
+CValidationCacheStats GetScriptExecutionCacheStats();
+
+void InterruptMempoolScriptCheck();
+/** Run an instance of the thread that checks the scripts of transactions entering the mempool */
+void ThreadMempoolScriptCheck();
+
 /**
  * Check if transaction will be final in the next block to be created.
  *
@@ -352,6 +370,8 @@ protected:
     unsigned int nFlags;
     bool cacheStore;
     ScriptError error;
+    //! shared by the checks of all inputs of ptxTo
+    std::shared_ptr<const PrecomputedTransactionData> txdata;
 
 public:
     CScriptCheck() : amount(0), ptxTo(0), nIn(0), nFlags(0), cacheStore(false), error(SCRIPT_ERR_UNKNOWN_ERROR) {}
@@ -360,9 +380,10 @@ public:
         const CTransaction &txToIn,
         unsigned int nInIn,
         unsigned int nFlagsIn,
-        bool cacheIn)
+        bool cacheIn,
+        std::shared_ptr<const PrecomputedTransactionData> txdataIn = nullptr)
         : scriptPubKey(scriptPubKeyIn), amount(amountIn), ptxTo(&txToIn), nIn(nInIn), nFlags(nFlagsIn),
-          cacheStore(cacheIn), error(SCRIPT_ERR_UNKNOWN_ERROR)
+          cacheStore(cacheIn), error(SCRIPT_ERR_UNKNOWN_ERROR), txdata(txdataIn)
     {
     }
 
@@ -377,6 +398,7 @@ public:
         std::swap(nFlags, check.nFlags);
         std::swap(cacheStore, check.cacheStore);
         std::swap(error, check.error);
+        txdata.swap(check.txdata);
     }
 
     ScriptError GetScriptError() const { return error; }
@@ -757,8 +757,6 @@ void static ProcessGetData(CNode *pfrom, CConnman &connman, const Consensus::Par
     std::deque<CInv>::iterator it = pfrom->vRecvGetData.begin();
 
     std::vector<CInv> vNotFound;
-    LOCK(cs_main);
-
     while (it != pfrom->vRecvGetData.end())
     {
         // Don't bother if send buffer is too full to respond anyway.
@@ -774,57 +772,65 @@ void static ProcessGetData(CNode *pfrom, CConnman &connman, const Consensus::Par
         if (inv.type == MSG_BLOCK || inv.type == MSG_FILTERED_BLOCK)
         {
             bool send = false;
-            CBlockIndex *pindex = pnetMan->getChainActive()->LookupBlockIndex(inv.hash);
-            if (pindex)
+            CBlockIndex *pindex = nullptr;
+            uint256 hashTip;
             {
-                RECURSIVEREADLOCK(pnetMan->getChainActive()->cs_mapBlockIndex);
-                if (pnetMan->getChainActive()->chainActive.Contains(pindex))
-                {
-                    send = true;
-                }
-                else
+                // Deciding whether to serve the block needs cs_main, reading and sending it does not
+                LOCK(cs_main);
+                pindex = pnetMan->getChainActive()->LookupBlockIndex(inv.hash);
+                if (pindex)
                 {
-                    static const int nOneMonth = 30 * 24 * 60 * 60;
-                    // To prevent fingerprinting attacks, only send blocks
-                    // outside of the active chain if they are valid, and no
-                    // more than a month older (both in time, and in best
-                    // equivalent proof of work) than the best header chain
-                    // we know about.
-                    send =
-                        pindex->IsValid(BLOCK_VALID_SCRIPTS) &&
-                        (pnetMan->getChainActive()->pindexBestHeader != nullptr) &&
-                        (pnetMan->getChainActive()->pindexBestHeader.load()->GetBlockTime() - pindex->GetBlockTime() <
-                            nOneMonth) &&
-                        (GetBlockProofEquivalentTime(*pnetMan->getChainActive()->pindexBestHeader, *pindex,
-                             *pnetMan->getChainActive()->pindexBestHeader, consensusParams) < nOneMonth);
-                    if (!send)
+                    RECURSIVEREADLOCK(pnetMan->getChainActive()->cs_mapBlockIndex);
+                    if (pnetMan->getChainActive()->chainActive.Contains(pindex))
+                    {
+                        send = true;
+                    }
+                    else
                     {
-                        LogPrintf("%s: ignoring request from peer=%i for old block that isn't in the main chain\n",
-                            __func__, pfrom->GetId());
+                        static const int nOneMonth = 30 * 24 * 60 * 60;
+                        // To prevent fingerprinting attacks, only send blocks
+                        // outside of the active chain if they are valid, and no
+                        // more than a month older (both in time, and in best
+                        // equivalent proof of work) than the best header chain
+                        // we know about.
+                        send =
+                            pindex->IsValid(BLOCK_VALID_SCRIPTS) &&
+                            (pnetMan->getChainActive()->pindexBestHeader != nullptr) &&
+                            (pnetMan->getChainActive()->pindexBestHeader.load()->GetBlockTime() - pindex->GetBlockTime() <
+                                nOneMonth) &&
+                            (GetBlockProofEquivalentTime(*pnetMan->getChainActive()->pindexBestHeader, *pindex,
+                                 *pnetMan->getChainActive()->pindexBestHeader, consensusParams) < nOneMonth);
+                        if (!send)
+                        {
+                            LogPrintf("%s: ignoring request from peer=%i for old block that isn't in the main chain\n",
+                                __func__, pfrom->GetId());
+                        }
                     }
                 }
-            }
-            // Disconnect node in case we have reached the outbound limit
-            // for serving historical blocks never disconnect whitelisted
-            // nodes.
-            // assume > 1 week = historical
-            static const int nOneWeek = 7 * 24 * 60 * 60;
-            if (send && connman.OutboundTargetReached(true) &&
-                (((pnetMan->getChainActive()->pindexBestHeader != nullptr) &&
-                     (pnetMan->getChainActive()->pindexBestHeader.load()->GetBlockTime() - pindex->GetBlockTime() >
-                         nOneWeek)) ||
-                    inv.type == MSG_FILTERED_BLOCK) &&
-                !pfrom->fWhitelisted)
-            {
-                LogPrintf("historical block serving limit reached, disconnect peer=%d\n", pfrom->GetId());
+                // Disconnect node in case we have reached the outbound limit
+                // for serving historical blocks never disconnect whitelisted
+                // nodes.
+                // assume > 1 week = historical
+                static const int nOneWeek = 7 * 24 * 60 * 60;
+                if (send && connman.OutboundTargetReached(true) &&
+                    (((pnetMan->getChainActive()->pindexBestHeader != nullptr) &&
+                         (pnetMan->getChainActive()->pindexBestHeader.load()->GetBlockTime() - pindex->GetBlockTime() >
+                             nOneWeek)) ||
+                        inv.type == MSG_FILTERED_BLOCK) &&
+                    !pfrom->fWhitelisted)
+                {
+                    LogPrintf("historical block serving limit reached, disconnect peer=%d\n", pfrom->GetId());
 
-                // disconnect node
-                pfrom->fDisconnect = true;
-                send = false;
+                    // disconnect node
+                    pfrom->fDisconnect = true;
+                    send = false;
+                }
+                // Pruned nodes may have deleted the block, so check whether
+                // it's available before trying to send.
+                send = send && (pindex->nStatus & BLOCK_HAVE_DATA);
+                hashTip = pnetMan->getChainActive()->chainActive.Tip()->GetBlockHash();
             }
-            // Pruned nodes may have deleted the block, so check whether
-            // it's available before trying to send.
-            if (send && (pindex->nStatus & BLOCK_HAVE_DATA))
+            if (send)
             {
                 // Send block from disk
                 CBlock block;
@@ -883,7 +889,7 @@ void static ProcessGetData(CNode *pfrom, CConnman &connman, const Consensus::Par
                     // redundant, and we want it right after the last block
                     // so they don't wait for other stuff first.
                     std::vector<CInv> vInv;
-                    vInv.push_back(CInv(MSG_BLOCK, pnetMan->getChainActive()->chainActive.Tip()->GetBlockHash()));
+                    vInv.push_back(CInv(MSG_BLOCK, hashTip));
                     connman.PushMessage(pfrom, NetMsgType::INV, vInv);
                 }
             }
@@ -944,6 +950,24 @@ void UnregisterNodeSignals(CNodeSignals &nodeSignals)
 }
 
 
+/** Tell the peer a block it sent failed validation, and penalise it for that */
+static void RejectInvalidBlock(CConnman &connman, NodeId nodeid, const uint256 &hash, const CValidationState &state)
+{
+    int nDoS;
+    if (!state.IsInvalid(nDoS))
+        return;
+    assert(state.GetRejectCode() < REJECT_INTERNAL); // Blocks are never rejected with internal reject codes
+    connman.ForNode(nodeid, [&connman, &hash, &state](CNode *pnode) {
+        connman.PushMessage(pnode, NetMsgType::REJECT, std::string(NetMsgType::BLOCK),
+            (unsigned char)state.GetRejectCode(), state.GetRejectReason().substr(0, MAX_REJECT_MESSAGE_LENGTH), hash);
+        return true;
+    });
+    if (nDoS > 0)
+    {
+        Misbehaving(nodeid, nDoS, "invalid-blk");
+    }
+}
+
 bool static ProcessMessage(CNode *pfrom,
     std::string strCommand,
     CDataStream &vRecv,
@@ -1817,10 +1841,10 @@ bool static ProcessMessage(CNode *pfrom,
 
     else if (strCommand == NetMsgType::BLOCK && !fImporting && !fReindex) // Ignore blocks received while importing
     {
-        CBlock block;
-        vRecv >> block;
+        std::shared_ptr<CBlock> pblock = std::make_shared<CBlock>();
+        vRecv >> *pblock;
 
-        const uint256 hash(block.GetHash());
+        const uint256 hash(pblock->GetHash());
         LogPrint("net", "received block %s peer=%d\n", hash.ToString(), pfrom->id);
 
         // Process all blocks from whitelisted peers, even if not requested,
@@ -1838,18 +1862,17 @@ bool static ProcessMessage(CNode *pfrom,
             // is fine.
             mapBlockSource.emplace(hash, std::make_pair(pfrom->GetId(), true));
         }
-        CValidationState state;
-        ProcessNewBlock(state, chainparams, pfrom, &block, forceProcessing, NULL);
-        int nDoS;
-        if (state.IsInvalid(nDoS))
+        // Leave the checks to a block check thread, so this thread can go on reading the blocks other
+        // peers sent meanwhile. The threads are joined before connman goes away.
+        const NodeId nodeid = pfrom->GetId();
+        CConnman *pconnman = &connman;
+        auto fnProcessed = [pconnman, nodeid, hash](
+            const CValidationState &state) { RejectInvalidBlock(*pconnman, nodeid, hash, state); };
+        if (!QueueNewBlock(pblock, forceProcessing, fnProcessed))
         {
-            assert(state.GetRejectCode() < REJECT_INTERNAL); // Blocks are never rejected with internal reject codes
-            connman.PushMessage(pfrom, NetMsgType::REJECT, strCommand, (unsigned char)state.GetRejectCode(),
-                state.GetRejectReason().substr(0, MAX_REJECT_MESSAGE_LENGTH), hash);
-            if (nDoS > 0)
-            {
-                Misbehaving(pfrom->GetId(), nDoS, "invalid-blk");
-            }
+            CValidationState state;
+            ProcessNewBlock(state, chainparams, pfrom, pblock.get(), forceProcessing, NULL);
+            fnProcessed(state);
         }
     }
 
@@ -1881,7 +1904,10 @@ bool static ProcessMessage(CNode *pfrom,
         }
         pfrom->fSentAddr = true;
 
-        pfrom->vAddrToSend.clear();
+        {
+            LOCK(pfrom->cs_vAddrToSend);
+            pfrom->vAddrToSend.clear();
+        }
         std::vector<CAddress> vAddr = connman.GetAddresses();
         FastRandomContext insecure_rand;
         for (const CAddress &addr : vAddr)
@@ -2228,7 +2254,13 @@ bool ProcessMessages(CNode *pfrom, CConnman &connman)
         // Just take one message
         msgs.splice(msgs.begin(), pfrom->vProcessMsg, pfrom->vProcessMsg.begin());
         pfrom->nProcessQueueSize -= msgs.front().vRecv.size() + CMessageHeader::HEADER_SIZE;
+        bool fWasPaused = pfrom->fPauseRecv;
         pfrom->fPauseRecv = pfrom->nProcessQueueSize > connman.GetReceiveFloodSize();
+        if (fWasPaused && !pfrom->fPauseRecv)
+        {
+            // The socket handler does not look at a paused node's socket until told to
+            connman.WakeSocketHandler();
+        }
         fMoreWork = !pfrom->vProcessMsg.empty();
     }
     CNetMessage &msg(msgs.front());
@@ -2376,6 +2408,8 @@ bool SendMessages(CNode *pto, CConnman &connman)
     CNodeState statem(CAddress(), "");
     const CNodeState *state = &statem;
     {
+        // Another message handler thread may be marking blocks from this peer as received
+        LOCK(cs_main);
         CNodeStateAccessor stateAccess(nodestateman, pto->GetId());
         if (state == nullptr)
         {
@@ -2399,31 +2433,31 @@ bool SendMessages(CNode *pto, CConnman &connman)
     {
         pto->nNextAddrSend = PoissonNextSend(nNow, AVG_ADDRESS_BROADCAST_INTERVAL);
         std::vector<CAddress> vAddr;
-        vAddr.reserve(pto->vAddrToSend.size());
-        for (const CAddress &addr : pto->vAddrToSend)
         {
-            if (!pto->addrKnown.contains(addr.GetKey()))
+            LOCK(pto->cs_vAddrToSend);
+            vAddr.reserve(pto->vAddrToSend.size());
+            for (const CAddress &addr : pto->vAddrToSend)
             {
-                pto->addrKnown.insert(addr.GetKey());
-                vAddr.push_back(addr);
-                // receiver rejects addr messages larger than 1000
-                if (vAddr.size() >= 1000)
+                if (!pto->addrKnown.contains(addr.GetKey()))
                 {
-                    connman.PushMessage(pto, NetMsgType::ADDR, vAddr);
-                    vAddr.clear();
+                    pto->addrKnown.insert(addr.GetKey());
+                    vAddr.push_back(addr);
                 }
             }
-        }
-        pto->vAddrToSend.clear();
-        if (!vAddr.empty())
-        {
-            connman.PushMessage(pto, NetMsgType::ADDR, vAddr);
-        }
+            pto->vAddrToSend.clear();
 
-        // we only send the big addr message once
-        if (pto->vAddrToSend.capacity() > 40)
+            // we only send the big addr message once
+            if (pto->vAddrToSend.capacity() > 40)
+            {
+                pto->vAddrToSend.shrink_to_fit();
+            }
+        }
+        // receiver rejects addr messages larger than 1000
+        for (size_t nStart = 0; nStart < vAddr.size(); nStart += 1000)
         {
-            pto->vAddrToSend.shrink_to_fit();
+            std::vector<CAddress> vAddrMsg(
+                vAddr.begin() + nStart, vAddr.begin() + std::min(vAddr.size(), nStart + 1000));
+            connman.PushMessage(pto, NetMsgType::ADDR, vAddrMsg);
         }
     }
 
@@ -2712,7 +2746,8 @@ bool SendMessages(CNode *pto, CConnman &connman)
             targetSpacing = 150;
         }
         const QueuedBlock &queuedBlock = state->vBlocksInFlight.front();
-        int nOtherPeersWithValidatedDownloads = nPeersWithValidatedDownloads - (state->nBlocksInFlightValidHeaders > 0);
+        int nOtherPeersWithValidatedDownloads =
+            nPeersWithValidatedDownloads.load() - (state->nBlocksInFlightValidHeaders > 0);
         if (nNow > state->nDownloadingSince +
                        targetSpacing * (BLOCK_DOWNLOAD_TIMEOUT_BASE +
                                            BLOCK_DOWNLOAD_TIMEOUT_PER_PEER * nOtherPeersWithValidatedDownloads))
@@ -2735,13 +2770,14 @@ bool SendMessages(CNode *pto, CConnman &connman)
     {
         std::vector<const CBlockIndex *> vToDownload;
         NodeId staller = -1;
+        // Held across both, so that no other peer's handler requests the same blocks in between
+        LOCK(cs_main);
         FindNextBlocksToDownload(
             pto->GetId(), MAX_BLOCKS_IN_TRANSIT_PER_PEER - state->nBlocksInFlight, vToDownload, staller);
         for (const CBlockIndex *pindex : vToDownload)
         {
             uint32_t nFetchFlags = GetFetchFlags(pto, pindex->pprev, consensusParams);
             vGetData.push_back(CInv(MSG_BLOCK | nFetchFlags, pindex->GetBlockHash()));
-            LOCK(cs_main);
             MarkBlockAsInFlight(pto->GetId(), pindex->GetBlockHash(), consensusParams, pindex);
             LogPrint("net", "Requesting block %s (%d) peer=%d\n", pindex->GetBlockHash().ToString(), pindex->nHeight,
                 pto->id);
@@ -2751,25 +2787,29 @@ bool SendMessages(CNode *pto, CConnman &connman)
     //
     // Message: getdata (non-blocks)
     //
-    while (!pto->mapAskFor.empty() && (*pto->mapAskFor.begin()).first <= nNow)
+    if (!pto->mapAskFor.empty() && (*pto->mapAskFor.begin()).first <= nNow)
     {
-        const CInv &inv = (*pto->mapAskFor.begin()).second;
-        if (!AlreadyHave(inv))
+        LOCK(cs_main);
+        while (!pto->mapAskFor.empty() && (*pto->mapAskFor.begin()).first <= nNow)
         {
-            LogPrint("net", "Requesting %s peer=%d\n", inv.ToString(), pto->id);
-            vGetData.push_back(inv);
-            if (vGetData.size() >= 1000)
+            const CInv &inv = (*pto->mapAskFor.begin()).second;
+            if (!AlreadyHave(inv))
             {
-                connman.PushMessage(pto, NetMsgType::GETDATA, vGetData);
-                vGetData.clear();
+                LogPrint("net", "Requesting %s peer=%d\n", inv.ToString(), pto->id);
+                vGetData.push_back(inv);
+                if (vGetData.size() >= 1000)
+                {
+                    connman.PushMessage(pto, NetMsgType::GETDATA, vGetData);
+                    vGetData.clear();
+                }
             }
+            else
+            {
+                // If we're not going to ask, don't expect a response.
+                pto->setAskFor.erase(inv.hash);
+            }
+            pto->mapAskFor.erase(pto->mapAskFor.begin());
         }
-        else
-        {
-            // If we're not going to ask, don't expect a response.
-            pto->setAskFor.erase(inv.hash);
-        }
-        pto->mapAskFor.erase(pto->mapAskFor.begin());
     }
     if (!vGetData.empty())
     {
@@ -2778,24 +2818,21 @@ bool SendMessages(CNode *pto, CConnman &connman)
 
     if (IsBetaEnabled())
     {
-        std::set<RREQRESPONSE> responseQueue_copy;
+        // Other peers' handler threads may queue responses concurrently, so the
+        // queue is taken apart under a single write lock
+        RECURSIVEWRITELOCK(g_aodvtable.cs_aodv);
+        std::set<RREQRESPONSE>::iterator it = g_aodvtable.responseQueue.begin();
+        while (it != g_aodvtable.responseQueue.end())
         {
-            RECURSIVEREADLOCK(g_aodvtable.cs_aodv);
-            for (const auto &response : g_aodvtable.responseQueue)
+            if (it->source == pto->routing_id)
             {
-                if (response.source == pto->routing_id)
-                {
-                    connman.PushMessage(pto, NetMsgType::RREP, response.nonce, response.pubkey, response.found);
-                }
-                else
-                {
-                    responseQueue_copy.emplace(response);
-                }
+                connman.PushMessage(pto, NetMsgType::RREP, it->nonce, it->pubkey, it->found);
+                it = g_aodvtable.responseQueue.erase(it);
+            }
+            else
+            {
+                ++it;
             }
-        }
-        {
-            RECURSIVEWRITELOCK(g_aodvtable.cs_aodv);
-            g_aodvtable.responseQueue = responseQueue_copy;
         }
     }
 
@@ -27,6 +27,11 @@
 #include <fcntl.h>
 #endif
 
+#ifdef USE_EPOLL
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#endif
+
 #ifdef USE_UPNP
 #include <miniupnpc/miniupnpc.h>
 #include <miniupnpc/miniwget.h>
@@ -65,6 +70,15 @@
 
 static const std::string NET_MESSAGE_COMMAND_OTHER = "*other*";
 
+#ifdef USE_EPOLL
+// How long the epoll socket handler sleeps at most, it checks for inactivity and disconnects in between
+static const int SOCKET_HANDLER_WAIT_MILLISECONDS = 500;
+static const int EPOLL_EVENTS_PER_WAIT = 256;
+// epoll data of the wakeup eventfd, of listen socket i it is EPOLL_DATA_LISTEN | i, of a node its id
+static const uint64_t EPOLL_DATA_WAKEUP = ~(uint64_t)0;
+static const uint64_t EPOLL_DATA_LISTEN = (uint64_t)1 << 62;
+#endif
+
 // SHA256("netgroup")[0:8]
 static const uint64_t RANDOMIZER_ID_NETGROUP = 0x6c0edd8036ef4036ULL;
 // SHA256("localhostnonce")[0:8]
@@ -357,7 +371,7 @@ CNode *CConnman::ConnectNode(CAddress addrConnect, const char *pszDest, bool fCo
                       pnetMan->getActivePaymentNetwork()->GetDefaultPort(), nConnectTimeout, &proxyConnectionFailed) :
                   ConnectSocket(addrConnect, hSocket, nConnectTimeout, &proxyConnectionFailed))
     {
-        if (!IsSelectableSocket(hSocket))
+        if (!IsSocketUsable(hSocket))
         {
             LogPrintf("Cannot create connection: non-selectable socket created "
                       "(fd >= FD_SETSIZE ?)\n");
@@ -1058,7 +1072,7 @@ void CConnman::AcceptConnection(const ListenSocket &hListenSocket)
         return;
     }
 
-    if (!IsSelectableSocket(hSocket))
+    if (!IsSocketUsable(hSocket))
     {
         LogPrintf("connection from %s dropped: non-selectable socket\n", addr.ToString());
         CloseSocket(hSocket);
@@ -1151,77 +1165,380 @@ void CConnman::AcceptConnection(const ListenSocket &hListenSocket)
     {
         LOCK(cs_vNodes);
         vNodes.push_back(pnode);
+#ifdef USE_EPOLL
+        // Registered once the node is in vNodes, where the socket handler looks its events up
+        RegisterSocket(pnode->hSocket, pnode->GetId(), EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET);
+#endif
     }
 }
 
-void CConnman::ThreadSocketHandler()
+bool CConnman::IsSocketUsable(SOCKET hSocket) const
 {
-    unsigned int nPrevNodeCount = 0;
-    while (interruptNet.load() == false)
+#ifdef USE_EPOLL
+    if (hEpoll != -1)
     {
-        //
-        // Disconnect nodes
-        //
+        return true;
+    }
+#endif
+    return IsSelectableSocket(hSocket);
+}
+
+void CConnman::DisconnectNodes()
+{
+    {
+        LOCK(cs_vNodes);
+        // Disconnect unused nodes
+        std::vector<CNode *> vNodesCopy = vNodes;
+        for (CNode *pnode : vNodesCopy)
         {
-            LOCK(cs_vNodes);
-            // Disconnect unused nodes
-            std::vector<CNode *> vNodesCopy = vNodes;
-            for (CNode *pnode : vNodesCopy)
+            if (pnode->fDisconnect)
             {
-                if (pnode->fDisconnect)
-                {
-                    // remove from vNodes
-                    vNodes.erase(remove(vNodes.begin(), vNodes.end(), pnode), vNodes.end());
+                // remove from vNodes
+                vNodes.erase(remove(vNodes.begin(), vNodes.end(), pnode), vNodes.end());
 
-                    // release outbound grant (if any)
-                    pnode->grantOutbound.Release();
+                // release outbound grant (if any)
+                pnode->grantOutbound.Release();
 
-                    // close socket and cleanup
-                    pnode->CloseSocketDisconnect();
+                // close socket and cleanup
+                pnode->CloseSocketDisconnect();
 
-                    // hold in disconnected pool until all refs are released
-                    pnode->Release();
-                    vNodesDisconnected.push_back(pnode);
-                }
+                // hold in disconnected pool until all refs are released
+                pnode->Release();
+                vNodesDisconnected.push_back(pnode);
             }
         }
+    }
+    {
+        // Delete disconnected nodes
+        std::list<CNode *> vNodesDisconnectedCopy = vNodesDisconnected;
+        for (CNode *pnode : vNodesDisconnectedCopy)
         {
-            // Delete disconnected nodes
-            std::list<CNode *> vNodesDisconnectedCopy = vNodesDisconnected;
-            for (CNode *pnode : vNodesDisconnectedCopy)
+            // wait until threads are done using it
+            if (pnode->GetRefCount() <= 0)
             {
-                // wait until threads are done using it
-                if (pnode->GetRefCount() <= 0)
+                bool fDelete = false;
                 {
-                    bool fDelete = false;
+                    TRY_LOCK(pnode->cs_inventory, lockInv);
+                    if (lockInv)
                     {
-                        TRY_LOCK(pnode->cs_inventory, lockInv);
-                        if (lockInv)
+                        TRY_LOCK(pnode->cs_vSend, lockSend);
+                        if (lockSend)
                         {
-                            TRY_LOCK(pnode->cs_vSend, lockSend);
-                            if (lockSend)
-                            {
-                                fDelete = true;
-                            }
+                            fDelete = true;
                         }
                     }
-                    if (fDelete)
+                }
+                if (fDelete)
+                {
+                    vNodesDisconnected.remove(pnode);
+                    DeleteNode(pnode);
+                }
+            }
+        }
+    }
+}
+
+bool CConnman::SocketRecvData(CNode *pnode)
+{
+    // typical socket buffer is 8K-64K
+    char pchBuf[0x10000];
+    int nBytes = 0;
+    {
+        LOCK(pnode->cs_hSocket);
+        if (pnode->hSocket == INVALID_SOCKET)
+        {
+            return false;
+        }
+        nBytes = recv(pnode->hSocket, pchBuf, sizeof(pchBuf), MSG_DONTWAIT);
+    }
+    if (nBytes > 0)
+    {
+        bool notify = false;
+        if (!pnode->ReceiveMsgBytes(pchBuf, nBytes, notify))
+        {
+            pnode->CloseSocketDisconnect();
+        }
+        RecordBytesRecv(nBytes);
+        if (notify)
+        {
+            size_t nSizeAdded = 0;
+            auto it(pnode->vRecvMsg.begin());
+            for (; it != pnode->vRecvMsg.end(); ++it)
+            {
+                if (!it->complete())
+                {
+                    break;
+                }
+                nSizeAdded += it->vRecv.size() + CMessageHeader::HEADER_SIZE;
+            }
+            {
+                LOCK(pnode->cs_vProcessMsg);
+                pnode->vProcessMsg.splice(pnode->vProcessMsg.end(), pnode->vRecvMsg, pnode->vRecvMsg.begin(), it);
+                pnode->nProcessQueueSize += nSizeAdded;
+                pnode->fPauseRecv = pnode->nProcessQueueSize > nReceiveFloodSize;
+            }
+            WakeMessageHandler(pnode->GetId());
+        }
+        // A short read drained the socket
+        return nBytes == sizeof(pchBuf);
+    }
+    else if (nBytes == 0)
+    {
+        // socket closed gracefully
+        if (!pnode->fDisconnect)
+        {
+            LogPrintf("socket closed\n");
+        }
+        pnode->CloseSocketDisconnect();
+    }
+    else if (nBytes < 0)
+    {
+        // error
+        int nErr = WSAGetLastError();
+        if (nErr != WSAEWOULDBLOCK && nErr != WSAEMSGSIZE && nErr != WSAEINTR && nErr != WSAEINPROGRESS)
+        {
+            if (!pnode->fDisconnect)
+            {
+                LogPrintf("socket recv error %s\n", NetworkErrorString(nErr));
+            }
+            pnode->CloseSocketDisconnect();
+        }
+    }
+    return false;
+}
+
+void CConnman::InactivityCheck(CNode *pnode)
+{
+    int64_t nTime = GetSystemTimeInSeconds();
+    if (nTime - pnode->nTimeConnected > 60)
+    {
+        if (pnode->nLastRecv == 0 || pnode->nLastSend == 0)
+        {
+            LogPrintf("socket no message in first 60 "
+                      "seconds, %d %d from %d\n",
+                pnode->nLastRecv != 0, pnode->nLastSend != 0, pnode->id);
+            pnode->fDisconnect = true;
+        }
+        else if (nTime - pnode->nLastSend > TIMEOUT_INTERVAL)
+        {
+            LogPrintf("socket sending timeout: %is\n", nTime - pnode->nLastSend);
+            pnode->fDisconnect = true;
+        }
+        else if (nTime - pnode->nLastRecv > TIMEOUT_INTERVAL)
+        {
+            LogPrintf("socket receive timeout: %is\n", nTime - pnode->nLastRecv);
+            pnode->fDisconnect = true;
+        }
+        else if (pnode->nPingNonceSent && pnode->nPingUsecStart + TIMEOUT_INTERVAL * 1000000 < GetTimeMicros())
+        {
+            LogPrintf("ping timeout: %fs\n", 0.000001 * (GetTimeMicros() - pnode->nPingUsecStart));
+            pnode->fDisconnect = true;
+        }
+        else if (!pnode->fSuccessfullyConnected)
+        {
+            LogPrintf("version handshake timeout from %d\n", pnode->id);
+            pnode->fDisconnect = true;
+        }
+    }
+}
+
+void CConnman::WakeSocketHandler()
+{
+#ifdef USE_EPOLL
+    if (hWakeup != -1 && !fWakeupPending.exchange(true))
+    {
+        uint64_t nOne = 1;
+        if (write(hWakeup, &nOne, sizeof(nOne)) != sizeof(nOne))
+        {
+            LogPrint("net", "socket handler wakeup failed: %s\n", NetworkErrorString(errno));
+        }
+    }
+#endif
+}
+
+#ifdef USE_EPOLL
+void CConnman::RegisterSocket(SOCKET hSocket, uint64_t nData, uint32_t nEvents)
+{
+    if (hEpoll == -1)
+    {
+        return;
+    }
+    struct epoll_event event;
+    event.events = nEvents;
+    event.data.u64 = nData;
+    if (epoll_ctl(hEpoll, EPOLL_CTL_ADD, hSocket, &event) != 0)
+    {
+        LogPrintf("epoll_ctl failed to add socket: %s\n", NetworkErrorString(errno));
+    }
+}
+
+void CConnman::ThreadSocketHandlerEpoll()
+{
+    std::vector<struct epoll_event> vEvents(EPOLL_EVENTS_PER_WAIT);
+    // Nodes that could not be serviced completely in the last pass
+    std::set<NodeId> setMoreWork;
+    int64_t nLastInactivityCheck = 0;
+    while (interruptNet.load() == false)
+    {
+        DisconnectNodes();
+
+        int nEvents = epoll_wait(hEpoll, vEvents.data(), vEvents.size(),
+            setMoreWork.empty() ? SOCKET_HANDLER_WAIT_MILLISECONDS : 0);
+        if (interruptNet.load() == true)
+        {
+            return;
+        }
+        if (nEvents < 0)
+        {
+            int nErr = errno;
+            if (nErr != EINTR)
+            {
+                LogPrintf("socket epoll_wait error %s\n", NetworkErrorString(nErr));
+                MilliSleep(SOCKET_HANDLER_WAIT_MILLISECONDS);
+            }
+            nEvents = 0;
+        }
+
+        //
+        // Accept new connections and collect the readiness of the nodes' sockets
+        //
+        bool fWoken = false;
+        std::map<NodeId, uint32_t> mapNodeEvents;
+        for (int i = 0; i < nEvents; i++)
+        {
+            const uint64_t nData = vEvents[i].data.u64;
+            if (nData == EPOLL_DATA_WAKEUP)
+            {
+                // Clear the flag first, so that a wakeup requested while draining is not lost
+                fWakeupPending = false;
+                uint64_t nCount;
+                if (read(hWakeup, &nCount, sizeof(nCount)) < 0 && errno != EAGAIN)
+                {
+                    LogPrint("net", "socket handler wakeup read failed: %s\n", NetworkErrorString(errno));
+                }
+                fWoken = true;
+            }
+            else if (nData & EPOLL_DATA_LISTEN)
+            {
+                AcceptConnection(vhListenSocket[nData & ~EPOLL_DATA_LISTEN]);
+            }
+            else
+            {
+                mapNodeEvents[(NodeId)nData] |= vEvents[i].events;
+            }
+        }
+
+        int64_t nNow = GetSystemTimeInSeconds();
+        bool fInactivityCheck = nNow != nLastInactivityCheck;
+        nLastInactivityCheck = nNow;
+
+        //
+        // Service the sockets that became ready, the ones left over from the last pass,
+        // and all of them when woken up or due for the inactivity check
+        //
+        std::vector<CNode *> vNodesCopy;
+        {
+            LOCK(cs_vNodes);
+            for (CNode *pnode : vNodes)
+            {
+                std::map<NodeId, uint32_t>::const_iterator it = mapNodeEvents.find(pnode->GetId());
+                if (it != mapNodeEvents.end())
+                {
+                    if (it->second & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR))
+                    {
+                        pnode->fSocketReadable = true;
+                    }
+                    if (it->second & (EPOLLOUT | EPOLLHUP | EPOLLERR))
                     {
-                        vNodesDisconnected.remove(pnode);
-                        DeleteNode(pnode);
+                        pnode->fSocketWritable = true;
                     }
                 }
+                else if (!fWoken && !fInactivityCheck && setMoreWork.count(pnode->GetId()) == 0)
+                {
+                    continue;
+                }
+                pnode->AddRef();
+                vNodesCopy.push_back(pnode);
             }
         }
-        size_t vNodesSize;
+        setMoreWork.clear();
+
+        for (CNode *pnode : vNodesCopy)
         {
-            LOCK(cs_vNodes);
-            vNodesSize = vNodes.size();
+            if (interruptNet.load() == true)
+            {
+                break;
+            }
+
+            // As in the select() loop, drain the send buffer before receiving more
+            bool fSendQueued = false;
+            {
+                LOCK(pnode->cs_vSend);
+                fSendQueued = !pnode->vSendMsg.empty();
+            }
+
+            //
+            // Receive
+            //
+            if (!fSendQueued && pnode->fSocketReadable && !pnode->fPauseRecv && !SocketRecvData(pnode))
+            {
+                pnode->fSocketReadable = false;
+            }
+
+            //
+            // Send
+            //
+            if (fSendQueued && pnode->fSocketWritable)
+            {
+                LOCK(pnode->cs_vSend);
+                size_t nBytes = SocketSendData(pnode);
+                if (nBytes)
+                {
+                    RecordBytesSent(nBytes);
+                }
+                // What is left waits for the socket to become writable again
+                fSendQueued = !pnode->vSendMsg.empty();
+                pnode->fSocketWritable = !fSendQueued;
+            }
+
+            //
+            // Inactivity checking
+            //
+            if (fInactivityCheck)
+            {
+                InactivityCheck(pnode);
+            }
+
+            // Edge triggered events are not repeated, so a socket with unread data is serviced
+            // again in the next pass without waiting, unless it is paused or waits for sending
+            if (pnode->fSocketReadable && !pnode->fPauseRecv && !fSendQueued && !pnode->fDisconnect)
+            {
+                setMoreWork.insert(pnode->GetId());
+            }
         }
-        if (vNodesSize != nPrevNodeCount)
         {
-            nPrevNodeCount = vNodesSize;
+            LOCK(cs_vNodes);
+            for (CNode *pnode : vNodesCopy)
+            {
+                pnode->Release();
+            }
         }
+    }
+}
+#endif
+
+void CConnman::ThreadSocketHandler()
+{
+#ifdef USE_EPOLL
+    if (hEpoll != -1)
+    {
+        ThreadSocketHandlerEpoll();
+        return;
+    }
+#endif
+    while (interruptNet.load() == false)
+    {
+        DisconnectNodes();
 
         //
         // Find which sockets have data to receive
@@ -1365,68 +1682,7 @@ void CConnman::ThreadSocketHandler()
             }
             if (recvSet || errorSet)
             {
-                // typical socket buffer is 8K-64K
-                char pchBuf[0x10000];
-                int nBytes = 0;
-                {
-                    LOCK(pnode->cs_hSocket);
-                    if (pnode->hSocket == INVALID_SOCKET)
-                    {
-                        continue;
-                    }
-                    nBytes = recv(pnode->hSocket, pchBuf, sizeof(pchBuf), MSG_DONTWAIT);
-                }
-                if (nBytes > 0)
-                {
-                    bool notify = false;
-                    if (!pnode->ReceiveMsgBytes(pchBuf, nBytes, notify))
-                    {
-                        pnode->CloseSocketDisconnect();
-                    }
-                    RecordBytesRecv(nBytes);
-                    if (notify)
-                    {
-                        size_t nSizeAdded = 0;
-                        auto it(pnode->vRecvMsg.begin());
-                        for (; it != pnode->vRecvMsg.end(); ++it)
-                        {
-                            if (!it->complete())
-                            {
-                                break;
-                            }
-                            nSizeAdded += it->vRecv.size() + CMessageHeader::HEADER_SIZE;
-                        }
-                        {
-                            LOCK(pnode->cs_vProcessMsg);
-                            pnode->vProcessMsg.splice(
-                                pnode->vProcessMsg.end(), pnode->vRecvMsg, pnode->vRecvMsg.begin(), it);
-                            pnode->nProcessQueueSize += nSizeAdded;
-                            pnode->fPauseRecv = pnode->nProcessQueueSize > nReceiveFloodSize;
-                        }
-                    }
-                }
-                else if (nBytes == 0)
-                {
-                    // socket closed gracefully
-                    if (!pnode->fDisconnect)
-                    {
-                        LogPrintf("socket closed\n");
-                    }
-                    pnode->CloseSocketDisconnect();
-                }
-                else if (nBytes < 0)
-                {
-                    // error
-                    int nErr = WSAGetLastError();
-                    if (nErr != WSAEWOULDBLOCK && nErr != WSAEMSGSIZE && nErr != WSAEINTR && nErr != WSAEINPROGRESS)
-                    {
-                        if (!pnode->fDisconnect)
-                        {
-                            LogPrintf("socket recv error %s\n", NetworkErrorString(nErr));
-                        }
-                        pnode->CloseSocketDisconnect();
-                    }
-                }
+                SocketRecvData(pnode);
             }
 
             //
@@ -1445,37 +1701,7 @@ void CConnman::ThreadSocketHandler()
             //
             // Inactivity checking
             //
-            int64_t nTime = GetSystemTimeInSeconds();
-            if (nTime - pnode->nTimeConnected > 60)
-            {
-                if (pnode->nLastRecv == 0 || pnode->nLastSend == 0)
-                {
-                    LogPrintf("socket no message in first 60 "
-                              "seconds, %d %d from %d\n",
-                        pnode->nLastRecv != 0, pnode->nLastSend != 0, pnode->id);
-                    pnode->fDisconnect = true;
-                }
-                else if (nTime - pnode->nLastSend > TIMEOUT_INTERVAL)
-                {
-                    LogPrintf("socket sending timeout: %is\n", nTime - pnode->nLastSend);
-                    pnode->fDisconnect = true;
-                }
-                else if (nTime - pnode->nLastRecv > TIMEOUT_INTERVAL)
-                {
-                    LogPrintf("socket receive timeout: %is\n", nTime - pnode->nLastRecv);
-                    pnode->fDisconnect = true;
-                }
-                else if (pnode->nPingNonceSent && pnode->nPingUsecStart + TIMEOUT_INTERVAL * 1000000 < GetTimeMicros())
-                {
-                    LogPrintf("ping timeout: %fs\n", 0.000001 * (GetTimeMicros() - pnode->nPingUsecStart));
-                    pnode->fDisconnect = true;
-                }
-                else if (!pnode->fSuccessfullyConnected)
-                {
-                    LogPrintf("version handshake timeout from %d\n", pnode->id);
-                    pnode->fDisconnect = true;
-                }
-            }
+            InactivityCheck(pnode);
         }
         {
             LOCK(cs_vNodes);
@@ -2168,22 +2394,45 @@ bool CConnman::OpenNetworkConnection(const CAddress &addrConnect,
     {
         LOCK(cs_vNodes);
         vNodes.push_back(pnode);
+#ifdef USE_EPOLL
+        // Registered once the node is in vNodes, where the socket handler looks its events up
+        RegisterSocket(pnode->hSocket, pnode->GetId(), EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET);
+#endif
     }
 
     return true;
 }
 
-void CConnman::ThreadMessageHandler()
+void CConnman::WakeMessageHandler(NodeId id)
+{
+    if (vMessageHandlerSignals.empty())
+    {
+        return;
+    }
+    MessageHandlerSignal &signal = *vMessageHandlerSignals[id % nMessageHandlerThreads];
+    {
+        std::lock_guard<std::mutex> lock(signal.mutex);
+        signal.fWake = true;
+    }
+    signal.cond.notify_one();
+}
+
+void CConnman::ThreadMessageHandler(int nThread)
 {
+    MessageHandlerSignal &signal = *vMessageHandlerSignals[nThread];
     while (interruptNet.load() == false)
     {
+        // A node always goes to the same thread, so its messages are processed in the order they arrived
         std::vector<CNode *> vNodesCopy;
         {
             LOCK(cs_vNodes);
-            vNodesCopy = vNodes;
-            for (CNode *pnode : vNodesCopy)
+            for (CNode *pnode : vNodes)
             {
-                pnode->AddRef();
+                if (pnode->GetId() % nMessageHandlerThreads == nThread)
+                {
+                    pnode->AddRef();
+                    vNodesCopy.push_back(pnode);
+                }
             }
         }
 
@@ -2215,10 +2464,12 @@ void CConnman::ThreadMessageHandler()
             }
         }
 
+        std::unique_lock<std::mutex> lock(signal.mutex);
         if (!fMoreWork)
         {
-            MilliSleep(100);
+            signal.cond.wait_for(lock, std::chrono::milliseconds(100), [&signal] { return signal.fWake; });
         }
+        signal.fWake = false;
     }
 }
 
@@ -2246,7 +2497,7 @@ bool CConnman::BindListenPort(const CService &addrBind, std::string &strError, b
         LogPrintf("%s\n", strError);
         return false;
     }
-    if (!IsSelectableSocket(hListenSocket))
+    if (!IsSocketUsable(hListenSocket))
     {
         strError = "Error: Couldn't create a listenable socket for incoming "
                    "connections";
@@ -2330,6 +2581,10 @@ bool CConnman::BindListenPort(const CService &addrBind, std::string &strError, b
     }
 
     vhListenSocket.push_back(ListenSocket(hListenSocket, fWhitelisted));
+#ifdef USE_EPOLL
+    // Level triggered, the socket handler accepts one connection per event
+    RegisterSocket(hListenSocket, EPOLL_DATA_LISTEN | (vhListenSocket.size() - 1), EPOLLIN);
+#endif
 
     if (addrBind.IsRoutable() && fDiscover && !fWhitelisted)
     {
@@ -2406,6 +2661,7 @@ CConnman::CConnman(uint64_t nSeed0In, uint64_t nSeed1In) : nSeed0(nSeed0In), nSe
     nLastNodeId = 0;
     nSendBufferMaxSize = 0;
     nReceiveFloodSize = 0;
+    nMessageHandlerThreads = 0;
     semOutbound = nullptr;
     semAddnode = nullptr;
     nMaxConnections = 0;
@@ -2414,6 +2670,28 @@ CConnman::CConnman(uint64_t nSeed0In, uint64_t nSeed1In) : nSeed0(nSeed0In), nSe
     nBestHeight = 0;
     interruptNet.store(false);
     tagstore = new CNetTagStore(strRoutingFile);
+#ifdef USE_EPOLL
+    fWakeupPending = false;
+    hEpoll = epoll_create1(EPOLL_CLOEXEC);
+    hWakeup = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    struct epoll_event event;
+    event.events = EPOLLIN;
+    event.data.u64 = EPOLL_DATA_WAKEUP;
+    if (hEpoll == -1 || hWakeup == -1 || epoll_ctl(hEpoll, EPOLL_CTL_ADD, hWakeup, &event) != 0)
+    {
+        LogPrintf("Cannot use epoll, falling back to select(): %s\n", NetworkErrorString(errno));
+        if (hEpoll != -1)
+        {
+            close(hEpoll);
+        }
+        if (hWakeup != -1)
+        {
+            close(hWakeup);
+        }
+        hEpoll = -1;
+        hWakeup = -1;
+    }
+#endif
 }
 
 NodeId CConnman::GetNewNodeId() { return nLastNodeId.fetch_add(1, std::memory_order_relaxed); }
@@ -2518,6 +2796,20 @@ bool CConnman::Start(std::string &strNodeError)
         semAddnode = MakeUnique<CSemaphore>(nMaxAddnode);
     }
 
+    // The socket handler wakes the message handlers up, so they are set up first
+    nMessageHandlerThreads = (int)gArgs.GetArg("-msghandlerthreads", DEFAULT_MESSAGE_HANDLER_THREADS);
+    if (nMessageHandlerThreads <= 0)
+    {
+        nMessageHandlerThreads = GetNumCores();
+    }
+    nMessageHandlerThreads = std::max(1, std::min(nMessageHandlerThreads, MAX_MESSAGE_HANDLER_THREADS));
+    LogPrintf("Using %d message handler threads\n", nMessageHandlerThreads);
+    vMessageHandlerSignals.clear();
+    for (int i = 0; i < nMessageHandlerThreads; i++)
+    {
+        vMessageHandlerSignals.emplace_back(new MessageHandlerSignal());
+    }
+
     //
     // Start threads
     //
@@ -2546,7 +2838,10 @@ bool CConnman::Start(std::string &strNodeError)
     }
 
     // Process messages
-    netThreads.create_thread(&CConnman::ThreadMessageHandler, this);
+    for (int i = 0; i < nMessageHandlerThreads; i++)
+    {
+        netThreads.create_thread(&CConnman::ThreadMessageHandler, this, i);
+    }
 
     // Dump network addresses
     netThreads.create_thread(&CConnman::DumpData, this, DUMP_ADDRESSES_INTERVAL);
@@ -2571,6 +2866,15 @@ void CConnman::Interrupt()
 {
     interruptNet.store(true);
     InterruptSocks5(true);
+    WakeSocketHandler();
+    for (std::unique_ptr<MessageHandlerSignal> &signal : vMessageHandlerSignals)
+    {
+        {
+            std::lock_guard<std::mutex> lock(signal->mutex);
+            signal->fWake = true;
+        }
+        signal->cond.notify_all();
+    }
 
     if (semOutbound)
     {
@@ -2648,6 +2952,13 @@ CConnman::~CConnman()
 {
     Interrupt();
     Stop();
+#ifdef USE_EPOLL
+    if (hEpoll != -1)
+    {
+        close(hEpoll);
+        close(hWakeup);
+    }
+#endif
 }
 
 size_t CConnman::GetAddressCount() const { return addrman.size(); }
@@ -2929,6 +3240,8 @@ CNode::CNode(NodeId idIn,
     nMinPingUsecTime = std::numeric_limits<int64_t>::max();
     fPauseRecv = false;
     fPauseSend = false;
+    fSocketReadable = false;
+    fSocketWritable = false;
     nProcessQueueSize = 0;
     nNetworkServiceVersion = 0;
 
@@ -13,6 +13,7 @@
 #include <cstdint>
 #include <deque>
 #include <memory>
+#include <mutex>
 #include <stdint.h>
 #include <thread>
 
@@ -89,6 +90,10 @@ static const bool DEFAULT_BLOCKSONLY = false;
 static const bool DEFAULT_FORCEDNSSEED = true;
 static const size_t DEFAULT_MAXRECEIVEBUFFER = 5 * 1000;
 static const size_t DEFAULT_MAXSENDBUFFER = 1 * 1000;
+/** Number of message handler threads, 0 for one per core */
+static const int DEFAULT_MESSAGE_HANDLER_THREADS = 0;
+/** Maximum number of message handler threads */
+static const int MAX_MESSAGE_HANDLER_THREADS = 16;
 
 static const ServiceFlags REQUIRED_SERVICES = ServiceFlags(NODE_NETWORK);
 
@@ -250,6 +255,10 @@ public:
     const uint64_t nKeyedNetGroup;
     std::atomic_bool fPauseRecv;
     std::atomic_bool fPauseSend;
+    // Readiness of the socket as last reported by epoll, only used by the
+    // socket handler thread. Cleared when a read or write would block.
+    bool fSocketReadable;
+    bool fSocketWritable;
     CPubKey routing_id;
 
 protected:
@@ -260,6 +269,8 @@ public:
     std::atomic<int> nStartingHeight;
 
     // flood relay
+    // vAddrToSend and addrKnown are protected by cs_vAddrToSend, peers' addresses are pushed by other threads
+    CCriticalSection cs_vAddrToSend;
     std::vector<CAddress> vAddrToSend;
     CRollingBloomFilter addrKnown;
     bool fGetAddr;
@@ -359,12 +370,17 @@ public:
     }
 
     void Release() { nRefCount--; }
-    void AddAddressKnown(const CAddress &_addr) { addrKnown.insert(_addr.GetKey()); }
+    void AddAddressKnown(const CAddress &_addr)
+    {
+        LOCK(cs_vAddrToSend);
+        addrKnown.insert(_addr.GetKey());
+    }
     void PushAddress(const CAddress &_addr, FastRandomContext &insecure_rand)
     {
         // Known checking here is only to save space from duplicates.
         // SendMessages will filter it again for knowns that were added
         // after addresses were pushed.
+        LOCK(cs_vAddrToSend);
         if (_addr.IsValid() && !addrKnown.contains(_addr.GetKey()))
         {
             if (vAddrToSend.size() >= MAX_ADDR_TO_SEND)
@@ -445,6 +461,11 @@ public:
 
     bool ForNode(NodeId id, std::function<bool(CNode *pnode)> func);
 
+    //! Make the socket handler look at every node's socket again, e.g. after data got queued or receiving resumed
+    void WakeSocketHandler();
+    //! Wake up the message handler thread of node id, e.g. after complete messages were received from it
+    void WakeMessageHandler(NodeId id);
+
     template <typename... Args>
     void PushMessage(CNode *pnode, std::string sCommand, Args &&... args)
     {
@@ -463,6 +484,7 @@ public:
         CVectorWriter{SER_NETWORK, MIN_PROTO_VERSION, serializedHeader, 0, hdr};
 
         size_t nBytesSent = 0;
+        bool fWake = false;
         {
             LOCK(pnode->cs_vSend);
             bool optimisticSend(pnode->vSendMsg.empty());
@@ -492,12 +514,18 @@ public:
             if (optimisticSend == true)
             {
                 nBytesSent = SocketSendData(pnode);
+                // Leave the rest to the socket handler
+                fWake = !pnode->vSendMsg.empty();
             }
         }
         if (nBytesSent)
         {
             RecordBytesSent(nBytesSent);
         }
+        if (fWake)
+        {
+            WakeSocketHandler();
+        }
     }
 
     template <typename... Args>
@@ -676,9 +704,20 @@ private:
     void ThreadOpenAddedConnections();
     void ProcessOneShot();
     void ThreadOpenConnections();
-    void ThreadMessageHandler();
+    //! Handles the messages of the nodes whose id modulo the number of message handlers is nThread
+    void ThreadMessageHandler(int nThread);
     void AcceptConnection(const ListenSocket &hListenSocket);
+    //! Whether the socket handler can wait for hSocket
+    bool IsSocketUsable(SOCKET hSocket) const;
+    void DisconnectNodes();
+    //! Read once from the socket of pnode, returns whether there may be more to read right away
+    bool SocketRecvData(CNode *pnode);
+    void InactivityCheck(CNode *pnode);
     void ThreadSocketHandler();
+#ifdef USE_EPOLL
+    void RegisterSocket(SOCKET hSocket, uint64_t nData, uint32_t nEvents);
+    void ThreadSocketHandlerEpoll();
+#endif
     void ThreadDNSAddressSeed();
 
     uint64_t CalculateKeyedNetGroup(const CAddress &ad) const;
@@ -767,9 +806,30 @@ private:
     /** SipHasher seeds for deterministic randomness */
     const uint64_t nSeed0, nSeed1;
 
+    /** Lets a message handler thread sleep until there is work for it */
+    struct MessageHandlerSignal
+    {
+        std::mutex mutex;
+        std::condition_variable cond;
+        bool fWake;
+
+        MessageHandlerSignal() : fWake(false) {}
+    };
+    int nMessageHandlerThreads;
+    std::vector<std::unique_ptr<MessageHandlerSignal> > vMessageHandlerSignals;
+
     std::atomic<bool> interruptNet;
     thread_group netThreads;
 
+#ifdef USE_EPOLL
+    //! The epoll instance the socket handler waits on, -1 if it falls back to select()
+    int hEpoll;
+    //! eventfd WakeSocketHandler() writes to
+    int hWakeup;
+    //! Whether hWakeup was written to and not drained yet
+    std::atomic<bool> fWakeupPending;
+#endif
+
 public:
     CNetTagStore *tagstore;
     CPubKey pub_routing_id;
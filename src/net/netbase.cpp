@@ -33,6 +33,10 @@
 #include <fcntl.h>
 #endif
 
+#ifdef USE_EPOLL
+#include <poll.h>
+#endif
+
 #include <boost/algorithm/string/case_conv.hpp> // for to_lower()
 #include <boost/algorithm/string/predicate.hpp> // for startswith() and endswith()
 
@@ -207,6 +211,33 @@ struct timeval MillisToTimeval(int64_t nTimeout)
     return timeout;
 }
 
+/**
+ * Wait until hSocket is readable, or writable if fWrite, for at most nTimeout
+ * milliseconds. Returns like select(): positive once the socket is ready, 0 on
+ * timeout and SOCKET_ERROR on failure.
+ */
+static int WaitForSocket(SOCKET hSocket, bool fWrite, int64_t nTimeout)
+{
+#ifdef USE_EPOLL
+    // With epoll the socket handler accepts sockets beyond FD_SETSIZE, which select() cannot wait for
+    struct pollfd pollSocket;
+    pollSocket.fd = hSocket;
+    pollSocket.events = fWrite ? POLLOUT : POLLIN;
+    pollSocket.revents = 0;
+    return poll(&pollSocket, 1, nTimeout);
+#else
+    if (!IsSelectableSocket(hSocket))
+    {
+        return SOCKET_ERROR;
+    }
+    struct timeval timeout = MillisToTimeval(nTimeout);
+    fd_set fdset;
+    FD_ZERO(&fdset);
+    FD_SET(hSocket, &fdset);
+    return select(hSocket + 1, fWrite ? nullptr : &fdset, fWrite ? &fdset : nullptr, nullptr, &timeout);
+#endif
+}
+
 /** SOCKS version */
 enum SOCKSVersion : uint8_t
 {
@@ -291,15 +322,7 @@ static bool InterruptibleRecv(uint8_t *data, size_t len, int timeout, SOCKET &hS
             int nErr = WSAGetLastError();
             if (nErr == WSAEINPROGRESS || nErr == WSAEWOULDBLOCK || nErr == WSAEINVAL)
             {
-                if (!IsSelectableSocket(hSocket))
-                {
-                    return false;
-                }
-                struct timeval tval = MillisToTimeval(std::min(endTime - curTime, maxWait));
-                fd_set fdset;
-                FD_ZERO(&fdset);
-                FD_SET(hSocket, &fdset);
-                int nRet = select(hSocket + 1, &fdset, nullptr, nullptr, &tval);
+                int nRet = WaitForSocket(hSocket, false, std::min(endTime - curTime, maxWait));
                 if (nRet == SOCKET_ERROR)
                 {
                     return false;
@@ -550,11 +573,7 @@ static bool ConnectSocketDirectly(const CService &addrConnect, SOCKET &hSocketRe
         // WSAEINVAL is here because some legacy version of winsock uses it
         if (nErr == WSAEINPROGRESS || nErr == WSAEWOULDBLOCK || nErr == WSAEINVAL)
         {
-            struct timeval timeout = MillisToTimeval(nTimeout);
-            fd_set fdset;
-            FD_ZERO(&fdset);
-            FD_SET(hSocket, &fdset);
-            int nRet = select(hSocket + 1, nullptr, &fdset, nullptr, &timeout);
+            int nRet = WaitForSocket(hSocket, true, nTimeout);
             if (nRet == 0)
             {
                 LogPrintf("connection to %s timeout\n", addrConnect.ToString());
@@ -564,7 +583,7 @@ static bool ConnectSocketDirectly(const CService &addrConnect, SOCKET &hSocketRe
             if (nRet == SOCKET_ERROR)
             {
                 LogPrintf(
-                    "select() for %s failed: %s\n", addrConnect.ToString(), NetworkErrorString(WSAGetLastError()));
+                    "waiting for connection to %s failed: %s\n", addrConnect.ToString(), NetworkErrorString(WSAGetLastError()));
                 CloseSocket(hSocket);
                 return false;
             }
@@ -583,7 +602,7 @@ static bool ConnectSocketDirectly(const CService &addrConnect, SOCKET &hSocketRe
             if (nRet != 0)
             {
                 LogPrintf(
-                    "connect() to %s failed after select(): %s\n", addrConnect.ToString(), NetworkErrorString(nRet));
+                    "connect() to %s failed after waiting: %s\n", addrConnect.ToString(), NetworkErrorString(nRet));
                 CloseSocket(hSocket);
                 return false;
             }
@@ -133,9 +133,13 @@ public:
     CNodeStateAccessor(CNodesStateManager &ns, const NodeId id)
     {
         cs = &ns.cs;
+        {
+            // Message handler threads look up their peers' states while others are added and removed
+            LOCK(ns.cs);
+            obj = ns._GetNodeState(id);
+        }
         EnterCritical("CNodeStateAccessor.cs", __FILE__, __LINE__, (void *)(&cs), LockType::RECURSIVE_MUTEX,
             OwnershipType::EXCLUSIVE);
-        obj = ns._GetNodeState(id);
     }
 
     CNodeState *operator->() { return obj; }
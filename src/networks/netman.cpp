@@ -54,6 +54,9 @@ void CNetworkManager::ConstructLegacyNetworkTemplate()
     legacyTemplate->consensus.nTargetSpacing = 45;
     legacyTemplate->consensus.fPowAllowMinDifficultyBlocks = false;
     legacyTemplate->consensus.fPowNoRetargeting = false;
+    // The last checkpoint, 1493040
+    legacyTemplate->consensus.defaultAssumeValid =
+        uint256S("0xcd266ca5eaca1f561d3adf5ab0bc4994ea26418dd12d9072d5c5194639c40ac2");
     legacyTemplate->consensus.nRuleChangeActivationThreshold = 1916; // 95% of 2016
     legacyTemplate->consensus.nMinerConfirmationWindow = 2016; // nPowTargetTimespan / nTargetSpacing
     legacyTemplate->consensus.vDeployments[Consensus::DEPLOYMENT_TESTDUMMY].bit = 28;
@@ -189,6 +192,7 @@ void CNetworkManager::ConstructTetnet0Template()
     testnet0Template->consensus.nTargetSpacing = 45;
     testnet0Template->consensus.fPowAllowMinDifficultyBlocks = true;
     testnet0Template->consensus.fPowNoRetargeting = true;
+    testnet0Template->consensus.defaultAssumeValid = uint256();
     testnet0Template->consensus.nRuleChangeActivationThreshold = 1916; // 95% of 2016
     testnet0Template->consensus.nMinerConfirmationWindow = 2016; // nPowTargetTimespan / nTargetSpacing
     testnet0Template->consensus.vDeployments[Consensus::DEPLOYMENT_TESTDUMMY].bit = 28;
@@ -267,6 +271,7 @@ void CNetworkManager::ConstructRegTestTemplate()
     regTestTemplate->consensus.nTargetSpacing = 45;
     regTestTemplate->consensus.fPowAllowMinDifficultyBlocks = true;
     regTestTemplate->consensus.fPowNoRetargeting = true;
+    regTestTemplate->consensus.defaultAssumeValid = uint256();
     regTestTemplate->consensus.nRuleChangeActivationThreshold = 1916; // 95% of 2016
     regTestTemplate->consensus.nMinerConfirmationWindow = 2016; // nPowTargetTimespan / nTargetSpacing
     regTestTemplate->consensus.vDeployments[Consensus::DEPLOYMENT_TESTDUMMY].bit = 28;
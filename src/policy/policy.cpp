@@ -140,7 +140,7 @@ bool AreInputsStandard(const CTransaction &tx, const CCoinsViewCache &mapInputs)
     for (unsigned int i = 0; i < tx.vin.size(); i++)
     {
         CoinAccessor coin(mapInputs, tx.vin[i].prevout);
-        const CTxOut &prev = coin->out;
+        const CTxOut prev = coin->out.GetTxOut();
         std::vector<std::vector<unsigned char> > vSolutions;
         txnouttype whichType;
         // get the scriptPubKey corresponding to this input:
@@ -6,11 +6,14 @@
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
 #include <atomic>
+#include <deque>
 #include <boost/algorithm/string/join.hpp>
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/foreach.hpp>
 #include <boost/math/distributions/poisson.hpp>
 #include <boost/range/adaptor/reversed.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/mutex.hpp>
 
 #include <sstream>
 
@@ -29,6 +32,7 @@
 #include "networks/netman.h"
 #include "networks/networktemplate.h"
 #include "policy/policy.h"
+#include "pow.h"
 #include "processblock.h"
 #include "processheader.h"
 #include "txmempool.h"
@@ -36,6 +40,7 @@
 #include "undo.h"
 #include "util/util.h"
 #include "validationinterface.h"
+#include "validationstats.h"
 
 
 bool fLargeWorkForkFound = false;
@@ -64,9 +69,14 @@ void UpdateTip(CBlockIndex *pindexNew)
     cvBlockChange.notify_all();
 }
 
-/** Disconnect chainActive's tip. You probably want to call mempool.removeForReorg and manually re-limit mempool size
- * after this, with cs_main held. */
-bool DisconnectTip(CValidationState &state, const Consensus::Params &consensusParams)
+/**
+ * Disconnect chainActive's tip into view, which is left for the caller to flush. The disconnected block is
+ * appended to vDisconnected, its transactions are not put back into the mempool yet.
+ */
+static bool DisconnectTip(CValidationState &state,
+    const Consensus::Params &consensusParams,
+    CCoinsViewCache &view,
+    std::vector<std::shared_ptr<const CBlock> > &vDisconnected)
 {
     CBlockIndex *pindexDelete = pnetMan->getChainActive()->chainActive.Tip();
     assert(pindexDelete);
@@ -79,65 +89,96 @@ bool DisconnectTip(CValidationState &state, const Consensus::Params &consensusPa
     }
     // Apply the block atomically to the chain state.
     {
-        CCoinsViewCache view(pcoinsTip.get());
-        if (DisconnectBlock(block, pindexDelete, view) != DISCONNECT_OK)
+        CCoinsViewCache viewBlock(&view);
+        if (DisconnectBlock(block, pindexDelete, viewBlock) != DISCONNECT_OK)
         {
             return error("DisconnectTip(): DisconnectBlock %s failed", pindexDelete->GetBlockHash().ToString());
         }
-        assert(view.Flush());
+        assert(viewBlock.Flush());
     }
-    // Write the chain state to disk, if necessary.
-    if (!FlushStateToDisk(state, FLUSH_STATE_IF_NEEDED))
-        return false;
-    // Resurrect mempool transactions from the disconnected block.
+    // Update chainActive and related variables.
+    UpdateTip(pindexDelete->pprev);
+    // Let wallets know transactions went from 1-confirmed to
+    // 0-confirmed or conflicted:
+    for (const auto &ptx : block.vtx)
+    {
+        SyncWithWallets(ptx, nullptr, -1);
+    }
+    vDisconnected.push_back(pblock);
+    return true;
+}
+
+/**
+ * Resurrect mempool transactions from the disconnected blocks, in the order they were mined. Call this once
+ * pcoinsTip holds the state of the new tip.
+ */
+static void ResurrectMempoolTransactions(const std::vector<std::shared_ptr<const CBlock> > &vDisconnected)
+{
     std::vector<uint256> vHashUpdate;
-    for (auto const &ptx : block.vtx)
+    // The block disconnected last is the oldest one
+    for (const std::shared_ptr<const CBlock> &pblock : boost::adaptors::reverse(vDisconnected))
     {
-        const CTransaction &tx = *ptx;
-        // ignore validation errors in resurrected transactions
-        std::list<CTransactionRef> removed;
-        CValidationState stateDummy;
-        if (tx.IsCoinBase() || tx.IsCoinStake() || !AcceptToMemoryPool(mempool, stateDummy, ptx, false, NULL, true))
-        {
-            mempool.remove(tx, removed, true);
-        }
-        else if (mempool.exists(tx.GetHash()))
+        for (auto const &ptx : pblock->vtx)
         {
-            vHashUpdate.push_back(tx.GetHash());
+            const CTransaction &tx = *ptx;
+            // ignore validation errors in resurrected transactions
+            std::list<CTransactionRef> removed;
+            CValidationState stateDummy;
+            if (tx.IsCoinBase() || tx.IsCoinStake() || !AcceptToMemoryPool(mempool, stateDummy, ptx, false, NULL, true))
+            {
+                mempool.remove(tx, removed, true);
+            }
+            else if (mempool.exists(tx.GetHash()))
+            {
+                vHashUpdate.push_back(tx.GetHash());
+            }
         }
     }
     // AcceptToMemoryPool/addUnchecked all assume that new mempool entries have
     // no in-mempool children, which is generally not true when adding
     // previously-confirmed transactions back to the mempool.
-    // UpdateTransactionsFromBlock finds descendants of any transactions in this
-    // block that were added back and cleans up the mempool state.
+    // UpdateTransactionsFromBlock finds descendants of any transactions in these
+    // blocks that were added back and cleans up the mempool state.
     mempool.UpdateTransactionsFromBlock(vHashUpdate);
-    // Update chainActive and related variables.
-    UpdateTip(pindexDelete->pprev);
-    // Let wallets know transactions went from 1-confirmed to
-    // 0-confirmed or conflicted:
-    for (const auto &ptx : block.vtx)
+}
+
+bool DisconnectTip(CValidationState &state, const Consensus::Params &consensusParams)
+{
+    std::vector<std::shared_ptr<const CBlock> > vDisconnected;
     {
-        SyncWithWallets(ptx, nullptr, -1);
+        CCoinsViewCache view(pcoinsTip.get());
+        if (!DisconnectTip(state, consensusParams, view, vDisconnected))
+            return false;
+        assert(view.Flush());
     }
+    // Write the chain state to disk, if necessary.
+    if (!FlushStateToDisk(state, FLUSH_STATE_IF_NEEDED))
+        return false;
+    ResurrectMempoolTransactions(vDisconnected);
     return true;
 }
 
 /**
  * Connect a new block to chainActive. pblock is either NULL or a pointer to a CBlock
- * corresponding to pindexNew, to bypass loading it again from disk.
+ * corresponding to pindexNew, to bypass loading it again from disk. The block is connected
+ * into viewChain, which is left for the caller to flush. The time each stage takes is added to timing.
  */
-bool ConnectTip(CValidationState &state,
+static bool ConnectTip(CValidationState &state,
     const CNetworkTemplate &chainparams,
     CBlockIndex *pindexNew,
-    const CBlock *pblock)
+    const CBlock *pblock,
+    CCoinsViewCache &viewChain,
+    CBlockValidationTiming &timing)
 {
     AssertLockHeld(cs_main);
     assert(pindexNew->pprev == pnetMan->getChainActive()->chainActive.Tip());
+    timing.hashBlock = pindexNew->GetBlockHash();
+    timing.nHeight = pindexNew->nHeight;
     // Read block from disk.
     CBlock block;
     if (!pblock)
     {
+        CValidationStageTimer timer(&timing, STAGE_READ);
         if (!ReadBlockFromDisk(block, pindexNew, chainparams.GetConsensus()))
         {
             return AbortNode(state, "Failed to read block");
@@ -147,8 +188,8 @@ bool ConnectTip(CValidationState &state,
 
     // Apply the block atomically to the chain state.
     {
-        CCoinsViewCache view(pcoinsTip.get());
-        bool rv = ConnectBlock(*pblock, state, pindexNew, view);
+        CCoinsViewCache view(&viewChain);
+        bool rv = ConnectBlock(*pblock, state, pindexNew, view, false, &timing);
         if (!rv)
         {
             if (state.IsInvalid())
@@ -157,18 +198,20 @@ bool ConnectTip(CValidationState &state,
             }
             return error("ConnectTip(): ConnectBlock %s failed", pindexNew->GetBlockHash().ToString().c_str());
         }
+        CValidationStageTimer timer(&timing, STAGE_FLUSH);
         assert(view.Flush());
     }
-    // Write the chain state to disk, if necessary.
-    if (!FlushStateToDisk(state, FLUSH_STATE_IF_NEEDED))
-        return false;
     // Remove conflicting transactions from the mempool.
     std::list<CTransactionRef> txConflicted;
-    mempool.removeForBlock(
-        pblock->vtx, pindexNew->nHeight, txConflicted, !pnetMan->getChainActive()->IsInitialBlockDownload());
+    {
+        CValidationStageTimer timer(&timing, STAGE_MEMPOOL);
+        mempool.removeForBlock(
+            pblock->vtx, pindexNew->nHeight, txConflicted, !pnetMan->getChainActive()->IsInitialBlockDownload());
+    }
     // Update chainActive & related variables.
     UpdateTip(pindexNew);
 
+    CValidationStageTimer timer(&timing, STAGE_SIGNALS);
     // Tell wallet about transactions that went from mempool
     // to conflicted:
     for (const auto &ptx : txConflicted)
@@ -298,88 +341,132 @@ bool ActivateBestChainStep(CValidationState &state,
     const CBlockIndex *pindexOldTip = pnetMan->getChainActive()->chainActive.Tip();
     const CBlockIndex *pindexFork = pnetMan->getChainActive()->chainActive.FindFork(pindexMostWork);
 
-    // Disconnect active blocks which are no longer in the best chain.
-    bool fBlocksDisconnected = false;
-    while (pnetMan->getChainActive()->chainActive.Tip() && pnetMan->getChainActive()->chainActive.Tip() != pindexFork)
+    // Disconnect and connect the whole chain segment on one layer over pcoinsTip, so that a reorg
+    // writes the coins it touches to pcoinsTip once instead of once per block.
+    std::vector<std::shared_ptr<const CBlock> > vDisconnected;
+    std::vector<CBlockIndex *> vpindexConnected;
+    //! Where the time connecting each block of vpindexConnected went
+    std::vector<CBlockValidationTiming> vTimings;
+    std::vector<CBlockIndex *> vpindexToConnect;
+    bool fAbort = false;
     {
-        if (!DisconnectTip(state, chainparams.GetConsensus()))
-            return false;
-        fBlocksDisconnected = true;
-    }
+        CCoinsViewCache viewReorg(pcoinsTip.get());
 
-    // Build list of new blocks to connect.
-    std::vector<CBlockIndex *> vpindexToConnect;
-    bool fContinue = true;
-    int nHeight = pindexFork ? pindexFork->nHeight : -1;
-    bool fBlock = true;
-    while (fContinue && nHeight < pindexMostWork->nHeight)
-    {
-        // Don't iterate the entire list of potential improvements toward the best tip, as we likely only need
-        // a few blocks along the way.
-        int nTargetHeight = std::min(nHeight + 32, pindexMostWork->nHeight);
-        vpindexToConnect.clear();
-        vpindexToConnect.reserve(nTargetHeight - nHeight);
-        CBlockIndex *pindexIter = pindexMostWork->GetAncestor(nTargetHeight);
-        while (pindexIter && pindexIter->nHeight != nHeight)
+        // Disconnect active blocks which are no longer in the best chain.
+        while (pnetMan->getChainActive()->chainActive.Tip() &&
+               pnetMan->getChainActive()->chainActive.Tip() != pindexFork)
         {
-            vpindexToConnect.push_back(pindexIter);
-            pindexIter = pindexIter->pprev;
+            if (!DisconnectTip(state, chainparams.GetConsensus(), viewReorg, vDisconnected))
+            {
+                fAbort = true;
+                break;
+            }
         }
-        nHeight = nTargetHeight;
 
-        // Connect new blocks.
-        CBlockIndex *pindexNewTip = nullptr;
-        for (auto i = vpindexToConnect.rbegin(); i != vpindexToConnect.rend(); i++)
+        // Build list of new blocks to connect.
+        bool fContinue = !fAbort;
+        int nHeight = pindexFork ? pindexFork->nHeight : -1;
+        bool fBlock = true;
+        while (fContinue && nHeight < pindexMostWork->nHeight)
         {
-            CBlockIndex *pindexConnect = *i;
-            if (!ConnectTip(
-                    state, chainparams, pindexConnect, pindexConnect == pindexMostWork && fBlock ? pblock : nullptr))
+            // Don't iterate the entire list of potential improvements toward the best tip, as we likely only need
+            // a few blocks along the way.
+            int nTargetHeight = std::min(nHeight + 32, pindexMostWork->nHeight);
+            vpindexToConnect.clear();
+            vpindexToConnect.reserve(nTargetHeight - nHeight);
+            CBlockIndex *pindexIter = pindexMostWork->GetAncestor(nTargetHeight);
+            while (pindexIter && pindexIter->nHeight != nHeight)
             {
-                if (state.IsInvalid())
+                vpindexToConnect.push_back(pindexIter);
+                pindexIter = pindexIter->pprev;
+            }
+            nHeight = nTargetHeight;
+
+            // Connect new blocks.
+            for (auto i = vpindexToConnect.rbegin(); i != vpindexToConnect.rend(); i++)
+            {
+                CBlockIndex *pindexConnect = *i;
+                CBlockValidationTiming timing;
+                if (!ConnectTip(state, chainparams, pindexConnect,
+                        pindexConnect == pindexMostWork && fBlock ? pblock : nullptr, viewReorg, timing))
                 {
-                    // The block violates a consensus rule.
-                    if (!state.CorruptionPossible())
-                        InvalidChainFound(vpindexToConnect.back());
-                    fInvalidFound = true;
-                    fContinue = false;
-                    break;
+                    if (state.IsInvalid())
+                    {
+                        // The block violates a consensus rule.
+                        if (!state.CorruptionPossible())
+                            InvalidChainFound(vpindexToConnect.back());
+                        fInvalidFound = true;
+                        fContinue = false;
+                        break;
+                    }
+                    else
+                    {
+                        // A system error occurred (disk space, database error, ...).
+                        fAbort = true;
+                        fContinue = false;
+                        break;
+                    }
                 }
                 else
                 {
-                    // A system error occurred (disk space, database error, ...).
-                    return false;
+                    vpindexConnected.push_back(pindexConnect);
+                    vTimings.push_back(timing);
+                    PruneBlockIndexCandidates();
+                    if (!pindexOldTip ||
+                        pnetMan->getChainActive()->chainActive.Tip()->nChainWork > pindexOldTip->nChainWork)
+                    {
+                        // We're in a better position than we were. Return temporarily to release the lock.
+                        fContinue = false;
+                        break;
+                    }
                 }
             }
-            else
-            {
-                pindexNewTip = pindexConnect;
-                if (!pnetMan->getChainActive()->IsInitialBlockDownload())
-                {
-                    // Notify external zmq listeners about the new tip.
-                    GetMainSignals().UpdatedBlockTip(pindexConnect);
-                }
-                BlockNotifyCallback(pnetMan->getChainActive()->IsInitialBlockDownload(), pindexNewTip);
+            if (fInvalidFound || fAbort)
+                break; // stop processing more blocks if the last one was invalid.
 
-                PruneBlockIndexCandidates();
-                if (!pindexOldTip ||
-                    pnetMan->getChainActive()->chainActive.Tip()->nChainWork > pindexOldTip->nChainWork)
+            if (fContinue)
+            {
+                pindexMostWork = FindMostWorkChain();
+                if (!pindexMostWork)
                 {
-                    // We're in a better position than we were. Return temporarily to release the lock.
-                    fContinue = false;
+                    fAbort = true;
                     break;
                 }
             }
+            fBlock = false; // read next blocks from disk
         }
-        if (fInvalidFound)
-            break; // stop processing more blocks if the last one was invalid.
 
-        if (fContinue)
+        // viewReorg is at chainActive's tip whenever we get here, whether the segment was finished or not
+        CValidationStageTimer timer(vTimings.empty() ? nullptr : &vTimings.back(), STAGE_FLUSH);
+        assert(viewReorg.Flush());
+    }
+    // The work done once for the whole segment is counted towards its last block
+    CBlockValidationTiming *ptimingLast = vTimings.empty() ? nullptr : &vTimings.back();
+    {
+        // Write the chain state to disk, if necessary.
+        CValidationStageTimer timer(ptimingLast, STAGE_FLUSH);
+        if (!FlushStateToDisk(state, FLUSH_STATE_IF_NEEDED))
+            return false;
+    }
+    const bool fBlocksDisconnected = !vDisconnected.empty();
+    {
+        CValidationStageTimer timer(ptimingLast, STAGE_MEMPOOL);
+        ResurrectMempoolTransactions(vDisconnected);
+    }
+    if (fAbort)
+        return false;
+
+    // Notify about the new tips only now that pcoinsTip has caught up with them
+    for (size_t i = 0; i < vpindexConnected.size(); i++)
+    {
+        CBlockIndex *pindexConnected = vpindexConnected[i];
+        CValidationStageTimer timer(&vTimings[i], STAGE_SIGNALS);
+        if (!pnetMan->getChainActive()->IsInitialBlockDownload())
         {
-            pindexMostWork = FindMostWorkChain();
-            if (!pindexMostWork)
-                return false;
+            // Notify external zmq listeners about the new tip.
+            GetMainSignals().UpdatedBlockTip(pindexConnected);
         }
-        fBlock = false; // read next blocks from disk
+        BlockNotifyCallback(pnetMan->getChainActive()->IsInitialBlockDownload(), pindexConnected);
     }
 
     // Relay Inventory
@@ -419,12 +506,15 @@ bool ActivateBestChainStep(CValidationState &state,
 
     if (fBlocksDisconnected)
     {
+        CValidationStageTimer timer(ptimingLast, STAGE_MEMPOOL);
         mempool.removeForReorg(
             pcoinsTip.get(), pnetMan->getChainActive()->chainActive.Tip()->nHeight + 1, STANDARD_LOCKTIME_VERIFY_FLAGS);
         LimitMempoolSize(mempool, gArgs.GetArg("-maxmempool", DEFAULT_MAX_MEMPOOL_SIZE) * 1000000,
             gArgs.GetArg("-mempoolexpiry", DEFAULT_MEMPOOL_EXPIRY) * 60 * 60);
     }
     mempool.check(pcoinsTip.get());
+    for (const CBlockValidationTiming &timing : vTimings)
+        validationStats.Add(timing);
     // Callbacks/notifications for a new best chain.
     if (fInvalidFound)
     {
@@ -880,7 +970,8 @@ bool ConnectBlock(const CBlock &block,
     CValidationState &state,
     CBlockIndex *pindex,
     CCoinsViewCache &view,
-    bool fJustCheck)
+    bool fJustCheck,
+    CBlockValidationTiming *ptiming)
 {
     const CNetworkTemplate &chainparams = pnetMan->getActivePaymentNetwork();
     AssertLockHeld(cs_main);
@@ -894,9 +985,21 @@ bool ConnectBlock(const CBlock &block,
         pindex->updateForPos(block);
     }
 
-    // Check it again in case a previous version let a bad block in
-    if (!CheckBlock(block, state, !fJustCheck, !fJustCheck))
-        return false;
+    {
+        CValidationStageTimer timer(ptiming, STAGE_CHECKBLOCK);
+        if (!fJustCheck && (pindex->nStatus & BLOCK_CHECKED))
+        {
+            // AcceptBlock checked this block before storing it. Only make sure the copy read back from disk
+            // still has the transactions the header commits to.
+            bool mutated;
+            if (block.hashMerkleRoot != BlockMerkleRoot(block, &mutated) || mutated)
+                return state.DoS(100, error("%s: hashMerkleRoot mismatch on stored block", __func__),
+                    REJECT_INVALID, "bad-txnmrklroot", true);
+        }
+        // Check it again in case a previous version let a bad block in
+        else if (!CheckBlock(block, state, !fJustCheck, !fJustCheck))
+            return false;
+    }
 
     // verify that the view's current state corresponds to the previous block
     uint256 hashPrevBlock = pindex->pprev == nullptr ? uint256() : pindex->pprev->GetBlockHash();
@@ -921,6 +1024,21 @@ bool ConnectBlock(const CBlock &block,
             fScriptChecks = false;
         }
     }
+    if (fScriptChecks && !hashAssumeValid.IsNull())
+    {
+        // The scripts of an ancestor of the assumed valid block are only skipped while that block and the best
+        // header are on one chain, and the best header buries this block under two weeks worth of work. Amounts,
+        // coins and everything else are still checked.
+        CBlockIndex *pindexAssumeValid = pnetMan->getChainActive()->LookupBlockIndex(hashAssumeValid);
+        CBlockIndex *pindexBest = pnetMan->getChainActive()->pindexBestHeader;
+        if (pindexAssumeValid && pindexBest && pindexAssumeValid->GetAncestor(pindex->nHeight) == pindex &&
+            pindexBest->GetAncestor(pindex->nHeight) == pindex &&
+            pindexBest->GetAncestor(pindexAssumeValid->nHeight) == pindexAssumeValid)
+        {
+            fScriptChecks = GetBlockProofEquivalentTime(*pindexBest, *pindex, *pindexBest,
+                                chainparams.GetConsensus()) <= 60 * 60 * 24 * 7 * 2;
+        }
+    }
 
     for (auto const &tx : block.vtx)
     {
@@ -934,12 +1052,23 @@ bool ConnectBlock(const CBlock &block,
         }
     }
 
-    unsigned int flags = SCRIPT_VERIFY_P2SH;
-    flags |= SCRIPT_VERIFY_DERSIG;
-    flags |= SCRIPT_VERIFY_CHECKLOCKTIMEVERIFY;
-    int nLockTimeFlags = 0;
-    flags |= SCRIPT_VERIFY_CHECKSEQUENCEVERIFY;
-    nLockTimeFlags |= LOCKTIME_VERIFY_SEQUENCE;
+    // Fetch the coins spent by this block in one batch instead of doing a
+    // separate database lookup for every input while connecting it
+    {
+        std::vector<COutPoint> vPrevouts;
+        for (auto const &tx : block.vtx)
+        {
+            if (tx->IsCoinBase())
+                continue;
+            for (const CTxIn &txin : tx->vin)
+                vPrevouts.push_back(txin.prevout);
+        }
+        std::vector<Coin> vCoins;
+        view.GetCoins(vPrevouts, vCoins);
+    }
+
+    unsigned int flags = BLOCK_SCRIPT_VERIFY_FLAGS;
+    int nLockTimeFlags = LOCKTIME_VERIFY_SEQUENCE;
 
     CBlockUndo blockundo;
 
@@ -963,6 +1092,9 @@ bool ConnectBlock(const CBlock &block,
         // PoW block
         blockundo.vtxundo.reserve(block.vtx.size() - 1);
     }
+    // The loop counts as fetching inputs, except for the time CheckInputs takes
+    const int64_t nTimeInputsStart = GetTimeMicros();
+    int64_t nTimeScripts = 0;
     for (unsigned int i = 0; i < block.vtx.size(); i++)
     {
         const CTransaction &tx = *(block.vtx[i]);
@@ -1022,11 +1154,13 @@ bool ConnectBlock(const CBlock &block,
             std::vector<CScriptCheck> vChecks;
             bool fCacheResults = fJustCheck; /* Don't cache results if we're actually connecting blocks (still consult
                                                 the cache, though) */
-            if (!CheckInputs(
-                    tx, state, view, fScriptChecks, flags, fCacheResults, nScriptCheckThreads ? &vChecks : NULL))
+            const int64_t nTimeCheckStart = GetTimeMicros();
+            if (!CheckInputs(tx, state, view, fScriptChecks, flags, fCacheResults, fCacheResults,
+                    nScriptCheckThreads ? &vChecks : NULL))
                 return error("ConnectBlock(): CheckInputs on %s failed with %s", tx.GetHash().ToString(),
                     FormatStateMessage(state));
             control.Add(vChecks);
+            nTimeScripts += GetTimeMicros() - nTimeCheckStart;
         }
 
         CTxUndo undoDummy;
@@ -1038,6 +1172,11 @@ bool ConnectBlock(const CBlock &block,
         vPos.push_back(std::make_pair(tx.GetHash(), pos));
         pos.nTxOffset += ::GetSerializeSize(tx, SER_DISK, CLIENT_VERSION);
     }
+    if (ptiming)
+    {
+        ptiming->nStageTime[STAGE_INPUTS] += GetTimeMicros() - nTimeInputsStart - nTimeScripts;
+        ptiming->nStageTime[STAGE_SCRIPTS] += nTimeScripts;
+    }
 
     CAmount blockReward = 0;
 
@@ -1081,9 +1220,13 @@ bool ConnectBlock(const CBlock &block,
             return state.DoS(100, error("ConnectBlock(): coinstake pays too much"), REJECT_INVALID, "bad-cb-amount");
         }
     }
-    if (!control.Wait())
     {
-        return state.DoS(100, error("%s: CheckQueue failed", __func__), REJECT_INVALID, "block-validation-failed");
+        CValidationStageTimer timer(ptiming, STAGE_SCRIPTS);
+        if (!control.Wait())
+        {
+            return state.DoS(
+                100, error("%s: CheckQueue failed", __func__), REJECT_INVALID, "block-validation-failed");
+        }
     }
 
     {
@@ -1143,6 +1286,7 @@ bool ConnectBlock(const CBlock &block,
         return true;
 
     // Write undo information to disk
+    CValidationStageTimer timerUndo(ptiming, STAGE_UNDO);
     if (pindex->GetUndoPos().IsNull() || !pindex->IsValid(BLOCK_VALID_SCRIPTS))
     {
         if (pindex->GetUndoPos().IsNull())
@@ -1168,6 +1312,9 @@ bool ConnectBlock(const CBlock &block,
         return AbortNode(state, "Failed to write transaction index");
     }
 
+    // Keep the undo data at hand in case the block is disconnected again soon
+    undoCache.Add(pindex->GetBlockHash(), std::move(blockundo));
+
     // add this block to the view's block chain
     view.SetBestBlock(pindex->GetBlockHash());
     return true;
@@ -1217,13 +1364,14 @@ DisconnectResult DisconnectBlock(const CBlock &block, const CBlockIndex *pindex,
     bool fClean = true;
 
     CBlockUndo blockUndo;
-    CDiskBlockPos pos = pindex->GetUndoPos();
-    if (pos.IsNull())
-    {
-        error("DisconnectBlock(): no undo data available");
-        return DISCONNECT_FAILED;
-    }
+    if (!undoCache.Get(pindex->GetBlockHash(), blockUndo))
     {
+        CDiskBlockPos pos = pindex->GetUndoPos();
+        if (pos.IsNull())
+        {
+            error("DisconnectBlock(): no undo data available");
+            return DISCONNECT_FAILED;
+        }
         if (!UndoReadFromDisk(blockUndo, pos, pindex->pprev->GetBlockHash()))
         {
             error("DisconnectBlock(): failure reading undo data");
@@ -1276,7 +1424,7 @@ DisconnectResult DisconnectBlock(const CBlock &block, const CBlockIndex *pindex,
                 COutPoint out(hash, o);
                 Coin coin;
                 bool is_spent = view.SpendCoin(out, &coin);
-                if (!is_spent || tx.vout[o] != coin.out)
+                if (!is_spent || tx.vout[o] != coin.out.GetTxOut())
                 {
                     error("DisconnectBlock(): transaction output mismatch");
                     error("%s != %s", tx.vout[o].ToString().c_str(), coin.out.ToString().c_str());
@@ -1372,6 +1520,8 @@ bool AcceptBlock(const CBlock *pblock,
             if (!WriteBlockToDisk(*pblock, blockPos, chainparams.MessageStart()))
                 AbortNode(state, "Failed to write block");
         }
+        // CheckBlock passed above, ConnectBlock does not need to run it again on the stored copy
+        pindex->nStatus |= BLOCK_CHECKED;
         if (!ReceivedBlockTransactions(*pblock, state, pindex, blockPos))
             return error("AcceptBlock(): ReceivedBlockTransactions failed");
     }
@@ -1547,3 +1697,68 @@ bool ProcessNewBlock(CValidationState &state,
     }
     return true;
 }
+
+namespace
+{
+/** A block received from a peer, waiting for a block check thread */
+struct CBlockCheckJob
+{
+    std::shared_ptr<const CBlock> pblock;
+    bool fForceProcessing;
+    std::function<void(const CValidationState &)> fnProcessed;
+};
+
+boost::mutex csBlockCheck;
+boost::condition_variable condBlockCheck;
+std::deque<CBlockCheckJob> dequeBlockCheck;
+bool fBlockCheckShutdown = false;
+std::atomic<int> nBlockCheckThreads(0);
+}
+
+void InterruptBlockCheck()
+{
+    boost::unique_lock<boost::mutex> lock(csBlockCheck);
+    fBlockCheckShutdown = true;
+    dequeBlockCheck.clear();
+    condBlockCheck.notify_all();
+}
+
+void ThreadBlockCheck()
+{
+    RenameThread("bitcoin-blockch");
+    nBlockCheckThreads++;
+    while (true)
+    {
+        CBlockCheckJob job;
+        {
+            boost::unique_lock<boost::mutex> lock(csBlockCheck);
+            while (dequeBlockCheck.empty() && !fBlockCheckShutdown)
+                condBlockCheck.wait(lock);
+            if (fBlockCheckShutdown)
+                break;
+            job = std::move(dequeBlockCheck.front());
+            dequeBlockCheck.pop_front();
+        }
+
+        // CheckBlock runs first and without a lock, so blocks from different peers are checked side by side
+        CValidationState state;
+        ProcessNewBlock(state, pnetMan->getActivePaymentNetwork(), nullptr, job.pblock.get(), job.fForceProcessing,
+            nullptr);
+        job.fnProcessed(state);
+    }
+    nBlockCheckThreads--;
+}
+
+bool QueueNewBlock(const std::shared_ptr<const CBlock> &pblock,
+    bool fForceProcessing,
+    const std::function<void(const CValidationState &)> &fnProcessed)
+{
+    if (nBlockCheckThreads.load() == 0)
+        return false;
+    boost::unique_lock<boost::mutex> lock(csBlockCheck);
+    if (fBlockCheckShutdown)
+        return false;
+    dequeBlockCheck.push_back(CBlockCheckJob{pblock, fForceProcessing, fnProcessed});
+    condBlockCheck.notify_one();
+    return true;
+}
@@ -11,6 +11,10 @@
 #include "consensus/params.h"
 #include "consensus/validation.h"
 #include "main.h"
+#include "script/interpreter.h"
+
+#include <functional>
+#include <memory>
 
 class CValidationState;
 class CNode;
@@ -18,6 +22,11 @@ class CBlock;
 class CNetworkTemplate;
 class CDiskBlockPos;
 class CBlockIndex;
+struct CBlockValidationTiming;
+
+/** Script verification flags that ConnectBlock checks the transactions of a block against */
+static const unsigned int BLOCK_SCRIPT_VERIFY_FLAGS =
+    SCRIPT_VERIFY_P2SH | SCRIPT_VERIFY_DERSIG | SCRIPT_VERIFY_CHECKLOCKTIMEVERIFY | SCRIPT_VERIFY_CHECKSEQUENCEVERIFY;
 
 extern bool fLargeWorkForkFound;
 extern bool fLargeWorkInvalidChainFound;
@@ -25,6 +34,8 @@ extern bool fLargeWorkInvalidChainFound;
 CBlockIndex *FindMostWorkChain();
 void CheckBlockIndex(const Consensus::Params &consensusParams);
 
+/** Disconnect chainActive's tip. You probably want to call mempool.removeForReorg and manually re-limit mempool size
+ * after this, with cs_main held. */
 bool DisconnectTip(CValidationState &state, const Consensus::Params &consensusParams);
 void InvalidChainFound(CBlockIndex *pindexNew);
 void InvalidBlockFound(CBlockIndex *pindex, const CValidationState &state);
@@ -33,12 +44,14 @@ void InterruptScriptCheck();
 /** Run an instance of the script checking thread */
 void ThreadScriptCheck();
 
-/** Apply the effects of this block (with given index) on the UTXO set represented by coins */
+/** Apply the effects of this block (with given index) on the UTXO set represented by coins. The time its stages
+ * take is added to ptiming, unless that is nullptr. */
 bool ConnectBlock(const CBlock &block,
     CValidationState &state,
     CBlockIndex *pindex,
     CCoinsViewCache &coins,
-    bool fJustCheck = false);
+    bool fJustCheck = false,
+    CBlockValidationTiming *ptiming = nullptr);
 
 /** Undo the effects of this block (with given index) on the UTXO set represented by coins.
  *  In case pfClean is provided, operation will try to be tolerant about errors, and *pfClean
@@ -74,4 +87,18 @@ bool ProcessNewBlock(CValidationState &state,
     bool fForceProcessing,
     CDiskBlockPos *dbp);
 
+void InterruptBlockCheck();
+/** Run an instance of the thread that processes blocks handed to QueueNewBlock */
+void ThreadBlockCheck();
+
+/**
+ * Hand a block received from a peer to a block check thread, which runs ProcessNewBlock on it and then
+ * fnProcessed with the resulting state. Blocks queued by different peers are checked in parallel; only
+ * storing and connecting them is serialized by cs_main. Returns false when there are no block check
+ * threads, in which case the caller has to process the block itself.
+ */
+bool QueueNewBlock(const std::shared_ptr<const CBlock> &pblock,
+    bool fForceProcessing,
+    const std::function<void(const CValidationState &)> &fnProcessed);
+
 #endif // PROCESSBLOCK_H
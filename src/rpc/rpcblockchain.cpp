@@ -20,9 +20,13 @@
 #include "policy/policy.h"
 #include "processblock.h"
 #include "rpcserver.h"
+#include "script/sigcache.h"
 #include "streams.h"
 #include "sync.h"
+#include "txdb.h"
+#include "validationstats.h"
 #include "txmempool.h"
+#include "txoutsnapshot.h"
 #include "util/util.h"
 #include "util/utilstrencodings.h"
 #include "verifydb.h"
@@ -430,39 +434,24 @@ UniValue getblock(const UniValue &params, bool fHelp)
     return blockToJSON(block, pblockindex);
 }
 
-static void ApplyStats(CCoinsStats &stats,
-    CHashWriter &ss,
-    const uint256 &hash,
-    const std::map<uint32_t, Coin> &outputs)
-{
-    assert(!outputs.empty());
-    ss << hash;
-    ss << VARINT(
-        outputs.begin()->second.nHeight * 2 + outputs.begin()->second.fCoinBase, VarIntMode::NONNEGATIVE_SIGNED);
-    stats.nTransactions++;
-    for (const auto output : outputs)
-    {
-        ss << VARINT(output.first + 1);
-        ss << *(const CScriptBase *)(&output.second.out.scriptPubKey);
-        ss << VARINT(output.second.out.nValue, VarIntMode::NONNEGATIVE_SIGNED);
-        stats.nTransactionOutputs++;
-        stats.nTotalAmount += output.second.out.nValue;
-    }
-    ss << VARINT(0u);
+static void ApplyCommitment(CCoinsStats &stats, const CUTXOCommitment &commitment)
+{
+    stats.nTransactionOutputs = commitment.nTransactionOutputs;
+    stats.nSerializedSize = commitment.nSerializedSize;
+    stats.nTotalAmount = commitment.nTotalAmount;
+    stats.hashSerialized = commitment.GetHash();
 }
 
-//! Calculate statistics about the unspent transaction output set
-static bool GetUTXOStats(CCoinsView *view, CCoinsStats &stats)
+//! Calculate statistics about the unspent transaction output set by walking all of it
+static bool GetUTXOStats(CCoinsView *view, CCoinsStats &stats, CUTXOCommitment &commitment)
 {
     std::unique_ptr<CCoinsViewCursor> pcursor(view->Cursor());
     assert(pcursor);
 
-    CHashWriter ss(SER_GETHASH, PROTOCOL_VERSION);
     stats.hashBlock = pcursor->GetBestBlock();
     stats.nHeight = pnetMan->getChainActive()->LookupBlockIndex(stats.hashBlock)->nHeight;
-    ss << stats.hashBlock;
+    commitment.SetNull();
     uint256 prevkey;
-    std::map<uint32_t, Coin> outputs;
     while (pcursor->Valid())
     {
         if (shutdown_threads.load())
@@ -474,13 +463,11 @@ static bool GetUTXOStats(CCoinsView *view, CCoinsStats &stats)
         Coin coin;
         if (pcursor->GetKey(key) && pcursor->GetValue(coin))
         {
-            if (!outputs.empty() && key.hash != prevkey)
-            {
-                ApplyStats(stats, ss, prevkey, outputs);
-                outputs.clear();
-            }
+            // the outputs of a transaction are stored next to each other
+            if (stats.nTransactions == 0 || key.hash != prevkey)
+                stats.nTransactions++;
             prevkey = key.hash;
-            outputs[key.n] = std::move(coin);
+            commitment.AddCoin(key, coin);
         }
         else
         {
@@ -488,11 +475,7 @@ static bool GetUTXOStats(CCoinsView *view, CCoinsStats &stats)
         }
         pcursor->Next();
     }
-    if (!outputs.empty())
-    {
-        ApplyStats(stats, ss, prevkey, outputs);
-    }
-    stats.hashSerialized = ss.GetHash();
+    ApplyCommitment(stats, commitment);
     stats.nDiskSize = view->EstimateSize();
     return true;
 }
@@ -500,37 +483,184 @@ static bool GetUTXOStats(CCoinsView *view, CCoinsStats &stats)
 
 UniValue gettxoutsetinfo(const UniValue &params, bool fHelp)
 {
-    if (fHelp || params.size() != 0)
-        throw std::runtime_error("gettxoutsetinfo\n"
-                                 "\nReturns statistics about the unspent transaction output set.\n"
-                                 "Note this call may take some time.\n"
-                                 "\nResult:\n"
-                                 "{\n"
-                                 "  \"height\":n,     (numeric) The current block height (index)\n"
-                                 "  \"bestblock\": \"hex\",   (string) the best block hash hex\n"
-                                 "  \"transactions\": n,      (numeric) The number of transactions\n"
-                                 "  \"txouts\": n,            (numeric) The number of output transactions\n"
-                                 "  \"bytes_serialized\": n,  (numeric) The serialized size\n"
-                                 "  \"hash_serialized\": \"hash\",   (string) The serialized hash\n"
-                                 "  \"total_amount\": x.xxx          (numeric) The total amount\n"
-                                 "}\n"
-                                 "\nExamples:\n" +
-                                 HelpExampleCli("gettxoutsetinfo", "") + HelpExampleRpc("gettxoutsetinfo", ""));
+    if (fHelp || params.size() > 1)
+        throw std::runtime_error(
+            "gettxoutsetinfo ( full )\n"
+            "\nReturns statistics about the unspent transaction output set.\n"
+            "The statistics are kept up to date as blocks are connected and disconnected, so by default\n"
+            "this call returns immediately. On a chainstate written by an older version the first call\n"
+            "has to walk the whole set once to initialize them.\n"
+            "\nArguments:\n"
+            "1. full          (boolean, optional, default=false) Walk the whole set instead of using the kept\n"
+            "                 statistics. This also counts the transactions and may take some time.\n"
+            "\nResult:\n"
+            "{\n"
+            "  \"height\":n,     (numeric) The current block height (index)\n"
+            "  \"bestblock\": \"hex\",   (string) the best block hash hex\n"
+            "  \"transactions\": n,      (numeric) The number of transactions, only when the set was walked\n"
+            "  \"txouts\": n,            (numeric) The number of output transactions\n"
+            "  \"bytes_serialized\": n,  (numeric) The serialized size of the outpoints and coins\n"
+            "  \"hash_serialized\": \"hash\",   (string) Order independent hash of the set\n"
+            "  \"disk_size\": n,         (numeric) The estimated size of the chainstate on disk\n"
+            "  \"total_amount\": x.xxx          (numeric) The total amount\n"
+            "}\n"
+            "\nExamples:\n" +
+            HelpExampleCli("gettxoutsetinfo", "") + HelpExampleCli("gettxoutsetinfo", "true") +
+            HelpExampleRpc("gettxoutsetinfo", ""));
+
+    bool fFull = params.size() > 0 && params[0].get_bool();
 
     UniValue ret(UniValue::VOBJ);
 
     CCoinsStats stats;
-    FlushStateToDisk();
-    if (GetUTXOStats(pcoinsdbview.get(), stats))
+    CUTXOCommitment commitment;
+    bool fWalked = false;
     {
-        ret.push_back(Pair("height", (int64_t)stats.nHeight));
-        ret.push_back(Pair("bestblock", stats.hashBlock.GetHex()));
+        LOCK(cs_main);
+        if (!fFull && pcoinsTip->GetCommitment(commitment))
+        {
+            stats.hashBlock = pcoinsTip->GetBestBlock();
+            stats.nHeight = pnetMan->getChainActive()->LookupBlockIndex(stats.hashBlock)->nHeight;
+            ApplyCommitment(stats, commitment);
+            stats.nDiskSize = pcoinsdbview->EstimateSize();
+        }
+        else
+            fWalked = true;
+    }
+    if (fWalked)
+    {
+        FlushStateToDisk();
+        if (!GetUTXOStats(pcoinsdbview.get(), stats, commitment))
+            return ret;
+        // Store what we found, so the next call can answer without walking the set
+        pcoinsdbview->WriteCommitment(commitment, stats.hashBlock);
+    }
+
+    ret.push_back(Pair("height", (int64_t)stats.nHeight));
+    ret.push_back(Pair("bestblock", stats.hashBlock.GetHex()));
+    if (fWalked)
         ret.push_back(Pair("transactions", (int64_t)stats.nTransactions));
-        ret.push_back(Pair("txouts", (int64_t)stats.nTransactionOutputs));
-        ret.push_back(Pair("bytes_serialized", (int64_t)stats.nSerializedSize));
-        ret.push_back(Pair("hash_serialized", stats.hashSerialized.GetHex()));
-        ret.push_back(Pair("total_amount", ValueFromAmount(stats.nTotalAmount)));
+    ret.push_back(Pair("txouts", (int64_t)stats.nTransactionOutputs));
+    ret.push_back(Pair("bytes_serialized", (int64_t)stats.nSerializedSize));
+    ret.push_back(Pair("hash_serialized", stats.hashSerialized.GetHex()));
+    ret.push_back(Pair("disk_size", (int64_t)stats.nDiskSize));
+    ret.push_back(Pair("total_amount", ValueFromAmount(stats.nTotalAmount)));
+    return ret;
+}
+
+UniValue dumptxoutset(const UniValue &params, bool fHelp)
+{
+    if (fHelp || params.size() != 1)
+        throw std::runtime_error(
+            "dumptxoutset \"path\"\n"
+            "\nWrite the unspent transaction output set to a snapshot file, which can be loaded into\n"
+            "another node with loadtxoutset.\n"
+            "\nArguments:\n"
+            "1. \"path\"      (string, required) The file to write, relative to the data directory\n"
+            "\nResult:\n"
+            "{\n"
+            "  \"coins_written\": n,        (numeric) The number of coins in the snapshot\n"
+            "  \"base_hash\": \"hash\",       (string) The best block at the time of the snapshot\n"
+            "  \"base_height\": n,          (numeric) The height of that block\n"
+            "  \"hash_serialized\": \"hash\", (string) The hash of the set, as reported by gettxoutsetinfo\n"
+            "  \"path\": \"path\"             (string) The absolute path of the snapshot file\n"
+            "}\n"
+            "\nExamples:\n" +
+            HelpExampleCli("dumptxoutset", "\"utxo.dat\"") + HelpExampleRpc("dumptxoutset", "\"utxo.dat\""));
+
+    fs::path path = fs::absolute(params[0].get_str(), GetDataDir());
+    if (fs::exists(path))
+        throw JSONRPCError(RPC_INVALID_PARAMETER, path.string() + " already exists");
+
+    FlushStateToDisk();
+    CTxOutSnapshotInfo info;
+    if (!DumpTxOutSet(pcoinsdbview.get(), path, info))
+        throw JSONRPCError(RPC_MISC_ERROR, "Unable to write the snapshot, see debug.log for details");
+
+    UniValue ret(UniValue::VOBJ);
+    ret.push_back(Pair("coins_written", info.commitment.nTransactionOutputs));
+    ret.push_back(Pair("base_hash", info.hashBlock.GetHex()));
+    {
+        LOCK(cs_main);
+        CBlockIndex *pindex = pnetMan->getChainActive()->LookupBlockIndex(info.hashBlock);
+        ret.push_back(Pair("base_height", pindex ? pindex->nHeight : -1));
     }
+    ret.push_back(Pair("hash_serialized", info.commitment.GetHash().GetHex()));
+    ret.push_back(Pair("path", path.string()));
+    return ret;
+}
+
+UniValue loadtxoutset(const UniValue &params, bool fHelp)
+{
+    if (fHelp || params.size() != 1)
+        throw std::runtime_error(
+            "loadtxoutset \"path\"\n"
+            "\nLoad a snapshot written by dumptxoutset and continue the chain from the block it was\n"
+            "taken at, without connecting the blocks before it.\n"
+            "The coin database has to be empty, i.e. no block past the genesis block may have been\n"
+            "connected yet, and the blocks up to the snapshot block have to be stored already: they\n"
+            "are needed to validate the coin stakes of the blocks after it. The snapshot is checked\n"
+            "against its checksum and the hash of the set stored in it, compare that hash with\n"
+            "gettxoutsetinfo on a node you trust. Wallets are not rescanned.\n"
+            "\nArguments:\n"
+            "1. \"path\"      (string, required) The snapshot file, relative to the data directory\n"
+            "\nResult:\n"
+            "{\n"
+            "  \"coins_loaded\": n,         (numeric) The number of coins loaded\n"
+            "  \"base_hash\": \"hash\",       (string) The block the snapshot was taken at\n"
+            "  \"base_height\": n,          (numeric) The height of that block\n"
+            "  \"hash_serialized\": \"hash\"  (string) The hash of the set, as reported by gettxoutsetinfo\n"
+            "}\n"
+            "\nExamples:\n" +
+            HelpExampleCli("loadtxoutset", "\"utxo.dat\"") + HelpExampleRpc("loadtxoutset", "\"utxo.dat\""));
+
+    fs::path path = fs::absolute(params[0].get_str(), GetDataDir());
+    CTxOutSnapshotInfo info;
+    if (!VerifyTxOutSnapshot(path, info))
+        throw JSONRPCError(RPC_DESERIALIZATION_ERROR, "Invalid snapshot file, see debug.log for details");
+
+    UniValue ret(UniValue::VOBJ);
+    {
+        LOCK(cs_main);
+        CChain &chainActive = pnetMan->getChainActive()->chainActive;
+        CBlockIndex *pindex = pnetMan->getChainActive()->LookupBlockIndex(info.hashBlock);
+        if (!pindex)
+            throw JSONRPCError(RPC_INVALID_PARAMETER, "The snapshot block is not known");
+        if (!(pindex->nStatus & BLOCK_HAVE_DATA) || pindex->nChainTx == 0 || (pindex->nStatus & BLOCK_FAILED_MASK))
+            throw JSONRPCError(RPC_INVALID_PARAMETER, "The blocks up to the snapshot block are not stored");
+        if (chainActive.Height() > 0)
+            throw JSONRPCError(RPC_MISC_ERROR, "A snapshot can only be loaded into an empty coin database");
+
+        FlushStateToDisk();
+        {
+            std::unique_ptr<CCoinsViewCursor> pcursor(pcoinsdbview->Cursor());
+            if (pcursor->Valid())
+                throw JSONRPCError(RPC_MISC_ERROR, "A snapshot can only be loaded into an empty coin database");
+        }
+
+        uint64_t nCoins = 0;
+        if (!LoadTxOutSnapshot(pcoinsdbview.get(), path, nCoins))
+            throw JSONRPCError(RPC_DATABASE_ERROR, "Unable to load the snapshot, see debug.log for details");
+        // Only now make the coins count: the best block and the commitment are written together
+        pcoinsdbview->UpdateCommitment(info.commitment);
+        pcoinsTip->SetBestBlock(info.hashBlock);
+        FlushStateToDisk();
+        chainActive.SetTip(pindex);
+        PruneBlockIndexCandidates();
+        LogPrintf("Loaded %u coins from UTXO snapshot %s at block %s (height %d)\n", nCoins, path.string(),
+            info.hashBlock.ToString(), pindex->nHeight);
+
+        ret.push_back(Pair("coins_loaded", (int64_t)nCoins));
+        ret.push_back(Pair("base_hash", info.hashBlock.GetHex()));
+        ret.push_back(Pair("base_height", pindex->nHeight));
+        ret.push_back(Pair("hash_serialized", info.commitment.GetHash().GetHex()));
+    }
+
+    // Continue with the blocks after the snapshot
+    CValidationState state;
+    ActivateBestChain(state, pnetMan->getActivePaymentNetwork());
+    if (!state.IsValid())
+        throw JSONRPCError(RPC_DATABASE_ERROR, state.GetRejectReason());
     return ret;
 }
 
@@ -607,7 +737,7 @@ UniValue gettxout(const UniValue &params, bool fHelp)
         ret.push_back(Pair("confirmations", (int64_t)(pindex->nHeight - coin.nHeight + 1)));
     ret.push_back(Pair("value", ValueFromAmount(coin.out.nValue)));
     UniValue o(UniValue::VOBJ);
-    ScriptPubKeyToJSON(coin.out.scriptPubKey, o, true);
+    ScriptPubKeyToJSON(coin.out.GetScriptPubKey(), o, true);
     ret.push_back(Pair("scriptPubKey", o));
     ret.push_back(Pair("coinbase", (bool)coin.fCoinBase));
 
@@ -926,6 +1056,141 @@ UniValue getmempoolinfo(const UniValue &params, bool fHelp)
     return mempoolInfoToJSON();
 }
 
+static UniValue CacheStatsToJSON(const CValidationCacheStats &stats)
+{
+    UniValue ret(UniValue::VOBJ);
+    ret.push_back(Pair("entries", (int64_t)stats.nEntries));
+    ret.push_back(Pair("bytes", (int64_t)stats.nBytes));
+    ret.push_back(Pair("lookups", (int64_t)stats.nLookups));
+    ret.push_back(Pair("hits", (int64_t)stats.nHits));
+    ret.push_back(Pair("hitrate", stats.nLookups ? (double)stats.nHits / stats.nLookups : 0.0));
+    return ret;
+}
+
+UniValue getsigcacheinfo(const UniValue &params, bool fHelp)
+{
+    if (fHelp || params.size() != 0)
+        throw std::runtime_error(
+            "getsigcacheinfo\n"
+            "\nReturns the size and hit rate of the signature cache and the script execution cache.\n"
+            "\nResult:\n"
+            "{\n"
+            "  \"signatures\": {             (json object) Cache of valid signatures\n"
+            "    \"entries\": xxxxx,         (numeric) Number of entries the cache holds\n"
+            "    \"bytes\": xxxxx,           (numeric) Memory taken by the entries\n"
+            "    \"lookups\": xxxxx,         (numeric) Number of lookups since startup\n"
+            "    \"hits\": xxxxx,            (numeric) Number of lookups that found an entry\n"
+            "    \"hitrate\": x.xxx          (numeric) hits / lookups\n"
+            "  },\n"
+            "  \"scripts\": {                (json object) Cache of transactions whose scripts passed, same fields\n"
+            "    ...\n"
+            "  }\n"
+            "}\n"
+            "\nExamples:\n" +
+            HelpExampleCli("getsigcacheinfo", "") + HelpExampleRpc("getsigcacheinfo", ""));
+
+    UniValue ret(UniValue::VOBJ);
+    ret.push_back(Pair("signatures", CacheStatsToJSON(GetSignatureCacheStats())));
+    ret.push_back(Pair("scripts", CacheStatsToJSON(GetScriptExecutionCacheStats())));
+    return ret;
+}
+
+static UniValue HistogramToJSON(const CStageHistogram &hist)
+{
+    UniValue ret(UniValue::VOBJ);
+    ret.push_back(Pair("count", (int64_t)hist.nCount));
+    ret.push_back(Pair("total_us", hist.nTotal));
+    ret.push_back(Pair("mean_us", hist.nCount ? hist.nTotal / (int64_t)hist.nCount : 0));
+    ret.push_back(Pair("max_us", hist.nMax));
+    UniValue buckets(UniValue::VARR);
+    for (int i = 0; i < CStageHistogram::NUM_BUCKETS; i++)
+    {
+        if (hist.vBuckets[i] == 0)
+            continue;
+        UniValue bucket(UniValue::VOBJ);
+        if (i < CStageHistogram::NUM_BUCKETS - 1)
+            bucket.push_back(Pair("below_us", CStageHistogram::BucketLimit(i)));
+        bucket.push_back(Pair("count", (int64_t)hist.vBuckets[i]));
+        buckets.push_back(bucket);
+    }
+    ret.push_back(Pair("histogram", buckets));
+    return ret;
+}
+
+UniValue getvalidationstats(const UniValue &params, bool fHelp)
+{
+    if (fHelp || params.size() > 1)
+        throw std::runtime_error(
+            "getvalidationstats ( count )\n"
+            "\nReturns where the time connecting blocks to the tip went, stage by stage, for the most recent\n"
+            "blocks and cumulatively since startup. The stages are read, checkblock, inputs, scripts, undo,\n"
+            "flush, mempool and signals. All times are in microseconds.\n"
+            "\nArguments:\n"
+            "1. count          (numeric, optional, default=10) Number of recent blocks to list, at most " +
+            std::to_string(VALIDATION_STATS_RECENT_BLOCKS) +
+            "\n"
+            "\nResult:\n"
+            "{\n"
+            "  \"blocks\": [               (json array) The most recently connected blocks, the newest first\n"
+            "    {\n"
+            "      \"height\": n,          (numeric) The height of the block\n"
+            "      \"hash\": \"hash\",       (string) The block hash\n"
+            "      \"total_us\": n,        (numeric) Time spent in all stages\n"
+            "      \"stages\": {           (json object) Time spent in each stage\n"
+            "        \"read\": n,\n"
+            "        ...\n"
+            "      }\n"
+            "    }, ...\n"
+            "  ],\n"
+            "  \"stages\": {               (json object) Every stage over all blocks connected since startup\n"
+            "    \"read\": {\n"
+            "      \"count\": n,           (numeric) Number of blocks\n"
+            "      \"total_us\": n,        (numeric) Time spent in the stage\n"
+            "      \"mean_us\": n,         (numeric) Average time per block\n"
+            "      \"max_us\": n,          (numeric) Longest time for one block\n"
+            "      \"histogram\": [        (json array) The non-empty buckets, fastest first\n"
+            "        { \"below_us\": n,    (numeric) Upper bound of the bucket, absent for the last one\n"
+            "          \"count\": n }      (numeric) Number of blocks in the bucket\n"
+            "      ]\n"
+            "    }, ...\n"
+            "  },\n"
+            "  \"total\": {...}            (json object) The sum of all stages, same fields as a stage\n"
+            "}\n"
+            "\nExamples:\n" +
+            HelpExampleCli("getvalidationstats", "") + HelpExampleCli("getvalidationstats", "100") +
+            HelpExampleRpc("getvalidationstats", "100"));
+
+    int64_t nCount = 10;
+    if (params.size() > 0)
+        nCount = params[0].get_int64();
+    if (nCount < 0)
+        throw JSONRPCError(RPC_INVALID_PARAMETER, "count must not be negative");
+
+    UniValue blocks(UniValue::VARR);
+    for (const CBlockValidationTiming &timing : validationStats.GetRecent(nCount))
+    {
+        UniValue block(UniValue::VOBJ);
+        block.push_back(Pair("height", timing.nHeight));
+        block.push_back(Pair("hash", timing.hashBlock.GetHex()));
+        block.push_back(Pair("total_us", timing.Total()));
+        UniValue stages(UniValue::VOBJ);
+        for (int i = 0; i < VALIDATION_STAGE_COUNT; i++)
+            stages.push_back(Pair(ValidationStageName(i), timing.nStageTime[i]));
+        block.push_back(Pair("stages", stages));
+        blocks.push_back(block);
+    }
+
+    UniValue stages(UniValue::VOBJ);
+    for (int i = 0; i < VALIDATION_STAGE_COUNT; i++)
+        stages.push_back(Pair(ValidationStageName(i), HistogramToJSON(validationStats.GetHistogram(i))));
+
+    UniValue ret(UniValue::VOBJ);
+    ret.push_back(Pair("blocks", blocks));
+    ret.push_back(Pair("stages", stages));
+    ret.push_back(Pair("total", HistogramToJSON(validationStats.GetTotalHistogram())));
+    return ret;
+}
+
 UniValue invalidateblock(const UniValue &params, bool fHelp)
 {
     if (fHelp || params.size() != 1)
@@ -34,12 +34,12 @@ static const CRPCConvertParam vRPCConvertParams[] = {{"stop", 0}, {"setmocktime"
     {"listunspent", 0}, {"listunspent", 1}, {"listunspent", 2}, {"getblock", 1}, {"getblockheader", 1},
     {"gettransaction", 1}, {"getrawtransaction", 1}, {"createrawtransaction", 0}, {"createrawtransaction", 1},
     {"createrawtransaction", 2}, {"signrawtransaction", 1}, {"signrawtransaction", 2}, {"sendrawtransaction", 1},
-    {"fundrawtransaction", 1}, {"gettxout", 1}, {"gettxout", 2}, {"gettxoutproof", 0}, {"lockunspent", 0},
-    {"lockunspent", 1}, {"importprivkey", 2}, {"importaddress", 1}, {"importaddress", 2}, {"importpubkey", 2},
-    {"verifychain", 0}, {"verifychain", 1}, {"keypoolrefill", 0}, {"getrawmempool", 0}, {"estimatefee", 0},
-    {"estimatesmartfee", 0}, {"prioritisetransaction", 1}, {"prioritisetransaction", 2}, {"setban", 2}, {"setban", 3},
-    {"generatetoaddress", 0}, {"generatetoaddress", 2}, {"getaodvidentry", 0}, {"sendpacket", 1}, {"sendpacket", 2},
-    {"getbuffer", 0}};
+    {"fundrawtransaction", 1}, {"gettxout", 1}, {"gettxout", 2}, {"gettxoutsetinfo", 0}, {"gettxoutproof", 0},
+    {"lockunspent", 0}, {"lockunspent", 1}, {"importprivkey", 2}, {"importaddress", 1}, {"importaddress", 2},
+    {"importpubkey", 2}, {"verifychain", 0}, {"verifychain", 1}, {"keypoolrefill", 0}, {"getrawmempool", 0},
+    {"estimatefee", 0}, {"estimatesmartfee", 0}, {"prioritisetransaction", 1}, {"prioritisetransaction", 2},
+    {"setban", 2}, {"setban", 3}, {"generatetoaddress", 0}, {"generatetoaddress", 2}, {"getaodvidentry", 0},
+    {"sendpacket", 1}, {"sendpacket", 2}, {"getbuffer", 0}, {"getvalidationstats", 0}};
 
 class CRPCConvertTable
 {
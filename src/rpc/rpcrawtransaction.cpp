@@ -737,13 +737,13 @@ UniValue signrawtransaction(const UniValue &params, bool fHelp)
             {
                 CoinAccessor coin(view, out);
 
-                if (!coin->IsSpent() && coin->out.scriptPubKey != scriptPubKey)
+                if (!coin->IsSpent() && coin->out.GetScriptPubKey() != scriptPubKey)
                 {
                     std::string err("Previous output scriptPubKey mismatch:\n");
-                    err = err + ScriptToAsmStr(coin->out.scriptPubKey) + "\nvs:\n" + ScriptToAsmStr(scriptPubKey);
+                    err = err + ScriptToAsmStr(coin->out.GetScriptPubKey()) + "\nvs:\n" + ScriptToAsmStr(scriptPubKey);
                     throw JSONRPCError(RPC_DESERIALIZATION_ERROR, err);
                 }
-                newcoin.out.scriptPubKey = scriptPubKey;
+                newcoin.out.SetScriptPubKey(scriptPubKey);
                 newcoin.out.nValue = 0;
                 if (prevOut.exists("amount"))
                 {
@@ -792,6 +792,9 @@ UniValue signrawtransaction(const UniValue &params, bool fHelp)
     // Script verification errors
     UniValue vErrors(UniValue::VARR);
 
+    // Filling in the scriptSigs below leaves this valid for all inputs
+    const PrecomputedTransactionData txdata(mergedTx);
+
     // Sign what we can:
     for (unsigned int i = 0; i < mergedTx.vin.size(); i++)
     {
@@ -802,12 +805,12 @@ UniValue signrawtransaction(const UniValue &params, bool fHelp)
             TxInErrorToJSON(txin, vErrors, "Input not found or already spent");
             continue;
         }
-        const CScript &prevPubKey = coin->out.scriptPubKey;
+        const CScript prevPubKey = coin->out.GetScriptPubKey();
 
         txin.scriptSig.clear();
         // Only sign SIGHASH_SINGLE if there's a corresponding output:
         if (!fHashSingle || (i < mergedTx.vout.size()))
-            SignSignature(keystore, prevPubKey, mergedTx, i, nHashType);
+            SignSignature(keystore, prevPubKey, mergedTx, i, nHashType, &txdata);
 
         // ... and merge in other signatures:
         for (auto const &txv : txVariants)
@@ -816,7 +819,7 @@ UniValue signrawtransaction(const UniValue &params, bool fHelp)
         }
         ScriptError serror = SCRIPT_ERR_OK;
         if (!VerifyScript(txin.scriptSig, prevPubKey, STANDARD_SCRIPT_VERIFY_FLAGS,
-                MutableTransactionSignatureChecker(&mergedTx, i), &serror))
+                MutableTransactionSignatureChecker(&mergedTx, i, &txdata), &serror))
         {
             TxInErrorToJSON(txin, vErrors, ScriptErrorString(serror));
         }
@@ -310,6 +310,9 @@ static const CRPCCommand vRPCCommands[] = {
     {"blockchain", "getrawmempool", &getrawmempool, true}, {"blockchain", "gettxout", &gettxout, true},
     {"blockchain", "gettxoutproof", &gettxoutproof, true}, {"blockchain", "verifytxoutproof", &verifytxoutproof, true},
     {"blockchain", "gettxoutsetinfo", &gettxoutsetinfo, true}, {"blockchain", "verifychain", &verifychain, true},
+    {"blockchain", "dumptxoutset", &dumptxoutset, true}, {"blockchain", "loadtxoutset", &loadtxoutset, true},
+    {"blockchain", "getsigcacheinfo", &getsigcacheinfo, true},
+    {"blockchain", "getvalidationstats", &getvalidationstats, true},
 
     /* Mining */
     {"mining", "getblocktemplate", &getblocktemplate, true}, {"mining", "getmininginfo", &getmininginfo, true},
@@ -262,6 +262,10 @@ extern UniValue getblockhash(const UniValue &params, bool fHelp);
 extern UniValue getblockheader(const UniValue &params, bool fHelp);
 extern UniValue getblock(const UniValue &params, bool fHelp);
 extern UniValue gettxoutsetinfo(const UniValue &params, bool fHelp);
+extern UniValue dumptxoutset(const UniValue &params, bool fHelp);
+extern UniValue loadtxoutset(const UniValue &params, bool fHelp);
+extern UniValue getsigcacheinfo(const UniValue &params, bool fHelp);
+extern UniValue getvalidationstats(const UniValue &params, bool fHelp);
 extern UniValue gettxout(const UniValue &params, bool fHelp);
 extern UniValue verifychain(const UniValue &params, bool fHelp);
 extern UniValue getchaintips(const UniValue &params, bool fHelp);
@@ -66,6 +66,17 @@ static inline void popstack(std::vector<valtype> &stack)
     stack.pop_back();
 }
 
+//! Push a copy of stack[nPos]; push_back copies an element of the vector itself safely
+static inline void pushcopy(std::vector<valtype> &stack, size_t nPos) { stack.push_back(stack[nPos]); }
+//! Set vch to the encoding of a boolean result, in place
+static inline void setbool(valtype &vch, bool fValue)
+{
+    if (fValue)
+        vch.assign(1, 1);
+    else
+        vch.clear();
+}
+
 bool static IsCompressedOrUncompressedPubKey(const valtype &vchPubKey)
 {
     if (vchPubKey.size() < 33)
@@ -293,9 +304,6 @@ bool EvalScript(std::vector<std::vector<unsigned char> > &stack,
     static const CScriptNum bnOne(1);
     static const CScriptNum bnFalse(0);
     static const CScriptNum bnTrue(1);
-    static const valtype vchFalse(0);
-    static const valtype vchZero(0);
-    static const valtype vchTrue(1, 1);
 
     CScript::const_iterator pc = script.begin();
     CScript::const_iterator pend = script.end();
@@ -541,8 +549,8 @@ bool EvalScript(std::vector<std::vector<unsigned char> > &stack,
                 {
                     if (stack.size() < 1)
                         return set_error(serror, SCRIPT_ERR_INVALID_STACK_OPERATION);
-                    altstack.push_back(stacktop(-1));
-                    popstack(stack);
+                    altstack.push_back(std::move(stacktop(-1)));
+                    stack.pop_back();
                 }
                 break;
 
@@ -550,8 +558,8 @@ bool EvalScript(std::vector<std::vector<unsigned char> > &stack,
                 {
                     if (altstack.size() < 1)
                         return set_error(serror, SCRIPT_ERR_INVALID_ALTSTACK_OPERATION);
-                    stack.push_back(altstacktop(-1));
-                    popstack(altstack);
+                    stack.push_back(std::move(altstacktop(-1)));
+                    altstack.pop_back();
                 }
                 break;
 
@@ -570,10 +578,9 @@ bool EvalScript(std::vector<std::vector<unsigned char> > &stack,
                     // (x1 x2 -- x1 x2 x1 x2)
                     if (stack.size() < 2)
                         return set_error(serror, SCRIPT_ERR_INVALID_STACK_OPERATION);
-                    valtype vch1 = stacktop(-2);
-                    valtype vch2 = stacktop(-1);
-                    stack.push_back(vch1);
-                    stack.push_back(vch2);
+                    const size_t nSize = stack.size();
+                    pushcopy(stack, nSize - 2);
+                    pushcopy(stack, nSize - 1);
                 }
                 break;
 
@@ -582,12 +589,10 @@ bool EvalScript(std::vector<std::vector<unsigned char> > &stack,
                     // (x1 x2 x3 -- x1 x2 x3 x1 x2 x3)
                     if (stack.size() < 3)
                         return set_error(serror, SCRIPT_ERR_INVALID_STACK_OPERATION);
-                    valtype vch1 = stacktop(-3);
-                    valtype vch2 = stacktop(-2);
-                    valtype vch3 = stacktop(-1);
-                    stack.push_back(vch1);
-                    stack.push_back(vch2);
-                    stack.push_back(vch3);
+                    const size_t nSize = stack.size();
+                    pushcopy(stack, nSize - 3);
+                    pushcopy(stack, nSize - 2);
+                    pushcopy(stack, nSize - 1);
                 }
                 break;
 
@@ -596,10 +601,9 @@ bool EvalScript(std::vector<std::vector<unsigned char> > &stack,
                     // (x1 x2 x3 x4 -- x1 x2 x3 x4 x1 x2)
                     if (stack.size() < 4)
                         return set_error(serror, SCRIPT_ERR_INVALID_STACK_OPERATION);
-                    valtype vch1 = stacktop(-4);
-                    valtype vch2 = stacktop(-3);
-                    stack.push_back(vch1);
-                    stack.push_back(vch2);
+                    const size_t nSize = stack.size();
+                    pushcopy(stack, nSize - 4);
+                    pushcopy(stack, nSize - 3);
                 }
                 break;
 
@@ -608,11 +612,11 @@ bool EvalScript(std::vector<std::vector<unsigned char> > &stack,
                     // (x1 x2 x3 x4 x5 x6 -- x3 x4 x5 x6 x1 x2)
                     if (stack.size() < 6)
                         return set_error(serror, SCRIPT_ERR_INVALID_STACK_OPERATION);
-                    valtype vch1 = stacktop(-6);
-                    valtype vch2 = stacktop(-5);
+                    valtype vch1 = std::move(stacktop(-6));
+                    valtype vch2 = std::move(stacktop(-5));
                     stack.erase(stack.end() - 6, stack.end() - 4);
-                    stack.push_back(vch1);
-                    stack.push_back(vch2);
+                    stack.push_back(std::move(vch1));
+                    stack.push_back(std::move(vch2));
                 }
                 break;
 
@@ -631,9 +635,8 @@ bool EvalScript(std::vector<std::vector<unsigned char> > &stack,
                     // (x - 0 | x x)
                     if (stack.size() < 1)
                         return set_error(serror, SCRIPT_ERR_INVALID_STACK_OPERATION);
-                    valtype vch = stacktop(-1);
-                    if (CastToBool(vch))
-                        stack.push_back(vch);
+                    if (CastToBool(stacktop(-1)))
+                        pushcopy(stack, stack.size() - 1);
                 }
                 break;
 
@@ -659,8 +662,7 @@ bool EvalScript(std::vector<std::vector<unsigned char> > &stack,
                     // (x -- x x)
                     if (stack.size() < 1)
                         return set_error(serror, SCRIPT_ERR_INVALID_STACK_OPERATION);
-                    valtype vch = stacktop(-1);
-                    stack.push_back(vch);
+                    pushcopy(stack, stack.size() - 1);
                 }
                 break;
 
@@ -678,8 +680,7 @@ bool EvalScript(std::vector<std::vector<unsigned char> > &stack,
                     // (x1 x2 -- x1 x2 x1)
                     if (stack.size() < 2)
                         return set_error(serror, SCRIPT_ERR_INVALID_STACK_OPERATION);
-                    valtype vch = stacktop(-2);
-                    stack.push_back(vch);
+                    pushcopy(stack, stack.size() - 2);
                 }
                 break;
 
@@ -694,10 +695,16 @@ bool EvalScript(std::vector<std::vector<unsigned char> > &stack,
                     popstack(stack);
                     if (n < 0 || n >= (int)stack.size())
                         return set_error(serror, SCRIPT_ERR_INVALID_STACK_OPERATION);
-                    valtype vch = stacktop(-n - 1);
                     if (opcode == OP_ROLL)
+                    {
+                        valtype vch = std::move(stacktop(-n - 1));
                         stack.erase(stack.end() - n - 1);
-                    stack.push_back(vch);
+                        stack.push_back(std::move(vch));
+                    }
+                    else
+                    {
+                        pushcopy(stack, stack.size() - n - 1);
+                    }
                 }
                 break;
 
@@ -763,8 +770,7 @@ bool EvalScript(std::vector<std::vector<unsigned char> > &stack,
                         // if (opcode == OP_NOTEQUAL)
                         //    fEqual = !fEqual;
                         popstack(stack);
-                        popstack(stack);
-                        stack.push_back(fEqual ? vchTrue : vchFalse);
+                        setbool(stacktop(-1), fEqual);
                         if (opcode == OP_EQUALVERIFY)
                         {
                             if (fEqual)
@@ -912,8 +918,7 @@ bool EvalScript(std::vector<std::vector<unsigned char> > &stack,
                     bool fValue = (bn2 <= bn1 && bn1 < bn3);
                     popstack(stack);
                     popstack(stack);
-                    popstack(stack);
-                    stack.push_back(fValue ? vchTrue : vchFalse);
+                    setbool(stacktop(-1), fValue);
                 }
                 break;
 
@@ -930,20 +935,21 @@ bool EvalScript(std::vector<std::vector<unsigned char> > &stack,
                     // (in -- hash)
                     if (stack.size() < 1)
                         return set_error(serror, SCRIPT_ERR_INVALID_STACK_OPERATION);
+                    // The hash replaces its input in place, reusing its buffer
                     valtype &vch = stacktop(-1);
-                    valtype vchHash((opcode == OP_RIPEMD160 || opcode == OP_SHA1 || opcode == OP_HASH160) ? 20 : 32);
+                    unsigned char hash[32];
+                    size_t nHashSize = (opcode == OP_RIPEMD160 || opcode == OP_SHA1 || opcode == OP_HASH160) ? 20 : 32;
                     if (opcode == OP_RIPEMD160)
-                        CRIPEMD160().Write(begin_ptr(vch), vch.size()).Finalize(begin_ptr(vchHash));
+                        CRIPEMD160().Write(begin_ptr(vch), vch.size()).Finalize(hash);
                     else if (opcode == OP_SHA1)
-                        CSHA1().Write(begin_ptr(vch), vch.size()).Finalize(begin_ptr(vchHash));
+                        CSHA1().Write(begin_ptr(vch), vch.size()).Finalize(hash);
                     else if (opcode == OP_SHA256)
-                        CSHA256().Write(begin_ptr(vch), vch.size()).Finalize(begin_ptr(vchHash));
+                        CSHA256().Write(begin_ptr(vch), vch.size()).Finalize(hash);
                     else if (opcode == OP_HASH160)
-                        CHash160().Write(begin_ptr(vch), vch.size()).Finalize(begin_ptr(vchHash));
+                        CHash160().Write(begin_ptr(vch), vch.size()).Finalize(hash);
                     else if (opcode == OP_HASH256)
-                        CHash256().Write(begin_ptr(vch), vch.size()).Finalize(begin_ptr(vchHash));
-                    popstack(stack);
-                    stack.push_back(vchHash);
+                        CHash256().Write(begin_ptr(vch), vch.size()).Finalize(hash);
+                    vch.assign(hash, hash + nHashSize);
                 }
                 break;
 
@@ -988,8 +994,7 @@ bool EvalScript(std::vector<std::vector<unsigned char> > &stack,
                         return set_error(serror, SCRIPT_ERR_SIG_NULLFAIL);
 
                     popstack(stack);
-                    popstack(stack);
-                    stack.push_back(fSuccess ? vchTrue : vchFalse);
+                    setbool(stacktop(-1), fSuccess);
                     if (opcode == OP_CHECKSIGVERIFY)
                     {
                         if (fSuccess)
@@ -1100,9 +1105,9 @@ bool EvalScript(std::vector<std::vector<unsigned char> > &stack,
                         return set_error(serror, SCRIPT_ERR_INVALID_STACK_OPERATION);
                     if ((flags & SCRIPT_VERIFY_NULLDUMMY) && stacktop(-1).size())
                         return set_error(serror, SCRIPT_ERR_SIG_NULLDUMMY);
-                    popstack(stack);
 
-                    stack.push_back(fSuccess ? vchTrue : vchFalse);
+                    // The result takes the place of the dummy
+                    setbool(stacktop(-1), fSuccess);
 
                     if (opcode == OP_CHECKMULTISIGVERIFY)
                     {
@@ -1244,9 +1249,37 @@ public:
     }
 };
 
+//! Size of an input with a blanked script: prevout, empty script and nSequence
+const size_t BLANKED_INPUT_SIZE = 32 + 4 + 1 + 4;
+
 } // anon namespace
 
-uint256 SignatureHash(const CScript &scriptCode, const CTransaction &txTo, unsigned int nIn, int nHashType)
+PrecomputedTransactionData::PrecomputedTransactionData(const CTransaction &txTo)
+{
+    CDataStream ss(SER_GETHASH, 0);
+    for (const CTxIn &txin : txTo.vin)
+        ss << txin.prevout << CScriptBase() << txin.nSequence;
+    nOutputsPos = ss.size();
+    assert(nOutputsPos == txTo.vin.size() * BLANKED_INPUT_SIZE);
+    ss << txTo.vout << txTo.nLockTime;
+    vchTail.assign(ss.begin(), ss.end());
+
+    CHashWriter hasher(SER_GETHASH, 0);
+    hasher << txTo.nVersion << txTo.nTime;
+    ::WriteCompactSize(hasher, txTo.vin.size());
+    vMidstates.reserve(txTo.vin.size());
+    for (size_t i = 0; i < txTo.vin.size(); i++)
+    {
+        vMidstates.push_back(hasher);
+        hasher.write((const char *)&vchTail[i * BLANKED_INPUT_SIZE], BLANKED_INPUT_SIZE);
+    }
+}
+
+uint256 SignatureHash(const CScript &scriptCode,
+    const CTransaction &txTo,
+    unsigned int nIn,
+    int nHashType,
+    const PrecomputedTransactionData *cache)
 {
     assert(nIn < txTo.vin.size());
 
@@ -1265,6 +1298,32 @@ uint256 SignatureHash(const CScript &scriptCode, const CTransaction &txTo, unsig
     // Wrapper to serialize only the necessary parts of the transaction being signed
     CTransactionSignatureSerializer txTmp(txTo, scriptCode, nIn, nHashType);
 
+    // SIGHASH_SINGLE and SIGHASH_NONE blank the other inputs' nSequence and
+    // outputs, so the precomputed serialization only covers the other types.
+    if (cache && (nHashType & 0x1f) != SIGHASH_SINGLE && (nHashType & 0x1f) != SIGHASH_NONE)
+    {
+        assert(cache->vMidstates.size() == txTo.vin.size());
+        CHashWriter ss(SER_GETHASH, 0);
+        size_t nTailPos;
+        if (nHashType & SIGHASH_ANYONECANPAY)
+        {
+            ss << txTo.nVersion << txTo.nTime;
+            ::WriteCompactSize(ss, 1);
+            nTailPos = cache->nOutputsPos;
+        }
+        else
+        {
+            ss = cache->vMidstates[nIn];
+            nTailPos = (nIn + 1) * BLANKED_INPUT_SIZE;
+        }
+        ss << txTo.vin[nIn].prevout;
+        txTmp.SerializeScriptCode(ss);
+        ss << txTo.vin[nIn].nSequence;
+        ss.write((const char *)&cache->vchTail[nTailPos], cache->vchTail.size() - nTailPos);
+        ss << nHashType;
+        return ss.GetHash();
+    }
+
     // Serialize and hash
     CHashWriter ss(SER_GETHASH, 0);
     ss << txTmp << nHashType;
@@ -1293,7 +1352,7 @@ bool TransactionSignatureChecker::CheckSig(const std::vector<unsigned char> &vch
     int nHashType = vchSig.back();
     vchSig.pop_back();
 
-    uint256 sighash = SignatureHash(scriptCode, *txTo, nIn, nHashType);
+    uint256 sighash = SignatureHash(scriptCode, *txTo, nIn, nHashType, txdata);
 
     if (!VerifySignature(vchSig, pubkey, sighash))
         return false;
@@ -1399,7 +1458,9 @@ bool VerifyScript(const CScript &scriptSig,
     if (!EvalScript(stack, scriptSig, flags, checker, serror))
         // serror is set
         return false;
-    if (flags & SCRIPT_VERIFY_P2SH)
+    // Only a P2SH spend needs the stack again, other spends skip the copy
+    const bool fP2SH = (flags & SCRIPT_VERIFY_P2SH) && scriptPubKey.IsPayToScriptHash();
+    if (fP2SH)
         stackCopy = stack;
     if (!EvalScript(stack, scriptPubKey, flags, checker, serror))
         // serror is set
@@ -1410,7 +1471,7 @@ bool VerifyScript(const CScript &scriptSig,
         return set_error(serror, SCRIPT_ERR_EVAL_FALSE);
 
     // Additional validation for spend-to-script-hash transactions:
-    if ((flags & SCRIPT_VERIFY_P2SH) && scriptPubKey.IsPayToScriptHash())
+    if (fP2SH)
     {
         // scriptSig must be literals-only or validation fails
         if (!scriptSig.IsPushOnly())
@@ -9,6 +9,7 @@
 #define BITCOIN_SCRIPT_INTERPRETER_H
 
 #include "chain/tx.h"
+#include "crypto/hash.h"
 #include "script_error.h"
 
 #include <stdint.h>
@@ -98,7 +99,35 @@ enum
 
 bool CheckSignatureEncoding(const std::vector<unsigned char> &vchSig, unsigned int flags, ScriptError *serror);
 
-uint256 SignatureHash(const CScript &scriptCode, const CTransaction &txTo, unsigned int nIn, int nHashType);
+/**
+ * Serialized parts of a transaction that the signature hashes of all its
+ * inputs have in common.
+ *
+ * Every input's signature hash covers the whole transaction, so signing or
+ * verifying all inputs of an n-input transaction serializes it n times. With
+ * this data SignatureHash resumes from a SHA-256 midstate taken just before
+ * the input being hashed, serializes only that input and appends the rest
+ * from a buffer. Only scripts are left out, so the data stays valid while the
+ * scriptSigs are being filled in.
+ */
+class PrecomputedTransactionData
+{
+public:
+    //! hasher state after everything that precedes input i in a SIGHASH_ALL preimage
+    std::vector<CHashWriter> vMidstates;
+    //! all inputs with their scripts blanked, then the outputs and nLockTime
+    std::vector<unsigned char> vchTail;
+    //! position of the outputs in vchTail
+    size_t nOutputsPos;
+
+    explicit PrecomputedTransactionData(const CTransaction &txTo);
+};
+
+uint256 SignatureHash(const CScript &scriptCode,
+    const CTransaction &txTo,
+    unsigned int nIn,
+    int nHashType,
+    const PrecomputedTransactionData *cache = nullptr);
 
 class BaseSignatureChecker
 {
@@ -120,6 +149,7 @@ class TransactionSignatureChecker : public BaseSignatureChecker
 private:
     const CTransaction *txTo;
     unsigned int nIn;
+    const PrecomputedTransactionData *txdata;
 
 protected:
     virtual bool VerifySignature(const std::vector<unsigned char> &vchSig,
@@ -127,7 +157,12 @@ protected:
         const uint256 &sighash) const;
 
 public:
-    TransactionSignatureChecker(const CTransaction *txToIn, unsigned int nInIn) : txTo(txToIn), nIn(nInIn) {}
+    TransactionSignatureChecker(const CTransaction *txToIn,
+        unsigned int nInIn,
+        const PrecomputedTransactionData *txdataIn = nullptr)
+        : txTo(txToIn), nIn(nInIn), txdata(txdataIn)
+    {
+    }
     bool CheckSig(const std::vector<unsigned char> &scriptSig,
         const std::vector<unsigned char> &vchPubKey,
         const CScript &scriptCode) const;
@@ -141,8 +176,10 @@ private:
     const CTransaction txTo;
 
 public:
-    MutableTransactionSignatureChecker(const CTransaction *txToIn, unsigned int nInIn)
-        : TransactionSignatureChecker(&txTo, nInIn), txTo(*txToIn)
+    MutableTransactionSignatureChecker(const CTransaction *txToIn,
+        unsigned int nInIn,
+        const PrecomputedTransactionData *txdataIn = nullptr)
+        : TransactionSignatureChecker(&txTo, nInIn, txdataIn), txTo(*txToIn)
     {
     }
 };
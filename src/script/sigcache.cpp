@@ -8,27 +8,18 @@
 #include "sigcache.h"
 
 #include "args.h"
-#include "memusage.h"
+#include "cuckoocache.h"
 #include "pubkey.h"
 #include "random.h"
 #include "uint256.h"
 #include "util/util.h"
 
-#include <boost/thread.hpp>
-#include <boost/unordered_set.hpp>
+#include <atomic>
+
+#include <boost/thread/shared_mutex.hpp>
 
 namespace
 {
-/**
- * We're hashing a nonce into the entries themselves, so we don't need extra
- * blinding in the set hash computation.
- */
-class CSignatureCacheHasher
-{
-public:
-    size_t operator()(const uint256 &key) const { return key.GetCheapHash(); }
-};
-
 /**
  * Valid signature cache, to avoid doing expensive ECDSA signature checking
  * twice for every transaction (once when accepted into memory pool, and
@@ -39,13 +30,15 @@ class CSignatureCache
 private:
     //! Entries are SHA256(nonce || signature hash || public key || signature):
     uint256 nonce;
-    typedef boost::unordered_set<uint256, CSignatureCacheHasher> map_type;
+    typedef CuckooCache::cache<uint256, SignatureCacheHasher> map_type;
     map_type setValid;
+    //! Lookups share the lock, inserts and resizing take it exclusively
     boost::shared_mutex cs_sigcache;
-
+    std::atomic<uint64_t> nLookups;
+    std::atomic<uint64_t> nHits;
 
 public:
-    CSignatureCache() { GetRandBytes(nonce.begin(), 32); }
+    CSignatureCache() : nLookups(0), nHits(0) { GetRandBytes(nonce.begin(), 32); }
     void ComputeEntry(uint256 &entry,
         const uint256 &hash,
         const std::vector<unsigned char> &vchSig,
@@ -59,57 +52,69 @@ public:
             .Finalize(entry.begin());
     }
 
-    bool Get(const uint256 &entry)
+    //! Look up entry, letting it be evicted first when it is found and fErase is set
+    bool Get(const uint256 &entry, bool fErase)
     {
         boost::shared_lock<boost::shared_mutex> lock(cs_sigcache);
-        return setValid.count(entry);
+        nLookups.fetch_add(1, std::memory_order_relaxed);
+        if (!setValid.contains(entry, fErase))
+            return false;
+        nHits.fetch_add(1, std::memory_order_relaxed);
+        return true;
     }
 
-    void Erase(const uint256 &entry)
+    void Set(const uint256 &entry)
     {
         boost::unique_lock<boost::shared_mutex> lock(cs_sigcache);
-        setValid.erase(entry);
+        setValid.insert(entry);
     }
 
-    void Set(const uint256 &entry)
+    uint32_t Setup(size_t nBytes)
     {
-        size_t nMaxCacheSize = gArgs.GetArg("-maxsigcachesize", DEFAULT_MAX_SIG_CACHE_SIZE) * ((size_t)1 << 20);
-        if (nMaxCacheSize <= 0)
-            return;
-
         boost::unique_lock<boost::shared_mutex> lock(cs_sigcache);
-        while (memusage::DynamicUsage(setValid) > nMaxCacheSize)
-        {
-            map_type::size_type s = GetRand(setValid.bucket_count());
-            map_type::local_iterator it = setValid.begin(s);
-            if (it != setValid.end(s))
-            {
-                setValid.erase(*it);
-            }
-        }
+        return setValid.setup_bytes(nBytes);
+    }
 
-        setValid.insert(entry);
+    CValidationCacheStats GetStats()
+    {
+        CValidationCacheStats stats;
+        boost::shared_lock<boost::shared_mutex> lock(cs_sigcache);
+        stats.nEntries = setValid.capacity();
+        stats.nBytes = (size_t)stats.nEntries * sizeof(uint256);
+        stats.nLookups = nLookups.load(std::memory_order_relaxed);
+        stats.nHits = nHits.load(std::memory_order_relaxed);
+        return stats;
     }
 };
+
+CSignatureCache signatureCache;
+}
+
+size_t GetValidationCacheBytes()
+{
+    int64_t nMaxCacheSize = std::max((int64_t)0, gArgs.GetArg("-maxsigcachesize", DEFAULT_MAX_SIG_CACHE_SIZE));
+    return std::min(nMaxCacheSize, MAX_MAX_SIG_CACHE_SIZE) * ((size_t)1 << 20) / 2;
 }
 
+void InitSignatureCache()
+{
+    size_t nMaxCacheSize = GetValidationCacheBytes();
+    uint32_t nEntries = signatureCache.Setup(nMaxCacheSize);
+    LogPrintf("Using %zu MiB out of %zu requested for signature cache, able to store %u elements\n",
+        (nEntries * sizeof(uint256)) >> 20, nMaxCacheSize >> 20, nEntries);
+}
+
+CValidationCacheStats GetSignatureCacheStats() { return signatureCache.GetStats(); }
+
 bool CachingTransactionSignatureChecker::VerifySignature(const std::vector<unsigned char> &vchSig,
     const CPubKey &pubkey,
     const uint256 &sighash) const
 {
-    static CSignatureCache signatureCache;
-
     uint256 entry;
     signatureCache.ComputeEntry(entry, sighash, vchSig, pubkey);
 
-    if (signatureCache.Get(entry))
-    {
-        if (!store)
-        {
-            signatureCache.Erase(entry);
-        }
+    if (signatureCache.Get(entry, !store))
         return true;
-    }
 
     if (!TransactionSignatureChecker::VerifySignature(vchSig, pubkey, sighash))
         return false;
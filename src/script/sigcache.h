@@ -9,23 +9,60 @@
 #define BITCOIN_SCRIPT_SIGCACHE_H
 
 #include "script/interpreter.h"
+#include "uint256.h"
 
+#include <stdint.h>
+#include <string.h>
 #include <vector>
 
-// DoS prevention: limit cache size to less than 40MB (over 500000
-// entries on 64-bit systems).
+// DoS prevention: limit the signature and script execution caches to 40MB
+// together (over 600000 entries each).
 static const unsigned int DEFAULT_MAX_SIG_CACHE_SIZE = 40;
+//! Maximum for -maxsigcachesize, so the entries of either cache can be counted in 32 bits
+static const int64_t MAX_MAX_SIG_CACHE_SIZE = 16384;
 
 class CPubKey;
 
+/**
+ * The eight hash functions the validation caches place their entries with.
+ * Entries are salted SHA256 hashes already, so each function just picks a
+ * different 32-bit word of the entry.
+ */
+class SignatureCacheHasher
+{
+public:
+    template <uint8_t hash_select>
+    uint32_t operator()(const uint256 &key) const
+    {
+        static_assert(hash_select < 8, "SignatureCacheHasher only has 8 hashes available.");
+        uint32_t u;
+        memcpy(&u, key.begin() + 4 * hash_select, 4);
+        return u;
+    }
+};
+
+/** Size and use of the signature cache or the script execution cache */
+struct CValidationCacheStats
+{
+    //! number of entries the cache holds
+    uint32_t nEntries;
+    //! memory taken by the entries
+    size_t nBytes;
+    uint64_t nLookups;
+    uint64_t nHits;
+};
+
 class CachingTransactionSignatureChecker : public TransactionSignatureChecker
 {
 private:
     bool store;
 
 public:
-    CachingTransactionSignatureChecker(const CTransaction *txToIn, unsigned int nInIn, bool storeIn = true)
-        : TransactionSignatureChecker(txToIn, nInIn), store(storeIn)
+    CachingTransactionSignatureChecker(const CTransaction *txToIn,
+        unsigned int nInIn,
+        bool storeIn = true,
+        const PrecomputedTransactionData *txdataIn = nullptr)
+        : TransactionSignatureChecker(txToIn, nInIn, txdataIn), store(storeIn)
     {
     }
 
@@ -34,4 +71,10 @@ public:
         const uint256 &sighash) const;
 };
 
+//! Size of each of the signature and script execution caches, half of -maxsigcachesize
+size_t GetValidationCacheBytes();
+/** Size the signature cache from -maxsigcachesize, before any script is checked */
+void InitSignatureCache();
+CValidationCacheStats GetSignatureCacheStats();
+
 #endif // BITCOIN_SCRIPT_SIGCACHE_H
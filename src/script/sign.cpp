@@ -19,8 +19,10 @@ typedef std::vector<unsigned char> valtype;
 TransactionSignatureCreator::TransactionSignatureCreator(const CKeyStore *keystoreIn,
     const CTransaction *txToIn,
     unsigned int nInIn,
-    int nHashTypeIn)
-    : BaseSignatureCreator(keystoreIn), txTo(txToIn), nIn(nInIn), nHashType(nHashTypeIn), checker(txTo, nIn)
+    int nHashTypeIn,
+    const PrecomputedTransactionData *txdataIn)
+    : BaseSignatureCreator(keystoreIn), txTo(txToIn), nIn(nInIn), nHashType(nHashTypeIn), txdata(txdataIn),
+      checker(txTo, nIn, txdata)
 {
 }
 
@@ -32,7 +34,7 @@ bool TransactionSignatureCreator::CreateSig(std::vector<unsigned char> &vchSig,
     if (!keystore->GetKey(address, key))
         return false;
 
-    uint256 hash = SignatureHash(scriptCode, *txTo, nIn, nHashType);
+    uint256 hash = SignatureHash(scriptCode, *txTo, nIn, nHashType, txdata);
     if (!key.Sign(hash, vchSig))
         return false;
     vchSig.push_back((unsigned char)nHashType);
@@ -144,13 +146,14 @@ bool SignSignature(const CKeyStore &keystore,
     const CScript &fromPubKey,
     CTransaction &txTo,
     unsigned int nIn,
-    int nHashType)
+    int nHashType,
+    const PrecomputedTransactionData *txdata)
 {
     assert(nIn < txTo.vin.size());
     CTxIn &txin = txTo.vin[nIn];
 
     CTransaction txToConst(txTo);
-    TransactionSignatureCreator creator(&keystore, &txToConst, nIn, nHashType);
+    TransactionSignatureCreator creator(&keystore, &txToConst, nIn, nHashType, txdata);
 
     return ProduceSignature(creator, fromPubKey, txin.scriptSig);
 }
@@ -159,7 +162,8 @@ bool SignSignature(const CKeyStore &keystore,
     const CTransaction &txFrom,
     CTransaction &txTo,
     unsigned int nIn,
-    int nHashType)
+    int nHashType,
+    const PrecomputedTransactionData *txdata)
 {
     assert(nIn < txTo.vin.size());
     CTxIn &txin = txTo.vin[nIn];
@@ -167,7 +171,7 @@ bool SignSignature(const CKeyStore &keystore,
     assert(txin.prevout.hash == txFrom.GetHash());
     const CTxOut &txout = txFrom.vout[txin.prevout.n];
 
-    return SignSignature(keystore, txout.scriptPubKey, txTo, nIn, nHashType);
+    return SignSignature(keystore, txout.scriptPubKey, txTo, nIn, nHashType, txdata);
 }
 
 static CScript PushAll(const std::vector<valtype> &values)
@@ -41,13 +41,15 @@ class TransactionSignatureCreator : public BaseSignatureCreator
     const CTransaction *txTo;
     unsigned int nIn;
     int nHashType;
+    const PrecomputedTransactionData *txdata;
     const TransactionSignatureChecker checker;
 
 public:
     TransactionSignatureCreator(const CKeyStore *keystoreIn,
         const CTransaction *txToIn,
         unsigned int nInIn,
-        int nHashTypeIn = SIGHASH_ALL);
+        int nHashTypeIn = SIGHASH_ALL,
+        const PrecomputedTransactionData *txdataIn = nullptr);
     const BaseSignatureChecker &Checker() const { return checker; }
     bool CreateSig(std::vector<unsigned char> &vchSig, const CKeyID &keyid, const CScript &scriptCode) const;
 };
@@ -64,17 +66,22 @@ public:
 /** Produce a script signature using a generic signature creator. */
 bool ProduceSignature(const BaseSignatureCreator &creator, const CScript &scriptPubKey, CScript &scriptSig);
 
-/** Produce a script signature for a transaction. */
+/**
+ * Produce a script signature for a transaction. When several inputs of txTo
+ * are signed in a row, pass txdata computed from txTo once to all of them.
+ */
 bool SignSignature(const CKeyStore &keystore,
     const CScript &fromPubKey,
     CTransaction &txTo,
     unsigned int nIn,
-    int nHashType = SIGHASH_ALL);
+    int nHashType = SIGHASH_ALL,
+    const PrecomputedTransactionData *txdata = nullptr);
 bool SignSignature(const CKeyStore &keystore,
     const CTransaction &txFrom,
     CTransaction &txTo,
     unsigned int nIn,
-    int nHashType = SIGHASH_ALL);
+    int nHashType = SIGHASH_ALL,
+    const PrecomputedTransactionData *txdata = nullptr);
 
 /** Combine two script signatures using a generic signature checker, intelligently, possibly with OP_0 placeholders. */
 CScript CombineSignatures(const CScript &scriptPubKey,
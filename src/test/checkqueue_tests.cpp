@@ -0,0 +1,115 @@
+// Copyright (c) 2018 The Eccoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "checkqueue.h"
+#include "random.h"
+#include "test/test_bitcoin.h"
+
+#include <atomic>
+#include <utility>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/thread/thread.hpp>
+
+namespace
+{
+std::atomic<int> nChecksRun(0);
+
+/** Check that counts its runs and fails when told so */
+class CCountingCheck
+{
+private:
+    bool fResult;
+
+public:
+    CCountingCheck() : fResult(true) {}
+    explicit CCountingCheck(bool fResultIn) : fResult(fResultIn) {}
+    bool operator()()
+    {
+        nChecksRun++;
+        return fResult;
+    }
+    void swap(CCountingCheck &check) { std::swap(fResult, check.fResult); }
+};
+
+/** A queue with nThreads - 1 worker threads, stopped again on destruction */
+class CQueueWithWorkers
+{
+public:
+    CCheckQueue<CCountingCheck> queue;
+    boost::thread_group threads;
+
+    explicit CQueueWithWorkers(int nThreads) : queue(16)
+    {
+        for (int i = 0; i < nThreads - 1; i++)
+            threads.create_thread([this]() { queue.Thread(); });
+    }
+    ~CQueueWithWorkers()
+    {
+        queue.Interrupt();
+        threads.join_all();
+    }
+};
+
+//! Add nChecks checks in randomly sized batches, the one at nFail failing
+bool RunChecks(CCheckQueue<CCountingCheck> &queue, int nChecks, int nFail = -1)
+{
+    CCheckQueueControl<CCountingCheck> control(&queue);
+    for (int i = 0; i < nChecks;)
+    {
+        std::vector<CCountingCheck> vChecks;
+        for (int n = 1 + insecure_rand() % 20; n > 0 && i < nChecks; n--, i++)
+            vChecks.emplace_back(i != nFail);
+        control.Add(vChecks);
+    }
+    return control.Wait();
+}
+}
+
+BOOST_FIXTURE_TEST_SUITE(checkqueue_tests, BasicTestingSetup)
+
+BOOST_AUTO_TEST_CASE(checkqueue_all_run)
+{
+    for (int nThreads : {1, 2, 5, 70})
+    {
+        CQueueWithWorkers workers(nThreads);
+        for (int nChecks : {0, 1, 7, 1000, 10000})
+        {
+            nChecksRun = 0;
+            BOOST_CHECK(RunChecks(workers.queue, nChecks));
+            BOOST_CHECK_EQUAL(nChecksRun.load(), nChecks);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(checkqueue_failure)
+{
+    CQueueWithWorkers workers(4);
+    for (int i = 0; i < 20; i++)
+    {
+        int nChecks = 1 + insecure_rand() % 5000;
+        nChecksRun = 0;
+        BOOST_CHECK(!RunChecks(workers.queue, nChecks, insecure_rand() % nChecks));
+        BOOST_CHECK(nChecksRun.load() <= nChecks);
+        // The failure does not stick to the next round
+        BOOST_CHECK(RunChecks(workers.queue, 100));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(checkqueue_early_abort)
+{
+    // Without workers the master runs the checks in order, so nothing after
+    // the failing check at the back of its deque is run
+    CCheckQueue<CCountingCheck> queue(16);
+    CCheckQueueControl<CCountingCheck> control(&queue);
+    std::vector<CCountingCheck> vChecks;
+    for (int i = 0; i < 1000; i++)
+        vChecks.emplace_back(i != 999);
+    control.Add(vChecks);
+    nChecksRun = 0;
+    BOOST_CHECK(!control.Wait());
+    BOOST_CHECK_EQUAL(nChecksRun.load(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -183,14 +183,18 @@ BOOST_AUTO_TEST_CASE(coins_cache_simulation_test)
                 newcoin.nHeight = 1;
                 if (insecure_rand() % 16 == 0 && coin.IsSpent())
                 {
-                    newcoin.out.scriptPubKey.assign(1 + (insecure_rand() & 0x3F), OP_RETURN);
-                    BOOST_CHECK(newcoin.out.scriptPubKey.IsUnspendable());
+                    CScript scriptPubKey;
+                    scriptPubKey.assign(1 + (insecure_rand() & 0x3F), OP_RETURN);
+                    newcoin.out.SetScriptPubKey(scriptPubKey);
+                    BOOST_CHECK(newcoin.out.IsUnspendable());
                     added_an_unspendable_entry = true;
                 }
                 else
                 {
                     // Random sizes so we can test memory usage accounting
-                    newcoin.out.scriptPubKey.assign(insecure_rand() & 0x3F, 0);
+                    CScript scriptPubKey;
+                    scriptPubKey.assign(insecure_rand() & 0x3F, 0);
+                    newcoin.out.SetScriptPubKey(scriptPubKey);
                     (coin.IsSpent() ? added_an_entry : updated_an_entry) = true;
                     coin = newcoin;
                 }
@@ -347,7 +351,7 @@ BOOST_AUTO_TEST_CASE(ccoins_serialization)
     BOOST_CHECK_EQUAL(cc1.fCoinBase, false);
     BOOST_CHECK_EQUAL(cc1.nHeight, 100);
     BOOST_CHECK_EQUAL(cc1.out.nValue, 10000ULL);
-    BOOST_CHECK_EQUAL(HexStr(cc1.out.scriptPubKey), HexStr(script1));
+    BOOST_CHECK_EQUAL(HexStr(cc1.out.GetScriptPubKey()), HexStr(script1));
 
     printf("first passed \n");
 
@@ -363,7 +367,7 @@ BOOST_AUTO_TEST_CASE(ccoins_serialization)
     BOOST_CHECK_EQUAL(cc2.fCoinBase, true);
     BOOST_CHECK_EQUAL(cc2.nHeight, 120891);
     BOOST_CHECK_EQUAL(cc2.out.nValue, 110397);
-    BOOST_CHECK_EQUAL(HexStr(cc2.out.scriptPubKey), HexStr(script2));
+    BOOST_CHECK_EQUAL(HexStr(cc2.out.GetScriptPubKey()), HexStr(script2));
 
     // Smallest possible example
     CDataStream ss3(ParseHex("000006"), SER_DISK, CLIENT_VERSION);
@@ -372,7 +376,7 @@ BOOST_AUTO_TEST_CASE(ccoins_serialization)
     BOOST_CHECK_EQUAL(cc3.fCoinBase, false);
     BOOST_CHECK_EQUAL(cc3.nHeight, 0);
     BOOST_CHECK_EQUAL(cc3.out.nValue, 0);
-    BOOST_CHECK_EQUAL(cc3.out.scriptPubKey.size(), 0);
+    BOOST_CHECK_EQUAL(cc3.out.GetScriptPubKey().size(), 0);
 
     // scriptPubKey that ends beyond the end of the stream
     CDataStream ss4(ParseHex("000007"), SER_DISK, CLIENT_VERSION);
@@ -555,6 +559,53 @@ BOOST_AUTO_TEST_CASE(ccoins_access)
     CheckAccessCoin(VALUE1, VALUE2, VALUE2, DIRTY | FRESH, DIRTY | FRESH);
 }
 
+void CheckGetCoins(CAmount base_value,
+    CAmount cache_value,
+    CAmount expected_value,
+    char cache_flags,
+    char expected_flags)
+{
+    SingleEntryCacheTest test(base_value, cache_value, cache_flags);
+    std::vector<COutPoint> outpoints = {OUTPOINT, COutPoint(uint256S("0x1"), 0), OUTPOINT};
+    std::vector<Coin> coins;
+    size_t nFound = test.cache.GetCoins(outpoints, coins);
+    test.cache.SelfTest();
+
+    bool fUnspent = expected_value != ABSENT && expected_value != PRUNED;
+    BOOST_CHECK_EQUAL(coins.size(), outpoints.size());
+    BOOST_CHECK_EQUAL(nFound, fUnspent ? 2 : 0);
+    BOOST_CHECK(coins[1].IsSpent());
+    for (size_t i : {0, 2})
+    {
+        BOOST_CHECK_EQUAL(coins[i].IsSpent(), !fUnspent);
+        if (fUnspent)
+            BOOST_CHECK_EQUAL(coins[i].out.nValue, expected_value);
+    }
+
+    CAmount result_value;
+    char result_flags;
+    GetCoinsMapEntry(test.cache.map(), result_value, result_flags);
+    BOOST_CHECK_EQUAL(result_value, expected_value);
+    BOOST_CHECK_EQUAL(result_flags, expected_flags);
+}
+
+BOOST_AUTO_TEST_CASE(ccoins_getcoins)
+{
+    /* Check GetCoins behavior, requesting a batch of coins from a cache view
+     * layered on top of a base view. Unlike AccessCoin, coins missing from the
+     * cache are only added to it when the base view has them unspent.
+     *
+     *             Base    Cache   Result  Cache          Result
+     *             Value   Value   Value   Flags          Flags
+     */
+    CheckGetCoins(ABSENT, ABSENT, ABSENT, NO_ENTRY, NO_ENTRY);
+    CheckGetCoins(PRUNED, ABSENT, ABSENT, NO_ENTRY, NO_ENTRY);
+    CheckGetCoins(VALUE1, ABSENT, VALUE1, NO_ENTRY, 0);
+    CheckGetCoins(VALUE1, PRUNED, PRUNED, DIRTY, DIRTY);
+    CheckGetCoins(VALUE1, VALUE2, VALUE2, FRESH, FRESH);
+    CheckGetCoins(ABSENT, VALUE2, VALUE2, DIRTY | FRESH, DIRTY | FRESH);
+}
+
 void CheckSpendCoins(CAmount base_value,
     CAmount cache_value,
     CAmount expected_value,
@@ -4,6 +4,9 @@
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 
 #include "compressor.h"
+#include "key.h"
+#include "script/standard.h"
+#include "streams.h"
 #include "test/test_bitcoin.h"
 #include "util/util.h"
 
@@ -65,4 +68,45 @@ BOOST_AUTO_TEST_CASE(compress_amounts)
         BOOST_CHECK(TestDecode(i));
 }
 
+static void CheckCompactTxOut(const CTxOut &txout, bool fInline)
+{
+    CCompactTxOut compact(txout);
+    BOOST_CHECK(compact.GetTxOut() == txout);
+    BOOST_CHECK_EQUAL(compact.IsUnspendable(), txout.scriptPubKey.IsUnspendable());
+    BOOST_CHECK_EQUAL(compact.IsPayToScriptHash(), txout.scriptPubKey.IsPayToScriptHash());
+    BOOST_CHECK_EQUAL(compact.DynamicMemoryUsage() == 0, fInline);
+
+    // The serialization must be identical to CTxOutCompressor
+    CTxOut txoutCopy(txout);
+    CDataStream ssCompressor(SER_DISK, 0);
+    ssCompressor << CTxOutCompressor(txoutCopy);
+    CDataStream ssCompact(SER_DISK, 0);
+    ssCompact << compact;
+    BOOST_CHECK(ssCompressor.str() == ssCompact.str());
+
+    CCompactTxOut compactRead;
+    ssCompact >> compactRead;
+    BOOST_CHECK(compactRead == compact);
+    BOOST_CHECK(compactRead.GetTxOut() == txout);
+}
+
+BOOST_AUTO_TEST_CASE(compact_txout)
+{
+    CKey key;
+    key.MakeNewKey(true);
+    CPubKey pubkey = key.GetPubKey();
+    CKey keyUncompressed;
+    keyUncompressed.MakeNewKey(false);
+    CPubKey pubkeyUncompressed = keyUncompressed.GetPubKey();
+
+    CheckCompactTxOut(CTxOut(COIN, GetScriptForDestination(pubkey.GetID())), true);
+    CheckCompactTxOut(CTxOut(50 * COIN, GetScriptForDestination(CScriptID(CScript() << OP_TRUE))), true);
+    CheckCompactTxOut(CTxOut(12345, CScript() << ToByteVector(pubkey) << OP_CHECKSIG), true);
+    CheckCompactTxOut(CTxOut(0, CScript() << ToByteVector(pubkeyUncompressed) << OP_CHECKSIG), false);
+    CheckCompactTxOut(CTxOut(0, CScript() << OP_RETURN << std::vector<unsigned char>(10, 0x42)), true);
+    CheckCompactTxOut(CTxOut(CENT, CScript() << OP_1 << ToByteVector(pubkey) << ToByteVector(pubkey) << OP_2
+                                             << OP_CHECKMULTISIG),
+        false);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,111 @@
+// Copyright (c) 2018 The Eccoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "cuckoocache.h"
+#include "random.h"
+#include "script/sigcache.h"
+#include "test/test_bitcoin.h"
+
+#include <thread>
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+typedef CuckooCache::cache<uint256, SignatureCacheHasher> cache_type;
+
+std::vector<uint256> RandomHashes(size_t n)
+{
+    std::vector<uint256> hashes;
+    hashes.reserve(n);
+    for (size_t i = 0; i < n; i++)
+        hashes.push_back(GetRandHash());
+    return hashes;
+}
+
+//! Fraction of hashes found in cc
+double HitRate(const cache_type &cc, const std::vector<uint256> &hashes)
+{
+    size_t nHits = 0;
+    for (const uint256 &hash : hashes)
+        nHits += cc.contains(hash, false);
+    return (double)nHits / hashes.size();
+}
+}
+
+BOOST_FIXTURE_TEST_SUITE(cuckoocache_tests, BasicTestingSetup)
+
+BOOST_AUTO_TEST_CASE(cuckoocache_setup)
+{
+    cache_type cc;
+    BOOST_CHECK_EQUAL(cc.setup(0), 2);
+    BOOST_CHECK_EQUAL(cc.setup(1000), 1000);
+    BOOST_CHECK_EQUAL(cc.setup_bytes(1 << 20), (1 << 20) / sizeof(uint256));
+    BOOST_CHECK_EQUAL(cc.capacity(), (1 << 20) / sizeof(uint256));
+    BOOST_CHECK(!cc.contains(GetRandHash(), false));
+}
+
+BOOST_AUTO_TEST_CASE(cuckoocache_fill)
+{
+    // A quarter full, everything fits before a generation is aged
+    cache_type cc;
+    cc.setup(1 << 16);
+    std::vector<uint256> hashes = RandomHashes(1 << 14);
+    for (const uint256 &hash : hashes)
+        cc.insert(hash);
+    BOOST_CHECK_EQUAL(HitRate(cc, hashes), 1.0);
+    BOOST_CHECK(!cc.contains(GetRandHash(), false));
+
+    // Erased entries stay visible until their slot is reused
+    for (const uint256 &hash : hashes)
+        BOOST_CHECK(cc.contains(hash, true));
+    BOOST_CHECK_EQUAL(HitRate(cc, hashes), 1.0);
+    std::vector<uint256> hashes2 = RandomHashes(3 << 13);
+    for (const uint256 &hash : hashes2)
+        cc.insert(hash);
+    BOOST_CHECK(HitRate(cc, hashes2) > 0.99);
+    BOOST_CHECK(HitRate(cc, hashes) < 0.9);
+}
+
+BOOST_AUTO_TEST_CASE(cuckoocache_generations)
+{
+    // Filling the cache several times over keeps the newest entries
+    cache_type cc;
+    cc.setup(1 << 14);
+    std::vector<std::vector<uint256> > generations;
+    for (int i = 0; i < 8; i++)
+    {
+        generations.push_back(RandomHashes(1 << 12));
+        for (const uint256 &hash : generations.back())
+            cc.insert(hash);
+    }
+    BOOST_CHECK(HitRate(cc, generations.back()) > 0.95);
+    BOOST_CHECK(HitRate(cc, generations.front()) < HitRate(cc, generations.back()));
+}
+
+BOOST_AUTO_TEST_CASE(cuckoocache_concurrent_reads)
+{
+    cache_type cc;
+    cc.setup(1 << 14);
+    std::vector<uint256> hashes = RandomHashes(1 << 12);
+    for (const uint256 &hash : hashes)
+        cc.insert(hash);
+
+    // Readers that erase and readers that don't share the cache without a lock
+    std::vector<size_t> vHits(4);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < vHits.size(); t++)
+    {
+        threads.emplace_back([&cc, &hashes, &vHits, t]() {
+            for (const uint256 &hash : hashes)
+                vHits[t] += cc.contains(hash, t % 2);
+        });
+    }
+    for (std::thread &thread : threads)
+        thread.join();
+    for (size_t nHits : vHits)
+        BOOST_CHECK_EQUAL(nHits, hashes.size());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,87 @@
+namespace json_tests{
+static unsigned const char base58_encode_decode[] = {
+  5b 0a 5b 22 22 2c 20 22  22 5d 2c 0a 5b 22 36 31
+   2.590278426644266e-144   1.2527514179025269e-71
+   2.590278426644266e-144   1.2527514179025269e-71
+  22 2c 20 22 32 67 22 5d  2c 0a 5b 22 36 32 36 32
+   4.383077848731936e+140    8.233005352866307e-67
+   4.383077848731936e+140    8.233005352866307e-67
+  36 32 22 2c 20 22 61 33  67 56 22 5d 2c 0a 5b 22
+    3.331900277873848e-61    3.46469153451946e-143
+    3.331900277873848e-61    3.46469153451946e-143
+  36 33 36 33 36 33 22 2c  20 22 61 50 45 72 22 5d
+    4.260336198440202e-96   4.393381444270295e+140
+    4.260336198440202e-96   4.393381444270295e+140
+  2c 0a 5b 22 37 33 36 39  36 64 37 30 36 63 37 39
+    4.275576038119218e-33    4.504277439392919e-33
+    4.275576038119218e-33    4.504277439392919e-33
+  32 30 36 31 32 30 36 63  36 66 36 65 36 37 32 30
+   8.373768167551016e+169   1.5731362891303602e-76
+   8.373768167551016e+169   1.5731362891303602e-76
+  37 33 37 34 37 32 36 39  36 65 36 37 22 2c 20 22
+   4.2748239267574514e-33   2.590278625757907e-144
+   4.2748239267574514e-33   2.590278625757907e-144
+  32 63 46 75 70 6a 68 6e  45 73 53 6e 35 39 71 48
+   7.060531120612847e+223    9.377349860521383e+40
+   7.060531120612847e+223    9.377349860521383e+40
+  58 73 74 6d 4b 32 66 66  70 4c 76 32 22 5d 2c 0a
+  1.8863016056864328e+185   1.152970543310574e-259
+  1.8863016056864328e+185   1.152970543310574e-259
+  5b 22 30 30 65 62 31 35  32 33 31 64 66 63 65 62
+    1.815011507319925e-52    9.85334097563198e+165
+    1.815011507319925e-52    9.85334097563198e+165
+  36 30 39 32 35 38 38 36  62 36 37 64 30 36 35 32
+    1.657169659665877e-47    7.867847869684401e-67
+    1.657169659665877e-47    7.867847869684401e-67
+  39 39 39 32 35 39 31 35  61 65 62 31 37 32 63 30
+   1.7982139588759242e-52   1.3262498191974457e-75
+   1.7982139588759242e-52   1.3262498191974457e-75
+  36 36 34 37 22 2c 20 22  31 4e 53 31 37 69 61 67
+   2.590278625676477e-144   9.696856250046014e+189
+   2.590278625676477e-144   9.696856250046014e+189
+  39 6a 4a 67 54 48 44 31  56 58 6a 76 4c 43 45 6e
+   2.2959019260028346e-71  1.5371951459035213e+223
+   2.2959019260028346e-71  1.5371951459035213e+223
+  5a 75 51 33 72 4a 44 45  39 4c 22 5d 2c 0a 5b 22
+    4.906015627743028e+25   3.464691534518274e-143
+    4.906015627743028e+25   3.464691534518274e-143
+  35 31 36 62 36 66 63 64  30 66 22 2c 20 22 41 42
+  3.8384228613100604e+175       147173955652.79834
+  3.8384228613100604e+175       147173955652.79834
+  6e 4c 54 6d 67 22 5d 2c  0a 5b 22 62 66 34 66 38
+    5.455911516662552e-95    5.220296883828286e-37
+    5.455911516662552e-95    5.220296883828286e-37
+  39 30 30 31 65 36 37 30  32 37 34 64 64 22 2c 20
+   2.0046690341659345e-76  1.0491776321130733e-153
+   2.0046690341659345e-76  1.0491776321130733e-153
+  22 33 53 45 6f 33 4c 57  4c 6f 50 6e 74 43 22 5d
+  3.3910299405509266e+112   4.349826058672955e+140
+  3.3910299405509266e+112   4.349826058672955e+140
+  2c 0a 5b 22 35 37 32 65  34 37 39 34 22 2c 20 22
+   2.952583671931137e+179  2.5902785972230517e-144
+   2.952583671931137e+179  2.5902785972230517e-144
+  33 45 46 55 37 6d 22 5d  2c 0a 5b 22 65 63 61 63
+   4.388678867214803e+140   5.249811774187462e+170
+   4.388678867214803e+140   5.249811774187462e+170
+  38 39 63 61 64 39 33 39  32 33 63 30 32 33 32 31
+    3.702443919796178e-33   1.0300826221117046e-71
+    3.702443919796178e-33   1.0300826221117046e-71
+  22 2c 20 22 45 4a 44 4d  38 64 72 66 58 41 36 75
+    1.669374031732003e+64  4.1770425603975884e+256
+    1.669374031732003e+64  4.1770425603975884e+256
+  79 41 22 5d 2c 0a 5b 22  31 30 63 38 35 31 31 65
+   3.464691534517021e-143   2.786694437912182e+179
+   3.464691534517021e-143   2.786694437912182e+179
+  22 2c 20 22 52 74 35 7a  6d 22 5d 2c 0a 5b 22 30
+   4.868015018569023e+280    7.926113132201827e-77
+   4.868015018569023e+280    7.926113132201827e-77
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 22 2c 20 22 31  31 31 31 31 31 31 31 31
+    5.129383800620535e-72    9.730415951366742e-72
+    5.129383800620535e-72    9.730415951366742e-72
+  31 22 5d 0a 5d 0a
+      5.629740739471e-311
+      5.629740739471e-311
+};};
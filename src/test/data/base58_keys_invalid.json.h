@@ -0,0 +1,792 @@
+namespace json_tests{
+static unsigned const char base58_keys_invalid[] = {
+  5b 0a 20 20 20 20 5b 0a  20 20 20 20 20 20 20 20
+   8.821071308809186e-259   6.013470016999068e-154
+   8.821071308809186e-259   6.013470016999068e-154
+  22 22 0a 20 20 20 20 5d  2c 20 0a 20 20 20 20 5b
+   3.840616274014117e+140   8.942131591061345e+130
+   3.840616274014117e+140   8.942131591061345e+130
+  0a 20 20 20 20 20 20 20  20 22 78 22 0a 20 20 20
+    6.01347001699904e-154   6.013344883322884e-154
+    6.01347001699904e-154   6.013344883322884e-154
+  20 5d 2c 20 0a 20 20 20  20 5b 0a 20 20 20 20 20
+   6.013344832288905e-154   6.013470015108896e-154
+   6.013344832288905e-154   6.013470015108896e-154
+  20 20 20 22 33 37 71 67  65 6b 4c 70 43 43 48 72
+  1.9176089383414214e+190   3.235687047884698e+242
+  1.9176089383414214e+190   3.235687047884698e+242
+  51 75 53 6a 76 58 33 66  73 34 39 36 46 57 54 47
+   2.055032049663075e+184    4.224642782357489e+35
+   2.055032049663075e+184    4.224642782357489e+35
+  73 48 46 48 69 7a 6a 4a  41 73 36 4e 50 63 52 34
+   3.0958309855112387e+50    1.171747401276251e-56
+   3.0958309855112387e+50    1.171747401276251e-56
+  37 61 65 66 6e 6e 43 57  45 43 41 68 48 56 36 45
+  2.3365327231126097e+112   2.7003827226981555e+25
+  2.3365327231126097e+112   2.7003827226981555e+25
+  33 67 34 59 4e 37 75 37  59 75 77 6f 64 35 59 22
+   1.5221761650518634e-41   3.230056920540088e-143
+   1.5221761650518634e-41   3.230056920540088e-143
+  0a 20 20 20 20 5d 2c 20  0a 20 20 20 20 5b 0a 20
+  1.0577333593336978e-153   2.457146526467208e-154
+  1.0577333593336978e-153   2.457146526467208e-154
+  20 20 20 20 20 20 20 22  64 7a 62 37 56 56 31 55
+  2.5827657058487563e-144    2.42693883614496e+102
+  2.5827657058487563e-144    2.42693883614496e+102
+  69 35 35 42 41 52 78 76  37 41 54 78 41 74 43 55
+   4.786556269164899e+262   5.446533991004374e+102
+   4.786556269164899e+262   5.446533991004374e+102
+  65 4a 73 41 4e 4b 6f 76  44 47 57 46 56 67 70 54
+  3.0794246277014436e+262    5.606080884105562e+98
+  3.0794246277014436e+262    5.606080884105562e+98
+  62 68 71 39 67 76 50 71  50 33 79 76 22 0a 20 20
+   6.699967741649878e+237   5.981435759001082e-154
+   6.699967741649878e+237   5.981435759001082e-154
+  20 20 5d 2c 20 0a 20 20  20 20 5b 0a 20 20 20 20
+    5.98142273119716e-154   6.013469533114908e-154
+    5.98142273119716e-154   6.013469533114908e-154
+  20 20 20 20 22 4d 75 4e  75 37 5a 41 45 44 46 69
+    9.188511438096831e+69  1.3315658644699502e+199
+    9.188511438096831e+69  1.3315658644699502e+199
+  48 74 68 69 75 6e 6d 37  64 50 6a 77 4b 71 72 56
+   1.0558025321258726e-41  2.7070707671426563e+108
+   1.0558025321258726e-41  2.7070707671426563e+108
+  4e 43 4d 33 6d 41 7a 36  72 50 39 7a 46 76 65 51
+    2.874366675500537e-46   1.3029245258140186e+84
+    2.874366675500537e-46   1.3029245258140186e+84
+  75 31 34 59 41 38 43 78  45 78 53 4a 54 48 63 56
+   2.030737460590054e+271  1.4151830404844762e+108
+   2.030737460590054e+271  1.4151830404844762e+108
+  50 39 44 45 72 6e 36 75  38 34 45 36 45 6a 37 53
+   4.210108667670988e+256    7.631590233668972e+92
+   4.210108667670988e+256    7.631590233668972e+92
+  22 0a 20 20 20 20 5d 2c  20 0a 20 20 20 20 5b 0a
+   5.4542447507882475e-95   8.821071308809118e-259
+   5.4542447507882475e-95   8.821071308809118e-259
+  20 20 20 20 20 20 20 20  22 72 50 70 51 70 59 6b
+   6.013470016999068e-154  1.3067504251659484e+209
+   6.013470016999068e-154  1.3067504251659484e+209
+  6e 79 4e 51 35 41 45 48  75 59 36 48 38 69 6a 4a
+    1.446521273178357e+40   3.0879793387079872e+50
+    1.446521273178357e+40   3.0879793387079872e+50
+  4a 72 59 63 32 6e 44 4b  4b 6b 39 6a 6a 6d 4b 45
+    3.913697908912549e+54    6.631539617073321e+25
+    3.913697908912549e+54    6.631539617073321e+25
+  58 73 57 7a 79 41 51 63  46 47 70 44 4c 55 32 5a
+   2.604903572271799e+170    3.10253260285749e+126
+   2.604903572271799e+170    3.10253260285749e+126
+  76 73 6d 6f 69 38 4a 4c  52 37 68 41 77 6f 79 33
+    3.291757196332997e+59    9.892810403976293e-61
+    3.291757196332997e+59    9.892810403976293e-61
+  52 51 57 66 22 0a 20 20  20 20 5d 2c 20 0a 20 20
+   5.981435400417758e-154    5.98142273119716e-154
+   5.981435400417758e-154    5.98142273119716e-154
+  20 20 5b 0a 20 20 20 20  20 20 20 20 22 34 55 63
+   6.013469533114908e-154   3.200870487702727e+170
+   6.013469533114908e-154   3.200870487702727e+170
+  33 46 6d 4e 36 4e 51 36  7a 4c 42 4b 35 51 51 42
+    4.736365860203511e-47       297507564809.19495
+    4.736365860203511e-47       297507564809.19495
+  58 52 42 55 52 45 61 61  48 77 43 5a 59 73 47 43
+   1.214059130667899e+161    1.320150413599912e+16
+   1.214059130667899e+161    1.320150413599912e+16
+  75 65 48 61 75 75 44 6d  4a 70 5a 4b 6e 36 6a 6b
+   2.256874993347289e+218  2.6930067567548893e+209
+   2.256874993347289e+218  2.6930067567548893e+209
+  45 73 6b 4d 42 32 5a 69  32 43 4e 67 74 62 35 72
+  3.1331234227968047e+199   1.425927459396456e+242
+  3.1331234227968047e+199   1.425927459396456e+242
+  36 65 70 57 45 46 66 55  4a 71 22 0a 20 20 20 20
+  2.4944592166790083e+103   6.013469528193325e-154
+  2.4944592166790083e+103   6.013469528193325e-154
+  5d 2c 20 0a 20 20 20 20  5b 0a 20 20 20 20 20 20
+   6.013469527996294e-154   6.013470016991685e-154
+   6.013469527996294e-154   6.013470016991685e-154
+  20 20 22 37 61 51 67 52  35 44 46 51 32 35 76 79
+     9.27722267310752e+88  1.2302164980516436e+277
+     9.27722267310752e+88  1.2302164980516436e+277
+  58 6d 71 5a 41 57 6d 6e  56 43 6a 4c 33 50 6b 42
+   8.484755910374868e+223        938477249362.1042
+   8.484755910374868e+223        938477249362.1042
+  63 64 56 6b 42 55 70 6a  72 6a 4d 54 63 67 68 48
+   5.120875534699488e+204    6.643362429530626e+40
+   5.120875534699488e+204    6.643362429530626e+40
+  78 33 45 38 77 62 22 0a  20 20 20 20 5d 2c 20 0a
+   7.473235764475847e-260   6.574341888680965e-260
+   7.473235764475847e-260   6.574341888680965e-260
+  20 20 20 20 5b 0a 20 20  20 20 20 20 20 20 22 31
+   5.981758184651215e-154    5.129331948815817e-72
+   5.981758184651215e-154    5.129331948815817e-72
+  37 51 70 50 70 72 6a 65  67 36 39 66 57 31 44 56
+  3.4294483529653075e+180  3.7049616733241474e+107
+  3.4294483529653075e+180  3.7049616733241474e+107
+  38 44 63 59 59 43 4b 76  57 6a 59 68 58 76 57 6b
+   6.706890268575406e+261  1.2052228077634276e+209
+   6.706890268575406e+261  1.2052228077634276e+209
+  6f 76 36 4d 4a 31 69 54  54 76 4d 46 6a 36 77 65
+    4.304875107802731e+98   6.020054716894691e+180
+    4.304875107802731e+98   6.020054716894691e+180
+  41 71 57 37 77 79 62 5a  65 48 35 37 57 54 4e 78
+   2.501153217896185e+127  3.2045771268532007e+271
+   2.501153217896185e+127  3.2045771268532007e+271
+  58 56 43 52 48 34 76 65  56 73 22 0a 20 20 20 20
+   5.758549500338783e+180   6.013469528194019e-154
+   5.758549500338783e+180   6.013469528194019e-154
+  5d 2c 20 0a 20 20 20 20  5b 0a 20 20 20 20 20 20
+   6.013469527996294e-154   6.013470016991685e-154
+   6.013469527996294e-154   6.013470016991685e-154
+  20 20 22 4b 78 75 41 43  44 76 69 7a 38 58 76 70
+         9828468242268224   5.550466250735334e+233
+         9828468242268224   5.550466250735334e+233
+  6e 31 78 41 68 39 4d 66  6f 70 79 53 5a 4e 75 79
+    6.20884317136077e+184  1.1802643555361528e+277
+    6.20884317136077e+184  1.1802643555361528e+277
+  61 6a 59 4d 5a 57 7a 31  36 44 76 32 6d 48 48 72
+    2.385376498192473e-70  3.2383767159841464e+242
+    2.385376498192473e-70  3.2383767159841464e+242
+  79 7a 6e 57 55 70 33 22  0a 20 20 20 20 5d 2c 20
+   6.226895566726384e-144  1.0577333593336978e-153
+   6.226895566726384e-144  1.0577333593336978e-153
+  0a 20 20 20 20 5b 0a 20  20 20 20 20 20 20 20 22
+   2.457146526467208e-154  2.5827657058487563e-144
+   2.457146526467208e-154  2.5827657058487563e-144
+  37 6e 4b 33 47 53 6d 71  64 58 4a 51 74 64 6f 68
+  2.3869819116007568e+238   1.145807681823041e+195
+  2.3869819116007568e+238   1.145807681823041e+195
+  76 47 66 4a 37 4b 73 53  6d 6e 33 54 6d 47 71 45
+   1.0061360644102443e+94    3.342246994584162e+26
+   1.0061360644102443e+94    3.342246994584162e+26
+  78 75 67 34 39 35 38 33  62 44 41 4c 39 31 70 56
+       5.884615516086e-62  2.3767662734247916e+108
+       5.884615516086e-62  2.3767662734247916e+108
+  53 47 71 35 78 53 39 53  48 6f 41 59 4c 33 57 76
+    8.254412972704705e+92  1.1414881655055453e+262
+    8.254412972704705e+92  1.1414881655055453e+262
+  33 69 6a 4b 54 69 74 36  35 74 68 22 0a 20 20 20
+    2.234572109894549e-46   6.013344881961499e-154
+    2.234572109894549e-46   6.013344881961499e-154
+  20 5d 2c 20 0a 20 20 20  20 5b 0a 20 20 20 20 20
+   6.013344832288905e-154   6.013470015108896e-154
+   6.013344832288905e-154   6.013470015108896e-154
+  20 20 20 22 63 54 69 76  64 42 6d 71 37 62 61 79
+  2.4925002918277045e+262   4.814899361137796e+276
+  2.4925002918277045e+262   4.814899361137796e+276
+  33 52 46 47 45 42 42 75  4e 66 4d 68 32 50 31 70
+    6.85393854162981e+256  2.6879163602116364e+232
+    6.85393854162981e+256  2.6879163602116364e+232
+  44 43 67 52 59 4e 32 57  62 78 6d 67 77 72 34 6b
+  1.1006089981385715e+112  2.6258473159260317e+208
+  1.1006089981385715e+112  2.6258473159260317e+208
+  69 33 6a 4e 55 4c 32 76  61 22 0a 20 20 20 20 5d
+  2.2507334745074785e+261    3.84061627401417e+140
+  2.2507334745074785e+261    3.84061627401417e+140
+  2c 20 0a 20 20 20 20 5b  0a 20 20 20 20 20 20 20
+   8.942131591061345e+130    6.01347001699904e-154
+   8.942131591061345e+130    6.01347001699904e-154
+  20 22 67 6a 4d 56 34 76  6a 4e 6a 79 4d 72 6e 61
+   2.501529786886341e+261   2.140252419341815e+161
+   2.501529786886341e+261   2.140252419341815e+161
+  34 66 73 41 72 38 62 57  78 41 62 77 74 6d 4d 55
+   8.763720629531706e+112   8.238777396092811e+102
+   8.763720629531706e+112   8.238777396092811e+102
+  42 58 4a 53 33 7a 4c 34  4e 4a 74 35 71 6a 6f 7a
+    9.073405805165968e-57   5.702613625248363e+281
+    9.073405805165968e-57   5.702613625248363e+281
+  70 62 51 4c 6d 41 66 4b  31 75 41 33 43 71 75 53
+   1.7053283962499892e+55   1.1181825197774916e+94
+   1.7053283962499892e+55   1.1181825197774916e+94
+  71 73 5a 51 4d 70 6f 44  31 67 32 6e 6b 22 0a 20
+   4.6395302387150115e+21  2.4364955754915008e-154
+   4.6395302387150115e+21  2.4364955754915008e-154
+  20 20 20 5d 2c 20 0a 20  20 20 20 5b 0a 20 20 20
+  2.4356775054076983e-154    6.01334614265396e-154
+  2.4356775054076983e-154    6.01334614265396e-154
+  20 20 20 20 20 22 65 6d  58 6d 31 6e 61 42 4d 6f
+   9.325115907395546e+218  1.3862790322976878e+228
+   9.325115907395546e+218  1.3862790322976878e+228
+  56 7a 50 6a 62 6b 37 78  70 65 54 56 4d 46 79 34
+  1.2372378159855297e+271    6.442366209850912e-56
+  1.2372378159855297e+271    6.442366209850912e-56
+  6f 44 45 65 32 35 55 6d  6f 79 47 67 4b 45 42 31
+   4.678994052400807e+218   2.0681678883612046e-71
+   4.678994052400807e+218   2.0681678883612046e-71
+  67 47 57 73 4b 38 6b 52  47 73 22 0a 20 20 20 20
+   1.0829671521064972e+89   6.013469528193999e-154
+   1.0829671521064972e+89   6.013469528193999e-154
+  5d 2c 20 0a 20 20 20 20  5b 0a 20 20 20 20 20 20
+   6.013469527996294e-154   6.013470016991685e-154
+   6.013469527996294e-154   6.013470016991685e-154
+  20 20 22 37 56 54 68 51  6e 4e 52 6a 31 6f 33 5a
+   1.4770014783223756e+84   3.288881047431389e+126
+   1.4770014783223756e+84   3.288881047431389e+126
+  79 76 63 37 58 48 50 52  72 6a 44 66 38 6a 32 6f
+   3.2390853508392645e+88   4.362411691607801e+227
+   3.2390853508392645e+88   4.362411691607801e+227
+  69 76 50 54 65 44 58 6e  52 50 59 57 65 59 47 45
+   3.508778501288639e+223    5.645490776682716e+25
+   3.508778501288639e+223    5.645490776682716e+25
+  34 70 58 65 52 4a 44 5a  67 66 32 38 70 70 74 69
+   6.867474937298946e+126      9.778253533776e+199
+   6.867474937298946e+126      9.778253533776e+199
+  35 68 73 48 57 58 53 32  47 53 6f 62 64 71 79 6f
+    2.870195860828491e-66   9.643706435596066e+228
+    2.870195860828491e-66   9.643706435596066e+228
+  22 0a 20 20 20 20 5d 2c  20 0a 20 20 20 20 5b 0a
+   5.4542447507882475e-95   8.821071308809118e-259
+   5.4542447507882475e-95   8.821071308809118e-259
+  20 20 20 20 20 20 20 20  22 31 47 39 75 36 6f 43
+   6.013470016999068e-154    7.028481102456654e+16
+   6.013470016999068e-154    7.028481102456654e+16
+  56 43 50 68 32 6f 38 6d  33 74 35 35 41 43 69 59
+  1.3477144906558149e+218   5.218771158595245e+122
+  1.3477144906558149e+218   5.218771158595245e+122
+  76 47 31 79 35 42 48 65  77 55 6b 44 53 64 69 51
+   7.864184092907969e+179   1.5415014254497363e+84
+   7.864184092907969e+179   1.5415014254497363e+84
+  61 72 44 63 59 58 58 68  46 48 59 64 7a 4d 64 59
+  4.4429254688665115e+194   4.194120991818005e+122
+  4.4429254688665115e+194   4.194120991818005e+122
+  66 55 41 68 66 78 6e 35  76 4e 5a 42 77 70 67 55
+   2.5449992578447813e-51   2.624904658607417e+103
+   2.5449992578447813e-51   2.624904658607417e+103
+  4e 70 73 6f 22 0a 20 20  20 20 5d 2c 20 0a 20 20
+   5.981435602907697e-154    5.98142273119716e-154
+   5.981435602907697e-154    5.98142273119716e-154
+  20 20 5b 0a 20 20 20 20  20 20 20 20 22 33 31 51
+   6.013469533114908e-154   1.3052108910325327e+83
+   6.013469533114908e-154   1.3052108910325327e+83
+  51 37 5a 4d 4c 6b 53 63  44 69 42 34 56 79 5a 6a
+  2.9314831348915477e+170   2.075086363836388e+204
+  2.9314831348915477e+170   2.075086363836388e+204
+  75 70 74 72 37 41 45 63  39 6a 31 53 6a 73 74 46
+  1.6042927309922843e+170   2.5924521046713332e+31
+  1.6042927309922843e+170   2.5924521046713332e+31
+  37 70 52 6f 4c 68 48 54  47 6b 57 34 51 32 79 39
+   1.0426784960825504e+98     7.76428690984188e-32
+   1.0426784960825504e+98     7.76428690984188e-32
+  58 45 4c 6f 62 51 6d 68  68 57 78 65 52 76 71 63
+  1.0700897232130381e+195  1.0544266705973456e+171
+  1.0700897232130381e+195  1.0544266705973456e+171
+  75 6b 47 64 31 58 43 71  22 0a 20 20 20 20 5d 2c
+   3.936444994715041e+237   5.4542447507882475e-95
+   3.936444994715041e+237   5.4542447507882475e-95
+  20 0a 20 20 20 20 5b 0a  20 20 20 20 20 20 20 20
+   8.821071308809118e-259   6.013470016999068e-154
+   8.821071308809118e-259   6.013470016999068e-154
+  22 44 48 71 4b 53 6e 70  78 61 38 5a 64 51 79 48
+  3.7664548354441494e+233    1.378439632040272e+41
+  3.7664548354441494e+233    1.378439632040272e+41
+  38 6b 65 41 68 76 4c 54  72 66 6b 79 42 4d 51 78
+   1.2159118296783298e+98   3.656177590801384e+271
+   1.2159118296783298e+98   3.656177590801384e+271
+  71 6e 67 63 51 41 35 4e  38 4c 51 39 4b 56 74 32
+    5.730376601720213e+68   1.2069510716267269e-65
+    5.730376601720213e+68   1.2069510716267269e-65
+  35 6b 6d 47 4e 22 0a 20  20 20 20 5d 2c 20 0a 20
+   2.436454105651164e-154  2.4356775054076983e-154
+   2.436454105651164e-154  2.4356775054076983e-154
+  20 20 20 5b 0a 20 20 20  20 20 20 20 20 22 32 4c
+    6.01334614265396e-154    1.138245858218459e+59
+    6.01334614265396e-154    1.138245858218459e+59
+  55 48 63 4a 50 62 77 4c  43 79 39 47 4c 48 31 71
+    2.348543731703429e+60   1.758413473644344e+237
+    2.348543731703429e+60   1.758413473644344e+237
+  58 6d 66 6d 41 77 76 61  64 57 77 34 62 70 34 50
+  3.1584964654351174e+161    2.366674336908245e+78
+  3.1584964654351174e+161    2.366674336908245e+78
+  43 70 44 66 64 75 4c 71  56 31 37 73 36 69 44 63
+    5.79108002685813e+237  1.5406059667740632e+170
+    5.79108002685813e+237  1.5406059667740632e+170
+  79 31 69 6d 55 77 68 51  4a 68 41 6f 4e 6f 4e 31
+     1.48530072534587e+84    3.445096202563375e-71
+     1.48530072534587e+84    3.445096202563375e-71
+  58 4e 6d 77 65 69 4a 50  34 69 22 0a 20 20 20 20
+    6.116532890159413e+78   6.013469528190582e-154
+    6.116532890159413e+78   6.013469528190582e-154
+  5d 2c 20 0a 20 20 20 20  5b 0a 20 20 20 20 20 20
+   6.013469527996294e-154   6.013470016991685e-154
+   6.013469527996294e-154   6.013470016991685e-154
+  20 20 22 37 55 53 52 7a  42 58 41 6e 6d 63 6b 38
+  1.6632297765567482e+281   6.4389791989654156e-37
+  1.6632297765567482e+281   6.4389791989654156e-37
+  66 58 39 48 6d 57 37 52  41 62 34 71 74 39 32 56
+    1.160827592395792e+88   1.671908476072562e+107
+    1.160827592395792e+88   1.671908476072562e+107
+  46 58 36 73 6f 43 6e 74  73 39 73 37 34 77 78 6d
+  6.9336892704175925e+252   2.159103447342143e+219
+  6.9336892704175925e+252   2.159103447342143e+219
+  34 67 67 75 56 68 74 47  35 6f 66 38 66 5a 47 62
+   1.6953945236192868e+36  2.6896303071499347e+165
+   1.6953945236192868e+36  2.6896303071499347e+165
+  4e 50 4a 41 38 33 69 72  48 56 59 36 62 43 6f 73
+  1.3442758243024806e+243  1.0929495579728624e+248
+  1.3442758243024806e+243  1.0929495579728624e+248
+  22 0a 20 20 20 20 5d 2c  20 0a 20 20 20 20 5b 0a
+   5.4542447507882475e-95   8.821071308809118e-259
+   5.4542447507882475e-95   8.821071308809118e-259
+  20 20 20 20 20 20 20 20  22 31 44 47 65 7a 6f 37
+   6.013470016999068e-154    1.129221740539014e-41
+   6.013470016999068e-154    1.129221740539014e-41
+  42 66 56 65 62 5a 78 41  62 4e 54 33 58 47 75 6a
+       25536038.333593614   6.671476305302012e+204
+       25536038.333593614   6.671476305302012e+204
+  64 65 48 79 4e 4e 42 46  33 76 6e 66 69 63 59 6f
+    2.900683249957138e+30  2.4057517727414682e+228
+    2.900683249957138e+30  2.4057517727414682e+228
+  54 53 70 34 50 66 4b 32  51 61 4d 4c 39 62 48 7a
+   2.0326198465447617e-66  1.1065354785479511e+281
+   2.0326198465447617e-66  1.1065354785479511e+281
+  41 4d 78 6b 65 33 77 64  4b 64 48 59 57 6d 73 4d
+   9.181207746929357e+175   1.2786961905853346e+65
+   9.181207746929357e+175   1.2786961905853346e+65
+  54 4a 56 75 22 0a 20 20  20 20 5d 2c 20 0a 20 20
+   5.981435733742373e-154    5.98142273119716e-154
+   5.981435733742373e-154    5.98142273119716e-154
+  20 20 5b 0a 20 20 20 20  20 20 20 20 22 32 44 31
+   6.013469533114908e-154   2.2860873039047915e-71
+   6.013469533114908e-154   2.2860873039047915e-71
+  32 44 71 44 5a 4b 77 43  78 78 6b 7a 73 31 5a 41
+   1.0490840850813827e+17        6866381.912809484
+   1.0490840850813827e+17        6866381.912809484
+  54 4a 57 76 67 4a 47 68  51 34 63 46 69 33 57 72
+   2.125243349243155e+194   6.188137469735036e+242
+   2.125243349243155e+194   6.188137469735036e+242
+  69 7a 51 35 7a 4c 41 79  68 4e 35 48 78 75 41 4a
+   1.197844674066952e+276    5.103232426891867e+49
+   1.197844674066952e+276    5.103232426891867e+49
+  31 79 4d 59 61 4a 70 38  47 75 59 73 54 4c 4c 78
+    7.659778823238568e-37  2.9899530156540788e+271
+    7.659778823238568e-37  2.9899530156540788e+271
+  54 41 7a 36 6f 74 43 66  62 22 0a 20 20 20 20 5d
+   4.133278037275287e+184   3.840616274014171e+140
+   4.133278037275287e+184   3.840616274014171e+140
+  2c 20 0a 20 20 20 20 5b  0a 20 20 20 20 20 20 20
+   8.942131591061345e+130    6.01347001699904e-154
+   8.942131591061345e+130    6.01347001699904e-154
+  20 22 38 41 46 4a 7a 75  54 75 6a 58 6a 77 31 5a
+   7.894945088394097e+257  2.9558558467913454e+126
+   7.894945088394097e+257  2.9558558467913454e+126
+  36 4d 33 66 57 68 51 31  75 6a 44 57 37 7a 73 56
+    3.940937266904926e-71   2.858969974293862e+108
+    3.940937266904926e-71   2.858969974293862e+108
+  34 65 50 65 56 6a 56 6f  37 44 31 65 67 45 52 71
+  2.1240407854919005e+228   7.436036260705029e+237
+  2.1240407854919005e+228   7.436036260705029e+237
+  53 57 39 6e 5a 22 0a 20  20 20 20 5d 2c 20 0a 20
+  2.4364713920269074e-154  2.4356775054076983e-154
+  2.4364713920269074e-154  2.4356775054076983e-154
+  20 20 20 5b 0a 20 20 20  20 20 20 20 20 22 31 36
+    6.01334614265396e-154    1.172308142423191e-47
+    6.01334614265396e-154    1.172308142423191e-47
+  33 51 31 37 71 4c 62 54  43 75 65 38 59 59 33 41
+    3.126846222859869e+98        1268057.220298127
+    3.126846222859869e+98        1268057.220298127
+  76 6a 70 55 68 6f 74 75  61 6f 64 4c 6d 32 75 71
+   6.136700038706343e+257   3.450726814358375e+238
+   6.136700038706343e+257   3.450726814358375e+238
+  4d 68 70 59 69 72 73 4b  6a 56 71 6e 78 4a 52 57
+    2.980231818945561e+55   4.398792483879583e+112
+    2.980231818945561e+55   4.398792483879583e+112
+  54 45 6f 79 77 4d 56 59  33 4e 62 42 41 48 75 68
+  2.3036358877318474e+122  1.5535837211543932e+195
+  2.3036358877318474e+122  1.5535837211543932e+195
+  41 4a 32 63 46 39 47 41  5a 22 0a 20 20 20 20 5d
+       3043980.7749722307  3.8406162740141645e+140
+       3043980.7749722307  3.8406162740141645e+140
+  2c 20 0a 20 20 20 20 5b  0a 20 20 20 20 20 20 20
+   8.942131591061345e+130    6.01347001699904e-154
+   8.942131591061345e+130    6.01347001699904e-154
+  20 22 32 4d 6e 6d 67 69  52 48 34 65 47 4c 79 4c
+  5.6039264628224276e+199   2.5407663404211173e+60
+  5.6039264628224276e+199   2.5407663404211173e+60
+  63 39 65 41 71 53 74 7a  6b 37 64 46 67 42 6a 46
+   7.379156911081317e+281   1.6643864702342587e+31
+   7.379156911081317e+281   1.6643864702342587e+31
+  74 55 43 74 75 22 0a 20  20 20 20 5d 2c 20 0a 20
+  2.4365098348563874e-154  2.4356775054076983e-154
+  2.4365098348563874e-154  2.4356775054076983e-154
+  20 20 20 5b 0a 20 20 20  20 20 20 20 20 22 34 36
+    6.01334614265396e-154   1.3775764721582717e-47
+    6.01334614265396e-154   1.3775764721582717e-47
+  31 51 51 32 73 59 57 78  55 37 48 32 50 56 34 6f
+   4.934147090662657e+271   4.817781175125435e+227
+   4.934147090662657e+271   4.817781175125435e+227
+  42 77 4a 47 4e 63 68 38  58 56 54 59 59 62 5a 78
+    5.733570835418786e-37  5.5754463254414875e+271
+    5.733570835418786e-37  5.5754463254414875e+271
+  55 22 0a 20 20 20 20 5d  2c 20 0a 20 20 20 20 5b
+    3.84061627401416e+140   8.942131591061345e+130
+    3.84061627401416e+140   8.942131591061345e+130
+  0a 20 20 20 20 20 20 20  20 22 32 55 43 74 76 35
+    6.01347001699904e-154     3.75091663593838e-51
+    6.01347001699904e-154     3.75091663593838e-51
+  33 56 74 74 6d 51 59 6b  56 55 34 56 4d 74 58 42
+   1.300551978767109e+209        420121762001.3334
+   1.300551978767109e+209        420121762001.3334
+  33 31 52 45 76 51 67 34  41 42 7a 73 34 31 41 45
+    2.971844255766905e-56     4.15682048856745e+25
+    2.971844255766905e-56     4.15682048856745e+25
+  4b 5a 38 55 63 42 37 44  41 66 56 7a 64 6b 56 39
+    4.290588746250387e+20   1.7271356034998142e-32
+    4.290588746250387e+20   1.7271356034998142e-32
+  4a 44 45 72 77 47 77 79  6a 35 41 55 48 4c 6b 6d
+  1.2895656372629025e+277  1.2045292645930752e+219
+  1.2895656372629025e+277  1.2045292645930752e+219
+  67 5a 65 6f 62 73 22 0a  20 20 20 20 5d 2c 20 0a
+    7.50010056350584e-260   6.574341888680965e-260
+    7.50010056350584e-260   6.574341888680965e-260
+  20 20 20 20 5b 0a 20 20  20 20 20 20 20 20 22 63
+   5.981758184651215e-154  3.4202459465735615e+169
+   5.981758184651215e-154  3.4202459465735615e+169
+  53 4e 6a 41 73 6e 68 67  74 69 46 4d 69 36 4d 74
+   1.360681424642337e+190  1.6732304976296842e+252
+   1.360681424642337e+190  1.6732304976296842e+252
+  66 76 67 73 63 4d 42 32  43 62 68 6e 32 76 31 46
+   1.3577399818109448e-66   1.3834589615782482e+30
+   1.3577399818109448e-66   1.3834589615782482e+30
+  55 59 66 76 69 4a 31 43  64 6a 66 69 64 76 6d 65
+         4866891422521685   3.820468017406155e+180
+         4866891422521685   3.820468017406155e+180
+  57 36 6d 6e 22 0a 20 20  20 20 5d 2c 20 0a 20 20
+    5.98143558013949e-154    5.98142273119716e-154
+    5.98143558013949e-154    5.98142273119716e-154
+  20 20 5b 0a 20 20 20 20  20 20 20 20 22 67 6d 73
+   6.013469533114908e-154  1.0279123660920434e+248
+   6.013469533114908e-154  1.0279123660920434e+248
+  6f 77 32 59 36 45 57 41  46 44 46 45 31 43 45 34
+        6100185.393705233    6.774613971884266e-57
+        6100185.393705233    6.774613971884266e-57
+  48 64 33 54 70 75 32 42  76 66 6d 42 66 47 31 53
+        79279707187.39172    5.631639887244144e+92
+        79279707187.39172    5.631639887244144e+92
+  58 73 75 52 41 52 62 6e  74 31 57 6a 6b 5a 6e 46
+   5.298138421748105e+223   1.9238627068430619e+31
+   5.298138421748105e+223   1.9238627068430619e+31
+  68 31 71 47 54 69 70 74  57 57 62 6a 73 71 32 51
+   7.520091482607993e+252    1.399569042512567e+83
+   7.520091482607993e+252    1.399569042512567e+83
+  36 71 76 70 67 4a 56 6a  22 0a 20 20 20 20 5d 2c
+  1.7471879757745333e+204   5.4542447507882475e-95
+  1.7471879757745333e+204   5.4542447507882475e-95
+  20 0a 20 20 20 20 5b 0a  20 20 20 20 20 20 20 20
+   8.821071308809118e-259   6.013470016999068e-154
+   8.821071308809118e-259   6.013470016999068e-154
+  22 6e 6b 73 55 4b 53 6b  7a 53 37 36 76 38 45 73
+   9.911181263430935e+208   1.854655152822767e+247
+   9.911181263430935e+208   1.854655152822767e+247
+  53 67 6f 7a 58 47 4d 6f  51 46 69 43 6f 43 48 7a
+  1.3871979332353654e+228  1.1010775934885949e+281
+  1.3871979332353654e+228  1.1010775934885949e+281
+  43 56 61 6a 46 4b 41 58  71 7a 4b 35 6f 6e 39 5a
+  1.3628399951262438e+117   4.303761524141402e+126
+  1.3628399951262438e+117   4.303761524141402e+126
+  4a 59 56 48 4d 44 35 43  4b 77 67 6d 58 33 53 33
+         5986073227712842     1.86695981693944e-61
+         5986073227712842     1.86695981693944e-61
+  63 37 4d 31 55 33 78 61  62 55 6e 79 22 0a 20 20
+   3.402376479690288e+161   5.981435824740308e-154
+   3.402376479690288e+161   5.981435824740308e-154
+  20 20 5d 2c 20 0a 20 20  20 20 5b 0a 20 20 20 20
+    5.98142273119716e-154   6.013469533114908e-154
+    5.98142273119716e-154   6.013469533114908e-154
+  20 20 20 20 22 4c 33 66  61 76 4b 31 55 7a 46 47
+  2.0499160051884856e+184   2.3342346901843874e+35
+  2.0499160051884856e+184   2.3342346901843874e+35
+  67 64 7a 59 42 46 32 6f  42 54 35 74 62 61 79 43
+   4.329134234219093e+227   1.1430319843372342e+17
+   4.329134234219093e+227   1.1430319843372342e+17
+  6f 34 76 74 56 42 4c 4a  68 67 32 69 59 75 4d 65
+    8.260153449094982e+49   9.549849295245721e+179
+    8.260153449094982e+49   9.549849295245721e+179
+  65 50 78 57 47 38 53 51  63 22 0a 20 20 20 20 5d
+    5.834028521532587e+83   3.840616274014172e+140
+    5.834028521532587e+83   3.840616274014172e+140
+  2c 20 0a 20 20 20 20 5b  0a 20 20 20 20 20 20 20
+   8.942131591061345e+130    6.01347001699904e-154
+   8.942131591061345e+130    6.01347001699904e-154
+  20 22 37 56 78 4c 78 47  47 74 59 54 36 4e 39 39
+   2.0186579487452483e+36    4.873665198982474e-33
+   2.0186579487452483e+36    4.873665198982474e-33
+  47 64 45 66 69 36 78 7a  35 36 78 64 51 38 6e 50
+   8.790152576982936e+281   2.7993888037343462e+79
+   8.790152576982936e+281   2.7993888037343462e+79
+  32 64 47 31 43 61 76 75  58 78 37 52 66 32 50 72
+   6.720708502392775e+257   4.320039529831949e+242
+   6.720708502392775e+257   4.320039529831949e+242
+  76 4e 4d 54 42 4e 65 76  6a 6b 66 67 73 39 4a 6d
+  2.0965346290303133e+262  2.8928953186714047e+218
+  2.0965346290303133e+262  2.8928953186714047e+218
+  6b 63 47 6d 36 45 58 70  6a 38 69 70 79 50 5a 22
+  1.5072070282056261e+233  3.3717453650815906e-143
+  1.5072070282056261e+233  3.3717453650815906e-143
+  0a 20 20 20 20 5d 2c 20  0a 20 20 20 20 5b 0a 20
+  1.0577333593336978e-153   2.457146526467208e-154
+  1.0577333593336978e-153   2.457146526467208e-154
+  20 20 20 20 20 20 20 22  32 6d 62 5a 77 46 58 46
+  2.5827657058487563e-144     7.69313656012402e+30
+  2.5827657058487563e-144     7.69313656012402e+30
+  36 63 78 53 68 61 43 6f  32 63 7a 54 52 42 36 32
+   9.182304076852174e+227    8.256347473828802e-67
+   9.182304076852174e+227    8.256347473828802e-67
+  57 54 78 39 4c 78 68 54  74 70 50 22 0a 20 20 20
+    4.181393371017623e+98    6.01334487987639e-154
+    4.181393371017623e+98    6.01334487987639e-154
+  20 5d 2c 20 0a 20 20 20  20 5b 0a 20 20 20 20 20
+   6.013344832288905e-154   6.013470015108896e-154
+   6.013344832288905e-154   6.013470015108896e-154
+  20 20 20 22 64 42 37 63  77 59 64 63 50 53 67 69
+    8.77798767445837e+169   5.579523196911415e+199
+    8.77798767445837e+169   5.579523196911415e+199
+  79 41 77 4b 57 4c 33 4a  77 43 56 77 53 6b 36 65
+   2.8204361146704114e+49   3.633945122767305e+179
+   2.8204361146704114e+49   3.633945122767305e+179
+  70 55 32 74 78 77 22 0a  20 20 20 20 5d 2c 20 0a
+   7.506588600097213e-260   6.574341888680965e-260
+   7.506588600097213e-260   6.574341888680965e-260
+  20 20 20 20 5b 0a 20 20  20 20 20 20 20 20 22 49
+   5.981758184651215e-154   2.0210596923060498e+44
+   5.981758184651215e-154   2.0210596923060498e+44
+  50 68 46 55 68 55 41 68  38 5a 51 51 69 73 48 38
+  1.5816725350398045e+194   1.4370903782651808e-37
+  1.5816725350398045e+194   1.4370903782651808e-37
+  51 51 57 61 66 41 78 74  51 59 6a 75 33 53 46 54
+  1.1114400486291106e+253    9.537183801426909e+97
+  1.1114400486291106e+253    9.537183801426909e+97
+  58 22 0a 20 20 20 20 5d  2c 20 0a 20 20 20 20 5b
+   3.840616274014163e+140   8.942131591061345e+130
+   3.840616274014163e+140   8.942131591061345e+130
+  0a 20 20 20 20 20 20 20  20 22 34 63 74 41 48 36
+    6.01347001699904e-154   3.3192822454618314e-47
+    6.01347001699904e-154   3.3192822454618314e-47
+  41 6b 48 7a 71 35 69 6f  69 4d 31 6d 39 54 33 45
+   4.777473181548944e+228   2.3367328689806343e+25
+   4.777473181548944e+228   2.3367328689806343e+25
+  32 68 69 59 45 65 76 35  6d 54 73 42 22 0a 20 20
+    3.741133819107603e-51   5.981434602656804e-154
+    3.741133819107603e-51   5.981434602656804e-154
+  20 20 5d 2c 20 0a 20 20  20 20 5b 0a 20 20 20 20
+    5.98142273119716e-154   6.013469533114908e-154
+    5.98142273119716e-154   6.013469533114908e-154
+  20 20 20 20 22 48 6e 31  75 46 69 34 64 4e 65 78
+   1.3711099876074356e-70   9.004766126122327e+271
+   1.3711099876074356e-70   9.004766126122327e+271
+  57 72 71 41 52 70 6a 4d  71 67 54 36 63 58 31 55
+    8.701018408438832e+64   2.428060220536411e+102
+    8.701018408438832e+64   2.428060220536411e+102
+  73 4e 50 75 56 33 63 48  64 47 67 39 45 78 79 58
+    5.226883612973721e+40  1.6056983436560176e+118
+    5.226883612973721e+40  1.6056983436560176e+118
+  77 38 48 54 4b 61 64 62  6b 74 52 44 74 64 65 56
+    9.38886283723161e+165  1.5700300067153272e+108
+    9.38886283723161e+165  1.5700300067153272e+108
+  6d 59 33 4d 31 42 78 4a  53 74 69 4c 34 76 6a 4a
+    5.672629143752009e+50    3.093909582138321e+50
+    5.672629143752009e+50    3.093909582138321e+50
+  22 0a 20 20 20 20 5d 2c  20 0a 20 20 20 20 5b 0a
+   5.4542447507882475e-95   8.821071308809118e-259
+   5.4542447507882475e-95   8.821071308809118e-259
+  20 20 20 20 20 20 20 20  22 53 71 33 66 44 62 76
+   6.013470016999068e-154   1.797537068071656e+262
+   6.013470016999068e-154   1.797537068071656e+262
+  75 74 41 42 6d 6e 41 48  48 45 78 4a 44 67 50 4c
+   1.1863165242749562e+40    4.118628855441812e+59
+   1.1863165242749562e+40    4.118628855441812e+59
+  51 6e 34 34 4b 6e 4e 43  37 55 73 58 75 54 37 4b
+    1.713103715754717e+16   2.2345619718586435e+54
+    1.713103715754717e+16   2.2345619718586435e+54
+  5a 65 63 70 61 59 44 4d  55 39 54 78 73 22 0a 20
+   1.6742303814331317e+64  2.4365070123194038e-154
+   1.6742303814331317e+64  2.4365070123194038e-154
+  20 20 20 5d 2c 20 0a 20  20 20 20 5b 0a 20 20 20
+  2.4356775054076983e-154    6.01334614265396e-154
+  2.4356775054076983e-154    6.01334614265396e-154
+  20 20 20 20 20 22 36 54  71 57 79 72 71 64 67 55
+   4.7276447620936855e+97  2.6196453253374313e+103
+   4.7276447620936855e+97  2.6196453253374313e+103
+  45 59 44 51 55 31 61 43  68 4d 75 46 4d 4d 45 69
+        38714536875969064   1.273874733547402e+199
+        38714536875969064   1.273874733547402e+199
+  6d 48 58 34 34 71 48 46  7a 43 55 67 47 66 71 78
+    3.873021635572731e+30   1.470731996153973e+272
+    3.873021635572731e+30   1.470731996153973e+272
+  47 67 5a 4e 4d 55 56 57  4a 22 0a 20 20 20 20 5d
+   5.370930860459282e+112   3.840616274014151e+140
+   5.370930860459282e+112   3.840616274014151e+140
+  2c 20 0a 20 20 20 20 5b  0a 20 20 20 20 20 20 20
+   8.942131591061345e+130    6.01347001699904e-154
+   8.942131591061345e+130    6.01347001699904e-154
+  20 22 67 69 71 4a 6f 37  6f 57 71 46 78 4e 4b 57
+   1.1225021494878505e-41  3.2834832114609776e+112
+   1.1225021494878505e-41  3.2834832114609776e+112
+  79 72 67 63 42 78 41 56  48 58 6e 6a 4a 31 74 36
+   3.205350181895699e+107   2.2106076356973966e-46
+   3.205350181895699e+107   2.2106076356973966e-46
+  63 47 6f 45 66 66 63 65  35 59 31 79 37 75 36 34
+   2.515643558842693e+180    3.577746331630364e-57
+   2.515643558842693e+180    3.577746331630364e-57
+  39 4e 6f 6a 35 77 4a 34  6d 6d 69 55 41 4b 45 56
+    8.432445394545663e-57  3.9070144620212805e+107
+    8.432445394545663e-57  3.9070144620212805e+107
+  56 72 59 41 47 67 32 4b  50 42 33 59 34 22 0a 20
+   1.7626984983426432e+54  2.4364172177072642e-154
+   1.7626984983426432e+54  2.4364172177072642e-154
+  20 20 20 5d 2c 20 0a 20  20 20 20 5b 0a 20 20 20
+  2.4356775054076983e-154    6.01334614265396e-154
+  2.4356775054076983e-154    6.01334614265396e-154
+  20 20 20 20 20 22 63 4e  7a 48 59 35 65 38 76 63
+    4.126662562021792e+69   1.341736893165301e+171
+    4.126662562021792e+69   1.341736893165301e+171
+  6d 4d 33 51 56 4a 55 63  6a 43 79 69 4b 4d 59 66
+   3.213963704186496e+170  1.0751053878505925e+185
+   3.213963704186496e+170  1.0751053878505925e+185
+  65 59 76 79 75 65 71 35  71 43 4d 56 33 6b 71 63
+     2.90601751578432e-51  1.0518034541337785e+171
+     2.90601751578432e-51  1.0518034541337785e+171
+  79 53 6f 4c 79 47 4c 59  55 4b 22 0a 20 20 20 20
+  1.4604789371642337e+122   6.013469528180451e-154
+  1.4604789371642337e+122   6.013469528180451e-154
+  5d 2c 20 0a 20 20 20 20  5b 0a 20 20 20 20 20 20
+   6.013469527996294e-154   6.013470016991685e-154
+   6.013469527996294e-154   6.013470016991685e-154
+  20 20 22 33 37 75 54 65  35 36 38 45 59 63 39 57
+   1.326410386309891e+180  1.5263997211501378e+112
+   1.326410386309891e+180  1.5263997211501378e+112
+  4c 6f 48 45 64 39 6a 58  45 76 55 69 57 62 71 35
+   8.266284395619965e+117    2.903983295443885e-51
+   8.266284395619965e+117    2.903983295443885e-51
+  4c 46 4c 73 63 4e 79 71  76 41 7a 4c 55 35 76 42
+  4.1196811555373235e+238       1526145009572.0913
+  4.1196811555373235e+238       1526145009572.0913
+  41 72 55 4a 41 36 65 79  64 6b 4c 6d 6e 4d 77 4a
+   5.875249235076172e+276    5.449054808188706e+50
+   5.875249235076172e+276    5.449054808188706e+50
+  44 6a 6b 4c 35 6b 58 63  32 56 4b 37 69 67 22 0a
+   3.686222632253691e+170   7.481088233245237e-260
+   3.686222632253691e+170   7.481088233245237e-260
+  20 20 20 20 5d 2c 20 0a  20 20 20 20 5b 0a 20 20
+   6.574341888680965e-260   5.981758184651215e-154
+   6.574341888680965e-260   5.981758184651215e-154
+  20 20 20 20 20 20 22 45  73 59 62 47 34 74 57 57
+   1.0956186545605521e+25  5.6404517091214385e+112
+   1.0956186545605521e+25  5.6404517091214385e+112
+  57 59 34 35 47 33 31 6e  6f 78 38 33 38 71 4e 64
+   6.217459487725008e+222  1.5058594652420306e+175
+   6.217459487725008e+222  1.5058594652420306e+175
+  7a 6b 73 62 50 79 53 57  63 22 0a 20 20 20 20 5d
+  4.6832888891045464e+112   3.840616274014172e+140
+  4.6832888891045464e+112   3.840616274014172e+140
+  2c 20 0a 20 20 20 20 5b  0a 20 20 20 20 20 20 20
+   8.942131591061345e+130    6.01347001699904e-154
+   8.942131591061345e+130    6.01347001699904e-154
+  20 22 6e 62 75 7a 68 66  77 4d 6f 4e 7a 41 33 50
+  2.0802213796128054e+185     2.22966612734575e+78
+  2.0802213796128054e+185     2.22966612734575e+78
+  61 46 6e 79 4c 63 52 78  45 39 62 54 4a 50 44 6b
+   3.885687772444133e+271   5.217406076240362e+208
+   3.885687772444133e+271   5.217406076240362e+208
+  6a 5a 36 52 66 36 59 36  6f 32 63 6b 58 5a 66 7a
+    6.900436688600684e-47   4.057514357091226e+281
+    6.900436688600684e-47   4.057514357091226e+281
+  5a 7a 58 42 54 22 0a 20  20 20 20 5d 2c 20 0a 20
+  2.4364626128057224e-154  2.4356775054076983e-154
+  2.4364626128057224e-154  2.4356775054076983e-154
+  20 20 20 5b 0a 20 20 20  20 20 20 20 20 22 63 51
+    6.01334614265396e-154     1.16155224853782e+84
+    6.01334614265396e-154     1.16155224853782e+84
+  4e 39 50 6f 78 5a 65 43  57 4b 31 78 35 36 78 6e
+     4.80835825682213e+16  1.4003062683547878e+224
+     4.80835825682213e+16  1.4003062683547878e+224
+  7a 36 51 59 41 73 76 52  31 31 58 41 63 65 33 45
+   1.7864022443208708e+89   2.3448380523678583e+25
+   1.7864022443208708e+89   2.3448380523678583e+25
+  68 70 33 67 4d 55 64 66  53 51 35 33 59 32 6d 50
+  1.7279586533468598e+185    2.704595066501283e+79
+  1.7279586533468598e+185    2.704595066501283e+79
+  7a 78 22 0a 20 20 20 20  5d 2c 20 0a 20 20 20 20
+   6.013469528195762e-154   6.013469527996294e-154
+   6.013469528195762e-154   6.013469527996294e-154
+  5b 0a 20 20 20 20 20 20  20 20 22 31 47 6d 33 4e
+   6.013470016991685e-154    5.237473131278007e+68
+   6.013470016991685e-154    5.237473131278007e+68
+  33 72 6b 65 66 36 69 4d  62 78 34 76 6f 42 7a 61
+    8.297456711062894e+64  3.6918527029240634e+161
+    8.297456711062894e+64  3.6918527029240634e+161
+  78 74 58 63 6d 6d 69 4d  54 71 5a 50 68 63 75 41
+     8.36819709609293e+64       22427269.022080734
+     8.36819709609293e+64       22427269.022080734
+  65 70 52 7a 59 55 4a 51  57 34 71 52 70 45 6e 48
+   3.9966461210449287e+83     8.24061675896963e+40
+   3.9966461210449287e+83     8.24061675896963e+40
+  76 4d 6f 6a 7a 6f 66 34  32 68 6a 46 52 66 38 50
+     2.85934020024489e-56   2.8252914197013654e+78
+     2.85934020024489e-56   2.8252914197013654e+78
+  45 32 6a 50 64 65 22 0a  20 20 20 20 5d 2c 20 0a
+    7.47788209735476e-260   6.574341888680965e-260
+    7.47788209735476e-260   6.574341888680965e-260
+  20 20 20 20 5b 0a 20 20  20 20 20 20 20 20 22 32
+   5.981758184651215e-154   3.3615589859759336e-67
+   5.981758184651215e-154   3.3615589859759336e-67
+  54 41 71 32 74 75 4e 36  78 36 6d 32 33 33 62 70
+   4.1681519196596697e-47  2.2604663366644567e+233
+   4.1681519196596697e-47  2.2604663366644567e+233
+  54 37 79 71 64 59 51 50  45 4c 64 54 44 4a 6e 31
+    8.035595313720325e+78   1.3714873565063485e-70
+    8.035595313720325e+78   1.3714873565063485e-70
+  65 55 22 0a 20 20 20 20  5d 2c 20 0a 20 20 20 20
+   6.013469528183864e-154   6.013469527996294e-154
+   6.013469528183864e-154   6.013469527996294e-154
+  5b 0a 20 20 20 20 20 20  20 20 22 6e 74 45 74 6e
+   6.013470016991685e-154  1.1724074247055836e+224
+   6.013470016991685e-154  1.1724074247055836e+224
+  6e 47 68 71 50 69 69 34  6a 6f 41 42 76 42 74 53
+    3.238613587474548e-56   1.0565009578944271e+94
+    3.238613587474548e-56   1.0565009578944271e+94
+  45 4a 47 36 42 78 6a 54  32 74 55 5a 71 45 38 50
+     4.52312519019786e+98   2.8104200054271575e+78
+     4.52312519019786e+98   2.8104200054271575e+78
+  63 56 59 67 6b 33 52 48  70 67 78 67 48 44 43 51
+    2.477372361716807e+40   2.9241309873141114e+83
+    2.477372361716807e+40   2.9241309873141114e+83
+  78 4e 62 4c 4a 66 37 61  72 64 66 31 64 44 6b 32
+  2.0561065170433198e+160    8.091159573871888e-66
+  2.0561065170433198e+160    8.091159573871888e-66
+  6f 43 51 37 43 66 22 0a  20 20 20 20 5d 2c 20 0a
+   7.479264669216298e-260   6.574341888680965e-260
+   7.479264669216298e-260   6.574341888680965e-260
+  20 20 20 20 5b 0a 20 20  20 20 20 20 20 20 22 4b
+   5.981758184651215e-154    8.680385281718307e+53
+   5.981758184651215e-154    8.680385281718307e+53
+  79 31 59 6a 6f 5a 4e 67  51 31 39 36 48 4a 56 33
+  4.2262255249443373e+189   2.1673755216884208e-61
+  4.2262255249443373e+189   2.1673755216884208e-61
+  48 70 64 6b 65 63 66 68  52 42 6d 52 5a 64 4d 4a
+    8.17161083792481e+194    8.591292161426563e+49
+    8.17161083792481e+194    8.591292161426563e+49
+  6b 38 39 48 69 35 4b 47  66 70 66 50 77 53 32 62
+   2.8255064839718757e+35  1.0553250710734554e+165
+   2.8255064839718757e+35  1.0553250710734554e+165
+  55 62 66 64 22 0a 20 20  20 20 5d 2c 20 0a 20 20
+   5.981435357270751e-154    5.98142273119716e-154
+   5.981435357270751e-154    5.98142273119716e-154
+  20 20 5b 0a 20 20 20 20  20 20 20 20 22 32 41 31
+   6.013469533114908e-154     1.94649933844879e-71
+   6.013469533114908e-154     1.94649933844879e-71
+  71 31 59 73 4d 5a 6f 77  61 62 62 76 74 61 37 6b
+  2.0219095887295634e+267   3.002577435661657e+208
+  2.0219095887295634e+267   3.002577435661657e+208
+  54 79 32 46 64 36 71 4e  34 72 35 5a 43 65 47 33
+    7.424755320129426e+69   1.1374290693580739e-61
+    7.424755320129426e+69   1.1374290693580739e-61
+  71 4c 70 76 5a 42 4d 7a  43 69 78 4d 55 64 6b 4e
+   1.327786697299836e+281   5.9078790451346296e+69
+   1.327786697299836e+281   5.9078790451346296e+69
+  32 59 34 64 48 42 31 77  50 73 5a 41 65 56 58 55
+  1.3912645752168427e+266   1.362743713531456e+103
+  1.3912645752168427e+266   1.362743713531456e+103
+  47 44 38 33 4d 66 52 45  44 22 0a 20 20 20 20 5d
+    8.897508089753868e+25   3.840616274014146e+140
+    8.897508089753868e+25   3.840616274014146e+140
+  0a 5d 0a
+            3.355585e-318
+            3.355585e-318
+};};
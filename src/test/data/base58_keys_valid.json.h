@@ -0,0 +1,2370 @@
+namespace json_tests{
+static unsigned const char base58_keys_valid[] = {
+  5b 0a 20 20 20 20 5b 0a  20 20 20 20 20 20 20 20
+   8.821071308809186e-259   6.013470016999068e-154
+   8.821071308809186e-259   6.013470016999068e-154
+  22 31 41 47 4e 61 31 35  5a 51 58 41 5a 55 67 46
+   1.8145671782207207e-52    1.478930460455725e+31
+   1.8145671782207207e-52    1.478930460455725e+31
+  69 71 4a 32 69 37 5a 32  44 50 55 32 4a 36 68 57
+    3.889688543391647e-66  1.1645558085888703e+113
+    3.889688543391647e-66  1.1645558085888703e+113
+  36 32 69 22 2c 20 0a 20  20 20 20 20 20 20 20 22
+     2.4356771791369e-154  2.5827657058487563e-144
+     2.4356771791369e-154  2.5827657058487563e-144
+  36 35 61 31 36 30 35 39  38 36 34 61 32 66 64 62
+    4.080723328259182e-33   9.397685280823885e+165
+    4.080723328259182e-33   9.397685280823885e+165
+  63 37 63 39 39 61 34 37  32 33 61 38 33 39 35 62
+    9.138609154139265e-43  1.2221749392043578e+165
+    9.138609154139265e-43  1.2221749392043578e+165
+  63 36 66 31 38 38 65 62  22 2c 20 0a 20 20 20 20
+    9.77563490420438e+165   6.013469527996216e-154
+    9.77563490420438e+165   6.013469527996216e-154
+  20 20 20 20 7b 0a 20 20  20 20 20 20 20 20 20 20
+   5.981940273047973e-154   6.013470016999068e-154
+   5.981940273047973e-154   6.013470016999068e-154
+  20 20 22 61 64 64 72 54  79 70 65 22 3a 20 22 70
+     6.28566531304754e+98  1.4070383799779425e+232
+     6.28566531304754e+98  1.4070383799779425e+232
+  75 62 6b 65 79 22 2c 20  0a 20 20 20 20 20 20 20
+  1.0491895843658824e-153    6.01347001699904e-154
+  1.0491895843658824e-153    6.01347001699904e-154
+  20 20 20 20 20 22 69 73  50 72 69 76 6b 65 79 22
+   8.786501966149144e+247  1.3016382627362237e-142
+   8.786501966149144e+247  1.3016382627362237e-142
+  3a 20 66 61 6c 73 65 2c  20 0a 20 20 20 20 20 20
+    8.034083407401953e-95   6.013470016991607e-154
+    8.034083407401953e-95   6.013470016991607e-154
+  20 20 20 20 20 20 22 69  73 54 65 73 74 6e 65 74
+    2.70979801693884e+198  4.9101891977339775e+252
+    2.70979801693884e+198  4.9101891977339775e+252
+  22 3a 20 66 61 6c 73 65  0a 20 20 20 20 20 20 20
+    5.03734622854541e+180    6.01347001699904e-154
+    5.03734622854541e+180    6.01347001699904e-154
+  20 7d 0a 20 20 20 20 5d  2c 20 0a 20 20 20 20 5b
+   3.840616274033827e+140   8.942131591061345e+130
+   3.840616274033827e+140   8.942131591061345e+130
+  0a 20 20 20 20 20 20 20  20 22 33 43 4d 4e 46 78
+    6.01347001699904e-154   2.356813449672071e+271
+    6.01347001699904e-154   2.356813449672071e+271
+  4e 31 6f 48 42 63 34 52  31 45 70 62 6f 41 4c 35
+   1.0139291940004869e+88   5.9000457937027105e-52
+   1.0139291940004869e+88   5.9000457937027105e-52
+  79 7a 48 47 67 45 36 31  31 58 6f 75 22 2c 20 0a
+   1.2604999944843487e-71   6.573978002197726e-260
+   1.2604999944843487e-71   6.573978002197726e-260
+  20 20 20 20 20 20 20 20  22 37 34 66 32 30 39 66
+   6.013470016999068e-154   2.675689331161008e+184
+   6.013470016999068e-154   2.675689331161008e+184
+  36 65 61 39 30 37 65 32  65 61 34 38 66 37 34 66
+    6.295436665048454e-66  2.1475399950252527e+184
+    6.295436665048454e-66  2.1475399950252527e+184
+  61 65 30 35 37 38 32 61  65 38 61 36 36 35 32 35
+  1.6009448358597155e+160   1.9009891232031407e-52
+  1.6009448358597155e+160   1.9009891232031407e-52
+  37 22 2c 20 0a 20 20 20  20 20 20 20 20 7b 0a 20
+   6.013344832268924e-154  2.4688001838597158e-154
+   6.013344832268924e-154  2.4688001838597158e-154
+  20 20 20 20 20 20 20 20  20 20 20 22 61 64 64 72
+   6.013470016999068e-154  1.0877989176282101e+243
+   6.013470016999068e-154  1.0877989176282101e+243
+  54 79 70 65 22 3a 20 22  73 63 72 69 70 74 22 2c
+  2.5990381806122846e-144    4.319979465966004e-96
+  2.5990381806122846e-144    4.319979465966004e-96
+  20 0a 20 20 20 20 20 20  20 20 20 20 20 20 22 69
+   6.013470016991607e-154    2.70979801693884e+198
+   6.013470016991607e-154    2.70979801693884e+198
+  73 50 72 69 76 6b 65 79  22 3a 20 66 61 6c 73 65
+   5.932816947191957e+276    5.03734622854541e+180
+   5.932816947191957e+276    5.03734622854541e+180
+  2c 20 0a 20 20 20 20 20  20 20 20 20 20 20 20 22
+   6.013470015088901e-154  2.5827657058487563e-144
+   6.013470015088901e-154  2.5827657058487563e-144
+  69 73 54 65 73 74 6e 65  74 22 3a 20 66 61 6c 73
+   3.949156961798742e+180   9.921696751788942e+247
+   3.949156961798742e+180   9.921696751788942e+247
+  65 0a 20 20 20 20 20 20  20 20 7d 0a 20 20 20 20
+   6.013470016991698e-154    6.01346953606701e-154
+   6.013470016991698e-154    6.01346953606701e-154
+  5d 2c 20 0a 20 20 20 20  5b 0a 20 20 20 20 20 20
+   6.013469527996294e-154   6.013470016991685e-154
+   6.013469527996294e-154   6.013470016991685e-154
+  20 20 22 6d 6f 39 6e 63  58 69 73 4d 65 41 6f 58
+    9.12524685372666e+170   9.852220108300925e+117
+    9.12524685372666e+170   9.852220108300925e+117
+  77 71 63 56 35 45 57 75  79 6e 63 62 6d 43 63 51
+   1.747025075627545e+257    1.169449508796345e+84
+   1.747025075627545e+257    1.169449508796345e+84
+  4e 34 72 56 73 22 2c 20  0a 20 20 20 20 20 20 20
+  1.0491861369262751e-153    6.01347001699904e-154
+  1.0491861369262751e-153    6.01347001699904e-154
+  20 22 35 33 63 30 33 30  37 64 36 38 35 31 61 61
+   1.6571955648021168e-76  1.2085360647218768e+161
+   1.6571955648021168e-76  1.2085360647218768e+161
+  30 63 65 37 38 32 35 62  61 38 38 33 63 36 62 64
+  1.2206047094705161e+165   3.603594288350602e+175
+  1.2206047094705161e+165   3.603594288350602e+175
+  39 61 64 32 34 32 62 34  38 36 22 2c 20 0a 20 20
+    2.319045919941785e-56   5.981422726081889e-154
+    2.319045919941785e-56   5.981422726081889e-154
+  20 20 20 20 20 20 7b 0a  20 20 20 20 20 20 20 20
+    3.52842852352625e-258   6.013470016999068e-154
+    3.52842852352625e-258   6.013470016999068e-154
+  20 20 20 20 22 61 64 64  72 54 79 70 65 22 3a 20
+    4.03236148217039e+175   1.949189642201022e-153
+    4.03236148217039e+175   1.949189642201022e-153
+  22 70 75 62 6b 65 79 22  2c 20 0a 20 20 20 20 20
+   1.301638201780595e-142   6.013470015088901e-154
+   1.301638201780595e-142   6.013470015088901e-154
+  20 20 20 20 20 20 20 22  69 73 50 72 69 76 6b 65
+  2.5827657058487563e-144   3.561133256465674e+180
+  2.5827657058487563e-144   3.561133256465674e+180
+  79 22 3a 20 66 61 6c 73  65 2c 20 0a 20 20 20 20
+   9.921696751788948e+247   6.013469527996305e-154
+   9.921696751788948e+247   6.013469527996305e-154
+  20 20 20 20 20 20 20 20  22 69 73 54 65 73 74 6e
+   6.013470016999068e-154  1.1827864699734312e+224
+   6.013470016999068e-154  1.1827864699734312e+224
+  65 74 22 3a 20 74 72 75  65 0a 20 20 20 20 20 20
+   5.541633531018842e+257   6.013470016991698e-154
+   5.541633531018842e+257   6.013470016991698e-154
+  20 20 7d 0a 20 20 20 20  5d 2c 20 0a 20 20 20 20
+    6.01346953606701e-154   6.013469527996294e-154
+    6.01346953606701e-154   6.013469527996294e-154
+  5b 0a 20 20 20 20 20 20  20 20 22 32 4e 32 4a 44
+   6.013470016991685e-154    9.664804715773548e+20
+   6.013470016991685e-154    9.664804715773548e+20
+  36 77 62 35 36 41 66 4b  34 74 66 6d 4d 36 50 77
+   1.7052639854372543e+55   5.227523057919265e+266
+   1.7052639854372543e+55   5.227523057919265e+266
+  64 56 6d 6f 59 6b 32 64  43 4b 66 34 42 72 22 2c
+    4.55566113057524e+174    4.317985641561695e-96
+    4.55566113057524e+174    4.317985641561695e-96
+  20 0a 20 20 20 20 20 20  20 20 22 36 33 34 39 61
+   6.013470016991607e-154  2.2146523884976888e+160
+   6.013470016991607e-154  2.2146523884976888e+160
+  34 31 38 66 63 34 35 37  38 64 31 30 61 33 37 32
+    9.508490198018753e-43    8.605618553886373e-67
+    9.508490198018753e-43    8.605618553886373e-67
+  62 35 34 62 34 35 63 32  38 30 63 63 38 63 34 33
+    5.699664260492317e-66   4.9559459620899055e-62
+    5.699664260492317e-66   4.9559459620899055e-62
+  38 32 66 22 2c 20 0a 20  20 20 20 20 20 20 20 7b
+   2.435677179071781e-154  1.1989438289530674e+285
+   2.435677179071781e-154  1.1989438289530674e+285
+  0a 20 20 20 20 20 20 20  20 20 20 20 20 22 61 64
+    6.01347001699904e-154   3.390069307505042e+175
+    6.01347001699904e-154   3.390069307505042e+175
+  64 72 54 79 70 65 22 3a  20 22 73 63 72 69 70 74
+   1.1609664343084283e-28     7.5203020051533e+252
+   1.1609664343084283e-28     7.5203020051533e+252
+  22 2c 20 0a 20 20 20 20  20 20 20 20 20 20 20 20
+   6.013469527996216e-154   6.013470016999068e-154
+   6.013469527996216e-154   6.013470016999068e-154
+  22 69 73 50 72 69 76 6b  65 79 22 3a 20 66 61 6c
+   4.605064167587364e+209  1.1714653744282218e+214
+   4.605064167587364e+209  1.1714653744282218e+214
+  73 65 2c 20 0a 20 20 20  20 20 20 20 20 20 20 20
+   6.013344832291728e-154   6.013470016999068e-154
+   6.013344832291728e-154   6.013470016999068e-154
+  20 22 69 73 54 65 73 74  6e 65 74 22 3a 20 74 72
+   8.887600345591531e+252   2.147195286614755e+243
+   8.887600345591531e+252   2.147195286614755e+243
+  75 65 0a 20 20 20 20 20  20 20 20 7d 0a 20 20 20
+     6.0134700151124e-154   6.013346898391935e-154
+     6.0134700151124e-154   6.013346898391935e-154
+  20 5d 2c 20 0a 20 20 20  20 5b 0a 20 20 20 20 20
+   6.013344832288905e-154   6.013470015108896e-154
+   6.013344832288905e-154   6.013470015108896e-154
+  20 20 20 22 35 4b 64 33  4e 42 55 41 64 55 6e 68
+   3.9465156210363056e-61  1.1071605671098093e+195
+   3.9465156210363056e-61  1.1071605671098093e+195
+  79 7a 65 6e 45 77 56 4c  79 39 70 42 4b 78 53 77
+    5.640830395181303e+59   6.277979022353381e+266
+    5.640830395181303e+59   6.277979022353381e+266
+  58 76 45 39 46 4d 50 79  52 34 55 4b 5a 76 70 65
+   2.257631227532244e+276   4.269414597448494e+180
+   2.257631227532244e+276   4.269414597448494e+180
+  36 45 33 41 67 4c 72 22  2c 20 0a 20 20 20 20 20
+   9.378564735284877e-143   6.013470015088901e-154
+   9.378564735284877e-143   6.013470015088901e-154
+  20 20 20 22 65 64 64 62  64 63 31 31 36 38 66 31
+   9.394442924897736e+165   1.0060667886735547e-70
+   9.394442924897736e+165   1.0060667886735547e-70
+  64 61 65 61 64 62 64 33  65 34 34 63 31 65 33 66
+    3.964127665225483e-61  2.0603145323961982e+184
+    3.964127665225483e-61  2.0603145323961982e+184
+  38 66 35 61 32 38 34 63  32 30 32 39 66 37 38 61
+   7.630770394834259e+169  2.1278810939583775e+160
+   7.630770394834259e+169  2.1278810939583775e+160
+  64 32 36 61 66 39 38 35  38 33 61 34 39 39 64 65
+   2.5291264132035478e-52  2.6224327798065945e+180
+   2.5291264132035478e-52  2.6224327798065945e+180
+  35 62 31 39 22 2c 20 0a  20 20 20 20 20 20 20 20
+   6.573976542598963e-260   6.013470016999068e-154
+   6.573976542598963e-260   6.013470016999068e-154
+  7b 0a 20 20 20 20 20 20  20 20 20 20 20 20 22 69
+   6.013470016991727e-154    2.70979801693884e+198
+   6.013470016991727e-154    2.70979801693884e+198
+  73 43 6f 6d 70 72 65 73  73 65 64 22 3a 20 66 61
+   7.497795098079407e+247  1.5553509142091264e+161
+   7.497795098079407e+247  1.5553509142091264e+161
+  6c 73 65 2c 20 0a 20 20  20 20 20 20 20 20 20 20
+   5.981422731920023e-154   6.013470016999068e-154
+   5.981422731920023e-154   6.013470016999068e-154
+  20 20 22 69 73 50 72 69  76 6b 65 79 22 3a 20 74
+   8.761662860649562e+199  2.3236301470955206e+251
+   8.761662860649562e+199  2.3236301470955206e+251
+  72 75 65 2c 20 0a 20 20  20 20 20 20 20 20 20 20
+    5.98142273192071e-154   6.013470016999068e-154
+    5.98142273192071e-154   6.013470016999068e-154
+  20 20 22 69 73 54 65 73  74 6e 65 74 22 3a 20 66
+   7.456842731009478e+247   8.618823075239411e+183
+   7.456842731009478e+247   8.618823075239411e+183
+  61 6c 73 65 0a 20 20 20  20 20 20 20 20 7d 0a 20
+   6.013346372162298e-154   2.469528537446747e-154
+   6.013346372162298e-154   2.469528537446747e-154
+  20 20 20 5d 2c 20 0a 20  20 20 20 5b 0a 20 20 20
+  2.4356775054076983e-154    6.01334614265396e-154
+  2.4356775054076983e-154    6.01334614265396e-154
+  20 20 20 20 20 22 4b 7a  36 55 4a 6d 51 41 43 4a
+  1.2313134732639906e+281    5.628286278057022e+49
+  1.2313134732639906e+281    5.628286278057022e+49
+  6d 4c 74 61 51 6a 35 41  33 4a 41 67 65 34 6b 56
+       1403473.3806808249  1.9966041040181526e+108
+       1403473.3806808249  1.9966041040181526e+108
+  54 4e 51 38 67 62 76 58  75 77 62 6d 43 6a 37 62
+  1.4111836407245497e+118  1.3483837121810234e+165
+  1.4111836407245497e+118  1.3483837121810234e+165
+  73 61 61 62 75 64 62 33  52 44 22 2c 20 0a 20 20
+    3.576758957812299e-61   5.981422726086672e-154
+    3.576758957812299e-61   5.981422726086672e-154
+  20 20 20 20 20 20 22 35  35 63 39 62 63 63 62 39
+    9.461947372890723e-53   2.8331562275001015e-32
+    9.461947372890723e-53   2.8331562275001015e-32
+  65 64 36 38 34 34 36 64  31 62 37 35 32 37 33 62
+   5.491704894940128e+174  1.1065519651326341e+165
+   5.491704894940128e+174  1.1065519651326341e+165
+  62 63 65 38 39 64 37 66  65 30 31 33 61 38 61 63
+  2.4848226712840293e+184   5.199081029537241e+170
+  2.4848226712840293e+184   5.199081029537241e+170
+  64 31 36 32 35 35 31 34  34 32 30 66 62 32 61 63
+    2.741367542549522e-57   5.192010374587042e+170
+    2.741367542549522e-57   5.192010374587042e+170
+  61 31 61 32 31 63 34 22  2c 20 0a 20 20 20 20 20
+   6.530785265027866e-144   6.013470015088901e-154
+   6.530785265027866e-144   6.013470015088901e-154
+  20 20 20 7b 0a 20 20 20  20 20 20 20 20 20 20 20
+    6.01334685393676e-154   6.013470016999068e-154
+    6.01334685393676e-154   6.013470016999068e-154
+  20 22 69 73 43 6f 6d 70  72 65 73 73 65 64 22 3a
+  3.6558227758146443e+233    1.160709300546122e-28
+  3.6558227758146443e+233    1.160709300546122e-28
+  20 74 72 75 65 2c 20 0a  20 20 20 20 20 20 20 20
+   6.574393576735255e-260   6.013470016999068e-154
+   6.574393576735255e-260   6.013470016999068e-154
+  20 20 20 20 22 69 73 50  72 69 76 6b 65 79 22 3a
+      3.5961645426119e+79   1.1658861701882902e-28
+      3.5961645426119e+79   1.1658861701882902e-28
+  20 74 72 75 65 2c 20 0a  20 20 20 20 20 20 20 20
+   6.574393576735255e-260   6.013470016999068e-154
+   6.574393576735255e-260   6.013470016999068e-154
+  20 20 20 20 22 69 73 54  65 73 74 6e 65 74 22 3a
+    6.633752696451049e+98   1.1646535862798119e-28
+    6.633752696451049e+98   1.1646535862798119e-28
+  20 66 61 6c 73 65 0a 20  20 20 20 20 20 20 20 7d
+   2.460906791088173e-154   5.149424535094442e+294
+   2.460906791088173e-154   5.149424535094442e+294
+  0a 20 20 20 20 5d 2c 20  0a 20 20 20 20 5b 0a 20
+  1.0577333593336978e-153   2.457146526467208e-154
+  1.0577333593336978e-153   2.457146526467208e-154
+  20 20 20 20 20 20 20 22  39 32 31 33 71 4a 61 62
+  2.5827657058487563e-144    7.96567272702175e+165
+  2.5827657058487563e-144    7.96567272702175e+165
+  32 48 4e 45 70 4d 70 59  4e 42 61 37 77 48 47 46
+   6.735538253978415e+122   3.6893495644640385e+30
+   6.735538253978415e+122   3.6893495644640385e+30
+  4b 4b 62 6b 44 6e 32 34  6a 70 41 4e 44 73 32 68
+    2.936184926609885e-57    8.41782202471299e+193
+    2.936184926609885e-57    8.41782202471299e+193
+  75 4e 33 79 69 34 4a 31  31 6b 6f 22 2c 20 0a 20
+    2.966270813059438e-71  2.4356771792719714e-154
+    2.966270813059438e-71  2.4356771792719714e-154
+  20 20 20 20 20 20 20 22  33 36 63 62 39 33 62 39
+  2.5827657058487563e-144    2.804168538309193e-32
+  2.5827657058487563e-144    2.804168538309193e-32
+  61 62 31 62 64 61 62 66  37 66 62 39 66 32 63 30
+  1.5620078298674812e+185      1.3262994004722e-75
+  1.5620078298674812e+185      1.3262994004722e-75
+  34 66 31 62 39 63 63 38  37 39 39 33 33 35 33 30
+    4.558001527769539e-37   1.6588190633676184e-76
+    4.558001527769539e-37   1.6588190633676184e-76
+  61 65 37 38 34 32 33 39  38 65 65 66 35 61 36 33
+   3.6970361731601844e-33    5.440208833097376e-62
+   3.6970361731601844e-33    5.440208833097376e-62
+  61 35 36 38 30 30 63 32  22 2c 20 0a 20 20 20 20
+    5.693849771813214e-66   6.013469527996216e-154
+    5.693849771813214e-66   6.013469527996216e-154
+  20 20 20 20 7b 0a 20 20  20 20 20 20 20 20 20 20
+   5.981940273047973e-154   6.013470016999068e-154
+   5.981940273047973e-154   6.013470016999068e-154
+  20 20 22 69 73 43 6f 6d  70 72 65 73 73 65 64 22
+  1.3795078638833634e+219   5.226889369249613e-143
+  1.3795078638833634e+219   5.226889369249613e-143
+  3a 20 66 61 6c 73 65 2c  20 0a 20 20 20 20 20 20
+    8.034083407401953e-95   6.013470016991607e-154
+    8.034083407401953e-95   6.013470016991607e-154
+  20 20 20 20 20 20 22 69  73 50 72 69 76 6b 65 79
+    2.70979801693884e+198   5.932816947191957e+276
+    2.70979801693884e+198   5.932816947191957e+276
+  22 3a 20 74 72 75 65 2c  20 0a 20 20 20 20 20 20
+    8.037044162805465e-95   6.013470016991607e-154
+    8.037044162805465e-95   6.013470016991607e-154
+  20 20 20 20 20 20 22 69  73 54 65 73 74 6e 65 74
+    2.70979801693884e+198  4.9101891977339775e+252
+    2.70979801693884e+198  4.9101891977339775e+252
+  22 3a 20 74 72 75 65 0a  20 20 20 20 20 20 20 20
+   1.395657049443267e-258   6.013470016999068e-154
+   1.395657049443267e-258   6.013470016999068e-154
+  7d 0a 20 20 20 20 5d 2c  20 0a 20 20 20 20 5b 0a
+    5.454244750788308e-95   8.821071308809118e-259
+    5.454244750788308e-95   8.821071308809118e-259
+  20 20 20 20 20 20 20 20  22 63 54 70 42 34 59 69
+   6.013470016999068e-154   3.014456416174935e+199
+   6.013470016999068e-154   3.014456416174935e+199
+  79 4b 69 42 63 50 78 6e  65 66 73 44 70 62 6e 44
+  1.4062206271903935e+224    4.483964535094599e+21
+  1.4062206271903935e+224    4.483964535094599e+21
+  78 46 44 66 66 6a 71 4a  6f 62 38 77 47 43 45 44
+    4.072474310564634e+50     7.84459200311683e+20
+    4.072474310564634e+50     7.84459200311683e+20
+  58 78 67 51 37 7a 51 6f  4d 58 4a 64 48 22 2c 20
+  1.6561273150897835e+228  1.0491616995704981e-153
+  1.6561273150897835e+228  1.0491616995704981e-153
+  0a 20 20 20 20 20 20 20  20 22 62 39 66 34 38 39
+    6.01347001699904e-154    4.661652728312551e-33
+    6.01347001699904e-154    4.661652728312551e-33
+  32 63 39 65 38 32 38 32  30 32 38 66 65 61 31 64
+    8.974859380972005e-67   4.298714537105117e+174
+    8.974859380972005e-67   4.298714537105117e+174
+  32 36 36 37 63 34 64 63  35 32 31 33 35 36 34 64
+   6.100123844574527e+170   4.998980060708429e+174
+   6.100123844574527e+170   4.998980060708429e+174
+  34 31 66 63 35 37 38 33  38 39 36 61 30 64 38 34
+    5.886500473725925e-62     3.88576834411429e-57
+    5.886500473725925e-62     3.88576834411429e-57
+  33 66 63 31 35 30 38 39  66 33 22 2c 20 0a 20 20
+   4.6584993729377396e-33   5.981422726080932e-154
+   4.6584993729377396e-33   5.981422726080932e-154
+  20 20 20 20 20 20 7b 0a  20 20 20 20 20 20 20 20
+    3.52842852352625e-258   6.013470016999068e-154
+    3.52842852352625e-258   6.013470016999068e-154
+  20 20 20 20 22 69 73 43  6f 6d 70 72 65 73 73 65
+    8.741791754053274e+16   5.044453705302714e+180
+    8.741791754053274e+16   5.044453705302714e+180
+  64 22 3a 20 74 72 75 65  2c 20 0a 20 20 20 20 20
+   5.562188174538047e+180   6.013470015088901e-154
+   5.562188174538047e+180   6.013470015088901e-154
+  20 20 20 20 20 20 20 22  69 73 50 72 69 76 6b 65
+  2.5827657058487563e-144   3.561133256465674e+180
+  2.5827657058487563e-144   3.561133256465674e+180
+  79 22 3a 20 74 72 75 65  2c 20 0a 20 20 20 20 20
+   5.562188174538066e+180   6.013470015088901e-154
+   5.562188174538066e+180   6.013470015088901e-154
+  20 20 20 20 20 20 20 22  69 73 54 65 73 74 6e 65
+  2.5827657058487563e-144   3.949156961798742e+180
+  2.5827657058487563e-144   3.949156961798742e+180
+  74 22 3a 20 74 72 75 65  0a 20 20 20 20 20 20 20
+   5.562188174538061e+180    6.01347001699904e-154
+   5.562188174538061e+180    6.01347001699904e-154
+  20 7d 0a 20 20 20 20 5d  2c 20 0a 20 20 20 20 5b
+   3.840616274033827e+140   8.942131591061345e+130
+   3.840616274033827e+140   8.942131591061345e+130
+  0a 20 20 20 20 20 20 20  20 22 31 41 78 34 67 5a
+    6.01347001699904e-154  3.1415863857478247e+127
+    6.01347001699904e-154  3.1415863857478247e+127
+  74 62 37 67 41 69 74 32  54 69 76 77 65 6a 5a 48
+   1.2113468606127583e-65   3.5955066209874307e+40
+   1.2113468606127583e-65   3.5955066209874307e+40
+  59 74 4e 4e 4c 54 31 38  50 55 58 4a 22 2c 20 0a
+    5.092620429381213e-38   6.573976958176768e-260
+    5.092620429381213e-38   6.573976958176768e-260
+  20 20 20 20 20 20 20 20  22 36 64 32 33 31 35 36
+   6.013470016999068e-154   1.4500283072217002e-47
+   6.013470016999068e-154   1.4500283072217002e-47
+  63 62 62 64 63 63 38 32  61 35 61 34 37 65 65 65
+    9.046099257757215e-67   2.774388621185501e+180
+    9.046099257757215e-67   2.774388621185501e+180
+  34 63 32 63 37 63 35 38  33 63 31 38 62 36 62 66
+    6.285240134396748e-38  1.5477306901196453e+185
+    6.285240134396748e-38  1.5477306901196453e+185
+  34 22 2c 20 0a 20 20 20  20 20 20 20 20 7b 0a 20
+    6.01334483226892e-154  2.4688001838597158e-154
+    6.01334483226892e-154  2.4688001838597158e-154
+  20 20 20 20 20 20 20 20  20 20 20 22 61 64 64 72
+   6.013470016999068e-154  1.0877989176282101e+243
+   6.013470016999068e-154  1.0877989176282101e+243
+  54 79 70 65 22 3a 20 22  70 75 62 6b 65 79 22 2c
+  2.5990381806122846e-144    4.324512152376323e-96
+  2.5990381806122846e-144    4.324512152376323e-96
+  20 0a 20 20 20 20 20 20  20 20 20 20 20 20 22 69
+   6.013470016991607e-154    2.70979801693884e+198
+   6.013470016991607e-154    2.70979801693884e+198
+  73 50 72 69 76 6b 65 79  22 3a 20 66 61 6c 73 65
+   5.932816947191957e+276    5.03734622854541e+180
+   5.932816947191957e+276    5.03734622854541e+180
+  2c 20 0a 20 20 20 20 20  20 20 20 20 20 20 20 22
+   6.013470015088901e-154  2.5827657058487563e-144
+   6.013470015088901e-154  2.5827657058487563e-144
+  69 73 54 65 73 74 6e 65  74 22 3a 20 66 61 6c 73
+   3.949156961798742e+180   9.921696751788942e+247
+   3.949156961798742e+180   9.921696751788942e+247
+  65 0a 20 20 20 20 20 20  20 20 7d 0a 20 20 20 20
+   6.013470016991698e-154    6.01346953606701e-154
+   6.013470016991698e-154    6.01346953606701e-154
+  5d 2c 20 0a 20 20 20 20  5b 0a 20 20 20 20 20 20
+   6.013469527996294e-154   6.013470016991685e-154
+   6.013469527996294e-154   6.013470016991685e-154
+  20 20 22 33 51 6a 59 58  68 54 6b 76 75 6a 38 71
+   4.005655470273167e+117  2.4842113104543338e+237
+   4.005655470273167e+117  2.4842113104543338e+237
+  50 61 58 48 54 54 57 62  35 77 6a 58 68 64 73 4c
+   5.373798870690959e+165   1.9476307222249055e+60
+   5.373798870690959e+165   1.9476307222249055e+60
+  41 41 57 56 79 22 2c 20  0a 20 20 20 20 20 20 20
+   1.049189550849722e-153    6.01347001699904e-154
+   1.049189550849722e-153    6.01347001699904e-154
+  20 22 66 63 63 35 34 36  30 64 64 36 65 32 34 38
+   1.3827249507337572e-47    5.935322791619371e-38
+   1.3827249507337572e-47    5.935322791619371e-38
+  37 63 37 64 37 35 62 31  39 36 33 36 32 35 64 61
+    8.244234294966622e-71  1.4205177901608856e+161
+    8.244234294966622e-71  1.4205177901608856e+161
+  30 65 38 66 34 63 35 39  37 35 22 2c 20 0a 20 20
+   4.1190861929783294e-33   5.981422726081549e-154
+   4.1190861929783294e-33   5.981422726081549e-154
+  20 20 20 20 20 20 7b 0a  20 20 20 20 20 20 20 20
+    3.52842852352625e-258   6.013470016999068e-154
+    3.52842852352625e-258   6.013470016999068e-154
+  20 20 20 20 22 61 64 64  72 54 79 70 65 22 3a 20
+    4.03236148217039e+175   1.949189642201022e-153
+    4.03236148217039e+175   1.949189642201022e-153
+  22 73 63 72 69 70 74 22  2c 20 0a 20 20 20 20 20
+  1.0475723415387628e-142   6.013470015088901e-154
+  1.0475723415387628e-142   6.013470015088901e-154
+  20 20 20 20 20 20 20 22  69 73 50 72 69 76 6b 65
+  2.5827657058487563e-144   3.561133256465674e+180
+  2.5827657058487563e-144   3.561133256465674e+180
+  79 22 3a 20 66 61 6c 73  65 2c 20 0a 20 20 20 20
+   9.921696751788948e+247   6.013469527996305e-154
+   9.921696751788948e+247   6.013469527996305e-154
+  20 20 20 20 20 20 20 20  22 69 73 54 65 73 74 6e
+   6.013470016999068e-154  1.1827864699734312e+224
+   6.013470016999068e-154  1.1827864699734312e+224
+  65 74 22 3a 20 66 61 6c  73 65 0a 20 20 20 20 20
+  1.1714653744279156e+214   6.013470015112398e-154
+  1.1714653744279156e+214   6.013470015112398e-154
+  20 20 20 7d 0a 20 20 20  20 5d 2c 20 0a 20 20 20
+   6.013346898391935e-154   6.013344832288905e-154
+   6.013346898391935e-154   6.013344832288905e-154
+  20 5b 0a 20 20 20 20 20  20 20 20 22 6e 33 5a 64
+   6.013470015108896e-154  2.5921115722661137e+175
+   6.013470015108896e-154  2.5921115722661137e+175
+  64 78 7a 4c 76 41 59 39  6f 37 31 38 34 54 42 34
+    1.945629229889904e-32    5.839931413895232e-57
+    1.945629229889904e-32    5.839931413895232e-57
+  63 36 46 4a 61 73 41 79  62 73 77 34 48 5a 22 2c
+  1.2083673310298047e+276    4.296061715597736e-96
+  1.2083673310298047e+276    4.296061715597736e-96
+  20 0a 20 20 20 20 20 20  20 20 22 66 31 64 34 37
+   6.013470016991607e-154    9.143810481107537e-43
+   6.013470016991607e-154    9.143810481107537e-43
+  30 66 39 62 30 32 33 37  30 66 64 65 63 32 65 36
+    8.607806871744934e-43   1.1602767248224752e-46
+    8.607806871744934e-43   1.1602767248224752e-46
+  62 37 30 38 62 30 38 61  63 34 33 31 62 66 37 61
+   2.125473046376392e+160  2.0561385534082345e+160
+   2.125473046376392e+160  2.0561385534082345e+160
+  35 66 37 22 2c 20 0a 20  20 20 20 20 20 20 20 7b
+  2.4356771780559776e-154  1.1989438289530674e+285
+  2.4356771780559776e-154  1.1989438289530674e+285
+  0a 20 20 20 20 20 20 20  20 20 20 20 20 22 61 64
+    6.01347001699904e-154   3.390069307505042e+175
+    6.01347001699904e-154   3.390069307505042e+175
+  64 72 54 79 70 65 22 3a  20 22 70 75 62 6b 65 79
+   1.1609664343084283e-28   5.932732618036777e+276
+   1.1609664343084283e-28   5.932732618036777e+276
+  22 2c 20 0a 20 20 20 20  20 20 20 20 20 20 20 20
+   6.013469527996216e-154   6.013470016999068e-154
+   6.013469527996216e-154   6.013470016999068e-154
+  22 69 73 50 72 69 76 6b  65 79 22 3a 20 66 61 6c
+   4.605064167587364e+209  1.1714653744282218e+214
+   4.605064167587364e+209  1.1714653744282218e+214
+  73 65 2c 20 0a 20 20 20  20 20 20 20 20 20 20 20
+   6.013344832291728e-154   6.013470016999068e-154
+   6.013344832291728e-154   6.013470016999068e-154
+  20 22 69 73 54 65 73 74  6e 65 74 22 3a 20 74 72
+   8.887600345591531e+252   2.147195286614755e+243
+   8.887600345591531e+252   2.147195286614755e+243
+  75 65 0a 20 20 20 20 20  20 20 20 7d 0a 20 20 20
+     6.0134700151124e-154   6.013346898391935e-154
+     6.0134700151124e-154   6.013346898391935e-154
+  20 5d 2c 20 0a 20 20 20  20 5b 0a 20 20 20 20 20
+   6.013344832288905e-154   6.013470015108896e-154
+   6.013344832288905e-154   6.013470015108896e-154
+  20 20 20 22 32 4e 42 46  4e 4a 54 6b 74 4e 61 37
+   2.9006147269337496e+30    6.208389455252429e-42
+   2.9006147269337496e+30    6.208389455252429e-42
+  47 5a 75 73 47 62 44 62  47 4b 52 5a 54 78 64 4b
+  2.3476587851535248e+165   1.5685120305304722e+55
+  2.3476587851535248e+165   1.5685120305304722e+55
+  39 56 56 65 7a 33 6e 22  2c 20 0a 20 20 20 20 20
+   7.739530811187099e-143   6.013470015088901e-154
+   7.739530811187099e-143   6.013470015088901e-154
+  20 20 20 22 63 35 37 39  33 34 32 63 32 63 34 63
+   4.4698029670637784e-33   7.694161214647045e+169
+   4.4698029670637784e-33   7.694161214647045e+169
+  39 32 32 30 32 30 35 65  32 63 64 63 32 38 35 36
+   3.434415580670329e+179   1.4518983983103035e-47
+   3.434415580670329e+179   1.4518983983103035e-47
+  31 37 30 34 30 63 39 32  34 61 30 61 22 2c 20 0a
+    9.416730157510271e-67   6.573977511660299e-260
+    9.416730157510271e-67   6.573977511660299e-260
+  20 20 20 20 20 20 20 20  7b 0a 20 20 20 20 20 20
+   6.013470016999068e-154   6.013470016991727e-154
+   6.013470016999068e-154   6.013470016991727e-154
+  20 20 20 20 20 20 22 61  64 64 72 54 79 70 65 22
+   7.963380651952609e+159  5.4941904516250855e-143
+   7.963380651952609e+159  5.4941904516250855e-143
+  3a 20 22 73 63 72 69 70  74 22 2c 20 0a 20 20 20
+  3.1605331151745443e+233   6.013344832269005e-154
+  3.1605331151745443e+233   6.013344832269005e-154
+  20 20 20 20 20 20 20 20  20 22 69 73 50 72 69 76
+   6.013470016999068e-154  2.5040037858705394e+262
+   6.013470016999068e-154  2.5040037858705394e+262
+  6b 65 79 22 3a 20 66 61  6c 73 65 2c 20 0a 20 20
+  1.5553509145528304e+161   5.981422731920023e-154
+  1.5553509145528304e+161   5.981422731920023e-154
+  20 20 20 20 20 20 20 20  20 20 22 69 73 54 65 73
+   6.013470016999068e-154   7.456842731009478e+247
+   6.013470016999068e-154   7.456842731009478e+247
+  74 6e 65 74 22 3a 20 74  72 75 65 0a 20 20 20 20
+   2.323630104420618e+251   6.013469534012111e-154
+   2.323630104420618e+251   6.013469534012111e-154
+  20 20 20 20 7d 0a 20 20  20 20 5d 2c 20 0a 20 20
+    5.98195165357277e-154    5.98142273119716e-154
+    5.98195165357277e-154    5.98142273119716e-154
+  20 20 5b 0a 20 20 20 20  20 20 20 20 22 35 4b 34
+   6.013469533114908e-154    8.668826191003425e-57
+   6.013469533114908e-154    8.668826191003425e-57
+  39 34 58 5a 77 70 73 32  62 47 79 65 4c 37 31 70
+    1.153671195027335e-65   2.672816617361268e+232
+    1.153671195027335e-65   2.672816617361268e+232
+  57 69 64 34 6e 6f 69 53  4e 41 32 63 66 43 69 62
+     6.63200907965104e+93  1.1638509941960705e+166
+     6.63200907965104e+93  1.1638509941960705e+166
+  72 76 52 57 71 63 48 53  70 74 6f 46 6e 37 72 63
+   1.5897646843593848e+93  1.0999757792200192e+171
+   1.5897646843593848e+93  1.0999757792200192e+171
+  22 2c 20 0a 20 20 20 20  20 20 20 20 22 61 33 32
+   6.013469527996216e-154    7.188228969039256e-67
+   6.013469527996216e-154    7.188228969039256e-67
+  36 62 39 35 65 62 61 65  33 30 31 36 34 32 31 37
+  2.2542706012031627e+180    7.711002046813953e-43
+  2.2542706012031627e+180    7.711002046813953e-43
+  64 37 61 37 66 35 37 64  37 32 61 62 32 62 35 34
+   5.740190116639266e+174   3.4066010405391794e-57
+   5.740190116639266e+174   3.4066010405391794e-57
+  65 33 62 65 36 34 39 32  38 61 31 39 64 61 30 32
+    9.348666497271827e-67    6.075841224799926e-67
+    9.348666497271827e-67    6.075841224799926e-67
+  31 30 62 39 35 36 38 64  34 30 31 35 65 22 2c 20
+   5.988301757874356e+174  1.0491780966433668e-153
+   5.988301757874356e+174  1.0491780966433668e-153
+  0a 20 20 20 20 20 20 20  20 7b 0a 20 20 20 20 20
+    6.01347001699904e-154   6.013470015119749e-154
+    6.01347001699904e-154   6.013470015119749e-154
+  20 20 20 20 20 20 20 22  69 73 43 6f 6d 70 72 65
+  2.5827657058487563e-144   4.782101395475446e+180
+  2.5827657058487563e-144   4.782101395475446e+180
+  73 73 65 64 22 3a 20 66  61 6c 73 65 2c 20 0a 20
+   8.618822568709162e+183   2.435677551670989e-154
+   8.618822568709162e+183   2.435677551670989e-154
+  20 20 20 20 20 20 20 20  20 20 20 22 69 73 50 72
+   6.013470016999068e-154   4.387772996371559e+242
+   6.013470016999068e-154   4.387772996371559e+242
+  69 76 6b 65 79 22 3a 20  74 72 75 65 2c 20 0a 20
+   1.949212354109114e-153  2.4356775517149174e-154
+   1.949212354109114e-153  2.4356775517149174e-154
+  20 20 20 20 20 20 20 20  20 20 20 22 69 73 54 65
+   6.013470016999068e-154  1.3259532540006391e+180
+   6.013470016999068e-154  1.3259532540006391e+180
+  73 74 6e 65 74 22 3a 20  66 61 6c 73 65 0a 20 20
+  1.9492066638986783e-153   5.981816938785917e-154
+  1.9492066638986783e-153   5.981816938785917e-154
+  20 20 20 20 20 20 7d 0a  20 20 20 20 5d 2c 20 0a
+   3.788584450517487e-258   6.574341888680965e-260
+   3.788584450517487e-258   6.574341888680965e-260
+  20 20 20 20 5b 0a 20 20  20 20 20 20 20 20 22 4c
+   5.981758184651215e-154    5.688777298226909e+58
+   5.981758184651215e-154    5.688777298226909e+58
+  31 52 72 72 6e 58 6b 63  4b 75 74 35 44 45 4d 77
+   8.256051621487889e+170   4.719080544640597e+266
+   8.256051621487889e+170   4.719080544640597e+266
+  74 44 74 68 6a 77 52 63  54 54 77 45 44 33 36 74
+   2.787670164618101e+170   6.357911270855384e+251
+   2.787670164618101e+170   6.357911270855384e+251
+  68 79 4c 31 44 65 62 56  72 4b 75 77 76 6f 68 6a
+  1.3500869898157449e+108  3.8305977646011893e+204
+  1.3500869898157449e+108  3.8305977646011893e+204
+  4d 4e 69 22 2c 20 0a 20  20 20 20 20 20 20 20 22
+   2.435677179139282e-154  2.5827657058487563e-144
+   2.435677179139282e-154  2.5827657058487563e-144
+  37 64 39 39 38 62 34 35  63 32 31 39 61 31 65 33
+   2.1281544888800223e-52    4.121364898986945e-61
+   2.1281544888800223e-52    4.121364898986945e-61
+  38 65 39 39 65 37 63 62  64 33 31 32 65 66 36 37
+   8.852774338306632e+165    1.004449915461072e-42
+   8.852774338306632e+165    1.004449915461072e-42
+  66 37 37 61 34 35 35 61  39 62 35 30 63 37 33 30
+  1.8635195546035673e+160   1.6595570017037622e-76
+  1.8635195546035673e+160   1.6595570017037622e-76
+  63 32 37 66 30 32 63 36  66 37 33 30 64 66 62 34
+   1.0507576877960921e-46   2.3450269920750903e-56
+   1.0507576877960921e-46   2.3450269920750903e-56
+  22 2c 20 0a 20 20 20 20  20 20 20 20 7b 0a 20 20
+   6.013469527996216e-154   5.981940273047973e-154
+   6.013469527996216e-154   5.981940273047973e-154
+  20 20 20 20 20 20 20 20  20 20 22 69 73 43 6f 6d
+   6.013470016999068e-154  1.3795078638833634e+219
+   6.013470016999068e-154  1.3795078638833634e+219
+  70 72 65 73 73 65 64 22  3a 20 74 72 75 65 2c 20
+   5.226889369249613e-143  1.0589472752989032e-153
+   5.226889369249613e-143  1.0589472752989032e-153
+  0a 20 20 20 20 20 20 20  20 20 20 20 20 22 69 73
+    6.01347001699904e-154   8.786501966149144e+247
+    6.01347001699904e-154   8.786501966149144e+247
+  50 72 69 76 6b 65 79 22  3a 20 74 72 75 65 2c 20
+  1.3016382627362237e-142  1.0589472752989032e-153
+  1.3016382627362237e-142  1.0589472752989032e-153
+  0a 20 20 20 20 20 20 20  20 20 20 20 20 22 69 73
+    6.01347001699904e-154   8.786501966149144e+247
+    6.01347001699904e-154   8.786501966149144e+247
+  54 65 73 74 6e 65 74 22  3a 20 66 61 6c 73 65 0a
+  1.0453739667527694e-142  1.3951429053043418e-258
+  1.0453739667527694e-142  1.3951429053043418e-258
+  20 20 20 20 20 20 20 20  7d 0a 20 20 20 20 5d 2c
+   6.013470016999068e-154    5.454244750788308e-95
+   6.013470016999068e-154    5.454244750788308e-95
+  20 0a 20 20 20 20 5b 0a  20 20 20 20 20 20 20 20
+   8.821071308809118e-259   6.013470016999068e-154
+   8.821071308809118e-259   6.013470016999068e-154
+  22 39 33 44 56 4b 79 46  59 77 53 4e 36 77 45 6f
+   3.2064315652472285e+31  1.0170240708572651e+228
+   3.2064315652472285e+31  1.0170240708572651e+228
+  33 45 32 66 43 72 46 50  55 70 31 37 46 74 72 74
+    5.198217424092402e+78     8.4561273237677e+252
+    5.198217424092402e+78     8.4561273237677e+252
+  4e 69 32 4c 66 37 6e 34  47 33 67 61 72 46 62 31
+    3.851000791378864e-56    8.274709530640273e-71
+    3.851000791378864e-56    8.274709530640273e-71
+  36 43 52 6a 22 2c 20 0a  20 20 20 20 20 20 20 20
+   6.573977732927292e-260   6.013470016999068e-154
+   6.573977732927292e-260   6.013470016999068e-154
+  22 64 36 62 63 61 32 35  36 62 35 61 62 63 35 36
+    1.919005672397691e-52    1.463441391996569e-47
+    1.919005672397691e-52    1.463441391996569e-47
+  30 32 65 63 32 65 31 63  31 32 31 61 30 38 62 30
+   6.564920899825624e+169   1.2587725696969854e-75
+   6.564920899825624e+169   1.2587725696969854e-75
+  64 61 32 35 35 36 35 38  37 34 33 30 62 63 66 37
+    6.233572893750605e-38    8.031378964232304e-42
+    6.233572893750605e-38    8.031378964232304e-42
+  65 31 38 39 38 61 66 32  32 32 34 38 38 35 32 30
+    6.640892707700888e-66    1.572463992327087e-76
+    6.640892707700888e-66    1.572463992327087e-76
+  33 22 2c 20 0a 20 20 20  20 20 20 20 20 7b 0a 20
+   6.013344832268919e-154  2.4688001838597158e-154
+   6.013344832268919e-154  2.4688001838597158e-154
+  20 20 20 20 20 20 20 20  20 20 20 22 69 73 43 6f
+   6.013470016999068e-154   9.215623337008235e+227
+   6.013470016999068e-154   9.215623337008235e+227
+  6d 70 72 65 73 73 65 64  22 3a 20 66 61 6c 73 65
+   4.244383508749611e+175    5.03734622854541e+180
+   4.244383508749611e+175    5.03734622854541e+180
+  2c 20 0a 20 20 20 20 20  20 20 20 20 20 20 20 22
+   6.013470015088901e-154  2.5827657058487563e-144
+   6.013470015088901e-154  2.5827657058487563e-144
+  69 73 50 72 69 76 6b 65  79 22 3a 20 74 72 75 65
+   3.561133256465674e+180   5.562188174538066e+180
+   3.561133256465674e+180   5.562188174538066e+180
+  2c 20 0a 20 20 20 20 20  20 20 20 20 20 20 20 22
+   6.013470015088901e-154  2.5827657058487563e-144
+   6.013470015088901e-154  2.5827657058487563e-144
+  69 73 54 65 73 74 6e 65  74 22 3a 20 74 72 75 65
+   3.949156961798742e+180   5.562188174538061e+180
+   3.949156961798742e+180   5.562188174538061e+180
+  0a 20 20 20 20 20 20 20  20 7d 0a 20 20 20 20 5d
+    6.01347001699904e-154   3.840616274033827e+140
+    6.01347001699904e-154   3.840616274033827e+140
+  2c 20 0a 20 20 20 20 5b  0a 20 20 20 20 20 20 20
+   8.942131591061345e+130    6.01347001699904e-154
+   8.942131591061345e+130    6.01347001699904e-154
+  20 22 63 54 44 56 4b 74  4d 47 56 59 57 54 48 43
+  1.5658022945870493e+252        13696267157540506
+  1.5658022945870493e+252        13696267157540506
+  62 31 41 46 6a 6d 56 62  45 62 57 6a 76 4b 70 4b
+   5.166026349761157e+165    2.497167098556151e+55
+   5.166026349761157e+165    2.497167098556151e+55
+  71 4b 67 4d 61 52 33 51  4a 78 54 6f 4d 53 51 41
+   1.4662443122539936e+83        4541749.739530632
+   1.4662443122539936e+83        4541749.739530632
+  68 6d 43 65 54 4e 22 2c  20 0a 20 20 20 20 20 20
+    4.285132579504886e-96   6.013470016991607e-154
+    4.285132579504886e-96   6.013470016991607e-154
+  20 20 22 61 38 31 63 61  34 65 38 66 39 30 31 38
+  1.3491305101311017e+161    5.051209676043676e-38
+  1.3491305101311017e+161    5.051209676043676e-38
+  31 65 63 34 62 36 31 62  36 61 37 65 62 39 39 38
+   9.911970007771268e+164    7.412713703778824e-38
+   9.911970007771268e+164    7.412713703778824e-38
+  61 66 31 37 62 32 63 62  30 34 64 65 38 61 30 33
+   8.843755366283138e+165    3.981700740410599e-62
+   8.843755366283138e+165    3.981700740410599e-62
+  62 35 30 34 62 39 65 33  34 63 34 63 36 31 64 62
+    4.127444971708057e-61   9.302336481528014e+165
+    4.127444971708057e-61   9.302336481528014e+165
+  37 64 39 22 2c 20 0a 20  20 20 20 20 20 20 20 7b
+   2.435677178099222e-154  1.1989438289530674e+285
+   2.435677178099222e-154  1.1989438289530674e+285
+  0a 20 20 20 20 20 20 20  20 20 20 20 20 22 69 73
+    6.01347001699904e-154   8.786501966149144e+247
+    6.01347001699904e-154   8.786501966149144e+247
+  43 6f 6d 70 72 65 73 73  65 64 22 3a 20 74 72 75
+   1.356172183488606e+248   5.541633531014472e+257
+   1.356172183488606e+248   5.541633531014472e+257
+  65 2c 20 0a 20 20 20 20  20 20 20 20 20 20 20 20
+   6.013469527996305e-154   6.013470016999068e-154
+   6.013469527996305e-154   6.013470016999068e-154
+  22 69 73 50 72 69 76 6b  65 79 22 3a 20 74 72 75
+   4.605064167587364e+209   5.541633531020207e+257
+   4.605064167587364e+209   5.541633531020207e+257
+  65 2c 20 0a 20 20 20 20  20 20 20 20 20 20 20 20
+   6.013469527996305e-154   6.013470016999068e-154
+   6.013469527996305e-154   6.013470016999068e-154
+  22 69 73 54 65 73 74 6e  65 74 22 3a 20 74 72 75
+  1.1827864699734312e+224   5.541633531018842e+257
+  1.1827864699734312e+224   5.541633531018842e+257
+  65 0a 20 20 20 20 20 20  20 20 7d 0a 20 20 20 20
+   6.013470016991698e-154    6.01346953606701e-154
+   6.013470016991698e-154    6.01346953606701e-154
+  5d 2c 20 0a 20 20 20 20  5b 0a 20 20 20 20 20 20
+   6.013469527996294e-154   6.013470016991685e-154
+   6.013469527996294e-154   6.013470016991685e-154
+  20 20 22 31 43 35 62 53  6a 31 69 45 47 55 67 53
+    4.747579671700145e+93    6.083891501660552e+93
+    4.747579671700145e+93    6.083891501660552e+93
+  54 62 7a 69 79 6d 47 37  43 6e 31 38 45 4e 51 75
+     2.10106286959439e-42  1.2992316210638265e+257
+     2.10106286959439e-42  1.2992316210638265e+257
+  54 33 36 76 76 22 2c 20  0a 20 20 20 20 20 20 20
+  1.0491879146122825e-153    6.01347001699904e-154
+  1.0491879146122825e-153    6.01347001699904e-154
+  20 22 37 39 38 37 63 63  61 61 35 33 64 30 32 63
+   5.801546880245967e+170     6.8644711730234e+169
+   5.801546880245967e+170     6.8644711730234e+169
+  38 38 37 33 34 38 37 65  66 39 31 39 36 37 37 63
+  3.7636667868929687e+179   8.761507052497533e+169
+  3.7636667868929687e+179   8.761507052497533e+169
+  64 33 64 62 37 61 36 39  31 32 22 2c 20 0a 20 20
+    4.310183326902189e-33   5.981422726080523e-154
+    4.310183326902189e-33   5.981422726080523e-154
+  20 20 20 20 20 20 7b 0a  20 20 20 20 20 20 20 20
+    3.52842852352625e-258   6.013470016999068e-154
+    3.52842852352625e-258   6.013470016999068e-154
+  20 20 20 20 22 61 64 64  72 54 79 70 65 22 3a 20
+    4.03236148217039e+175   1.949189642201022e-153
+    4.03236148217039e+175   1.949189642201022e-153
+  22 70 75 62 6b 65 79 22  2c 20 0a 20 20 20 20 20
+   1.301638201780595e-142   6.013470015088901e-154
+   1.301638201780595e-142   6.013470015088901e-154
+  20 20 20 20 20 20 20 22  69 73 50 72 69 76 6b 65
+  2.5827657058487563e-144   3.561133256465674e+180
+  2.5827657058487563e-144   3.561133256465674e+180
+  79 22 3a 20 66 61 6c 73  65 2c 20 0a 20 20 20 20
+   9.921696751788948e+247   6.013469527996305e-154
+   9.921696751788948e+247   6.013469527996305e-154
+  20 20 20 20 20 20 20 20  22 69 73 54 65 73 74 6e
+   6.013470016999068e-154  1.1827864699734312e+224
+   6.013470016999068e-154  1.1827864699734312e+224
+  65 74 22 3a 20 66 61 6c  73 65 0a 20 20 20 20 20
+  1.1714653744279156e+214   6.013470015112398e-154
+  1.1714653744279156e+214   6.013470015112398e-154
+  20 20 20 7d 0a 20 20 20  20 5d 2c 20 0a 20 20 20
+   6.013346898391935e-154   6.013344832288905e-154
+   6.013346898391935e-154   6.013344832288905e-154
+  20 5b 0a 20 20 20 20 20  20 20 20 22 33 41 6e 4e
+   6.013470015108896e-154    6.525317871949038e+69
+   6.013470015108896e-154    6.525317871949038e+69
+  78 61 62 59 47 6f 54 78  59 69 54 45 5a 77 46 45
+   4.318212393899883e+271    5.431998969136736e+25
+   4.318212393899883e+271    5.431998969136736e+25
+  6e 65 72 55 6f 65 46 58  4b 32 5a 6f 6b 73 22 2c
+  1.7649127918789433e+117    4.319047299271376e-96
+  1.7649127918789433e+117    4.319047299271376e-96
+  20 0a 20 20 20 20 20 20  20 20 22 36 33 62 63 63
+   6.013470016991607e-154   5.852236410427158e+170
+   6.013470016991607e-154   5.852236410427158e+170
+  35 36 35 66 39 65 36 38  65 65 30 31 38 39 64 64
+    6.581418630558375e-38    4.00151180496625e+175
+    6.581418630558375e-38    4.00151180496625e+175
+  35 63 63 36 37 66 31 62  30 65 35 66 30 32 66 34
+  1.0019566169024029e+165    2.828827946356489e-56
+  1.0019566169024029e+165    2.828827946356489e-56
+  35 63 62 22 2c 20 0a 20  20 20 20 20 20 20 20 7b
+  2.4356771789891082e-154  1.1989438289530674e+285
+  2.4356771789891082e-154  1.1989438289530674e+285
+  0a 20 20 20 20 20 20 20  20 20 20 20 20 22 61 64
+    6.01347001699904e-154   3.390069307505042e+175
+    6.01347001699904e-154   3.390069307505042e+175
+  64 72 54 79 70 65 22 3a  20 22 73 63 72 69 70 74
+   1.1609664343084283e-28     7.5203020051533e+252
+   1.1609664343084283e-28     7.5203020051533e+252
+  22 2c 20 0a 20 20 20 20  20 20 20 20 20 20 20 20
+   6.013469527996216e-154   6.013470016999068e-154
+   6.013469527996216e-154   6.013470016999068e-154
+  22 69 73 50 72 69 76 6b  65 79 22 3a 20 66 61 6c
+   4.605064167587364e+209  1.1714653744282218e+214
+   4.605064167587364e+209  1.1714653744282218e+214
+  73 65 2c 20 0a 20 20 20  20 20 20 20 20 20 20 20
+   6.013344832291728e-154   6.013470016999068e-154
+   6.013344832291728e-154   6.013470016999068e-154
+  20 22 69 73 54 65 73 74  6e 65 74 22 3a 20 66 61
+   8.887600345591531e+252  1.5553509144709964e+161
+   8.887600345591531e+252  1.5553509144709964e+161
+  6c 73 65 0a 20 20 20 20  20 20 20 20 7d 0a 20 20
+   6.013469534011425e-154    5.98195165357277e-154
+   6.013469534011425e-154    5.98195165357277e-154
+  20 20 5d 2c 20 0a 20 20  20 20 5b 0a 20 20 20 20
+    5.98142273119716e-154   6.013469533114908e-154
+    5.98142273119716e-154   6.013469533114908e-154
+  20 20 20 20 22 6e 33 4c  6e 4a 58 43 71 62 50 6a
+    1.219653936968681e+59   1.284255252294226e+204
+    1.219653936968681e+59   1.284255252294226e+204
+  67 68 75 56 73 38 70 68  39 43 59 73 41 65 34 53
+  1.1840818123285112e+195    6.647428521223099e+92
+  1.1840818123285112e+195    6.647428521223099e+92
+  68 34 6a 39 37 77 6b 22  2c 20 0a 20 20 20 20 20
+   7.038539065629933e-143   6.013470015088901e-154
+   7.038539065629933e-143   6.013470015088901e-154
+  20 20 20 22 65 66 36 36  34 34 34 62 35 62 31 37
+   1.5326688728615763e-47     7.79508797328242e-43
+   1.5326688728615763e-47     7.79508797328242e-43
+  66 31 34 65 38 66 61 65  36 65 37 65 31 39 62 30
+   2.256208063746387e+180   1.2590435207560333e-75
+   2.256208063746387e+180   1.2590435207560333e-75
+  34 35 61 37 38 63 35 34  66 64 37 39 22 2c 20 0a
+    3.407237518950043e-57   6.573976543167639e-260
+    3.407237518950043e-57   6.573976543167639e-260
+  20 20 20 20 20 20 20 20  7b 0a 20 20 20 20 20 20
+   6.013470016999068e-154   6.013470016991727e-154
+   6.013470016999068e-154   6.013470016991727e-154
+  20 20 20 20 20 20 22 61  64 64 72 54 79 70 65 22
+   7.963380651952609e+159  5.4941904516250855e-143
+   7.963380651952609e+159  5.4941904516250855e-143
+  3a 20 22 70 75 62 6b 65  79 22 2c 20 0a 20 20 20
+   3.551026330083098e+180   6.013344832269012e-154
+   3.551026330083098e+180   6.013344832269012e-154
+  20 20 20 20 20 20 20 20  20 22 69 73 50 72 69 76
+   6.013470016999068e-154  2.5040037858705394e+262
+   6.013470016999068e-154  2.5040037858705394e+262
+  6b 65 79 22 3a 20 66 61  6c 73 65 2c 20 0a 20 20
+  1.5553509145528304e+161   5.981422731920023e-154
+  1.5553509145528304e+161   5.981422731920023e-154
+  20 20 20 20 20 20 20 20  20 20 22 69 73 54 65 73
+   6.013470016999068e-154   7.456842731009478e+247
+   6.013470016999068e-154   7.456842731009478e+247
+  74 6e 65 74 22 3a 20 74  72 75 65 0a 20 20 20 20
+   2.323630104420618e+251   6.013469534012111e-154
+   2.323630104420618e+251   6.013469534012111e-154
+  20 20 20 20 7d 0a 20 20  20 20 5d 2c 20 0a 20 20
+    5.98195165357277e-154    5.98142273119716e-154
+    5.98195165357277e-154    5.98142273119716e-154
+  20 20 5b 0a 20 20 20 20  20 20 20 20 22 32 4e 42
+   6.013469533114908e-154       259380232256.25098
+   6.013469533114908e-154       259380232256.25098
+  37 32 58 74 6b 6a 70 6e  41 54 4d 67 67 75 69 38
+   9.494153613985326e+223    5.985290226565637e-37
+   9.494153613985326e+223    5.985290226565637e-37
+  33 61 45 74 50 61 77 79  79 4b 76 6e 62 58 32 6f
+  1.2951588037280802e+277   4.345906914218121e+227
+  1.2951588037280802e+277   4.345906914218121e+227
+  22 2c 20 0a 20 20 20 20  20 20 20 20 22 63 33 65
+   6.013469527996216e-154   3.142486405940112e+179
+   6.013469527996216e-154   3.142486405940112e+179
+  35 35 66 63 65 63 65 61  61 34 33 39 31 65 64 32
+  1.5034994391335662e+161    6.052024536057842e-66
+  1.5034994391335662e+161    6.052024536057842e-66
+  61 39 36 37 37 66 34 61  34 64 33 34 65 61 63 64
+  1.7924727011714452e+160   3.834699682138088e+175
+  1.7924727011714452e+160   3.834699682138088e+175
+  30 32 31 61 30 22 2c 20  0a 20 20 20 20 20 20 20
+   1.049148036054106e-153    6.01347001699904e-154
+   1.049148036054106e-153    6.01347001699904e-154
+  20 7b 0a 20 20 20 20 20  20 20 20 20 20 20 20 22
+   6.013470015119749e-154  2.5827657058487563e-144
+   6.013470015119749e-154  2.5827657058487563e-144
+  61 64 64 72 54 79 70 65  22 3a 20 22 73 63 72 69
+   4.272430653488194e+180   8.797167573717661e+199
+   4.272430653488194e+180   8.797167573717661e+199
+  70 74 22 2c 20 0a 20 20  20 20 20 20 20 20 20 20
+   5.981422726102992e-154   6.013470016999068e-154
+   5.981422726102992e-154   6.013470016999068e-154
+  20 20 22 69 73 50 72 69  76 6b 65 79 22 3a 20 66
+   8.761662860649562e+199   8.618823233529423e+183
+   8.761662860649562e+199   8.618823233529423e+183
+  61 6c 73 65 2c 20 0a 20  20 20 20 20 20 20 20 20
+   2.435677551670989e-154   6.013470016999068e-154
+   2.435677551670989e-154   6.013470016999068e-154
+  20 20 20 22 69 73 54 65  73 74 6e 65 74 22 3a 20
+  1.3259532540006391e+180  1.9492066638986783e-153
+  1.3259532540006391e+180  1.9492066638986783e-153
+  74 72 75 65 0a 20 20 20  20 20 20 20 20 7d 0a 20
+   6.013346372338011e-154   2.469528537446747e-154
+   6.013346372338011e-154   2.469528537446747e-154
+  20 20 20 5d 2c 20 0a 20  20 20 20 5b 0a 20 20 20
+  2.4356775054076983e-154    6.01334614265396e-154
+  2.4356775054076983e-154    6.01334614265396e-154
+  20 20 20 20 20 22 35 4b  61 42 57 39 76 4e 74 57
+    2.024168259094329e+54  1.9534094290347594e+113
+    2.024168259094329e+54  1.9534094290347594e+113
+  4e 68 63 33 5a 45 44 79  4e 43 69 58 4c 50 64 56
+  1.4036513100068693e+276  1.4908595974485985e+108
+  1.4036513100068693e+276  1.4908595974485985e+108
+  50 48 43 69 6b 52 78 53  42 57 77 56 39 4e 72 70
+   1.2683440677892206e+94   4.547154691701283e+233
+   1.2683440677892206e+94   4.547154691701283e+233
+  4c 4c 61 34 4c 73 58 69  39 22 2c 20 0a 20 20 20
+  2.9243058121539328e+199   6.013344832268927e-154
+  2.9243058121539328e+199   6.013344832268927e-154
+  20 20 20 20 20 22 65 37  35 64 39 33 36 64 35 36
+    7.581200541216313e-42    1.463662542785468e-47
+    7.581200541216313e-42    1.463662542785468e-47
+  33 37 37 66 34 33 32 66  34 30 34 61 61 62 62 34
+   1.933344237771442e+184    2.343030165364447e-56
+   1.933344237771442e+184    2.343030165364447e-56
+  30 36 36 30 31 66 38 39  32 66 64 34 39 64 61 39
+    4.699112689252933e-33   2.6795845226309603e-32
+    4.699112689252933e-33   2.6795845226309603e-32
+  30 65 62 36 61 63 35 35  38 61 37 33 33 63 39 33
+   2.2330324909933063e-52   6.1713593895607745e-62
+   2.2330324909933063e-52   6.1713593895607745e-62
+  62 34 37 32 35 32 22 2c  20 0a 20 20 20 20 20 20
+    4.259418222793847e-96   6.013470016991607e-154
+    4.259418222793847e-96   6.013470016991607e-154
+  20 20 7b 0a 20 20 20 20  20 20 20 20 20 20 20 20
+   6.013469535893356e-154   6.013470016999068e-154
+   6.013469535893356e-154   6.013470016999068e-154
+  22 69 73 43 6f 6d 70 72  65 73 73 65 64 22 3a 20
+  1.7526186726551543e+243  1.9491884551457575e-153
+  1.7526186726551543e+243  1.9491884551457575e-153
+  66 61 6c 73 65 2c 20 0a  20 20 20 20 20 20 20 20
+   6.574393527702649e-260   6.013470016999068e-154
+   6.574393527702649e-260   6.013470016999068e-154
+  20 20 20 20 22 69 73 50  72 69 76 6b 65 79 22 3a
+      3.5961645426119e+79   1.1658861701882902e-28
+      3.5961645426119e+79   1.1658861701882902e-28
+  20 74 72 75 65 2c 20 0a  20 20 20 20 20 20 20 20
+   6.574393576735255e-260   6.013470016999068e-154
+   6.574393576735255e-260   6.013470016999068e-154
+  20 20 20 20 22 69 73 54  65 73 74 6e 65 74 22 3a
+    6.633752696451049e+98   1.1646535862798119e-28
+    6.633752696451049e+98   1.1646535862798119e-28
+  20 66 61 6c 73 65 0a 20  20 20 20 20 20 20 20 7d
+   2.460906791088173e-154   5.149424535094442e+294
+   2.460906791088173e-154   5.149424535094442e+294
+  0a 20 20 20 20 5d 2c 20  0a 20 20 20 20 5b 0a 20
+  1.0577333593336978e-153   2.457146526467208e-154
+  1.0577333593336978e-153   2.457146526467208e-154
+  20 20 20 20 20 20 20 22  4c 31 61 78 7a 62 53 79
+  2.5827657058487563e-144  2.6845698040364246e+276
+  2.5827657058487563e-144  2.6845698040364246e+276
+  79 6e 4e 59 41 38 6d 43  41 68 7a 78 6b 69 70 4b
+        65797021175608264    2.515100437377925e+55
+        65797021175608264    2.515100437377925e+55
+  6b 66 48 74 41 58 59 46  34 59 51 6e 68 53 4b 63
+    8.032071492116877e+30   2.062531772393076e+170
+    8.032071492116877e+30   2.062531772393076e+170
+  4c 56 38 59 58 41 38 37  34 66 67 54 22 2c 20 0a
+   1.0876432211317335e-42   6.573977201891763e-260
+   1.0876432211317335e-42   6.573977201891763e-260
+  20 20 20 20 20 20 20 20  22 38 32 34 38 62 64 30
+   6.013470016999068e-154   1.4082944862697987e-75
+   6.013470016999068e-154   1.4082944862697987e-75
+  33 37 35 66 32 66 37 35  64 37 65 32 37 34 61 65
+   2.4429911508436627e-52   2.230879059289602e+180
+   2.4429911508436627e-52   2.230879059289602e+180
+  35 34 34 66 62 39 32 30  66 35 31 37 38 34 34 38
+   1.5738689769908295e-76    5.937416906058621e-38
+   1.5738689769908295e-76    5.937416906058621e-38
+  30 38 36 36 62 31 30 32  33 38 34 31 39 30 62 31
+    6.006282223967881e-67     8.23540329951255e-71
+    6.006282223967881e-67     8.23540329951255e-71
+  61 64 64 66 62 61 61 35  63 22 2c 20 0a 20 20 20
+   1.4516793870624688e-51   6.013344832268983e-154
+   1.4516793870624688e-51   6.013344832268983e-154
+  20 20 20 20 20 7b 0a 20  20 20 20 20 20 20 20 20
+  2.4688001838597158e-154   6.013470016999068e-154
+  2.4688001838597158e-154   6.013470016999068e-154
+  20 20 20 22 69 73 43 6f  6d 70 72 65 73 73 65 64
+   9.215623337008235e+227   4.244383508749611e+175
+   9.215623337008235e+227   4.244383508749611e+175
+  22 3a 20 74 72 75 65 2c  20 0a 20 20 20 20 20 20
+    8.037044162805465e-95   6.013470016991607e-154
+    8.037044162805465e-95   6.013470016991607e-154
+  20 20 20 20 20 20 22 69  73 50 72 69 76 6b 65 79
+    2.70979801693884e+198   5.932816947191957e+276
+    2.70979801693884e+198   5.932816947191957e+276
+  22 3a 20 74 72 75 65 2c  20 0a 20 20 20 20 20 20
+    8.037044162805465e-95   6.013470016991607e-154
+    8.037044162805465e-95   6.013470016991607e-154
+  20 20 20 20 20 20 22 69  73 54 65 73 74 6e 65 74
+    2.70979801693884e+198  4.9101891977339775e+252
+    2.70979801693884e+198  4.9101891977339775e+252
+  22 3a 20 66 61 6c 73 65  0a 20 20 20 20 20 20 20
+    5.03734622854541e+180    6.01347001699904e-154
+    5.03734622854541e+180    6.01347001699904e-154
+  20 7d 0a 20 20 20 20 5d  2c 20 0a 20 20 20 20 5b
+   3.840616274033827e+140   8.942131591061345e+130
+   3.840616274033827e+140   8.942131591061345e+130
+  0a 20 20 20 20 20 20 20  20 22 39 32 37 43 6e 55
+    6.01347001699904e-154  3.3890205916460507e+103
+    6.01347001699904e-154  3.3890205916460507e+103
+  6b 55 62 61 73 59 74 44  77 59 77 56 6e 32 6a 38
+    6.006087744653698e+21    6.158884189652102e-37
+    6.006087744653698e+21    6.158884189652102e-37
+  47 64 54 75 41 43 4e 6e  4b 6b 6a 5a 31 72 70 5a
+   2.187835822876284e+223  4.4530769133861155e+127
+   2.187835822876284e+223  4.4530769133861155e+127
+  64 32 79 42 42 31 43 4c  63 6e 58 70 6f 22 2c 20
+    2.409455117823058e+59  1.0491839183892642e-153
+    2.409455117823058e+59  1.0491839183892642e-153
+  0a 20 20 20 20 20 20 20  20 22 34 34 63 34 66 36
+    6.01347001699904e-154    1.215442427953683e-46
+    6.01347001699904e-154    1.215442427953683e-46
+  61 30 39 36 65 61 63 35  32 33 38 32 39 31 61 39
+   1.6187307650598632e-51   2.6488899941896203e-32
+   1.6187307650598632e-51   2.6488899941896203e-32
+  34 63 63 32 34 63 30 31  65 33 62 31 39 62 38 64
+    9.275004915300597e-72    6.03082664854164e+174
+    9.275004915300597e-72    6.03082664854164e+174
+  38 63 65 66 37 32 38 37  34 61 30 37 39 65 30 30
+   1.0849932422111438e-42    1.415934749816447e-76
+   1.0849932422111438e-42    1.415934749816447e-76
+  61 32 34 32 32 33 37 61  35 32 22 2c 20 0a 20 20
+   2.038568967154561e+160   5.981422726080528e-154
+   2.038568967154561e+160   5.981422726080528e-154
+  20 20 20 20 20 20 7b 0a  20 20 20 20 20 20 20 20
+    3.52842852352625e-258   6.013470016999068e-154
+    3.52842852352625e-258   6.013470016999068e-154
+  20 20 20 20 22 69 73 43  6f 6d 70 72 65 73 73 65
+    8.741791754053274e+16   5.044453705302714e+180
+    8.741791754053274e+16   5.044453705302714e+180
+  64 22 3a 20 66 61 6c 73  65 2c 20 0a 20 20 20 20
+   9.921696751788922e+247   6.013469527996305e-154
+   9.921696751788922e+247   6.013469527996305e-154
+  20 20 20 20 20 20 20 20  22 69 73 50 72 69 76 6b
+   6.013470016999068e-154   4.605064167587364e+209
+   6.013470016999068e-154   4.605064167587364e+209
+  65 79 22 3a 20 74 72 75  65 2c 20 0a 20 20 20 20
+   5.541633531020207e+257   6.013469527996305e-154
+   5.541633531020207e+257   6.013469527996305e-154
+  20 20 20 20 20 20 20 20  22 69 73 54 65 73 74 6e
+   6.013470016999068e-154  1.1827864699734312e+224
+   6.013470016999068e-154  1.1827864699734312e+224
+  65 74 22 3a 20 74 72 75  65 0a 20 20 20 20 20 20
+   5.541633531018842e+257   6.013470016991698e-154
+   5.541633531018842e+257   6.013470016991698e-154
+  20 20 7d 0a 20 20 20 20  5d 2c 20 0a 20 20 20 20
+    6.01346953606701e-154   6.013469527996294e-154
+    6.01346953606701e-154   6.013469527996294e-154
+  5b 0a 20 20 20 20 20 20  20 20 22 63 55 63 66 43
+   6.013470016991685e-154    5.041334299348198e+16
+   6.013470016991685e-154    5.041334299348198e+16
+  4d 52 6a 69 51 66 38 35  59 4d 7a 7a 51 45 6b 39
+    2.547445428140862e-52   4.2017280991675396e-32
+    2.547445428140862e-52   4.2017280991675396e-32
+  64 31 73 35 41 34 4b 37  78 4c 35 53 6d 42 43 4c
+   2.4397498617174583e-42    2.417874390425128e+59
+   2.4397498617174583e-42    2.417874390425128e+59
+  72 65 7a 71 58 46 75 54  56 65 66 79 68 59 37 22
+    7.270827088570481e+98   7.479542321786914e-144
+    7.270827088570481e+98   7.479542321786914e-144
+  2c 20 0a 20 20 20 20 20  20 20 20 22 64 31 64 65
+   6.013470015088901e-154  2.6184654590789027e+180
+   6.013470015088901e-154  2.6184654590789027e+180
+  37 30 37 30 32 30 61 39  30 35 39 64 36 64 33 61
+   2.6482716657576977e-32  1.7039157063201323e+160
+   2.6482716657576977e-32  1.7039157063201323e+160
+  62 61 66 38 35 65 31 37  39 36 37 63 36 35 35 35
+    7.800341725201129e-43   2.2142040166815877e-52
+    7.800341725201129e-43   2.2142040166815877e-52
+  31 35 31 31 34 33 64 62  31 33 64 62 62 30 36 64
+   9.305920180157443e+165   5.488014581492255e+174
+   9.305920180157443e+165   5.488014581492255e+174
+  62 37 38 64 66 30 66 31  35 63 36 39 22 2c 20 0a
+   1.0046851394156591e-70   6.573976543072554e-260
+   1.0046851394156591e-70   6.573976543072554e-260
+  20 20 20 20 20 20 20 20  7b 0a 20 20 20 20 20 20
+   6.013470016999068e-154   6.013470016991727e-154
+   6.013470016999068e-154   6.013470016991727e-154
+  20 20 20 20 20 20 22 69  73 43 6f 6d 70 72 65 73
+    2.70979801693884e+198   7.497795098079407e+247
+    2.70979801693884e+198   7.497795098079407e+247
+  73 65 64 22 3a 20 74 72  75 65 2c 20 0a 20 20 20
+  2.1471952862173123e+243   6.013344832291731e-154
+  2.1471952862173123e+243   6.013344832291731e-154
+  20 20 20 20 20 20 20 20  20 22 69 73 50 72 69 76
+   6.013470016999068e-154  2.5040037858705394e+262
+   6.013470016999068e-154  2.5040037858705394e+262
+  6b 65 79 22 3a 20 74 72  75 65 2c 20 0a 20 20 20
+  2.1471952867389554e+243   6.013344832291731e-154
+  2.1471952867389554e+243   6.013344832291731e-154
+  20 20 20 20 20 20 20 20  20 22 69 73 54 65 73 74
+   6.013470016999068e-154   8.887600345591531e+252
+   6.013470016999068e-154   8.887600345591531e+252
+  6e 65 74 22 3a 20 74 72  75 65 0a 20 20 20 20 20
+   2.147195286614755e+243     6.0134700151124e-154
+   2.147195286614755e+243     6.0134700151124e-154
+  20 20 20 7d 0a 20 20 20  20 5d 2c 20 0a 20 20 20
+   6.013346898391935e-154   6.013344832288905e-154
+   6.013346898391935e-154   6.013344832288905e-154
+  20 5b 0a 20 20 20 20 20  20 20 20 22 31 47 71 6b
+   6.013470015108896e-154    3.55019998999946e+209
+   6.013470015108896e-154    3.55019998999946e+209
+  34 54 76 37 39 50 39 31  43 63 31 53 54 51 74 55
+   1.4326861425302637e-71  4.5506445951149586e+103
+   1.4326861425302637e-71  4.5506445951149586e+103
+  33 73 31 57 36 32 37 37  4d 32 43 56 57 75 22 2c
+   1.0401509664912596e-42    4.320804292319861e-96
+   1.0401509664912596e-42    4.320804292319861e-96
+  20 0a 20 20 20 20 20 20  20 20 22 61 64 63 31 63
+   6.013470016991607e-154   6.562260371281494e+169
+   6.013470016991607e-154   6.562260371281494e+169
+  63 32 30 38 31 61 32 37  32 30 36 66 61 65 32 35
+    8.241723366695785e-43   1.9206338372179976e-52
+    8.241723366695785e-43   1.9206338372179976e-52
+  37 39 32 66 32 38 62 62  63 35 35 62 38 33 31 35
+   8.393527858964527e+165   1.7957720475832926e-52
+   8.393527858964527e+165   1.7957720475832926e-52
+  34 39 64 22 2c 20 0a 20  20 20 20 20 20 20 20 7b
+    2.43567717902896e-154  1.1989438289530674e+285
+    2.43567717902896e-154  1.1989438289530674e+285
+  0a 20 20 20 20 20 20 20  20 20 20 20 20 22 61 64
+    6.01347001699904e-154   3.390069307505042e+175
+    6.01347001699904e-154   3.390069307505042e+175
+  64 72 54 79 70 65 22 3a  20 22 70 75 62 6b 65 79
+   1.1609664343084283e-28   5.932732618036777e+276
+   1.1609664343084283e-28   5.932732618036777e+276
+  22 2c 20 0a 20 20 20 20  20 20 20 20 20 20 20 20
+   6.013469527996216e-154   6.013470016999068e-154
+   6.013469527996216e-154   6.013470016999068e-154
+  22 69 73 50 72 69 76 6b  65 79 22 3a 20 66 61 6c
+   4.605064167587364e+209  1.1714653744282218e+214
+   4.605064167587364e+209  1.1714653744282218e+214
+  73 65 2c 20 0a 20 20 20  20 20 20 20 20 20 20 20
+   6.013344832291728e-154   6.013470016999068e-154
+   6.013344832291728e-154   6.013470016999068e-154
+  20 22 69 73 54 65 73 74  6e 65 74 22 3a 20 66 61
+   8.887600345591531e+252  1.5553509144709964e+161
+   8.887600345591531e+252  1.5553509144709964e+161
+  6c 73 65 0a 20 20 20 20  20 20 20 20 7d 0a 20 20
+   6.013469534011425e-154    5.98195165357277e-154
+   6.013469534011425e-154    5.98195165357277e-154
+  20 20 5d 2c 20 0a 20 20  20 20 5b 0a 20 20 20 20
+    5.98142273119716e-154   6.013469533114908e-154
+    5.98142273119716e-154   6.013469533114908e-154
+  20 20 20 20 22 33 33 76  74 38 56 69 48 35 6a 73
+   2.361628543091791e+261   9.162259441014737e+247
+   2.361628543091791e+261   9.162259441014737e+247
+  72 31 31 35 41 47 6b 57  36 63 45 6d 45 7a 39 4d
+  1.3120376857071705e+113   1.0480885723995106e+64
+  1.3120376857071705e+113   1.0480885723995106e+64
+  70 76 4a 53 77 44 6b 22  2c 20 0a 20 20 20 20 20
+   6.987736602337444e-143   6.013470015088901e-154
+   6.987736602337444e-143   6.013470015088901e-154
+  20 20 20 22 31 38 38 66  39 31 61 39 33 31 39 34
+  2.5727792930985937e+184   4.0133470716775623e-57
+  2.5727792930985937e+184   4.0133470716775623e-57
+  37 65 64 64 64 37 34 33  32 64 36 65 36 31 34 33
+    4.914328683636594e-62     4.90846073139156e-62
+    4.914328683636594e-62     4.90846073139156e-62
+  38 37 65 33 32 62 32 34  34 37 30 39 22 2c 20 0a
+    2.928673021056853e-57    6.57397654248842e-260
+    2.928673021056853e-57    6.57397654248842e-260
+  20 20 20 20 20 20 20 20  7b 0a 20 20 20 20 20 20
+   6.013470016999068e-154   6.013470016991727e-154
+   6.013470016999068e-154   6.013470016991727e-154
+  20 20 20 20 20 20 22 61  64 64 72 54 79 70 65 22
+   7.963380651952609e+159  5.4941904516250855e-143
+   7.963380651952609e+159  5.4941904516250855e-143
+  3a 20 22 73 63 72 69 70  74 22 2c 20 0a 20 20 20
+  3.1605331151745443e+233   6.013344832269005e-154
+  3.1605331151745443e+233   6.013344832269005e-154
+  20 20 20 20 20 20 20 20  20 22 69 73 50 72 69 76
+   6.013470016999068e-154  2.5040037858705394e+262
+   6.013470016999068e-154  2.5040037858705394e+262
+  6b 65 79 22 3a 20 66 61  6c 73 65 2c 20 0a 20 20
+  1.5553509145528304e+161   5.981422731920023e-154
+  1.5553509145528304e+161   5.981422731920023e-154
+  20 20 20 20 20 20 20 20  20 20 22 69 73 54 65 73
+   6.013470016999068e-154   7.456842731009478e+247
+   6.013470016999068e-154   7.456842731009478e+247
+  74 6e 65 74 22 3a 20 66  61 6c 73 65 0a 20 20 20
+   8.618823075239411e+183   6.013346372162298e-154
+   8.618823075239411e+183   6.013346372162298e-154
+  20 20 20 20 20 7d 0a 20  20 20 20 5d 2c 20 0a 20
+   2.469528537446747e-154  2.4356775054076983e-154
+   2.469528537446747e-154  2.4356775054076983e-154
+  20 20 20 5b 0a 20 20 20  20 20 20 20 20 22 6d 68
+    6.01334614265396e-154  1.0633517083685635e+195
+    6.01334614265396e-154  1.0633517083685635e+195
+  61 4d 63 42 78 4e 68 35  63 71 58 6d 34 61 54 51
+   2.0301754873241398e-51    6.186097080483283e+83
+   2.0301754873241398e-51    6.186097080483283e+83
+  36 45 63 56 62 4b 74 66  4c 36 4c 47 79 4b 32 48
+  3.4493323738470666e+185     6.22540441826987e+39
+  3.4493323738470666e+185     6.22540441826987e+39
+  22 2c 20 0a 20 20 20 20  20 20 20 20 22 31 36 39
+   6.013469527996216e-154    4.274009666296067e-33
+   6.013469527996216e-154    4.274009666296067e-33
+  34 66 35 62 63 31 61 37  32 39 35 62 36 30 30 66
+    6.167658549791665e-42  1.7196474024072027e+184
+    6.167658549791665e-42  1.7196474024072027e+184
+  34 30 30 31 38 61 36 31  38 61 36 65 61 34 38 65
+    1.266649735575269e-71   3.923336357207456e+179
+    1.266649735575269e-71   3.923336357207456e+179
+  65 62 34 39 38 22 2c 20  0a 20 20 20 20 20 20 20
+   1.049152499381358e-153    6.01347001699904e-154
+   1.049152499381358e-153    6.01347001699904e-154
+  20 7b 0a 20 20 20 20 20  20 20 20 20 20 20 20 22
+   6.013470015119749e-154  2.5827657058487563e-144
+   6.013470015119749e-154  2.5827657058487563e-144
+  61 64 64 72 54 79 70 65  22 3a 20 22 70 75 62 6b
+   4.272430653488194e+180   1.896396345774036e+209
+   4.272430653488194e+180   1.896396345774036e+209
+  65 79 22 2c 20 0a 20 20  20 20 20 20 20 20 20 20
+   5.981422726104673e-154   6.013470016999068e-154
+   5.981422726104673e-154   6.013470016999068e-154
+  20 20 22 69 73 50 72 69  76 6b 65 79 22 3a 20 66
+   8.761662860649562e+199   8.618823233529423e+183
+   8.761662860649562e+199   8.618823233529423e+183
+  61 6c 73 65 2c 20 0a 20  20 20 20 20 20 20 20 20
+   2.435677551670989e-154   6.013470016999068e-154
+   2.435677551670989e-154   6.013470016999068e-154
+  20 20 20 22 69 73 54 65  73 74 6e 65 74 22 3a 20
+  1.3259532540006391e+180  1.9492066638986783e-153
+  1.3259532540006391e+180  1.9492066638986783e-153
+  74 72 75 65 0a 20 20 20  20 20 20 20 20 7d 0a 20
+   6.013346372338011e-154   2.469528537446747e-154
+   6.013346372338011e-154   2.469528537446747e-154
+  20 20 20 5d 2c 20 0a 20  20 20 20 5b 0a 20 20 20
+  2.4356775054076983e-154    6.01334614265396e-154
+  2.4356775054076983e-154    6.01334614265396e-154
+  20 20 20 20 20 22 32 4d  78 67 50 71 58 31 69 54
+    7.459608056420493e+63    4.304911979186009e+98
+    7.459608056420493e+63    4.304911979186009e+98
+  68 57 33 6f 5a 56 6b 39  4b 6f 46 63 45 35 4d 34
+    4.211980657330775e-32    9.306234391278426e-57
+    4.211980657330775e-32    9.306234391278426e-57
+  4a 70 69 45 54 73 73 56  4e 22 2c 20 0a 20 20 20
+   2.855021148096633e+108   6.013344832268955e-154
+   2.855021148096633e+108   6.013344832268955e-154
+  20 20 20 20 20 22 33 62  39 62 33 66 64 37 61 35
+  1.1018122167623396e+165   1.4379787956736666e-51
+  1.1018122167623396e+165   1.4379787956736666e-51
+  30 64 34 66 30 38 64 31  61 35 62 30 66 36 32 66
+    9.155059955925823e-71   1.934669796821859e+184
+    9.155059955925823e-71   1.934669796821859e+184
+  36 34 34 66 61 37 31 31  35 61 65 32 66 33 22 2c
+     9.74409743071167e-72    4.260507635167792e-96
+     9.74409743071167e-72    4.260507635167792e-96
+  20 0a 20 20 20 20 20 20  20 20 7b 0a 20 20 20 20
+   6.013470016991607e-154   6.013469535893356e-154
+   6.013470016991607e-154   6.013469535893356e-154
+  20 20 20 20 20 20 20 20  22 61 64 64 72 54 79 70
+   6.013470016999068e-154   6.292013152771389e+233
+   6.013470016999068e-154   6.292013152771389e+233
+  65 22 3a 20 22 73 63 72  69 70 74 22 2c 20 0a 20
+  1.0375291479983522e+243   2.435677179380947e-154
+  1.0375291479983522e+243   2.435677179380947e-154
+  20 20 20 20 20 20 20 20  20 20 20 22 69 73 50 72
+   6.013470016999068e-154   4.387772996371559e+242
+   6.013470016999068e-154   4.387772996371559e+242
+  69 76 6b 65 79 22 3a 20  66 61 6c 73 65 2c 20 0a
+   1.949212354109114e-153   6.574393527702649e-260
+   1.949212354109114e-153   6.574393527702649e-260
+  20 20 20 20 20 20 20 20  20 20 20 20 22 69 73 54
+   6.013470016999068e-154    6.633752696451049e+98
+   6.013470016999068e-154    6.633752696451049e+98
+  65 73 74 6e 65 74 22 3a  20 74 72 75 65 0a 20 20
+   1.1646535862798119e-28   5.981816983768403e-154
+   1.1646535862798119e-28   5.981816983768403e-154
+  20 20 20 20 20 20 7d 0a  20 20 20 20 5d 2c 20 0a
+   3.788584450517487e-258   6.574341888680965e-260
+   3.788584450517487e-258   6.574341888680965e-260
+  20 20 20 20 5b 0a 20 20  20 20 20 20 20 20 22 35
+   5.981758184651215e-154    9.461947372890723e-53
+   5.981758184651215e-154    9.461947372890723e-53
+  48 74 48 36 47 64 63 77  43 4a 41 34 67 67 57 45
+   1.250553612387938e+267    1.131744055155362e+26
+   1.250553612387938e+267    1.131744055155362e+26
+  4c 31 42 33 6a 7a 42 42  55 42 38 48 50 69 42 69
+       158726383236.38513  1.1010157271701828e+199
+       158726383236.38513  1.1010157271701828e+199
+  39 53 42 63 35 68 39 69  34 57 6b 34 50 53 65 41
+   7.596816705267219e+198       11180673.638103105
+   7.596816705267219e+198       11180673.638103105
+  70 52 22 2c 20 0a 20 20  20 20 20 20 20 20 22 30
+    5.98142272609146e-154    7.826739423852259e-77
+    5.98142272609146e-154    7.826739423852259e-77
+  39 31 30 33 35 34 34 35  65 66 31 30 35 66 61 31
+   2.1093894216970816e-52     7.87810079783107e-71
+   2.1093894216970816e-52     7.87810079783107e-71
+  62 62 31 32 35 65 63 63  66 62 31 38 38 32 66 33
+   5.855783643065885e+170    4.316472098295246e-61
+   5.855783643065885e+170    4.316472098295246e-61
+  66 65 36 39 35 39 32 32  36 35 39 35 36 61 64 65
+    6.759460098693198e-67   2.642688156887278e+180
+    6.759460098693198e-67   2.642688156887278e+180
+  37 35 31 66 64 30 39 35  30 33 33 64 38 64 30 22
+    2.629857645738254e-52   5.250738552569746e-144
+    2.629857645738254e-52   5.250738552569746e-144
+  2c 20 0a 20 20 20 20 20  20 20 20 7b 0a 20 20 20
+   6.013470015088901e-154    6.01334685393676e-154
+   6.013470015088901e-154    6.01334685393676e-154
+  20 20 20 20 20 20 20 20  20 22 69 73 43 6f 6d 70
+   6.013470016999068e-154  3.6558227758146443e+233
+   6.013470016999068e-154  3.6558227758146443e+233
+  72 65 73 73 65 64 22 3a  20 66 61 6c 73 65 2c 20
+    1.160709300546122e-28  1.0589461237472713e-153
+    1.160709300546122e-28  1.0589461237472713e-153
+  0a 20 20 20 20 20 20 20  20 20 20 20 20 22 69 73
+    6.01347001699904e-154   8.786501966149144e+247
+    6.01347001699904e-154   8.786501966149144e+247
+  50 72 69 76 6b 65 79 22  3a 20 74 72 75 65 2c 20
+  1.3016382627362237e-142  1.0589472752989032e-153
+  1.3016382627362237e-142  1.0589472752989032e-153
+  0a 20 20 20 20 20 20 20  20 20 20 20 20 22 69 73
+    6.01347001699904e-154   8.786501966149144e+247
+    6.01347001699904e-154   8.786501966149144e+247
+  54 65 73 74 6e 65 74 22  3a 20 66 61 6c 73 65 0a
+  1.0453739667527694e-142  1.3951429053043418e-258
+  1.0453739667527694e-142  1.3951429053043418e-258
+  20 20 20 20 20 20 20 20  7d 0a 20 20 20 20 5d 2c
+   6.013470016999068e-154    5.454244750788308e-95
+   6.013470016999068e-154    5.454244750788308e-95
+  20 0a 20 20 20 20 5b 0a  20 20 20 20 20 20 20 20
+   8.821071308809118e-259   6.013470016999068e-154
+   8.821071308809118e-259   6.013470016999068e-154
+  22 4c 32 78 53 59 6d 4d  65 56 6f 33 5a 65 6b 33
+    9.658759578536642e+64   5.3276609871198396e-61
+    9.658759578536642e+64   5.3276609871198396e-61
+  5a 54 73 76 39 78 55 72  58 56 41 6d 72 57 78 4a
+   5.726391257818871e+242    5.692043727268523e+50
+   5.726391257818871e+242    5.692043727268523e+50
+  38 55 61 34 63 77 38 70  6b 66 62 51 68 63 45 46
+  3.7984462659369785e+232   3.3891130827679004e+30
+  3.7984462659369785e+232   3.3891130827679004e+30
+  68 6b 58 54 38 22 2c 20  0a 20 20 20 20 20 20 20
+  1.0491525597087253e-153    6.01347001699904e-154
+  1.0491525597087253e-153    6.01347001699904e-154
+  20 22 61 62 32 62 34 62  63 64 66 63 39 31 64 33
+  1.1738108813787748e+165    3.926777466198868e-61
+  1.1738108813787748e+165    3.926777466198868e-61
+  34 64 65 65 30 61 65 32  61 38 63 36 62 36 36 36
+    6.344120774274733e-66    1.519836552742176e-47
+    6.344120774274733e-66    1.519836552742176e-47
+  38 64 61 64 61 65 62 33  61 38 38 62 39 38 35 39
+    3.577459279116577e-61   4.0867512361974885e-33
+    3.577459279116577e-61   4.0867512361974885e-33
+  37 34 33 31 35 36 66 34  36 32 33 32 35 31 38 37
+     2.83082863202968e-56   1.0848165719397837e-42
+     2.83082863202968e-56   1.0848165719397837e-42
+  61 66 22 2c 20 0a 20 20  20 20 20 20 20 20 7b 0a
+   5.981422726098223e-154    3.52842852352625e-258
+   5.981422726098223e-154    3.52842852352625e-258
+  20 20 20 20 20 20 20 20  20 20 20 20 22 69 73 43
+   6.013470016999068e-154    8.741791754053274e+16
+   6.013470016999068e-154    8.741791754053274e+16
+  6f 6d 70 72 65 73 73 65  64 22 3a 20 74 72 75 65
+   5.044453705302714e+180   5.562188174538047e+180
+   5.044453705302714e+180   5.562188174538047e+180
+  2c 20 0a 20 20 20 20 20  20 20 20 20 20 20 20 22
+   6.013470015088901e-154  2.5827657058487563e-144
+   6.013470015088901e-154  2.5827657058487563e-144
+  69 73 50 72 69 76 6b 65  79 22 3a 20 74 72 75 65
+   3.561133256465674e+180   5.562188174538066e+180
+   3.561133256465674e+180   5.562188174538066e+180
+  2c 20 0a 20 20 20 20 20  20 20 20 20 20 20 20 22
+   6.013470015088901e-154  2.5827657058487563e-144
+   6.013470015088901e-154  2.5827657058487563e-144
+  69 73 54 65 73 74 6e 65  74 22 3a 20 66 61 6c 73
+   3.949156961798742e+180   9.921696751788942e+247
+   3.949156961798742e+180   9.921696751788942e+247
+  65 0a 20 20 20 20 20 20  20 20 7d 0a 20 20 20 20
+   6.013470016991698e-154    6.01346953606701e-154
+   6.013470016991698e-154    6.01346953606701e-154
+  5d 2c 20 0a 20 20 20 20  5b 0a 20 20 20 20 20 20
+   6.013469527996294e-154   6.013470016991685e-154
+   6.013469527996294e-154   6.013470016991685e-154
+  20 20 22 39 32 78 46 45  76 65 31 5a 39 4e 38 5a
+    5.432795692711643e+25   4.113238335824515e+126
+    5.432795692711643e+25   4.113238335824515e+126
+  36 34 31 4b 51 51 53 37  42 79 43 53 62 38 6b 47
+     3.46493294672349e-42   1.1306849619759817e+36
+     3.46493294672349e-42   1.1306849619759817e+36
+  6a 73 44 7a 77 36 66 41  6d 6a 48 4e 31 4c 5a 47
+       11645883.820855815     5.46180351436489e+35
+       11645883.820855815     5.46180351436489e+35
+  4b 51 58 79 4d 71 22 2c  20 0a 20 20 20 20 20 20
+    4.317111503799816e-96   6.013470016991607e-154
+    4.317111503799816e-96   6.013470016991607e-154
+  20 20 22 62 34 32 30 34  33 38 39 63 65 66 31 38
+   2.5801894710304847e-57    5.113395886281799e-38
+   2.5801894710304847e-57    5.113395886281799e-38
+  62 62 65 32 62 33 35 33  36 32 33 63 62 66 39 33
+    5.153608848019085e-62    6.174383087812953e-62
+    5.153608848019085e-62    6.174383087812953e-62
+  65 38 36 37 38 66 62 63  39 32 61 34 37 35 62 36
+   5.555059923319319e+170    9.966666141392884e-47
+   5.555059923319319e+170    9.966666141392884e-47
+  36 34 61 65 39 38 65 64  35 39 34 65 36 63 66 30
+  4.1986068533274885e+175   1.5467411567955652e-75
+  4.1986068533274885e+175   1.5467411567955652e-75
+  38 35 36 22 2c 20 0a 20  20 20 20 20 20 20 20 7b
+   2.435677178030117e-154  1.1989438289530674e+285
+   2.435677178030117e-154  1.1989438289530674e+285
+  0a 20 20 20 20 20 20 20  20 20 20 20 20 22 69 73
+    6.01347001699904e-154   8.786501966149144e+247
+    6.01347001699904e-154   8.786501966149144e+247
+  43 6f 6d 70 72 65 73 73  65 64 22 3a 20 66 61 6c
+   1.356172183488606e+248  1.1714653744269358e+214
+   1.356172183488606e+248  1.1714653744269358e+214
+  73 65 2c 20 0a 20 20 20  20 20 20 20 20 20 20 20
+   6.013344832291728e-154   6.013470016999068e-154
+   6.013344832291728e-154   6.013470016999068e-154
+  20 22 69 73 50 72 69 76  6b 65 79 22 3a 20 74 72
+  2.5040037858705394e+262  2.1471952867389554e+243
+  2.5040037858705394e+262  2.1471952867389554e+243
+  75 65 2c 20 0a 20 20 20  20 20 20 20 20 20 20 20
+   6.013344832291731e-154   6.013470016999068e-154
+   6.013344832291731e-154   6.013470016999068e-154
+  20 22 69 73 54 65 73 74  6e 65 74 22 3a 20 74 72
+   8.887600345591531e+252   2.147195286614755e+243
+   8.887600345591531e+252   2.147195286614755e+243
+  75 65 0a 20 20 20 20 20  20 20 20 7d 0a 20 20 20
+     6.0134700151124e-154   6.013346898391935e-154
+     6.0134700151124e-154   6.013346898391935e-154
+  20 5d 2c 20 0a 20 20 20  20 5b 0a 20 20 20 20 20
+   6.013344832288905e-154   6.013470015108896e-154
+   6.013344832288905e-154   6.013470015108896e-154
+  20 20 20 22 63 56 4d 36  35 74 64 59 75 31 59 4b
+    4.014699594553041e-47    9.652115460694296e+54
+    4.014699594553041e-47    9.652115460694296e+54
+  33 37 74 4e 6f 41 79 47  6f 4a 54 52 31 33 56 42
+   2.0981535471035834e+36         381392603473.163
+   2.0981535471035834e+36         381392603473.163
+  59 46 76 61 31 76 67 39  46 4c 75 50 41 73 4a 69
+    3.614845857865387e-32  1.5817446121160594e+199
+    3.614845857865387e-32  1.5817446121160594e+199
+  6a 47 76 47 36 4e 45 41  22 2c 20 0a 20 20 20 20
+       2792556.5582970874   6.013469527996216e-154
+       2792556.5582970874   6.013469527996216e-154
+  20 20 20 20 22 65 37 62  32 33 30 31 33 33 66 31
+   1.347229721642872e+165    1.005180372320533e-70
+   1.347229721642872e+165    1.005180372320533e-70
+  62 35 34 38 39 38 34 33  32 36 30 32 33 36 62 30
+    4.915118104299604e-62    1.258235778257675e-75
+    4.915118104299604e-62    1.258235778257675e-75
+  36 65 64 63 61 32 35 66  36 36 61 64 62 31 62 65
+  2.2516850047304308e+184  2.3591172908214353e+180
+  2.2516850047304308e+184  2.3591172908214353e+180
+  34 35 35 66 62 64 33 38  64 34 30 31 30 64 34 38
+    5.698833774097936e-38    5.992482225346652e-38
+    5.698833774097936e-38    5.992482225346652e-38
+  66 61 65 65 66 22 2c 20  0a 20 20 20 20 20 20 20
+   1.049178772815193e-153    6.01347001699904e-154
+   1.049178772815193e-153    6.01347001699904e-154
+  20 7b 0a 20 20 20 20 20  20 20 20 20 20 20 20 22
+   6.013470015119749e-154  2.5827657058487563e-144
+   6.013470015119749e-154  2.5827657058487563e-144
+  69 73 43 6f 6d 70 72 65  73 73 65 64 22 3a 20 74
+   4.782101395475446e+180   2.323629967860333e+251
+   4.782101395475446e+180   2.323629967860333e+251
+  72 75 65 2c 20 0a 20 20  20 20 20 20 20 20 20 20
+    5.98142273192071e-154   6.013470016999068e-154
+    5.98142273192071e-154   6.013470016999068e-154
+  20 20 22 69 73 50 72 69  76 6b 65 79 22 3a 20 74
+   8.761662860649562e+199  2.3236301470955206e+251
+   8.761662860649562e+199  2.3236301470955206e+251
+  72 75 65 2c 20 0a 20 20  20 20 20 20 20 20 20 20
+    5.98142273192071e-154   6.013470016999068e-154
+    5.98142273192071e-154   6.013470016999068e-154
+  20 20 22 69 73 54 65 73  74 6e 65 74 22 3a 20 74
+   7.456842731009478e+247   2.323630104420618e+251
+   7.456842731009478e+247   2.323630104420618e+251
+  72 75 65 0a 20 20 20 20  20 20 20 20 7d 0a 20 20
+   6.013469534012111e-154    5.98195165357277e-154
+   6.013469534012111e-154    5.98195165357277e-154
+  20 20 5d 2c 20 0a 20 20  20 20 5b 0a 20 20 20 20
+    5.98142273119716e-154   6.013469533114908e-154
+    5.98142273119716e-154   6.013469533114908e-154
+  20 20 20 20 22 31 4a 77  4d 57 42 56 4c 74 69 71
+   4.222733085572671e+266  2.0718941873520748e+238
+   4.222733085572671e+266  2.0718941873520748e+238
+  74 73 63 62 61 52 48 61  69 34 70 71 48 6f 6b 68
+   4.274284165275727e+160  1.0013534856642088e+195
+   4.274284165275727e+160  1.0013534856642088e+195
+  46 43 62 74 6f 42 34 22  2c 20 0a 20 20 20 20 20
+    6.48979661111802e-144   6.013470015088901e-154
+    6.48979661111802e-144   6.013470015088901e-154
+  20 20 20 22 63 34 63 31  62 37 32 34 39 31 65 64
+    8.695551771058916e-71  4.1931959207426016e+175
+    8.695551771058916e-71  4.1931959207426016e+175
+  65 31 65 65 64 61 63 61  30 30 36 31 38 34 30 37
+  1.3623581349799157e+161    7.266117020385239e-43
+  1.3623581349799157e+161    7.266117020385239e-43
+  65 65 30 62 37 37 32 63  61 64 30 64 22 2c 20 0a
+   6.874532520900979e+169     6.5739775843482e-260
+   6.874532520900979e+169     6.5739775843482e-260
+  20 20 20 20 20 20 20 20  7b 0a 20 20 20 20 20 20
+   6.013470016999068e-154   6.013470016991727e-154
+   6.013470016999068e-154   6.013470016991727e-154
+  20 20 20 20 20 20 22 61  64 64 72 54 79 70 65 22
+   7.963380651952609e+159  5.4941904516250855e-143
+   7.963380651952609e+159  5.4941904516250855e-143
+  3a 20 22 70 75 62 6b 65  79 22 2c 20 0a 20 20 20
+   3.551026330083098e+180   6.013344832269012e-154
+   3.551026330083098e+180   6.013344832269012e-154
+  20 20 20 20 20 20 20 20  20 22 69 73 50 72 69 76
+   6.013470016999068e-154  2.5040037858705394e+262
+   6.013470016999068e-154  2.5040037858705394e+262
+  6b 65 79 22 3a 20 66 61  6c 73 65 2c 20 0a 20 20
+  1.5553509145528304e+161   5.981422731920023e-154
+  1.5553509145528304e+161   5.981422731920023e-154
+  20 20 20 20 20 20 20 20  20 20 22 69 73 54 65 73
+   6.013470016999068e-154   7.456842731009478e+247
+   6.013470016999068e-154   7.456842731009478e+247
+  74 6e 65 74 22 3a 20 66  61 6c 73 65 0a 20 20 20
+   8.618823075239411e+183   6.013346372162298e-154
+   8.618823075239411e+183   6.013346372162298e-154
+  20 20 20 20 20 7d 0a 20  20 20 20 5d 2c 20 0a 20
+   2.469528537446747e-154  2.4356775054076983e-154
+   2.469528537446747e-154  2.4356775054076983e-154
+  20 20 20 5b 0a 20 20 20  20 20 20 20 20 22 33 51
+    6.01334614265396e-154    1.451940310672275e+83
+    6.01334614265396e-154    1.451940310672275e+83
+  43 7a 76 66 4c 34 5a 52  76 6d 4a 46 69 57 57 42
+   5.2128010784637485e+88        401003059497.7103
+   5.2128010784637485e+88        401003059497.7103
+  56 77 78 66 64 61 4e 42  54 38 45 74 78 42 35 79
+        260965977328.9323    7.36058217925902e+275
+        260965977328.9323    7.36058217925902e+275
+  22 2c 20 0a 20 20 20 20  20 20 20 20 22 66 36 66
+   6.013469527996216e-154  2.3793875413576364e+184
+   6.013469527996216e-154  2.3793875413576364e+184
+  65 36 39 62 63 62 35 34  38 61 38 32 39 63 63 65
+   3.4067201514579054e-57  2.5140347734015893e+180
+   3.4067201514579054e-57  2.5140347734015893e+180
+  34 63 35 37 62 66 36 66  66 66 38 61 66 33 61 35
+  2.3794914254008733e+184   1.4366762589326155e-51
+  2.3794914254008733e+184   1.4366762589326155e-51
+  39 38 31 66 39 22 2c 20  0a 20 20 20 20 20 20 20
+  1.0491531684042633e-153    6.01347001699904e-154
+  1.0491531684042633e-153    6.01347001699904e-154
+  20 7b 0a 20 20 20 20 20  20 20 20 20 20 20 20 22
+   6.013470015119749e-154  2.5827657058487563e-144
+   6.013470015119749e-154  2.5827657058487563e-144
+  61 64 64 72 54 79 70 65  22 3a 20 22 73 63 72 69
+   4.272430653488194e+180   8.797167573717661e+199
+   4.272430653488194e+180   8.797167573717661e+199
+  70 74 22 2c 20 0a 20 20  20 20 20 20 20 20 20 20
+   5.981422726102992e-154   6.013470016999068e-154
+   5.981422726102992e-154   6.013470016999068e-154
+  20 20 22 69 73 50 72 69  76 6b 65 79 22 3a 20 66
+   8.761662860649562e+199   8.618823233529423e+183
+   8.761662860649562e+199   8.618823233529423e+183
+  61 6c 73 65 2c 20 0a 20  20 20 20 20 20 20 20 20
+   2.435677551670989e-154   6.013470016999068e-154
+   2.435677551670989e-154   6.013470016999068e-154
+  20 20 20 22 69 73 54 65  73 74 6e 65 74 22 3a 20
+  1.3259532540006391e+180  1.9492066638986783e-153
+  1.3259532540006391e+180  1.9492066638986783e-153
+  66 61 6c 73 65 0a 20 20  20 20 20 20 20 20 7d 0a
+   5.981816938785917e-154   3.788584450517487e-258
+   5.981816938785917e-154   3.788584450517487e-258
+  20 20 20 20 5d 2c 20 0a  20 20 20 20 5b 0a 20 20
+   6.574341888680965e-260   5.981758184651215e-154
+   6.574341888680965e-260   5.981758184651215e-154
+  20 20 20 20 20 20 22 6d  69 7a 58 69 75 63 58 52
+   4.998695050991644e+217    4.851589150917523e+88
+   4.998695050991644e+217    4.851589150917523e+88
+  43 73 45 72 69 51 43 48  55 6b 43 71 65 66 39 70
+    1.314715989604733e+40  3.9433936860157486e+232
+    1.314715989604733e+40  3.9433936860157486e+232
+  68 39 71 74 50 62 5a 5a  36 22 2c 20 0a 20 20 20
+  1.7859919070971297e+127   6.013344832268923e-154
+  1.7859919070971297e+127   6.013344832268923e-154
+  20 20 20 20 20 22 32 36  31 66 38 33 35 36 38 61
+   1.2407309190015513e-47  2.1274721245190318e+160
+   1.2407309190015513e-47  2.1274721245190318e+160
+  30 39 38 61 38 36 33 38  38 34 34 62 64 37 61 65
+    5.645839941918665e-38   2.232488065736618e+180
+    5.645839941918665e-38   2.232488065736618e+180
+  63 61 30 33 39 64 35 66  32 33 35 32 63 30 22 2c
+   2.272367441187987e+184    4.257753747296035e-96
+   2.272367441187987e+184    4.257753747296035e-96
+  20 0a 20 20 20 20 20 20  20 20 7b 0a 20 20 20 20
+   6.013470016991607e-154   6.013469535893356e-154
+   6.013470016991607e-154   6.013469535893356e-154
+  20 20 20 20 20 20 20 20  22 61 64 64 72 54 79 70
+   6.013470016999068e-154   6.292013152771389e+233
+   6.013470016999068e-154   6.292013152771389e+233
+  65 22 3a 20 22 70 75 62  6b 65 79 22 2c 20 0a 20
+   1.975251090301259e+166   2.435677179488548e-154
+   1.975251090301259e+166   2.435677179488548e-154
+  20 20 20 20 20 20 20 20  20 20 20 22 69 73 50 72
+   6.013470016999068e-154   4.387772996371559e+242
+   6.013470016999068e-154   4.387772996371559e+242
+  69 76 6b 65 79 22 3a 20  66 61 6c 73 65 2c 20 0a
+   1.949212354109114e-153   6.574393527702649e-260
+   1.949212354109114e-153   6.574393527702649e-260
+  20 20 20 20 20 20 20 20  20 20 20 20 22 69 73 54
+   6.013470016999068e-154    6.633752696451049e+98
+   6.013470016999068e-154    6.633752696451049e+98
+  65 73 74 6e 65 74 22 3a  20 74 72 75 65 0a 20 20
+   1.1646535862798119e-28   5.981816983768403e-154
+   1.1646535862798119e-28   5.981816983768403e-154
+  20 20 20 20 20 20 7d 0a  20 20 20 20 5d 2c 20 0a
+   3.788584450517487e-258   6.574341888680965e-260
+   3.788584450517487e-258   6.574341888680965e-260
+  20 20 20 20 5b 0a 20 20  20 20 20 20 20 20 22 32
+   5.981758184651215e-154   3.3615589859759336e-67
+   5.981758184651215e-154   3.3615589859759336e-67
+  4e 45 57 44 7a 48 57 77  59 35 5a 5a 70 38 43 51
+   7.507533363905615e+266   2.9171092363543975e+83
+   7.507533363905615e+266   2.9171092363543975e+83
+  57 62 42 37 6f 75 4e 4d  4c 71 43 69 61 36 59 52
+   2.5059988088668777e+64     5.01548969604419e+88
+   2.5059988088668777e+64     5.01548969604419e+88
+  64 61 22 2c 20 0a 20 20  20 20 20 20 20 20 22 65
+   5.981422726096531e-154   1.468984448481001e+179
+   5.981422726096531e-154   1.468984448481001e+179
+  39 33 30 65 31 38 33 34  61 34 64 32 33 34 37 30
+   3.0618435899496675e-57   2.0039284509539042e-76
+   3.0618435899496675e-57   2.0039284509539042e-76
+  32 37 37 33 39 35 31 64  36 32 37 63 63 65 38 32
+   4.256037818104699e+174    9.048997049224043e-67
+   4.256037818104699e+174    9.048997049224043e-67
+  66 62 62 35 64 32 65 22  2c 20 0a 20 20 20 20 20
+    5.43204328451469e-143   6.013470015088901e-154
+    5.43204328451469e-143   6.013470015088901e-154
+  20 20 20 7b 0a 20 20 20  20 20 20 20 20 20 20 20
+    6.01334685393676e-154   6.013470016999068e-154
+    6.01334685393676e-154   6.013470016999068e-154
+  20 22 61 64 64 72 54 79  70 65 22 3a 20 22 73 63
+  2.8316679681918873e+276  1.1553339406131187e+171
+  2.8316679681918873e+276  1.1553339406131187e+171
+  72 69 70 74 22 2c 20 0a  20 20 20 20 20 20 20 20
+    6.57397797806984e-260   6.013470016999068e-154
+    6.57397797806984e-260   6.013470016999068e-154
+  20 20 20 20 22 69 73 50  72 69 76 6b 65 79 22 3a
+      3.5961645426119e+79   1.1658861701882902e-28
+      3.5961645426119e+79   1.1658861701882902e-28
+  20 66 61 6c 73 65 2c 20  0a 20 20 20 20 20 20 20
+  1.0589461237472713e-153    6.01347001699904e-154
+  1.0589461237472713e-153    6.01347001699904e-154
+  20 20 20 20 20 22 69 73  54 65 73 74 6e 65 74 22
+   8.786501966149144e+247  1.0453739667527694e-142
+   8.786501966149144e+247  1.0453739667527694e-142
+  3a 20 74 72 75 65 0a 20  20 20 20 20 20 20 20 7d
+  2.4609096699672528e-154   5.149424535094442e+294
+  2.4609096699672528e-154   5.149424535094442e+294
+  0a 20 20 20 20 5d 2c 20  0a 20 20 20 20 5b 0a 20
+  1.0577333593336978e-153   2.457146526467208e-154
+  1.0577333593336978e-153   2.457146526467208e-154
+  20 20 20 20 20 20 20 22  35 4b 51 6d 44 72 79 4d
+  2.5827657058487563e-144   1.6748838309887503e+65
+  2.5827657058487563e-144   1.6748838309887503e+65
+  4e 44 63 69 73 54 7a 52  70 33 7a 45 71 39 65 34
+   2.0951142625405623e+89    2.704991638378053e-56
+   2.0951142625405623e+89    2.704991638378053e-56
+  61 77 52 6d 4a 72 45 56  55 31 6a 35 76 46 52 54
+   3.934991935021203e+107   1.5614271330451238e+98
+   3.934991935021203e+107   1.5614271330451238e+98
+  4b 70 52 4e 59 50 71 59  72 4d 67 22 2c 20 0a 20
+   7.153395175647068e+122   2.435677179095796e-154
+   7.153395175647068e+122   2.435677179095796e-154
+  20 20 20 20 20 20 20 22  64 31 66 61 62 37 61 62
+  2.5827657058487563e-144   7.931376807698494e+165
+  2.5827657058487563e-144   7.931376807698494e+165
+  37 33 38 35 61 64 32 36  38 37 32 32 33 37 66 31
+   1.2584391152827781e-47    1.005887849968619e-70
+   1.2584391152827781e-47    1.005887849968619e-70
+  65 62 39 37 38 39 61 61  32 35 63 63 39 38 36 62
+  1.2107360137060663e+161  1.2795415098694566e+165
+  1.2107360137060663e+161  1.2795415098694566e+165
+  61 63 63 36 39 35 65 30  37 61 63 35 37 31 64 36
+   1.4652402859267764e-75   1.1052877752479164e-46
+   1.4652402859267764e-75   1.1052877752479164e-46
+  63 64 61 63 38 62 63 30  22 2c 20 0a 20 20 20 20
+   1.3392053321360368e-75   6.013469527996216e-154
+   1.3392053321360368e-75   6.013469527996216e-154
+  20 20 20 20 7b 0a 20 20  20 20 20 20 20 20 20 20
+   5.981940273047973e-154   6.013470016999068e-154
+   5.981940273047973e-154   6.013470016999068e-154
+  20 20 22 69 73 43 6f 6d  70 72 65 73 73 65 64 22
+  1.3795078638833634e+219   5.226889369249613e-143
+  1.3795078638833634e+219   5.226889369249613e-143
+  3a 20 66 61 6c 73 65 2c  20 0a 20 20 20 20 20 20
+    8.034083407401953e-95   6.013470016991607e-154
+    8.034083407401953e-95   6.013470016991607e-154
+  20 20 20 20 20 20 22 69  73 50 72 69 76 6b 65 79
+    2.70979801693884e+198   5.932816947191957e+276
+    2.70979801693884e+198   5.932816947191957e+276
+  22 3a 20 74 72 75 65 2c  20 0a 20 20 20 20 20 20
+    8.037044162805465e-95   6.013470016991607e-154
+    8.037044162805465e-95   6.013470016991607e-154
+  20 20 20 20 20 20 22 69  73 54 65 73 74 6e 65 74
+    2.70979801693884e+198  4.9101891977339775e+252
+    2.70979801693884e+198  4.9101891977339775e+252
+  22 3a 20 66 61 6c 73 65  0a 20 20 20 20 20 20 20
+    5.03734622854541e+180    6.01347001699904e-154
+    5.03734622854541e+180    6.01347001699904e-154
+  20 7d 0a 20 20 20 20 5d  2c 20 0a 20 20 20 20 5b
+   3.840616274033827e+140   8.942131591061345e+130
+   3.840616274033827e+140   8.942131591061345e+130
+  0a 20 20 20 20 20 20 20  20 22 4c 33 39 46 79 37
+    6.01347001699904e-154    1.813342833777943e-41
+    6.01347001699904e-154    1.813342833777943e-41
+  41 43 32 48 68 6a 39 35  67 68 33 59 62 32 41 55
+   2.6535180601375766e-52   4.814558987235962e+102
+   2.6535180601375766e-52   4.814558987235962e+102
+  35 59 48 68 31 6d 51 53  41 48 67 70 4e 69 78 76
+    2.271902658307711e+93  4.8042775537848666e+262
+    2.271902658307711e+93  4.8042775537848666e+262
+  6d 32 37 70 6f 69 7a 63  4a 79 4c 74 55 69 22 2c
+  1.5948376739248573e+171     4.30982488877247e-96
+  1.5948376739248573e+171     4.30982488877247e-96
+  20 0a 20 20 20 20 20 20  20 20 22 62 30 62 62 65
+   6.013470016991607e-154   2.383838441746643e+180
+   6.013470016991607e-154   2.383838441746643e+180
+  64 65 33 33 65 66 32 35  34 65 38 33 37 36 61 63
+    1.921047723673238e-52   5.196528814243822e+170
+    1.921047723673238e-52   5.196528814243822e+170
+  65 62 31 35 31 30 32 35  33 66 63 33 35 35 30 65
+    1.898941992711493e-52  2.6271366010150954e+179
+    1.898941992711493e-52  2.6271366010150954e+179
+  66 64 30 66 63 66 38 34  64 63 64 30 63 39 39 39
+   3.8871369685638935e-57    4.857998385252457e-33
+   3.8871369685638935e-57    4.857998385252457e-33
+  38 62 32 38 38 66 31 36  36 62 33 22 2c 20 0a 20
+   1.1905080977914117e-47  2.4356771779688122e-154
+   1.1905080977914117e-47  2.4356771779688122e-154
+  20 20 20 20 20 20 20 7b  0a 20 20 20 20 20 20 20
+  1.1989438289530674e+285    6.01347001699904e-154
+  1.1989438289530674e+285    6.01347001699904e-154
+  20 20 20 20 20 22 69 73  43 6f 6d 70 72 65 73 73
+   8.786501966149144e+247   1.356172183488606e+248
+   8.786501966149144e+247   1.356172183488606e+248
+  65 64 22 3a 20 74 72 75  65 2c 20 0a 20 20 20 20
+   5.541633531014472e+257   6.013469527996305e-154
+   5.541633531014472e+257   6.013469527996305e-154
+  20 20 20 20 20 20 20 20  22 69 73 50 72 69 76 6b
+   6.013470016999068e-154   4.605064167587364e+209
+   6.013470016999068e-154   4.605064167587364e+209
+  65 79 22 3a 20 74 72 75  65 2c 20 0a 20 20 20 20
+   5.541633531020207e+257   6.013469527996305e-154
+   5.541633531020207e+257   6.013469527996305e-154
+  20 20 20 20 20 20 20 20  22 69 73 54 65 73 74 6e
+   6.013470016999068e-154  1.1827864699734312e+224
+   6.013470016999068e-154  1.1827864699734312e+224
+  65 74 22 3a 20 66 61 6c  73 65 0a 20 20 20 20 20
+  1.1714653744279156e+214   6.013470015112398e-154
+  1.1714653744279156e+214   6.013470015112398e-154
+  20 20 20 7d 0a 20 20 20  20 5d 2c 20 0a 20 20 20
+   6.013346898391935e-154   6.013344832288905e-154
+   6.013346898391935e-154   6.013344832288905e-154
+  20 5b 0a 20 20 20 20 20  20 20 20 22 39 31 63 54
+   6.013470015108896e-154    3.279556565806412e+98
+   6.013470015108896e-154    3.279556565806412e+98
+  56 55 63 67 79 64 71 79  5a 4c 67 61 41 4e 70 66
+   9.634684058635215e+276  2.7713820383526404e+185
+   9.634684058635215e+276  2.7713820383526404e+185
+  31 66 76 4c 35 35 46 48  35 33 51 4d 6d 34 42 73
+   1.5113875797228858e+40   1.591080665059403e+247
+   1.5113875797228858e+40   1.591080665059403e+247
+  6e 43 41 44 56 4e 59 75  57 75 71 64 56 79 73 22
+  1.8998524957975642e+257   9.981059872753287e-143
+  1.8998524957975642e+257   9.981059872753287e-143
+  2c 20 0a 20 20 20 20 20  20 20 20 22 30 33 37 66
+   6.013470015088901e-154  2.4644753158462807e+184
+   6.013470015088901e-154  2.4644753158462807e+184
+  34 31 39 32 63 36 33 30  66 33 39 39 64 39 32 37
+   1.6592196617412743e-76    8.172007427307797e-43
+   1.6592196617412743e-76    8.172007427307797e-43
+  31 65 32 36 63 35 37 35  32 36 39 62 31 64 31 35
+   2.4230851686407706e-52   1.8157446409704716e-52
+   2.4230851686407706e-52   1.8157446409704716e-52
+  62 65 35 35 33 65 61 31  61 37 32 31 37 66 30 63
+    7.876318428002703e-71   6.189026525255944e+169
+    7.876318428002703e-71   6.189026525255944e+169
+  62 38 35 31 33 63 65 66  34 31 63 62 22 2c 20 0a
+  1.8175542013282972e+185   6.573977540698315e-260
+  1.8175542013282972e+185   6.573977540698315e-260
+  20 20 20 20 20 20 20 20  7b 0a 20 20 20 20 20 20
+   6.013470016999068e-154   6.013470016991727e-154
+   6.013470016999068e-154   6.013470016991727e-154
+  20 20 20 20 20 20 22 69  73 43 6f 6d 70 72 65 73
+    2.70979801693884e+198   7.497795098079407e+247
+    2.70979801693884e+198   7.497795098079407e+247
+  73 65 64 22 3a 20 66 61  6c 73 65 2c 20 0a 20 20
+  1.5553509142091264e+161   5.981422731920023e-154
+  1.5553509142091264e+161   5.981422731920023e-154
+  20 20 20 20 20 20 20 20  20 20 22 69 73 50 72 69
+   6.013470016999068e-154   8.761662860649562e+199
+   6.013470016999068e-154   8.761662860649562e+199
+  76 6b 65 79 22 3a 20 74  72 75 65 2c 20 0a 20 20
+  2.3236301470955206e+251    5.98142273192071e-154
+  2.3236301470955206e+251    5.98142273192071e-154
+  20 20 20 20 20 20 20 20  20 20 22 69 73 54 65 73
+   6.013470016999068e-154   7.456842731009478e+247
+   6.013470016999068e-154   7.456842731009478e+247
+  74 6e 65 74 22 3a 20 74  72 75 65 0a 20 20 20 20
+   2.323630104420618e+251   6.013469534012111e-154
+   2.323630104420618e+251   6.013469534012111e-154
+  20 20 20 20 7d 0a 20 20  20 20 5d 2c 20 0a 20 20
+    5.98195165357277e-154    5.98142273119716e-154
+    5.98195165357277e-154    5.98142273119716e-154
+  20 20 5b 0a 20 20 20 20  20 20 20 20 22 63 51 73
+   6.013469533114908e-154  3.0392546411570814e+247
+   6.013469533114908e-154  3.0392546411570814e+247
+  70 66 53 7a 73 67 4c 65  69 4a 47 42 32 75 38 76
+   9.208068691034286e+179  3.0083863532543258e+261
+   9.208068691034286e+179  3.0083863532543258e+261
+  72 41 69 57 70 43 55 34  4d 78 55 54 36 4a 73 65
+   1.3549841210707074e-56   5.002731569166728e+180
+   1.3549841210707074e-56   5.002731569166728e+180
+  57 6f 32 53 6a 58 79 34  51 62 7a 6e 32 66 77 44
+    6.460401238408825e-56    6.906226936127015e+21
+    6.460401238408825e-56    6.906226936127015e+21
+  77 22 2c 20 0a 20 20 20  20 20 20 20 20 22 36 32
+   6.013344832269009e-154     8.20969824953206e-67
+   6.013344832269009e-154     8.20969824953206e-67
+  35 31 65 32 30 35 65 38  61 64 35 30 38 62 61 62
+    4.985921984160953e-37   8.008461533012032e+165
+    4.985921984160953e-37   8.008461533012032e+165
+  35 35 39 36 62 65 65 30  38 36 65 66 31 36 63 64
+    1.478237761092467e-75   3.801308254580065e+175
+    1.478237761092467e-75   3.801308254580065e+175
+  34 62 32 33 39 65 30 63  63 30 63 35 64 37 63 34
+   6.187563883406899e+169    2.449075846926722e-56
+   6.187563883406899e+169    2.449075846926722e-56
+  65 36 30 33 35 34 34 31  65 37 64 35 64 65 22 2c
+    1.143502296811225e-71    4.306220028941933e-96
+    1.143502296811225e-71    4.306220028941933e-96
+  20 0a 20 20 20 20 20 20  20 20 7b 0a 20 20 20 20
+   6.013470016991607e-154   6.013469535893356e-154
+   6.013470016991607e-154   6.013469535893356e-154
+  20 20 20 20 20 20 20 20  22 69 73 43 6f 6d 70 72
+   6.013470016999068e-154  1.7526186726551543e+243
+   6.013470016999068e-154  1.7526186726551543e+243
+  65 73 73 65 64 22 3a 20  74 72 75 65 2c 20 0a 20
+  1.9491884551457575e-153  2.4356775517149174e-154
+  1.9491884551457575e-153  2.4356775517149174e-154
+  20 20 20 20 20 20 20 20  20 20 20 22 69 73 50 72
+   6.013470016999068e-154   4.387772996371559e+242
+   6.013470016999068e-154   4.387772996371559e+242
+  69 76 6b 65 79 22 3a 20  74 72 75 65 2c 20 0a 20
+   1.949212354109114e-153  2.4356775517149174e-154
+   1.949212354109114e-153  2.4356775517149174e-154
+  20 20 20 20 20 20 20 20  20 20 20 22 69 73 54 65
+   6.013470016999068e-154  1.3259532540006391e+180
+   6.013470016999068e-154  1.3259532540006391e+180
+  73 74 6e 65 74 22 3a 20  74 72 75 65 0a 20 20 20
+  1.9492066638986783e-153   6.013346372338011e-154
+  1.9492066638986783e-153   6.013346372338011e-154
+  20 20 20 20 20 7d 0a 20  20 20 20 5d 2c 20 0a 20
+   2.469528537446747e-154  2.4356775054076983e-154
+   2.469528537446747e-154  2.4356775054076983e-154
+  20 20 20 5b 0a 20 20 20  20 20 20 20 20 22 31 39
+    6.01334614265396e-154    3.299754070862801e-33
+    6.01334614265396e-154    3.299754070862801e-33
+  64 63 61 77 6f 4b 63 5a  64 51 7a 33 36 35 57 70
+  2.6121946110172116e+127   1.441224795332723e+233
+  2.6121946110172116e+127   1.441224795332723e+233
+  58 57 4d 68 58 36 51 43  55 70 52 39 53 59 34 72
+     1.93793117560088e+16  1.3568693323614255e+242
+     1.93793117560088e+16  1.3568693323614255e+242
+  22 2c 20 0a 20 20 20 20  20 20 20 20 22 35 65 61
+   6.013469527996216e-154  1.4907960637154083e+161
+   6.013469527996216e-154  1.4907960637154083e+161
+  64 61 66 39 62 62 37 31  32 31 66 30 66 31 39 32
+   1.3235051153430347e-71     9.34459027027571e-67
+   1.3235051153430347e-71     9.34459027027571e-67
+  35 36 31 61 35 61 36 32  66 35 65 35 66 35 34 32
+    8.301099788968589e-67    7.495782940000462e-67
+    8.301099788968589e-67    7.495782940000462e-67
+  31 30 32 39 32 22 2c 20  0a 20 20 20 20 20 20 20
+  1.0491490852048508e-153    6.01347001699904e-154
+  1.0491490852048508e-153    6.01347001699904e-154
+  20 7b 0a 20 20 20 20 20  20 20 20 20 20 20 20 22
+   6.013470015119749e-154  2.5827657058487563e-144
+   6.013470015119749e-154  2.5827657058487563e-144
+  61 64 64 72 54 79 70 65  22 3a 20 22 70 75 62 6b
+   4.272430653488194e+180   1.896396345774036e+209
+   4.272430653488194e+180   1.896396345774036e+209
+  65 79 22 2c 20 0a 20 20  20 20 20 20 20 20 20 20
+   5.981422726104673e-154   6.013470016999068e-154
+   5.981422726104673e-154   6.013470016999068e-154
+  20 20 22 69 73 50 72 69  76 6b 65 79 22 3a 20 66
+   8.761662860649562e+199   8.618823233529423e+183
+   8.761662860649562e+199   8.618823233529423e+183
+  61 6c 73 65 2c 20 0a 20  20 20 20 20 20 20 20 20
+   2.435677551670989e-154   6.013470016999068e-154
+   2.435677551670989e-154   6.013470016999068e-154
+  20 20 20 22 69 73 54 65  73 74 6e 65 74 22 3a 20
+  1.3259532540006391e+180  1.9492066638986783e-153
+  1.3259532540006391e+180  1.9492066638986783e-153
+  66 61 6c 73 65 0a 20 20  20 20 20 20 20 20 7d 0a
+   5.981816938785917e-154   3.788584450517487e-258
+   5.981816938785917e-154   3.788584450517487e-258
+  20 20 20 20 5d 2c 20 0a  20 20 20 20 5b 0a 20 20
+   6.574341888680965e-260   5.981758184651215e-154
+   6.574341888680965e-260   5.981758184651215e-154
+  20 20 20 20 20 20 22 33  37 53 70 36 52 76 33 79
+    2.203031297049188e-62   6.738260511483266e+275
+    2.203031297049188e-62   6.738260511483266e+275
+  34 6b 56 64 31 6e 51 31  4a 56 35 70 66 71 58 63
+    3.946112033966172e-71    3.68987391279731e+170
+    3.946112033966172e-71    3.68987391279731e+170
+  63 48 4e 79 5a 6d 31 78  33 22 2c 20 0a 20 20 20
+   9.206674257049407e+270   6.013344832268919e-154
+   9.206674257049407e+270   6.013344832268919e-154
+  20 20 20 20 20 22 33 66  32 31 30 65 37 32 37 37
+  2.0324847979901472e+184    1.040151688124599e-42
+  2.0324847979901472e+184    1.040151688124599e-42
+  63 38 39 39 63 33 61 31  35 35 63 63 31 63 39 30
+    7.788215799226316e-71   2.1925049044232053e-76
+    7.788215799226316e-71   2.1925049044232053e-76
+  66 34 31 30 36 63 62 64  64 65 65 63 36 65 22 2c
+  3.6382392277063674e+175    4.306056366382939e-96
+  3.6382392277063674e+175    4.306056366382939e-96
+  20 0a 20 20 20 20 20 20  20 20 7b 0a 20 20 20 20
+   6.013470016991607e-154   6.013469535893356e-154
+   6.013470016991607e-154   6.013469535893356e-154
+  20 20 20 20 20 20 20 20  22 61 64 64 72 54 79 70
+   6.013470016999068e-154   6.292013152771389e+233
+   6.013470016999068e-154   6.292013152771389e+233
+  65 22 3a 20 22 73 63 72  69 70 74 22 2c 20 0a 20
+  1.0375291479983522e+243   2.435677179380947e-154
+  1.0375291479983522e+243   2.435677179380947e-154
+  20 20 20 20 20 20 20 20  20 20 20 22 69 73 50 72
+   6.013470016999068e-154   4.387772996371559e+242
+   6.013470016999068e-154   4.387772996371559e+242
+  69 76 6b 65 79 22 3a 20  66 61 6c 73 65 2c 20 0a
+   1.949212354109114e-153   6.574393527702649e-260
+   1.949212354109114e-153   6.574393527702649e-260
+  20 20 20 20 20 20 20 20  20 20 20 20 22 69 73 54
+   6.013470016999068e-154    6.633752696451049e+98
+   6.013470016999068e-154    6.633752696451049e+98
+  65 73 74 6e 65 74 22 3a  20 66 61 6c 73 65 0a 20
+   1.1646535862798119e-28   2.460906791088173e-154
+   1.1646535862798119e-28   2.460906791088173e-154
+  20 20 20 20 20 20 20 7d  0a 20 20 20 20 5d 2c 20
+   5.149424535094442e+294  1.0577333593336978e-153
+   5.149424535094442e+294  1.0577333593336978e-153
+  0a 20 20 20 20 5b 0a 20  20 20 20 20 20 20 20 22
+   2.457146526467208e-154  2.5827657058487563e-144
+   2.457146526467208e-154  2.5827657058487563e-144
+  6d 79 6f 71 63 67 59 69  65 68 75 66 72 73 6e 6e
+  3.0383435381556634e+199   8.805780316757812e+223
+  3.0383435381556634e+199   8.805780316757812e+223
+  6b 71 64 71 62 70 36 39  64 64 64 56 44 4d 6f 70
+    4.321594610515217e-33   3.887731846192134e+233
+    4.321594610515217e-33   3.887731846192134e+233
+  4a 75 22 2c 20 0a 20 20  20 20 20 20 20 20 22 63
+    5.98142272610328e-154  3.4202459465735615e+169
+    5.98142272610328e-154  3.4202459465735615e+169
+  38 61 33 63 32 61 30 39  61 32 39 38 35 39 32 63
+    3.154610675880691e-33   6.877468467827474e+169
+    3.154610675880691e-33   6.877468467827474e+169
+  33 65 31 38 30 66 30 32  34 38 37 63 64 39 31 62
+    6.082791436385677e-67   9.918737559649545e+164
+    6.082791436385677e-67   9.918737559649545e+164
+  61 33 34 30 30 62 35 22  2c 20 0a 20 20 20 20 20
+   6.849862328882116e-144   6.013470015088901e-154
+   6.849862328882116e-144   6.013470015088901e-154
+  20 20 20 7b 0a 20 20 20  20 20 20 20 20 20 20 20
+    6.01334685393676e-154   6.013470016999068e-154
+    6.01334685393676e-154   6.013470016999068e-154
+  20 22 61 64 64 72 54 79  70 65 22 3a 20 22 70 75
+  2.8316679681918873e+276    4.84484212534132e+257
+  2.8316679681918873e+276    4.84484212534132e+257
+  62 6b 65 79 22 2c 20 0a  20 20 20 20 20 20 20 20
+   6.573978098174014e-260   6.013470016999068e-154
+   6.573978098174014e-260   6.013470016999068e-154
+  20 20 20 20 22 69 73 50  72 69 76 6b 65 79 22 3a
+      3.5961645426119e+79   1.1658861701882902e-28
+      3.5961645426119e+79   1.1658861701882902e-28
+  20 66 61 6c 73 65 2c 20  0a 20 20 20 20 20 20 20
+  1.0589461237472713e-153    6.01347001699904e-154
+  1.0589461237472713e-153    6.01347001699904e-154
+  20 20 20 20 20 22 69 73  54 65 73 74 6e 65 74 22
+   8.786501966149144e+247  1.0453739667527694e-142
+   8.786501966149144e+247  1.0453739667527694e-142
+  3a 20 74 72 75 65 0a 20  20 20 20 20 20 20 20 7d
+  2.4609096699672528e-154   5.149424535094442e+294
+  2.4609096699672528e-154   5.149424535094442e+294
+  0a 20 20 20 20 5d 2c 20  0a 20 20 20 20 5b 0a 20
+  1.0577333593336978e-153   2.457146526467208e-154
+  1.0577333593336978e-153   2.457146526467208e-154
+  20 20 20 20 20 20 20 22  32 4e 37 46 75 77 75 55
+  2.5827657058487563e-144   4.807977887224588e+103
+  2.5827657058487563e-144   4.807977887224588e+103
+  75 6f 54 42 72 44 46 64  72 41 5a 39 4b 78 42 6d
+  1.1014794359706029e+175   2.037470675047766e+218
+  1.1014794359706029e+175   2.037470675047766e+218
+  74 71 4d 4c 78 63 65 39  69 31 43 22 2c 20 0a 20
+    3.295428583597142e-32  2.4356771783119804e-154
+    3.295428583597142e-32  2.4356771783119804e-154
+  20 20 20 20 20 20 20 22  39 39 62 33 31 64 66 37
+  2.5827657058487563e-144    8.032512113486052e-42
+  2.5827657058487563e-144    8.032512113486052e-42
+  63 39 30 36 38 64 31 34  38 31 62 35 39 36 35 37
+   2.7706230447123755e-57     9.51170476324824e-43
+   2.7706230447123755e-57     9.51170476324824e-43
+  38 64 64 62 62 34 64 33  62 64 39 30 62 61 65 62
+    3.929178052737737e-61   9.849712299385926e+165
+    3.929178052737737e-61   9.849712299385926e+165
+  22 2c 20 0a 20 20 20 20  20 20 20 20 7b 0a 20 20
+   6.013469527996216e-154   5.981940273047973e-154
+   6.013469527996216e-154   5.981940273047973e-154
+  20 20 20 20 20 20 20 20  20 20 22 61 64 64 72 54
+   6.013470016999068e-154     6.28566531304754e+98
+   6.013470016999068e-154     6.28566531304754e+98
+  79 70 65 22 3a 20 22 73  63 72 69 70 74 22 2c 20
+   3.960460952352905e+246  1.0491867636682042e-153
+   3.960460952352905e+246  1.0491867636682042e-153
+  0a 20 20 20 20 20 20 20  20 20 20 20 20 22 69 73
+    6.01347001699904e-154   8.786501966149144e+247
+    6.01347001699904e-154   8.786501966149144e+247
+  50 72 69 76 6b 65 79 22  3a 20 66 61 6c 73 65 2c
+  1.3016382627362237e-142    8.034083407401953e-95
+  1.3016382627362237e-142    8.034083407401953e-95
+  20 0a 20 20 20 20 20 20  20 20 20 20 20 20 22 69
+   6.013470016991607e-154    2.70979801693884e+198
+   6.013470016991607e-154    2.70979801693884e+198
+  73 54 65 73 74 6e 65 74  22 3a 20 74 72 75 65 0a
+  4.9101891977339775e+252   1.395657049443267e-258
+  4.9101891977339775e+252   1.395657049443267e-258
+  20 20 20 20 20 20 20 20  7d 0a 20 20 20 20 5d 2c
+   6.013470016999068e-154    5.454244750788308e-95
+   6.013470016999068e-154    5.454244750788308e-95
+  20 0a 20 20 20 20 5b 0a  20 20 20 20 20 20 20 20
+   8.821071308809118e-259   6.013470016999068e-154
+   8.821071308809118e-259   6.013470016999068e-154
+  22 35 4b 4c 36 7a 45 61  4d 74 50 52 58 5a 4b 6f
+  3.7744113570313445e+160  1.2959560525860303e+228
+  3.7744113570313445e+160  1.2959560525860303e+228
+  31 62 62 4d 71 37 4a 44  6a 6a 6f 31 62 4a 75 51
+    9.672208106917044e+20   2.5850318862213258e+84
+    9.672208106917044e+20   2.5850318862213258e+84
+  63 73 67 4c 33 33 6a 65  33 6f 59 38 75 53 4a 43
+  3.3974160668257275e+180        14820224632282726
+  3.3974160668257275e+180        14820224632282726
+  52 35 62 34 22 2c 20 0a  20 20 20 20 20 20 20 20
+    6.57397642607539e-260   6.013470016999068e-154
+    6.57397642607539e-260   6.013470016999068e-154
+  22 63 37 36 36 36 38 34  32 35 30 33 64 62 36 64
+    3.857156650761938e-57    5.53632815258488e+174
+    3.857156650761938e-57    5.53632815258488e+174
+  63 36 65 61 30 36 31 66  30 39 32 63 66 62 39 63
+  1.8283549797400265e+184   9.579967670689496e+169
+  1.8283549797400265e+184   9.579967670689496e+169
+  33 38 38 34 34 38 36 32  39 61 36 66 65 38 36 38
+    8.241687880130648e-67    6.529958466873202e-38
+    8.241687880130648e-67    6.529958466873202e-38
+  64 30 36 38 63 34 32 61  34 38 38 62 34 37 38 61
+  1.5996308865133735e+160  2.1278142697765438e+160
+  1.5996308865133735e+160  2.1278142697765438e+160
+  65 22 2c 20 0a 20 20 20  20 20 20 20 20 7b 0a 20
+   6.013344832268985e-154  2.4688001838597158e-154
+   6.013344832268985e-154  2.4688001838597158e-154
+  20 20 20 20 20 20 20 20  20 20 20 22 69 73 43 6f
+   6.013470016999068e-154   9.215623337008235e+227
+   6.013470016999068e-154   9.215623337008235e+227
+  6d 70 72 65 73 73 65 64  22 3a 20 66 61 6c 73 65
+   4.244383508749611e+175    5.03734622854541e+180
+   4.244383508749611e+175    5.03734622854541e+180
+  2c 20 0a 20 20 20 20 20  20 20 20 20 20 20 20 22
+   6.013470015088901e-154  2.5827657058487563e-144
+   6.013470015088901e-154  2.5827657058487563e-144
+  69 73 50 72 69 76 6b 65  79 22 3a 20 74 72 75 65
+   3.561133256465674e+180   5.562188174538066e+180
+   3.561133256465674e+180   5.562188174538066e+180
+  2c 20 0a 20 20 20 20 20  20 20 20 20 20 20 20 22
+   6.013470015088901e-154  2.5827657058487563e-144
+   6.013470015088901e-154  2.5827657058487563e-144
+  69 73 54 65 73 74 6e 65  74 22 3a 20 66 61 6c 73
+   3.949156961798742e+180   9.921696751788942e+247
+   3.949156961798742e+180   9.921696751788942e+247
+  65 0a 20 20 20 20 20 20  20 20 7d 0a 20 20 20 20
+   6.013470016991698e-154    6.01346953606701e-154
+   6.013470016991698e-154    6.01346953606701e-154
+  5d 2c 20 0a 20 20 20 20  5b 0a 20 20 20 20 20 20
+   6.013469527996294e-154   6.013470016991685e-154
+   6.013469527996294e-154   6.013470016991685e-154
+  20 20 22 4b 77 56 39 4b  41 66 77 62 77 74 35 31
+   2.4268750502806025e+54   1.2143069478197631e-71
+   2.4268750502806025e+54   1.2143069478197631e-71
+  76 65 5a 57 4e 73 63 52  54 65 5a 73 39 43 4b 70
+    7.738514328566877e+88   8.465134513035875e+232
+    7.738514328566877e+88   8.465134513035875e+232
+  6f 6a 79 75 31 4d 73 50  6e 61 4b 54 46 35 6b 7a
+    3.575944273814045e+79  4.9388319427401463e+281
+    3.575944273814045e+79  4.9388319427401463e+281
+  36 39 48 31 55 4e 32 22  2c 20 0a 20 20 20 20 20
+   5.864017277323877e-144   6.013470015088901e-154
+   5.864017277323877e-144   6.013470015088901e-154
+  20 20 20 22 30 37 66 30  38 30 33 66 63 35 33 39
+   1.5348598234811591e-75     3.69943177076541e-33
+   1.5348598234811591e-75     3.69943177076541e-33
+  39 65 37 37 33 35 35 35  61 62 31 65 38 39 33 39
+    2.214198963597645e-52   3.7023146591004676e-33
+    2.214198963597645e-52   3.7023146591004676e-33
+  39 30 37 65 39 62 61 64  61 63 63 31 37 63 61 31
+  3.4396116818712884e+175    7.872808585998391e-71
+  3.4396116818712884e+175    7.872808585998391e-71
+  32 39 65 36 37 61 32 66  35 66 32 66 66 38 34 33
+  1.9524365693201673e+184    4.915285684971964e-62
+  1.9524365693201673e+184    4.915285684971964e-62
+  35 31 64 64 22 2c 20 0a  20 20 20 20 20 20 20 20
+   6.573977589250778e-260   6.013470016999068e-154
+   6.573977589250778e-260   6.013470016999068e-154
+  7b 0a 20 20 20 20 20 20  20 20 20 20 20 20 22 69
+   6.013470016991727e-154    2.70979801693884e+198
+   6.013470016991727e-154    2.70979801693884e+198
+  73 43 6f 6d 70 72 65 73  73 65 64 22 3a 20 74 72
+   7.497795098079407e+247  2.1471952862173123e+243
+   7.497795098079407e+247  2.1471952862173123e+243
+  75 65 2c 20 0a 20 20 20  20 20 20 20 20 20 20 20
+   6.013344832291731e-154   6.013470016999068e-154
+   6.013344832291731e-154   6.013470016999068e-154
+  20 22 69 73 50 72 69 76  6b 65 79 22 3a 20 74 72
+  2.5040037858705394e+262  2.1471952867389554e+243
+  2.5040037858705394e+262  2.1471952867389554e+243
+  75 65 2c 20 0a 20 20 20  20 20 20 20 20 20 20 20
+   6.013344832291731e-154   6.013470016999068e-154
+   6.013344832291731e-154   6.013470016999068e-154
+  20 22 69 73 54 65 73 74  6e 65 74 22 3a 20 66 61
+   8.887600345591531e+252  1.5553509144709964e+161
+   8.887600345591531e+252  1.5553509144709964e+161
+  6c 73 65 0a 20 20 20 20  20 20 20 20 7d 0a 20 20
+   6.013469534011425e-154    5.98195165357277e-154
+   6.013469534011425e-154    5.98195165357277e-154
+  20 20 5d 2c 20 0a 20 20  20 20 5b 0a 20 20 20 20
+    5.98142273119716e-154   6.013469533114908e-154
+    5.98142273119716e-154   6.013469533114908e-154
+  20 20 20 20 22 39 33 4e  38 37 44 36 75 78 53 42
+    5.182558257133795e+68        334501304592.8628
+    5.182558257133795e+68        334501304592.8628
+  7a 77 58 76 70 6f 6b 70  7a 67 38 46 46 6d 66 51
+  3.4075051851394274e+233   1.3614984607322422e+84
+  3.4075051851394274e+233   1.3614984607322422e+84
+  50 6d 76 58 34 78 48 6f  57 51 65 33 70 4c 64 59
+  1.1593450046835075e+228   4.193281914361807e+122
+  1.1593450046835075e+228   4.193281914361807e+122
+  70 62 69 77 54 35 59 56  22 2c 20 0a 20 20 20 20
+   9.250439563843176e+107   6.013469527996216e-154
+   9.250439563843176e+107   6.013469527996216e-154
+  20 20 20 20 22 65 61 35  37 37 61 63 66 62 35 64
+   1.4529025318337873e-51   5.289006009476753e+174
+   1.4529025318337873e-51   5.289006009476753e+174
+  31 64 31 34 64 33 62 37  62 31 39 35 63 33 32 31
+    6.529198043497429e-42   1.0301249556515826e-71
+    6.529198043497429e-42   1.0301249556515826e-71
+  35 36 36 66 31 32 66 38  37 64 32 62 37 37 65 61
+    5.218270102868314e-37   1.491368049480538e+161
+    5.218270102868314e-37   1.491368049480538e+161
+  33 61 35 33 66 36 38 64  66 37 65 62 66 38 36 30
+   5.988486591000578e+174   1.9189836203546905e-76
+   5.988486591000578e+174   1.9189836203546905e-76
+  34 61 38 30 31 22 2c 20  0a 20 20 20 20 20 20 20
+  1.0491484962275404e-153    6.01347001699904e-154
+  1.0491484962275404e-153    6.01347001699904e-154
+  20 7b 0a 20 20 20 20 20  20 20 20 20 20 20 20 22
+   6.013470015119749e-154  2.5827657058487563e-144
+   6.013470015119749e-154  2.5827657058487563e-144
+  69 73 43 6f 6d 70 72 65  73 73 65 64 22 3a 20 66
+   4.782101395475446e+180   8.618822568709162e+183
+   4.782101395475446e+180   8.618822568709162e+183
+  61 6c 73 65 2c 20 0a 20  20 20 20 20 20 20 20 20
+   2.435677551670989e-154   6.013470016999068e-154
+   2.435677551670989e-154   6.013470016999068e-154
+  20 20 20 22 69 73 50 72  69 76 6b 65 79 22 3a 20
+   4.387772996371559e+242   1.949212354109114e-153
+   4.387772996371559e+242   1.949212354109114e-153
+  74 72 75 65 2c 20 0a 20  20 20 20 20 20 20 20 20
+  2.4356775517149174e-154   6.013470016999068e-154
+  2.4356775517149174e-154   6.013470016999068e-154
+  20 20 20 22 69 73 54 65  73 74 6e 65 74 22 3a 20
+  1.3259532540006391e+180  1.9492066638986783e-153
+  1.3259532540006391e+180  1.9492066638986783e-153
+  74 72 75 65 0a 20 20 20  20 20 20 20 20 7d 0a 20
+   6.013346372338011e-154   2.469528537446747e-154
+   6.013346372338011e-154   2.469528537446747e-154
+  20 20 20 5d 2c 20 0a 20  20 20 20 5b 0a 20 20 20
+  2.4356775054076983e-154    6.01334614265396e-154
+  2.4356775054076983e-154    6.01334614265396e-154
+  20 20 20 20 20 22 63 4d  78 58 75 73 53 69 68 61
+    6.296787356600635e+64   1.716014334734589e+161
+    6.296787356600635e+64   1.716014334734589e+161
+  58 35 38 77 70 4a 33 74  4e 75 75 55 63 5a 45 51
+   5.524667545634622e+251    3.240778187447539e+83
+   5.524667545634622e+251    3.240778187447539e+83
+  47 74 36 44 4b 4a 31 77  45 70 78 79 73 38 38 46
+  1.3937872162263027e+266   1.9189466609896387e+30
+  1.3937872162263027e+266   1.9189466609896387e+30
+  46 61 51 43 59 6a 6b 75  39 68 22 2c 20 0a 20 20
+  4.1164352227610387e+257   5.981422726098849e-154
+  4.1164352227610387e+257   5.981422726098849e-154
+  20 20 20 20 20 20 22 30  62 33 62 33 34 66 30 39
+    7.826739423852259e-77   3.1583775863616235e-33
+    7.826739423852259e-77   3.1583775863616235e-33
+  35 38 64 38 61 32 36 38  31 39 33 61 39 38 31 34
+    6.523052065430878e-38   2.7432446167757904e-57
+    6.523052065430878e-38   2.7432446167757904e-57
+  64 61 39 32 63 33 65 38  62 35 38 62 34 61 34 33
+   4.9842682253671165e-37    4.954031994794492e-62
+   4.9842682253671165e-37    4.954031994794492e-62
+  37 38 61 35 34 32 38 36  33 65 33 34 61 63 32 38
+   1.6555649696637876e-47    5.403806882599746e-38
+   1.6555649696637876e-47    5.403806882599746e-38
+  39 63 64 38 33 30 63 22  2c 20 0a 20 20 20 20 20
+   4.917316369387486e-143   6.013470015088901e-154
+   4.917316369387486e-143   6.013470015088901e-154
+  20 20 20 7b 0a 20 20 20  20 20 20 20 20 20 20 20
+    6.01334685393676e-154   6.013470016999068e-154
+    6.01334685393676e-154   6.013470016999068e-154
+  20 22 69 73 43 6f 6d 70  72 65 73 73 65 64 22 3a
+  3.6558227758146443e+233    1.160709300546122e-28
+  3.6558227758146443e+233    1.160709300546122e-28
+  20 74 72 75 65 2c 20 0a  20 20 20 20 20 20 20 20
+   6.574393576735255e-260   6.013470016999068e-154
+   6.574393576735255e-260   6.013470016999068e-154
+  20 20 20 20 22 69 73 50  72 69 76 6b 65 79 22 3a
+      3.5961645426119e+79   1.1658861701882902e-28
+      3.5961645426119e+79   1.1658861701882902e-28
+  20 74 72 75 65 2c 20 0a  20 20 20 20 20 20 20 20
+   6.574393576735255e-260   6.013470016999068e-154
+   6.574393576735255e-260   6.013470016999068e-154
+  20 20 20 20 22 69 73 54  65 73 74 6e 65 74 22 3a
+    6.633752696451049e+98   1.1646535862798119e-28
+    6.633752696451049e+98   1.1646535862798119e-28
+  20 74 72 75 65 0a 20 20  20 20 20 20 20 20 7d 0a
+   5.981816983768403e-154   3.788584450517487e-258
+   5.981816983768403e-154   3.788584450517487e-258
+  20 20 20 20 5d 2c 20 0a  20 20 20 20 5b 0a 20 20
+   6.574341888680965e-260   5.981758184651215e-154
+   6.574341888680965e-260   5.981758184651215e-154
+  20 20 20 20 20 20 22 31  33 70 31 69 6a 4c 77 73
+    5.129331948815817e-72  1.6290123675804566e+248
+    5.129331948815817e-72  1.6290123675804566e+248
+  6e 72 63 75 79 71 63 54  76 4a 58 6b 71 32 41 53
+    3.322444028560385e+98   1.1209918581006218e+93
+    3.322444028560385e+98   1.1209918581006218e+93
+  64 58 71 63 6e 45 42 4c  45 22 2c 20 0a 20 20 20
+    2.293805588537429e+59   6.013344832268943e-154
+    2.293805588537429e+59   6.013344832268943e-154
+  20 20 20 20 20 22 31 65  64 34 36 37 30 31 37 66
+  2.7771447767081305e+179   2.463645546243413e+184
+  2.7771447767081305e+179   2.463645546243413e+184
+  30 34 33 65 39 31 65 64  34 63 34 34 62 34 65 38
+   4.193196498676092e+175   4.9851830207572935e-37
+   4.193196498676092e+175   4.9851830207572935e-37
+  64 64 36 37 34 64 62 32  31 31 63 34 65 36 22 2c
+    5.457405973390863e-66   4.2632472608570115e-96
+    5.457405973390863e-66   4.2632472608570115e-96
+  20 0a 20 20 20 20 20 20  20 20 7b 0a 20 20 20 20
+   6.013470016991607e-154   6.013469535893356e-154
+   6.013470016991607e-154   6.013469535893356e-154
+  20 20 20 20 20 20 20 20  22 61 64 64 72 54 79 70
+   6.013470016999068e-154   6.292013152771389e+233
+   6.013470016999068e-154   6.292013152771389e+233
+  65 22 3a 20 22 70 75 62  6b 65 79 22 2c 20 0a 20
+   1.975251090301259e+166   2.435677179488548e-154
+   1.975251090301259e+166   2.435677179488548e-154
+  20 20 20 20 20 20 20 20  20 20 20 22 69 73 50 72
+   6.013470016999068e-154   4.387772996371559e+242
+   6.013470016999068e-154   4.387772996371559e+242
+  69 76 6b 65 79 22 3a 20  66 61 6c 73 65 2c 20 0a
+   1.949212354109114e-153   6.574393527702649e-260
+   1.949212354109114e-153   6.574393527702649e-260
+  20 20 20 20 20 20 20 20  20 20 20 20 22 69 73 54
+   6.013470016999068e-154    6.633752696451049e+98
+   6.013470016999068e-154    6.633752696451049e+98
+  65 73 74 6e 65 74 22 3a  20 66 61 6c 73 65 0a 20
+   1.1646535862798119e-28   2.460906791088173e-154
+   1.1646535862798119e-28   2.460906791088173e-154
+  20 20 20 20 20 20 20 7d  0a 20 20 20 20 5d 2c 20
+   5.149424535094442e+294  1.0577333593336978e-153
+   5.149424535094442e+294  1.0577333593336978e-153
+  0a 20 20 20 20 5b 0a 20  20 20 20 20 20 20 20 22
+   2.457146526467208e-154  2.5827657058487563e-144
+   2.457146526467208e-154  2.5827657058487563e-144
+  33 41 4c 4a 48 39 59 39  35 31 56 43 47 63 56 5a
+    1.943167734706781e-32  1.5154783104390461e+127
+    1.943167734706781e-32  1.5154783104390461e+127
+  59 41 64 70 41 33 4b 63  68 6f 50 39 4d 63 45 6a
+   2.053051958505791e+170   8.382144969496889e+203
+   2.053051958505791e+170   8.382144969496889e+203
+  31 47 22 2c 20 0a 20 20  20 20 20 20 20 20 22 35
+   5.981422726087646e-154    9.461947372890723e-53
+   5.981422726087646e-154    9.461947372890723e-53
+  65 63 65 30 63 61 64 64  64 63 34 31 35 62 31 39
+    4.03255792010546e+175    3.347964228984943e-33
+    4.03255792010546e+175    3.347964228984943e-33
+  38 30 66 30 30 31 37 38  35 39 34 37 31 32 30 61
+    6.815557845840133e-38  1.4231385423307294e+160
+    6.815557845840133e-38  1.4231385423307294e+160
+  63 64 62 33 36 66 63 22  2c 20 0a 20 20 20 20 20
+   4.971384267420594e-143   6.013470015088901e-154
+   4.971384267420594e-143   6.013470015088901e-154
+  20 20 20 7b 0a 20 20 20  20 20 20 20 20 20 20 20
+    6.01334685393676e-154   6.013470016999068e-154
+    6.01334685393676e-154   6.013470016999068e-154
+  20 22 61 64 64 72 54 79  70 65 22 3a 20 22 73 63
+  2.8316679681918873e+276  1.1553339406131187e+171
+  2.8316679681918873e+276  1.1553339406131187e+171
+  72 69 70 74 22 2c 20 0a  20 20 20 20 20 20 20 20
+    6.57397797806984e-260   6.013470016999068e-154
+    6.57397797806984e-260   6.013470016999068e-154
+  20 20 20 20 22 69 73 50  72 69 76 6b 65 79 22 3a
+      3.5961645426119e+79   1.1658861701882902e-28
+      3.5961645426119e+79   1.1658861701882902e-28
+  20 66 61 6c 73 65 2c 20  0a 20 20 20 20 20 20 20
+  1.0589461237472713e-153    6.01347001699904e-154
+  1.0589461237472713e-153    6.01347001699904e-154
+  20 20 20 20 20 22 69 73  54 65 73 74 6e 65 74 22
+   8.786501966149144e+247  1.0453739667527694e-142
+   8.786501966149144e+247  1.0453739667527694e-142
+  3a 20 66 61 6c 73 65 0a  20 20 20 20 20 20 20 20
+  1.3951429053043418e-258   6.013470016999068e-154
+  1.3951429053043418e-258   6.013470016999068e-154
+  7d 0a 20 20 20 20 5d 0a  5d 0a
+   9.471461126287318e-259               1.311e-320
+   9.471461126287318e-259               1.311e-320
+};};
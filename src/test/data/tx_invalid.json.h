@@ -0,0 +1,5379 @@
+namespace json_tests{
+static unsigned const char tx_invalid[] = {
+  5b 0a 5b 22 54 68 65 20  66 6f 6c 6c 6f 77 69 6e
+  1.2773174495275057e-152   7.364390457482061e+223
+  1.2773174495275057e-152   7.364390457482061e+223
+  67 20 61 72 65 20 64 65  73 65 72 69 61 6c 69 7a
+  2.6098570027529237e+180   4.614864288793235e+281
+  2.6098570027529237e+180   4.614864288793235e+281
+  65 64 20 74 72 61 6e 73  61 63 74 69 6f 6e 73 20
+  1.0620954503183082e+248  2.3188145430129914e-152
+  1.0620954503183082e+248  2.3188145430129914e-152
+  77 68 69 63 68 20 61 72  65 20 69 6e 76 61 6c 69
+   9.136029459168516e+242   6.788759915210939e+199
+   9.136029459168516e+242   6.788759915210939e+199
+  64 2e 22 5d 2c 0a 5b 22  54 68 65 79 20 61 72 65
+  3.4646915345147974e-143   4.766600861186246e+180
+  3.4646915345147974e-143   4.766600861186246e+180
+  20 69 6e 20 74 68 65 20  66 6f 72 6d 22 5d 2c 0a
+  1.2773465768272543e-152  1.1529706862245706e-259
+  1.2773465768272543e-152  1.1529706862245706e-259
+  5b 22 5b 5b 5b 70 72 65  76 6f 75 74 20 68 61 73
+   4.782029856586903e+180   6.085328417568069e+247
+   4.782029856586903e+180   6.085328417568069e+247
+  68 2c 20 70 72 65 76 6f  75 74 20 69 6e 64 65 78
+   8.488922343329762e+228   9.041152192176163e+271
+   8.488922343329762e+228   9.041152192176163e+271
+  2c 20 70 72 65 76 6f 75  74 20 73 63 72 69 70 74
+  4.7241027811489394e+257   7.520302005152603e+252
+  4.7241027811489394e+257   7.520302005152603e+252
+  50 75 62 4b 65 79 5d 2c  20 5b 69 6e 70 75 74 20
+    5.519546960782045e-95   2.441412874923677e-152
+    5.519546960782045e-95   2.441412874923677e-152
+  32 5d 2c 20 2e 2e 2e 5d  2c 22 5d 2c 0a 5b 22 73
+   7.188079289042987e+140   4.010657894815738e+246
+   7.188079289042987e+140   4.010657894815738e+246
+  65 72 69 61 6c 69 7a 65  64 54 72 61 6e 73 61 63
+    6.84976355123871e+180   5.268724183664553e+170
+    6.84976355123871e+180   5.268724183664553e+170
+  74 69 6f 6e 2c 20 76 65  72 69 66 79 46 6c 61 67
+   5.738177825319826e+180    9.70351273941857e+189
+   5.738177825319826e+180    9.70351273941857e+189
+  73 5d 22 5d 2c 0a 5b 22  4f 62 6a 65 63 74 73 20
+  3.4646915345202814e-143  2.3215895414503075e-152
+  3.4646915345202814e-143  2.3215895414503075e-152
+  74 68 61 74 20 61 72 65  20 6f 6e 6c 79 20 61 20
+   4.766600783653991e+180  1.0219032292813557e-152
+   4.766600783653991e+180  1.0219032292813557e-152
+  73 69 6e 67 6c 65 20 73  74 72 69 6e 67 20 28 6c
+   3.582525461387301e+246  1.0152726428997194e+213
+   3.582525461387301e+246  1.0152726428997194e+213
+  69 6b 65 20 74 68 69 73  20 6f 6e 65 29 20 61 72
+   8.882542717269106e+247   9.135516724422383e+242
+   8.882542717269106e+247   9.135516724422383e+242
+  65 20 69 67 6e 6f 72 65  64 22 5d 2c 0a 0a 5b 22
+   4.781092166047223e+180   3.464624686628593e-143
+   4.781092166047223e+180   3.464624686628593e-143
+  30 65 31 62 35 36 38 38  63 66 31 37 39 63 64 39
+    7.115194445030298e-38   3.1412058818974163e-32
+    7.115194445030298e-38   3.1412058818974163e-32
+  66 37 63 62 64 61 31 66  61 63 30 30 39 30 66 36
+  1.8462821900034976e+184   1.2145520501112942e-46
+  1.8462821900034976e+184   1.2145520501112942e-46
+  65 36 38 34 62 62 66 38  63 64 39 34 36 36 36 30
+    5.262526219363799e-37   1.9182454288298124e-76
+    5.262526219363799e-37   1.9182454288298124e-76
+  31 32 30 31 39 37 63 33  66 33 36 38 31 38 30 39
+   3.7368655292662994e-61    3.123762271889944e-33
+   3.7368655292662994e-61    3.123762271889944e-33
+  20 62 75 74 20 77 69 74  68 20 65 78 74 72 61 20
+   5.834395168728814e+252  1.0410107177428033e-152
+   5.834395168728814e+252  1.0410107177428033e-152
+  6a 75 6e 6b 20 61 70 70  65 6e 64 65 64 20 74 6f
+   4.068690606738366e+233    7.62861448845944e+228
+   4.068690606738366e+233    7.62861448845944e+228
+  20 74 68 65 20 65 6e 64  20 6f 66 20 74 68 65 20
+   6.014091102726484e+175   1.277346576716442e-152
+   6.014091102726484e+175   1.277346576716442e-152
+  73 63 72 69 70 74 50 75  62 4b 65 79 22 5d 2c 0a
+   1.235349902385333e+257  1.1529707151748922e-259
+   1.235349902385333e+257  1.1529707151748922e-259
+  5b 5b 5b 22 36 63 61 37  65 63 37 62 31 38 34 37
+    6.237475785727061e-42     9.06673896087902e-43
+    6.237475785727061e-42     9.06673896087902e-43
+  66 36 62 64 62 64 37 33  37 31 37 36 30 35 30 65
+    5.686310922831018e-62   2.627124261810699e+179
+    5.686310922831018e-62   2.627124261810699e+179
+  36 61 30 38 64 36 36 63  63 64 35 35 62 62 39 34
+   8.382901479418633e+169   4.0439540576032904e-57
+   8.382901479418633e+169   4.0439540576032904e-57
+  61 64 32 34 66 34 30 31  38 30 32 34 31 30 37 61
+    9.171526404687031e-72  2.0375379171585083e+160
+    9.171526404687031e-72  2.0375379171585083e+160
+  35 38 32 37 22 2c 20 30  2c 20 22 30 78 34 31 20
+    6.983377359929515e-77  1.2832044591892965e-153
+    6.983377359929515e-77  1.2832044591892965e-153
+  30 78 30 34 33 62 36 34  30 65 39 38 33 63 39 36
+   3.5659122239142786e-57   1.7370832608733925e-47
+   3.5659122239142786e-57   1.7370832608733925e-47
+  39 30 61 31 34 63 30 33  39 61 32 30 33 37 65 63
+    3.983584263531978e-62   6.405357671483737e+170
+    3.983584263531978e-62   6.405357671483737e+170
+  63 33 34 36 37 62 32 37  61 30 64 63 64 35 38 66
+    8.243515990404871e-43  2.5716175177996083e+184
+    8.243515990404871e-43  2.5716175177996083e+184
+  31 39 64 37 36 63 37 62  63 31 31 38 64 30 39 66
+  1.3467974840036445e+165  2.6757700850559276e+184
+  1.3467974840036445e+165  2.6757700850559276e+184
+  65 63 34 35 61 64 63 35  33 37 30 61 31 63 35 62
+    1.619704457764176e-51  1.2316210408562767e+165
+    1.619704457764176e-51  1.2316210408562767e+165
+  66 38 30 36 37 63 61 39  66 35 35 35 37 61 34 63
+    2.678977984041209e-32   7.691240565064785e+169
+    2.678977984041209e-32   7.691240565064785e+169
+  66 38 38 35 66 64 62 30  66 65 30 64 63 63 39 63
+   1.2707040482480994e-75   9.581424621266726e+169
+   1.2707040482480994e-75   9.581424621266726e+169
+  33 61 37 31 33 37 32 32  36 31 30 36 66 62 63 37
+    6.756550785005338e-67     6.95380246849618e-42
+    6.756550785005338e-67     6.95380246849618e-42
+  37 39 61 35 20 43 48 45  43 4b 53 49 47 20 56 45
+    5.866242473466438e+25   1.0699519504580977e+26
+    5.866242473466438e+25   1.0699519504580977e+26
+  52 49 46 59 20 31 22 5d  5d 2c 0a 22 30 31 30 30
+   4.332774123520774e+140    1.398380563599275e-76
+   4.332774123520774e+140    1.398380563599275e-76
+  30 30 30 30 30 31 32 37  35 38 37 61 31 30 32 34
+    8.157638402736565e-43    2.897555948892229e-57
+    8.157638402736565e-43    2.897555948892229e-57
+  38 30 30 31 66 34 32 34  61 64 39 34 62 62 35 35
+    2.900173534818494e-57   2.2326262391132054e-52
+    2.900173534818494e-57   2.2326262391132054e-52
+  63 64 36 63 64 36 30 38  36 61 30 65 30 35 37 36
+    4.764416516532889e-38   1.5879400412846658e-47
+    4.764416516532889e-38   1.5879400412846658e-47
+  37 31 37 33 62 64 62 64  66 36 34 37 31 38 37 62
+   3.639145014345063e+175   1.337120425231153e+165
+   3.639145014345063e+175   1.337120425231153e+165
+  65 63 61 37 36 63 30 30  30 30 30 30 30 30 34 39
+   1.4152560968092984e-76    3.888112687727643e-33
+   1.4152560968092984e-76    3.888112687727643e-33
+  34 38 33 30 34 35 30 32  32 30 31 62 38 32 32 61
+    6.011817374894185e-67  1.5988869730428015e+160
+    6.011817374894185e-67  1.5988869730428015e+160
+  64 31 30 64 36 61 64 63  31 61 33 34 31 61 65 38
+   6.152988690607318e+170    5.026333215093856e-37
+   6.152988690607318e+170    5.026333215093856e-37
+  38 33 35 62 65 33 66 37  30 61 32 35 32 30 31 62
+    7.964134128683699e-42   9.898051520971466e+164
+    7.964134128683699e-42   9.898051520971466e+164
+  62 66 66 33 31 66 35 39  63 62 62 39 63 35 33 35
+     4.12133374253591e-33     2.00546570252446e-52
+     4.12133374253591e-33     2.00546570252446e-52
+  33 61 35 66 30 65 63 61  31 38 30 32 32 31 30 30
+  1.3634007295319306e+161    1.398383282274702e-76
+  1.3634007295319306e+161    1.398383282274702e-76
+  65 61 37 62 32 66 37 30  37 34 65 39 61 61 39 63
+    2.020794896069786e-76   9.578463733276752e+169
+    2.020794896069786e-76   9.578463733276752e+169
+  66 37 30 61 61 38 64 30  66 66 65 65 31 33 65 36
+   1.3970029233326594e-75   1.1604487840634427e-46
+   1.3970029233326594e-75   1.1604487840634427e-46
+  62 34 35 64 64 64 61 62  66 31 61 62 39 36 31 62
+   8.012371392228844e+165   9.911611321798244e+164
+   8.012371392228844e+165   9.911611321798244e+164
+  64 61 33 37 38 62 63 64  62 37 37 38 66 61 34 37
+    3.83533676237579e+175    9.138917025312405e-43
+    3.83533676237579e+175    9.138917025312405e-43
+  30 31 66 66 66 66 66 66  66 66 30 31 30 30 66 32
+  1.9035985662511804e+185    6.584059123768776e-66
+  1.9035985662511804e+185    6.584059123768776e-66
+  30 35 32 61 30 31 30 30  30 30 30 30 31 39 37 36
+    1.398380888700402e-76   1.5890099750636563e-47
+    1.398380888700402e-76   1.5890099750636563e-47
+  61 39 31 34 66 63 35 30  63 35 39 30 37 64 38 36
+     1.84712776134054e-76    1.668931904331404e-47
+     1.84712776134054e-76    1.668931904331404e-47
+  66 65 64 34 37 34 62 61  35 63 65 38 62 31 32 61
+  1.2796574977232943e+161  1.5985998270491805e+160
+  1.2796574977232943e+161  1.5985998270491805e+160
+  36 36 65 30 61 34 63 31  33 39 64 38 38 38 61 63
+    8.695538338304813e-71   5.198892240706257e+170
+    8.695538338304813e-71   5.198892240706257e+170
+  30 30 30 30 30 30 30 30  22 2c 20 22 50 32 53 48
+    1.398043286095289e-76    2.612896978874658e+40
+    1.398043286095289e-76    2.612896978874658e+40
+  22 5d 2c 0a 0a 5b 22 54  68 69 73 20 69 73 20 74
+    1.960368525460912e+97  2.3556676759176245e+251
+    1.960368525460912e+97  2.3556676759176245e+251
+  68 65 20 6e 65 61 72 6c  79 2d 73 74 61 6e 64 61
+   2.475102354389807e+214  1.4362202030070042e+161
+   2.475102354389807e+214  1.4362202030070042e+161
+  72 64 20 74 72 61 6e 73  61 63 74 69 6f 6e 20 77
+  1.0620954503183098e+248   6.622781494997587e+265
+  1.0620954503183098e+248   6.622781494997587e+265
+  69 74 68 20 43 48 45 43  4b 53 49 47 56 45 52 49
+        11980855309297874   1.6298140813692505e+45
+        11980855309297874   1.6298140813692505e+45
+  46 59 20 31 20 69 6e 73  74 65 61 64 20 6f 66 20
+  1.0631440560164057e+248  1.3385685792405213e-152
+  1.0631440560164057e+248  1.3385685792405213e-152
+  43 48 45 43 4b 53 49 47  20 66 72 6f 6d 20 74 78
+   2.6299364878383027e+35  1.7012495379406453e+272
+   2.6299364878383027e+35  1.7012495379406453e+272
+  5f 76 61 6c 69 64 2e 6a  73 6f 6e 22 5d 2c 0a 5b
+   2.977760122350905e+203  3.6284952473106546e+130
+   2.977760122350905e+203  3.6284952473106546e+130
+  22 62 75 74 20 77 69 74  68 20 74 68 65 20 73 69
+   5.834395168728815e+252   9.150265983409822e+199
+   5.834395168728815e+252   9.150265983409822e+199
+  67 6e 61 74 75 72 65 20  64 75 70 6c 69 63 61 74
+  1.2796785173062013e-152   3.983861098562337e+252
+  1.2796785173062013e-152   3.983861098562337e+252
+  65 64 20 69 6e 20 74 68  65 20 73 63 72 69 70 74
+  1.4692288627699838e+195   7.520302005152578e+252
+  1.4692288627699838e+195   7.520302005152578e+252
+  50 75 62 4b 65 79 20 77  69 74 68 20 61 20 6e 6f
+    6.64003811534131e+265   5.709461476499038e+228
+    6.64003811534131e+265   5.709461476499038e+228
+  6e 2d 73 74 61 6e 64 61  72 64 20 70 75 73 68 64
+  1.4362202030070014e+161   4.837982636575096e+175
+  1.4362202030070014e+161   4.837982636575096e+175
+  61 74 61 20 70 72 65 66  69 78 22 5d 2c 0a 5b 22
+  1.8226126349161738e+185  3.4646915345234233e-143
+  1.8226126349161738e+185  3.4646915345234233e-143
+  53 65 65 20 46 69 6e 64  41 6e 64 44 65 6c 65 74
+   6.017296647301094e+175   4.908346184955444e+252
+   6.017296647301094e+175   4.908346184955444e+252
+  65 2c 20 77 68 69 63 68  20 77 69 6c 6c 20 6f 6e
+   7.085196629273713e+194   9.001175710183955e+223
+   7.085196629273713e+194   9.001175710183955e+223
+  6c 79 20 72 65 6d 6f 76  65 20 69 66 20 69 74 20
+  3.0925285330741534e+262  2.4356733917488726e-152
+  3.0925285330741534e+262  2.4356733917488726e-152
+  75 73 65 73 20 74 68 65  20 73 61 6d 65 20 70 75
+   3.170958673967293e+180   4.842813117105289e+257
+   3.170958673967293e+180   4.842813117105289e+257
+  73 68 64 61 74 61 20 70  72 65 66 69 78 20 61 73
+  1.2715652642490042e+232    5.98747374172554e+247
+  1.2715652642490042e+232    5.98747374172554e+247
+  20 69 73 20 73 74 61 6e  64 61 72 64 22 5d 2c 0a
+   5.047585746347327e+223  1.1529706644180349e-259
+   5.047585746347327e+223  1.1529706644180349e-259
+  5b 5b 5b 22 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043214897502e-76    1.398043286095289e-76
+    1.398043214897502e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 31 30 30 22 2c 20 30  2c 20 22 44 55 50 20 48
+    6.983377179561166e-77    2.775649418769176e+39
+    6.983377179561166e-77    2.775649418769176e+39
+  41 53 48 31 36 30 20 30  78 31 34 20 30 78 35 62
+    6.990255991883209e-77  1.2363437985938537e+165
+    6.990255991883209e-77  1.2363437985938537e+165
+  36 34 36 32 34 37 35 34  35 34 37 31 30 66 33 63
+    3.379846479193141e-57   7.321174942873065e+169
+    3.379846479193141e-57   7.321174942873065e+169
+  32 32 66 35 66 64 66 30  62 34 30 37 30 34 63 39
+   1.5470614427506932e-75    2.958823231347055e-32
+   1.5470614427506932e-75    2.958823231347055e-32
+  32 66 32 35 63 33 20 45  51 55 41 4c 56 45 52 49
+    9.792741932681157e+24    1.629814107787821e+45
+    9.792741932681157e+24    1.629814107787821e+45
+  46 59 20 43 48 45 43 4b  53 49 47 56 45 52 49 46
+   3.6915200620834524e+54    4.012331313964064e+30
+   3.6915200620834524e+54    4.012331313964064e+30
+  59 20 31 20 30 78 34 63  20 30 78 34 37 20 30 78
+    7.72510647571304e+169   8.519194329178854e+270
+    7.72510647571304e+169   8.519194329178854e+270
+  33 30 34 34 30 32 32 30  36 37 32 38 38 65 61 35
+   1.5714413785362064e-76    1.452930690085115e-51
+   1.5714413785362064e-76    1.452930690085115e-51
+  30 61 61 37 39 39 35 34  33 61 35 33 36 66 66 39
+    3.381103285654742e-57   3.4511531427646997e-32
+    3.381103285654742e-57   3.4511531427646997e-32
+  33 30 36 66 38 65 31 63  62 61 30 35 62 39 63 36
+   6.564955514836728e+169    1.052296038025506e-46
+   6.564955514836728e+169    1.052296038025506e-46
+  62 31 30 39 35 31 31 37  35 62 39 32 34 66 39 36
+    7.709257346090224e-43   1.7378861098650578e-47
+    7.709257346090224e-43   1.7378861098650578e-47
+  37 33 32 35 35 35 65 64  30 32 32 30 32 36 64 37
+  4.1962754858741385e+175    7.250592976057135e-42
+  4.1962754858741385e+175    7.250592976057135e-42
+  62 35 32 36 35 66 33 38  64 32 31 35 34 31 35 31
+    5.700927033538724e-38   1.1994361764519836e-71
+    5.700927033538724e-38   1.1994361764519836e-71
+  39 65 34 61 31 65 35 35  30 34 34 64 35 62 39 65
+    2.233771952111534e-52  4.1144436020742326e+179
+    2.233771952111534e-52  4.1144436020742326e+179
+  31 37 65 31 35 63 64 62  61 66 32 39 61 65 33 37
+   9.392306360143962e+165    8.697473823886588e-43
+   9.392306360143962e+165    8.697473823886588e-43
+  39 32 65 39 39 65 38 38  33 65 37 61 30 31 22 5d
+    7.169165021022361e-38   4.332832383361507e+140
+    7.169165021022361e-38   4.332832383361507e+140
+  5d 2c 0a 22 30 31 30 30  30 30 30 30 30 31 30 30
+    1.398380563599275e-76   1.3983806364294722e-76
+    1.398380563599275e-76   1.3983806364294722e-76
+  30 31 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432860953674e-76    1.398043286095289e-76
+   1.3980432860953674e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 36 61  34 37 33 30 34 34 30 32
+  1.9496671453374237e+160    6.010368466241235e-67
+  1.9496671453374237e+160    6.010368466241235e-67
+  32 30 36 37 32 38 38 65  61 35 30 61 61 37 39 39
+   3.925752330800806e+179    4.856488435164244e-33
+   3.925752330800806e+179    4.856488435164244e-33
+  35 34 33 61 35 33 36 66  66 39 33 30 36 66 38 65
+   2.358256221171862e+184   3.954887784353069e+179
+   2.358256221171862e+184   3.954887784353069e+179
+  31 63 62 61 30 35 62 39  63 36 62 31 30 39 35 31
+    2.805351076413002e-32   1.2012013964565469e-71
+    2.805351076413002e-32   1.2012013964565469e-71
+  31 37 35 62 39 32 34 66  39 36 37 33 32 35 35 35
+  2.1453925624877563e+184     2.21419734560921e-52
+  2.1453925624877563e+184     2.21419734560921e-52
+  65 64 30 32 32 30 32 36  64 37 62 35 32 36 35 66
+   1.2444916561413666e-47   2.253268337135412e+184
+   1.2444916561413666e-47   2.253268337135412e+184
+  33 38 64 32 31 35 34 31  35 31 39 65 34 61 31 65
+   1.1437199255706459e-71   2.817084357516739e+179
+   1.1437199255706459e-71   2.817084357516739e+179
+  35 35 30 34 34 64 35 62  39 65 31 37 65 31 35 63
+  1.2318484681702536e+165   7.998139952779833e+169
+  1.2318484681702536e+165   7.998139952779833e+169
+  64 62 61 66 32 39 61 65  33 37 39 32 65 39 39 65
+  2.2334022311808344e+180  4.0886020388502744e+179
+  2.2334022311808344e+180  4.0886020388502744e+179
+  38 38 33 65 37 61 30 31  32 31 30 33 62 61 38 63
+    9.270610819645313e-72   9.201073109778726e+169
+    9.270610819645313e-72   9.201073109778726e+169
+  38 62 38 36 64 65 61 31  33 31 63 32 32 61 62 39
+    7.876656993113052e-71    2.831836883527766e-32
+    7.876656993113052e-71    2.831836883527766e-32
+  36 37 65 36 64 64 39 39  62 64 61 65 38 65 66 66
+    4.890350997436688e-33  1.9032069505590654e+185
+    4.890350997436688e-33  1.9032069505590654e+185
+  37 61 31 66 37 35 61 32  63 33 35 66 31 66 39 34
+    5.106204930453002e-66    4.046324616588352e-57
+    5.106204930453002e-66    4.046324616588352e-57
+  34 31 30 39 65 33 66 65  35 65 32 32 66 66 66 66
+   2.878825404355418e+180  1.9035983018293223e+185
+   2.878825404355418e+180  1.9035983018293223e+185
+  66 66 66 66 30 31 30 30  30 30 30 30 30 30 30 30
+    1.398380915487653e-76    1.398043286095289e-76
+    1.398380915487653e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 31  35 31 30 30 30 30 30 30
+    9.162216479754085e-72    1.398043286095369e-76
+    9.162216479754085e-72    1.398043286095369e-76
+  30 30 22 2c 20 22 50 32  53 48 22 5d 2c 0a 0a 5b
+    2.393669929840339e-66  3.6099798191179337e+130
+    2.393669929840339e-66  3.6099798191179337e+130
+  22 53 61 6d 65 20 61 73  20 61 62 6f 76 65 2c 20
+   5.987372470843535e+247  1.0589478375027802e-153
+   5.987372470843535e+247  1.0589478375027802e-153
+  62 75 74 20 77 69 74 68  20 74 68 65 20 73 69 67
+  1.4900547067816291e+195  1.4173926348037918e+190
+  1.4900547067816291e+195  1.4173926348037918e+190
+  20 69 6e 20 74 68 65 20  73 63 72 69 70 74 53 69
+  1.2773465768272543e-152  2.3268308668881245e+199
+  1.2773465768272543e-152  2.3268308668881245e+199
+  67 20 61 6c 73 6f 20 70  75 73 68 65 64 20 77 69
+  1.2758092972665362e+232   1.106388488988408e+200
+  1.2758092972665362e+232   1.106388488988408e+200
+  74 68 20 74 68 65 20 73  61 6d 65 20 6e 6f 6e 2d
+   3.582512290695204e+246    7.470480271665889e-90
+   3.582512290695204e+246    7.470480271665889e-90
+  73 74 61 6e 64 61 72 64  20 4f 50 5f 50 55 53 48
+   7.273666055884893e+175    2.631506667231954e+40
+   7.273666055884893e+175    2.631506667231954e+40
+  44 41 54 41 22 5d 2c 0a  5b 5b 5b 22 30 30 30 30
+   1.152970579331734e-259    1.398043214897502e-76
+   1.152970579331734e-259    1.398043214897502e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 31 30 30 22 2c 20 30
+    1.398043286095289e-76    6.983377179561166e-77
+    1.398043286095289e-76    6.983377179561166e-77
+  2c 20 22 44 55 50 20 48  41 53 48 31 36 30 20 30
+    2.775649418769176e+39    6.990255991883209e-77
+    2.775649418769176e+39    6.990255991883209e-77
+  78 31 34 20 30 78 35 62  36 34 36 32 34 37 35 34
+  1.2363437985938537e+165    3.379846479193141e-57
+  1.2363437985938537e+165    3.379846479193141e-57
+  35 34 37 31 30 66 33 63  32 32 66 35 66 64 66 30
+   7.321174942873065e+169   1.5470614427506932e-75
+   7.321174942873065e+169   1.5470614427506932e-75
+  62 34 30 37 30 34 63 39  32 66 32 35 63 33 20 45
+    2.958823231347055e-32    9.792741932681157e+24
+    2.958823231347055e-32    9.792741932681157e+24
+  51 55 41 4c 56 45 52 49  46 59 20 43 48 45 43 4b
+    1.629814107787821e+45   3.6915200620834524e+54
+    1.629814107787821e+45   3.6915200620834524e+54
+  53 49 47 56 45 52 49 46  59 20 31 20 30 78 34 63
+    4.012331313964064e+30    7.72510647571304e+169
+    4.012331313964064e+30    7.72510647571304e+169
+  20 30 78 34 37 20 30 78  33 30 34 34 30 32 32 30
+   8.519194329178854e+270   1.5714413785362064e-76
+   8.519194329178854e+270   1.5714413785362064e-76
+  36 37 32 38 38 65 61 35  30 61 61 37 39 39 35 34
+    1.452930690085115e-51    3.381103285654742e-57
+    1.452930690085115e-51    3.381103285654742e-57
+  33 61 35 33 36 66 66 39  33 30 36 66 38 65 31 63
+   3.4511531427646997e-32   6.564955514836728e+169
+   3.4511531427646997e-32   6.564955514836728e+169
+  62 61 30 35 62 39 63 36  62 31 30 39 35 31 31 37
+    1.052296038025506e-46    7.709257346090224e-43
+    1.052296038025506e-46    7.709257346090224e-43
+  35 62 39 32 34 66 39 36  37 33 32 35 35 35 65 64
+   1.7378861098650578e-47  4.1962754858741385e+175
+   1.7378861098650578e-47  4.1962754858741385e+175
+  30 32 32 30 32 36 64 37  62 35 32 36 35 66 33 38
+    7.250592976057135e-42    5.700927033538724e-38
+    7.250592976057135e-42    5.700927033538724e-38
+  64 32 31 35 34 31 35 31  39 65 34 61 31 65 35 35
+   1.1994361764519836e-71    2.233771952111534e-52
+   1.1994361764519836e-71    2.233771952111534e-52
+  30 34 34 64 35 62 39 65  31 37 65 31 35 63 64 62
+  4.1144436020742326e+179   9.392306360143962e+165
+  4.1144436020742326e+179   9.392306360143962e+165
+  61 66 32 39 61 65 33 37  39 32 65 39 39 65 38 38
+    8.697473823886588e-43    7.169165021022361e-38
+    8.697473823886588e-43    7.169165021022361e-38
+  33 65 37 61 30 31 22 5d  5d 2c 0a 22 30 31 30 30
+   4.332832383361507e+140    1.398380563599275e-76
+   4.332832383361507e+140    1.398380563599275e-76
+  30 30 30 30 30 31 30 30  30 31 30 30 30 30 30 30
+   1.3983806364294722e-76   1.3980432860953674e-76
+   1.3983806364294722e-76   1.3980432860953674e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 36 62
+    1.398043286095289e-76   1.277733860368334e+165
+    1.398043286095289e-76   1.277733860368334e+165
+  34 63 34 37 33 30 34 34  30 32 32 30 36 37 32 38
+   3.2161787939305135e-57    5.353104470897179e-38
+   3.2161787939305135e-57    5.353104470897179e-38
+  38 65 61 35 30 61 61 37  39 39 35 34 33 61 35 33
+    6.234640752630251e-42    5.197114153212867e-62
+    6.234640752630251e-42    5.197114153212867e-62
+  36 66 66 39 33 30 36 66  38 65 31 63 62 61 30 35
+  2.3570078726920447e+184    1.710194342431402e-52
+  2.3570078726920447e+184    1.710194342431402e-52
+  62 39 63 36 62 31 30 39  35 31 31 37 35 62 39 32
+     3.11864003431628e-33    9.415309614264898e-67
+     3.11864003431628e-33    9.415309614264898e-67
+  34 66 39 36 37 33 32 35  35 35 65 64 30 32 32 30
+   1.9001750522685557e-52   1.5714416266046387e-76
+   1.9001750522685557e-52   1.5714416266046387e-76
+  32 36 64 37 62 35 32 36  35 66 33 38 64 32 31 35
+   1.2458781740518362e-47   1.7954340506875093e-52
+   1.2458781740518362e-47   1.7954340506875093e-52
+  34 31 35 31 39 65 34 61  31 65 35 35 30 34 34 64
+  1.7921321114043628e+160    4.99702895186069e+174
+  1.7921321114043628e+160    4.99702895186069e+174
+  35 62 39 65 31 37 65 31  35 63 64 62 61 66 32 39
+    9.606082105020187e-71    3.543696357985138e-33
+    9.606082105020187e-71    3.543696357985138e-33
+  61 65 33 37 39 32 65 39  39 65 38 38 33 65 37 61
+    3.265789475246571e-32  2.0557323335961284e+160
+    3.265789475246571e-32  2.0557323335961284e+160
+  30 31 32 31 30 33 62 61  38 63 38 62 38 36 64 65
+  1.2793753840529427e+161  2.6209115574819853e+180
+  1.2793753840529427e+161  2.6209115574819853e+180
+  61 31 33 31 63 32 32 61  62 39 36 37 65 36 64 64
+  1.5989443700240886e+160   3.999329016130022e+175
+  1.5989443700240886e+160   3.999329016130022e+175
+  39 39 62 64 61 65 38 65  66 66 37 61 31 66 37 35
+  3.9543614747615454e+179   2.4429895266897743e-52
+  3.9543614747615454e+179   2.4429895266897743e-52
+  61 32 63 33 35 66 31 66  39 34 34 31 30 39 65 33
+  1.8482804676871167e+184     4.12729656886913e-61
+  1.8482804676871167e+184     4.12729656886913e-61
+  66 65 35 65 32 32 66 66  66 66 66 66 66 66 30 31
+  1.8862691458258148e+185     9.28207105579738e-72
+  1.8862691458258148e+185     9.28207105579738e-72
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 31 35 31 30 30 30 30  30 30 30 30 22 2c 20 22
+   1.3980432913434632e-76     2.5902785586997e-144
+   1.3980432913434632e-76     2.5902785586997e-144
+  50 32 53 48 22 5d 2c 0a  0a 5b 22 54 68 69 73 20
+  1.1529705962819529e-259  2.3164709136980974e-152
+  1.1529705962819529e-259  2.3164709136980974e-152
+  69 73 20 74 68 65 20 6e  65 61 72 6c 79 2d 73 74
+    2.96338471109781e+222   8.787622692714494e+252
+    2.96338471109781e+222   8.787622692714494e+252
+  61 6e 64 61 72 64 20 74  72 61 6e 73 61 63 74 69
+  2.3472975910893304e+251   9.753851640481545e+199
+  2.3472975910893304e+251   9.753851640481545e+199
+  6f 6e 20 77 69 74 68 20  43 48 45 43 4b 53 49 47
+  1.4591339256131488e-152   2.6299364878383027e+35
+  1.4591339256131488e-152   2.6299364878383027e+35
+  56 45 52 49 46 59 20 31  20 69 6e 73 74 65 61 64
+    4.626526274241862e-72  3.4421087030664346e+175
+    4.626526274241862e-72  3.4421087030664346e+175
+  20 6f 66 20 43 48 45 43  4b 53 49 47 20 66 72 6f
+        11980855309033024    6.97379681419466e+228
+        11980855309033024    6.97379681419466e+228
+  6d 20 74 78 5f 76 61 6c  69 64 2e 6a 73 6f 6e 22
+  1.1757384575741983e+214   7.799566005802822e-143
+  1.1757384575741983e+214   7.799566005802822e-143
+  5d 2c 0a 5b 22 62 75 74  20 77 69 74 68 20 74 68
+   9.798325214879312e+252   1.469222228611249e+195
+   9.798325214879312e+252   1.469222228611249e+195
+  65 20 73 69 67 6e 61 74  75 72 65 20 64 75 70 6c
+   3.993698689038451e+252  2.2163009894042133e+214
+   3.993698689038451e+252  2.2163009894042133e+214
+  69 63 61 74 65 64 20 69  6e 20 74 68 65 20 73 63
+   2.450663546756569e+198   1.154925937069714e+171
+   2.450663546756569e+198   1.154925937069714e+171
+  72 69 70 74 50 75 62 4b  65 79 20 77 69 74 68 20
+    1.414359972316996e+55  1.4591339256137436e-152
+    1.414359972316996e+55  1.4591339256137436e-152
+  61 20 64 69 66 66 65 72  65 6e 74 20 68 61 73 68
+  1.1415640804194648e+243  1.4147577284338403e+195
+  1.1415640804194648e+243  1.4147577284338403e+195
+  74 79 70 65 20 73 75 66  66 69 78 22 5d 2c 0a 5b
+  3.6456824161543757e+185   3.628495247632673e+130
+  3.6456824161543757e+185   3.628495247632673e+130
+  22 53 65 65 20 46 69 6e  64 41 6e 64 44 65 6c 65
+   7.308691073534716e+223  3.6821212456294824e+180
+   7.308691073534716e+223  3.6821212456294824e+180
+  74 65 2c 20 77 68 69 63  68 20 77 69 6c 6c 20 6f
+   7.671127427070958e+170  1.9453297635997415e+227
+   7.671127427070958e+170  1.9453297635997415e+227
+  6e 6c 79 20 72 65 6d 6f  76 65 20 69 66 20 74 68
+   5.571074852741954e+228  1.4692199517532233e+195
+   5.571074852741954e+228  1.4692199517532233e+195
+  65 20 73 69 67 6e 61 74  75 72 65 2c 20 69 6e 63
+   3.993698689038451e+252   9.181491180983481e+170
+   3.993698689038451e+252   9.181491180983481e+170
+  6c 75 64 69 6e 67 20 74  68 65 20 68 61 73 68 20
+   2.348966980247311e+251  1.4588935155827286e-152
+   2.348966980247311e+251  1.4588935155827286e-152
+  74 79 70 65 2c 20 6d 61  74 63 68 65 73 22 5d 2c
+   2.047404874666068e+161    5.455945717864352e-95
+   2.047404874666068e+161    5.455945717864352e-95
+  0a 5b 5b 5b 22 30 30 30  30 30 30 30 30 30 30 30
+   1.3980250594618592e-76    1.398043286095289e-76
+   1.3980250594618592e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 31 30 30 22 2c 20  30 2c 20 22 44 55 50 20
+  1.0491479271388595e-153   4.872704312904001e-153
+  1.0491479271388595e-153   4.872704312904001e-153
+  48 41 53 48 31 36 30 20  30 78 31 34 20 30 78 35
+   1.209123040566424e-153    4.040550612569466e-51
+   1.209123040566424e-153    4.040550612569466e-51
+  62 36 34 36 32 34 37 35  34 35 34 37 31 30 66 33
+   2.4225992756520478e-52    4.314932024438053e-61
+   2.4225992756520478e-52    4.314932024438053e-61
+  63 32 32 66 35 66 64 66  30 62 34 30 37 30 34 63
+  1.7335708680638647e+185   7.619004452981844e+169
+  1.7335708680638647e+185   7.619004452981844e+169
+  39 32 66 32 35 63 33 20  45 51 55 41 4c 56 45 52
+  1.4459880818064462e-153   2.1222872311647527e+88
+  1.4459880818064462e-153   2.1222872311647527e+88
+  49 46 59 20 43 48 45 43  4b 53 49 47 56 45 52 49
+        11980855307308178   1.6298140813692505e+45
+        11980855307308178   1.6298140813692505e+45
+  46 59 20 31 20 30 78 34  37 20 30 78 33 30 34 34
+    6.165390902760468e-56    3.216179410984343e-57
+    6.165390902760468e-56    3.216179410984343e-57
+  30 32 32 30 36 37 32 38  38 65 61 35 30 61 61 37
+    5.353104470897179e-38    6.234640752630251e-42
+    5.353104470897179e-38    6.234640752630251e-42
+  39 39 35 34 33 61 35 33  36 66 66 39 33 30 36 66
+    5.197114153212867e-62  2.3570078726920447e+184
+    5.197114153212867e-62  2.3570078726920447e+184
+  38 65 31 63 62 61 30 35  62 39 63 36 62 31 30 39
+    1.710194342431402e-52     3.11864003431628e-33
+    1.710194342431402e-52     3.11864003431628e-33
+  35 31 31 37 35 62 39 32  34 66 39 36 37 33 32 35
+    9.415309614264898e-67   1.9001750522685557e-52
+    9.415309614264898e-67   1.9001750522685557e-52
+  35 35 65 64 30 32 32 30  32 36 64 37 62 35 32 36
+   1.5714416266046387e-76   1.2458781740518362e-47
+   1.5714416266046387e-76   1.2458781740518362e-47
+  35 66 33 38 64 32 31 35  34 31 35 31 39 65 34 61
+   1.7954340506875093e-52  1.7921321114043628e+160
+   1.7954340506875093e-52  1.7921321114043628e+160
+  31 65 35 35 30 34 34 64  35 62 39 65 31 37 65 31
+    4.99702895186069e+174    9.606082105020187e-71
+    4.99702895186069e+174    9.606082105020187e-71
+  35 63 64 62 61 66 32 39  61 65 33 37 39 32 65 39
+    3.543696357985138e-33    3.265789475246571e-32
+    3.543696357985138e-33    3.265789475246571e-32
+  39 65 38 38 33 65 37 61  38 31 22 5d 5d 2c 0a 22
+  2.0557323335961284e+160  1.0480224142302576e-144
+  2.0557323335961284e+160  1.0480224142302576e-144
+  30 31 30 30 30 30 30 30  30 31 30 30 30 31 30 30
+   1.3980432860953674e-76   1.3983806364295508e-76
+   1.3980432860953674e-76   1.3983806364295508e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 36 61 34 37 33 30  34 34 30 32 32 30 36 37
+   1.6594953185373452e-76    9.949562552004172e-43
+   1.6594953185373452e-76    9.949562552004172e-43
+  32 38 38 65 61 35 30 61  61 37 39 39 35 34 33 61
+  1.4242328604611153e+160   1.687438625945927e+160
+  1.4242328604611153e+160   1.687438625945927e+160
+  35 33 36 66 66 39 33 30  36 66 38 65 31 63 62 61
+   1.6602359336808823e-76  1.2925570861634984e+161
+   1.6602359336808823e-76  1.2925570861634984e+161
+  30 35 62 39 63 36 62 31  30 39 35 31 31 37 35 62
+    8.246305819448886e-71   1.221723265820281e+165
+    8.246305819448886e-71   1.221723265820281e+165
+  39 32 34 66 39 36 37 33  32 35 35 35 65 64 30 32
+   5.6424792601220865e-62    6.080193522453417e-67
+   5.6424792601220865e-62    6.080193522453417e-67
+  32 30 32 36 64 37 62 35  32 36 35 66 33 38 64 32
+    1.521502453877014e-51    5.999873676290842e-66
+    1.521502453877014e-51    5.999873676290842e-66
+  31 35 34 31 35 31 39 65  34 61 31 65 35 35 30 34
+    4.08341798378506e+179   2.5820588355316993e-57
+    4.08341798378506e+179   2.5820588355316993e-57
+  34 64 35 62 39 65 31 37  65 31 35 63 64 62 61 66
+     7.80037021175825e-43  1.4773577174029953e+185
+     7.80037021175825e-43  1.4773577174029953e+185
+  32 39 61 65 33 37 39 32  65 39 39 65 38 38 33 65
+    9.352996243746986e-67  3.1153153556142154e+179
+    9.352996243746986e-67  3.1153153556142154e+179
+  37 61 30 31 32 31 30 33  62 61 38 63 38 62 38 36
+    3.936099003628407e-62   1.6683986034189874e-47
+    3.936099003628407e-62   1.6683986034189874e-47
+  64 65 61 31 33 31 63 32  32 61 62 39 36 37 65 36
+    5.695022361429609e-66   1.1613081013703401e-46
+    5.695022361429609e-66   1.1613081013703401e-46
+  64 64 39 39 62 64 61 65  38 65 66 66 37 61 31 66
+  2.2552777615145184e+180  1.8462092747053975e+184
+  2.2552777615145184e+180  1.8462092747053975e+184
+  37 35 61 32 63 33 35 66  31 66 39 34 34 31 30 39
+  2.2521028877662652e+184    3.118504827631565e-33
+  2.2521028877662652e+184    3.118504827631565e-33
+  65 33 66 65 35 65 32 32  66 66 66 66 66 66 66 66
+    6.823213056314656e-67  1.9035985662552932e+185
+    6.823213056314656e-67  1.9035985662552932e+185
+  30 31 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432860953674e-76    1.398043286095289e-76
+   1.3980432860953674e-76    1.398043286095289e-76
+  30 30 30 31 35 31 30 30  30 30 30 30 30 30 22 2c
+   1.3983872304507443e-76    4.257571555502434e-96
+   1.3983872304507443e-76    4.257571555502434e-96
+  20 22 50 32 53 48 22 5d  2c 0a 0a 5b 22 41 6e 20
+   4.354357046338091e+140  1.8051828088988972e-152
+   4.354357046338091e+140  1.8051828088988972e-152
+  69 6e 76 61 6c 69 64 20  50 32 53 48 20 54 72 61
+   1.217905871867967e-152  2.5768397037579313e+161
+   1.217905871867967e-152  2.5768397037579313e+161
+  6e 73 61 63 74 69 6f 6e  22 5d 2c 0a 5b 5b 5b 22
+   9.083672062285389e+223  3.5053249760825546e-143
+   9.083672062285389e+223  3.5053249760825546e-143
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 31 30 30
+    1.398043286095289e-76   1.3983806364294722e-76
+    1.398043286095289e-76   1.3983806364294722e-76
+  22 2c 20 30 2c 20 22 48  41 53 48 31 36 30 20 30
+    3.083923668804203e+39    6.990255991883209e-77
+    3.083923668804203e+39    6.990255991883209e-77
+  78 31 34 20 30 78 37 61  30 35 32 63 38 34 30 62
+  2.0622497432467033e+160    9.33124268338547e+164
+  2.0622497432467033e+160    9.33124268338547e+164
+  61 37 33 61 66 32 36 37  35 35 64 65 34 32 63 66
+    9.953422853117115e-43  1.6313255036472347e+185
+    9.953422853117115e-43  1.6313255036472347e+185
+  30 31 63 63 39 65 30 61  34 39 66 65 66 30 20 45
+  1.4406547340180228e+160    9.785687789748835e+24
+  1.4406547340180228e+160    9.785687789748835e+24
+  51 55 41 4c 22 5d 5d 2c  0a 22 30 31 30 30 30 30
+   5.4988731860599135e-95   1.3980432912417352e-76
+   5.4988731860599135e-95   1.3980432912417352e-76
+  30 30 30 31 30 30 30 31  30 30 30 30 30 30 30 30
+    9.162216513489118e-72    1.398043286095289e-76
+    9.162216513489118e-72    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 39 30 38
+    1.398043286095289e-76     4.76762627782209e-38
+    1.398043286095289e-76     4.76762627782209e-38
+  35 37 36 38 36 31 37 34  32 30 36 39 37 33 32 30
+   3.6947359709574413e-57    1.571787979071593e-76
+   3.6947359709574413e-57    1.571787979071593e-76
+  66 66 66 66 66 66 66 66  30 31 30 30 30 30 30 30
+  1.9035985662552932e+185   1.3980432860953674e-76
+  1.9035985662552932e+185   1.3980432860953674e-76
+  30 30 30 30 30 30 30 30  30 30 30 31 35 31 30 30
+    1.398043286095289e-76   1.3983872304507443e-76
+    1.398043286095289e-76   1.3983872304507443e-76
+  30 30 30 30 30 30 22 2c  20 22 50 32 53 48 22 5d
+    4.257571555502434e-96   4.354357046338091e+140
+    4.257571555502434e-96   4.354357046338091e+140
+  2c 0a 0a 5b 22 54 65 73  74 73 20 66 6f 72 20 43
+   7.456410349988096e+247         2314711203854778
+   7.456410349988096e+247         2314711203854778
+  68 65 63 6b 54 72 61 6e  73 61 63 74 69 6f 6e 28
+    5.04519103865698e+223   6.179421973272868e-114
+    5.04519103865698e+223   6.179421973272868e-114
+  29 22 5d 2c 0a 5b 22 4e  6f 20 69 6e 70 75 74 73
+   2.4743332180091277e+68  1.4304591902772858e+248
+   2.4743332180091277e+68  1.4304591902772858e+248
+  22 5d 2c 0a 5b 5b 5b 22  30 30 30 30 30 30 30 30
+  3.5053249760825546e-143    1.398043286095289e-76
+  3.5053249760825546e-143    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 31 30 30  22 2c 20 30 2c 20 22 48
+   1.3983806364294722e-76    3.083923668804203e+39
+   1.3983806364294722e-76    3.083923668804203e+39
+  41 53 48 31 36 30 20 30  78 31 34 20 30 78 37 61
+    6.990255991883209e-77  2.0622497432467033e+160
+    6.990255991883209e-77  2.0622497432467033e+160
+  30 35 32 63 38 34 30 62  61 37 33 61 66 32 36 37
+    9.33124268338547e+164    9.953422853117115e-43
+    9.33124268338547e+164    9.953422853117115e-43
+  35 35 64 65 34 32 63 66  30 31 63 63 39 65 30 61
+  1.6313255036472347e+185  1.4406547340180228e+160
+  1.6313255036472347e+185  1.4406547340180228e+160
+  34 39 66 65 66 30 20 45  51 55 41 4c 22 5d 5d 2c
+    9.785687789748835e+24   5.4988731860599135e-95
+    9.785687789748835e+24   5.4988731860599135e-95
+  0a 22 30 31 30 30 30 30  30 30 30 30 30 31 30 30
+   1.3980432912417352e-76   1.3983806364294722e-76
+   1.3980432912417352e-76   1.3983806364294722e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 31
+    1.398043286095289e-76    9.162216479754085e-72
+    1.398043286095289e-76    9.162216479754085e-72
+  35 31 30 30 30 30 30 30  30 30 22 2c 20 22 50 32
+    1.398043286095369e-76    2.393669929840339e-66
+    1.398043286095369e-76    2.393669929840339e-66
+  53 48 22 5d 2c 0a 0a 5b  22 4e 6f 20 6f 75 74 70
+  3.6099798191179337e+130   5.082006987428596e+233
+  3.6099798191179337e+130   5.082006987428596e+233
+  75 74 73 22 5d 2c 0a 5b  5b 5b 22 30 30 30 30 30
+  3.6284952474726766e+130   1.3980432858171725e-76
+  3.6284952474726766e+130   1.3980432858171725e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  31 30 30 22 2c 20 30 2c
+    1.398043286095289e-76    7.549518397495304e-96
+    1.398043286095289e-76    7.549518397495304e-96
+  20 22 48 41 53 48 31 36  30 20 30 78 31 34 20 30
+   1.1825180300277662e-47    6.996971879148275e-77
+   1.1825180300277662e-47    6.996971879148275e-77
+  78 30 35 61 62 39 65 31  34 64 39 38 33 37 34 32
+    9.609957909073436e-71    7.498392170076699e-67
+    9.609957909073436e-71    7.498392170076699e-67
+  35 31 33 66 30 66 34 35  31 65 31 30 35 66 66 62
+    2.129773350146725e-52  1.0319082568802296e+166
+    2.129773350146725e-52  1.0319082568802296e+166
+  34 31 39 38 64 31 64 64  34 20 45 51 55 41 4c 22
+   3.995461471367432e+175  1.8102167830449426e-143
+   3.995461471367432e+175  1.8102167830449426e-143
+  5d 5d 2c 0a 22 30 31 30  30 30 30 30 30 30 31 30
+    1.484386327115762e-76   1.4844049716462333e-76
+    1.484386327115762e-76   1.4844049716462333e-76
+  30 30 31 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432861153965e-76    1.398043286095289e-76
+   1.3980432861153965e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 36  64 34 38 33 30 34 35 30
+    1.107644006727337e-47   1.8312011307906087e-76
+    1.107644006727337e-47   1.8312011307906087e-76
+  32 32 31 30 30 66 31 36  37 30 33 31 30 34 61 61
+    1.190499712756251e-47  1.2093544479359153e+161
+    1.190499712756251e-47  1.2093544479359153e+161
+  62 34 65 34 30 38 38 33  31 37 63 38 36 32 64 61
+    5.887430803426786e-62  1.4196983141057631e+161
+    5.887430803426786e-62  1.4196983141057631e+161
+  65 63 38 33 34 34 30 32  34 32 34 31 31 62 30 33
+    6.010368533013726e-67    3.982623576592478e-62
+    6.010368533013726e-67    3.982623576592478e-62
+  39 64 31 34 32 38 30 65  30 33 64 64 33 33 62 34
+   2.629028686360436e+179   2.3195421962891135e-56
+   2.629028686360436e+179   2.3195421962891135e-56
+  38 37 61 62 38 30 32 32  30 31 33 31 38 61 37 62
+    6.746437810368185e-67  1.3463493287605964e+165
+    6.746437810368185e-67  1.3463493287605964e+165
+  65 32 33 36 36 37 32 63  35 63 35 36 30 38 33 65
+    6.87452577277639e+169   3.115295114954144e+179
+    6.87452577277639e+169   3.115295114954144e+179
+  62 37 61 35 61 31 39 35  62 63 35 37 61 34 30 61
+    2.630260394231043e-52  1.4238893795986354e+160
+    2.630260394231043e-52  1.4238893795986354e+160
+  66 37 39 32 33 66 66 38  35 34 35 30 31 36 63 64
+   5.2660310070078745e-37  3.8013076155122375e+175
+   5.2660310070078745e-37  3.8013076155122375e+175
+  33 62 35 37 31 65 32 61  36 30 31 32 33 32 31 30
+  1.6163825964871407e+160   1.4850836359540534e-76
+  1.6163825964871407e+160   1.4850836359540534e-76
+  33 63 34 30 65 35 64 33  33 39 64 66 33 66 33 30
+    3.929946018515155e-61   1.6753494931326686e-76
+    3.929946018515155e-61   1.6753494931326686e-76
+  62 66 37 35 33 65 37 65  30 34 34 35 30 61 65 34
+   3.792156795168149e+179   2.7247787586490416e-56
+   3.792156795168149e+179   2.7247787586490416e-56
+  65 66 37 36 63 39 65 34  35 35 38 37 64 31 64 39
+   2.7049642967571716e-56   3.1112143192747576e-32
+   2.7049642967571716e-56   3.1112143192747576e-32
+  39 33 62 64 63 34 63 64  30 36 66 30 36 35 31 63
+    3.79991337434184e+175   6.494180991665072e+169
+    3.79991337434184e+175   6.494180991665072e+169
+  37 61 63 66 66 66 66 66  66 66 66 30 30 30 30 30
+  1.9035985661955332e+185   1.3980432871853598e-76
+  1.9035985661955332e+185   1.3980432871853598e-76
+  30 30 30 30 30 22 2c 20  22 50 32 53 48 22 5d 2c
+  1.0491479271301769e-153    5.455822643446265e-95
+  1.0491479271301769e-153    5.455822643446265e-95
+  0a 0a 5b 22 4e 65 67 61  74 69 76 65 20 6f 75 74
+  1.6446147361303655e+161   9.821580625142928e+252
+  1.6446147361303655e+161   9.821580625142928e+252
+  70 75 74 22 5d 2c 0a 5b  5b 5b 22 30 30 30 30 30
+  3.6284952475050784e+130   1.3980432858171725e-76
+  3.6284952475050784e+130   1.3980432858171725e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  31 30 30 22 2c 20 30 2c
+    1.398043286095289e-76    7.549518397495304e-96
+    1.398043286095289e-76    7.549518397495304e-96
+  20 22 48 41 53 48 31 36  30 20 30 78 31 34 20 30
+   1.1825180300277662e-47    6.996971879148275e-77
+   1.1825180300277662e-47    6.996971879148275e-77
+  78 61 65 36 30 39 61 63  61 38 30 36 31 64 37 37
+   5.200034712952251e+170    1.048905572540386e-42
+   5.200034712952251e+170    1.048905572540386e-42
+  63 35 65 31 31 31 66 36  62 62 36 32 35 30 31 61
+     1.21475919331216e-46  1.5103268095946432e+160
+     1.21475919331216e-46  1.5103268095946432e+160
+  36 62 62 65 32 62 66 64  62 20 45 51 55 41 4c 22
+   4.428912155564085e+175   1.810216783044953e-143
+   4.428912155564085e+175   1.810216783044953e-143
+  5d 5d 2c 0a 22 30 31 30  30 30 30 30 30 30 31 30
+    1.484386327115762e-76   1.4844049716462333e-76
+    1.484386327115762e-76   1.4844049716462333e-76
+  30 30 31 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432861153965e-76    1.398043286095289e-76
+   1.3980432861153965e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 36  64 34 38 33 30 34 35 30
+    1.107644006727337e-47   1.8312011307906087e-76
+    1.107644006727337e-47   1.8312011307906087e-76
+  32 32 30 30 36 33 32 32  32 63 62 62 31 32 38 37
+    6.750772107064181e-67   1.0849891261221678e-42
+    6.750772107064181e-67   1.0849891261221678e-42
+  33 31 66 63 30 39 64 65  30 64 37 33 32 33 37 34
+   2.622415335434936e+180   3.6959708031174125e-57
+   2.622415335434936e+180   3.6959708031174125e-57
+  36 35 33 39 31 36 36 35  34 34 64 36 63 31 64 66
+    2.319008492775286e-52   1.716036329191896e+185
+    2.319008492775286e-52   1.716036329191896e+185
+  38 34 64 38 36 37 63 63  65 61 38 34 62 63 63 38
+   5.801537651643128e+170   4.5581479638412005e-37
+   5.801537651643128e+170   4.5581479638412005e-37
+  39 30 33 30 32 32 31 30  30 62 66 35 36 38 65 38
+   1.4850823079244116e-76     4.98869861509427e-37
+   1.4850823079244116e-76     4.98869861509427e-37
+  35 35 32 38 34 34 64 65  36 36 34 63 64 34 31 36
+  2.6198902527769757e+180   1.1771903877810862e-47
+  2.6198902527769757e+180   1.1771903877810862e-47
+  34 38 61 30 33 31 35 35  34 33 32 37 61 61 38 38
+    2.212567594936227e-52    7.164752573896134e-38
+    2.212567594936227e-52    7.164752573896134e-38
+  34 34 61 66 33 34 62 34  66 32 37 33 39 37 63 36
+   2.3200400526153476e-56   1.0518341444356128e-46
+   2.3200400526153476e-56   1.0518341444356128e-46
+  35 62 39 32 63 30 34 64  65 30 31 32 33 32 31 30
+    4.99335684242489e+174    1.485083635954068e-76
+    4.99335684242489e+174    1.485083635954068e-76
+  32 34 33 65 63 33 37 64  65 65 30 65 32 65 30 35
+   5.738247201474677e+174    1.711749212558406e-52
+   5.738247201474677e+174    1.711749212558406e-52
+  33 61 39 63 39 37 36 66  34 33 31 34 37 65 37 39
+  2.3599225238335526e+184    4.505785056537963e-33
+  2.3599225238335526e+184    4.505785056537963e-33
+  62 63 37 64 39 64 63 36  30 36 65 61 35 31 30 31
+   1.0614562572643428e-46    9.164472179750897e-72
+   1.0614562572643428e-46    9.164472179750897e-72
+  30 61 66 31 61 63 38 30  64 62 36 62 30 36 39 65
+   2.1062062147458182e-76  4.0865719198918314e+179
+   2.1062062147458182e-76  4.0865719198918314e+179
+  31 61 63 66 66 66 66 66  66 66 66 30 31 66 66 66
+  1.9035985661955314e+185   1.903529566376046e+185
+  1.9035985661955314e+185   1.903529566376046e+185
+  66 66 66 66 66 66 66 66  66 66 66 66 66 30 31 35
+  1.9035985662552932e+185    1.794621861311294e-52
+  1.9035985662552932e+185    1.794621861311294e-52
+  31 30 30 30 30 30 30 30  30 22 2c 20 22 50 32 53
+   1.3980432860952892e-76    5.968685125563565e+92
+   1.3980432860952892e-76    5.968685125563565e+92
+  48 22 5d 2c 0a 0a 5b 22  4d 41 58 5f 4d 4f 4e 45
+  3.4646246866285803e-143    7.328453762038457e+25
+  3.4646246866285803e-143    7.328453762038457e+25
+  59 20 2b 20 31 20 6f 75  74 70 75 74 22 5d 2c 0a
+  4.6735417783310057e+257   1.152970703213239e-259
+  4.6735417783310057e+257   1.152970703213239e-259
+  5b 5b 5b 22 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043214897502e-76    1.398043286095289e-76
+    1.398043214897502e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 31 30 30 22 2c 20 30  2c 20 22 48 41 53 48 31
+    6.983377179561166e-77   2.7535167424148395e-71
+    6.983377179561166e-77   2.7535167424148395e-71
+  36 30 20 30 78 31 34 20  30 78 33 32 61 66 61 63
+  1.5060806567872225e-153   5.253331721558701e+170
+  1.5060806567872225e-153   5.253331721558701e+170
+  32 38 31 34 36 32 62 38  32 32 61 64 62 65 63 35
+    4.277891857908329e-37   1.6200322323178533e-51
+    4.277891857908329e-37   1.6200322323178533e-51
+  30 39 34 62 38 64 34 64  33 33 37 64 64 35 62 64
+   5.043434257160644e+174  3.6028249778569336e+175
+   5.043434257160644e+174  3.6028249778569336e+175
+  36 61 20 45 51 55 41 4c  22 5d 5d 2c 0a 22 30 31
+   2.1760541511822953e+59    9.130936148260522e-72
+   2.1760541511822953e+59    9.130936148260522e-72
+  30 30 30 30 30 30 30 31  30 30 30 31 30 30 30 30
+    9.162216479754085e-72   1.3980432912428464e-76
+    9.162216479754085e-72   1.3980432912428464e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  36 65 34 39 33 30 34 36  30 32 32 31 30 30 65 31
+   1.3813382819587834e-47     9.59369298070964e-71
+   1.3813382819587834e-47     9.59369298070964e-71
+  65 61 64 62 61 30 30 64  39 32 39 36 63 37 34 33
+   4.004028398701596e+174   4.9143243054874755e-62
+   4.004028398701596e+174   4.9143243054874755e-62
+  63 62 36 65 63 63 37 30  33 66 64 39 64 64 63 39
+   2.0198474314522813e-76   2.9878344521648374e-32
+   2.0198474314522813e-76   2.9878344521648374e-32
+  62 33 63 64 31 32 39 30  36 31 37 36 61 32 32 36
+    2.175974743195634e-76   1.2450752957945768e-47
+    2.175974743195634e-76   1.2450752957945768e-47
+  61 65 34 63 31 38 64 36  62 30 30 37 39 36 30 32
+   1.1067796615349441e-46    6.013294737042336e-67
+   1.1067796615349441e-46    6.013294737042336e-67
+  32 31 30 30 61 37 31 61  65 66 37 64 32 38 37 34
+  1.5127884725290477e+160   3.6990827760394823e-57
+  1.5127884725290477e+160   3.6990827760394823e-57
+  64 65 66 66 36 38 31 62  61 36 30 38 30 66 31 62
+   9.916084012763346e+164   1.001950472222351e+165
+   9.916084012763346e+164   1.001950472222351e+165
+  32 37 38 62 61 63 37 62  62 39 39 63 36 31 62 30
+  1.3468354148530674e+165   1.2568897415095573e-75
+  1.3468354148530674e+165   1.2568897415095573e-75
+  38 61 38 35 66 34 33 31  31 39 37 30 66 66 65 37
+   1.0869466266491111e-71     7.67687234838235e-42
+   1.0869466266491111e-71     7.67687234838235e-42
+  66 36 33 66 30 31 32 33  32 31 30 33 30 63 30 35
+    4.422265421880921e-62   1.7109300521603634e-52
+    4.422265421880921e-62   1.7109300521603634e-52
+  38 38 64 63 34 34 64 39  32 62 64 63 62 66 38 65
+   3.1129074367949694e-32   3.954997104313507e+179
+   3.1129074367949694e-32   3.954997104313507e+179
+  37 32 30 39 33 34 36 36  37 36 36 66 64 63 32 36
+   1.5192529409326435e-47   1.2581751707636877e-47
+   1.5192529409326435e-47   1.2581751707636877e-47
+  35 65 61 64 38 64 62 36  34 35 31 37 62 30 63 35
+   1.0067172012980524e-46   1.6027399505158834e-51
+   1.0067172012980524e-46   1.6027399505158834e-51
+  34 32 32 37 35 62 37 30  66 66 66 62 61 63 66 66
+     2.01944922660806e-76   1.902596178639379e+185
+     2.01944922660806e-76   1.902596178639379e+185
+  66 66 66 66 66 66 30 31  30 31 34 30 30 37 35 61
+     9.28207105579738e-72  1.8642004145507123e+160
+     9.28207105579738e-72  1.8642004145507123e+160
+  66 30 37 35 30 37 30 30  30 31 35 31 30 30 30 30
+   1.4004047643131305e-76   1.3980432913434632e-76
+   1.4004047643131305e-76   1.3980432913434632e-76
+  30 30 30 30 22 2c 20 22  50 32 53 48 22 5d 2c 0a
+     2.5902785586997e-144  1.1529705962819529e-259
+     2.5902785586997e-144  1.1529705962819529e-259
+  0a 5b 22 4d 41 58 5f 4d  4f 4e 45 59 20 6f 75 74
+   5.1577923080288237e+64   9.821580292157647e+252
+   5.1577923080288237e+64   9.821580292157647e+252
+  70 75 74 20 2b 20 31 20  6f 75 74 70 75 74 22 5d
+  1.2772899307535653e-153   4.395417048044186e+140
+  1.2772899307535653e-153   4.395417048044186e+140
+  2c 0a 5b 5b 5b 22 30 30  30 30 30 30 30 30 30 30
+   1.3933772679372857e-76    1.398043286095289e-76
+   1.3933772679372857e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 31 30 30 22 2c  20 30 2c 20 22 48 41 53
+    4.257571569454917e-96   1.1265148378945013e+93
+    4.257571569454917e-96   1.1265148378945013e+93
+  48 31 36 30 20 30 78 31  34 20 30 78 62 35 35 38
+    2.190386854601886e-70    6.232627910460688e-38
+    2.190386854601886e-70    6.232627910460688e-38
+  63 62 66 34 39 33 30 39  35 34 61 61 36 61 33 34
+    3.120024156097206e-33   3.0873700707509954e-57
+    3.120024156097206e-33   3.0873700707509954e-57
+  34 33 36 33 61 31 35 36  36 38 64 37 34 37 37 61
+   1.4500763368078954e-47  2.0399446354177812e+160
+   1.4500763368078954e-47  2.0399446354177812e+160
+  65 37 31 36 20 45 51 55  41 4c 22 5d 5d 2c 0a 22
+    9.67011066926171e+102  1.0480224142312421e-144
+    9.67011066926171e+102  1.0480224142312421e-144
+  30 31 30 30 30 30 30 30  30 31 30 30 30 31 30 30
+   1.3980432860953674e-76   1.3983806364295508e-76
+   1.3980432860953674e-76   1.3983806364295508e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 36 64 34 38 33 30  34 35 30 32 32 30 32 37
+   1.6598326843142014e-76    8.155900517668814e-43
+   1.6598326843142014e-76    8.155900517668814e-43
+  64 65 63 63 63 31 34 61  61 36 36 36 38 65 37 38
+   1.774340213097848e+160    6.875286893398252e-38
+   1.774340213097848e+160    6.875286893398252e-38
+  61 38 63 39 64 61 33 34  38 34 66 62 63 64 34 66
+    3.087481510808848e-57   2.166208219533595e+184
+    3.087481510808848e-57   2.166208219533595e+184
+  39 64 63 63 39 62 62 37  64 31 62 38 35 31 34 36
+    6.594824706105002e-42   1.3816076431785046e-47
+    6.594824706105002e-42   1.3816076431785046e-47
+  33 31 34 62 32 31 62 39  61 65 34 64 38 36 30 32
+   2.8029483734862965e-32    6.013290072492854e-67
+   2.8029483734862965e-32    6.013290072492854e-67
+  32 31 30 30 64 30 62 34  33 64 65 63 65 38 63 66
+     2.31814356598499e-56  1.6333808004702113e+185
+     2.31814356598499e-56  1.6333808004702113e+185
+  62 30 37 33 34 38 64 65  30 63 61 38 62 63 35 62
+  2.6219163449308577e+180  1.2316639567981354e+165
+  2.6219163449308577e+180  1.2316639567981354e+165
+  38 36 32 37 36 66 61 38  38 66 37 66 32 31 33 38
+    4.090547487839296e-37    5.640073406003043e-38
+    4.090547487839296e-37    5.640073406003043e-38
+  33 38 31 31 32 38 62 37  63 33 36 61 62 32 65 34
+    6.535930780552033e-42   2.7014777901212394e-56
+    6.535930780552033e-42   2.7014777901212394e-56
+  32 32 36 34 30 31 32 33  32 31 30 32 39 62 62 31
+     4.42226469759546e-62    8.323837692080172e-71
+     4.42226469759546e-62    8.323837692080172e-71
+  33 34 36 33 64 64 64 35  64 32 63 63 30 35 64 61
+    1.703232168453628e-51  1.4205158342442846e+161
+    1.703232168453628e-51  1.4205158342442846e+161
+  36 65 38 34 65 33 37 35  33 36 63 62 39 35 32 35
+   2.4222726794659163e-52    1.900994176339955e-52
+   2.4222726794659163e-52    1.900994176339955e-52
+  37 30 33 63 66 64 38 66  34 33 61 66 64 62 34 31
+  2.5911234815704523e+184    1.153713011588129e-71
+  2.5911234815704523e+184    1.153713011588129e-71
+  34 39 38 38 39 38 37 61  39 32 66 36 61 63 66 66
+  2.0402945835420745e+160  1.9025959557609748e+185
+  2.0402945835420745e+160  1.9025959557609748e+185
+  66 66 66 66 66 66 30 32  30 30 34 30 30 37 35 61
+     6.08309808712737e-67  1.8642004145506324e+160
+     6.08309808712737e-67  1.8642004145506324e+160
+  66 30 37 35 30 37 30 30  30 31 35 31 30 30 30 31
+   1.4004047643131305e-76     9.16221651414852e-72
+   1.4004047643131305e-76     9.16221651414852e-72
+  30 30 30 30 30 30 30 30  30 30 30 30 30 31 35 31
+    1.398043286095289e-76   1.1994327051037537e-71
+    1.398043286095289e-76   1.1994327051037537e-71
+  30 30 30 30 30 30 30 30  22 2c 20 22 50 32 53 48
+    1.398043286095289e-76    2.612896978874658e+40
+    1.398043286095289e-76    2.612896978874658e+40
+  22 5d 2c 0a 0a 5b 22 44  75 70 6c 69 63 61 74 65
+    1.693007301598239e+20   5.285555198580949e+180
+    1.693007301598239e+20   5.285555198580949e+180
+  20 69 6e 70 75 74 73 22  5d 2c 0a 5b 5b 5b 22 30
+   9.971292263255848e-143    7.926648032307966e-77
+   9.971292263255848e-143    7.926648032307966e-77
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 31 30 30 22
+    1.398043286095289e-76   5.185635643610081e-144
+    1.398043286095289e-76   5.185635643610081e-144
+  2c 20 30 2c 20 22 48 41  53 48 31 36 30 20 30 78
+        3163200.345218679   8.519137955491178e+270
+        3163200.345218679   8.519137955491178e+270
+  31 34 20 30 78 32 33 36  64 30 36 33 39 64 62 36
+   1.3135220606572618e-47   1.0067178761164118e-46
+   1.3135220606572618e-47   1.0067178761164118e-46
+  32 62 30 37 37 33 66 64  38 61 63 33 34 64 63 38
+   4.392600053886877e+175    4.558901290236343e-37
+   4.392600053886877e+175    4.558901290236343e-37
+  35 61 65 31 39 65 39 61  62 61 38 30 61 20 45 51
+  2.2314791626385753e+160   3.2063876000742446e+83
+  2.2314791626385753e+160   3.2063876000742446e+83
+  55 41 4c 22 5d 5d 2c 0a  22 30 31 30 30 30 30 30
+  1.1530070994902142e-259   1.3980432861153922e-76
+  1.1530070994902142e-259   1.3980432861153922e-76
+  30 30 32 30 30 30 31 30  30 30 30 30 30 30 30 30
+   1.4844049716864486e-76    1.398043286095289e-76
+   1.4844049716864486e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 36 63 34 37 33
+    1.398043286095289e-76    5.640735237528268e-62
+    1.398043286095289e-76    5.640735237528268e-62
+  30 34 34 30 32 32 30 34  62 62 31 31 39 37 30 35
+   2.5801841351919756e-57   1.6929997902835164e-52
+   2.5801841351919756e-57   1.6929997902835164e-52
+  33 64 30 64 37 37 39 39  62 66 31 62 33 30 63 64
+     4.85636504270392e-33  3.7966767983308794e+175
+     4.85636504270392e-33  3.7966767983308794e+175
+  35 30 33 63 34 34 62 35  38 64 36 32 34 30 63 63
+   1.5204627075254244e-51   5.793272783869034e+170
+   1.5204627075254244e-51   5.793272783869034e+170
+  63 62 64 63 38 35 62 36  66 65 37 36 64 30 38 37
+    9.966676027635473e-47   1.0846735790716433e-42
+    9.966676027635473e-47   1.0846735790716433e-42
+  39 38 30 32 30 38 66 30  32 32 30 34 62 65 65 65
+    1.535129769896135e-75   2.774473701363839e+180
+    1.535129769896135e-75   2.774473701363839e+180
+  64 37 38 32 30 30 31 37  38 66 66 63 36 63 37 34
+    7.707471325365688e-43   3.7258514574433906e-57
+    7.707471325365688e-43   3.7258514574433906e-57
+  32 33 37 62 62 37 34 62  33 66 32 37 36 62 62 62
+  1.1641803934750968e+165   8.469136438360957e+165
+  1.1641803934750968e+165   8.469136438360957e+165
+  34 30 39 38 62 35 36 30  35 64 38 31 34 33 30 34
+   1.9179660811704484e-76    2.580811308101341e-57
+   1.9179660811704484e-76    2.580811308101341e-57
+  66 65 31 32 38 62 66 31  34 33 31 30 31 32 33 32
+    1.013496659903759e-70    7.120215514569891e-67
+    1.013496659903759e-70    7.120215514569891e-67
+  31 30 33 39 65 38 38 31  35 65 31 35 39 35 32 61
+    1.370820091331233e-71  1.5999177977927268e+160
+    1.370820091331233e-71  1.5999177977927268e+160
+  37 63 33 66 61 64 61 31  39 30 35 66 38 63 66 35
+     7.87486887388702e-71   1.8698978746549927e-51
+     7.87486887388702e-71   1.8698978746549927e-51
+  35 34 31 39 38 33 37 31  33 33 62 64 37 37 35 36
+   1.3130778047288672e-71   1.4516363461263353e-47
+   1.3130778047288672e-71   1.4516363461263353e-47
+  63 30 65 66 31 34 66 63  38 64 66 65 35 30 63 30
+   6.703728337257781e+170    1.325708164425831e-75
+   6.703728337257781e+170    1.325708164425831e-75
+  64 65 61 61 63 66 66 66  66 66 66 66 66 30 30 30
+  1.9035946506588042e+185   1.3981147249895865e-76
+  1.9035946506588042e+185   1.3981147249895865e-76
+  31 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432860952892e-76    1.398043286095289e-76
+   1.3980432860952892e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 36 63 34  37 33 30 34 34 30 32 32
+   2.4484768422105777e-56    6.746414149942206e-67
+   2.4484768422105777e-56    6.746414149942206e-67
+  30 32 33 30 36 34 38 39  61 66 65 66 35 32 61 36
+     4.66151156357078e-33    9.412854220544215e-47
+     4.66151156357078e-33    9.412854220544215e-47
+  66 36 32 65 39 30 62 66  37 35 30 62 62 63 64 66
+   1.545685984934378e+185    1.73263331658936e+185
+   1.545685984934378e+185    1.73263331658936e+185
+  34 30 63 30 36 66 35 63  36 62 31 33 38 32 38 36
+   8.076001960865626e+169    1.655569136939946e-47
+   8.076001960865626e+169    1.655569136939946e-47
+  65 36 62 36 62 38 36 31  37 36 62 62 39 33 34 31
+    1.257621502494496e-71   1.1432848245771719e-71
+    1.257621502494496e-71   1.1432848245771719e-71
+  38 30 32 32 30 30 64 62  61 39 38 34 38 36 65 61
+   9.300493392957145e+165  1.4910943375569912e+161
+   9.300493392957145e+165  1.4910943375569912e+161
+  36 38 33 38 30 66 34 37  65 62 62 31 39 61 37 64
+     9.14730565730363e-43   5.782530112698354e+174
+     9.14730565730363e-43   5.782530112698354e+174
+  66 31 37 33 62 39 39 65  36 62 63 39 63 36 38 31
+  4.0885946285232396e+179   1.3703761929026078e-71
+  4.0885946285232396e+179   1.3703761929026078e-71
+  64 36 63 63 66 33 62 64  65 33 31 34 36 35 64 31
+   3.601285191421579e+175    9.149793997836941e-71
+   3.601285191421579e+175    9.149793997836941e-71
+  66 31 36 62 33 30 31 32  33 32 31 30 33 39 65 38
+    6.375488892586806e-67    4.989606135107334e-37
+    6.375488892586806e-67    4.989606135107334e-37
+  38 31 35 65 31 35 39 35  32 61 37 63 33 66 61 64
+   2.6318155495708757e-52   3.442685173291611e+175
+   2.6318155495708757e-52   3.442685173291611e+175
+  61 31 39 30 35 66 38 63  66 35 35 34 31 39 38 33
+    9.20818492601232e+169    5.888384066691034e-62
+    9.20818492601232e+169    5.888384066691034e-62
+  37 31 33 33 62 64 37 37  35 36 63 30 65 66 31 34
+   1.0489390917136446e-42    2.771976981626207e-57
+   1.0489390917136446e-42    2.771976981626207e-57
+  66 63 38 64 66 65 35 30  63 30 64 65 61 61 63 66
+    1.847802709235725e-76   1.646986034748542e+185
+    1.847802709235725e-76   1.646986034748542e+185
+  66 66 66 66 66 66 66 30  31 30 30 30 30 30 30 30
+   1.5476014050729244e-75   1.3980432860952892e-76
+   1.5476014050729244e-75   1.3980432860952892e-76
+  30 30 30 30 30 30 30 30  30 30 31 35 31 30 30 30
+    1.398043286095289e-76   1.3980446296279274e-76
+    1.398043286095289e-76   1.3980446296279274e-76
+  30 30 30 30 30 22 2c 20  22 50 32 53 48 22 5d 2c
+  1.0491479271301769e-153    5.455822643446265e-95
+  1.0491479271301769e-153    5.455822643446265e-95
+  0a 0a 5b 22 43 6f 69 6e  62 61 73 65 20 6f 66 20
+   7.355158185188684e+223  1.3385685830467748e-152
+   7.355158185188684e+223  1.3385685830467748e-152
+  73 69 7a 65 20 31 22 5d  2c 0a 5b 22 4e 6f 74 65
+   4.332774296764136e+140   5.299653911528827e+180
+   4.332774296764136e+140   5.299653911528827e+180
+  20 74 68 65 20 69 6e 70  75 74 20 69 73 20 6a 75
+  3.7770468173851767e+233  3.9229419618151513e+257
+  3.7770468173851767e+233  3.9229419618151513e+257
+  73 74 20 72 65 71 75 69  72 65 64 20 74 6f 20 6d
+  1.0258450235690345e+200   4.532588100976072e+217
+  1.0258450235690345e+200   4.532588100976072e+217
+  61 6b 65 20 74 68 65 20  74 65 73 74 65 72 20 68
+  1.2773465767023465e-152   3.751891236831942e+193
+  1.2773465767023465e-152   3.751891236831942e+193
+  61 70 70 79 22 5d 2c 0a  5b 5b 5b 22 30 30 30 30
+  1.1529707152803686e-259    1.398043214897502e-76
+  1.1529707152803686e-259    1.398043214897502e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 22 2c 20 2d
+    1.398043286095289e-76    2.480993963004882e-91
+    1.398043286095289e-76    2.480993963004882e-91
+  31 2c 20 22 31 22 5d 5d  2c 0a 22 30 31 30 30 30
+  5.5510043706860546e+141   1.3980446035855388e-76
+  5.5510043706860546e+141   1.3980446035855388e-76
+  30 30 30 30 31 30 30 30  30 30 30 30 30 30 30 30
+   1.3980446038700318e-76    1.398043286095289e-76
+   1.3980446038700318e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 66 66 66  66 66 66 66 66 30 31 35
+  1.9035282685797734e+185    1.794621861311294e-52
+  1.9035282685797734e+185    1.794621861311294e-52
+  31 66 66 66 66 66 66 66  66 30 31 30 30 30 30 30
+  1.9035985662552772e+185    1.398043286115413e-76
+  1.9035985662552772e+185    1.398043286115413e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 31 35 31 30
+    1.398043286095289e-76    1.486093041091893e-76
+    1.398043286095289e-76    1.486093041091893e-76
+  30 30 30 30 30 30 30 22  2c 20 22 50 32 53 48 22
+     5.1856307557119e-144  1.5584206141976403e-143
+     5.1856307557119e-144  1.5584206141976403e-143
+  5d 2c 0a 0a 5b 22 43 6f  69 6e 62 61 73 65 20 6f
+   9.065611035336691e+227  1.9421035530022938e+227
+   9.065611035336691e+227  1.9421035530022938e+227
+  66 20 73 69 7a 65 20 31  30 31 22 5d 2c 0a 5b 22
+    4.640016511450276e-72  3.4646915345151233e-143
+    4.640016511450276e-72  3.4646915345151233e-143
+  4e 6f 74 65 20 74 68 65  20 69 6e 70 75 74 20 69
+   3.170958566212628e+180  2.4600438894756224e+198
+   3.170958566212628e+180  2.4600438894756224e+198
+  73 20 6a 75 73 74 20 72  65 71 75 69 72 65 64 20
+   5.486071120085856e+241  1.2169790703660515e-152
+   5.486071120085856e+241  1.2169790703660515e-152
+  74 6f 20 6d 61 6b 65 20  74 68 65 20 74 65 73 74
+  1.2780287706337388e-152    8.88782181971942e+252
+  1.2780287706337388e-152    8.88782181971942e+252
+  65 72 20 68 61 70 70 79  22 5d 2c 0a 5b 5b 5b 22
+    9.10649098444104e+276  3.5053249760825546e-143
+    9.10649098444104e+276  3.5053249760825546e-143
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  22 2c 20 2d 31 2c 20 22  31 22 5d 5d 2c 0a 22 30
+  2.5903151886987755e-144     7.78971152971537e-77
+  2.5903151886987755e-144     7.78971152971537e-77
+  31 30 30 30 30 30 30 30  31 30 30 30 30 30 30 30
+   1.3980432860952892e-76   1.3980432860952892e-76
+   1.3980432860952892e-76   1.3980432860952892e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 66 66 66 66 66 66 66
+    1.398043286095289e-76   1.903598566255277e+185
+    1.398043286095289e-76   1.903598566255277e+185
+  66 36 35 35 31 35 31 35  31 35 31 35 31 35 31 35
+    1.796576278962823e-52    1.796576278865474e-52
+    1.796576278962823e-52    1.796576278865474e-52
+  31 35 31 35 31 35 31 35  31 35 31 35 31 35 31 35
+    1.796576278865474e-52    1.796576278865474e-52
+    1.796576278865474e-52    1.796576278865474e-52
+  31 35 31 35 31 35 31 35  31 35 31 35 31 35 31 35
+    1.796576278865474e-52    1.796576278865474e-52
+    1.796576278865474e-52    1.796576278865474e-52
+  31 35 31 35 31 35 31 35  31 35 31 35 31 35 31 35
+    1.796576278865474e-52    1.796576278865474e-52
+    1.796576278865474e-52    1.796576278865474e-52
+  31 35 31 35 31 35 31 35  31 35 31 35 31 35 31 35
+    1.796576278865474e-52    1.796576278865474e-52
+    1.796576278865474e-52    1.796576278865474e-52
+  31 35 31 35 31 35 31 35  31 35 31 35 31 35 31 35
+    1.796576278865474e-52    1.796576278865474e-52
+    1.796576278865474e-52    1.796576278865474e-52
+  31 35 31 35 31 35 31 35  31 35 31 35 31 35 31 35
+    1.796576278865474e-52    1.796576278865474e-52
+    1.796576278865474e-52    1.796576278865474e-52
+  31 35 31 35 31 35 31 35  31 35 31 35 31 35 31 35
+    1.796576278865474e-52    1.796576278865474e-52
+    1.796576278865474e-52    1.796576278865474e-52
+  31 35 31 35 31 35 31 35  31 35 31 35 31 35 31 35
+    1.796576278865474e-52    1.796576278865474e-52
+    1.796576278865474e-52    1.796576278865474e-52
+  31 35 31 35 31 35 31 35  31 35 31 35 31 35 31 35
+    1.796576278865474e-52    1.796576278865474e-52
+    1.796576278865474e-52    1.796576278865474e-52
+  31 35 31 35 31 35 31 35  31 35 31 35 31 35 31 35
+    1.796576278865474e-52    1.796576278865474e-52
+    1.796576278865474e-52    1.796576278865474e-52
+  31 35 31 35 31 35 31 35  31 35 31 35 31 35 31 35
+    1.796576278865474e-52    1.796576278865474e-52
+    1.796576278865474e-52    1.796576278865474e-52
+  31 35 31 35 31 35 31 35  31 35 31 35 31 66 66 66
+    1.796576278865474e-52   1.903529590650195e+185
+    1.796576278865474e-52   1.903529590650195e+185
+  66 66 66 66 66 30 31 30  30 30 30 30 30 30 30 30
+    1.484476410540531e-76    1.398043286095289e-76
+    1.484476410540531e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  31 35 31 30 30 30 30 30
+    1.398043286095289e-76   1.3980432861157895e-76
+    1.398043286095289e-76   1.3980432861157895e-76
+  30 30 30 22 2c 20 22 50  32 53 48 22 5d 2c 0a 0a
+   1.0494047973278671e+78   2.659819575045378e-260
+   1.0494047973278671e+78   2.659819575045378e-260
+  5b 22 4e 75 6c 6c 20 74  78 69 6e 2c 20 62 75 74
+   2.351759479934563e+251   9.798309958061002e+252
+   2.351759479934563e+251   9.798309958061002e+252
+  20 77 69 74 68 6f 75 74  20 62 65 69 6e 67 20 61
+   9.822084451677427e+252   7.207061533177213e+159
+   9.822084451677427e+252   7.207061533177213e+159
+  20 63 6f 69 6e 62 61 73  65 20 28 62 65 63 61 75
+    6.07755061582826e+247   2.610853953079286e+257
+    6.07755061582826e+247   2.610853953079286e+257
+  73 65 20 74 68 65 72 65  20 61 72 65 20 74 77 6f
+   4.770937965648594e+180   8.889689535296924e+228
+   4.770937965648594e+180   8.889689535296924e+228
+  20 69 6e 70 75 74 73 29  22 5d 2c 0a 5b 5b 5b 22
+   5.177390949403597e-109  3.5053249760825546e-143
+   5.177390949403597e-109  3.5053249760825546e-143
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  22 2c 20 2d 31 2c 20 22  31 22 5d 2c 0a 20 20 5b
+  2.5903151886987755e-144    8.94194584505147e+130
+  2.5903151886987755e-144    8.94194584505147e+130
+  22 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432860952846e-76    1.398043286095289e-76
+   1.3980432860952846e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 31 30
+    1.398043286095289e-76   1.4844049716462333e-76
+    1.398043286095289e-76   1.4844049716462333e-76
+  30 22 2c 20 30 2c 20 22  31 22 5d 5d 2c 0a 22 30
+  2.5903126210889466e-144     7.78971152971537e-77
+  2.5903126210889466e-144     7.78971152971537e-77
+  31 30 30 30 30 30 30 30  32 30 30 30 30 30 30 30
+   1.3980432860952892e-76   1.3980432860952895e-76
+   1.3980432860952892e-76   1.3980432860952895e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 66 66 66 66 66 66 66
+    1.398043286095289e-76   1.903598566255277e+185
+    1.398043286095289e-76   1.903598566255277e+185
+  66 30 30 66 66 66 66 66  66 66 66 30 30 30 31 30
+   1.903598565182652e+185   1.4844049727363043e-76
+   1.903598565182652e+185   1.4844049727363043e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 66 66 66  66 66 66 66 66 30 31 30
+  1.9035282685797734e+185    1.484476410540531e-76
+  1.9035282685797734e+185    1.484476410540531e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  31 35 31 30 30 30 30 30  30 30 30 22 2c 20 22 50
+   1.3980432861157895e-76   1.0494047973278671e+78
+   1.3980432861157895e-76   1.0494047973278671e+78
+  32 53 48 22 5d 2c 0a 5b  5b 5b 22 30 30 30 30 30
+  3.6284952460805235e+130   1.3980432858171725e-76
+  3.6284952460805235e+130   1.3980432858171725e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  31 30 30 22 2c 20 30 2c
+    1.398043286095289e-76    7.549518397495304e-96
+    1.398043286095289e-76    7.549518397495304e-96
+  20 22 31 22 5d 2c 0a 20  20 5b 22 30 30 30 30 30
+  2.4401170051565365e-154   1.3980432858171544e-76
+  2.4401170051565365e-154   1.3980432858171544e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 22 2c 20 2d 31
+    1.398043286095289e-76    8.242273483967217e-72
+    1.398043286095289e-76    8.242273483967217e-72
+  2c 20 22 31 22 5d 5d 2c  0a 22 30 31 30 30 30 30
+    5.498872883325587e-95   1.3980432912417352e-76
+    5.498872883325587e-95   1.3980432912417352e-76
+  30 30 30 32 30 30 30 31  30 30 30 30 30 30 30 30
+    9.162216547224152e-72    1.398043286095289e-76
+    9.162216547224152e-72    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 66 66
+    1.398043286095289e-76  1.8856023613222075e+185
+    1.398043286095289e-76  1.8856023613222075e+185
+  66 66 66 66 66 66 30 30  30 30 30 30 30 30 30 30
+   1.4163316430354888e-76    1.398043286095289e-76
+   1.4163316430354888e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 66 66  66 66 66 66 66 66 30 30
+  1.8856023613222075e+185   1.4163316430354888e-76
+  1.8856023613222075e+185   1.4163316430354888e-76
+  66 66 66 66 66 66 66 66  30 31 30 30 30 30 30 30
+  1.9035985662552932e+185   1.3980432860953674e-76
+  1.9035985662552932e+185   1.3980432860953674e-76
+  30 30 30 30 30 30 30 30  30 30 30 31 35 31 30 30
+    1.398043286095289e-76   1.3983872304507443e-76
+    1.398043286095289e-76   1.3983872304507443e-76
+  30 30 30 30 30 30 22 2c  20 22 50 32 53 48 22 5d
+    4.257571555502434e-96   4.354357046338091e+140
+    4.257571555502434e-96   4.354357046338091e+140
+  2c 0a 0a 5b 22 53 61 6d  65 20 61 73 20 74 68 65
+   7.644580623900634e+218    3.17095867383673e+180
+   7.644580623900634e+218    3.17095867383673e+180
+  20 74 72 61 6e 73 61 63  74 69 6f 6e 73 20 69 6e
+   5.268724183673267e+170   7.266132456479509e+223
+   5.268724183673267e+170   7.266132456479509e+223
+  20 76 61 6c 69 64 20 77  69 74 68 20 6f 6e 65 20
+   6.607000260414307e+265  1.2787404634216944e-152
+   6.607000260414307e+265  1.2787404634216944e-152
+  69 6e 70 75 74 20 53 49  47 48 41 53 48 5f 41 4c
+   1.7061655231196525e+45    2.180941002060413e+59
+   1.7061655231196525e+45    2.180941002060413e+59
+  4c 20 61 6e 64 20 6f 6e  65 20 53 49 47 48 41 53
+   9.001140443920823e+223   1.1265517997038191e+93
+   9.001140443920823e+223   1.1265517997038191e+93
+  48 5f 41 4e 59 4f 4e 45  43 41 4e 50 41 59 2c 20
+    7.328497787940222e+25  1.0571695614229372e-153
+    7.328497787940222e+25  1.0571695614229372e-153
+  62 75 74 20 77 65 20 73  65 74 20 74 68 65 20 5f
+   3.582561211108227e+246   1.677216308175303e+150
+   3.582561211108227e+246   1.677216308175303e+150
+  41 4e 59 4f 4e 45 43 41  4e 50 41 59 20 73 65 71
+        2525852.619912893  1.7459349553148485e+238
+        2525852.619912893  1.7459349553148485e+238
+  75 65 6e 63 65 20 6e 75  6d 62 65 72 2c 20 69 6e
+   4.523511181573994e+257   7.265819235701472e+223
+   4.523511181573994e+257   7.265819235701472e+223
+  76 61 6c 69 64 61 74 69  6e 67 20 74 68 65 20 53
+   9.750135703467247e+199    2.671959733771588e+92
+   9.750135703467247e+199    2.671959733771588e+92
+  49 47 48 41 53 48 5f 41  4c 4c 20 73 69 67 6e 61
+        8200525.020036527  2.1372619155101908e+161
+        8200525.020036527  2.1372619155101908e+161
+  74 75 72 65 22 5d 2c 0a  5b 5b 5b 22 30 30 30 30
+  1.1529706668416675e-259    1.398043214897502e-76
+  1.1529706668416675e-259    1.398043214897502e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 31 30 30 22 2c 20 30
+    1.398043286095289e-76    6.983377179561166e-77
+    1.398043286095289e-76    6.983377179561166e-77
+  2c 20 22 30 78 32 31 20  30 78 30 33 35 65 37 66
+  1.2826217763196715e-153  2.4852311062557085e+184
+  1.2826217763196715e-153  2.4852311062557085e+184
+  30 64 34 64 30 38 34 31  62 63 64 35 36 63 33 39
+   1.1443824877437212e-71   3.7339055210529345e-33
+   1.1443824877437212e-71   3.7339055210529345e-33
+  33 33 37 65 64 30 38 36  62 31 61 36 33 33 65 65
+   1.6550807261498067e-47   2.749054088959487e+180
+   1.6550807261498067e-47   2.749054088959487e+180
+  37 37 30 63 31 66 66 64  64 39 34 61 63 35 35 32
+  4.4320007405141124e+175    7.866687544218582e-67
+  4.4320007405141124e+175    7.866687544218582e-67
+  61 39 35 61 63 32 63 65  30 65 66 63 20 43 48 45
+  2.4892981391391088e+180    5.866243136687448e+25
+  2.4892981391391088e+180    5.866243136687448e+25
+  43 4b 53 49 47 22 5d 2c  0a 20 20 5b 22 30 30 30
+   5.4558196757959444e-95   1.3980250582708738e-76
+   5.4558196757959444e-95   1.3980250582708738e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 32 30 30 22 2c 20
+    1.398043286095289e-76  1.0491479271475422e-153
+    1.398043286095289e-76  1.0491479271475422e-153
+  30 2c 20 22 30 78 32 31  20 30 78 30 33 35 65 37
+   1.0453357749013958e-71     7.60792956412809e-42
+   1.0453357749013958e-71     7.60792956412809e-42
+  66 30 64 34 64 30 38 34  31 62 63 64 35 36 63 33
+    3.853534644071652e-57   3.7360946078593746e-61
+    3.853534644071652e-57   3.7360946078593746e-61
+  39 33 33 37 65 64 30 38  36 62 31 61 36 33 33 65
+    4.817225640046255e-38   3.112144540926055e+179
+    4.817225640046255e-38   3.112144540926055e+179
+  65 37 37 30 63 31 66 66  64 64 39 34 61 63 35 35
+   1.886000455611159e+185   2.2330324775505453e-52
+   1.886000455611159e+185   2.2330324775505453e-52
+  32 61 39 35 61 63 32 63  65 30 65 66 63 20 43 48
+   6.939638350216974e+169    1.301683276314949e+40
+   6.939638350216974e+169    1.301683276314949e+40
+  45 43 4b 53 49 47 22 5d  5d 2c 0a 20 22 30 31 30
+   4.353390819034962e+140   1.4843864396745203e-76
+   4.353390819034962e+140   1.4843864396745203e-76
+  30 30 30 30 30 30 32 30  30 30 31 30 30 30 30 30
+   1.5707666571971778e-76   1.3980432861153965e-76
+   1.5707666571971778e-76   1.3980432861153965e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 34
+    1.398043286095289e-76   2.5789346702567697e-57
+    1.398043286095289e-76   2.5789346702567697e-57
+  39 34 38 33 30 34 35 30  32 32 30 33 61 30 66 35
+   1.8312011307905955e-76   1.8533103476801735e-51
+   1.8312011307905955e-76   1.8533103476801735e-51
+  66 30 65 31 66 32 62 64  62 63 64 30 34 64 62 33
+   3.600511694326406e+175    3.576565499665179e-61
+   3.600511694326406e+175    3.576565499665179e-61
+  30 36 31 64 31 38 66 33  61 66 37 30 65 30 37 66
+    4.321009709266793e-61  2.4633164583339916e+184
+    4.321009709266793e-61  2.4633164583339916e+184
+  34 66 34 36 37 63 62 63  31 62 38 31 31 36 66 32
+   5.551517208534656e+170    6.591018413692433e-66
+   5.551517208534656e+170    6.591018413692433e-66
+  36 37 30 32 35 66 35 33  36 30 62 30 32 32 31 30
+    5.201869326236441e-62     1.48508230886947e-76
+    5.201869326236441e-62     1.48508230886947e-76
+  30 63 37 39 32 62 36 65  32 31 35 61 66 63 35 61
+   3.628164411116311e+179  1.8793756282201043e+160
+   3.628164411116311e+179  1.8793756282201043e+160
+  66 63 37 32 31 61 33 35  31 65 63 34 31 33 65 37
+   2.0233305906096163e-52     7.60511610334697e-42
+   2.0233305906096163e-52     7.60511610334697e-42
+  31 34 33 30 35 63 62 37  34 39 61 61 65 33 64 37
+    6.596203014768002e-42    7.246669297244279e-42
+    6.596203014768002e-42    7.246669297244279e-42
+  66 65 65 37 36 36 32 31  33 31 33 34 31 38 64 66
+    1.030749357967621e-71   1.718295210629285e+185
+    1.030749357967621e-71   1.718295210629285e+185
+  31 30 31 30 31 30 30 30  30 30 30 30 30 30 32 30
+   1.3980446038901397e-76   1.5707666571971778e-76
+   1.3980446038901397e-76   1.5707666571971778e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 34 38 34 37 33  30 34 34 30 32 32 30 32
+    5.640575712685616e-62    6.007459329422506e-67
+    5.640575712685616e-62    6.007459329422506e-67
+  30 31 64 63 32 64 30 33  30 65 33 38 30 65 38 66
+    3.984527126518586e-62  2.5914506320271213e+184
+    3.984527126518586e-62  2.5914506320271213e+184
+  39 63 66 62 34 31 62 34  34 32 64 39 33 30 66 61
+    2.318548443408937e-56  1.5597369727045124e+161
+    2.318548443408937e-56  1.5597369727045124e+161
+  35 61 36 38 35 62 62 32  63 38 64 62 35 39 30 36
+    5.455092265072236e-66    1.110054919954677e-47
+    5.455092265072236e-66    1.110054919954677e-47
+  36 37 31 66 38 36 35 35  30 37 64 30 36 37 30 30
+   2.2146150529179476e-52   1.4004126461291774e-76
+   2.2146150529179476e-52   1.4004126461291774e-76
+  32 32 30 31 38 64 39 65  37 61 38 64 34 63 38 64
+   4.115716860762033e+179   6.031774662546038e+174
+   4.115716860762033e+179   6.031774662546038e+174
+  38 36 61 37 33 63 32 61  37 32 34 65 65 33 38 65
+  1.6156987991793812e+160   3.922713084513335e+179
+  1.6156987991793812e+160   3.922713084513335e+179
+  66 39 38 33 65 63 32 34  39 38 32 37 65 30 65 34
+    2.929419295048301e-57   2.7004876225843943e-56
+    2.929419295048301e-57   2.7004876225843943e-56
+  36 34 38 34 31 37 33 35  39 35 35 63 37 30 37 65
+   2.0062016788469786e-52  3.7586093438514255e+179
+   2.0062016788469786e-52  3.7586093438514255e+179
+  63 65 39 38 31 30 31 30  30 30 30 30 30 30 31 30
+   1.4844063307865843e-76   1.4844049716462333e-76
+   1.4844063307865843e-76   1.4844049716462333e-76
+  31 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432860952892e-76    1.398043286095289e-76
+   1.3980432860952892e-76    1.398043286095289e-76
+  31 35 31 30 30 30 30 30  30 30 30 22 2c 20 22 50
+   1.3980432861157895e-76   1.0494047973278671e+78
+   1.3980432861157895e-76   1.0494047973278671e+78
+  32 53 48 22 5d 2c 0a 0a  5b 22 43 48 45 43 4b 4d
+   2.659819575045378e-260   2.2430511005536554e+64
+   2.659819575045378e-260   2.2430511005536554e+64
+  55 4c 54 49 53 49 47 20  77 69 74 68 20 69 6e 63
+   3.473562154519639e-153   9.181492261774755e+170
+   3.473562154519639e-153   9.181492261774755e+170
+  6f 72 72 65 63 74 20 73  69 67 6e 61 74 75 72 65
+   3.595298017191828e+246   4.787194209282134e+180
+   3.595298017191828e+246   4.787194209282134e+180
+  20 6f 72 64 65 72 22 5d  2c 0a 5b 22 4e 6f 74 65
+   4.393498023346946e+140   5.299653911528827e+180
+   4.393498023346946e+140   5.299653911528827e+180
+  20 74 68 65 20 69 6e 70  75 74 20 69 73 20 6a 75
+  3.7770468173851767e+233  3.9229419618151513e+257
+  3.7770468173851767e+233  3.9229419618151513e+257
+  73 74 20 72 65 71 75 69  72 65 64 20 74 6f 20 6d
+  1.0258450235690345e+200   4.532588100976072e+217
+  1.0258450235690345e+200   4.532588100976072e+217
+  61 6b 65 20 74 68 65 20  74 65 73 74 65 72 20 68
+  1.2773465767023465e-152   3.751891236831942e+193
+  1.2773465767023465e-152   3.751891236831942e+193
+  61 70 70 79 22 5d 2c 0a  5b 5b 5b 22 62 33 64 61
+  1.1529707152803686e-259  1.4200200091887787e+161
+  1.1529707152803686e-259  1.4200200091887787e+161
+  30 31 64 64 34 61 61 65  36 38 33 63 37 61 65 65
+   2.253667479582557e+180  2.7723628524146764e+180
+   2.253667479582557e+180  2.7723628524146764e+180
+  34 64 35 64 38 62 35 32  61 35 34 30 61 35 30 38
+     7.93164512863747e-67    4.763254226888476e-38
+     7.93164512863747e-67    4.763254226888476e-38
+  65 31 31 31 35 66 37 37  63 64 37 66 61 39 61 32
+   1.0492586207138624e-42    5.111031607817409e-66
+   1.0492586207138624e-42    5.111031607817409e-66
+  39 31 32 34 33 66 35 30  31 32 32 33 22 2c 20 30
+    1.848072605850669e-76    6.983377256976001e-77
+    1.848072605850669e-76    6.983377256976001e-77
+  2c 20 22 48 41 53 48 31  36 30 20 30 78 31 34 20
+   2.7535167424148395e-71  1.5060806567872225e-153
+   2.7535167424148395e-71  1.5060806567872225e-153
+  30 78 62 31 63 65 39 39  32 39 38 64 35 66 30 37
+    4.891100317565009e-33    7.353679010895052e-43
+    4.891100317565009e-33    7.353679010895052e-43
+  33 36 34 62 35 37 62 31  65 35 63 39 63 63 30 30
+    8.247757797426243e-71   1.4153154070044465e-76
+    8.247757797426243e-71   1.4153154070044465e-76
+  62 65 30 62 30 34 61 39  35 34 20 45 51 55 41 4c
+    2.650674835144597e-32    2.176054151177157e+59
+    2.650674835144597e-32    2.176054151177157e+59
+  22 5d 5d 2c 0a 22 30 31  30 30 30 30 30 30 30 31
+    9.130936148260522e-72    9.162216479754085e-72
+    9.130936148260522e-72    9.162216479754085e-72
+  32 33 31 32 35 30 33 66  32 34 39 31 61 32 61 39
+  2.0383282731736347e+184    2.649585877697771e-32
+  2.0383282731736347e+184    2.649585877697771e-32
+  37 66 63 64 37 37 35 66  31 31 65 31 30 38 61 35
+  2.2536916908320915e+184   1.4382385253863372e-51
+  2.2536916908320915e+184   1.4382385253863372e-51
+  34 30 61 35 35 32 38 62  35 64 34 64 65 65 37 61
+  1.3933603561775742e+165   2.055799603000561e+160
+  1.3933603561775742e+165   2.055799603000561e+160
+  33 63 36 38 61 65 34 61  64 64 30 31 64 61 62 33
+  1.7921857793225116e+160    3.574429006159354e-61
+  1.7921857793225116e+160    3.574429006159354e-61
+  30 30 30 30 30 30 30 30  66 64 66 65 30 30 30 30
+    1.398043286095289e-76    1.398043560005755e-76
+    1.398043286095289e-76    1.398043560005755e-76
+  34 38 33 30 34 35 30 32  32 30 37 61 61 63 65 65
+    6.011817374894185e-67  2.7734590054156766e+180
+    6.011817374894185e-67  2.7734590054156766e+180
+  38 32 30 65 30 38 62 30  62 31 37 34 65 32 34 38
+   1.2587725861530852e-75    5.935322753494305e-38
+   1.2587725861530852e-75    5.935322753494305e-38
+  61 62 64 38 64 37 61 33  34 65 64 36 33 62 35 64
+    3.348054754593446e-61   5.288812874184358e+174
+    3.348054754593446e-61   5.288812874184358e+174
+  61 33 61 62 65 64 62 39  39 39 33 34 64 66 39 66
+    2.833762784013353e-32   2.698177443851475e+184
+    2.833762784013353e-32   2.698177443851475e+184
+  64 64 64 36 35 63 30 35  63 34 30 32 32 31 30 30
+    1.710938037557876e-52    1.398383282274403e-76
+    1.710938037557876e-52    1.398383282274403e-76
+  64 66 65 38 37 38 39 36  61 62 35 65 65 33 64 66
+    1.725594549515891e-47  1.7167030822741055e+185
+    1.725594549515891e-47  1.7167030822741055e+185
+  34 37 36 63 32 36 35 35  66 39 66 62 65 35 62 64
+   2.2146054758189775e-52   3.602827975605961e+175
+   2.2146054758189775e-52   3.602827975605961e+175
+  30 38 39 64 63 63 62 65  66 33 65 34 65 61 30 35
+   2.384445901368058e+180   1.7101988304847367e-52
+   2.384445901368058e+180   1.7101988304847367e-52
+  62 35 64 31 32 31 31 36  39 66 65 37 66 35 66 34
+   1.1763361527811826e-47   2.8304261277970974e-56
+   1.1763361527811826e-47   2.8304261277970974e-56
+  30 31 34 38 33 30 34 35  30 32 32 31 30 30 66 36
+   2.1077549406085673e-52   1.2145445362462399e-46
+   2.1077549406085673e-52   1.2145445362462399e-46
+  36 34 39 62 30 65 64 64  66 64 66 64 34 61 64 35
+  4.0354961601030486e+175   1.7021924429333533e-51
+  4.0354961601030486e+175   1.7021924429333533e-51
+  35 34 32 36 36 36 33 33  38 35 30 39 30 64 35 31
+   4.6701212997489205e-62    1.210708117131074e-71
+   4.6701212997489205e-62    1.210708117131074e-71
+  65 65 38 36 63 33 34 38  31 62 64 63 36 62 30 63
+    5.936461764000894e-38   6.183125079494117e+169
+    5.936461764000894e-38   6.183125079494117e+169
+  31 38 65 61 36 63 30 65  63 65 32 63 30 62 30 32
+   2.656265146887095e+179    6.076996752531088e-67
+   2.656265146887095e+179    6.076996752531088e-67
+  32 30 35 36 31 63 33 31  35 62 30 37 63 66 66 61
+   1.0972918962927054e-71   1.574616412404953e+161
+   1.0972918962927054e-71   1.574616412404953e+161
+  36 66 37 64 64 39 64 66  39 36 64 62 61 65 39 32
+  1.7186935479980955e+185    9.419906326472975e-67
+  1.7186935479980955e+185    9.419906326472975e-67
+  30 30 63 32 64 65 65 30  39 62 66 39 33 63 63 33
+    1.478239853735173e-75    3.770272218725533e-61
+    1.478239853735173e-75    3.770272218725533e-61
+  35 63 61 30 35 65 36 63  64 66 36 31 33 33 34 30
+   8.451918240507695e+169   1.7445060378983064e-76
+   8.451918240507695e+169   1.7445060378983064e-76
+  61 61 30 31 34 63 36 39  35 32 32 31 30 33 31 64
+   4.3116785786474914e-33   4.254071553908233e+174
+   4.3116785786474914e-33   4.254071553908233e+174
+  31 31 64 62 33 38 39 37  32 62 37 31 32 61 39 66
+   1.1308830193031788e-42  2.6960216219489956e+184
+   1.1308830193031788e-42  2.6960216219489956e+184
+  65 31 66 63 30 32 33 35  37 37 63 37 61 65 33 64
+   2.0041612217084667e-52   4.797224091326063e+174
+   2.0041612217084667e-52   4.797224091326063e+174
+  64 62 34 61 33 30 30 34  31 38 37 64 34 31 63 34
+     2.57894242829126e-57    2.445995810092792e-56
+     2.57894242829126e-57    2.445995810092792e-56
+  35 31 32 31 65 65 63 66  64 62 62 35 62 37 32 31
+  1.6483188022388026e+185   1.0310084362375791e-71
+  1.6483188022388026e+185   1.0310084362375791e-71
+  30 32 30 37 65 63 33 36  39 31 31 62 36 61 64 32
+    1.326598799614108e-47    6.047411392589951e-66
+    1.326598799614108e-47    6.047411392589951e-66
+  33 38 32 38 36 30 64 33  32 39 38 39 63 37 62 38
+    3.926008417897577e-61    4.282645132747623e-37
+    3.926008417897577e-61    4.282645132747623e-37
+  37 32 38 65 39 34 38 39  64 37 62 62 63 39 34 61
+   4.6615209884127855e-33  1.7770861269003405e+160
+   4.6615209884127855e-33  1.7770861269003405e+160
+  36 62 35 35 30 39 65 66  30 30 32 39 62 65 31 32
+  1.8036079591105507e+185     6.45254615495009e-67
+  1.8036079591105507e+185     6.45254615495009e-67
+  38 38 32 31 30 32 34 65  61 39 66 61 63 30 36 66
+   3.273586523470656e+179   2.357085929370961e+184
+   3.273586523470656e+179   2.357085929370961e+184
+  36 36 36 61 34 61 64 63  33 66 63 31 33 35 37 62
+   6.152979423267998e+170    1.33644732558845e+165
+   6.152979423267998e+170    1.33644732558845e+165
+  37 62 65 63 31 66 64 30  62 64 65 63 65 32 62 39
+    1.409366822171827e-75    2.803670137966212e-32
+    1.409366822171827e-75    2.803670137966212e-32
+  64 30 38 35 37 39 32 32  36 61 38 65 62 64 65 35
+    6.759471330012521e-67   1.7867537656598755e-51
+    6.759471330012521e-67   1.7867537656598755e-51
+  33 30 35 38 65 34 35 33  61 65 66 66 66 66 66 66
+   5.1545696166188335e-62  1.9035985662552144e+185
+   5.1545696166188335e-62  1.9035985662552144e+185
+  66 66 30 31 38 30 33 38  30 31 30 30 30 30 30 30
+    5.638951438392439e-38   1.3980432860953674e-76
+    5.638951438392439e-38   1.3980432860953674e-76
+  30 30 30 30 31 39 37 36  61 39 31 34 63 39 62 39
+   1.5890099750636563e-47   2.8078779742438894e-32
+   1.5890099750636563e-47   2.8078779742438894e-32
+  39 63 64 64 66 38 34 37  64 31 30 36 38 35 61 34
+    9.067101659748329e-43   2.1930998983242157e-56
+    9.067101659748329e-43   2.1930998983242157e-56
+  66 61 62 61 61 30 62 61  66 35 30 35 66 37 63 33
+  1.2786043688466274e+161    3.736999107053368e-61
+  1.2786043688466274e+161    3.736999107053368e-61
+  64 66 61 62 38 38 61 63  30 30 30 30 30 30 30 30
+   5.198892996325297e+170    1.398043286095289e-76
+   5.198892996325297e+170    1.398043286095289e-76
+  22 2c 20 22 50 32 53 48  22 5d 2c 0a 0a 0a 5b 22
+    2.612896978874658e+40   3.464624425504013e-143
+    2.612896978874658e+40   3.464624425504013e-143
+  54 68 65 20 66 6f 6c 6c  6f 77 69 6e 67 20 69 73
+  1.9145313831494386e+214   8.784151121955459e+247
+  1.9145313831494386e+214   8.784151121955459e+247
+  20 61 20 74 77 65 61 6b  65 64 20 66 6f 72 6d 20
+   1.787249727751773e+209   1.757006810757777e-152
+   1.787249727751773e+209   1.757006810757777e-152
+  6f 66 20 32 33 62 33 39  37 65 64 63 63 64 33 37
+    3.733144350973775e-33    8.695737013142444e-43
+    3.733144350973775e-33    8.695737013142444e-43
+  34 30 61 37 34 61 64 62  36 30 33 63 39 37 35 36
+    9.38870036387869e+165   1.4516384293965106e-47
+    9.38870036387869e+165   1.4516384293965106e-47
+  33 37 30 66 61 66 63 64  65 39 62 63 63 34 34 38
+  3.8385527325166696e+175    5.937610498795252e-38
+  3.8385527325166696e+175    5.937610498795252e-38
+  33 65 62 32 37 31 65 63  61 64 30 39 61 39 34 64
+   6.398299958854687e+170   5.002044606603328e+174
+   6.398299958854687e+170   5.002044606603328e+174
+  64 36 33 22 5d 2c 0a 5b  22 49 74 20 69 73 20 61
+   3.628495245399051e+130    7.22762049650208e+159
+   3.628495245399051e+130    7.22762049650208e+159
+  6e 20 4f 50 5f 43 48 45  43 4b 4d 55 4c 54 49 53
+    5.866475290534014e+25   1.6510935833778456e+93
+    5.866475290534014e+25   1.6510935833778456e+93
+  49 47 20 77 69 74 68 20  74 68 65 20 64 75 6d 6d
+  1.4591339256110244e-152  1.2998653435701778e+219
+  1.4591339256110244e-152  1.2998653435701778e+219
+  79 20 76 61 6c 75 65 20  6d 69 73 73 69 6e 67 22
+  1.2803694754875394e-152   6.004659549376028e-143
+  1.2803694754875394e-152   6.004659549376028e-143
+  5d 2c 0a 5b 5b 5b 22 36  30 61 32 30 62 64 39 33
+    6.280137584970692e-48    6.172483235274176e-62
+    6.280137584970692e-48    6.172483235274176e-62
+  61 61 34 39 61 62 34 62  32 38 64 35 31 34 65 63
+  1.1738520386731076e+165   6.401810461416803e+170
+  1.1738520386731076e+165   6.401810461416803e+170
+  31 30 62 30 36 65 31 38  32 39 63 65 36 38 31 38
+    5.112036296766212e-38    5.060379758608404e-38
+    5.112036296766212e-38    5.060379758608404e-38
+  65 63 30 36 63 64 33 61  61 62 64 30 31 33 65 62
+  1.7039758003538328e+160   9.766587842090383e+165
+  1.7039758003538328e+160   9.766587842090383e+165
+  63 64 63 34 62 62 31 22  2c 20 30 2c 20 22 31 20
+   5.568773622767118e-144  1.2778601472054988e-153
+   5.568773622767118e-144  1.2778601472054988e-153
+  30 78 34 31 20 30 78 30  34 63 63 37 31 65 62 33
+   3.3422651061449623e-75   3.5773163240836526e-61
+   3.3422651061449623e-75   3.5773163240836526e-61
+  30 64 36 35 33 63 30 63  33 31 36 33 39 39 30 63
+   6.184580968945862e+169   6.122698904564936e+169
+   6.184580968945862e+169   6.122698904564936e+169
+  34 37 62 39 37 36 66 33  66 62 33 66 33 37 63 63
+   4.3195077264112395e-61   5.801524655348289e+170
+   4.3195077264112395e-61   5.801524655348289e+170
+  63 64 63 62 65 64 62 31  36 39 61 31 64 66 65 66
+    8.327680360676363e-71  1.8186136253926442e+185
+    8.327680360676363e-71  1.8186136253926442e+185
+  35 38 62 62 66 62 66 61  66 66 37 64 38 61 34 37
+  1.5735214436363168e+161    9.138603456575791e-43
+  1.5735214436363168e+161    9.138603456575791e-43
+  33 65 37 65 32 65 36 64  33 31 37 62 38 37 62 61
+   5.539038595121839e+174  1.2804825380645332e+161
+   5.539038595121839e+174  1.2804825380645332e+161
+  66 65 38 62 64 65 39 37  65 33 63 66 38 66 30 36
+    1.138798849868277e-42    1.122085509593256e-47
+    1.138798849868277e-42    1.122085509593256e-47
+  35 64 65 63 30 32 32 62  35 31 64 31 31 66 63 64
+  1.0478395412328553e+165   3.838407189691533e+175
+  1.0478395412328553e+165   3.838407189691533e+175
+  64 30 64 33 34 38 61 63  34 20 30 78 34 31 20 30
+    5.19887372317466e+170    6.991931390756674e-77
+    5.19887372317466e+170    6.991931390756674e-77
+  78 30 34 36 31 63 62 64  63 63 35 34 30 39 66 62
+   3.638224202755963e+175  1.0238067083001555e+166
+   3.638224202755963e+175  1.0238067083001555e+166
+  34 62 34 64 34 32 62 35  31 64 33 33 33 38 31 33
+   1.5198101820802816e-51    4.185836173696666e-62
+   1.5198101820802816e-51    4.185836173696666e-62
+  35 34 64 38 30 65 35 35  30 30 37 38 63 62 35 33
+   2.2337701050381575e-52    5.198241809950221e-62
+   2.2337701050381575e-52    5.198241809950221e-62
+  32 61 33 34 62 66 61 32  66 63 66 64 65 62 37 64
+    5.163195962530111e-66   5.783663053500447e+174
+    5.163195962530111e-66   5.783663053500447e+174
+  37 36 35 31 39 61 65 63  63 36 32 37 37 30 66 35
+   6.454918587830606e+170   1.8532568397448206e-51
+   6.454918587830606e+170   1.8532568397448206e-51
+  62 30 65 34 65 66 38 35  35 31 39 34 36 64 38 61
+    2.547476960034511e-52  2.1432625051717745e+160
+    2.547476960034511e-52  2.1432625051717745e+160
+  35 34 30 39 31 31 61 62  65 33 65 37 38 35 34 61
+   7.920233862345577e+165  1.7756552886459985e+160
+   7.920233862345577e+165  1.7756552886459985e+160
+  32 36 66 33 39 66 35 38  62 32 35 63 31 35 33 34
+     6.28869209657972e-38   3.0599766665605123e-57
+     6.28869209657972e-38   3.0599766665605123e-57
+  32 61 66 20 32 20 4f 50  5f 43 48 45 43 4b 4d 55
+    7.208234686961478e+78   8.201383970977714e+102
+    7.208234686961478e+78   8.201383970977714e+102
+  4c 54 49 53 49 47 22 5d  5d 2c 0a 22 30 31 30 30
+   4.353390818927744e+140    1.398380563599275e-76
+   4.353390818927744e+140    1.398380563599275e-76
+  30 30 30 30 30 31 62 31  34 62 64 63 62 63 33 65
+    8.237109779006023e-71   3.142645347283126e+179
+    8.237109779006023e-71   3.142645347283126e+179
+  30 31 62 64 61 61 64 33  36 63 63 30 38 65 38 31
+   3.9633591523405075e-61    1.380730065021832e-71
+   3.9633591523405075e-61    1.380730065021832e-71
+  65 36 39 63 38 32 65 31  30 36 30 62 63 31 34 65
+    9.597286976969583e-71   3.273079969477704e+179
+    9.597286976969583e-71   3.273079969477704e+179
+  35 31 38 64 62 32 62 34  39 61 61 34 33 61 64 39
+    2.319135754297908e-56   3.1399880439205075e-32
+    2.319135754297908e-56   3.1399880439205075e-32
+  30 62 61 32 36 30 30 30  30 30 30 30 30 30 34 38
+   1.3980512040280634e-76    5.932789135326604e-38
+   1.3980512040280634e-76    5.932789135326604e-38
+  34 37 33 30 34 34 30 32  32 30 33 66 31 36 63 36
+    6.010368466241235e-67   1.0516138076912055e-46
+    6.010368466241235e-67   1.0516138076912055e-46
+  66 34 30 31 36 32 61 62  36 38 36 36 32 31 65 66
+   7.922068355953969e+165  1.8009548676755642e+185
+   7.922068355953969e+165  1.8009548676755642e+185
+  33 30 30 30 62 30 34 65  37 35 34 31 38 61 30 63
+   3.272443847277845e+179   6.181661263679617e+169
+   3.272443847277845e+179   6.181661263679617e+169
+  30 63 62 32 64 38 61 65  62 65 61 63 38 39 34 61
+    2.23299422879759e+180  1.7770284785468835e+160
+    2.23299422879759e+180  1.7770284785468835e+160
+  65 33 36 30 61 63 31 65  37 38 30 32 32 30 64 64
+   2.818461475688826e+179   3.994537534190682e+175
+   2.818461475688826e+179   3.994537534190682e+175
+  63 31 35 65 63 64 66 63  33 35 30 37 61 63 34 38
+   6.760568096646819e+170    5.991554110341484e-38
+   6.760568096646819e+170    5.991554110341484e-38
+  65 31 36 38 31 61 33 33  65 62 36 30 39 39 36 36
+    4.710933724228877e-62    1.520595550973725e-47
+    4.710933724228877e-62    1.520595550973725e-47
+  33 31 62 66 36 62 66 35  62 63 30 61 30 36 38 32
+   1.8695690613597207e-51    8.980609647975502e-67
+   1.8695690613597207e-51    8.980609647975502e-67
+  63 34 64 62 37 34 33 63  65 37 63 61 32 62 30 31
+   7.247506155718934e+169    9.272778369337403e-72
+   7.247506155718934e+169    9.272778369337403e-72
+  66 66 66 66 66 66 66 66  30 31 34 30 34 32 30 66
+  1.9035985662552932e+185    1.72047374710352e+184
+  1.9035985662552932e+185    1.72047374710352e+184
+  30 30 30 30 30 30 30 30  30 30 31 39 37 36 61 39
+    1.398043286095289e-76    2.651894621783635e-32
+    1.398043286095289e-76    2.651894621783635e-32
+  31 34 36 36 30 64 34 65  66 33 61 37 34 33 65 33
+   3.305244863316297e+179    4.122750637395845e-61
+   3.305244863316297e+179    4.122750637395845e-61
+  65 36 39 36 61 64 39 39  30 33 36 34 65 35 35 35
+    4.890342179255886e-33    2.214278599495096e-52
+    4.890342179255886e-33    2.214278599495096e-52
+  63 32 37 31 61 64 35 30  34 62 38 38 61 63 30 30
+   1.8474585074784328e-76   1.4153127654462938e-76
+   1.8474585074784328e-76   1.4153127654462938e-76
+  30 30 30 30 30 30 22 2c  20 22 50 32 53 48 22 5d
+    4.257571555502434e-96   4.354357046338091e+140
+    4.257571555502434e-96   4.354357046338091e+140
+  2c 0a 0a 0a 5b 22 43 48  45 43 4b 4d 55 4c 54 49
+    1.302206285197634e+40   1.8106578577758274e+45
+    1.302206285197634e+40   1.8106578577758274e+45
+  53 49 47 20 53 43 52 49  50 54 5f 56 45 52 49 46
+    1.629112892291479e+45   4.0123313148510914e+30
+    1.629112892291479e+45   4.0123313148510914e+30
+  59 5f 4e 55 4c 4c 44 55  4d 4d 59 20 74 65 73 74
+   5.682803476553336e+102   8.887821818427846e+252
+   5.682803476553336e+102   8.887821818427846e+252
+  73 3a 22 5d 2c 0a 0a 5b  22 54 68 65 20 66 6f 6c
+  3.6099798191161843e+130  2.1140819016468623e+214
+  3.6099798191161843e+130  2.1140819016468623e+214
+  6c 6f 77 69 6e 67 20 69  73 20 61 20 74 77 65 61
+  2.4524359576827537e+198  1.5090070858220462e+161
+  2.4524359576827537e+198  1.5090070858220462e+161
+  6b 65 64 20 66 6f 72 6d  20 6f 66 20 32 33 62 33
+  1.6269102124045332e+219   3.5393367540042856e-61
+  1.6269102124045332e+219   3.5393367540042856e-61
+  39 37 65 64 63 63 64 33  37 34 30 61 37 34 61 64
+    3.964884378046573e-61   3.404051850823356e+175
+    3.964884378046573e-61   3.404051850823356e+175
+  62 36 30 33 63 39 37 35  36 33 37 30 66 61 66 63
+   2.4247164760356624e-52   6.757042873908093e+170
+   2.4247164760356624e-52   6.757042873908093e+170
+  64 65 39 62 63 63 34 34  38 33 65 62 32 37 31 65
+   3.2480332618792556e-57    2.79048641881913e+179
+   3.2480332618792556e-57    2.79048641881913e+179
+  63 61 64 30 39 61 39 34  64 64 36 33 22 5d 2c 0a
+   4.0432320448614983e-57  1.1529705451286277e-259
+   4.0432320448614983e-57  1.1529705451286277e-259
+  5b 22 49 74 20 69 73 20  61 6e 20 4f 50 5f 43 48
+  2.3163400387403706e-152   1.3184117239451802e+40
+  2.3163400387403706e-152   1.3184117239451802e+40
+  45 43 4b 4d 55 4c 54 49  53 49 47 20 77 69 74 68
+   1.8106578577758274e+45  1.4900547060138653e+195
+   1.8106578577758274e+45  1.4900547060138653e+195
+  20 74 68 65 20 64 75 6d  6d 79 20 76 61 6c 75 65
+  1.8877756114999375e+219  5.5560359220008645e+180
+  1.8877756114999375e+219  5.5560359220008645e+180
+  20 73 65 74 20 74 6f 20  73 6f 6d 65 74 68 69 6e
+   1.876734534585121e-152   7.347468315751314e+223
+   1.876734534585121e-152   7.347468315751314e+223
+  67 20 6f 74 68 65 72 20  74 68 61 6e 20 61 6e 20
+  2.1952731065596313e-152  1.8126393975317372e-152
+  2.1952731065596313e-152  1.8126393975317372e-152
+  65 6d 70 74 79 20 73 74  72 69 6e 67 22 5d 2c 0a
+   8.764353801569854e+252  1.1529706716491476e-259
+   8.764353801569854e+252  1.1529706716491476e-259
+  5b 5b 5b 22 36 30 61 32  30 62 64 39 33 61 61 34
+    5.100403568195807e-66   2.2149952129789638e-56
+    5.100403568195807e-66   2.2149952129789638e-56
+  39 61 62 34 62 32 38 64  35 31 34 65 63 31 30 62
+   5.984606974961282e+174   9.324872220070917e+164
+   5.984606974961282e+174   9.324872220070917e+164
+  30 36 65 31 38 32 39 63  65 36 38 31 38 65 63 30
+   9.508939858931731e+169   1.3400147663733526e-75
+   9.508939858931731e+169   1.3400147663733526e-75
+  36 63 64 33 61 61 62 64  30 31 33 65 62 63 64 63
+   3.636823274743409e+175   6.155550138389244e+170
+   3.636823274743409e+175   6.155550138389244e+170
+  34 62 62 31 22 2c 20 30  2c 20 22 31 20 30 78 34
+    6.983377210345116e-77    6.165390902865925e-56
+    6.983377210345116e-77    6.165390902865925e-56
+  31 20 30 78 30 34 63 63  37 31 65 62 33 30 64 36
+   5.797973068604569e+170   1.1050707599576718e-46
+   5.797973068604569e+170   1.1050707599576718e-46
+  35 33 63 30 63 33 31 36  33 39 39 30 63 34 37 62
+   1.1769218600158485e-47  1.3362645532176632e+165
+   1.1769218600158485e-47  1.3362645532176632e+165
+  39 37 36 66 33 66 62 33  66 33 37 63 63 63 64 63
+    3.578082446977501e-61   6.155554709567448e+170
+    3.578082446977501e-61   6.155554709567448e+170
+  62 65 64 62 31 36 39 61  31 64 66 65 66 35 38 62
+   2.215336418504623e+160  1.3940784140825858e+165
+   2.215336418504623e+160  1.3940784140825858e+165
+  62 66 62 66 61 66 66 37  64 38 61 34 37 33 65 37
+    8.035578544379498e-42    7.605148946098063e-42
+    8.035578544379498e-42    7.605148946098063e-42
+  65 32 65 36 64 33 31 37  62 38 37 62 61 66 65 38
+    7.713082104651884e-43    5.031097826264573e-37
+    7.713082104651884e-43    5.031097826264573e-37
+  62 64 65 39 37 65 33 63  66 38 66 30 36 35 64 65
+   7.319741233083549e+169  2.6204006824633606e+180
+   7.319741233083549e+169  2.6204006824633606e+180
+  63 30 32 32 62 35 31 64  31 31 66 63 64 64 30 64
+   4.256192535532614e+174   4.054278723234465e+174
+   4.256192535532614e+174   4.054278723234465e+174
+  33 34 38 61 63 34 20 30  78 34 31 20 30 78 30 34
+    6.997300731677043e-77   2.6237402283659984e-57
+    6.997300731677043e-77   2.6237402283659984e-57
+  36 31 63 62 64 63 63 35  34 30 39 66 62 34 62 34
+    1.619382240900106e-51   2.3201314519648315e-56
+    1.619382240900106e-51   2.3201314519648315e-56
+  64 34 32 62 35 31 64 33  33 33 38 31 33 35 34 64
+    3.926765582784951e-61   4.998006349322069e+174
+    3.926765582784951e-61   4.998006349322069e+174
+  38 30 65 35 35 30 30 37  38 63 62 35 33 32 61 33
+    7.259090113048271e-43    3.344111091749819e-61
+    7.259090113048271e-43    3.344111091749819e-61
+  34 62 66 61 32 66 63 66  64 65 62 37 64 37 36 35
+  1.6485848747482933e+185   2.3194975606930547e-52
+  1.6485848747482933e+185   2.3194975606930547e-52
+  31 39 61 65 63 63 36 32  37 37 30 66 35 62 30 65
+    8.304258049628063e-67   2.655629554061684e+179
+    8.304258049628063e-67   2.655629554061684e+179
+  34 65 66 38 35 35 31 39  34 36 64 38 61 35 34 30
+    3.314110074279715e-33   1.7452413931589167e-76
+    3.314110074279715e-33   1.7452413931589167e-76
+  39 31 31 61 62 65 33 65  37 38 35 34 61 32 36 66
+   3.143911657684039e+179   2.357912304539045e+184
+   3.143911657684039e+179   2.357912304539045e+184
+  33 39 66 35 38 62 32 35  63 31 35 33 34 32 61 66
+   1.9193447221018132e-52  1.4613610917492806e+185
+   1.9193447221018132e-52  1.4613610917492806e+185
+  20 32 20 4f 50 5f 43 48  45 43 4b 4d 55 4c 54 49
+   1.3184117239414507e+40   1.8106578577758274e+45
+   1.3184117239414507e+40   1.8106578577758274e+45
+  53 49 47 22 5d 5d 2c 0a  22 30 31 30 30 30 30 30
+  1.1530070994431875e-259   1.3980432861153922e-76
+  1.1530070994431875e-259   1.3980432861153922e-76
+  30 30 31 62 31 34 62 64  63 62 63 33 65 30 31 62
+   3.601898068821177e+175   9.898499592885196e+164
+   3.601898068821177e+175   9.898499592885196e+164
+  64 61 61 64 33 36 63 63  30 38 65 38 31 65 36 39
+   5.800345259332539e+170    4.313174477934359e-33
+   5.800345259332539e+170    4.313174477934359e-33
+  63 38 32 65 31 30 36 30  62 63 31 34 65 35 31 38
+     1.91621499003711e-76    5.057145821086341e-38
+     1.91621499003711e-76    5.057145821086341e-38
+  64 62 32 62 34 39 61 61  34 33 61 64 39 30 62 61
+  1.2107319032603788e+161  1.2785614764117511e+161
+  1.2107319032603788e+161  1.2785614764117511e+161
+  32 36 30 30 30 30 30 30  30 30 30 34 61 30 31 30
+   1.3980432860957607e-76    1.484469563198866e-76
+   1.3980432860957607e-76    1.484469563198866e-76
+  30 34 37 33 30 34 34 30  32 32 30 33 66 31 36 63
+   1.7448394452195406e-76   8.375541863787985e+169
+   1.7448394452195406e-76   8.375541863787985e+169
+  36 66 34 30 31 36 32 61  62 36 38 36 36 32 31 65
+   1.600250285303721e+160   2.787330056099389e+179
+   1.600250285303721e+160   2.787330056099389e+179
+  66 33 30 30 30 62 30 34  65 37 35 34 31 38 61 30
+   2.6100497466465406e-57   1.1896840902286223e-75
+   2.6100497466465406e-57   1.1896840902286223e-75
+  63 30 63 62 32 64 38 61  65 62 65 61 63 38 39 34
+  2.1432573838293507e+160   4.0178202438867276e-57
+  2.1432573838293507e+160   4.0178202438867276e-57
+  61 65 33 36 30 61 63 31  65 37 38 30 32 32 30 64
+     8.77479088657769e-71   4.005782551583866e+174
+     8.77479088657769e-71   4.005782551583866e+174
+  64 63 31 35 65 63 64 66  63 33 35 30 37 61 63 34
+   1.732636978843863e+185   2.4698976277610794e-56
+   1.732636978843863e+185   2.4698976277610794e-56
+  38 65 31 36 38 31 61 33  33 65 62 36 30 39 39 36
+   3.3433662925277425e-61   1.7258545094413985e-47
+   3.3433662925277425e-61   1.7258545094413985e-47
+  36 33 31 62 66 36 62 66  35 62 63 30 61 30 36 38
+  1.5477360897541155e+185    6.520756037839884e-38
+  1.5477360897541155e+185    6.520756037839884e-38
+  32 63 34 64 62 37 34 33  63 65 37 63 61 32 62 30
+    4.914321262507142e-62   1.2572049531986528e-75
+    4.914321262507142e-62   1.2572049531986528e-75
+  31 66 66 66 66 66 66 66  66 30 31 34 30 34 32 30
+  1.9035985662552772e+185   1.5721160791442658e-76
+  1.9035985662552772e+185   1.5721160791442658e-76
+  66 30 30 30 30 30 30 30  30 30 30 31 39 37 36 61
+   1.3980432860953054e-76  1.9520818967830314e+160
+   1.3980432860953054e-76  1.9520818967830314e+160
+  39 31 34 36 36 30 64 34  65 66 33 61 37 34 33 65
+   2.5729488616189862e-56   3.112780180133937e+179
+   2.5729488616189862e-56   3.112780180133937e+179
+  33 65 36 39 36 61 64 39  39 30 33 36 34 65 35 35
+   3.1399951412623684e-32    2.233776463768269e-52
+   3.1399951412623684e-32    2.233776463768269e-52
+  35 63 32 37 31 61 64 35  30 34 62 38 38 61 63 30
+    1.702188394472886e-51   1.3389352748057665e-75
+    1.702188394472886e-51   1.3389352748057665e-75
+  30 30 30 30 30 30 30 22  2c 20 22 50 32 53 48 2c
+     5.1856307557119e-144   2.2776342793000827e-95
+     5.1856307557119e-144   2.2776342793000827e-95
+  4e 55 4c 4c 44 55 4d 4d  59 22 5d 2c 0a 0a 5b 22
+   2.4133852976169224e+64   3.464624686628588e-143
+   2.4133852976169224e+64   3.464624686628588e-143
+  41 73 20 61 62 6f 76 65  2c 20 62 75 74 20 75 73
+   5.818423473693044e+180  1.4771673268353138e+248
+   5.818423473693044e+180  1.4771673268353138e+248
+  69 6e 67 20 61 20 4f 50  5f 31 22 5d 2c 0a 5b 5b
+   7.2084007706422705e+78  1.1995562572227457e+132
+   7.2084007706422705e+78  1.1995562572227457e+132
+  5b 22 36 30 61 32 30 62  64 39 33 61 61 34 39 61
+   9.327102284175176e+164  2.2147142899732572e+160
+   9.327102284175176e+164  2.2147142899732572e+160
+  62 34 62 32 38 64 35 31  34 65 63 31 30 62 30 36
+    1.210715003110239e-71   1.1210078351718893e-47
+    1.210715003110239e-71   1.1210078351718893e-47
+  65 31 38 32 39 63 65 36  38 31 38 65 63 30 36 63
+   1.1707187154905561e-46   8.374051509317886e+169
+   1.1707187154905561e-46   8.374051509317886e+169
+  64 33 61 61 62 64 30 31  33 65 62 63 64 63 34 62
+     9.27761462346264e-72  1.1740797652228464e+165
+     9.27761462346264e-72  1.1740797652228464e+165
+  62 31 22 2c 20 30 2c 20  22 31 20 30 78 34 31 20
+   1.051178203741475e-153  1.2832044591557164e-153
+   1.051178203741475e-153  1.2832044591557164e-153
+  30 78 30 34 63 63 37 31  65 62 33 30 64 36 35 33
+    1.323727047296959e-71    5.156464904947044e-62
+    1.323727047296959e-71    5.156464904947044e-62
+  63 30 63 33 31 36 33 39  39 30 63 34 37 62 39 37
+    3.700036567057219e-33   1.1382424501942906e-42
+    3.700036567057219e-33   1.1382424501942906e-42
+  36 66 33 66 62 33 66 33  37 63 63 63 64 63 62 65
+   4.3173569063311854e-61  2.3844478735553207e+180
+   4.3173569063311854e-61  2.3844478735553207e+180
+  64 62 31 36 39 61 31 64  66 65 66 35 38 62 62 66
+   4.298547774748211e+174   1.562282508383136e+185
+   4.298547774748211e+174   1.562282508383136e+185
+  62 66 61 66 66 37 64 38  61 34 37 33 65 37 65 32
+    4.752854267886982e-37    6.295676531507872e-66
+    4.752854267886982e-37    6.295676531507872e-66
+  65 36 64 33 31 37 62 38  37 62 61 66 65 38 62 64
+    4.282465684874165e-37  3.6051467450713026e+175
+    4.282465684874165e-37  3.6051467450713026e+175
+  65 39 37 65 33 63 66 38  66 30 36 35 64 65 63 30
+    5.263276656676302e-37    1.340061168483938e-75
+    5.263276656676302e-37    1.340061168483938e-75
+  32 32 62 35 31 64 31 31  66 63 64 64 30 64 33 34
+    9.843169909419801e-72   3.0892224187471133e-57
+    9.843169909419801e-72   3.0892224187471133e-57
+  38 61 63 34 20 30 78 34  31 20 30 78 30 34 36 31
+    6.165390952317304e-56    1.256694199982869e-71
+    6.165390952317304e-56    1.256694199982869e-71
+  63 62 64 63 63 35 34 30  39 66 62 34 62 34 64 34
+   1.7452442500568492e-76   2.5750257791461952e-56
+   1.7452442500568492e-76   2.5750257791461952e-56
+  32 62 35 31 64 33 33 33  38 31 33 35 34 64 38 30
+    4.667443180642653e-62   2.1064842847775435e-76
+    4.667443180642653e-62   2.1064842847775435e-76
+  65 35 35 30 30 37 38 63  62 35 33 32 61 33 34 62
+   9.138868541220728e+169  1.1632795672134272e+165
+   9.138868541220728e+169  1.1632795672134272e+165
+  66 61 32 66 63 66 64 65  62 37 64 37 36 35 31 39
+  2.6453102376614394e+180    3.314113001438446e-33
+  2.6453102376614394e+180    3.314113001438446e-33
+  61 65 63 63 36 32 37 37  30 66 35 62 30 65 34 65
+   1.0401509990858969e-42  3.3058784542128265e+179
+   1.0401509990858969e-42  3.3058784542128265e+179
+  66 38 35 35 31 39 34 36  64 38 61 35 34 30 39 31
+   1.3837416658003177e-47   1.4256070681404817e-71
+   1.3837416658003177e-47   1.4256070681404817e-71
+  31 61 62 65 33 65 37 38  35 34 61 32 36 66 33 39
+    6.875265298907715e-38    3.736162435625414e-33
+    6.875265298907715e-38    3.736162435625414e-33
+  66 35 38 62 32 35 63 31  35 33 34 32 61 66 20 32
+    8.696983650344238e-71    3.041534317074069e-67
+    8.696983650344238e-71    3.041534317074069e-67
+  20 4f 50 5f 43 48 45 43  4b 4d 55 4c 54 49 53 49
+        11980857420062272   1.7204081633126492e+45
+        11980857420062272   1.7204081633126492e+45
+  47 22 5d 5d 2c 0a 22 30  31 30 30 30 30 30 30 30
+    7.789711529715404e-77   1.3980432860952892e-76
+    7.789711529715404e-77   1.3980432860952892e-76
+  31 62 31 34 62 64 63 62  63 33 65 30 31 62 64 61
+   8.933733559794676e+165  1.4328733290030128e+161
+   8.933733559794676e+165  1.4328733290030128e+161
+  61 64 33 36 63 63 30 38  65 38 31 65 36 39 63 38
+    4.816068710531016e-38    4.519419899440136e-37
+    4.816068710531016e-38    4.519419899440136e-37
+  32 65 31 30 36 30 62 63  31 34 65 35 31 38 64 62
+   5.491364967316243e+170   9.314897034502109e+165
+   5.491364967316243e+170   9.314897034502109e+165
+  32 62 34 39 61 61 34 33  61 64 39 30 62 61 32 36
+    4.954198314802241e-62   1.2576383095458793e-47
+    4.954198314802241e-62   1.2576383095458793e-47
+  30 30 30 30 30 30 30 30  30 34 39 35 31 34 37 33
+    1.398043286095289e-76    5.640549763241914e-62
+    1.398043286095289e-76    5.640549763241914e-62
+  30 34 34 30 32 32 30 33  66 31 36 63 36 66 34 30
+    3.937048546130334e-62   1.7617151156396045e-76
+    3.937048546130334e-62   1.7617151156396045e-76
+  31 36 32 61 62 36 38 36  36 32 31 65 66 33 30 30
+   1.6566822804857027e-47   1.3991267697747746e-76
+   1.6566822804857027e-47   1.3991267697747746e-76
+  30 62 30 34 65 37 35 34  31 38 61 30 63 30 63 62
+   3.3799656103701886e-57    8.84016307771522e+165
+   3.3799656103701886e-57    8.84016307771522e+165
+  32 64 38 61 65 62 65 61  63 38 39 34 61 65 33 36
+  1.5032248380974053e+161    1.327129164270085e-47
+  1.5032248380974053e+161    1.327129164270085e-47
+  30 61 63 31 65 37 38 30  32 32 30 64 64 63 31 35
+   2.0913680710803983e-76   1.8154180693555623e-52
+   2.0913680710803983e-76   1.8154180693555623e-52
+  65 63 64 66 63 33 35 30  37 61 63 34 38 65 31 36
+    1.830931250382179e-76    1.190240805787694e-47
+    1.830931250382179e-76    1.190240805787694e-47
+  38 31 61 33 33 65 62 36  30 39 39 36 36 33 31 62
+   1.0069266864074526e-46   9.904835074668885e+164
+   1.0069266864074526e-46   9.904835074668885e+164
+  66 36 62 66 35 62 63 30  61 30 36 38 32 63 34 64
+   1.3392021818439885e-75   5.042444859952821e+174
+   1.3392021818439885e-75   5.042444859952821e+174
+  62 37 34 33 63 65 37 63  61 32 62 30 31 66 66 66
+   8.829579442548614e+169  1.9035295662928796e+185
+   8.829579442548614e+169  1.9035295662928796e+185
+  66 66 66 66 66 30 31 34  30 34 32 30 66 30 30 30
+   2.7383756428700166e-57    1.398114445971935e-76
+   2.7383756428700166e-57    1.398114445971935e-76
+  30 30 30 30 30 30 30 31  39 37 36 61 39 31 34 36
+    9.162216479754085e-72   1.3816119858836936e-47
+    9.162216479754085e-72   1.3816119858836936e-47
+  36 30 64 34 65 66 33 61  37 34 33 65 33 65 36 39
+  1.7046649522663434e+160   4.3131808697380055e-33
+  1.7046649522663434e+160   4.3131808697380055e-33
+  36 61 64 39 39 30 33 36  34 65 35 35 35 63 32 37
+   1.3129217704371477e-47    8.245253902327036e-43
+   1.3129217704371477e-47    8.245253902327036e-43
+  31 61 64 35 30 34 62 38  38 61 63 30 30 30 30 30
+   4.2797070607004765e-37     1.39804328712463e-76
+   4.2797070607004765e-37     1.39804328712463e-76
+  30 30 30 22 2c 20 22 50  32 53 48 2c 4e 55 4c 4c
+   1.0494047973278671e+78   3.5570106002044783e+59
+   1.0494047973278671e+78   3.5570106002044783e+59
+  44 55 4d 4d 59 22 5d 2c  0a 0a 5b 22 41 73 20 61
+    5.455871154616592e-95   7.227352390135184e+159
+    5.455871154616592e-95   7.227352390135184e+159
+  62 6f 76 65 2c 20 62 75  74 20 75 73 69 6e 67 20
+   2.721576567439345e+257     1.3980687478274e-152
+   2.721576567439345e+257     1.3980687478274e-152
+  61 20 4f 50 5f 31 4e 45  47 41 54 45 22 5d 2c 0a
+   7.3001857547332275e+25  1.1529705890232979e-259
+   7.3001857547332275e+25  1.1529705890232979e-259
+  5b 5b 5b 22 36 30 61 32  30 62 64 39 33 61 61 34
+    5.100403568195807e-66   2.2149952129789638e-56
+    5.100403568195807e-66   2.2149952129789638e-56
+  39 61 62 34 62 32 38 64  35 31 34 65 63 31 30 62
+   5.984606974961282e+174   9.324872220070917e+164
+   5.984606974961282e+174   9.324872220070917e+164
+  30 36 65 31 38 32 39 63  65 36 38 31 38 65 63 30
+   9.508939858931731e+169   1.3400147663733526e-75
+   9.508939858931731e+169   1.3400147663733526e-75
+  36 63 64 33 61 61 62 64  30 31 33 65 62 63 64 63
+   3.636823274743409e+175   6.155550138389244e+170
+   3.636823274743409e+175   6.155550138389244e+170
+  34 62 62 31 22 2c 20 30  2c 20 22 31 20 30 78 34
+    6.983377210345116e-77    6.165390902865925e-56
+    6.983377210345116e-77    6.165390902865925e-56
+  31 20 30 78 30 34 63 63  37 31 65 62 33 30 64 36
+   5.797973068604569e+170   1.1050707599576718e-46
+   5.797973068604569e+170   1.1050707599576718e-46
+  35 33 63 30 63 33 31 36  33 39 39 30 63 34 37 62
+   1.1769218600158485e-47  1.3362645532176632e+165
+   1.1769218600158485e-47  1.3362645532176632e+165
+  39 37 36 66 33 66 62 33  66 33 37 63 63 63 64 63
+    3.578082446977501e-61   6.155554709567448e+170
+    3.578082446977501e-61   6.155554709567448e+170
+  62 65 64 62 31 36 39 61  31 64 66 65 66 35 38 62
+   2.215336418504623e+160  1.3940784140825858e+165
+   2.215336418504623e+160  1.3940784140825858e+165
+  62 66 62 66 61 66 66 37  64 38 61 34 37 33 65 37
+    8.035578544379498e-42    7.605148946098063e-42
+    8.035578544379498e-42    7.605148946098063e-42
+  65 32 65 36 64 33 31 37  62 38 37 62 61 66 65 38
+    7.713082104651884e-43    5.031097826264573e-37
+    7.713082104651884e-43    5.031097826264573e-37
+  62 64 65 39 37 65 33 63  66 38 66 30 36 35 64 65
+   7.319741233083549e+169  2.6204006824633606e+180
+   7.319741233083549e+169  2.6204006824633606e+180
+  63 30 32 32 62 35 31 64  31 31 66 63 64 64 30 64
+   4.256192535532614e+174   4.054278723234465e+174
+   4.256192535532614e+174   4.054278723234465e+174
+  33 34 38 61 63 34 20 30  78 34 31 20 30 78 30 34
+    6.997300731677043e-77   2.6237402283659984e-57
+    6.997300731677043e-77   2.6237402283659984e-57
+  36 31 63 62 64 63 63 35  34 30 39 66 62 34 62 34
+    1.619382240900106e-51   2.3201314519648315e-56
+    1.619382240900106e-51   2.3201314519648315e-56
+  64 34 32 62 35 31 64 33  33 33 38 31 33 35 34 64
+    3.926765582784951e-61   4.998006349322069e+174
+    3.926765582784951e-61   4.998006349322069e+174
+  38 30 65 35 35 30 30 37  38 63 62 35 33 32 61 33
+    7.259090113048271e-43    3.344111091749819e-61
+    7.259090113048271e-43    3.344111091749819e-61
+  34 62 66 61 32 66 63 66  64 65 62 37 64 37 36 35
+  1.6485848747482933e+185   2.3194975606930547e-52
+  1.6485848747482933e+185   2.3194975606930547e-52
+  31 39 61 65 63 63 36 32  37 37 30 66 35 62 30 65
+    8.304258049628063e-67   2.655629554061684e+179
+    8.304258049628063e-67   2.655629554061684e+179
+  34 65 66 38 35 35 31 39  34 36 64 38 61 35 34 30
+    3.314110074279715e-33   1.7452413931589167e-76
+    3.314110074279715e-33   1.7452413931589167e-76
+  39 31 31 61 62 65 33 65  37 38 35 34 61 32 36 66
+   3.143911657684039e+179   2.357912304539045e+184
+   3.143911657684039e+179   2.357912304539045e+184
+  33 39 66 35 38 62 32 35  63 31 35 33 34 32 61 66
+   1.9193447221018132e-52  1.4613610917492806e+185
+   1.9193447221018132e-52  1.4613610917492806e+185
+  20 32 20 4f 50 5f 43 48  45 43 4b 4d 55 4c 54 49
+   1.3184117239414507e+40   1.8106578577758274e+45
+   1.3184117239414507e+40   1.8106578577758274e+45
+  53 49 47 22 5d 5d 2c 0a  22 30 31 30 30 30 30 30
+  1.1530070994431875e-259   1.3980432861153922e-76
+  1.1530070994431875e-259   1.3980432861153922e-76
+  30 30 31 62 31 34 62 64  63 62 63 33 65 30 31 62
+   3.601898068821177e+175   9.898499592885196e+164
+   3.601898068821177e+175   9.898499592885196e+164
+  64 61 61 64 33 36 63 63  30 38 65 38 31 65 36 39
+   5.800345259332539e+170    4.313174477934359e-33
+   5.800345259332539e+170    4.313174477934359e-33
+  63 38 32 65 31 30 36 30  62 63 31 34 65 35 31 38
+     1.91621499003711e-76    5.057145821086341e-38
+     1.91621499003711e-76    5.057145821086341e-38
+  64 62 32 62 34 39 61 61  34 33 61 64 39 30 62 61
+  1.2107319032603788e+161  1.2785614764117511e+161
+  1.2107319032603788e+161  1.2785614764117511e+161
+  32 36 30 30 30 30 30 30  30 30 30 34 39 34 66 34
+   1.3980432860957607e-76    2.829840751054194e-56
+   1.3980432860957607e-76    2.829840751054194e-56
+  37 33 30 34 34 30 32 32  30 33 66 31 36 63 36 66
+    6.746414149942206e-67  2.3781752141486993e+184
+    6.746414149942206e-67  2.3781752141486993e+184
+  34 30 31 36 32 61 62 36  38 36 36 32 31 65 66 33
+     1.00607057563741e-46    4.355193173814465e-61
+     1.00607057563741e-46    4.355193173814465e-61
+  30 30 30 62 30 34 65 37  35 34 31 38 61 30 63 30
+     7.60651290728957e-42   1.3257543639291269e-75
+     7.60651290728957e-42   1.3257543639291269e-75
+  63 62 32 64 38 61 65 62  65 61 63 38 39 34 61 65
+   9.849418485294399e+165   2.230883062895046e+180
+   9.849418485294399e+165   2.230883062895046e+180
+  33 36 30 61 63 31 65 37  38 30 32 32 30 64 64 63
+    7.602588155444879e-42   6.156498239411745e+170
+    7.602588155444879e-42   6.156498239411745e+170
+  31 35 65 63 64 66 63 33  35 30 37 61 63 34 38 65
+   3.7726970426456865e-61  3.9233412652006243e+179
+   3.7726970426456865e-61  3.9233412652006243e+179
+  31 36 38 31 61 33 33 65  62 36 30 39 39 36 36 33
+   3.112250429511874e+179     5.39939207359627e-62
+   3.112250429511874e+179     5.39939207359627e-62
+  31 62 66 36 62 66 35 62  63 30 61 30 36 38 32 63
+   1.232338787069506e+165   6.875999845922476e+169
+   1.232338787069506e+165   6.875999845922476e+169
+  34 64 62 37 34 33 63 65  37 63 61 32 62 30 31 66
+   2.489711352312897e+180  1.8259460179421124e+184
+   2.489711352312897e+180  1.8259460179421124e+184
+  66 66 66 66 66 66 66 30  31 34 30 34 32 30 66 30
+   1.5476014050729244e-75    1.532972844432789e-75
+   1.5476014050729244e-75    1.532972844432789e-75
+  30 30 30 30 30 30 30 30  30 31 39 37 36 61 39 31
+    1.398043286095289e-76   1.4364420114292292e-71
+    1.398043286095289e-76   1.4364420114292292e-71
+  34 36 36 30 64 34 65 66  33 61 37 34 33 65 33 65
+  1.8020155572007445e+185  3.1437949778683856e+179
+  1.8020155572007445e+185  3.1437949778683856e+179
+  36 39 36 61 64 39 39 30  33 36 34 65 35 35 35 63
+   2.1784033856997468e-76   8.003761390802721e+169
+   2.1784033856997468e-76   8.003761390802721e+169
+  32 37 31 61 64 35 30 34  62 38 38 61 63 30 30 30
+    2.582173048214459e-57   1.3981107449990037e-76
+    2.582173048214459e-57   1.3981107449990037e-76
+  30 30 30 30 30 22 2c 20  22 50 32 53 48 2c 4e 55
+  1.0491479271301769e-153    8.44747126957892e+102
+  1.0491479271301769e-153    8.44747126957892e+102
+  4c 4c 44 55 4d 4d 59 22  5d 2c 0a 0a 5b 22 41 73
+  3.2420242503507667e-143  1.4975120688572445e+247
+  3.2420242503507667e-143  1.4975120688572445e+247
+  20 61 62 6f 76 65 2c 20  62 75 74 20 77 69 74 68
+  1.0589478375027802e-153  1.4900547067816291e+195
+  1.0589478375027802e-153  1.4900547067816291e+195
+  20 74 68 65 20 64 75 6d  6d 79 20 62 79 74 65 20
+  1.8877756114999375e+219   1.280148240451987e-152
+  1.8877756114999375e+219   1.280148240451987e-152
+  6d 69 73 73 69 6e 67 22  5d 2c 0a 5b 5b 5b 22 36
+   6.004659549376028e-143    6.280137584970692e-48
+   6.004659549376028e-143    6.280137584970692e-48
+  30 61 32 30 62 64 39 33  61 61 34 39 61 62 34 62
+    6.172483235274176e-62  1.1738520386731076e+165
+    6.172483235274176e-62  1.1738520386731076e+165
+  32 38 64 35 31 34 65 63  31 30 62 30 36 65 31 38
+   6.401810461416803e+170    5.112036296766212e-38
+   6.401810461416803e+170    5.112036296766212e-38
+  32 39 63 65 36 38 31 38  65 63 30 36 63 64 33 61
+    5.060379758608404e-38  1.7039758003538328e+160
+    5.060379758608404e-38  1.7039758003538328e+160
+  61 62 64 30 31 33 65 62  63 64 63 34 62 62 31 22
+   9.766587842090383e+165   5.568773622767118e-144
+   9.766587842090383e+165   5.568773622767118e-144
+  2c 20 30 2c 20 22 31 20  30 78 34 31 20 30 78 30
+  1.2778601472054988e-153   3.3422651061449623e-75
+  1.2778601472054988e-153   3.3422651061449623e-75
+  34 63 63 37 31 65 62 33  30 64 36 35 33 63 30 63
+   3.5773163240836526e-61   6.184580968945862e+169
+   3.5773163240836526e-61   6.184580968945862e+169
+  33 31 36 33 39 39 30 63  34 37 62 39 37 36 66 33
+   6.122698904564936e+169   4.3195077264112395e-61
+   6.122698904564936e+169   4.3195077264112395e-61
+  66 62 33 66 33 37 63 63  63 64 63 62 65 64 62 31
+   5.801524655348289e+170    8.327680360676363e-71
+   5.801524655348289e+170    8.327680360676363e-71
+  36 39 61 31 64 66 65 66  35 38 62 62 66 62 66 61
+  1.8186136253926442e+185  1.5735214436363168e+161
+  1.8186136253926442e+185  1.5735214436363168e+161
+  66 66 37 64 38 61 34 37  33 65 37 65 32 65 36 64
+    9.138603456575791e-43   5.539038595121839e+174
+    9.138603456575791e-43   5.539038595121839e+174
+  33 31 37 62 38 37 62 61  66 65 38 62 64 65 39 37
+  1.2804825380645332e+161    1.138798849868277e-42
+  1.2804825380645332e+161    1.138798849868277e-42
+  65 33 63 66 38 66 30 36  35 64 65 63 30 32 32 62
+    1.122085509593256e-47  1.0478395412328553e+165
+    1.122085509593256e-47  1.0478395412328553e+165
+  35 31 64 31 31 66 63 64  64 30 64 33 34 38 61 63
+   3.838407189691533e+175    5.19887372317466e+170
+   3.838407189691533e+175    5.19887372317466e+170
+  34 20 30 78 34 31 20 30  78 30 34 36 31 63 62 64
+    6.991931390756674e-77   3.638224202755963e+175
+    6.991931390756674e-77   3.638224202755963e+175
+  63 63 35 34 30 39 66 62  34 62 34 64 34 32 62 35
+  1.0238067083001555e+166   1.5198101820802816e-51
+  1.0238067083001555e+166   1.5198101820802816e-51
+  31 64 33 33 33 38 31 33  35 34 64 38 30 65 35 35
+    4.185836173696666e-62   2.2337701050381575e-52
+    4.185836173696666e-62   2.2337701050381575e-52
+  30 30 37 38 63 62 35 33  32 61 33 34 62 66 61 32
+    5.198241809950221e-62    5.163195962530111e-66
+    5.198241809950221e-62    5.163195962530111e-66
+  66 63 66 64 65 62 37 64  37 36 35 31 39 61 65 63
+   5.783663053500447e+174   6.454918587830606e+170
+   5.783663053500447e+174   6.454918587830606e+170
+  63 36 32 37 37 30 66 35  62 30 65 34 65 66 38 35
+   1.8532568397448206e-51    2.547476960034511e-52
+   1.8532568397448206e-51    2.547476960034511e-52
+  35 31 39 34 36 64 38 61  35 34 30 39 31 31 61 62
+  2.1432625051717745e+160   7.920233862345577e+165
+  2.1432625051717745e+160   7.920233862345577e+165
+  65 33 65 37 38 35 34 61  32 36 66 33 39 66 35 38
+  1.7756552886459985e+160     6.28869209657972e-38
+  1.7756552886459985e+160     6.28869209657972e-38
+  62 32 35 63 31 35 33 34  32 61 66 20 32 20 4f 50
+   3.0599766665605123e-57    7.208234686961478e+78
+   3.0599766665605123e-57    7.208234686961478e+78
+  5f 43 48 45 43 4b 4d 55  4c 54 49 53 49 47 22 5d
+   8.201383970977714e+102   4.353390818927744e+140
+   8.201383970977714e+102   4.353390818927744e+140
+  5d 2c 0a 22 30 31 30 30  30 30 30 30 30 31 62 31
+    1.398380563599275e-76    8.237109779006023e-71
+    1.398380563599275e-76    8.237109779006023e-71
+  34 62 64 63 62 63 33 65  30 31 62 64 61 61 64 33
+   3.142645347283126e+179   3.9633591523405075e-61
+   3.142645347283126e+179   3.9633591523405075e-61
+  36 63 63 30 38 65 38 31  65 36 39 63 38 32 65 31
+    1.380730065021832e-71    9.597286976969583e-71
+    1.380730065021832e-71    9.597286976969583e-71
+  30 36 30 62 63 31 34 65  35 31 38 64 62 32 62 34
+   3.273079969477704e+179    2.319135754297908e-56
+   3.273079969477704e+179    2.319135754297908e-56
+  39 61 61 34 33 61 64 39  30 62 61 32 36 30 30 30
+   3.1399880439205075e-32   1.3980512040280634e-76
+   3.1399880439205075e-32   1.3980512040280634e-76
+  30 30 30 30 30 30 34 38  34 37 33 30 34 34 30 32
+    5.932789135326604e-38    6.010368466241235e-67
+    5.932789135326604e-38    6.010368466241235e-67
+  32 30 33 66 31 36 63 36  66 34 30 31 36 32 61 62
+   1.0516138076912055e-46   7.922068355953969e+165
+   1.0516138076912055e-46   7.922068355953969e+165
+  36 38 36 36 32 31 65 66  33 30 30 30 62 30 34 65
+  1.8009548676755642e+185   3.272443847277845e+179
+  1.8009548676755642e+185   3.272443847277845e+179
+  37 35 34 31 38 61 30 63  30 63 62 32 64 38 61 65
+   6.181661263679617e+169    2.23299422879759e+180
+   6.181661263679617e+169    2.23299422879759e+180
+  62 65 61 63 38 39 34 61  65 33 36 30 61 63 31 65
+  1.7770284785468835e+160   2.818461475688826e+179
+  1.7770284785468835e+160   2.818461475688826e+179
+  37 38 30 32 32 30 64 64  63 31 35 65 63 64 66 63
+   3.994537534190682e+175   6.760568096646819e+170
+   3.994537534190682e+175   6.760568096646819e+170
+  33 35 30 37 61 63 34 38  65 31 36 38 31 61 33 33
+    5.991554110341484e-38    4.710933724228877e-62
+    5.991554110341484e-38    4.710933724228877e-62
+  65 62 36 30 39 39 36 36  33 31 62 66 36 62 66 35
+    1.520595550973725e-47   1.8695690613597207e-51
+    1.520595550973725e-47   1.8695690613597207e-51
+  62 63 30 61 30 36 38 32  63 34 64 62 37 34 33 63
+    8.980609647975502e-67   7.247506155718934e+169
+    8.980609647975502e-67   7.247506155718934e+169
+  65 37 63 61 32 62 30 31  66 66 66 66 66 66 66 66
+    9.272778369337403e-72  1.9035985662552932e+185
+    9.272778369337403e-72  1.9035985662552932e+185
+  30 31 34 30 34 32 30 66  30 30 30 30 30 30 30 30
+    1.72047374710352e+184    1.398043286095289e-76
+    1.72047374710352e+184    1.398043286095289e-76
+  30 30 31 39 37 36 61 39  31 34 36 36 30 64 34 65
+    2.651894621783635e-32   3.305244863316297e+179
+    2.651894621783635e-32   3.305244863316297e+179
+  66 33 61 37 34 33 65 33  65 36 39 36 61 64 39 39
+    4.122750637395845e-61    4.890342179255886e-33
+    4.122750637395845e-61    4.890342179255886e-33
+  30 33 36 34 65 35 35 35  63 32 37 31 61 64 35 30
+    2.214278599495096e-52   1.8474585074784328e-76
+    2.214278599495096e-52   1.8474585074784328e-76
+  34 62 38 38 61 63 30 30  30 30 30 30 30 30 22 2c
+   1.4153127654462938e-76    4.257571555502434e-96
+   1.4153127654462938e-76    4.257571555502434e-96
+  20 22 50 32 53 48 2c 4e  55 4c 4c 44 55 4d 4d 59
+   3.8124760837491277e+68  1.5133059698644156e+122
+   3.8124760837491277e+68  1.5133059698644156e+122
+  22 5d 2c 0a 0a 0a 5b 22  45 6d 70 74 79 20 73 74
+   3.464624425504013e-143   8.764353801569802e+252
+   3.464624425504013e-143   8.764353801569802e+252
+  61 63 6b 20 77 68 65 6e  20 77 65 20 74 72 79 20
+   6.190764246379506e+223   3.036688423159781e-152
+   6.190764246379506e+223   3.036688423159781e-152
+  74 6f 20 72 75 6e 20 43  48 45 43 4b 53 49 47 22
+         2312525166163898  1.4918835928118613e-143
+         2312525166163898  1.4918835928118613e-143
+  5d 2c 0a 5b 5b 5b 22 61  64 35 30 33 66 37 32 63
+    8.06503349056827e+159    6.87480211829364e+169
+    8.06503349056827e+159    6.87480211829364e+169
+  31 38 64 66 35 38 30 31  65 65 36 34 64 37 36 30
+    9.179948362346047e-72   1.9186433967419256e-76
+    9.179948362346047e-72   1.9186433967419256e-76
+  39 30 61 66 65 34 63 36  30 37 66 62 32 62 38 32
+   1.0512295983503889e-46    9.044372975046504e-67
+   1.0512295983503889e-46    9.044372975046504e-67
+  32 65 39 62 37 62 36 33  63 35 38 32 36 63 35 30
+    5.441165747837591e-62   1.8470644979982055e-76
+    5.441165747837591e-62   1.8470644979982055e-76
+  65 32 32 66 63 33 62 22  2c 20 30 2c 20 22 30 78
+   4.664241252777644e-143   8.523135963328286e+270
+   4.664241252777644e-143   8.523135963328286e+270
+  32 31 20 30 78 30 32 37  63 33 61 39 37 36 36 35
+    8.156379421977456e-43   2.3190180524447776e-52
+    8.156379421977456e-43   2.3190180524447776e-52
+  62 66 32 38 33 61 31 30  32 61 35 38 37 61 36 32
+   1.5009391325703803e-76    8.301110202475135e-67
+   1.5009391325703803e-76    8.301110202475135e-67
+  61 33 30 61 30 63 31 30  32 64 34 64 33 62 31 34
+    1.501610090920158e-76    2.769366724280776e-57
+    1.501610090920158e-76    2.769366724280776e-57
+  31 30 31 35 65 32 63 61  65 36 66 36 34 65 32 35
+  1.3494531860352272e+161   1.9205618505446674e-52
+  1.3494531860352272e+161   1.9205618505446674e-52
+  34 33 31 31 33 65 35 20  43 48 45 43 4b 53 49 47
+  1.5957352978293038e-153   2.6299364878383027e+35
+  1.5957352978293038e-153   2.6299364878383027e+35
+  20 4e 4f 54 22 5d 5d 2c  0a 22 30 31 30 30 30 30
+       5.498873275965e-95   1.3980432912417352e-76
+       5.498873275965e-95   1.3980432912417352e-76
+  30 30 30 31 33 62 66 63  32 32 30 65 63 35 32 36
+     6.7579873033946e+170   1.2458794048743978e-47
+     6.7579873033946e+170   1.2458794048743978e-47
+  35 38 33 63 62 36 62 37  65 39 32 32 62 38 62 32
+    6.533391996358379e-42    5.406612580715396e-66
+    6.533391996358379e-42    5.406612580715396e-66
+  37 66 36 30 34 63 66 65  30 61 30 39 37 36 34 64
+   2.903041949250179e+180  4.9989876970385045e+174
+   2.903041949250179e+180  4.9989876970385045e+174
+  65 36 31 65 38 30 66 35  38 64 63 31 37 32 33 66
+   1.8532583432058654e-51   2.039161413006179e+184
+   1.8532583432058654e-51   2.039161413006179e+184
+  35 30 61 64 30 30 30 30  30 30 30 30 30 30 66 66
+   1.3980435547535597e-76  1.8856023613222075e+185
+   1.3980435547535597e-76  1.8856023613222075e+185
+  66 66 66 66 66 66 30 31  30 31 30 30 30 30 30 30
+     9.28207105579738e-72   1.3980432860953674e-76
+     9.28207105579738e-72   1.3980432860953674e-76
+  30 30 30 30 30 30 30 30  32 33 32 31 30 32 37 63
+    1.398043286095289e-76     8.7541013006078e+169
+    1.398043286095289e-76     8.7541013006078e+169
+  33 61 39 37 36 36 35 62  66 32 38 33 61 31 30 32
+   1.221502734251176e+165    6.006276498013452e-67
+   1.221502734251176e+165    6.006276498013452e-67
+  61 35 38 37 61 36 32 61  33 30 61 30 63 31 30 32
+  1.6003146795216916e+160    6.006287754826614e-67
+  1.6003146795216916e+160    6.006287754826614e-67
+  64 34 64 33 62 31 34 31  30 31 35 65 32 63 61 65
+   1.1428779025098315e-71  2.2546765939306324e+180
+   1.1428779025098315e-71  2.2546765939306324e+180
+  36 66 36 34 65 32 35 34  33 31 31 33 65 35 61 63
+   3.3768541029543934e-57   5.195561367315095e+170
+   3.3768541029543934e-57   5.195561367315095e+170
+  30 30 30 30 30 30 30 30  22 2c 20 22 50 32 53 48
+    1.398043286095289e-76    2.612896978874658e+40
+    1.398043286095289e-76    2.612896978874658e+40
+  22 5d 2c 0a 0a 0a 5b 22  49 6e 76 65 72 74 65 64
+   3.464624425504013e-143   4.245153397268165e+175
+   3.464624425504013e-143   4.245153397268165e+175
+  20 76 65 72 73 69 6f 6e  73 20 6f 66 20 74 78 5f
+   9.083667908579806e+223   8.004624802980989e+151
+   9.083667908579806e+223   8.004624802980989e+151
+  76 61 6c 69 64 20 43 4f  44 45 53 45 50 41 52 41
+    6.758731442185835e+73        4785473.083207432
+    6.758731442185835e+73        4785473.083207432
+  54 4f 52 20 49 46 20 62  6c 6f 63 6b 20 74 65 73
+   4.685939995065208e+164   7.500099521229542e+247
+   4.685939995065208e+164   7.500099521229542e+247
+  74 73 22 5d 2c 0a 0a 5b  22 43 4f 44 45 53 45 50
+  3.6099798191233717e+130    4.938596448638356e+78
+  3.6099798191233717e+130    4.938596448638356e+78
+  41 52 41 54 4f 52 20 69  6e 20 61 6e 20 75 6e 65
+   2.440101210458025e+198   3.949499337018762e+180
+   2.440101210458025e+198   3.949499337018762e+180
+  78 65 63 75 74 65 64 20  49 46 20 62 6c 6f 63 6b
+  1.2169809336762795e-152   1.996719597317461e+209
+  1.2169809336762795e-152   1.996719597317461e+209
+  20 64 6f 65 73 20 6e 6f  74 20 63 68 61 6e 67 65
+   5.709514308458247e+228  3.0383756431852282e+180
+   5.709514308458247e+228  3.0383756431852282e+180
+  20 77 68 61 74 20 69 73  20 68 61 73 68 65 64 22
+    8.78422019833598e+247   5.226846355504544e-143
+    8.78422019833598e+247   5.226846355504544e-143
+  5d 2c 0a 5b 5b 5b 22 61  39 35 35 30 33 32 66 34
+    8.06503349056827e+159   2.8288333702192255e-56
+    8.06503349056827e+159   2.8288333702192255e-56
+  64 36 62 30 63 39 62 66  65 38 63 61 64 38 66 30
+   1.548727831023251e+185    1.535184783694008e-75
+   1.548727831023251e+185    1.535184783694008e-75
+  30 61 38 39 33 33 37 39  30 62 39 63 31 64 63 32
+    4.468157540087272e-33    5.754129660356332e-66
+    4.468157540087272e-33    5.754129660356332e-66
+  38 63 38 32 65 30 66 34  38 65 37 35 62 33 35 64
+    2.827934937675745e-56    5.24358191718946e+174
+    2.827934937675745e-56    5.24358191718946e+174
+  61 30 65 34 39 34 34 22  2c 20 30 2c 20 22 49 46
+   6.472013215777062e-144    3.982530894977298e+30
+   6.472013215777062e-144    3.982530894977298e+30
+  20 43 4f 44 45 53 45 50  41 52 41 54 4f 52 20 45
+    4.938596448638355e+78    9.865755264717706e+24
+    4.938596448638355e+78    9.865755264717706e+24
+  4e 44 49 46 20 30 78 32  31 20 30 78 30 33 37 38
+   1.4354920071177004e-65    6.817854990713587e-38
+   1.4354920071177004e-65    6.817854990713587e-38
+  64 34 33 30 32 37 34 66  38 63 35 65 63 31 33 32
+  2.1474556573079126e+184    7.119050768005487e-67
+  2.1474556573079126e+184    7.119050768005487e-67
+  31 33 33 38 31 35 31 65  39 66 32 37 66 34 63 36
+   2.789217206196148e+179   1.0512302796483916e-46
+   2.789217206196148e+179   1.0512302796483916e-46
+  37 36 61 30 30 38 62 64  66 38 36 33 38 64 30 37
+   3.604986092200413e+175     7.35019498170337e-43
+   3.604986092200413e+175     7.35019498170337e-43
+  63 30 62 36 62 65 39 61  62 33 35 63 37 31 20 43
+  2.2315341607729353e+160         2278856792381873
+  2.2315341607729353e+160         2278856792381873
+  48 45 43 4b 53 49 47 56  45 52 49 46 59 20 43 4f
+   4.272591087208812e+107    6.758671390232611e+73
+   4.272591087208812e+107    6.758671390232611e+73
+  44 45 53 45 50 41 52 41  54 4f 52 20 31 22 5d 5d
+        4785473.083207432   5.551004350196569e+141
+        4785473.083207432   5.551004350196569e+141
+  2c 0a 22 30 31 30 30 30  30 30 30 30 31 34 34 34
+   1.3980446035855388e-76    3.218663071686238e-57
+   1.3980446035855388e-76    3.218663071686238e-57
+  39 30 65 64 61 33 35 35  62 65 37 34 38 30 66 32
+     2.21345686391591e-52    6.584095400029062e-66
+     2.21345686391591e-52    6.584095400029062e-66
+  65 63 38 32 38 64 63 63  31 62 39 39 30 33 37 39
+   5.854618100963652e+170   4.4681487239246586e-33
+   5.854618100963652e+170   4.4681487239246586e-33
+  33 61 38 30 30 38 66 61  64 38 63 66 65 39 62 30
+    1.56193045165525e+161    1.259098345008357e-75
+    1.56193045165525e+161    1.259098345008357e-75
+  63 36 62 34 64 32 66 30  33 35 35 61 39 30 30 30
+   1.5335653167616423e-75   1.3980553983992288e-76
+   1.5335653167616423e-75   1.3980553983992288e-76
+  30 30 30 30 30 34 61 34  38 33 30 34 35 30 32 32
+   2.1925864539849275e-56    6.746419809741631e-67
+   2.1925864539849275e-56    6.746419809741631e-67
+  30 37 61 36 39 37 34 61  37 37 63 35 39 31 66 61
+   1.776343103873848e+160  1.5600179835829176e+161
+   1.776343103873848e+160  1.5600179835829176e+161
+  31 33 64 66 66 36 30 63  61 62 62 62 38 35 61 30
+   6.118536581048608e+169    1.188882019121838e-75
+   6.118536581048608e+169    1.188882019121838e-75
+  64 65 39 65 30 32 35 63  30 39 63 36 35 61 34 62
+   7.999309985993393e+169   1.173588420773824e+165
+   7.999309985993393e+169   1.173588420773824e+165
+  32 32 38 35 65 34 37 63  65 38 65 32 32 66 37 36
+   8.757355005569163e+169    1.601038469309266e-47
+   8.757355005569163e+169    1.601038469309266e-47
+  31 30 32 32 31 30 30 66  30 65 66 61 61 63 39 66
+   1.719638993889941e+184  2.6969280126575086e+184
+   1.719638993889941e+184  2.6969280126575086e+184
+  66 38 61 63 33 36 62 31  30 37 32 31 65 30 61 61
+    8.245975323969393e-71  1.2083129293999962e+161
+    8.245975323969393e-71  1.2083129293999962e+161
+  65 31 66 62 39 37 35 63  39 30 35 30 30 62 35 30
+   8.006732770293855e+169    1.846719230659721e-76
+   8.006732770293855e+169    1.846719230659721e-76
+  63 35 36 65 38 61 30 63  63 35 32 62 30 34 30 33
+   6.181662433573002e+169     3.93894096560858e-62
+   6.181662433573002e+169     3.93894096560858e-62
+  66 30 34 32 35 64 64 30  31 35 31 66 66 66 66 66
+   1.4088310759407033e-75   1.903598565202809e+185
+   1.4088310759407033e-75   1.903598565202809e+185
+  66 66 66 30 31 30 30 30  30 30 30 30 30 30 30 30
+   1.3980446049601027e-76    1.398043286095289e-76
+   1.3980446049601027e-76    1.398043286095289e-76
+  30 30 30 30 30 30 31 36  61 30 30 30 30 30 30 30
+   1.1760667833056972e-47    1.398043286095304e-76
+   1.1760667833056972e-47    1.398043286095304e-76
+  30 22 2c 20 22 50 32 53  48 22 5d 2c 0a 0a 5b 22
+    5.968685125563565e+92  3.4646246866285803e-143
+    5.968685125563565e+92  3.4646246866285803e-143
+  41 73 20 61 62 6f 76 65  2c 20 77 69 74 68 20 74
+   5.818423473693044e+180   2.349539444311644e+251
+   5.818423473693044e+180   2.349539444311644e+251
+  68 65 20 49 46 20 62 6c  6f 63 6b 20 65 78 65 63
+  1.2204237385486672e+214   6.482246343701175e+170
+  1.2204237385486672e+214   6.482246343701175e+170
+  75 74 65 64 22 5d 2c 0a  5b 5b 5b 22 61 39 35 35
+  1.1529706642957023e-259   2.2159034421334105e-52
+  1.1529706642957023e-259   2.2159034421334105e-52
+  30 33 32 66 34 64 36 62  30 63 39 62 66 65 38 63
+  1.2894347363870579e+165   9.206994018558863e+169
+  1.2894347363870579e+165   9.206994018558863e+169
+  61 64 38 66 30 30 61 38  39 33 33 37 39 30 62 39
+    4.040935454918147e-37    2.802362582371364e-32
+    4.040935454918147e-37    2.802362582371364e-32
+  63 31 64 63 32 38 63 38  32 65 30 66 34 38 65 37
+    4.518487169946463e-37    7.612140081981139e-42
+    4.518487169946463e-37    7.612140081981139e-42
+  35 62 33 35 64 61 30 65  34 39 34 34 22 2c 20 30
+  2.6551121602363154e+179    6.983377282917619e-77
+  2.6551121602363154e+179    6.983377282917619e-77
+  2c 20 22 49 46 20 43 4f  44 45 53 45 50 41 52 41
+    6.758569002397816e+73        4785473.083207432
+    6.758569002397816e+73        4785473.083207432
+  54 4f 52 20 45 4e 44 49  46 20 30 78 32 31 20 30
+     9.05666369438561e+44    6.991918213009273e-77
+     9.05666369438561e+44    6.991918213009273e-77
+  78 30 33 37 38 64 34 33  30 32 37 34 66 38 63 35
+    4.956894878628026e-62   1.6053551553784142e-51
+    4.956894878628026e-62   1.6053551553784142e-51
+  65 63 31 33 32 31 33 33  38 31 35 31 65 39 66 32
+    4.665358635538013e-62    6.594731241894268e-66
+    4.665358635538013e-62    6.594731241894268e-66
+  37 66 34 63 36 37 36 61  30 30 38 62 64 66 38 36
+  1.9520781363980535e+160   1.6695136433651022e-47
+  1.9520781363980535e+160   1.6695136433651022e-47
+  33 38 64 30 37 63 30 62  36 62 65 39 61 62 33 35
+   9.436956626798308e+164   2.0238149352297928e-52
+   9.436956626798308e+164   2.0238149352297928e-52
+  63 37 31 20 43 48 45 43  4b 53 49 47 56 45 52 49
+    1.198085530205767e+16   1.6298140813692505e+45
+    1.198085530205767e+16   1.6298140813692505e+45
+  46 59 20 43 4f 44 45 53  45 50 41 52 41 54 4f 52
+    1.386281819775562e+93   3.1161400419388188e+88
+    1.386281819775562e+93   3.1161400419388188e+88
+  20 31 22 5d 5d 2c 0a 22  30 31 30 30 30 30 30 30
+  1.0480224142302541e-144   1.3980432860953674e-76
+  1.0480224142302541e-144   1.3980432860953674e-76
+  30 31 34 34 34 39 30 65  64 61 33 35 35 62 65 37
+   2.629666798901932e+179    7.670999043830472e-42
+   2.629666798901932e+179    7.670999043830472e-42
+  34 38 30 66 32 65 63 38  32 38 64 63 63 31 62 39
+    4.559813182411583e-37   2.8030635828391227e-32
+    4.559813182411583e-37   2.8030635828391227e-32
+  39 30 33 37 39 33 61 38  30 30 38 66 61 64 38 63
+    4.043722146824383e-37   9.205491111311283e+169
+    4.043722146824383e-37   9.205491111311283e+169
+  66 65 39 62 30 63 36 62  34 64 32 66 30 33 35 35
+  1.2892062622878178e+165   2.2133788136234898e-52
+  1.2892062622878178e+165   2.2133788136234898e-52
+  61 39 30 30 30 30 30 30  30 30 34 61 34 38 33 30
+   1.3980432860960108e-76   1.6598326688313133e-76
+   1.3980432860960108e-76   1.6598326688313133e-76
+  34 35 30 32 32 31 30 30  66 61 34 61 37 34 62 61
+   1.3983832822744672e-76  1.2796576854847238e+161
+   1.3983832822744672e-76  1.2796576854847238e+161
+  39 66 64 35 39 63 35 39  66 34 36 63 33 39 36 30
+     4.11910032613851e-33   1.9192537683792483e-76
+     4.11910032613851e-33   1.9192537683792483e-76
+  63 66 39 30 63 62 65 30  64 32 62 37 34 33 63 34
+   1.4774291498050352e-75   2.4469911519721055e-56
+   1.4774291498050352e-75   2.4469911519721055e-56
+  37 31 64 32 34 61 33 64  35 64 36 64 62 36 30 30
+   4.793189651839962e+174   1.4001335446352607e-76
+   4.793189651839962e+174   1.4001335446352607e-76
+  32 61 66 35 65 65 62 62  30 32 32 30 34 64 37 30
+   8.474865474553366e+165   2.0201225734687796e-76
+   8.474865474553366e+165   2.0201225734687796e-76
+  65 63 34 39 30 66 64 30  66 37 30 35 35 61 37 63
+    1.409365594205952e-75   8.823417774853273e+169
+    1.409365594205952e-75   8.823417774853273e+169
+  34 35 66 38 36 35 31 34  33 33 36 65 33 61 37 66
+    2.741370032169243e-57   2.483568374943765e+184
+    2.741370032169243e-57   2.483568374943765e+184
+  30 33 35 30 33 64 61 63  65 63 61 62 62 32 34 37
+   5.250761042338143e+170    9.056564498386823e-43
+   5.250761042338143e+170    9.056564498386823e-43
+  66 63 32 33 66 31 35 63  38 33 35 31 30 31 30 30
+   7.998145621498458e+169    1.398380641677806e-76
+   7.998145621498458e+169    1.398380641677806e-76
+  66 66 66 66 66 66 66 66  30 31 30 30 30 30 30 30
+  1.9035985662552932e+185   1.3980432860953674e-76
+  1.9035985662552932e+185   1.3980432860953674e-76
+  30 30 30 30 30 30 30 30  30 30 30 31 36 61 30 30
+    1.398043286095289e-76   1.4145813642662893e-76
+    1.398043286095289e-76   1.4145813642662893e-76
+  30 30 30 30 30 30 22 2c  20 22 50 32 53 48 22 5d
+    4.257571555502434e-96   4.354357046338091e+140
+    4.257571555502434e-96   4.354357046338091e+140
+  2c 0a 0a 5b 22 43 48 45  43 4b 4c 4f 43 4b 54 49
+    5.866250394893773e+25   1.8102849189569236e+45
+    5.866250394893773e+25   1.8102849189569236e+45
+  4d 45 56 45 52 49 46 59  20 74 65 73 74 73 22 5d
+  1.1509816729231713e+122   4.394483102039588e+140
+  1.1509816729231713e+122   4.394483102039588e+140
+  2c 0a 0a 5b 22 42 79 2d  68 65 69 67 68 74 20 6c
+   1.2399553576191174e-89   6.924324264905241e+212
+   1.2399553576191174e-89   6.924324264905241e+212
+  6f 63 6b 73 2c 20 77 69  74 68 20 61 72 67 75 6d
+  1.1063476494745487e+200  1.8889201945512208e+219
+  1.1063476494745487e+200  1.8889201945512208e+219
+  65 6e 74 20 6a 75 73 74  20 62 65 79 6f 6e 64 20
+   8.916390806041675e+252  1.2190740540502696e-152
+   8.916390806041675e+252  1.2190740540502696e-152
+  74 78 20 6e 4c 6f 63 6b  54 69 6d 65 22 5d 2c 0a
+   1.996669506240297e+209  1.1529706667938971e-259
+   1.996669506240297e+209  1.1529706667938971e-259
+  5b 5b 5b 22 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043214897502e-76    1.398043286095289e-76
+    1.398043214897502e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 31 30 30 22 2c 20 30  2c 20 22 31 20 43 48 45
+    6.983377179561166e-77    5.866242412268271e+25
+    6.983377179561166e-77    5.866242412268271e+25
+  43 4b 4c 4f 43 4b 54 49  4d 45 56 45 52 49 46 59
+   1.8102849189569236e+45  1.1509816729231713e+122
+   1.8102849189569236e+45  1.1509816729231713e+122
+  20 31 22 5d 5d 2c 0a 22  30 31 30 30 30 30 30 30
+  1.0480224142302541e-144   1.3980432860953674e-76
+  1.0480224142302541e-144   1.3980432860953674e-76
+  30 31 30 30 30 31 30 30  30 30 30 30 30 30 30 30
+   1.3983806364295508e-76    1.398043286095289e-76
+   1.3983806364295508e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 31 30 30  30 30 30 30 30 30 30 30
+   1.3983806364294722e-76    1.398043286095289e-76
+   1.3983806364294722e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  22 2c 20 22 50 32 53 48  2c 43 48 45 43 4b 4c 4f
+    2.612896978874658e+40     9.99823248050118e+73
+    2.612896978874658e+40     9.99823248050118e+73
+  43 4b 54 49 4d 45 56 45  52 49 46 59 22 5d 2c 0a
+   1.0769454800825815e+26   1.152970637348911e-259
+   1.0769454800825815e+26   1.152970637348911e-259
+  5b 5b 5b 22 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043214897502e-76    1.398043286095289e-76
+    1.398043214897502e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 31 30 30 22 2c 20 30  2c 20 22 34 39 39 39 39
+    6.983377179561166e-77    4.857875001292052e-33
+    6.983377179561166e-77    4.857875001292052e-33
+  39 39 39 39 20 43 48 45  43 4b 4c 4f 43 4b 54 49
+    5.866242528860715e+25   1.8102849189569236e+45
+    5.866242528860715e+25   1.8102849189569236e+45
+  4d 45 56 45 52 49 46 59  20 31 22 5d 5d 2c 0a 22
+  1.1509816729231713e+122  1.0480224142302541e-144
+  1.1509816729231713e+122  1.0480224142302541e-144
+  30 31 30 30 30 30 30 30  30 31 30 30 30 31 30 30
+   1.3980432860953674e-76   1.3983806364295508e-76
+   1.3980432860953674e-76   1.3983806364295508e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 31 30 30
+    1.398043286095289e-76   1.3983806364294722e-76
+    1.398043286095289e-76   1.3983806364294722e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  66 65 36 34 63 64 31 64  22 2c 20 22 50 32 53 48
+   4.301604655116842e+174    2.612896978874658e+40
+   4.301604655116842e+174    2.612896978874658e+40
+  2c 43 48 45 43 4b 4c 4f  43 4b 54 49 4d 45 56 45
+     9.99823248050118e+73   1.0769454800825815e+26
+     9.99823248050118e+73   1.0769454800825815e+26
+  52 49 46 59 22 5d 2c 0a  0a 5b 22 42 79 2d 74 69
+   1.152970637348911e-259   9.653111545928755e+199
+   1.152970637348911e-259   9.653111545928755e+199
+  6d 65 20 6c 6f 63 6b 73  2c 20 77 69 74 68 20 61
+   9.574881566664404e+247   7.208817957830964e+159
+   9.574881566664404e+247   7.208817957830964e+159
+  72 67 75 6d 65 6e 74 20  6a 75 73 74 20 62 65 79
+  2.4381298143520567e-152   5.922716137431689e+276
+  2.4381298143520567e-152   5.922716137431689e+276
+  6f 6e 64 20 74 78 20 6e  4c 6f 63 6b 54 69 6d 65
+   2.976830969264249e+222  3.8138514498741003e+180
+   2.976830969264249e+222  3.8138514498741003e+180
+  20 28 62 75 74 20 77 69  74 68 69 6e 20 6e 75 6d
+   1.106400214390685e+200    1.89122294152521e+219
+   1.106400214390685e+200    1.89122294152521e+219
+  65 72 69 63 61 6c 20 62  6f 75 6e 64 61 72 69 65
+   4.728786270810117e+164  3.2997464663149888e+180
+   4.728786270810117e+164  3.2997464663149888e+180
+  73 29 22 5d 2c 0a 5b 5b  5b 22 30 30 30 30 30 30
+  1.1995562572224261e+132   1.3980432860942024e-76
+  1.1995562572224261e+132   1.3980432860942024e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 31  30 30 22 2c 20 30 2c 20
+    9.162216479754085e-72  1.0511782037414344e-153
+    9.162216479754085e-72  1.0511782037414344e-153
+  22 35 30 30 30 30 30 30  30 31 20 43 48 45 43 4b
+   1.3980432860956773e-76   3.6915200620764685e+54
+   1.3980432860956773e-76   3.6915200620764685e+54
+  4c 4f 43 4b 54 49 4d 45  56 45 52 49 46 59 20 31
+    7.081027294368297e+25    4.626526274241862e-72
+    7.081027294368297e+25    4.626526274241862e-72
+  22 5d 5d 2c 0a 22 30 31  30 30 30 30 30 30 30 31
+    9.130936148260522e-72    9.162216479754085e-72
+    9.130936148260522e-72    9.162216479754085e-72
+  30 30 30 31 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432912428464e-76    1.398043286095289e-76
+   1.3980432912428464e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 31 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432912428464e-76    1.398043286095289e-76
+   1.3980432912428464e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  36 35 63 64 31 64 22 2c
+    1.398043286095289e-76    4.305124131125146e-96
+    1.398043286095289e-76    4.305124131125146e-96
+  20 22 50 32 53 48 2c 43  48 45 43 4b 4c 4f 43 4b
+         3980410755748112    3.699014735381107e+54
+         3980410755748112    3.699014735381107e+54
+  54 49 4d 45 56 45 52 49  46 59 22 5d 2c 0a 5b 5b
+    1.629814070817695e+45  1.1995562572243557e+132
+    1.629814070817695e+45  1.1995562572243557e+132
+  5b 22 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432860942024e-76    1.398043286095289e-76
+   1.3980432860942024e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 31
+    1.398043286095289e-76    9.162216479754085e-72
+    1.398043286095289e-76    9.162216479754085e-72
+  30 30 22 2c 20 30 2c 20  22 34 32 39 34 39 36 37
+  1.0511782037414344e-153    9.965341031585453e-43
+  1.0511782037414344e-153    9.965341031585453e-43
+  32 39 35 20 43 48 45 43  4b 4c 4f 43 4b 54 49 4d
+        11980855302582884   2.0839717424071816e+64
+        11980855302582884   2.0839717424071816e+64
+  45 56 45 52 49 46 59 20  31 22 5d 5d 2c 0a 22 30
+   7.540250107217763e-153     7.78971152971537e-77
+   7.540250107217763e-153     7.78971152971537e-77
+  31 30 30 30 30 30 30 30  31 30 30 30 31 30 30 30
+   1.3980432860952892e-76    1.398044603870032e-76
+   1.3980432860952892e-76    1.398044603870032e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 31 30 30 30
+    1.398043286095289e-76   1.3980446038700318e-76
+    1.398043286095289e-76   1.3980446038700318e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 66
+    1.398043286095289e-76   1.719637360272639e+184
+    1.398043286095289e-76   1.719637360272639e+184
+  65 66 66 66 66 66 66 22  2c 20 22 50 32 53 48 2c
+   5.740372650508986e-143   2.2776342793000827e-95
+   5.740372650508986e-143   2.2776342793000827e-95
+  43 48 45 43 4b 4c 4f 43  4b 54 49 4d 45 56 45 52
+        17619220825804934   2.1222766780592805e+88
+        17619220825804934   2.1222766780592805e+88
+  49 46 59 22 5d 2c 0a 0a  5b 22 41 72 67 75 6d 65
+  2.6598195754464224e-260  3.8199674891096606e+180
+  2.6598195754464224e-260  3.8199674891096606e+180
+  6e 74 20 6d 69 73 73 69  6e 67 22 5d 2c 0a 5b 5b
+   9.305403697475214e+199  1.1995562572249269e+132
+   9.305403697475214e+199  1.1995562572249269e+132
+  5b 22 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432860942024e-76    1.398043286095289e-76
+   1.3980432860942024e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 31
+    1.398043286095289e-76    9.162216479754085e-72
+    1.398043286095289e-76    9.162216479754085e-72
+  30 30 22 2c 20 30 2c 20  22 43 48 45 43 4b 4c 4f
+  1.0511782037414344e-153    9.998232480501168e+73
+  1.0511782037414344e-153    9.998232480501168e+73
+  43 4b 54 49 4d 45 56 45  52 49 46 59 20 31 22 5d
+   1.0769454800825815e+26   4.332774123520774e+140
+   1.0769454800825815e+26   4.332774123520774e+140
+  5d 2c 0a 22 30 31 30 30  30 30 30 30 30 31 30 30
+    1.398380563599275e-76   1.3983806364294722e-76
+    1.398380563599275e-76   1.3983806364294722e-76
+  30 31 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432860953674e-76    1.398043286095289e-76
+   1.3980432860953674e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 31 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432860953674e-76    1.398043286095289e-76
+   1.3980432860953674e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 22 2c 20 22
+    1.398043286095289e-76     2.5902785586997e-144
+    1.398043286095289e-76     2.5902785586997e-144
+  50 32 53 48 2c 43 48 45  43 4b 4c 4f 43 4b 54 49
+   5.8662870186814245e+25   1.8102849189569236e+45
+   5.8662870186814245e+25   1.8102849189569236e+45
+  4d 45 56 45 52 49 46 59  22 5d 2c 0a 5b 5b 5b 22
+  1.1509816729231713e+122  3.5053249760825546e-143
+  1.1509816729231713e+122  3.5053249760825546e-143
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 31 30 30
+    1.398043286095289e-76   1.3983806364294722e-76
+    1.398043286095289e-76   1.3983806364294722e-76
+  22 2c 20 30 2c 20 22 31  22 5d 5d 2c 0a 22 30 31
+    5.129384035710505e-72    9.130936148260522e-72
+    5.129384035710505e-72    9.130936148260522e-72
+  30 30 30 30 30 30 30 31  30 30 30 31 30 30 30 30
+    9.162216479754085e-72   1.3980432912428464e-76
+    9.162216479754085e-72   1.3980432912428464e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 31 62 31 30 31 30 30  30 30 30 30 30 31 30 30
+   1.3983806425824907e-76   1.3983806364294722e-76
+   1.3983806425824907e-76   1.3983806364294722e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  22 2c 20 22 50 32 53 48
+    1.398043286095289e-76    2.612896978874658e+40
+    1.398043286095289e-76    2.612896978874658e+40
+  2c 43 48 45 43 4b 4c 4f  43 4b 54 49 4d 45 56 45
+     9.99823248050118e+73   1.0769454800825815e+26
+     9.99823248050118e+73   1.0769454800825815e+26
+  52 49 46 59 22 5d 2c 0a  0a 5b 22 41 72 67 75 6d
+   1.152970637348911e-259    1.88892002626689e+219
+   1.152970637348911e-259    1.88892002626689e+219
+  65 6e 74 20 6e 65 67 61  74 69 76 65 20 77 69 74
+   1.644649052154376e+161  5.8343949639422814e+252
+   1.644649052154376e+161  5.8343949639422814e+252
+  68 20 62 79 2d 62 6c 6f  63 6b 68 65 69 67 68 74
+  5.3791390598980466e+228  5.5912194849652515e+252
+  5.3791390598980466e+228  5.5912194849652515e+252
+  20 6e 4c 6f 63 6b 54 69  6d 65 3d 30 22 5d 2c 0a
+  2.4422040819661664e+199  1.1529705379262443e-259
+  2.4422040819661664e+199  1.1529705379262443e-259
+  5b 5b 5b 22 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043214897502e-76    1.398043286095289e-76
+    1.398043214897502e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 31 30 30 22 2c 20 30  2c 20 22 2d 31 20 43 48
+    6.983377179561166e-77   1.3016311210642325e+40
+    6.983377179561166e-77   1.3016311210642325e+40
+  45 43 4b 4c 4f 43 4b 54  49 4d 45 56 45 52 49 46
+    1.164665247074938e+98    4.012331313890848e+30
+    1.164665247074938e+98    4.012331313890848e+30
+  59 20 31 22 5d 5d 2c 0a  22 30 31 30 30 30 30 30
+  1.1530070992334554e-259   1.3980432861153922e-76
+  1.1530070992334554e-259   1.3980432861153922e-76
+  30 30 31 30 30 30 31 30  30 30 30 30 30 30 30 30
+    1.484404971666341e-76    1.398043286095289e-76
+    1.484404971666341e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 31 30  30 30 30 30 30 30 30 30
+   1.4844049716462333e-76    1.398043286095289e-76
+   1.4844049716462333e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 22 2c 20 22 50 32 53  48 2c 43 48 45 43 4b 4c
+    5.968685125563565e+92   3.4226243599768038e+59
+    5.968685125563565e+92   3.4226243599768038e+59
+  4f 43 4b 54 49 4d 45 56  45 52 49 46 59 22 5d 2c
+   3.908470283878822e+107    5.455871076307772e-95
+   3.908470283878822e+107    5.455871076307772e-95
+  0a 0a 5b 22 41 72 67 75  6d 65 6e 74 20 6e 65 67
+  3.5204707927781287e+257   1.193529493283415e+190
+  3.5204707927781287e+257   1.193529493283415e+190
+  61 74 69 76 65 20 77 69  74 68 20 62 79 2d 62 6c
+  1.1063892674660173e+200  1.2238953230989472e+214
+  1.1063892674660173e+200  1.2238953230989472e+214
+  6f 63 6b 74 69 6d 65 20  6e 4c 6f 63 6b 54 69 6d
+   1.278502226401473e-152  1.1176813441525232e+219
+   1.278502226401473e-152  1.1176813441525232e+219
+  65 3d 35 30 30 2c 30 30  30 2c 30 30 30 22 5d 2c
+    1.396693884860131e-76    5.455753673439944e-95
+    1.396693884860131e-76    5.455753673439944e-95
+  0a 5b 5b 5b 22 30 30 30  30 30 30 30 30 30 30 30
+   1.3980250594618592e-76    1.398043286095289e-76
+   1.3980250594618592e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 31 30 30 22 2c 20  30 2c 20 22 2d 31 20 43
+  1.0491479271388595e-153         2278834771596824
+  1.0491479271388595e-153         2278834771596824
+  48 45 43 4b 4c 4f 43 4b  54 49 4d 45 56 45 52 49
+    3.699014735381107e+54    1.629814070817695e+45
+    3.699014735381107e+54    1.629814070817695e+45
+  46 59 20 31 22 5d 5d 2c  0a 22 30 31 30 30 30 30
+    5.498872883248109e-95   1.3980432912417352e-76
+    5.498872883248109e-95   1.3980432912417352e-76
+  30 30 30 31 30 30 30 31  30 30 30 30 30 30 30 30
+    9.162216513489118e-72    1.398043286095289e-76
+    9.162216513489118e-72    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 31  30 30 30 30 30 30 30 30
+    9.162216479754085e-72    1.398043286095289e-76
+    9.162216479754085e-72    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 36 35 63 64
+    1.398043286095289e-76  3.8005498036262656e+175
+    1.398043286095289e-76  3.8005498036262656e+175
+  31 64 22 2c 20 22 50 32  53 48 2c 43 48 45 43 4b
+   2.3936699298473564e-66   3.6915200626157174e+54
+   2.3936699298473564e-66   3.6915200626157174e+54
+  4c 4f 43 4b 54 49 4d 45  56 45 52 49 46 59 22 5d
+    7.081027294368297e+25   4.370126139089802e+140
+    7.081027294368297e+25   4.370126139089802e+140
+  2c 0a 5b 5b 5b 22 30 30  30 30 30 30 30 30 30 30
+   1.3933772679372857e-76    1.398043286095289e-76
+   1.3933772679372857e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 31 30 30 22 2c  20 30 2c 20 22 31 22 5d
+    4.257571569454917e-96   4.332780581284848e+140
+    4.257571569454917e-96   4.332780581284848e+140
+  5d 2c 0a 22 30 31 30 30  30 30 30 30 30 31 30 30
+    1.398380563599275e-76   1.3983806364294722e-76
+    1.398380563599275e-76   1.3983806364294722e-76
+  30 31 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432860953674e-76    1.398043286095289e-76
+   1.3980432860953674e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 34  30 30 35 31 39 34 62 31
+   2.5789346702567697e-57    8.242478048895006e-71
+   2.5789346702567697e-57    8.242478048895006e-71
+  30 31 30 30 30 30 30 30  30 31 30 30 30 30 30 30
+   1.3980432860953674e-76   1.3980432860953674e-76
+   1.3980432860953674e-76   1.3980432860953674e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 32 30 30
+    1.398043286095289e-76   1.3987179867636556e-76
+    1.398043286095289e-76   1.3987179867636556e-76
+  30 30 30 30 22 2c 20 22  50 32 53 48 2c 43 48 45
+     2.5902785586997e-144   5.8662870186814245e+25
+     2.5902785586997e-144   5.8662870186814245e+25
+  43 4b 4c 4f 43 4b 54 49  4d 45 56 45 52 49 46 59
+   1.8102849189569236e+45  1.1509816729231713e+122
+   1.8102849189569236e+45  1.1509816729231713e+122
+  22 5d 2c 0a 0a 5b 22 49  6e 70 75 74 20 6c 6f 63
+    2.046720239698203e+44   9.486947561553819e+170
+    2.046720239698203e+44   9.486947561553819e+170
+  6b 65 64 22 5d 2c 0a 5b  5b 5b 22 30 30 30 30 30
+  3.6284952469866086e+130   1.3980432858171725e-76
+  3.6284952469866086e+130   1.3980432858171725e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  31 30 30 22 2c 20 30 2c
+    1.398043286095289e-76    7.549518397495304e-96
+    1.398043286095289e-76    7.549518397495304e-96
+  20 22 30 20 43 48 45 43  4b 4c 4f 43 4b 54 49 4d
+        11980855301915712   2.0839717424071816e+64
+        11980855301915712   2.0839717424071816e+64
+  45 56 45 52 49 46 59 20  31 22 5d 5d 2c 0a 22 30
+   7.540250107217763e-153     7.78971152971537e-77
+   7.540250107217763e-153     7.78971152971537e-77
+  31 30 30 30 30 30 30 30  31 30 30 30 31 30 30 30
+   1.3980432860952892e-76    1.398044603870032e-76
+   1.3980432860952892e-76    1.398044603870032e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 66 66 66 66 66  66 66 66 30 31 30 30 30
+  1.9035985651826358e+185   1.3980446049601027e-76
+  1.9035985651826358e+185   1.3980446049601027e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 22  2c 20 22 50 32 53 48 2c
+     5.1856307557119e-144   2.2776342793000827e-95
+     5.1856307557119e-144   2.2776342793000827e-95
+  43 48 45 43 4b 4c 4f 43  4b 54 49 4d 45 56 45 52
+        17619220825804934   2.1222766780592805e+88
+        17619220825804934   2.1222766780592805e+88
+  49 46 59 22 5d 2c 0a 5b  5b 5b 22 30 30 30 30 30
+   3.628495246627624e+130   1.3980432858171725e-76
+   3.628495246627624e+130   1.3980432858171725e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  31 30 30 22 2c 20 30 2c
+    1.398043286095289e-76    7.549518397495304e-96
+    1.398043286095289e-76    7.549518397495304e-96
+  20 22 30 22 5d 5d 2c 0a  22 30 31 30 30 30 30 30
+  1.1530070992240567e-259   1.3980432861153922e-76
+  1.1530070992240567e-259   1.3980432861153922e-76
+  30 30 31 30 30 30 31 30  30 30 30 30 30 30 30 30
+    1.484404971666341e-76    1.398043286095289e-76
+    1.484404971666341e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 32 35 31 62
+    1.398043286095289e-76   9.909298633544062e+164
+    1.398043286095289e-76   9.909298633544062e+164
+  31 66 66 66 66 66 66 66  66 30 31 30 30 30 30 30
+  1.9035985662552772e+185    1.398043286115413e-76
+  1.9035985662552772e+185    1.398043286115413e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 32 30
+    1.398043286095289e-76   1.5707666571971778e-76
+    1.398043286095289e-76   1.5707666571971778e-76
+  30 30 30 30 30 22 2c 20  22 50 32 53 48 2c 43 48
+  1.0491479271301769e-153   1.3048453072224773e+40
+  1.0491479271301769e-153   1.3048453072224773e+40
+  45 43 4b 4c 4f 43 4b 54  49 4d 45 56 45 52 49 46
+    1.164665247074938e+98    4.012331313890848e+30
+    1.164665247074938e+98    4.012331313890848e+30
+  59 22 5d 2c 0a 0a 5b 22  41 6e 6f 74 68 65 72 20
+   3.464624686628588e-143  2.1952731065680808e-152
+   3.464624686628588e-143  2.1952731065680808e-152
+  69 6e 70 75 74 20 62 65  69 6e 67 20 75 6e 6c 6f
+   2.350541982995339e+180  5.3882298434665954e+228
+   2.350541982995339e+180  5.3882298434665954e+228
+  63 6b 65 64 20 69 73 6e  27 74 20 73 75 66 66 69
+  1.1226306150992536e+224   5.358208551772452e+199
+  1.1226306150992536e+224   5.358208551772452e+199
+  63 69 65 6e 74 3b 20 74  68 65 20 43 48 45 43 4b
+   2.324368574749253e+251    3.691520062085566e+54
+   2.324368574749253e+251    3.691520062085566e+54
+  4c 4f 43 4b 54 49 4d 45  56 45 52 49 46 59 2d 75
+    7.081027294368297e+25  2.7542009360750648e+256
+    7.081027294368297e+25  2.7542009360750648e+256
+  73 69 6e 67 20 69 6e 70  75 74 20 6d 75 73 74 20
+  3.7770468323634445e+233   2.440489677613769e-152
+  3.7770468323634445e+233   2.440489677613769e-152
+  62 65 20 75 6e 6c 6f 63  6b 65 64 22 5d 2c 0a 5b
+   9.487306910813919e+170  3.6284952469866086e+130
+   9.487306910813919e+170  3.6284952469866086e+130
+  5b 5b 22 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432858171725e-76    1.398043286095289e-76
+   1.3980432858171725e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  31 30 30 22 2c 20 30 2c  20 22 30 20 43 48 45 43
+    7.549518397495304e-96        11980855301915712
+    7.549518397495304e-96        11980855301915712
+  4b 4c 4f 43 4b 54 49 4d  45 56 45 52 49 46 59 20
+   2.0839717424071816e+64   7.540250107217763e-153
+   2.0839717424071816e+64   7.540250107217763e-153
+  31 22 5d 20 2c 0a 20 20  5b 22 30 30 30 30 30 30
+   5.981490747615595e-154   1.3980432860942024e-76
+   5.981490747615595e-154   1.3980432860942024e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 32  30 30 22 2c 20 31 2c 20
+    6.004550192171637e-67  1.0513238744588407e-153
+    6.004550192171637e-67  1.0513238744588407e-153
+  22 31 22 5d 5d 2c 0a 22  30 31 30 30 30 30 30 30
+  1.0480224142302544e-144   1.3980432860953674e-76
+  1.0480224142302544e-144   1.3980432860953674e-76
+  30 32 30 30 30 31 30 30  30 30 30 30 30 30 30 30
+   1.3983806364296293e-76    1.398043286095289e-76
+   1.3983806364296293e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 66 66 66 66
+    1.398043286095289e-76  1.9035982916549982e+185
+    1.398043286095289e-76  1.9035982916549982e+185
+  66 66 66 66 30 30 30 32  30 30 30 30 30 30 30 30
+    6.004551390717397e-67    1.398043286095289e-76
+    6.004551390717397e-67    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 31 30 30  30 30 30 30 30 30 30 30
+   1.3983806364294722e-76    1.398043286095289e-76
+   1.3983806364294722e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 31  30 30 30 30 30 30 30 30
+    9.162216479754085e-72    1.398043286095289e-76
+    9.162216479754085e-72    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 22 2c 20 22 50 32  53 48 2c 43 48 45 43 4b
+    2.393669929840339e-66   3.6915200626157174e+54
+    2.393669929840339e-66   3.6915200626157174e+54
+  4c 4f 43 4b 54 49 4d 45  56 45 52 49 46 59 22 5d
+    7.081027294368297e+25   4.370126139089802e+140
+    7.081027294368297e+25   4.370126139089802e+140
+  2c 0a 0a 5b 22 41 72 67  75 6d 65 6e 74 2f 74 78
+  2.0333192151259715e+190   1.706211322347541e+272
+  2.0333192151259715e+190   1.706211322347541e+272
+  20 68 65 69 67 68 74 2f  74 69 6d 65 20 6d 69 73
+    4.302867234143254e-80   8.888924111919649e+247
+    4.302867234143254e-80   8.888924111919649e+247
+  6d 61 74 63 68 2c 20 62  6f 74 68 20 76 65 72 73
+   4.656834405123929e+164  1.2862569185163394e+248
+   4.656834405123929e+164  1.2862569185163394e+248
+  69 6f 6e 73 22 5d 2c 0a  5b 5b 5b 22 30 30 30 30
+  1.1529707007240587e-259    1.398043214897502e-76
+  1.1529707007240587e-259    1.398043214897502e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 31 30 30 22 2c 20 30
+    1.398043286095289e-76    6.983377179561166e-77
+    1.398043286095289e-76    6.983377179561166e-77
+  2c 20 22 30 20 43 48 45  43 4b 4c 4f 43 4b 54 49
+    5.866242397856752e+25   1.8102849189569236e+45
+    5.866242397856752e+25   1.8102849189569236e+45
+  4d 45 56 45 52 49 46 59  20 31 22 5d 5d 2c 0a 22
+  1.1509816729231713e+122  1.0480224142302541e-144
+  1.1509816729231713e+122  1.0480224142302541e-144
+  30 31 30 30 30 30 30 30  30 31 30 30 30 31 30 30
+   1.3980432860953674e-76   1.3983806364295508e-76
+   1.3980432860953674e-76   1.3983806364295508e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 31 30 30
+    1.398043286095289e-76   1.3983806364294722e-76
+    1.398043286095289e-76   1.3983806364294722e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 36 35 63 64 31 64  22 2c 20 22 50 32 53 48
+   4.301604669846913e+174    2.612896978874658e+40
+   4.301604669846913e+174    2.612896978874658e+40
+  2c 43 48 45 43 4b 4c 4f  43 4b 54 49 4d 45 56 45
+     9.99823248050118e+73   1.0769454800825815e+26
+     9.99823248050118e+73   1.0769454800825815e+26
+  52 49 46 59 22 5d 2c 0a  5b 5b 5b 22 30 30 30 30
+   1.152970637348911e-259    1.398043214897502e-76
+   1.152970637348911e-259    1.398043214897502e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 31 30 30 22 2c 20 30
+    1.398043286095289e-76    6.983377179561166e-77
+    1.398043286095289e-76    6.983377179561166e-77
+  2c 20 22 30 22 5d 5d 2c  0a 22 30 31 30 30 30 30
+   5.4988728721636005e-95   1.3980432912417352e-76
+   5.4988728721636005e-95   1.3980432912417352e-76
+  30 30 30 31 30 30 30 31  30 30 30 30 30 30 30 30
+    9.162216513489118e-72    1.398043286095289e-76
+    9.162216513489118e-72    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 32 35 31
+    1.398043286095289e-76   1.1996537910187641e-71
+    1.398043286095289e-76   1.1996537910187641e-71
+  62 31 30 30 30 30 30 30  30 30 30 31 30 30 30 30
+   1.3980432860953827e-76   1.3980432912428464e-76
+   1.3980432860953827e-76   1.3980432912428464e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  36 35 63 64 31 64 22 2c  20 22 50 32 53 48 2c 43
+    4.305124131125146e-96         3980410755748112
+    4.305124131125146e-96         3980410755748112
+  48 45 43 4b 4c 4f 43 4b  54 49 4d 45 56 45 52 49
+    3.699014735381107e+54    1.629814070817695e+45
+    3.699014735381107e+54    1.629814070817695e+45
+  46 59 22 5d 2c 0a 5b 5b  5b 22 30 30 30 30 30 30
+  1.1995562572243557e+132   1.3980432860942024e-76
+  1.1995562572243557e+132   1.3980432860942024e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 31  30 30 22 2c 20 30 2c 20
+    9.162216479754085e-72  1.0511782037414344e-153
+    9.162216479754085e-72  1.0511782037414344e-153
+  22 34 39 39 39 39 39 39  39 39 20 43 48 45 43 4b
+    4.857875059724089e-33   3.6915200620778684e+54
+    4.857875059724089e-33   3.6915200620778684e+54
+  4c 4f 43 4b 54 49 4d 45  56 45 52 49 46 59 20 31
+    7.081027294368297e+25    4.626526274241862e-72
+    7.081027294368297e+25    4.626526274241862e-72
+  22 5d 5d 2c 0a 22 30 31  30 30 30 30 30 30 30 31
+    9.130936148260522e-72    9.162216479754085e-72
+    9.130936148260522e-72    9.162216479754085e-72
+  30 30 30 31 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432912428464e-76    1.398043286095289e-76
+   1.3980432912428464e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 31 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432912428464e-76    1.398043286095289e-76
+   1.3980432912428464e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  36 35 63 64 31 64 22 2c
+    1.398043286095289e-76    4.305124131125146e-96
+    1.398043286095289e-76    4.305124131125146e-96
+  20 22 50 32 53 48 2c 43  48 45 43 4b 4c 4f 43 4b
+         3980410755748112    3.699014735381107e+54
+         3980410755748112    3.699014735381107e+54
+  54 49 4d 45 56 45 52 49  46 59 22 5d 2c 0a 5b 5b
+    1.629814070817695e+45  1.1995562572243557e+132
+    1.629814070817695e+45  1.1995562572243557e+132
+  5b 22 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432860942024e-76    1.398043286095289e-76
+   1.3980432860942024e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 31
+    1.398043286095289e-76    9.162216479754085e-72
+    1.398043286095289e-76    9.162216479754085e-72
+  30 30 22 2c 20 30 2c 20  22 35 30 30 30 30 30 30
+  1.0511782037414344e-153   1.3980432860956773e-76
+  1.0511782037414344e-153   1.3980432860956773e-76
+  30 30 20 43 48 45 43 4b  4c 4f 43 4b 54 49 4d 45
+    3.691520062076294e+54    7.081027294368297e+25
+    3.691520062076294e+54    7.081027294368297e+25
+  56 45 52 49 46 59 20 31  22 5d 5d 2c 0a 22 30 31
+    4.626526274241862e-72    9.130936148260522e-72
+    4.626526274241862e-72    9.130936148260522e-72
+  30 30 30 30 30 30 30 31  30 30 30 31 30 30 30 30
+    9.162216479754085e-72   1.3980432912428464e-76
+    9.162216479754085e-72   1.3980432912428464e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 31 30 30 30 30
+    1.398043286095289e-76   1.3980432912428464e-76
+    1.398043286095289e-76   1.3980432912428464e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 22 2c  20 22 50 32 53 48 2c 43
+    4.257571555502434e-96         3980410755748112
+    4.257571555502434e-96         3980410755748112
+  48 45 43 4b 4c 4f 43 4b  54 49 4d 45 56 45 52 49
+    3.699014735381107e+54    1.629814070817695e+45
+    3.699014735381107e+54    1.629814070817695e+45
+  46 59 22 5d 2c 0a 5b 5b  5b 22 30 30 30 30 30 30
+  1.1995562572243557e+132   1.3980432860942024e-76
+  1.1995562572243557e+132   1.3980432860942024e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 31  30 30 22 2c 20 30 2c 20
+    9.162216479754085e-72  1.0511782037414344e-153
+    9.162216479754085e-72  1.0511782037414344e-153
+  22 35 30 30 30 30 30 30  30 30 20 43 48 45 43 4b
+   1.3980432860956773e-76    3.691520062076294e+54
+   1.3980432860956773e-76    3.691520062076294e+54
+  4c 4f 43 4b 54 49 4d 45  56 45 52 49 46 59 20 31
+    7.081027294368297e+25    4.626526274241862e-72
+    7.081027294368297e+25    4.626526274241862e-72
+  22 5d 5d 2c 0a 22 30 31  30 30 30 30 30 30 30 31
+    9.130936148260522e-72    9.162216479754085e-72
+    9.130936148260522e-72    9.162216479754085e-72
+  30 30 30 31 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432912428464e-76    1.398043286095289e-76
+   1.3980432912428464e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 31 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432912428464e-76    1.398043286095289e-76
+   1.3980432912428464e-76    1.398043286095289e-76
+  30 30 30 30 30 30 66 66  36 34 63 64 31 64 22 2c
+  1.8856023613222075e+185    4.305124131124933e-96
+  1.8856023613222075e+185    4.305124131124933e-96
+  20 22 50 32 53 48 2c 43  48 45 43 4b 4c 4f 43 4b
+         3980410755748112    3.699014735381107e+54
+         3980410755748112    3.699014735381107e+54
+  54 49 4d 45 56 45 52 49  46 59 22 5d 2c 0a 0a 5b
+    1.629814070817695e+45   3.609979819120071e+130
+    1.629814070817695e+45   3.609979819120071e+130
+  22 41 72 67 75 6d 65 6e  74 20 32 5e 33 32 20 77
+   6.196404673500948e+223   6.527945791452222e+265
+   6.196404673500948e+223   6.527945791452222e+265
+  69 74 68 20 6e 4c 6f 63  6b 54 69 6d 65 3d 32 5e
+   9.449565762000417e+170   5.694015945507453e+145
+   9.449565762000417e+170   5.694015945507453e+145
+  33 32 2d 31 22 5d 2c 0a  5b 5b 5b 22 30 30 30 30
+  1.1529705401958106e-259    1.398043214897502e-76
+  1.1529705401958106e-259    1.398043214897502e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 31 30 30 22 2c 20 30
+    1.398043286095289e-76    6.983377179561166e-77
+    1.398043286095289e-76    6.983377179561166e-77
+  2c 20 22 34 32 39 34 39  36 37 32 39 36 20 43 48
+   3.8948894579472946e-33   1.3016363622938303e+40
+   3.8948894579472946e-33   1.3016363622938303e+40
+  45 43 4b 4c 4f 43 4b 54  49 4d 45 56 45 52 49 46
+    1.164665247074938e+98    4.012331313890848e+30
+    1.164665247074938e+98    4.012331313890848e+30
+  59 20 31 22 5d 5d 2c 0a  22 30 31 30 30 30 30 30
+  1.1530070992334554e-259   1.3980432861153922e-76
+  1.1530070992334554e-259   1.3980432861153922e-76
+  30 30 31 30 30 30 31 30  30 30 30 30 30 30 30 30
+    1.484404971666341e-76    1.398043286095289e-76
+    1.484404971666341e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 31 30  30 30 30 30 30 30 30 30
+   1.4844049716462333e-76    1.398043286095289e-76
+   1.4844049716462333e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 66 66 66 66 66 66 66
+    1.398043286095289e-76   1.903598566255277e+185
+    1.398043286095289e-76   1.903598566255277e+185
+  66 22 2c 20 22 50 32 53  48 2c 43 48 45 43 4b 4c
+    5.968685125563628e+92   3.4226243599768038e+59
+    5.968685125563628e+92   3.4226243599768038e+59
+  4f 43 4b 54 49 4d 45 56  45 52 49 46 59 22 5d 2c
+   3.908470283878822e+107    5.455871076307772e-95
+   3.908470283878822e+107    5.455871076307772e-95
+  0a 0a 5b 22 53 61 6d 65  2c 20 62 75 74 20 77 69
+  3.8097966454571992e+180  1.1064002143903389e+200
+  3.8097966454571992e+180  1.1064002143903389e+200
+  74 68 20 6e 4c 6f 63 6b  54 69 6d 65 3d 32 5e 33
+   1.996669506238802e+209   2.9361206394550894e-61
+   1.996669506238802e+209   2.9361206394550894e-61
+  31 2d 31 22 5d 2c 0a 5b  5b 5b 22 30 30 30 30 30
+   3.628495245333335e+130   1.3980432858171725e-76
+   3.628495245333335e+130   1.3980432858171725e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  31 30 30 22 2c 20 30 2c
+    1.398043286095289e-76    7.549518397495304e-96
+    1.398043286095289e-76    7.549518397495304e-96
+  20 22 32 31 34 37 34 38  33 36 34 38 20 43 48 45
+    5.940842695510089e-38   5.8662425141670565e+25
+    5.940842695510089e-38   5.8662425141670565e+25
+  43 4b 4c 4f 43 4b 54 49  4d 45 56 45 52 49 46 59
+   1.8102849189569236e+45  1.1509816729231713e+122
+   1.8102849189569236e+45  1.1509816729231713e+122
+  20 31 22 5d 5d 2c 0a 22  30 31 30 30 30 30 30 30
+  1.0480224142302541e-144   1.3980432860953674e-76
+  1.0480224142302541e-144   1.3980432860953674e-76
+  30 31 30 30 30 31 30 30  30 30 30 30 30 30 30 30
+   1.3983806364295508e-76    1.398043286095289e-76
+   1.3983806364295508e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 31 30 30  30 30 30 30 30 30 30 30
+   1.3983806364294722e-76    1.398043286095289e-76
+   1.3983806364294722e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  66 66 66 66 66 66 37 66
+    1.398043286095289e-76    2.48572580638247e+184
+    1.398043286095289e-76    2.48572580638247e+184
+  22 2c 20 22 50 32 53 48  2c 43 48 45 43 4b 4c 4f
+    2.612896978874658e+40     9.99823248050118e+73
+    2.612896978874658e+40     9.99823248050118e+73
+  43 4b 54 49 4d 45 56 45  52 49 46 59 22 5d 2c 0a
+   1.0769454800825815e+26   1.152970637348911e-259
+   1.0769454800825815e+26   1.152970637348911e-259
+  0a 5b 22 36 20 62 79 74  65 20 6e 6f 6e 2d 6d 69
+  1.1631200073850951e+253   6.979345849178844e+199
+  1.1631200073850951e+253   6.979345849178844e+199
+  6e 69 6d 61 6c 6c 79 2d  65 6e 63 6f 64 65 64 20
+    1.248064788825758e-89  1.2169663452665393e-152
+    1.248064788825758e-89  1.2169663452665393e-152
+  61 72 67 75 6d 65 6e 74  73 20 61 72 65 20 69 6e
+   6.964111143842559e+252   7.266070749157998e+223
+   6.964111143842559e+252   7.266070749157998e+223
+  76 61 6c 69 64 20 65 76  65 6e 20 69 66 20 74 68
+  2.0789041003916916e+262  1.4692199517538164e+195
+  2.0789041003916916e+262  1.4692199517538164e+195
+  65 69 72 20 63 6f 6e 74  65 6e 74 73 20 61 72 65
+   6.973024681534533e+252   4.766600769344527e+180
+   6.973024681534533e+252   4.766600769344527e+180
+  20 76 61 6c 69 64 22 5d  2c 0a 5b 5b 5b 22 30 30
+   4.380487722809414e+140   1.3933772679372857e-76
+   4.380487722809414e+140   1.3933772679372857e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 31 30 30 22 2c
+    1.398043286095289e-76    4.257571569454917e-96
+    1.398043286095289e-76    4.257571569454917e-96
+  20 30 2c 20 22 30 78 30  36 20 30 78 30 30 30 30
+    3.342269182744139e-75   1.3980436567181804e-76
+    3.342269182744139e-75   1.3980436567181804e-76
+  30 30 30 30 30 30 30 30  20 43 48 45 43 4b 4c 4f
+    1.398043286095289e-76    9.998232480501165e+73
+    1.398043286095289e-76    9.998232480501165e+73
+  43 4b 54 49 4d 45 56 45  52 49 46 59 20 31 22 5d
+   1.0769454800825815e+26   4.332774123520774e+140
+   1.0769454800825815e+26   4.332774123520774e+140
+  5d 2c 0a 22 30 31 30 30  30 30 30 30 30 31 30 30
+    1.398380563599275e-76   1.3983806364294722e-76
+    1.398380563599275e-76   1.3983806364294722e-76
+  30 31 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432860953674e-76    1.398043286095289e-76
+   1.3980432860953674e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 31 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432860953674e-76    1.398043286095289e-76
+   1.3980432860953674e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 22 2c 20 22
+    1.398043286095289e-76     2.5902785586997e-144
+    1.398043286095289e-76     2.5902785586997e-144
+  50 32 53 48 2c 43 48 45  43 4b 4c 4f 43 4b 54 49
+   5.8662870186814245e+25   1.8102849189569236e+45
+   5.8662870186814245e+25   1.8102849189569236e+45
+  4d 45 56 45 52 49 46 59  22 5d 2c 0a 0a 5b 22 46
+  1.1509816729231713e+122    7.271410992253646e+29
+  1.1509816729231713e+122    7.271410992253646e+29
+  61 69 6c 75 72 65 20 64  75 65 20 74 6f 20 66 61
+  2.0276489794020277e+174  1.5554081057768753e+161
+  2.0276489794020277e+174  1.5554081057768753e+161
+  69 6c 69 6e 67 20 43 48  45 43 4b 4c 4f 43 4b 54
+   1.3016874626713884e+40    1.164665247074938e+98
+   1.3016874626713884e+40    1.164665247074938e+98
+  49 4d 45 56 45 52 49 46  59 20 69 6e 20 73 63 72
+    4.012331313890848e+30  1.0375277686542387e+243
+    4.012331313890848e+30  1.0375277686542387e+243
+  69 70 74 53 69 67 22 5d  2c 0a 5b 5b 5b 22 30 30
+   4.383278429661365e+140   1.3933772679372857e-76
+   4.383278429661365e+140   1.3933772679372857e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 31 30 30 22 2c
+    1.398043286095289e-76    4.257571569454917e-96
+    1.398043286095289e-76    4.257571569454917e-96
+  20 30 2c 20 22 31 22 5d  5d 2c 0a 22 30 31 30 30
+   4.332780581284848e+140    1.398380563599275e-76
+   4.332780581284848e+140    1.398380563599275e-76
+  30 30 30 30 30 31 30 30  30 31 30 30 30 30 30 30
+   1.3983806364294722e-76   1.3980432860953674e-76
+   1.3983806364294722e-76   1.3980432860953674e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 32
+    1.398043286095289e-76    6.004550192171637e-67
+    1.398043286095289e-76    6.004550192171637e-67
+  35 31 62 31 30 30 30 30  30 30 30 30 30 31 30 30
+    1.398043292248309e-76   1.3983806364294722e-76
+    1.398043292248309e-76   1.3983806364294722e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  22 2c 20 22 50 32 53 48
+    1.398043286095289e-76    2.612896978874658e+40
+    1.398043286095289e-76    2.612896978874658e+40
+  2c 43 48 45 43 4b 4c 4f  43 4b 54 49 4d 45 56 45
+     9.99823248050118e+73   1.0769454800825815e+26
+     9.99823248050118e+73   1.0769454800825815e+26
+  52 49 46 59 22 5d 2c 0a  0a 5b 22 46 61 69 6c 75
+   1.152970637348911e-259    4.26601738868841e+257
+   1.152970637348911e-259    4.26601738868841e+257
+  72 65 20 64 75 65 20 74  6f 20 66 61 69 6c 69 6e
+  2.3478635229432833e+251   7.351938130907588e+223
+  2.3478635229432833e+251   7.351938130907588e+223
+  67 20 43 48 45 43 4b 4c  4f 43 4b 54 49 4d 45 56
+   3.4226243599754474e+59   3.908470283878822e+107
+   3.4226243599754474e+59   3.908470283878822e+107
+  45 52 49 46 59 20 69 6e  20 72 65 64 65 65 6d 53
+   7.266017038891276e+223    7.664751258427249e+93
+   7.266017038891276e+223    7.664751258427249e+93
+  63 72 69 70 74 22 5d 2c  0a 5b 5b 5b 22 30 30 30
+    5.455948698160824e-95   1.3980250594618592e-76
+    5.455948698160824e-95   1.3980250594618592e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 31 30 30 22 2c 20
+    1.398043286095289e-76  1.0491479271388595e-153
+    1.398043286095289e-76  1.0491479271388595e-153
+  30 2c 20 22 48 41 53 48  31 36 30 20 30 78 31 34
+    2.620855731499427e+40    2.783049419442401e-57
+    2.620855731499427e+40    2.783049419442401e-57
+  20 30 78 63 35 62 39 33  30 36 34 31 35 39 62 33
+    6.170417950342669e-62   3.5439037233945985e-61
+    6.170417950342669e-62   3.5439037233945985e-61
+  62 32 64 36 61 62 35 30  36 61 34 31 62 31 66 35
+   1.8467838334526978e-76    1.853637877501637e-51
+   1.8467838334526978e-76    1.853637877501637e-51
+  30 34 36 33 37 37 31 62  39 38 38 20 45 51 55 41
+   9.913841585822159e+164        5588244.503431373
+   9.913841585822159e+164        5588244.503431373
+  4c 22 5d 5d 2c 0a 22 30  31 30 30 30 30 30 30 30
+    7.789711529715412e-77   1.3980432860952892e-76
+    7.789711529715412e-77   1.3980432860952892e-76
+  31 30 30 30 31 30 30 30  30 30 30 30 30 30 30 30
+    1.398044603870032e-76    1.398043286095289e-76
+    1.398044603870032e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 33 30 32 35 31 62
+    1.398043286095289e-76   9.909298633946297e+164
+    1.398043286095289e-76   9.909298633946297e+164
+  31 30 30 30 30 30 30 30  30 30 31 30 30 30 30 30
+   1.3980432860952892e-76   1.3980432861153965e-76
+   1.3980432860952892e-76   1.3980432861153965e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 22 2c 20  22 50 32 53 48 2c 43 48
+  1.0491479271301769e-153   1.3048453072224773e+40
+  1.0491479271301769e-153   1.3048453072224773e+40
+  45 43 4b 4c 4f 43 4b 54  49 4d 45 56 45 52 49 46
+    1.164665247074938e+98    4.012331313890848e+30
+    1.164665247074938e+98    4.012331313890848e+30
+  59 22 5d 2c 0a 0a 5b 22  41 20 74 72 61 6e 73 61
+   3.464624686628588e-143   2.731849333205817e+161
+   3.464624686628588e-143   2.731849333205817e+161
+  63 74 69 6f 6e 20 77 69  74 68 20 61 20 6e 6f 6e
+  1.1063958174198293e+200   9.088949399518578e+223
+  1.1063958174198293e+200   9.088949399518578e+223
+  2d 73 74 61 6e 64 61 72  64 20 44 45 52 20 73 69
+    9.27777354164382e+242   9.150126281834545e+199
+    9.27777354164382e+242   9.150126281834545e+199
+  67 6e 61 74 75 72 65 2e  22 5d 2c 0a 5b 5b 5b 22
+   3.4500064577673595e-85  3.5053249760825546e-143
+   3.4500064577673595e-85  3.5053249760825546e-143
+  62 31 64 62 63 38 31 36  39 36 63 38 61 39 63 30
+   1.1782584463024766e-47   1.3281832871396797e-75
+   1.1782584463024766e-47   1.3281832871396797e-75
+  66 63 63 64 30 36 39 33  61 62 36 36 64 37 63 33
+    6.128618919542437e-62   3.7369931841944224e-61
+    6.128618919542437e-62   3.7369931841944224e-61
+  36 38 64 62 63 33 38 63  30 64 65 66 34 65 38 30
+    9.13326654288373e+169   2.1068218883514345e-76
+    9.13326654288373e+169   2.1068218883514345e-76
+  30 36 38 35 35 36 30 64  64 64 31 62 32 31 33 32
+    4.00965848470409e+174    7.118773371162872e-67
+    4.00965848470409e+174    7.118773371162872e-67
+  22 2c 20 30 2c 20 22 44  55 50 20 48 41 53 48 31
+    1.671798370748492e+20   2.7535167423670866e-71
+    1.671798370748492e+20   2.7535167423670866e-71
+  36 30 20 30 78 31 34 20  30 78 34 62 33 62 64 37
+  1.5060806567872225e-153    7.312256651605324e-42
+  1.5060806567872225e-153    7.312256651605324e-42
+  65 62 61 33 62 63 30 32  38 34 66 64 33 30 30 37
+    6.078727594000511e-67    7.259077684798406e-43
+    6.078727594000511e-67    7.259077684798406e-43
+  62 65 37 66 33 62 65 32  37 35 65 39 34 66 35 38
+    6.345293499224522e-66    6.288669780832991e-38
+    6.345293499224522e-66    6.288669780832991e-38
+  32 36 20 45 51 55 41 4c  56 45 52 49 46 59 20 43
+    2.176054151177384e+59         2300879020040875
+    2.176054151177384e+59         2300879020040875
+  48 45 43 4b 53 49 47 22  5d 5d 2c 0a 22 30 31 30
+  1.4918835928118613e-143    1.484386327115762e-76
+  1.4918835928118613e-143    1.484386327115762e-76
+  30 30 30 30 30 30 31 33  32 32 31 31 62 64 64 30
+    4.178228548233055e-62   1.4088785116652563e-75
+    4.178228548233055e-62   1.4088785116652563e-75
+  64 35 36 38 35 30 36 38  30 34 65 65 66 30 64 38
+    6.520558872054951e-38   4.7464257693511584e-37
+    6.520558872054951e-38   4.7464257693511584e-37
+  63 63 33 64 62 36 38 63  33 64 37 36 36 61 62 39
+   9.137683437189017e+169    2.831846322645495e-32
+   9.137683437189017e+169    2.831846322645495e-32
+  33 30 36 63 64 66 63 63  30 61 39 63 38 39 36 31
+   5.857180412171547e+170   1.2578064677711405e-71
+   5.857180412171547e+170   1.2578064677711405e-71
+  36 63 38 64 62 62 31 30  30 30 30 30 30 30 30 36
+   1.5013386449304108e-76    1.107644006727337e-47
+   1.5013386449304108e-76    1.107644006727337e-47
+  63 34 39 33 30 34 35 30  32 32 31 30 30 63 37 62
+    1.831201130810716e-76   1.346792187128085e+165
+    1.831201130810716e-76   1.346792187128085e+165
+  62 30 66 61 65 61 30 35  32 32 65 37 34 66 66 32
+   1.7101991105444465e-52     6.64667019868867e-66
+   1.7101991105444465e-52     6.64667019868867e-66
+  32 30 63 32 30 63 30 32  32 64 32 63 62 36 30 33
+    6.078444582076495e-67    3.941025553964701e-62
+    6.078444582076495e-67    3.941025553964701e-62
+  33 66 38 64 31 36 37 66  62 38 39 65 37 35 61 35
+  2.4657222099112735e+184    1.437268909053157e-51
+  2.4657222099112735e+184    1.437268909053157e-51
+  30 65 32 33 37 61 33 35  66 64 36 64 32 30 32 32
+    2.023340155262725e-52    6.746403892090512e-67
+    2.023340155262725e-52    6.746403892090512e-67
+  30 33 30 36 34 37 31 33  34 39 31 62 31 66 38 61
+    4.184890369414872e-62  2.1439425217923408e+160
+    4.184890369414872e-62  2.1439425217923408e+160
+  64 35 66 37 39 65 36 32  33 64 30 32 31 39 61 64
+    8.306917138792786e-67   3.407897719034638e+175
+    8.306917138792786e-67   3.407897719034638e+175
+  33 32 35 31 30 62 66 61  61 31 30 30 39 61 62 33
+  1.5734633158621036e+161    3.574301397867479e-61
+  1.5734633158621036e+161    3.574301397867479e-61
+  30 63 62 65 65 37 37 62  35 39 33 31 37 64 36 65
+  1.3369413301441029e+165   3.629443031844029e+179
+  1.3369413301441029e+165   3.629443031844029e+179
+  33 30 30 30 31 32 31 30  32 33 37 61 66 31 33 65
+    1.485080990089344e-76  3.1109969280827267e+179
+    1.485080990089344e-76  3.1109969280827267e+179
+  62 32 64 38 34 65 34 35  34 35 61 66 32 38 37 62
+   2.1293716059176525e-52  1.3371214658512873e+165
+   2.1293716059176525e-52  1.3371214658512873e+165
+  39 31 39 63 32 32 38 32  30 31 39 63 39 36 39 31
+    8.974825377941418e-67   1.4269380563684948e-71
+    8.974825377941418e-67   1.4269380563684948e-71
+  63 63 35 30 39 65 37 38  65 31 39 36 61 39 64 38
+    6.875291272399559e-38    4.754672366365677e-37
+    6.875291272399559e-38    4.754672366365677e-37
+  32 37 34 65 64 31 62 65  30 66 66 66 66 66 66 66
+  2.3591212544784236e+180   1.903598566255277e+185
+  2.3591212544784236e+180   1.903598566255277e+185
+  66 30 31 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286115413e-76    1.398043286095289e-76
+    1.398043286115413e-76    1.398043286095289e-76
+  30 30 30 31 39 37 36 61  39 31 34 66 31 62 33 65
+  1.9520818967830314e+160  3.1418910167239415e+179
+  1.9520818967830314e+160  3.1418910167239415e+179
+  64 32 65 64 61 39 61 32  65 62 65 35 61 39 33 37
+     5.11103157560828e-66    8.620402306761158e-43
+     5.11103157560828e-66    8.620402306761158e-43
+  34 66 36 39 32 38 37 37  63 64 66 38 37 63 30 66
+   1.0411991232971712e-42   1.740811287999459e+184
+   1.0411991232971712e-42   1.740811287999459e+184
+  39 35 62 38 38 61 63 30  30 30 30 30 30 30 30 22
+   1.3389352748058315e-75     5.1856307557119e-144
+   1.3389352748058315e-75     5.1856307557119e-144
+  2c 20 22 50 32 53 48 2c  44 45 52 53 49 47 22 5d
+   2.2776342793000827e-95  4.3533908194235685e+140
+   2.2776342793000827e-95  4.3533908194235685e+140
+  2c 0a 0a 5b 22 43 48 45  43 4b 53 45 51 55 45 4e
+    5.866250394893773e+25    1.150287715341693e+69
+    5.866250394893773e+25    1.150287715341693e+69
+  43 45 56 45 52 49 46 59  20 74 65 73 74 73 22 5d
+  1.1509816729231695e+122   4.394483102039588e+140
+  1.1509816729231695e+122   4.394483102039588e+140
+  2c 0a 0a 5b 22 42 79 2d  68 65 69 67 68 74 20 6c
+   1.2399553576191174e-89   6.924324264905241e+212
+   1.2399553576191174e-89   6.924324264905241e+212
+  6f 63 6b 73 2c 20 77 69  74 68 20 61 72 67 75 6d
+  1.1063476494745487e+200  1.8889201945512208e+219
+  1.1063476494745487e+200  1.8889201945512208e+219
+  65 6e 74 20 6a 75 73 74  20 62 65 79 6f 6e 64 20
+   8.916390806041675e+252  1.2190740540502696e-152
+   8.916390806041675e+252  1.2190740540502696e-152
+  74 78 69 6e 2e 6e 53 65  71 75 65 6e 63 65 22 5d
+   1.259792666418641e+180   4.381396299828587e+140
+   1.259792666418641e+180   4.381396299828587e+140
+  2c 0a 5b 5b 5b 22 30 30  30 30 30 30 30 30 30 30
+   1.3933772679372857e-76    1.398043286095289e-76
+   1.3933772679372857e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 31 30 30 22 2c  20 30 2c 20 22 31 20 43
+    4.257571569454917e-96      2.2788111328932e+15
+    4.257571569454917e-96      2.2788111328932e+15
+  48 45 43 4b 53 45 51 55  45 4e 43 45 56 45 52 49
+   9.670547113841522e+102    1.629814070610404e+45
+   9.670547113841522e+102    1.629814070610404e+45
+  46 59 20 31 22 5d 5d 2c  0a 22 30 32 30 30 30 30
+    5.498872883248109e-95   1.3980432963892927e-76
+    5.498872883248109e-95   1.3980432963892927e-76
+  30 30 30 31 30 30 30 31  30 30 30 30 30 30 30 30
+    9.162216513489118e-72    1.398043286095289e-76
+    9.162216513489118e-72    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 31  30 30 30 30 30 30 30 30
+    9.162216479754085e-72    1.398043286095289e-76
+    9.162216479754085e-72    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 22 2c 20 22 50 32  53 48 2c 43 48 45 43 4b
+    2.393669929840339e-66   3.6915200626157174e+54
+    2.393669929840339e-66   3.6915200626157174e+54
+  53 45 51 55 45 4e 43 45  56 45 52 49 46 59 22 5d
+    4.667842826290812e+25   4.370126139089802e+140
+    4.667842826290812e+25   4.370126139089802e+140
+  2c 0a 5b 5b 5b 22 30 30  30 30 30 30 30 30 30 30
+   1.3933772679372857e-76    1.398043286095289e-76
+   1.3933772679372857e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 31 30 30 22 2c  20 30 2c 20 22 34 32 35
+    4.257571569454917e-96    1.900549291640188e-52
+    4.257571569454917e-96    1.900549291640188e-52
+  39 38 33 39 20 43 48 45  43 4b 53 45 51 55 45 4e
+    5.866242528522725e+25    1.150287715341693e+69
+    5.866242528522725e+25    1.150287715341693e+69
+  43 45 56 45 52 49 46 59  20 31 22 5d 5d 2c 0a 22
+  1.1509816729231695e+122  1.0480224142302541e-144
+  1.1509816729231695e+122  1.0480224142302541e-144
+  30 32 30 30 30 30 30 30  30 31 30 30 30 31 30 30
+    1.398043286095446e-76   1.3983806364295508e-76
+    1.398043286095446e-76   1.3983806364295508e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 66 65 66 66  34 30 30 30 30 31 30 30
+  1.9032663304094877e+185   1.3983806364294735e-76
+  1.9032663304094877e+185   1.3983806364294735e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  22 2c 20 22 50 32 53 48
+    1.398043286095289e-76    2.612896978874658e+40
+    1.398043286095289e-76    2.612896978874658e+40
+  2c 43 48 45 43 4b 53 45  51 55 45 4e 43 45 56 45
+    9.330003593224064e+25    1.076938115628028e+26
+    9.330003593224064e+25    1.076938115628028e+26
+  52 49 46 59 22 5d 2c 0a  0a 5b 22 42 79 2d 74 69
+   1.152970637348911e-259   9.653111545928755e+199
+   1.152970637348911e-259   9.653111545928755e+199
+  6d 65 20 6c 6f 63 6b 73  2c 20 77 69 74 68 20 61
+   9.574881566664404e+247   7.208817957830964e+159
+   9.574881566664404e+247   7.208817957830964e+159
+  72 67 75 6d 65 6e 74 20  6a 75 73 74 20 62 65 79
+  2.4381298143520567e-152   5.922716137431689e+276
+  2.4381298143520567e-152   5.922716137431689e+276
+  6f 6e 64 20 74 78 69 6e  2e 6e 53 65 71 75 65 6e
+   7.365540815168292e+223   6.205423831533372e+223
+   7.365540815168292e+223   6.205423831533372e+223
+  63 65 20 28 62 75 74 20  77 69 74 68 69 6e 20 6e
+  2.4413868826230176e-152   2.969741374591112e+222
+  2.4413868826230176e-152   2.969741374591112e+222
+  75 6d 65 72 69 63 61 6c  20 62 6f 75 6e 64 72 69
+  1.1707515778612395e+214   8.799002225452799e+199
+  1.1707515778612395e+214   8.799002225452799e+199
+  65 73 29 22 5d 2c 0a 5b  5b 5b 22 30 30 30 30 30
+  3.6284952450839615e+130   1.3980432858171725e-76
+  3.6284952450839615e+130   1.3980432858171725e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  31 30 30 22 2c 20 30 2c
+    1.398043286095289e-76    7.549518397495304e-96
+    1.398043286095289e-76    7.549518397495304e-96
+  20 22 34 31 39 34 33 30  35 20 43 48 45 43 4b 53
+   1.6584896092844255e-76   1.7771281712245175e+93
+   1.6584896092844255e-76   1.7771281712245175e+93
+  45 51 55 45 4e 43 45 56  45 52 49 46 59 20 31 22
+  3.9013169354942144e+107   5.486144045743075e-144
+  3.9013169354942144e+107   5.486144045743075e-144
+  5d 5d 2c 0a 22 30 32 30  30 30 30 30 30 30 31 30
+   1.5707480126667065e-76   1.4844049716462333e-76
+   1.5707480126667065e-76   1.4844049716462333e-76
+  30 30 31 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432861153965e-76    1.398043286095289e-76
+   1.3980432861153965e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 34 30 30
+    1.398043286095289e-76   1.3993926874320224e-76
+    1.398043286095289e-76   1.3993926874320224e-76
+  30 30 31 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432861153965e-76    1.398043286095289e-76
+   1.3980432861153965e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 22 2c 20
+    1.398043286095289e-76  1.0491479271301769e-153
+    1.398043286095289e-76  1.0491479271301769e-153
+  22 50 32 53 48 2c 43 48  45 43 4b 53 45 51 55 45
+   1.3048453072224773e+40   1.0308493089730253e+26
+   1.3048453072224773e+40   1.0308493089730253e+26
+  4e 43 45 56 45 52 49 46  59 22 5d 2c 0a 5b 5b 5b
+   4.0123313138894097e+30  1.2135697532664579e+132
+   4.0123313138894097e+30  1.2135697532664579e+132
+  22 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432860952846e-76    1.398043286095289e-76
+   1.3980432860952846e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 31 30
+    1.398043286095289e-76   1.4844049716462333e-76
+    1.398043286095289e-76   1.4844049716462333e-76
+  30 22 2c 20 30 2c 20 22  34 32 35 39 38 33 39 20
+  2.5903126210889466e-144  1.8795075812326188e-153
+  2.5903126210889466e-144  1.8795075812326188e-153
+  43 48 45 43 4b 53 45 51  55 45 4e 43 45 56 45 52
+   3.2365724542314233e+83   2.1222766188881694e+88
+   3.2365724542314233e+83   2.1222766188881694e+88
+  49 46 59 20 31 22 5d 5d  2c 0a 22 30 32 30 30 30
+   5.551004350505541e+141   1.3980459213602817e-76
+   5.551004350505541e+141   1.3980459213602817e-76
+  30 30 30 30 31 30 30 30  31 30 30 30 30 30 30 30
+   1.3980446038700318e-76   1.3980432860952892e-76
+   1.3980446038700318e-76   1.3980432860952892e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 66
+    1.398043286095289e-76   1.719637360272639e+184
+    1.398043286095289e-76   1.719637360272639e+184
+  65 66 66 34 30 30 30 30  31 30 30 30 30 30 30 30
+     1.39804330777559e-76   1.3980432860952892e-76
+     1.39804330777559e-76   1.3980432860952892e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 22 2c 20 22 50  32 53 48 2c 43 48 45 43
+   1.0494047973278671e+78        11980855707739748
+   1.0494047973278671e+78        11980855707739748
+  4b 53 45 51 55 45 4e 43  45 56 45 52 49 46 59 22
+        17040964078708374  3.2385127614160786e-143
+        17040964078708374  3.2385127614160786e-143
+  5d 2c 0a 0a 5b 22 41 72  67 75 6d 65 6e 74 20 6d
+   2.285022077724067e+242   4.537950366285632e+217
+   2.285022077724067e+242   4.537950366285632e+217
+  69 73 73 69 6e 67 22 5d  2c 0a 5b 5b 5b 22 30 30
+   4.383296912888183e+140   1.3933772679372857e-76
+   4.383296912888183e+140   1.3933772679372857e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 31 30 30 22 2c
+    1.398043286095289e-76    4.257571569454917e-96
+    1.398043286095289e-76    4.257571569454917e-96
+  20 30 2c 20 22 43 48 45  43 4b 53 45 51 55 45 4e
+    5.866249546536539e+25    1.150287715341693e+69
+    5.866249546536539e+25    1.150287715341693e+69
+  43 45 56 45 52 49 46 59  20 31 22 5d 5d 2c 0a 22
+  1.1509816729231695e+122  1.0480224142302541e-144
+  1.1509816729231695e+122  1.0480224142302541e-144
+  30 32 30 30 30 30 30 30  30 31 30 30 30 31 30 30
+    1.398043286095446e-76   1.3983806364295508e-76
+    1.398043286095446e-76   1.3983806364295508e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 31 30 30
+    1.398043286095289e-76   1.3983806364294722e-76
+    1.398043286095289e-76   1.3983806364294722e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  22 2c 20 22 50 32 53 48
+    1.398043286095289e-76    2.612896978874658e+40
+    1.398043286095289e-76    2.612896978874658e+40
+  2c 43 48 45 43 4b 53 45  51 55 45 4e 43 45 56 45
+    9.330003593224064e+25    1.076938115628028e+26
+    9.330003593224064e+25    1.076938115628028e+26
+  52 49 46 59 22 5d 2c 0a  0a 5b 22 41 72 67 75 6d
+   1.152970637348911e-259    1.88892002626689e+219
+   1.152970637348911e-259    1.88892002626689e+219
+  65 6e 74 20 6e 65 67 61  74 69 76 65 20 77 69 74
+   1.644649052154376e+161  5.8343949639422814e+252
+   1.644649052154376e+161  5.8343949639422814e+252
+  68 20 62 79 2d 62 6c 6f  63 6b 68 65 69 67 68 74
+  5.3791390598980466e+228  5.5912194849652515e+252
+  5.3791390598980466e+228  5.5912194849652515e+252
+  20 74 78 69 6e 2e 6e 53  65 71 75 65 6e 63 65 3d
+    7.869509260182576e+93    6.078949827556901e-13
+    7.869509260182576e+93    6.078949827556901e-13
+  30 22 5d 2c 0a 5b 5b 5b  22 30 30 30 30 30 30 30
+  1.2135697532664514e+132   1.3980432860952846e-76
+  1.2135697532664514e+132   1.3980432860952846e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 31 30  30 22 2c 20 30 2c 20 22
+   1.4844049716462333e-76  2.5903126210889466e-144
+   1.4844049716462333e-76  2.5903126210889466e-144
+  2d 31 20 43 48 45 43 4b  53 45 51 55 45 4e 43 45
+   3.6915200620764664e+54    4.667842826290812e+25
+   3.6915200620764664e+54    4.667842826290812e+25
+  56 45 52 49 46 59 20 31  22 5d 5d 2c 0a 22 30 32
+    4.626526274241862e-72    5.984050314124015e-67
+    4.626526274241862e-72    5.984050314124015e-67
+  30 30 30 30 30 30 30 31  30 30 30 31 30 30 30 30
+    9.162216479754085e-72   1.3980432912428464e-76
+    9.162216479754085e-72   1.3980432912428464e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 31 30 30 30 30
+    1.398043286095289e-76   1.3980432912428464e-76
+    1.398043286095289e-76   1.3980432912428464e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 22 2c  20 22 50 32 53 48 2c 43
+    4.257571555502434e-96         3980410755748112
+    4.257571555502434e-96         3980410755748112
+  48 45 43 4b 53 45 51 55  45 4e 43 45 56 45 52 49
+   9.670547113841522e+102    1.629814070610404e+45
+   9.670547113841522e+102    1.629814070610404e+45
+  46 59 22 5d 2c 0a 0a 5b  22 41 72 67 75 6d 65 6e
+   3.609979819120071e+130   6.196404673500948e+223
+   3.609979819120071e+130   6.196404673500948e+223
+  74 20 6e 65 67 61 74 69  76 65 20 77 69 74 68 20
+   9.750157489315686e+199  1.4591339256126619e-152
+   9.750157489315686e+199  1.4591339256126619e-152
+  62 79 2d 62 6c 6f 63 6b  74 69 6d 65 20 74 78 69
+  1.9967195976331998e+209  1.1698772227070006e+200
+  1.9967195976331998e+209  1.1698772227070006e+200
+  6e 2e 6e 53 65 71 75 65  6e 63 65 3d 43 54 78 49
+    5.56111654142569e+180    8.680931156974927e+45
+    5.56111654142569e+180    8.680931156974927e+45
+  6e 3a 3a 53 45 51 55 45  4e 43 45 5f 4c 4f 43 4b
+   1.0308493087812335e+26    3.699014963829596e+54
+   1.0308493087812335e+26    3.699014963829596e+54
+  54 49 4d 45 5f 54 59 50  45 5f 46 4c 41 47 22 5d
+   1.1731859355956758e+79   4.353361645842307e+140
+   1.1731859355956758e+79   4.353361645842307e+140
+  2c 0a 5b 5b 5b 22 30 30  30 30 30 30 30 30 30 30
+   1.3933772679372857e-76    1.398043286095289e-76
+   1.3933772679372857e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 31 30 30 22 2c  20 30 2c 20 22 2d 31 20
+    4.257571569454917e-96  1.2810671256788068e-153
+    4.257571569454917e-96  1.2810671256788068e-153
+  43 48 45 43 4b 53 45 51  55 45 4e 43 45 56 45 52
+   3.2365724542314233e+83   2.1222766188881694e+88
+   3.2365724542314233e+83   2.1222766188881694e+88
+  49 46 59 20 31 22 5d 5d  2c 0a 22 30 32 30 30 30
+   5.551004350505541e+141   1.3980459213602817e-76
+   5.551004350505541e+141   1.3980459213602817e-76
+  30 30 30 30 31 30 30 30  31 30 30 30 30 30 30 30
+   1.3980446038700318e-76   1.3980432860952892e-76
+   1.3980446038700318e-76   1.3980432860952892e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 34 30 30 30 30  31 30 30 30 30 30 30 30
+   1.3980433066855192e-76   1.3980432860952892e-76
+   1.3980433066855192e-76   1.3980432860952892e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 22 2c 20 22 50  32 53 48 2c 43 48 45 43
+   1.0494047973278671e+78        11980855707739748
+   1.0494047973278671e+78        11980855707739748
+  4b 53 45 51 55 45 4e 43  45 56 45 52 49 46 59 22
+        17040964078708374  3.2385127614160786e-143
+        17040964078708374  3.2385127614160786e-143
+  5d 2c 0a 0a 5b 22 41 72  67 75 6d 65 6e 74 2f 74
+   2.285022077724067e+242  4.5041563369908077e+251
+   2.285022077724067e+242  4.5041563369908077e+251
+  78 20 68 65 69 67 68 74  2f 74 69 6d 65 20 6d 69
+  5.5912194849496404e+252   6.967165928930545e+199
+  5.5912194849496404e+252   6.967165928930545e+199
+  73 6d 61 74 63 68 2c 20  62 6f 74 68 20 76 65 72
+  1.0593740492619706e-153  1.1448411069965126e+243
+  1.0593740492619706e-153  1.1448411069965126e+243
+  73 69 6f 6e 73 22 5d 2c  0a 5b 5b 5b 22 30 30 30
+     5.45594581862846e-95   1.3980250594618592e-76
+     5.45594581862846e-95   1.3980250594618592e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 31 30 30 22 2c 20
+    1.398043286095289e-76  1.0491479271388595e-153
+    1.398043286095289e-76  1.0491479271388595e-153
+  30 2c 20 22 30 20 43 48  45 43 4b 53 45 51 55 45
+   1.3016300379526122e+40   1.0308493089730253e+26
+   1.3016300379526122e+40   1.0308493089730253e+26
+  4e 43 45 56 45 52 49 46  59 20 31 22 5d 5d 2c 0a
+   4.0123313138894097e+30  1.1530070992334554e-259
+   4.0123313138894097e+30  1.1530070992334554e-259
+  22 30 32 30 30 30 30 30  30 30 31 30 30 30 31 30
+      1.3980432861355e-76    1.484404971666341e-76
+      1.3980432861355e-76    1.484404971666341e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 34 30 30 30 30 31 30
+    1.398043286095289e-76   1.4844049716465475e-76
+    1.398043286095289e-76   1.4844049716465475e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 22 2c 20 22 50 32 53
+    1.398043286095289e-76    5.968685125563565e+92
+    1.398043286095289e-76    5.968685125563565e+92
+  48 2c 43 48 45 43 4b 53  45 51 55 45 4e 43 45 56
+   1.7771281712252333e+93  3.9013169354942144e+107
+   1.7771281712252333e+93  3.9013169354942144e+107
+  45 52 49 46 59 22 5d 2c  0a 5b 5b 5b 22 30 30 30
+    5.455871076307772e-95   1.3980250594618592e-76
+    5.455871076307772e-95   1.3980250594618592e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 31 30 30 22 2c 20
+    1.398043286095289e-76  1.0491479271388595e-153
+    1.398043286095289e-76  1.0491479271388595e-153
+  30 2c 20 22 36 35 35 33  35 20 43 48 45 43 4b 53
+    5.155344520754979e-62   1.7771281712245175e+93
+    5.155344520754979e-62   1.7771281712245175e+93
+  45 51 55 45 4e 43 45 56  45 52 49 46 59 20 31 22
+  3.9013169354942144e+107   5.486144045743075e-144
+  3.9013169354942144e+107   5.486144045743075e-144
+  5d 5d 2c 0a 22 30 32 30  30 30 30 30 30 30 31 30
+   1.5707480126667065e-76   1.4844049716462333e-76
+   1.5707480126667065e-76   1.4844049716462333e-76
+  30 30 31 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432861153965e-76    1.398043286095289e-76
+   1.3980432861153965e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 34 30 30
+    1.398043286095289e-76   1.3993926874320224e-76
+    1.398043286095289e-76   1.3993926874320224e-76
+  30 30 31 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432861153965e-76    1.398043286095289e-76
+   1.3980432861153965e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 22 2c 20
+    1.398043286095289e-76  1.0491479271301769e-153
+    1.398043286095289e-76  1.0491479271301769e-153
+  22 50 32 53 48 2c 43 48  45 43 4b 53 45 51 55 45
+   1.3048453072224773e+40   1.0308493089730253e+26
+   1.3048453072224773e+40   1.0308493089730253e+26
+  4e 43 45 56 45 52 49 46  59 22 5d 2c 0a 5b 5b 5b
+   4.0123313138894097e+30  1.2135697532664579e+132
+   4.0123313138894097e+30  1.2135697532664579e+132
+  22 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432860952846e-76    1.398043286095289e-76
+   1.3980432860952846e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 31 30
+    1.398043286095289e-76   1.4844049716462333e-76
+    1.398043286095289e-76   1.4844049716462333e-76
+  30 22 2c 20 30 2c 20 22  34 31 39 34 33 30 34 20
+  2.5903126210889466e-144   1.505710807947578e-153
+  2.5903126210889466e-144   1.505710807947578e-153
+  43 48 45 43 4b 53 45 51  55 45 4e 43 45 56 45 52
+   3.2365724542314233e+83   2.1222766188881694e+88
+   3.2365724542314233e+83   2.1222766188881694e+88
+  49 46 59 20 31 22 5d 5d  2c 0a 22 30 32 30 30 30
+   5.551004350505541e+141   1.3980459213602817e-76
+   5.551004350505541e+141   1.3980459213602817e-76
+  30 30 30 30 31 30 30 30  31 30 30 30 30 30 30 30
+   1.3980446038700318e-76   1.3980432860952892e-76
+   1.3980446038700318e-76   1.3980432860952892e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  31 30 30 30 30 30 30 30
+    1.398043286095289e-76   1.3980432860952892e-76
+    1.398043286095289e-76   1.3980432860952892e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 22 2c 20 22 50  32 53 48 2c 43 48 45 43
+   1.0494047973278671e+78        11980855707739748
+   1.0494047973278671e+78        11980855707739748
+  4b 53 45 51 55 45 4e 43  45 56 45 52 49 46 59 22
+        17040964078708374  3.2385127614160786e-143
+        17040964078708374  3.2385127614160786e-143
+  5d 2c 0a 5b 5b 5b 22 30  30 30 30 30 30 30 30 30
+    7.926648032307966e-77    1.398043286095289e-76
+    7.926648032307966e-77    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 31 30 30 22  2c 20 30 2c 20 22 34 32
+   5.185635643610081e-144    7.467857286079477e-67
+   5.185635643610081e-144    7.467857286079477e-67
+  35 39 38 33 39 20 43 48  45 43 4b 53 45 51 55 45
+   1.3016394534282512e+40   1.0308493089730253e+26
+   1.3016394534282512e+40   1.0308493089730253e+26
+  4e 43 45 56 45 52 49 46  59 20 31 22 5d 5d 2c 0a
+   4.0123313138894097e+30  1.1530070992334554e-259
+   4.0123313138894097e+30  1.1530070992334554e-259
+  22 30 32 30 30 30 30 30  30 30 31 30 30 30 31 30
+      1.3980432861355e-76    1.484404971666341e-76
+      1.3980432861355e-76    1.484404971666341e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 31 30
+    1.398043286095289e-76   1.4844049716462333e-76
+    1.398043286095289e-76   1.4844049716462333e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 22 2c 20 22 50 32 53
+    1.398043286095289e-76    5.968685125563565e+92
+    1.398043286095289e-76    5.968685125563565e+92
+  48 2c 43 48 45 43 4b 53  45 51 55 45 4e 43 45 56
+   1.7771281712252333e+93  3.9013169354942144e+107
+   1.7771281712252333e+93  3.9013169354942144e+107
+  45 52 49 46 59 22 5d 2c  0a 0a 5b 22 36 20 62 79
+    5.455871076307772e-95   5.020463797334934e+276
+    5.455871076307772e-95   5.020463797334934e+276
+  74 65 20 6e 6f 6e 2d 6d  69 6e 69 6d 61 6c 6c 79
+   8.116665033407924e+217   7.872659588354844e+276
+   8.116665033407924e+217   7.872659588354844e+276
+  2d 65 6e 63 6f 64 65 64  20 61 72 67 75 6d 65 6e
+  4.2327777957272344e+175   6.196404673509363e+223
+  4.2327777957272344e+175   6.196404673509363e+223
+  74 73 20 61 72 65 20 69  6e 76 61 6c 69 64 20 65
+   2.451277023449938e+198   1.328512278676308e+179
+   2.451277023449938e+198   1.328512278676308e+179
+  76 65 6e 20 69 66 20 74  68 65 69 72 20 63 6f 6e
+    2.34839607905236e+251   9.076524036033558e+223
+    2.34839607905236e+251   9.076524036033558e+223
+  74 65 6e 74 73 20 61 72  65 20 76 61 6c 69 64 22
+   9.136119536639375e+242   5.230865889261102e-143
+   9.136119536639375e+242   5.230865889261102e-143
+  5d 2c 0a 5b 5b 5b 22 30  30 30 30 30 30 30 30 30
+    7.926648032307966e-77    1.398043286095289e-76
+    7.926648032307966e-77    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 31 30 30 22  2c 20 30 2c 20 22 30 78
+   5.185635643610081e-144   8.523135963328286e+270
+   5.185635643610081e-144   8.523135963328286e+270
+  30 36 20 30 78 30 30 30  30 30 30 30 30 30 30 30
+    1.398138165555527e-76    1.398043286095289e-76
+    1.398138165555527e-76    1.398043286095289e-76
+  30 20 43 48 45 43 4b 53  45 51 55 45 4e 43 45 56
+   1.7771281712245163e+93  3.9013169354942144e+107
+   1.7771281712245163e+93  3.9013169354942144e+107
+  45 52 49 46 59 20 31 22  5d 5d 2c 0a 22 30 32 30
+   5.486144045743075e-144   1.5707480126667065e-76
+   5.486144045743075e-144   1.5707480126667065e-76
+  30 30 30 30 30 30 31 30  30 30 31 30 30 30 30 30
+   1.4844049716462333e-76   1.3980432861153965e-76
+   1.4844049716462333e-76   1.3980432861153965e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 66 66 66 66 30 30 30  30 30 31 30 30 30 30 30
+     1.39811472498957e-76   1.3980432861153965e-76
+     1.39811472498957e-76   1.3980432861153965e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 22 2c 20  22 50 32 53 48 2c 43 48
+  1.0491479271301769e-153   1.3048453072224773e+40
+  1.0491479271301769e-153   1.3048453072224773e+40
+  45 43 4b 53 45 51 55 45  4e 43 45 56 45 52 49 46
+   1.0308493089730253e+26   4.0123313138894097e+30
+   1.0308493089730253e+26   4.0123313138894097e+30
+  59 22 5d 2c 0a 0a 5b 22  46 61 69 6c 75 72 65 20
+   3.464624686628588e-143  1.2796784889653148e-152
+   3.464624686628588e-143  1.2796784889653148e-152
+  64 75 65 20 74 6f 20 66  61 69 6c 69 6e 67 20 43
+    8.72944714937446e+183       2308661770073264.5
+    8.72944714937446e+183       2308661770073264.5
+  48 45 43 4b 53 45 51 55  45 4e 43 45 56 45 52 49
+   9.670547113841522e+102    1.629814070610404e+45
+   9.670547113841522e+102    1.629814070610404e+45
+  46 59 20 69 6e 20 73 63  72 69 70 74 53 69 67 22
+   1.154934231888908e+171   5.999568329725761e-143
+   1.154934231888908e+171   5.999568329725761e-143
+  5d 2c 0a 5b 5b 5b 22 30  30 30 30 30 30 30 30 30
+    7.926648032307966e-77    1.398043286095289e-76
+    7.926648032307966e-77    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 31 30 30 22  2c 20 30 2c 20 22 31 22
+   5.185635643610081e-144   5.488367541109363e-144
+   5.185635643610081e-144   5.488367541109363e-144
+  5d 5d 2c 0a 22 30 32 30  30 30 30 30 30 30 31 30
+   1.5707480126667065e-76   1.4844049716462333e-76
+   1.5707480126667065e-76   1.4844049716462333e-76
+  30 30 31 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432861153965e-76    1.398043286095289e-76
+   1.3980432861153965e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  32 35 31 62 32 30 30 30
+    1.398043286095289e-76    1.398046179043155e-76
+    1.398043286095289e-76    1.398046179043155e-76
+  30 30 30 30 30 30 31 30  30 30 30 30 30 30 30 30
+   1.4844049716462333e-76    1.398043286095289e-76
+   1.4844049716462333e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 22 2c 20 22 50 32 53  48 2c 43 48 45 43 4b 53
+    5.968685125563565e+92   1.7771281712252333e+93
+    5.968685125563565e+92   1.7771281712252333e+93
+  45 51 55 45 4e 43 45 56  45 52 49 46 59 22 5d 2c
+  3.9013169354942144e+107    5.455871076307772e-95
+  3.9013169354942144e+107    5.455871076307772e-95
+  0a 0a 5b 22 46 61 69 6c  75 72 65 20 64 75 65 20
+  1.7088272014133048e+214    1.28036196055304e-152
+  1.7088272014133048e+214    1.28036196055304e-152
+  74 6f 20 66 61 69 6c 69  6e 67 20 43 48 45 43 4b
+   6.796158250807008e+199    3.691520062085919e+54
+   6.796158250807008e+199    3.691520062085919e+54
+  53 45 51 55 45 4e 43 45  56 45 52 49 46 59 20 69
+    4.667842826290812e+25   2.444168528837441e+198
+    4.667842826290812e+25   2.444168528837441e+198
+  6e 20 72 65 64 65 65 6d  53 63 72 69 70 74 22 5d
+    9.44105954205456e+218   4.395398777588767e+140
+    9.44105954205456e+218   4.395398777588767e+140
+  2c 0a 5b 5b 5b 22 30 30  30 30 30 30 30 30 30 30
+   1.3933772679372857e-76    1.398043286095289e-76
+   1.3933772679372857e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 31 30 30 22 2c  20 30 2c 20 22 48 41 53
+    4.257571569454917e-96   1.1265148378945013e+93
+    4.257571569454917e-96   1.1265148378945013e+93
+  48 31 36 30 20 30 78 31  34 20 30 78 37 63 31 37
+    2.190386854601886e-70    7.796853868500601e-43
+    2.190386854601886e-70    7.796853868500601e-43
+  61 66 66 35 33 32 66 32  32 62 65 62 35 34 30 36
+    6.586391035609886e-66   1.1087185376181636e-47
+    6.586391035609886e-66   1.1087185376181636e-47
+  39 39 34 32 66 39 62 66  35 36 37 61 36 36 31 33
+   1.548731730414793e+185    4.183948854480172e-62
+   1.548731730414793e+185    4.183948854480172e-62
+  33 65 61 66 20 45 51 55  41 4c 22 5d 5d 2c 0a 22
+   9.670112277533088e+102  1.0480224142312421e-144
+   9.670112277533088e+102  1.0480224142312421e-144
+  30 32 30 30 30 30 30 30  30 31 30 30 30 31 30 30
+    1.398043286095446e-76   1.3983806364295508e-76
+    1.398043286095446e-76   1.3983806364295508e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 33 30 32 35 31  62 32 30 30 30 30 30 30
+   1.1996538011392741e-71   1.3980432860954613e-76
+   1.1996538011392741e-71   1.3980432860954613e-76
+  30 30 30 31 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432912428464e-76    1.398043286095289e-76
+   1.3980432912428464e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 22 2c
+    1.398043286095289e-76    4.257571555502434e-96
+    1.398043286095289e-76    4.257571555502434e-96
+  20 22 50 32 53 48 2c 43  48 45 43 4b 53 45 51 55
+         3980410755748112   9.670547113841522e+102
+         3980410755748112   9.670547113841522e+102
+  45 4e 43 45 56 45 52 49  46 59 22 5d 2c 0a 0a 5b
+    1.629814070610404e+45   3.609979819120071e+130
+    1.629814070610404e+45   3.609979819120071e+130
+  22 46 61 69 6c 75 72 65  20 64 75 65 20 74 6f 20
+   4.787162673863113e+180   1.876734481460373e-152
+   4.787162673863113e+180   1.876734481460373e-152
+  69 6e 73 75 66 66 69 63  69 65 6e 74 20 74 78 2e
+   7.668691918088241e+170    7.867276147440814e-85
+   7.668691918088241e+170    7.867276147440814e-85
+  6e 56 65 72 73 69 6f 6e  20 28 3c 32 29 22 5d 2c
+    9.08366790857147e+223   5.4557336940070955e-95
+    9.08366790857147e+223   5.4557336940070955e-95
+  0a 5b 5b 5b 22 30 30 30  30 30 30 30 30 30 30 30
+   1.3980250594618592e-76    1.398043286095289e-76
+   1.3980250594618592e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 31 30 30 22 2c 20  30 2c 20 22 30 20 43 48
+  1.0491479271388595e-153   1.3016300379526122e+40
+  1.0491479271388595e-153   1.3016300379526122e+40
+  45 43 4b 53 45 51 55 45  4e 43 45 56 45 52 49 46
+   1.0308493089730253e+26   4.0123313138894097e+30
+   1.0308493089730253e+26   4.0123313138894097e+30
+  59 20 31 22 5d 5d 2c 0a  22 30 31 30 30 30 30 30
+  1.1530070992334554e-259   1.3980432861153922e-76
+  1.1530070992334554e-259   1.3980432861153922e-76
+  30 30 31 30 30 30 31 30  30 30 30 30 30 30 30 30
+    1.484404971666341e-76    1.398043286095289e-76
+    1.484404971666341e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 31 30  30 30 30 30 30 30 30 30
+   1.4844049716462333e-76    1.398043286095289e-76
+   1.4844049716462333e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 22 2c 20 22 50 32 53  48 2c 43 48 45 43 4b 53
+    5.968685125563565e+92   1.7771281712252333e+93
+    5.968685125563565e+92   1.7771281712252333e+93
+  45 51 55 45 4e 43 45 56  45 52 49 46 59 22 5d 2c
+  3.9013169354942144e+107    5.455871076307772e-95
+  3.9013169354942144e+107    5.455871076307772e-95
+  0a 5b 5b 5b 22 30 30 30  30 30 30 30 30 30 30 30
+   1.3980250594618592e-76    1.398043286095289e-76
+   1.3980250594618592e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 31 30 30 22 2c 20  30 2c 20 22 34 31 39 34
+  1.0491479271388595e-153   4.0133492817331335e-57
+  1.0491479271388595e-153   4.0133492817331335e-57
+  33 30 34 20 43 48 45 43  4b 53 45 51 55 45 4e 43
+        11980855302447206        17040964078708374
+        11980855302447206        17040964078708374
+  45 56 45 52 49 46 59 20  31 22 5d 5d 2c 0a 22 30
+   7.540250107217763e-153     7.78971152971537e-77
+   7.540250107217763e-153     7.78971152971537e-77
+  31 30 30 30 30 30 30 30  31 30 30 30 31 30 30 30
+   1.3980432860952892e-76    1.398044603870032e-76
+   1.3980432860952892e-76    1.398044603870032e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 34  30 30 30 30 31 30 30 30
+   2.5789346702567697e-57   1.3980446038700318e-76
+   2.5789346702567697e-57   1.3980446038700318e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 22  2c 20 22 50 32 53 48 2c
+     5.1856307557119e-144   2.2776342793000827e-95
+     5.1856307557119e-144   2.2776342793000827e-95
+  43 48 45 43 4b 53 45 51  55 45 4e 43 45 56 45 52
+   3.2365724542314233e+83   2.1222766188881694e+88
+   3.2365724542314233e+83   2.1222766188881694e+88
+  49 46 59 22 5d 2c 0a 0a  5b 22 4d 61 6b 65 20 64
+  2.6598195754464224e-260   2.027635622212561e+174
+  2.6598195754464224e-260   2.027635622212561e+174
+  69 66 66 73 20 63 6c 65  61 6e 65 72 20 62 79 20
+  3.6810370648483824e+180   3.029077711426251e-152
+  3.6810370648483824e+180   3.029077711426251e-152
+  6c 65 61 76 69 6e 67 20  61 20 63 6f 6d 6d 65 6e
+  1.3980687582225398e-152   6.196369510199211e+223
+  1.3980687582225398e-152   6.196369510199211e+223
+  74 20 68 65 72 65 20 77  69 74 68 6f 75 74 20 63
+   6.608629884684764e+265   3.105011907747297e+169
+   6.608629884684764e+265   3.105011907747297e+169
+  6f 6d 6d 61 20 61 74 20  74 68 65 20 65 6e 64 22
+  2.4319441859386317e-152   5.235842730917385e-143
+  2.4319441859386317e-152   5.235842730917385e-143
+  5d 0a 5d 0a
+          8.59030264e-316
+          8.59030264e-316
+};};
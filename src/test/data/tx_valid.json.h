@@ -0,0 +1,8559 @@
+namespace json_tests{
+static unsigned const char tx_valid[] = {
+  5b 0a 5b 22 54 68 65 20  66 6f 6c 6c 6f 77 69 6e
+  1.2773174495275057e-152   7.364390457482061e+223
+  1.2773174495275057e-152   7.364390457482061e+223
+  67 20 61 72 65 20 64 65  73 65 72 69 61 6c 69 7a
+  2.6098570027529237e+180   4.614864288793235e+281
+  2.6098570027529237e+180   4.614864288793235e+281
+  65 64 20 74 72 61 6e 73  61 63 74 69 6f 6e 73 20
+  1.0620954503183082e+248  2.3188145430129914e-152
+  1.0620954503183082e+248  2.3188145430129914e-152
+  77 68 69 63 68 20 61 72  65 20 76 61 6c 69 64 2e
+   9.136029459168516e+242   3.2834677351055854e-85
+   9.136029459168516e+242   3.2834677351055854e-85
+  22 5d 2c 0a 5b 22 54 68  65 79 20 61 72 65 20 69
+   3.674443977582139e+194  2.4512770234507456e+198
+   3.674443977582139e+194  2.4512770234507456e+198
+  6e 20 74 68 65 20 66 6f  72 6d 22 5d 2c 0a 5b 22
+   4.193342907978849e+228  3.4646915345221455e-143
+   4.193342907978849e+228  3.4646915345221455e-143
+  5b 5b 5b 70 72 65 76 6f  75 74 20 68 61 73 68 2c
+   8.488922348552723e+228    9.157623018413848e-95
+   8.488922348552723e+228    9.157623018413848e-95
+  20 70 72 65 76 6f 75 74  20 69 6e 64 65 78 2c 20
+   9.822181929830525e+252  1.0617058833415382e-153
+   9.822181929830525e+252  1.0617058833415382e-153
+  70 72 65 76 6f 75 74 20  73 63 72 69 70 74 50 75
+   2.441411110833726e-152   1.235349902385333e+257
+   2.441411110833726e-152   1.235349902385333e+257
+  62 4b 65 79 5d 2c 20 5b  69 6e 70 75 74 20 32 5d
+    8.96864447541425e+130    8.63452756994262e+140
+    8.96864447541425e+130    8.63452756994262e+140
+  2c 20 2e 2e 2e 5d 2c 22  5d 2c 0a 5b 22 73 65 72
+   4.542964535689289e-144  1.1442175659226127e+243
+   4.542964535689289e-144  1.1442175659226127e+243
+  69 61 6c 69 7a 65 64 54  72 61 6e 73 61 63 74 69
+   3.4853155255886734e+98   9.753851640481545e+199
+   3.4853155255886734e+98   9.753851640481545e+199
+  6f 6e 2c 20 76 65 72 69  66 79 46 6c 61 67 73 5d
+   8.800926969115483e+199  1.4788544709255646e+142
+   8.800926969115483e+199  1.4788544709255646e+142
+  22 5d 2c 0a 5b 22 4f 62  6a 65 63 74 73 20 74 68
+   3.585794286414837e+165  1.4692344811562377e+195
+   3.585794286414837e+165  1.4692344811562377e+195
+  61 74 20 61 72 65 20 6f  6e 6c 79 20 61 20 73 69
+   1.942101743813838e+227   9.150234731281609e+199
+   1.942101743813838e+227   9.150234731281609e+199
+  6e 67 6c 65 20 73 74 72  69 6e 67 20 28 6c 69 6b
+  2.1817437110839462e+243  2.6118308215611134e+209
+  2.1817437110839462e+243  2.6118308215611134e+209
+  65 20 74 68 69 73 20 6f  6e 65 29 20 61 72 65 20
+   1.948563139479133e+227  1.2796600089492972e-152
+   1.948563139479133e+227  1.2796600089492972e-152
+  69 67 6e 6f 72 65 64 22  5d 2c 0a 0a 5b 22 54 68
+  5.2268853983667705e-143   3.674443976129349e+194
+  5.2268853983667705e-143   3.674443976129349e+194
+  65 20 66 6f 6c 6c 6f 77  69 6e 67 20 69 73 20 32
+  2.0264744666635615e+267    3.050974665748631e-67
+  2.0264744666635615e+267    3.050974665748631e-67
+  33 62 33 39 37 65 64 63  63 64 33 37 34 30 61 37
+   6.157709976937187e+170    6.165999062088705e-42
+   6.157709976937187e+170    6.165999062088705e-42
+  34 61 64 62 36 30 33 63  39 37 35 36 33 37 30 66
+   7.241603580835876e+169  1.7225469219987074e+184
+   7.241603580835876e+169  1.7225469219987074e+184
+  61 66 63 64 65 39 62 63  63 34 34 38 33 65 62 32
+   5.502196699648328e+170    5.458560590009152e-66
+   5.502196699648328e+170    5.458560590009152e-66
+  37 31 65 63 61 64 30 39  61 39 34 64 64 36 33 22
+   3.1570057478541603e-33   6.154393616867498e-144
+   3.1570057478541603e-33   6.154393616867498e-144
+  5d 2c 0a 5b 22 49 74 20  69 73 20 6f 66 20 70 61
+  2.4207602711750723e-152  2.2672505259358665e+161
+  2.4207602711750723e-152  2.2672505259358665e+161
+  72 74 69 63 75 6c 61 72  20 69 6e 74 65 72 65 73
+    9.29450061761395e+242   7.497736565345796e+247
+    9.29450061761395e+242   7.497736565345796e+247
+  74 20 62 65 63 61 75 73  65 20 69 74 20 63 6f 6e
+  1.4949020447820293e+248   9.076524070488234e+223
+  1.4949020447820293e+248   9.076524070488234e+223
+  74 61 69 6e 73 20 61 6e  20 69 6e 76 61 6c 69 64
+   4.952700221099655e+223   5.030376296178568e+175
+   4.952700221099655e+223   5.030376296178568e+175
+  6c 79 2d 65 6e 63 6f 64  65 64 20 73 69 67 6e 61
+   6.210645101433959e+175  2.1372619155117315e+161
+   6.210645101433959e+175  2.1372619155117315e+161
+  74 75 72 65 20 77 68 69  63 68 20 4f 70 65 6e 53
+    5.85218927733155e+199    7.925535297283305e+93
+    5.85218927733155e+199    7.925535297283305e+93
+  53 4c 20 61 63 63 65 70  74 73 22 5d 2c 0a 5b 22
+  2.6564497637741066e+233  3.4646915345228457e-143
+  2.6564497637741066e+233  3.4646915345228457e-143
+  53 65 65 20 68 74 74 70  3a 2f 2f 72 36 2e 63 61
+   5.081010130756173e+233  1.3483046606053328e+161
+   5.081010130756173e+233  1.3483046606053328e+161
+  2f 62 6c 6f 67 2f 32 30  31 31 31 31 31 39 54 32
+    1.570502109980368e-76    3.000511404925933e-66
+    1.570502109980368e-76    3.000511404925933e-66
+  31 31 35 30 34 5a 2e 68  74 6d 6c 22 5d 2c 0a 5b
+  6.9240417384319216e+193  3.6284952472458467e+130
+  6.9240417384319216e+193  3.6284952472458467e+130
+  22 49 74 20 69 73 20 61  6c 73 6f 20 74 68 65 20
+    7.22762049650208e+159  1.2773465768417053e-152
+    7.22762049650208e+159  1.2773465768417053e-152
+  66 69 72 73 74 20 4f 50  5f 43 48 45 43 4b 4d 55
+    7.208469057112689e+78   8.201383970977714e+102
+    7.208469057112689e+78   8.201383970977714e+102
+  4c 54 49 53 49 47 20 74  72 61 6e 73 61 63 74 69
+  2.3309866325486153e+251   9.753851640481545e+199
+  2.3309866325486153e+251   9.753851640481545e+199
+  6f 6e 20 69 6e 20 73 74  61 6e 64 61 72 64 20 66
+   8.764276581482249e+252   8.706610662362312e+183
+   8.764276581482249e+252   8.706610662362312e+183
+  6f 72 6d 22 5d 2c 0a 5b  5b 5b 22 36 30 61 32 30
+   3.628495247278753e+130   1.5872968541793923e-76
+   3.628495247278753e+130   1.5872968541793923e-76
+  62 64 39 33 61 61 34 39  61 62 34 62 32 38 64 35
+   3.9251202234784334e-33   1.6888130088975745e-51
+   3.9251202234784334e-33   1.6888130088975745e-51
+  31 34 65 63 31 30 62 30  36 65 31 38 32 39 63 65
+    1.256614590850702e-75  2.4927465972495754e+180
+    1.256614590850702e-75  2.4927465972495754e+180
+  36 38 31 38 65 63 30 36  63 64 33 61 61 62 64 30
+   1.1213304739736484e-47    1.408337894612306e-75
+   1.1213304739736484e-47    1.408337894612306e-75
+  31 33 65 62 63 64 63 34  62 62 31 22 2c 20 30 2c
+    2.471477099134859e-56    7.549518397625679e-96
+    2.471477099134859e-56    7.549518397625679e-96
+  20 22 31 20 30 78 34 31  20 30 78 30 34 63 63 37
+   1.1585317568632268e-71    6.954929953574851e-42
+   1.1585317568632268e-71    6.954929953574851e-42
+  31 65 62 33 30 64 36 35  33 63 30 63 33 31 36 33
+   2.3377671138378417e-52    5.394622643038028e-62
+   2.3377671138378417e-52    5.394622643038028e-62
+  39 39 30 63 34 37 62 39  37 36 66 33 66 62 33 66
+    2.806564203150607e-32  2.0591552829822764e+184
+    2.806564203150607e-32  2.0591552829822764e+184
+  33 37 63 63 63 64 63 62  65 64 62 31 36 39 61 31
+    8.93374188527455e+165    7.798516809515043e-71
+    8.93374188527455e+165    7.798516809515043e-71
+  64 66 65 66 35 38 62 62  66 62 66 61 66 66 37 64
+   8.393548953112253e+165   5.787531320759542e+174
+   8.393548953112253e+165   5.787531320759542e+174
+  38 61 34 37 33 65 37 65  32 65 36 64 33 31 37 62
+   3.792156814376856e+179  1.3355477172784778e+165
+   3.792156814376856e+179  1.3355477172784778e+165
+  38 37 62 61 66 65 38 62  64 65 39 37 65 33 63 66
+  1.4048757934039075e+165  1.6317207704977766e+185
+  1.4048757934039075e+165  1.6317207704977766e+185
+  38 66 30 36 35 64 65 63  30 32 32 62 35 31 64 31
+   6.458438339692953e+170    9.142713581175919e-71
+   6.458438339692953e+170    9.142713581175919e-71
+  31 66 63 64 64 30 64 33  34 38 61 63 34 20 30 78
+    3.926145428926544e-61   8.519171622923192e+270
+    3.926145428926544e-61   8.519171622923192e+270
+  34 31 20 30 78 30 34 36  31 63 62 64 63 63 35 34
+   1.3814102842934177e-47    3.407342473504092e-57
+   1.3814102842934177e-47    3.407342473504092e-57
+  30 39 66 62 34 62 34 64  34 32 62 35 31 64 33 33
+   5.041486895428741e+174    4.713782353575836e-62
+   5.041486895428741e+174    4.713782353575836e-62
+  33 38 31 33 35 34 64 38  30 65 35 35 30 30 37 38
+    4.749922706823351e-37    6.814409986380753e-38
+    4.749922706823351e-37    6.814409986380753e-38
+  63 62 35 33 32 61 33 34  62 66 61 32 66 63 66 64
+    3.087359908868148e-57  4.4298414583849814e+175
+    3.087359908868148e-57  4.4298414583849814e+175
+  65 62 37 64 37 36 35 31  39 61 65 63 63 36 32 37
+   1.2005443555137968e-71    8.166746842962603e-43
+   1.2005443555137968e-71    8.166746842962603e-43
+  37 30 66 35 62 30 65 34  65 66 38 35 35 31 39 34
+   2.7004817748567645e-56    4.013351893912907e-57
+   2.7004817748567645e-56    4.013351893912907e-57
+  36 64 38 61 35 34 30 39  31 31 61 62 65 33 65 37
+    3.120765232050498e-33    7.605401725490936e-42
+    3.120765232050498e-33    7.605401725490936e-42
+  38 35 34 61 32 36 66 33  39 66 35 38 62 32 35 63
+   4.3194933511542485e-61   7.999596903869448e+169
+   4.3194933511542485e-61   7.999596903869448e+169
+  31 35 33 34 32 61 66 20  32 20 4f 50 5f 43 48 45
+  1.3353217717767953e-152    5.866475290533963e+25
+  1.3353217717767953e-152    5.866475290533963e+25
+  43 4b 4d 55 4c 54 49 53  49 47 22 5d 5d 2c 0a 22
+   1.6510935833778456e+93  1.0480224142310612e-144
+   1.6510935833778456e+93  1.0480224142310612e-144
+  30 31 30 30 30 30 30 30  30 31 62 31 34 62 64 63
+   1.3980432860953674e-76    6.15415792582593e+170
+   1.3980432860953674e-76    6.15415792582593e+170
+  62 63 33 65 30 31 62 64  61 61 64 33 36 63 63 30
+   3.599576362619675e+175   1.3394729063456528e-75
+   3.599576362619675e+175   1.3394729063456528e-75
+  38 65 38 31 65 36 39 63  38 32 65 31 30 36 30 62
+     9.5150958087171e+169   9.335669592288985e+164
+     9.5150958087171e+169   9.335669592288985e+164
+  63 31 34 65 35 31 38 64  62 32 62 34 39 61 61 34
+   5.983471731971685e+174   2.2150068430854503e-56
+   5.983471731971685e+174   2.2150068430854503e-56
+  33 61 64 39 30 62 61 32  36 30 30 30 30 30 30 30
+    5.158333154684527e-66   1.3980432860952907e-76
+    5.158333154684527e-66   1.3980432860952907e-76
+  30 30 34 39 30 30 34 37  33 30 34 34 30 32 32 30
+    9.052718037790485e-43   1.5714413785362064e-76
+    9.052718037790485e-43   1.5714413785362064e-76
+  33 66 31 36 63 36 66 34  30 31 36 32 61 62 36 38
+   2.8309181258030166e-56    6.578153254878964e-38
+   2.8309181258030166e-56    6.578153254878964e-38
+  36 36 32 31 65 66 33 30  30 30 62 30 34 65 37 35
+   1.6754151080436444e-76   2.4425861705486336e-52
+   1.6754151080436444e-76   2.4425861705486336e-52
+  34 31 38 61 30 63 30 63  62 32 64 38 61 65 62 65
+   6.184564683036164e+169   2.385454670624325e+180
+   6.184564683036164e+169   2.385454670624325e+180
+  61 63 38 39 34 61 65 33  36 30 61 63 31 65 37 38
+   4.1576943480348516e-61    6.875256295483568e-38
+   4.1576943480348516e-61    6.875256295483568e-38
+  30 32 32 30 64 64 63 31  35 65 63 64 66 63 33 35
+    8.780456051095168e-71   2.0242309997599225e-52
+    8.780456051095168e-71   2.0242309997599225e-52
+  30 37 61 63 34 38 65 31  36 38 31 61 33 33 65 62
+    9.607871469367912e-71   9.766603241208278e+165
+    9.607871469367912e-71   9.766603241208278e+165
+  36 30 39 39 36 36 33 31  62 66 36 62 66 35 62 63
+    1.087347358374736e-71   5.497483814350418e+170
+    1.087347358374736e-71   5.497483814350418e+170
+  30 61 30 36 38 32 63 34  64 62 37 34 33 63 65 37
+   2.4465010804442616e-56    7.672389373602848e-42
+   2.4465010804442616e-56    7.672389373602848e-42
+  63 61 32 62 30 31 66 66  66 66 66 66 66 66 30 31
+  1.8859345758774246e+185     9.28207105579738e-72
+  1.8859345758774246e+185     9.28207105579738e-72
+  34 30 34 32 30 66 30 30  30 30 30 30 30 30 30 30
+   1.4162602145167382e-76    1.398043286095289e-76
+   1.4162602145167382e-76    1.398043286095289e-76
+  31 39 37 36 61 39 31 34  36 36 30 64 34 65 66 33
+    2.743963744756248e-57    4.355202655201016e-61
+    2.743963744756248e-57    4.355202655201016e-61
+  61 37 34 33 65 33 65 36  39 36 61 64 39 39 30 33
+   1.1604920527305371e-46   3.9437221639752795e-62
+   1.1604920527305371e-46   3.9437221639752795e-62
+  36 34 65 35 35 35 63 32  37 31 61 64 35 30 34 62
+    5.699667995807624e-66  1.1625662398403062e+165
+    5.699667995807624e-66  1.1625662398403062e+165
+  38 38 61 63 30 30 30 30  30 30 30 30 22 2c 20 22
+   1.3980435496066314e-76     2.5902785586997e-144
+   1.3980435496066314e-76     2.5902785586997e-144
+  50 32 53 48 22 5d 2c 0a  0a 5b 22 54 68 65 20 66
+  1.1529705962819529e-259   8.708603955191764e+183
+  1.1529705962819529e-259   8.708603955191764e+183
+  6f 6c 6c 6f 77 69 6e 67  20 69 73 20 61 20 74 77
+  1.6937603372193355e+190  2.5958765603075915e+267
+  1.6937603372193355e+190  2.5958765603075915e+267
+  65 61 6b 65 64 20 66 6f  72 6d 20 6f 66 20 32 33
+  4.1933399819144586e+228    4.406323383183854e-62
+  4.1933399819144586e+228    4.406323383183854e-62
+  62 33 39 37 65 64 63 63  64 33 37 34 30 61 37 34
+   5.854825500946692e+170   3.7245918211533854e-57
+   5.854825500946692e+170   3.7245918211533854e-57
+  61 64 62 36 30 33 63 39  37 35 36 33 37 30 66 61
+    2.958221370856272e-32  1.5597412373107228e+161
+    2.958221370856272e-32  1.5597412373107228e+161
+  66 63 64 65 39 62 63 63  34 34 38 33 65 62 32 37
+   5.852264902207282e+170    8.243830655412143e-43
+   5.852264902207282e+170    8.243830655412143e-43
+  31 65 63 61 64 30 39 61  39 34 64 64 36 33 22 5d
+  2.2133453537691277e+160   4.334714940730432e+140
+  2.2133453537691277e+160   4.334714940730432e+140
+  2c 0a 5b 22 49 74 20 69  73 20 61 6e 20 4f 50 5f
+  2.4599428200484464e+198  1.3346504370136875e+151
+  2.4599428200484464e+198  1.3346504370136875e+151
+  43 48 45 43 4b 4d 55 4c  54 49 53 49 47 20 77 69
+    5.348575187649885e+59  1.1063672391854842e+200
+    5.348575187649885e+59  1.1063672391854842e+200
+  74 68 20 61 6e 20 61 72  62 69 74 72 61 72 79 20
+   9.136078224506999e+242  3.0366544100315688e-152
+   9.136078224506999e+242  3.0366544100315688e-152
+  65 78 74 72 61 20 62 79  74 65 20 73 74 75 66 66
+   5.020646853029999e+276   1.908596203532687e+185
+   5.020646853029999e+276   1.908596203532687e+185
+  65 64 20 69 6e 74 6f 20  74 68 65 20 73 69 67 6e
+  1.8768055089799386e-152   6.770234260216546e+223
+  1.8768055089799386e-152   6.770234260216546e+223
+  61 74 75 72 65 20 61 74  20 70 6f 73 20 6c 65 6e
+   3.923884491846297e+252   6.194900210210904e+223
+   3.923884491846297e+252   6.194900210210904e+223
+  67 74 68 20 2d 20 32 22  5d 2c 0a 5b 22 54 68 65
+   5.806261550227025e-144  3.1547533978091447e+180
+   5.806261550227025e-144  3.1547533978091447e+180
+  20 64 75 6d 6d 79 20 62  79 74 65 20 69 73 20 66
+   4.743460634709085e+164   8.737657030763229e+183
+   4.743460634709085e+164   8.737657030763229e+183
+  69 6e 65 20 68 6f 77 65  76 65 72 2c 20 73 6f 20
+   6.077790939852203e+180  1.8765012055553208e-152
+   6.077790939852203e+180  1.8765012055553208e-152
+  74 68 65 20 4e 55 4c 4c  44 55 4d 4d 59 20 66 6c
+    3.557010511259916e+59  1.4897622335006277e+214
+    3.557010511259916e+59  1.4897622335006277e+214
+  61 67 20 73 68 6f 75 6c  64 20 62 65 20 68 61 70
+   2.886451186244543e+214  2.1619428393056294e+233
+   2.886451186244543e+214  2.1619428393056294e+233
+  70 79 22 5d 2c 0a 5b 5b  5b 22 36 30 61 32 30 62
+  1.1995562572256534e+132   9.327102284175176e+164
+  1.1995562572256534e+132   9.327102284175176e+164
+  64 39 33 61 61 34 39 61  62 34 62 32 38 64 35 31
+  2.2147142899732572e+160    1.210715003110239e-71
+  2.2147142899732572e+160    1.210715003110239e-71
+  34 65 63 31 30 62 30 36  65 31 38 32 39 63 65 36
+   1.1210078351718893e-47   1.1707187154905561e-46
+   1.1210078351718893e-47   1.1707187154905561e-46
+  38 31 38 65 63 30 36 63  64 33 61 61 62 64 30 31
+   8.374051509317886e+169     9.27761462346264e-72
+   8.374051509317886e+169     9.27761462346264e-72
+  33 65 62 63 64 63 34 62  62 31 22 2c 20 30 2c 20
+  1.1740797652228464e+165   1.051178203741475e-153
+  1.1740797652228464e+165   1.051178203741475e-153
+  22 31 20 30 78 34 31 20  30 78 30 34 63 63 37 31
+  1.2832044591557164e-153    1.323727047296959e-71
+  1.2832044591557164e-153    1.323727047296959e-71
+  65 62 33 30 64 36 35 33  63 30 63 33 31 36 33 39
+    5.156464904947044e-62    3.700036567057219e-33
+    5.156464904947044e-62    3.700036567057219e-33
+  39 30 63 34 37 62 39 37  36 66 33 66 62 33 66 33
+   1.1382424501942906e-42   4.3173569063311854e-61
+   1.1382424501942906e-42   4.3173569063311854e-61
+  37 63 63 63 64 63 62 65  64 62 31 36 39 61 31 64
+  2.3844478735553207e+180   4.298547774748211e+174
+  2.3844478735553207e+180   4.298547774748211e+174
+  66 65 66 35 38 62 62 66  62 66 61 66 66 37 64 38
+   1.562282508383136e+185    4.752854267886982e-37
+   1.562282508383136e+185    4.752854267886982e-37
+  61 34 37 33 65 37 65 32  65 36 64 33 31 37 62 38
+    6.295676531507872e-66    4.282465684874165e-37
+    6.295676531507872e-66    4.282465684874165e-37
+  37 62 61 66 65 38 62 64  65 39 37 65 33 63 66 38
+  3.6051467450713026e+175    5.263276656676302e-37
+  3.6051467450713026e+175    5.263276656676302e-37
+  66 30 36 35 64 65 63 30  32 32 62 35 31 64 31 31
+    1.340061168483938e-75    9.843169909419801e-72
+    1.340061168483938e-75    9.843169909419801e-72
+  66 63 64 64 30 64 33 34  38 61 63 34 20 30 78 34
+   3.0892224187471133e-57    6.165390952317304e-56
+   3.0892224187471133e-57    6.165390952317304e-56
+  31 20 30 78 30 34 36 31  63 62 64 63 63 35 34 30
+    1.256694199982869e-71   1.7452442500568492e-76
+    1.256694199982869e-71   1.7452442500568492e-76
+  39 66 62 34 62 34 64 34  32 62 35 31 64 33 33 33
+   2.5750257791461952e-56    4.667443180642653e-62
+   2.5750257791461952e-56    4.667443180642653e-62
+  38 31 33 35 34 64 38 30  65 35 35 30 30 37 38 63
+   2.1064842847775435e-76   9.138868541220728e+169
+   2.1064842847775435e-76   9.138868541220728e+169
+  62 35 33 32 61 33 34 62  66 61 32 66 63 66 64 65
+  1.1632795672134272e+165  2.6453102376614394e+180
+  1.1632795672134272e+165  2.6453102376614394e+180
+  62 37 64 37 36 35 31 39  61 65 63 63 36 32 37 37
+    3.314113001438446e-33   1.0401509990858969e-42
+    3.314113001438446e-33   1.0401509990858969e-42
+  30 66 35 62 30 65 34 65  66 38 35 35 31 39 34 36
+  3.3058784542128265e+179   1.3837416658003177e-47
+  3.3058784542128265e+179   1.3837416658003177e-47
+  64 38 61 35 34 30 39 31  31 61 62 65 33 65 37 38
+   1.4256070681404817e-71    6.875265298907715e-38
+   1.4256070681404817e-71    6.875265298907715e-38
+  35 34 61 32 36 66 33 39  66 35 38 62 32 35 63 31
+    3.736162435625414e-33    8.696983650344238e-71
+    3.736162435625414e-33    8.696983650344238e-71
+  35 33 34 32 61 66 20 32  20 4f 50 5f 43 48 45 43
+    3.041534317074069e-67        11980857420062272
+    3.041534317074069e-67        11980857420062272
+  4b 4d 55 4c 54 49 53 49  47 22 5d 5d 2c 0a 22 30
+   1.7204081633126492e+45    7.789711529715404e-77
+   1.7204081633126492e+45    7.789711529715404e-77
+  31 30 30 30 30 30 30 30  31 62 31 34 62 64 63 62
+   1.3980432860952892e-76   8.933733559794676e+165
+   1.3980432860952892e-76   8.933733559794676e+165
+  63 33 65 30 31 62 64 61  61 64 33 36 63 63 30 38
+  1.4328733290030128e+161    4.816068710531016e-38
+  1.4328733290030128e+161    4.816068710531016e-38
+  65 38 31 65 36 39 63 38  32 65 31 30 36 30 62 63
+    4.519419899440136e-37   5.491364967316243e+170
+    4.519419899440136e-37   5.491364967316243e+170
+  31 34 65 35 31 38 64 62  32 62 34 39 61 61 34 33
+   9.314897034502109e+165    4.954198314802241e-62
+   9.314897034502109e+165    4.954198314802241e-62
+  61 64 39 30 62 61 32 36  30 30 30 30 30 30 30 30
+   1.2576383095458793e-47    1.398043286095289e-76
+   1.2576383095458793e-47    1.398043286095289e-76
+  30 34 61 30 30 34 38 33  30 34 34 30 32 32 30 33
+    5.883632518145701e-62    3.937048546130334e-62
+    5.883632518145701e-62    3.937048546130334e-62
+  66 31 36 63 36 66 34 30  31 36 32 61 62 36 38 36
+   1.7617151156396045e-76   1.6566822804857027e-47
+   1.7617151156396045e-76   1.6566822804857027e-47
+  36 32 31 65 66 33 30 30  30 62 30 34 65 37 35 34
+   1.3991267697747746e-76   3.3799656103701886e-57
+   1.3991267697747746e-76   3.3799656103701886e-57
+  31 38 61 30 63 30 63 62  32 64 38 61 65 62 65 61
+    8.84016307771522e+165  1.5032248380974053e+161
+    8.84016307771522e+165  1.5032248380974053e+161
+  63 38 39 34 61 65 33 36  30 61 63 31 65 37 38 30
+    1.327129164270085e-47   2.0913680710803983e-76
+    1.327129164270085e-47   2.0913680710803983e-76
+  32 32 30 64 64 63 31 35  65 63 64 66 63 33 35 30
+   1.8154180693555623e-52    1.830931250382179e-76
+   1.8154180693555623e-52    1.830931250382179e-76
+  37 61 63 34 38 65 31 36  38 31 61 33 33 65 62 36
+    1.190240805787694e-47   1.0069266864074526e-46
+    1.190240805787694e-47   1.0069266864074526e-46
+  30 39 39 36 36 33 31 62  66 36 62 66 35 62 63 30
+   9.904835074668885e+164   1.3392021818439885e-75
+   9.904835074668885e+164   1.3392021818439885e-75
+  61 30 36 38 32 63 34 64  62 37 34 33 63 65 37 63
+   5.042444859952821e+174   8.829579442548614e+169
+   5.042444859952821e+174   8.829579442548614e+169
+  61 32 62 61 62 30 31 66  66 66 66 66 66 66 66 30
+  1.8259463155500663e+184   1.5476014050729244e-75
+  1.8259463155500663e+184   1.5476014050729244e-75
+  31 34 30 34 32 30 66 30  30 30 30 30 30 30 30 30
+    1.532972844432789e-75    1.398043286095289e-76
+    1.532972844432789e-75    1.398043286095289e-76
+  30 31 39 37 36 61 39 31  34 36 36 30 64 34 65 66
+   1.4364420114292292e-71  1.8020155572007445e+185
+   1.4364420114292292e-71  1.8020155572007445e+185
+  33 61 37 34 33 65 33 65  36 39 36 61 64 39 39 30
+  3.1437949778683856e+179   2.1784033856997468e-76
+  3.1437949778683856e+179   2.1784033856997468e-76
+  33 36 34 65 35 35 35 63  32 37 31 61 64 35 30 34
+   8.003761390802721e+169    2.582173048214459e-57
+   8.003761390802721e+169    2.582173048214459e-57
+  62 38 38 61 63 30 30 30  30 30 30 30 30 22 2c 20
+   1.3981107449990037e-76  1.0491479271301769e-153
+   1.3981107449990037e-76  1.0491479271301769e-153
+  22 50 32 53 48 2c 4e 55  4c 4c 44 55 4d 4d 59 22
+    8.44747126957892e+102  3.2420242503507667e-143
+    8.44747126957892e+102  3.2420242503507667e-143
+  5d 2c 0a 0a 5b 22 54 68  65 20 66 6f 6c 6c 6f 77
+   3.674443976129349e+194  2.0264744666635615e+267
+   3.674443976129349e+194  2.0264744666635615e+267
+  69 6e 67 20 69 73 20 61  20 74 77 65 61 6b 65 64
+   7.227620495187161e+159   4.238145903884876e+175
+   7.227620495187161e+159   4.238145903884876e+175
+  20 66 6f 72 6d 20 6f 66  20 32 33 62 33 39 37 65
+  2.6452091267529874e+185   3.764297933348027e+179
+  2.6452091267529874e+185   3.764297933348027e+179
+  64 63 63 64 33 37 34 30  61 37 34 61 64 62 36 30
+   1.7458557026650854e-76   1.9331496927080727e-76
+   1.7458557026650854e-76   1.9331496927080727e-76
+  33 63 39 37 35 36 33 37  30 66 61 66 63 64 65 39
+    8.614846426164803e-43    3.295981305430205e-32
+    8.614846426164803e-43    3.295981305430205e-32
+  62 63 63 34 34 38 33 65  62 32 37 31 65 63 61 64
+   3.115304990583564e+179    3.44051681958474e+175
+   3.115304990583564e+179    3.44051681958474e+175
+  30 39 61 39 34 64 64 36  33 22 5d 2c 0a 5b 22 49
+   1.1161901625713036e-46   2.0467204669330984e+44
+   1.1161901625713036e-46   2.0467204669330984e+44
+  74 20 69 73 20 61 6e 20  4f 50 5f 43 48 45 43 4b
+   1.812639415421038e-152   3.6915200648917844e+54
+   1.812639415421038e-152   3.6915200648917844e+54
+  4d 55 4c 54 49 53 49 47  20 77 69 74 68 20 74 68
+   2.6299334241071866e+35   1.469222228611249e+195
+   2.6299334241071866e+35   1.469222228611249e+195
+  65 20 64 75 6d 6d 79 20  76 61 6c 75 65 20 73 65
+  3.0343455500466903e-152   4.960369329504799e+180
+  3.0343455500466903e-152   4.960369329504799e+180
+  74 20 74 6f 20 73 6f 6d  65 74 68 69 6e 67 20 6f
+  1.3877254752170628e+219   1.943019945698009e+227
+  1.3877254752170628e+219   1.943019945698009e+227
+  74 68 65 72 20 74 68 61  6e 20 61 6e 20 65 6d 70
+  1.7189801373979031e+161   3.650904788800713e+233
+  1.7189801373979031e+161   3.650904788800713e+233
+  74 79 20 73 74 72 69 6e  67 22 5d 2c 0a 5b 5b 5b
+   7.358764607714174e+223  1.2135697532664601e+132
+   7.358764607714174e+223  1.2135697532664601e+132
+  22 36 30 61 32 30 62 64  39 33 61 61 34 39 61 62
+  3.5988094461340715e+175   7.934652578769601e+165
+  3.5988094461340715e+175   7.934652578769601e+165
+  34 62 32 38 64 35 31 34  65 63 31 30 62 30 36 65
+     2.74148185005275e-57   3.596624751141959e+179
+     2.74148185005275e-57   3.596624751141959e+179
+  31 38 32 39 63 65 36 38  31 38 65 63 30 36 63 64
+    6.581606176636857e-38   3.801305200029582e+175
+    6.581606176636857e-38   3.801305200029582e+175
+  33 61 61 62 64 30 31 33  65 62 63 64 63 34 62 62
+    4.178422154191355e-62   8.386673995335386e+165
+    4.178422154191355e-62   8.386673995335386e+165
+  31 22 2c 20 30 2c 20 22  31 20 30 78 34 31 20 30
+   2.590312621088947e-144     6.99193139075667e-77
+   2.590312621088947e-144     6.99193139075667e-77
+  78 30 34 63 63 37 31 65  62 33 30 64 36 35 33 63
+  2.7906076185275486e+179   7.248974641601056e+169
+  2.7906076185275486e+179   7.248974641601056e+169
+  30 63 33 31 36 33 39 39  30 63 34 37 62 39 37 36
+    4.853352253112997e-33   1.5890611620657899e-47
+    4.853352253112997e-33   1.5890611620657899e-47
+  66 33 66 62 33 66 33 37  63 63 63 64 63 62 65 64
+    8.698911803436526e-43   4.231195761965302e+175
+    8.698911803436526e-43   4.231195761965302e+175
+  62 31 36 39 61 31 64 66  65 66 35 38 62 62 66 62
+  1.7160337500302515e+185  1.0312200856710285e+166
+  1.7160337500302515e+185  1.0312200856710285e+166
+  66 61 66 66 37 64 38 61  34 37 33 65 37 65 32 65
+  2.1432641087483085e+160   2.981714892423728e+179
+  2.1432641087483085e+160   2.981714892423728e+179
+  36 64 33 31 37 62 38 37  62 61 66 65 38 62 64 65
+   1.0934008908185792e-42  2.6431990191953565e+180
+   1.0934008908185792e-42  2.6431990191953565e+180
+  39 37 65 33 63 66 38 66  30 36 35 64 65 63 30 32
+   2.591948219288403e+184     6.07874565290494e-67
+   2.591948219288403e+184     6.07874565290494e-67
+  32 62 35 31 64 31 31 66  63 64 64 30 64 33 34 38
+   1.826364203888028e+184    5.936466146068928e-38
+   1.826364203888028e+184    5.936466146068928e-38
+  61 63 34 20 30 78 34 31  20 30 78 30 34 36 31 63
+    1.158531756906119e-71   6.495643680097523e+169
+    1.158531756906119e-71   6.495643680097523e+169
+  62 64 63 63 35 34 30 39  66 62 34 62 34 64 34 32
+    3.120765256937589e-33    7.563599647372102e-67
+    3.120765256937589e-33    7.563599647372102e-67
+  62 35 31 64 33 33 33 38  31 33 35 34 64 38 30 65
+    5.642373742106027e-38  2.6291523517049027e+179
+    5.642373742106027e-38  2.6291523517049027e+179
+  35 35 30 30 37 38 63 62  35 33 32 61 33 34 62 66
+   8.854250296277271e+165   1.547006029313175e+185
+   8.854250296277271e+165   1.547006029313175e+185
+  61 32 66 63 66 64 65 62  37 64 37 36 35 31 39 61
+   9.855140519375176e+165  2.2136253508453292e+160
+   9.855140519375176e+165  2.2136253508453292e+160
+  65 63 63 36 32 37 37 30  66 35 62 30 65 34 65 66
+    2.004939204755527e-76  1.8020168547949006e+185
+    2.004939204755527e-76  1.8020168547949006e+185
+  38 35 35 31 39 34 36 64  38 61 35 34 30 39 31 31
+   5.491723661489769e+174    9.748094290155952e-72
+   5.491723661489769e+174    9.748094290155952e-72
+  61 62 65 33 65 37 38 35  34 61 32 36 66 33 39 66
+   2.5283088719414975e-52  2.6770181689016663e+184
+   2.5283088719414975e-52  2.6770181689016663e+184
+  35 38 62 32 35 63 31 35  33 34 32 61 66 20 32 20
+   1.8153428841009787e-52   1.351940770969974e-153
+   1.8153428841009787e-52   1.351940770969974e-153
+  4f 50 5f 43 48 45 43 4b  4d 55 4c 54 49 53 49 47
+   3.6915200648917844e+54   2.6299334241071866e+35
+   3.6915200648917844e+54   2.6299334241071866e+35
+  22 5d 5d 2c 0a 22 30 31  30 30 30 30 30 30 30 31
+    9.130936148260522e-72    9.162216479754085e-72
+    9.130936148260522e-72    9.162216479754085e-72
+  62 31 34 62 64 63 62 63  33 65 30 31 62 64 61 61
+   5.551725310276632e+170  1.2225884906293724e+161
+   5.551725310276632e+170  1.2225884906293724e+161
+  64 33 36 63 63 30 38 65  38 31 65 36 39 63 38 32
+   3.920808621174957e+179    9.045860529428685e-67
+   3.920808621174957e+179    9.045860529428685e-67
+  65 31 30 36 30 62 63 31  34 65 35 31 38 64 62 32
+      8.7765595735601e-71    5.457423978558911e-66
+      8.7765595735601e-71    5.457423978558911e-66
+  62 34 39 61 61 34 33 61  64 39 30 62 61 32 36 30
+  1.6874978297975783e+160    1.916952928410327e-76
+  1.6874978297975783e+160    1.916952928410327e-76
+  30 30 30 30 30 30 30 30  34 61 30 31 66 66 34 37
+    1.398043286095289e-76    9.147674952907127e-43
+    1.398043286095289e-76    9.147674952907127e-43
+  33 30 34 34 30 32 32 30  33 66 31 36 63 36 66 34
+   1.5714413785362064e-76   2.8309181258030166e-56
+   1.5714413785362064e-76   2.8309181258030166e-56
+  30 31 36 32 61 62 36 38  36 36 32 31 65 66 33 30
+    6.578153254878964e-38   1.6754151080436444e-76
+    6.578153254878964e-38   1.6754151080436444e-76
+  30 30 62 30 34 65 37 35  34 31 38 61 30 63 30 63
+   2.4425861705486336e-52   6.184564683036164e+169
+   2.4425861705486336e-52   6.184564683036164e+169
+  62 32 64 38 61 65 62 65  61 63 38 39 34 61 65 33
+   2.385454670624325e+180   4.1576943480348516e-61
+   2.385454670624325e+180   4.1576943480348516e-61
+  36 30 61 63 31 65 37 38  30 32 32 30 64 64 63 31
+    6.875256295483568e-38    8.780456051095168e-71
+    6.875256295483568e-38    8.780456051095168e-71
+  35 65 63 64 66 63 33 35  30 37 61 63 34 38 65 31
+   2.0242309997599225e-52    9.607871469367912e-71
+   2.0242309997599225e-52    9.607871469367912e-71
+  36 38 31 61 33 33 65 62  36 30 39 39 36 36 33 31
+   9.766603241208278e+165    1.087347358374736e-71
+   9.766603241208278e+165    1.087347358374736e-71
+  62 66 36 62 66 35 62 63  30 61 30 36 38 32 63 34
+   5.497483814350418e+170   2.4465010804442616e-56
+   5.497483814350418e+170   2.4465010804442616e-56
+  64 62 37 34 33 63 65 37  63 61 32 62 30 31 66 66
+    7.672389373602848e-42  1.8859345758774246e+185
+    7.672389373602848e-42  1.8859345758774246e+185
+  66 66 66 66 66 66 30 31  34 30 34 32 30 66 30 30
+     9.28207105579738e-72   1.4162602145167382e-76
+     9.28207105579738e-72   1.4162602145167382e-76
+  30 30 30 30 30 30 30 30  31 39 37 36 61 39 31 34
+    1.398043286095289e-76    2.743963744756248e-57
+    1.398043286095289e-76    2.743963744756248e-57
+  36 36 30 64 34 65 66 33  61 37 34 33 65 33 65 36
+    4.355202655201016e-61   1.1604920527305371e-46
+    4.355202655201016e-61   1.1604920527305371e-46
+  39 36 61 64 39 39 30 33  36 34 65 35 35 35 63 32
+   3.9437221639752795e-62    5.699667995807624e-66
+   3.9437221639752795e-62    5.699667995807624e-66
+  37 31 61 64 35 30 34 62  38 38 61 63 30 30 30 30
+  1.1625662398403062e+165   1.3980435496066314e-76
+  1.1625662398403062e+165   1.3980435496066314e-76
+  30 30 30 30 22 2c 20 22  50 32 53 48 22 5d 2c 0a
+     2.5902785586997e-144  1.1529705962819529e-259
+     2.5902785586997e-144  1.1529705962819529e-259
+  0a 5b 22 41 73 20 61 62  6f 76 65 2c 20 62 75 74
+   7.890105417215866e+165   9.798309957106211e+252
+   7.890105417215866e+165   9.798309957106211e+252
+  20 75 73 69 6e 67 20 61  20 4f 50 5f 31 22 5d 2c
+   7.207061534616914e+159    5.455757056922975e-95
+   7.207061534616914e+159    5.455757056922975e-95
+  0a 5b 5b 5b 22 36 30 61  32 30 62 64 39 33 61 61
+  1.4244915794987523e+160   1.209089724107404e+161
+  1.4244915794987523e+160   1.209089724107404e+161
+  34 39 61 62 34 62 32 38  64 35 31 34 65 63 31 30
+    5.402457960801214e-38    1.501679701361706e-76
+    5.402457960801214e-38    1.501679701361706e-76
+  62 30 36 65 31 38 32 39  63 65 36 38 31 38 65 63
+   3.5089487773415286e-33    6.40652796521361e+170
+   3.5089487773415286e-33    6.40652796521361e+170
+  30 36 63 64 33 61 61 62  64 30 31 33 65 62 63 64
+   8.006628252522827e+165  3.8354725777475974e+175
+   8.006628252522827e+165  3.8354725777475974e+175
+  63 34 62 62 31 22 2c 20  30 2c 20 22 31 20 30 78
+  1.0491486077286292e-153   8.519145384745262e+270
+  1.0491486077286292e-153   8.519145384745262e+270
+  34 31 20 30 78 30 34 63  63 37 31 65 62 33 30 64
+   7.619378760835349e+169   4.006930617086066e+174
+   7.619378760835349e+169   4.006930617086066e+174
+  36 35 33 63 30 63 33 31  36 33 39 39 30 63 34 37
+    1.097291184457403e-71     9.14205081541445e-43
+    1.097291184457403e-71     9.14205081541445e-43
+  62 39 37 36 66 33 66 62  33 66 33 37 63 63 63 64
+  1.0227649340861372e+166  3.8362394941886724e+175
+  1.0227649340861372e+166  3.8362394941886724e+175
+  63 62 65 64 62 31 36 39  61 31 64 66 65 66 35 38
+   4.2741985290995895e-33    6.288890292593135e-38
+   4.2741985290995895e-33    6.288890292593135e-38
+  62 62 66 62 66 61 66 66  37 64 38 61 34 37 33 65
+   1.901938739766124e+185   3.114672257893583e+179
+   1.901938739766124e+185   3.114672257893583e+179
+  37 65 32 65 36 64 33 31  37 62 38 37 62 61 66 65
+   1.0975174588098464e-71  2.9021199556769244e+180
+   1.0975174588098464e-71  2.9021199556769244e+180
+  38 62 64 65 39 37 65 33  63 66 38 66 30 36 35 64
+   4.1258045892415914e-61   5.246292344628326e+174
+   4.1258045892415914e-61   5.246292344628326e+174
+  65 63 30 32 32 62 35 31  64 31 31 66 63 64 64 30
+   1.2102676489226178e-71   1.4088797841414418e-75
+   1.2102676489226178e-71   1.4088797841414418e-75
+  64 33 34 38 61 63 34 20  30 78 34 31 20 30 78 30
+  1.5206215892324758e-153   3.3422651061449623e-75
+  1.5206215892324758e-153   3.3422651061449623e-75
+  34 36 31 63 62 64 63 63  35 34 30 39 66 62 34 62
+   5.854812471530753e+170   1.173856432087613e+165
+   5.854812471530753e+170   1.173856432087613e+165
+  34 64 34 32 62 35 31 64  33 33 33 38 31 33 35 34
+   4.256192535659442e+174   3.3773500373479516e-57
+   4.256192535659442e+174   3.3773500373479516e-57
+  64 38 30 65 35 35 30 30  37 38 63 62 35 33 32 61
+   1.3997368994611168e-76  1.5992261916070045e+160
+   1.3997368994611168e-76  1.5992261916070045e+160
+  33 34 62 66 61 32 66 63  66 64 65 62 37 64 37 36
+   6.701590741143257e+170   1.6005093323726944e-47
+   6.701590741143257e+170   1.6005093323726944e-47
+  35 31 39 61 65 63 63 36  32 37 37 30 66 35 62 30
+    1.061279176837334e-46   1.2580196550764123e-75
+    1.061279176837334e-46   1.2580196550764123e-75
+  65 34 65 66 38 35 35 31  39 34 36 64 38 61 35 34
+    1.200324140566457e-71   3.4059933415999186e-57
+    1.200324140566457e-71   3.4059933415999186e-57
+  30 39 31 31 61 62 65 33  65 37 38 35 34 61 32 36
+    4.158587431821372e-61    1.257590303677841e-47
+    4.158587431821372e-61    1.257590303677841e-47
+  66 33 39 66 35 38 62 32  35 63 31 35 33 34 32 61
+    5.406409748135536e-66  1.5995665132248025e+160
+    5.406409748135536e-66  1.5995665132248025e+160
+  66 20 32 20 4f 50 5f 43  48 45 43 4b 4d 55 4c 54
+        35256100203299224   1.2103874132338066e+98
+        35256100203299224   1.2103874132338066e+98
+  49 53 49 47 22 5d 5d 2c  0a 22 30 31 30 30 30 30
+   5.4988731305984484e-95   1.3980432912417352e-76
+   5.4988731305984484e-95   1.3980432912417352e-76
+  30 30 30 31 62 31 34 62  64 63 62 63 33 65 30 31
+   1.162830551055179e+165    9.279419650317207e-72
+   1.162830551055179e+165    9.279419650317207e-72
+  62 64 61 61 64 33 36 63  63 30 38 65 38 31 65 36
+   8.378479793786063e+169   1.1600269878064292e-46
+   8.378479793786063e+169   1.1600269878064292e-46
+  39 63 38 32 65 31 30 36  30 62 63 31 34 65 35 31
+   1.1079666260674887e-47   1.2109326311998597e-71
+   1.1079666260674887e-47   1.2109326311998597e-71
+  38 64 62 32 62 34 39 61  61 34 33 61 64 39 30 62
+  2.2147153855600577e+160   9.342876524761724e+164
+  2.2147153855600577e+160   9.342876524761724e+164
+  61 32 36 30 30 30 30 30  30 30 30 30 34 39 35 31
+    1.398043286216107e-76    1.201204846891259e-71
+    1.398043286216107e-76    1.201204846891259e-71
+  34 37 33 30 34 34 30 32  32 30 33 66 31 36 63 36
+    6.010368466241235e-67   1.0516138076912055e-46
+    6.010368466241235e-67   1.0516138076912055e-46
+  66 34 30 31 36 32 61 62  36 38 36 36 32 31 65 66
+   7.922068355953969e+165  1.8009548676755642e+185
+   7.922068355953969e+165  1.8009548676755642e+185
+  33 30 30 30 62 30 34 65  37 35 34 31 38 61 30 63
+   3.272443847277845e+179   6.181661263679617e+169
+   3.272443847277845e+179   6.181661263679617e+169
+  30 63 62 32 64 38 61 65  62 65 61 63 38 39 34 61
+    2.23299422879759e+180  1.7770284785468835e+160
+    2.23299422879759e+180  1.7770284785468835e+160
+  65 33 36 30 61 63 31 65  37 38 30 32 32 30 64 64
+   2.818461475688826e+179   3.994537534190682e+175
+   2.818461475688826e+179   3.994537534190682e+175
+  63 31 35 65 63 64 66 63  33 35 30 37 61 63 34 38
+   6.760568096646819e+170    5.991554110341484e-38
+   6.760568096646819e+170    5.991554110341484e-38
+  65 31 36 38 31 61 33 33  65 62 36 30 39 39 36 36
+    4.710933724228877e-62    1.520595550973725e-47
+    4.710933724228877e-62    1.520595550973725e-47
+  33 31 62 66 36 62 66 35  62 63 30 61 30 36 38 32
+   1.8695690613597207e-51    8.980609647975502e-67
+   1.8695690613597207e-51    8.980609647975502e-67
+  63 34 64 62 37 34 33 63  65 37 63 61 32 62 30 31
+   7.247506155718934e+169    9.272778369337403e-72
+   7.247506155718934e+169    9.272778369337403e-72
+  66 66 66 66 66 66 66 66  30 31 34 30 34 32 30 66
+  1.9035985662552932e+185    1.72047374710352e+184
+  1.9035985662552932e+185    1.72047374710352e+184
+  30 30 30 30 30 30 30 30  30 30 31 39 37 36 61 39
+    1.398043286095289e-76    2.651894621783635e-32
+    1.398043286095289e-76    2.651894621783635e-32
+  31 34 36 36 30 64 34 65  66 33 61 37 34 33 65 33
+   3.305244863316297e+179    4.122750637395845e-61
+   3.305244863316297e+179    4.122750637395845e-61
+  65 36 39 36 61 64 39 39  30 33 36 34 65 35 35 35
+    4.890342179255886e-33    2.214278599495096e-52
+    4.890342179255886e-33    2.214278599495096e-52
+  63 32 37 31 61 64 35 30  34 62 38 38 61 63 30 30
+   1.8474585074784328e-76   1.4153127654462938e-76
+   1.8474585074784328e-76   1.4153127654462938e-76
+  30 30 30 30 30 30 22 2c  20 22 50 32 53 48 22 5d
+    4.257571555502434e-96   4.354357046338091e+140
+    4.257571555502434e-96   4.354357046338091e+140
+  2c 0a 0a 5b 22 41 73 20  61 62 6f 76 65 2c 20 62
+   2.297697649106558e-152   4.656821550455365e+164
+   2.297697649106558e-152   4.656821550455365e+164
+  75 74 20 75 73 69 6e 67  20 61 20 4f 50 5f 31 4e
+  1.6937569568687527e+190    4.683567982925745e+68
+  1.6937569568687527e+190    4.683567982925745e+68
+  45 47 41 54 45 22 5d 2c  0a 5b 5b 5b 22 36 30 61
+   5.4558140828553295e-95  1.4244915794987523e+160
+   5.4558140828553295e-95  1.4244915794987523e+160
+  32 30 62 64 39 33 61 61  34 39 61 62 34 62 32 38
+   1.209089724107404e+161    5.402457960801214e-38
+   1.209089724107404e+161    5.402457960801214e-38
+  64 35 31 34 65 63 31 30  62 30 36 65 31 38 32 39
+    1.501679701361706e-76   3.5089487773415286e-33
+    1.501679701361706e-76   3.5089487773415286e-33
+  63 65 36 38 31 38 65 63  30 36 63 64 33 61 61 62
+    6.40652796521361e+170   8.006628252522827e+165
+    6.40652796521361e+170   8.006628252522827e+165
+  64 30 31 33 65 62 63 64  63 34 62 62 31 22 2c 20
+  3.8354725777475974e+175  1.0491486077286292e-153
+  3.8354725777475974e+175  1.0491486077286292e-153
+  30 2c 20 22 31 20 30 78  34 31 20 30 78 30 34 63
+   8.519145384745262e+270   7.619378760835349e+169
+   8.519145384745262e+270   7.619378760835349e+169
+  63 37 31 65 62 33 30 64  36 35 33 63 30 63 33 31
+   4.006930617086066e+174    1.097291184457403e-71
+   4.006930617086066e+174    1.097291184457403e-71
+  36 33 39 39 30 63 34 37  62 39 37 36 66 33 66 62
+     9.14205081541445e-43  1.0227649340861372e+166
+     9.14205081541445e-43  1.0227649340861372e+166
+  33 66 33 37 63 63 63 64  63 62 65 64 62 31 36 39
+  3.8362394941886724e+175   4.2741985290995895e-33
+  3.8362394941886724e+175   4.2741985290995895e-33
+  61 31 64 66 65 66 35 38  62 62 66 62 66 61 66 66
+    6.288890292593135e-38   1.901938739766124e+185
+    6.288890292593135e-38   1.901938739766124e+185
+  37 64 38 61 34 37 33 65  37 65 32 65 36 64 33 31
+   3.114672257893583e+179   1.0975174588098464e-71
+   3.114672257893583e+179   1.0975174588098464e-71
+  37 62 38 37 62 61 66 65  38 62 64 65 39 37 65 33
+  2.9021199556769244e+180   4.1258045892415914e-61
+  2.9021199556769244e+180   4.1258045892415914e-61
+  63 66 38 66 30 36 35 64  65 63 30 32 32 62 35 31
+   5.246292344628326e+174   1.2102676489226178e-71
+   5.246292344628326e+174   1.2102676489226178e-71
+  64 31 31 66 63 64 64 30  64 33 34 38 61 63 34 20
+   1.4088797841414418e-75  1.5206215892324758e-153
+   1.4088797841414418e-75  1.5206215892324758e-153
+  30 78 34 31 20 30 78 30  34 36 31 63 62 64 63 63
+   3.3422651061449623e-75   5.854812471530753e+170
+   3.3422651061449623e-75   5.854812471530753e+170
+  35 34 30 39 66 62 34 62  34 64 34 32 62 35 31 64
+   1.173856432087613e+165   4.256192535659442e+174
+   1.173856432087613e+165   4.256192535659442e+174
+  33 33 33 38 31 33 35 34  64 38 30 65 35 35 30 30
+   3.3773500373479516e-57   1.3997368994611168e-76
+   3.3773500373479516e-57   1.3997368994611168e-76
+  37 38 63 62 35 33 32 61  33 34 62 66 61 32 66 63
+  1.5992261916070045e+160   6.701590741143257e+170
+  1.5992261916070045e+160   6.701590741143257e+170
+  66 64 65 62 37 64 37 36  35 31 39 61 65 63 63 36
+   1.6005093323726944e-47    1.061279176837334e-46
+   1.6005093323726944e-47    1.061279176837334e-46
+  32 37 37 30 66 35 62 30  65 34 65 66 38 35 35 31
+   1.2580196550764123e-75    1.200324140566457e-71
+   1.2580196550764123e-75    1.200324140566457e-71
+  39 34 36 64 38 61 35 34  30 39 31 31 61 62 65 33
+   3.4059933415999186e-57    4.158587431821372e-61
+   3.4059933415999186e-57    4.158587431821372e-61
+  65 37 38 35 34 61 32 36  66 33 39 66 35 38 62 32
+    1.257590303677841e-47    5.406409748135536e-66
+    1.257590303677841e-47    5.406409748135536e-66
+  35 63 31 35 33 34 32 61  66 20 32 20 4f 50 5f 43
+  1.5995665132248025e+160        35256100203299224
+  1.5995665132248025e+160        35256100203299224
+  48 45 43 4b 4d 55 4c 54  49 53 49 47 22 5d 5d 2c
+   1.2103874132338066e+98   5.4988731305984484e-95
+   1.2103874132338066e+98   5.4988731305984484e-95
+  0a 22 30 31 30 30 30 30  30 30 30 31 62 31 34 62
+   1.3980432912417352e-76   1.162830551055179e+165
+   1.3980432912417352e-76   1.162830551055179e+165
+  64 63 62 63 33 65 30 31  62 64 61 61 64 33 36 63
+    9.279419650317207e-72   8.378479793786063e+169
+    9.279419650317207e-72   8.378479793786063e+169
+  63 30 38 65 38 31 65 36  39 63 38 32 65 31 30 36
+   1.1600269878064292e-46   1.1079666260674887e-47
+   1.1600269878064292e-46   1.1079666260674887e-47
+  30 62 63 31 34 65 35 31  38 64 62 32 62 34 39 61
+   1.2109326311998597e-71  2.2147153855600577e+160
+   1.2109326311998597e-71  2.2147153855600577e+160
+  61 34 33 61 64 39 30 62  61 32 36 30 30 30 30 30
+   9.342876524761724e+164    1.398043286216107e-76
+   9.342876524761724e+164    1.398043286216107e-76
+  30 30 30 30 34 39 34 66  34 37 33 30 34 34 30 32
+  2.1482888021561218e+184    6.010368466241235e-67
+  2.1482888021561218e+184    6.010368466241235e-67
+  32 30 33 66 31 36 63 36  66 34 30 31 36 32 61 62
+   1.0516138076912055e-46   7.922068355953969e+165
+   1.0516138076912055e-46   7.922068355953969e+165
+  36 38 36 36 32 31 65 66  33 30 30 30 62 30 34 65
+  1.8009548676755642e+185   3.272443847277845e+179
+  1.8009548676755642e+185   3.272443847277845e+179
+  37 35 34 31 38 61 30 63  30 63 62 32 64 38 61 65
+   6.181661263679617e+169    2.23299422879759e+180
+   6.181661263679617e+169    2.23299422879759e+180
+  62 65 61 63 38 39 34 61  65 33 36 30 61 63 31 65
+  1.7770284785468835e+160   2.818461475688826e+179
+  1.7770284785468835e+160   2.818461475688826e+179
+  37 38 30 32 32 30 64 64  63 31 35 65 63 64 66 63
+   3.994537534190682e+175   6.760568096646819e+170
+   3.994537534190682e+175   6.760568096646819e+170
+  33 35 30 37 61 63 34 38  65 31 36 38 31 61 33 33
+    5.991554110341484e-38    4.710933724228877e-62
+    5.991554110341484e-38    4.710933724228877e-62
+  65 62 36 30 39 39 36 36  33 31 62 66 36 62 66 35
+    1.520595550973725e-47   1.8695690613597207e-51
+    1.520595550973725e-47   1.8695690613597207e-51
+  62 63 30 61 30 36 38 32  63 34 64 62 37 34 33 63
+    8.980609647975502e-67   7.247506155718934e+169
+    8.980609647975502e-67   7.247506155718934e+169
+  65 37 63 61 32 62 30 31  66 66 66 66 66 66 66 66
+    9.272778369337403e-72  1.9035985662552932e+185
+    9.272778369337403e-72  1.9035985662552932e+185
+  30 31 34 30 34 32 30 66  30 30 30 30 30 30 30 30
+    1.72047374710352e+184    1.398043286095289e-76
+    1.72047374710352e+184    1.398043286095289e-76
+  30 30 31 39 37 36 61 39  31 34 36 36 30 64 34 65
+    2.651894621783635e-32   3.305244863316297e+179
+    2.651894621783635e-32   3.305244863316297e+179
+  66 33 61 37 34 33 65 33  65 36 39 36 61 64 39 39
+    4.122750637395845e-61    4.890342179255886e-33
+    4.122750637395845e-61    4.890342179255886e-33
+  30 33 36 34 65 35 35 35  63 32 37 31 61 64 35 30
+    2.214278599495096e-52   1.8474585074784328e-76
+    2.214278599495096e-52   1.8474585074784328e-76
+  34 62 38 38 61 63 30 30  30 30 30 30 30 30 22 2c
+   1.4153127654462938e-76    4.257571555502434e-96
+   1.4153127654462938e-76    4.257571555502434e-96
+  20 22 50 32 53 48 22 5d  2c 0a 0a 5b 22 54 68 65
+   4.354357046338091e+140  3.1547533978051123e+180
+   4.354357046338091e+140  3.1547533978051123e+180
+  20 66 6f 6c 6c 6f 77 69  6e 67 20 69 73 20 63 39
+  1.1211576767985942e+200    2.946944144048307e-32
+  1.1211576767985942e+200    2.946944144048307e-32
+  39 63 34 39 64 61 34 63  33 38 61 66 36 36 39 64
+   7.691499792405486e+169  6.2356365966459335e+174
+   7.691499792405486e+169  6.2356365966459335e+174
+  65 61 34 33 36 64 33 65  37 33 37 38 30 64 66 64
+   3.143169222178125e+179   4.430451399530527e+175
+   3.143169222178125e+179   4.430451399530527e+175
+  62 36 63 31 65 63 66 39  39 35 38 62 61 61 35 32
+    3.449458063187884e-32    7.930428227787306e-67
+    3.449458063187884e-32    7.930428227787306e-67
+  39 36 30 65 38 62 61 65  65 33 30 65 37 33 22 5d
+  2.2541819329773215e+180   4.334718586236367e+140
+  2.2541819329773215e+180   4.334718586236367e+140
+  2c 0a 5b 22 49 74 20 69  73 20 6f 66 20 69 6e 74
+  2.4599428200484464e+198    6.96742161348442e+252
+  2.4599428200484464e+198    6.96742161348442e+252
+  65 72 65 73 74 20 62 65  63 61 75 73 65 20 69 74
+    2.35054196720555e+180  5.7567743562808305e+252
+    2.35054196720555e+180  5.7567743562808305e+252
+  20 63 6f 6e 74 61 69 6e  73 20 61 20 30 2d 73 65
+   7.339561231926069e+223    4.97332812791968e+180
+   7.339561231926069e+223    4.97332812791968e+180
+  71 75 65 6e 63 65 20 61  73 20 77 65 6c 6c 20 61
+   7.203555522346876e+159   7.215629019510986e+159
+   7.203555522346876e+159   7.215629019510986e+159
+  73 20 61 20 73 69 67 6e  61 74 75 72 65 20 6f 66
+    6.77023425992829e+223  2.6451987530838855e+185
+    6.77023425992829e+223  2.6451987530838855e+185
+  20 53 49 47 48 41 53 48  20 74 79 70 65 20 30 20
+   2.6208560329832514e+40  1.2027728862135254e-153
+   2.6208560329832514e+40  1.2027728862135254e-153
+  28 77 68 69 63 68 20 69  73 20 6e 6f 74 20 61 20
+   2.452994856137334e+198  1.0218986877364093e-152
+   2.452994856137334e+198  1.0218986877364093e-152
+  72 65 61 6c 20 74 79 70  65 29 22 5d 2c 0a 5b 5b
+   6.322752826047951e+233  1.1995562572224239e+132
+   6.322752826047951e+233  1.1995562572224239e+132
+  5b 22 34 30 36 62 32 62  30 36 62 63 64 33 34 64
+  1.0586420307915901e+165   4.996259744240701e+174
+  1.0586420307915901e+165   4.996259744240701e+174
+  33 63 38 37 33 33 65 36  62 37 39 66 37 61 33 39
+   1.1604503038857113e-46    3.732404387576279e-33
+   1.1604503038857113e-46    3.732404387576279e-33
+  34 63 38 61 34 33 31 66  62 66 34 66 66 35 61 63
+  1.8271166075787816e+184   5.195566892206725e+170
+  1.8271166075787816e+184   5.195566892206725e+170
+  37 30 35 63 39 33 66 34  30 37 36 62 62 37 37 36
+    2.829343267013684e-56   1.5885267845204527e-47
+    2.829343267013684e-56   1.5885267845204527e-47
+  30 32 22 2c 20 30 2c 20  22 44 55 50 20 48 41 53
+  1.0511782037415022e-153   1.1265130357212166e+93
+  1.0511782037415022e-153   1.1265130357212166e+93
+  48 31 36 30 20 30 78 31  34 20 30 78 64 63 34 34
+    2.190386854601886e-70   3.2480359013032357e-57
+    2.190386854601886e-70   3.2480359013032357e-57
+  62 31 31 36 34 31 38 38  30 36 37 63 33 61 33 32
+    7.109449471637337e-38     7.18832666889886e-67
+    7.109449471637337e-38     7.18832666889886e-67
+  64 34 37 38 30 66 35 39  39 36 66 61 31 34 61 34
+    4.121330859080908e-33    2.192588772506534e-56
+    4.121330859080908e-33    2.192588772506534e-56
+  66 32 64 39 20 45 51 55  41 4c 56 45 52 49 46 59
+   9.670110776032444e+102  1.1509816729234979e+122
+   9.670110776032444e+102  1.1509816729234979e+122
+  20 43 48 45 43 4b 53 49  47 22 5d 5d 2c 0a 22 30
+   1.7210818849099444e+45    7.789711529715404e-77
+   1.7210818849099444e+45    7.789711529715404e-77
+  31 30 30 30 30 30 30 30  31 30 32 37 36 62 37 36
+   1.3980432860952892e-76   1.5999735591986778e-47
+   1.3980432860952892e-76   1.5999735591986778e-47
+  62 30 37 66 34 39 33 35  63 37 30 61 63 66 35 34
+   2.0070224323073036e-52   3.4092093477397973e-57
+   2.0070224323073036e-52   3.4092093477397973e-57
+  66 62 66 31 66 34 33 38  61 34 63 33 39 37 61 39
+    5.643749488028048e-38    2.652501123561611e-32
+    5.643749488028048e-38    2.652501123561611e-32
+  66 62 37 65 36 33 33 38  37 33 63 34 64 64 33 62
+    5.642387212510084e-38  1.1167184530304655e+165
+    5.642387212510084e-38  1.1167184530304655e+165
+  63 30 36 32 62 36 62 34  30 30 30 30 30 30 30 30
+   2.3211267393046714e-56    1.398043286095289e-76
+   2.3211267393046714e-56    1.398043286095289e-76
+  30 38 63 34 39 33 30 34  36 30 32 32 31 30 30 64
+   2.5808234925033395e-57   4.003846537996882e+174
+   2.5808234925033395e-57   4.003846537996882e+174
+  32 33 34 35 39 64 30 33  65 64 37 65 39 35 31 31
+    3.984552421747401e-62    9.739330232354359e-72
+    3.984552421747401e-62    9.739330232354359e-72
+  61 34 37 64 31 33 32 39  32 64 33 34 33 30 61 30
+    3.505187183985002e-33   1.1875271565000802e-75
+    3.505187183985002e-33   1.1875271565000802e-75
+  34 36 32 37 64 65 36 32  33 35 62 36 65 35 31 61
+    8.307160505677496e-67   1.512107388334011e+160
+    8.307160505677496e-67   1.512107388334011e+160
+  34 30 66 39 63 64 33 38  36 66 32 61 62 65 33 30
+    5.698837473374015e-38   1.6750740514717668e-76
+    5.698837473374015e-38   1.6750740514717668e-76
+  32 32 31 30 30 65 37 64  32 35 62 30 38 30 66 30
+   5.786360666984946e+174   1.5329791540837396e-75
+   5.786360666984946e+174   1.5329791540837396e-75
+  62 62 38 64 38 64 35 66  38 37 38 62 62 61 37 64
+   2.272366130732684e+184   5.782685565089439e+174
+   2.272366130732684e+184   5.782685565089439e+174
+  35 34 61 64 32 66 64 61  36 35 30 65 61 38 64 31
+  1.4339729870647316e+161    9.155398466304123e-71
+  1.4339729870647316e+161    9.155398466304123e-71
+  35 38 61 33 33 65 65 33  63 62 64 31 31 37 36 38
+   4.1607298946497374e-61     6.52857642189429e-38
+   4.1607298946497374e-61     6.52857642189429e-38
+  31 39 31 66 64 30 30 34  31 30 34 62 30 65 32 63
+    2.579061588053656e-57   6.942305598287608e+169
+    2.579061588053656e-57   6.942305598287608e+169
+  38 37 39 65 34 64 61 66  37 62 39 61 62 36 38 33
+   1.477959407370732e+185    5.885717799713883e-62
+   1.477959407370732e+185    5.885717799713883e-62
+  35 30 32 32 38 63 31 35  39 37 36 36 36 37 36 61
+    1.815347662209137e-52  1.9520779007510916e+160
+    1.815347662209137e-52  1.9520779007510916e+160
+  31 34 66 35 38 31 35 30  38 34 62 61 31 36 36 34
+    1.830199633206053e-76   3.5385265241063074e-57
+    1.830199633206053e-76   3.5385265241063074e-57
+  33 32 61 61 62 34 36 31  39 38 64 34 63 63 61 39
+   1.2567373038817043e-71    2.679081411042366e-32
+   1.2567373038817043e-71    2.679081411042366e-32
+  38 66 61 33 65 39 39 38  31 64 30 61 39 30 62 32
+    7.412726283307636e-38    5.397154755073974e-66
+    7.412726283307636e-38    5.397154755073974e-66
+  65 66 66 63 35 31 34 62  37 36 32 37 39 34 37 36
+  1.1627911821674589e+165   1.5876819736787732e-47
+  1.1627911821674589e+165   1.5876819736787732e-47
+  35 35 30 62 61 33 36 36  33 66 64 63 61 66 66 39
+    1.519033857913632e-47    3.451254677775995e-32
+    1.519033857913632e-47    3.451254677775995e-32
+  34 63 33 38 34 32 30 65  39 64 35 30 30 30 30 30
+  2.6252346767225426e+179   1.3980432861999142e-76
+  2.6252346767225426e+179   1.3980432861999142e-76
+  30 30 30 30 31 30 30 30  39 33 64 30 30 30 30 30
+   1.3980446038700318e-76    1.398043287141125e-76
+   1.3980446038700318e-76    1.398043287141125e-76
+  30 30 30 30 30 31 39 37  36 61 39 31 34 39 61 37
+   1.1296546962824155e-42     6.17861062047503e-42
+   1.1296546962824155e-42     6.17861062047503e-42
+  62 30 66 33 62 38 30 63  36 62 61 61 65 65 64 63
+   6.121460807706129e+169   6.157922616832369e+170
+   6.121460807706129e+169   6.157922616832369e+170
+  65 30 61 30 38 34 32 35  35 33 38 30 30 66 38 33
+   1.9005844405188617e-52    5.931110354553765e-62
+   1.9005844405188617e-52    5.931110354553765e-62
+  32 62 61 31 66 38 38 61  63 30 30 30 30 30 30 30
+  2.1282242929075386e+160   1.3980432860953045e-76
+  2.1282242929075386e+160   1.3980432860953045e-76
+  30 22 2c 20 22 50 32 53  48 22 5d 2c 0a 0a 5b 22
+    5.968685125563565e+92  3.4646246866285803e-143
+    5.968685125563565e+92  3.4646246866285803e-143
+  41 20 6e 65 61 72 6c 79  2d 73 74 61 6e 64 61 72
+   7.879151139782563e+276    9.27777354164382e+242
+   7.879151139782563e+276    9.27777354164382e+242
+  64 20 74 72 61 6e 73 61  63 74 69 6f 6e 20 77 69
+  2.7318493332058347e+161  1.1063958174198293e+200
+  2.7318493332058347e+161  1.1063958174198293e+200
+  74 68 20 43 48 45 43 4b  53 49 47 56 45 52 49 46
+    3.691520062086097e+54    4.012331313964064e+30
+    3.691520062086097e+54    4.012331313964064e+30
+  59 20 31 20 69 6e 73 74  65 61 64 20 6f 66 20 43
+   8.903854286476803e+252       2308113549111474.5
+   8.903854286476803e+252       2308113549111474.5
+  48 45 43 4b 53 49 47 22  5d 2c 0a 5b 5b 5b 22 30
+  1.4918835928118613e-143    7.926648032307966e-77
+  1.4918835928118613e-143    7.926648032307966e-77
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 31 30 30 22
+    1.398043286095289e-76   5.185635643610081e-144
+    1.398043286095289e-76   5.185635643610081e-144
+  2c 20 30 2c 20 22 44 55  50 20 48 41 53 48 31 36
+   5.636682558318743e+102   1.1825180300276534e-47
+   5.636682558318743e+102   1.1825180300276534e-47
+  30 20 30 78 31 34 20 30  78 35 62 36 34 36 32 34
+    6.996971879148275e-77    2.901296643940123e-57
+    6.996971879148275e-77    2.901296643940123e-57
+  37 35 34 35 34 37 31 30  66 33 63 32 32 66 35 66
+    1.486771720903102e-76  2.2731859928954133e+184
+    1.486771720903102e-76  2.2731859928954133e+184
+  64 66 30 62 34 30 37 30  34 63 39 32 66 32 35 63
+   2.0025806134330085e-76   7.999619803691104e+169
+   2.0025806134330085e-76   7.999619803691104e+169
+  33 20 45 51 55 41 4c 56  45 52 49 46 59 20 43 48
+   5.184262452123494e+107   1.3016727614722294e+40
+   5.184262452123494e+107   1.3016727614722294e+40
+  45 43 4b 53 49 47 56 45  52 49 46 59 20 31 22 5d
+   1.0773203466435144e+26   4.332774123520774e+140
+   1.0773203466435144e+26   4.332774123520774e+140
+  5d 2c 0a 22 30 31 30 30  30 30 30 30 30 31 30 30
+    1.398380563599275e-76   1.3983806364294722e-76
+    1.398380563599275e-76   1.3983806364294722e-76
+  30 31 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432860953674e-76    1.398043286095289e-76
+   1.3980432860953674e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 36 61  34 37 33 30 34 34 30 32
+  1.9496671453374237e+160    6.010368466241235e-67
+  1.9496671453374237e+160    6.010368466241235e-67
+  32 30 36 37 32 38 38 65  61 35 30 61 61 37 39 39
+   3.925752330800806e+179    4.856488435164244e-33
+   3.925752330800806e+179    4.856488435164244e-33
+  35 34 33 61 35 33 36 66  66 39 33 30 36 66 38 65
+   2.358256221171862e+184   3.954887784353069e+179
+   2.358256221171862e+184   3.954887784353069e+179
+  31 63 62 61 30 35 62 39  63 36 62 31 30 39 35 31
+    2.805351076413002e-32   1.2012013964565469e-71
+    2.805351076413002e-32   1.2012013964565469e-71
+  31 37 35 62 39 32 34 66  39 36 37 33 32 35 35 35
+  2.1453925624877563e+184     2.21419734560921e-52
+  2.1453925624877563e+184     2.21419734560921e-52
+  65 64 30 32 32 30 32 36  64 37 62 35 32 36 35 66
+   1.2444916561413666e-47   2.253268337135412e+184
+   1.2444916561413666e-47   2.253268337135412e+184
+  33 38 64 32 31 35 34 31  35 31 39 65 34 61 31 65
+   1.1437199255706459e-71   2.817084357516739e+179
+   1.1437199255706459e-71   2.817084357516739e+179
+  35 35 30 34 34 64 35 62  39 65 31 37 65 31 35 63
+  1.2318484681702536e+165   7.998139952779833e+169
+  1.2318484681702536e+165   7.998139952779833e+169
+  64 62 61 66 32 39 61 65  33 37 39 32 65 39 39 65
+  2.2334022311808344e+180  4.0886020388502744e+179
+  2.2334022311808344e+180  4.0886020388502744e+179
+  38 38 33 65 37 61 30 31  32 31 30 33 62 61 38 63
+    9.270610819645313e-72   9.201073109778726e+169
+    9.270610819645313e-72   9.201073109778726e+169
+  38 62 38 36 64 65 61 31  33 31 63 32 32 61 62 39
+    7.876656993113052e-71    2.831836883527766e-32
+    7.876656993113052e-71    2.831836883527766e-32
+  36 37 65 36 64 64 39 39  62 64 61 65 38 65 66 66
+    4.890350997436688e-33  1.9032069505590654e+185
+    4.890350997436688e-33  1.9032069505590654e+185
+  37 61 31 66 37 35 61 32  63 33 35 66 31 66 39 34
+    5.106204930453002e-66    4.046324616588352e-57
+    5.106204930453002e-66    4.046324616588352e-57
+  34 31 30 39 65 33 66 65  35 65 32 32 66 66 66 66
+   2.878825404355418e+180  1.9035983018293223e+185
+   2.878825404355418e+180  1.9035983018293223e+185
+  66 66 66 66 30 31 30 30  30 30 30 30 30 30 30 30
+    1.398380915487653e-76    1.398043286095289e-76
+    1.398380915487653e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 31  35 31 30 30 30 30 30 30
+    9.162216479754085e-72    1.398043286095369e-76
+    9.162216479754085e-72    1.398043286095369e-76
+  30 30 22 2c 20 22 50 32  53 48 22 5d 2c 0a 0a 5b
+    2.393669929840339e-66  3.6099798191179337e+130
+    2.393669929840339e-66  3.6099798191179337e+130
+  22 53 61 6d 65 20 61 73  20 61 62 6f 76 65 2c 20
+   5.987372470843535e+247  1.0589478375027802e-153
+   5.987372470843535e+247  1.0589478375027802e-153
+  62 75 74 20 77 69 74 68  20 74 68 65 20 73 69 67
+  1.4900547067816291e+195  1.4173926348037918e+190
+  1.4900547067816291e+195  1.4173926348037918e+190
+  6e 61 74 75 72 65 20 64  75 70 6c 69 63 61 74 65
+   2.027648979631478e+174   5.285555198580949e+180
+   2.027648979631478e+174   5.285555198580949e+180
+  64 20 69 6e 20 74 68 65  20 73 63 72 69 70 74 50
+   3.170958635432888e+180     3.78669941153551e+79
+   3.170958635432888e+180     3.78669941153551e+79
+  75 62 4b 65 79 20 77 69  74 68 20 74 68 65 20 70
+  1.1064038184651192e+200  1.2727640419623767e+232
+  1.1064038184651192e+200  1.2727640419623767e+232
+  72 6f 70 65 72 20 70 75  73 68 64 61 74 61 20 70
+   4.842872543878703e+257  1.2715652642490042e+232
+   4.842872543878703e+257  1.2715652642490042e+232
+  72 65 66 69 78 22 5d 2c  0a 5b 5b 5b 22 30 30 30
+   5.4559600497678245e-95   1.3980250594618592e-76
+   5.4559600497678245e-95   1.3980250594618592e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 31 30 30 22 2c 20
+    1.398043286095289e-76  1.0491479271388595e-153
+    1.398043286095289e-76  1.0491479271388595e-153
+  30 2c 20 22 44 55 50 20  48 41 53 48 31 36 30 20
+   4.872704312904001e-153   1.209123040566424e-153
+   4.872704312904001e-153   1.209123040566424e-153
+  30 78 31 34 20 30 78 35  62 36 34 36 32 34 37 35
+    4.040550612569466e-51   2.4225992756520478e-52
+    4.040550612569466e-51   2.4225992756520478e-52
+  34 35 34 37 31 30 66 33  63 32 32 66 35 66 64 66
+    4.314932024438053e-61  1.7335708680638647e+185
+    4.314932024438053e-61  1.7335708680638647e+185
+  30 62 34 30 37 30 34 63  39 32 66 32 35 63 33 20
+   7.619004452981844e+169  1.4459880818064462e-153
+   7.619004452981844e+169  1.4459880818064462e-153
+  45 51 55 41 4c 56 45 52  49 46 59 20 43 48 45 43
+   2.1222872311647527e+88        11980855307308178
+   2.1222872311647527e+88        11980855307308178
+  4b 53 49 47 56 45 52 49  46 59 20 31 20 30 78 34
+   1.6298140813692505e+45    6.165390902760468e-56
+   1.6298140813692505e+45    6.165390902760468e-56
+  37 20 30 78 33 30 34 34  30 32 32 30 36 37 32 38
+    3.216179410984343e-57    5.353104470897179e-38
+    3.216179410984343e-57    5.353104470897179e-38
+  38 65 61 35 30 61 61 37  39 39 35 34 33 61 35 33
+    6.234640752630251e-42    5.197114153212867e-62
+    6.234640752630251e-42    5.197114153212867e-62
+  36 66 66 39 33 30 36 66  38 65 31 63 62 61 30 35
+  2.3570078726920447e+184    1.710194342431402e-52
+  2.3570078726920447e+184    1.710194342431402e-52
+  62 39 63 36 62 31 30 39  35 31 31 37 35 62 39 32
+     3.11864003431628e-33    9.415309614264898e-67
+     3.11864003431628e-33    9.415309614264898e-67
+  34 66 39 36 37 33 32 35  35 35 65 64 30 32 32 30
+   1.9001750522685557e-52   1.5714416266046387e-76
+   1.9001750522685557e-52   1.5714416266046387e-76
+  32 36 64 37 62 35 32 36  35 66 33 38 64 32 31 35
+   1.2458781740518362e-47   1.7954340506875093e-52
+   1.2458781740518362e-47   1.7954340506875093e-52
+  34 31 35 31 39 65 34 61  31 65 35 35 30 34 34 64
+  1.7921321114043628e+160    4.99702895186069e+174
+  1.7921321114043628e+160    4.99702895186069e+174
+  35 62 39 65 31 37 65 31  35 63 64 62 61 66 32 39
+    9.606082105020187e-71    3.543696357985138e-33
+    9.606082105020187e-71    3.543696357985138e-33
+  61 65 33 37 39 32 65 39  39 65 38 38 33 65 37 61
+    3.265789475246571e-32  2.0557323335961284e+160
+    3.265789475246571e-32  2.0557323335961284e+160
+  30 31 22 5d 5d 2c 0a 22  30 31 30 30 30 30 30 30
+  1.0480224142302564e-144   1.3980432860953674e-76
+  1.0480224142302564e-144   1.3980432860953674e-76
+  30 31 30 30 30 31 30 30  30 30 30 30 30 30 30 30
+   1.3983806364295508e-76    1.398043286095289e-76
+   1.3983806364295508e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 36 61 34 37 33 30
+    1.398043286095289e-76   1.6594953185373452e-76
+    1.398043286095289e-76   1.6594953185373452e-76
+  34 34 30 32 32 30 36 37  32 38 38 65 61 35 30 61
+    9.949562552004172e-43  1.4242328604611153e+160
+    9.949562552004172e-43  1.4242328604611153e+160
+  61 37 39 39 35 34 33 61  35 33 36 66 66 39 33 30
+   1.687438625945927e+160   1.6602359336808823e-76
+   1.687438625945927e+160   1.6602359336808823e-76
+  36 66 38 65 31 63 62 61  30 35 62 39 63 36 62 31
+  1.2925570861634984e+161    8.246305819448886e-71
+  1.2925570861634984e+161    8.246305819448886e-71
+  30 39 35 31 31 37 35 62  39 32 34 66 39 36 37 33
+   1.221723265820281e+165   5.6424792601220865e-62
+   1.221723265820281e+165   5.6424792601220865e-62
+  32 35 35 35 65 64 30 32  32 30 32 36 64 37 62 35
+    6.080193522453417e-67    1.521502453877014e-51
+    6.080193522453417e-67    1.521502453877014e-51
+  32 36 35 66 33 38 64 32  31 35 34 31 35 31 39 65
+    5.999873676290842e-66    4.08341798378506e+179
+    5.999873676290842e-66    4.08341798378506e+179
+  34 61 31 65 35 35 30 34  34 64 35 62 39 65 31 37
+   2.5820588355316993e-57     7.80037021175825e-43
+   2.5820588355316993e-57     7.80037021175825e-43
+  65 31 35 63 64 62 61 66  32 39 61 65 33 37 39 32
+  1.4773577174029953e+185    9.352996243746986e-67
+  1.4773577174029953e+185    9.352996243746986e-67
+  65 39 39 65 38 38 33 65  37 61 30 31 32 31 30 33
+  3.1153153556142154e+179    3.936099003628407e-62
+  3.1153153556142154e+179    3.936099003628407e-62
+  62 61 38 63 38 62 38 36  64 65 61 31 33 31 63 32
+   1.6683986034189874e-47    5.695022361429609e-66
+   1.6683986034189874e-47    5.695022361429609e-66
+  32 61 62 39 36 37 65 36  64 64 39 39 62 64 61 65
+   1.1613081013703401e-46  2.2552777615145184e+180
+   1.1613081013703401e-46  2.2552777615145184e+180
+  38 65 66 66 37 61 31 66  37 35 61 32 63 33 35 66
+  1.8462092747053975e+184  2.2521028877662652e+184
+  1.8462092747053975e+184  2.2521028877662652e+184
+  31 66 39 34 34 31 30 39  65 33 66 65 35 65 32 32
+    3.118504827631565e-33    6.823213056314656e-67
+    3.118504827631565e-33    6.823213056314656e-67
+  66 66 66 66 66 66 66 66  30 31 30 30 30 30 30 30
+  1.9035985662552932e+185   1.3980432860953674e-76
+  1.9035985662552932e+185   1.3980432860953674e-76
+  30 30 30 30 30 30 30 30  30 30 30 31 35 31 30 30
+    1.398043286095289e-76   1.3983872304507443e-76
+    1.398043286095289e-76   1.3983872304507443e-76
+  30 30 30 30 30 30 22 2c  20 22 50 32 53 48 22 5d
+    4.257571555502434e-96   4.354357046338091e+140
+    4.257571555502434e-96   4.354357046338091e+140
+  2c 0a 0a 5b 22 54 68 65  20 66 6f 6c 6c 6f 77 69
+  3.1547533978051123e+180  1.1211576767985942e+200
+  3.1547533978051123e+180  1.1211576767985942e+200
+  6e 67 20 69 73 20 66 37  66 64 64 30 39 31 66 61
+    7.937586239309152e-42  1.5600179626524734e+161
+    7.937586239309152e-42  1.5600179626524734e+161
+  36 64 38 66 35 65 37 61  38 63 32 34 35 38 66 35
+  2.0557352560791822e+160   1.8558643976531312e-51
+  2.0557352560791822e+160   1.8558643976531312e-51
+  63 33 38 66 61 66 66 66  66 32 64 33 66 31 34 30
+  1.9035920817230982e+185    1.743898554957811e-76
+  1.9035920817230982e+185    1.743898554957811e-76
+  36 62 36 65 34 66 65 32  63 39 39 64 63 63 30 64
+    6.349934516995602e-66   4.053308827043796e+174
+    6.349934516995602e-66   4.053308827043796e+174
+  32 64 31 63 62 62 22 5d  2c 0a 5b 22 49 74 20 63
+   4.378601445889601e+140  3.1048843517045536e+169
+   4.378601445889601e+140  3.1048843517045536e+169
+  61 75 67 68 74 20 61 20  62 75 67 20 69 6e 20 74
+  1.0218986627488745e-152   2.352870907558315e+251
+  1.0218986627488745e-152   2.352870907558315e+251
+  68 65 20 77 6f 72 6b 61  72 6f 75 6e 64 20 66 6f
+  1.9294022948706076e+161   4.193340084022635e+228
+  1.9294022948706076e+161   4.193340084022635e+228
+  72 20 32 33 62 33 39 37  65 64 63 63 64 33 37 34
+    1.130039240325319e-42   3.6960928038038907e-57
+    1.130039240325319e-42   3.6960928038038907e-57
+  30 61 37 34 61 64 62 36  30 33 63 39 37 35 36 33
+   1.0067512889531142e-46    5.398435101295184e-62
+   1.0067512889531142e-46    5.398435101295184e-62
+  37 30 66 61 66 63 64 65  39 62 63 63 34 34 38 33
+  2.6437965385232166e+180     5.88364809403709e-62
+  2.6437965385232166e+180     5.88364809403709e-62
+  65 62 32 37 31 65 63 61  64 30 39 61 39 34 64 64
+  1.3634016051803616e+161   3.997650853112618e+175
+  1.3634016051803616e+161   3.997650853112618e+175
+  36 33 20 69 6e 20 61 6e  20 6f 76 65 72 6c 79 20
+   4.952678067381302e+223  3.0338883948742457e-152
+   4.952678067381302e+223  3.0338883948742457e-152
+  73 69 6d 70 6c 65 20 69  6d 70 6c 65 6d 65 6e 74
+   2.451263472472244e+198   6.964110925611375e+252
+   2.451263472472244e+198   6.964110925611375e+252
+  61 74 69 6f 6e 22 5d 2c  0a 5b 5b 5b 22 62 34 36
+    5.455931542188308e-95   1.3946844959644842e-47
+    5.455931542188308e-95   1.3946844959644842e-47
+  34 65 38 35 64 66 32 61  32 33 38 34 31 36 66 38
+   1.616794205777356e+160    5.221942822174234e-37
+   1.616794205777356e+160    5.221942822174234e-37
+  62 64 61 65 31 31 64 31  32 30 61 64 64 36 31 30
+    9.142686031376126e-71   1.4864978665962345e-76
+    9.142686031376126e-71   1.4864978665962345e-76
+  33 38 30 65 61 30 37 66  34 65 66 31 39 63 35 66
+   2.463310310116211e+184  2.2719524783037353e+184
+   2.463310310116211e+184  2.2719524783037353e+184
+  39 64 66 64 34 37 32 66  39 36 63 33 64 22 2c 20
+  1.9350040325024806e+184  1.0491775236059462e-153
+  1.9350040325024806e+184  1.0491775236059462e-153
+  30 2c 20 22 44 55 50 20  48 41 53 48 31 36 30 20
+   4.872704312904001e-153   1.209123040566424e-153
+   4.872704312904001e-153   1.209123040566424e-153
+  30 78 31 34 20 30 78 62  65 66 38 30 65 63 66 33
+  2.2286272130396896e+166    4.353828162867551e-61
+  2.2286272130396896e+166    4.353828162867551e-61
+  61 34 34 35 30 30 66 64  61 31 62 63 39 32 31 37
+   4.390260173772253e+175    7.711037466062681e-43
+   4.390260173772253e+175    7.711037466062681e-43
+  36 65 34 34 32 38 39 31  36 36 32 61 65 64 32 20
+   1.4273740242626592e-71  1.3717508504848812e-153
+   1.4273740242626592e-71  1.3717508504848812e-153
+  45 51 55 41 4c 56 45 52  49 46 59 20 43 48 45 43
+   2.1222872311647527e+88        11980855307308178
+   2.1222872311647527e+88        11980855307308178
+  4b 53 49 47 22 5d 2c 0a  5b 22 62 37 39 37 38 63
+  1.1529705937656371e-259   9.138920530117212e+169
+  1.1529705937656371e-259   9.138920530117212e+169
+  63 39 36 65 35 39 61 38  62 31 33 65 30 38 36 35
+   4.0492185720610555e-37   2.3198228365541834e-52
+   4.0492185720610555e-37   2.3198228365541834e-52
+  64 33 66 39 35 36 35 37  35 36 31 61 37 66 37 32
+    9.511677501466702e-43    8.679276266899241e-67
+    9.511677501466702e-43    8.679276266899241e-67
+  35 62 65 39 35 32 34 33  38 36 33 37 34 37 35 39
+    4.909405944099844e-62    4.085983732293199e-33
+    4.909405944099844e-62    4.085983732293199e-33
+  32 30 62 61 63 39 65 62  32 31 22 2c 20 31 2c 20
+   9.777738058102275e+165  1.0513238744588748e-153
+   9.777738058102275e+165  1.0513238744588748e-153
+  22 44 55 50 20 48 41 53  48 31 36 30 20 30 78 31
+   1.1265130357212166e+93    2.190386854601886e-70
+   1.1265130357212166e+93    2.190386854601886e-70
+  34 20 30 78 62 65 66 38  30 65 63 66 33 61 34 34
+   5.2652822366888435e-37   3.2466720168273316e-57
+   5.2652822366888435e-37   3.2466720168273316e-57
+  35 30 30 66 64 61 31 62  63 39 32 31 37 36 65 34
+   1.000871593756964e+165    2.703385168494558e-56
+   1.000871593756964e+165    2.703385168494558e-56
+  34 32 38 39 31 36 36 32  61 65 64 32 20 45 51 55
+    8.238773193968085e-67   9.670110542434824e+102
+    8.238773193968085e-67   9.670110542434824e+102
+  41 4c 56 45 52 49 46 59  20 43 48 45 43 4b 53 49
+  1.1509816729234979e+122   1.7210818849099444e+45
+  1.1509816729234979e+122   1.7210818849099444e+45
+  47 22 5d 5d 2c 0a 22 30  31 30 30 30 30 30 30 30
+    7.789711529715404e-77   1.3980432860952892e-76
+    7.789711529715404e-77   1.3980432860952892e-76
+  32 33 64 36 63 66 39 37  32 64 34 64 66 66 39 63
+   1.1389732108042386e-42    9.58586450966335e+169
+   1.1389732108042386e-42    9.58586450966335e+169
+  35 31 39 65 66 66 34 30  37 65 61 38 30 30 33 36
+    1.761778379182687e-76    1.312912369872855e-47
+    1.761778379182687e-76    1.312912369872855e-47
+  31 64 64 30 61 31 32 31  64 65 31 64 61 38 62 36
+   1.0296810402895926e-71    9.973433137046378e-47
+   1.0296810402895926e-71    9.973433137046378e-47
+  66 34 31 33 38 61 32 66  32 35 64 65 38 36 34 62
+    1.95243816994313e+184  1.1639185535338014e+165
+    1.95243816994313e+184  1.1639185535338014e+165
+  34 30 30 30 30 30 30 30  30 38 61 34 37 33 30 34
+     1.39804328609529e-76   2.5808186306984696e-57
+     1.39804328609529e-76   2.5808186306984696e-57
+  34 30 32 32 30 66 66 64  61 34 37 62 66 63 37 37
+   4.431997143547052e+175   1.0487667919784995e-42
+   4.431997143547052e+175   1.0487667919784995e-42
+  36 62 63 64 32 36 39 64  61 34 38 33 32 36 32 36
+   6.235621471436775e+174   1.2460953191701965e-47
+   6.235621471436775e+174   1.2460953191701965e-47
+  61 63 33 33 32 61 64 66  63 61 36 64 64 38 33 35
+  1.7319069133573818e+185    2.006691056724102e-52
+  1.7319069133573818e+185    2.006691056724102e-52
+  65 38 65 63 64 38 33 63  64 31 65 62 65 37 64 37
+   7.253662132026097e+169    7.252274512815242e-42
+   7.253662132026097e+169    7.252274512815242e-42
+  30 39 62 30 65 30 32 32  30 34 39 63 66 66 61 31
+    6.746691395999728e-67    7.878440712850493e-71
+    6.746691395999728e-67    7.878440712850493e-71
+  63 64 63 31 30 32 61 30  62 35 36 65 30 65 30 34
+    1.188063742793398e-75   2.6119171547178294e-57
+    1.188063742793398e-75   2.6119171547178294e-57
+  39 31 33 36 30 36 63 37  30 61 66 37 30 32 61 31
+    6.891849749921644e-42    7.786094707013923e-71
+    6.891849749921644e-42    7.786094707013923e-71
+  31 34 39 64 63 33 62 33  30 35 61 62 39 34 33 39
+    3.539482941043748e-61    3.698555983619881e-33
+    3.539482941043748e-61    3.698555983619881e-33
+  32 38 38 66 65 65 30 39  30 30 31 34 31 30 34 32
+    3.157769851603859e-33    7.488238400766758e-67
+    3.157769851603859e-33    7.488238400766758e-67
+  36 36 61 62 62 33 36 64  36 36 65 62 34 32 31 38
+   5.490912984462439e+174    5.053483075673739e-38
+   5.490912984462439e+174    5.053483075673739e-38
+  61 36 64 64 33 31 66 30  39 62 62 39 32 63 66 33
+    1.533243977422757e-75    4.353676933478981e-61
+    1.533243977422757e-75    4.353676933478981e-61
+  63 66 61 38 30 33 63 37  65 61 37 32 63 31 66 63
+     6.88764590115235e-42   6.700419652876585e+170
+     6.88764590115235e-42   6.700419652876585e+170
+  38 30 61 35 30 66 39 31  39 32 37 33 65 36 31 33
+   1.4375422530832016e-71    4.184122520670393e-62
+   1.4375422530832016e-71    4.184122520670393e-62
+  66 38 39 35 62 38 35 35  66 62 37 34 36 35 63 63
+   2.2154973211035484e-52   5.799178849994375e+170
+   2.2154973211035484e-52   5.799178849994375e+170
+  62 63 38 39 31 39 61 64  31 62 64 34 61 33 30 36
+    3.40789780195847e+175   1.1084970116721745e-47
+    3.40789780195847e+175   1.1084970116721745e-47
+  63 37 38 33 66 32 32 63  64 33 32 32 37 33 32 37
+   6.867431098636301e+169    8.161189598506392e-43
+   6.867431098636301e+169    8.161189598506392e-43
+  36 39 34 63 34 66 61 34  63 31 63 34 33 39 61 66
+    2.217486681404374e-56   1.463683529719741e+185
+    2.217486681404374e-56   1.463683529719741e+185
+  66 66 66 66 66 66 66 32  31 65 62 63 39 62 61 32
+    6.646897422031859e-66    5.158374647951955e-66
+    6.646897422031859e-66    5.158374647951955e-66
+  30 35 39 34 37 33 37 38  36 34 33 35 32 65 39 35
+     6.81788518931691e-38    2.651392757313716e-52
+     6.81788518931691e-38    2.651392757313716e-52
+  62 37 32 37 66 31 61 35  36 35 37 35 36 66 39 64
+   1.4360235192722492e-51   6.282010322142857e+174
+   1.4360235192722492e-51   6.282010322142857e+174
+  33 36 35 30 38 33 65 62  31 61 38 35 39 36 65 63
+   9.766637043900164e+165   6.404206039952375e+170
+   9.766637043900164e+165   6.404206039952375e+170
+  39 38 63 39 37 62 37 30  31 30 30 30 30 30 30 38
+   2.0194518734384086e-76    4.757294784504317e-38
+   2.0194518734384086e-76    4.757294784504317e-38
+  61 34 37 33 30 34 34 30  32 32 30 35 30 33 66 66
+   1.7448394452195557e-76  1.8865982703855272e+185
+   1.7448394452195557e-76  1.8865982703855272e+185
+  31 30 65 39 66 31 65 30  64 65 37 33 31 34 30 37
+   1.4642082171312281e-75    7.266069178023031e-43
+   1.4642082171312281e-75    7.266069178023031e-43
+  61 34 61 32 34 35 35 33  31 63 39 66 66 31 37 36
+   5.1553373378487425e-62   1.5869273182530492e-47
+   5.1553373378487425e-62   1.5869273182530492e-47
+  37 36 65 64 61 34 36 31  66 38 63 65 65 62 38 63
+   1.2567364504382765e-71   9.202565718892153e+169
+   1.2567364504382765e-71   9.202565718892153e+169
+  30 36 30 34 39 66 61 32  63 38 31 30 32 32 30 63
+     5.16301032089012e-66   6.112339097871379e+169
+     5.16301032089012e-66   6.112339097871379e+169
+  30 30 38 61 63 33 34 36  39 34 35 31 30 32 39 38
+    1.382190388903161e-47    7.404452979117836e-38
+    1.382190388903161e-47    7.404452979117836e-38
+  66 61 36 30 62 33 66 30  30 30 64 66 30 31 63 61
+   1.5338330714121296e-75  1.3491219511649723e+161
+   1.5338330714121296e-75  1.3491219511649723e+161
+  61 32 34 34 66 31 36 35  62 37 32 37 64 34 38 39
+     2.31705373790929e-52    4.661646825733252e-33
+     2.31705373790929e-52    4.661646825733252e-33
+  36 65 62 38 34 66 38 31  65 34 36 62 63 63 34 30
+   1.3809477234443722e-71   1.7607623593531628e-76
+   1.3809477234443722e-71   1.7607623593531628e-76
+  31 34 31 30 34 32 36 36  61 62 62 33 36 64 36 36
+   1.5187193953505563e-47   1.5320853200168822e-47
+   1.5187193953505563e-47   1.5320853200168822e-47
+  65 62 34 32 31 38 61 36  64 64 33 31 66 30 39 62
+    9.425648378767716e-47   1.450539603035576e+165
+    9.425648378767716e-47   1.450539603035576e+165
+  62 39 32 63 66 33 63 66  61 38 30 33 63 37 65 61
+   1.631722289953857e+185   1.491415048001736e+161
+   1.631722289953857e+185   1.491415048001736e+161
+  37 32 63 31 66 63 38 30  61 35 30 66 39 31 39 32
+   2.1062128035555203e-76     9.34433676850344e-67
+   2.1062128035555203e-76     9.34433676850344e-67
+  37 33 65 36 31 33 66 38  39 35 62 38 35 35 66 62
+    5.219187787778687e-37  1.0230904083338536e+166
+    5.219187787778687e-37  1.0230904083338536e+166
+  37 34 36 35 63 63 62 63  38 39 31 39 61 64 31 62
+   5.551719893725792e+170  1.0015436402997764e+165
+   5.551719893725792e+170  1.0015436402997764e+165
+  64 34 61 33 30 36 63 37  38 33 66 32 32 63 64 33
+    6.891849689618424e-42    3.964738397646575e-61
+    6.891849689618424e-42    3.964738397646575e-61
+  32 32 37 33 32 37 36 39  34 63 34 66 61 34 63 31
+    4.278570803521082e-33    8.695539790511108e-71
+    4.278570803521082e-33    8.695539790511108e-71
+  63 34 33 39 61 66 66 66  66 66 66 66 66 30 31 66
+  1.9035918536845453e+185   1.825952830930392e+184
+  1.9035918536845453e+185   1.825952830930392e+184
+  30 64 61 35 32 30 30 30  30 30 30 30 30 30 30 31
+   1.3980459483719217e-76    9.162216479754085e-72
+   1.3980459483719217e-76    9.162216479754085e-72
+  39 37 36 61 39 31 34 38  35 37 63 63 64 34 32 64
+    5.933978295132078e-38   4.502565075733062e+174
+    5.933978295132078e-38   4.502565075733062e+174
+  64 65 64 36 64 66 33 32  39 34 39 64 34 36 34 36
+    7.195847551349293e-67   1.3829431602777172e-47
+    7.195847551349293e-67   1.3829431602777172e-47
+  64 66 61 31 30 61 39 32  34 35 38 63 66 61 61 38
+    9.413832278126917e-67   4.0861285214862295e-37
+    9.413832278126917e-67   4.0861285214862295e-37
+  38 61 63 30 30 30 30 30  30 30 30 22 2c 20 22 50
+     1.39804328712463e-76   1.0494047973278671e+78
+     1.39804328712463e-76   1.0494047973278671e+78
+  32 53 48 22 5d 2c 0a 0a  5b 22 54 68 65 20 66 6f
+   2.659819575045378e-260   4.193342906567174e+228
+   2.659819575045378e-260   4.193342906567174e+228
+  6c 6c 6f 77 69 6e 67 20  74 65 73 74 73 20 66 6f
+   1.398068761973825e-152   4.193383528563403e+228
+   1.398068761973825e-152   4.193383528563403e+228
+  72 20 74 68 65 20 70 72  65 73 65 6e 63 65 20 6f
+  1.7205128091698176e+243   1.942074726963082e+227
+  1.7205128091698176e+243   1.942074726963082e+227
+  66 20 61 20 62 75 67 20  69 6e 20 74 68 65 20 68
+  1.3996935913082537e-152   3.740317353142523e+193
+  1.3996935913082537e-152   3.740317353142523e+193
+  61 6e 64 6c 69 6e 67 20  6f 66 20 53 49 47 48 41
+  1.3980687227005626e-152       3182226.6494262735
+  1.3980687227005626e-152       3182226.6494262735
+  53 48 5f 53 49 4e 47 4c  45 22 5d 2c 0a 5b 22 49
+   2.9258583510608366e+59   2.0467204669331055e+44
+   2.9258583510608366e+59   2.0467204669331055e+44
+  74 20 72 65 73 75 6c 74  73 20 69 6e 20 73 69 67
+    6.52022889093812e+252  1.4173926646890327e+190
+    6.52022889093812e+252  1.4173926646890327e+190
+  6e 69 6e 67 20 74 68 65  20 63 6f 6e 73 74 61 6e
+   3.170958581488935e+180   5.047587090516669e+223
+   3.170958581488935e+180   5.047587090516669e+223
+  74 20 31 2c 20 69 6e 73  74 65 61 64 20 6f 66 20
+  1.0631440457342009e+248  1.3385685792405213e-152
+  1.0631440457342009e+248  1.3385685792405213e-152
+  73 6f 6d 65 74 68 69 6e  67 20 67 65 6e 65 72 61
+   7.347468315751314e+223  2.5863434016875814e+161
+   7.347468315751314e+223  2.5863434016875814e+161
+  74 65 64 20 62 61 73 65  64 20 6f 6e 20 74 68 65
+   5.026205389308844e+180   3.170958635614038e+180
+   5.026205389308844e+180   3.170958635614038e+180
+  20 74 72 61 6e 73 61 63  74 69 6f 6e 2c 22 5d 2c
+   5.268724183673267e+170    5.455742938366508e-95
+   5.268724183673267e+170    5.455742938366508e-95
+  0a 5b 22 77 68 65 6e 20  74 68 65 20 69 6e 70 75
+  1.8136372730777569e-152   4.934327929384365e+257
+  1.8136372730777569e-152   4.934327929384365e+257
+  74 20 64 6f 69 6e 67 20  74 68 65 20 73 69 67 6e
+  1.3980687333655759e-152   6.770234260216546e+223
+  1.3980687333655759e-152   6.770234260216546e+223
+  69 6e 67 20 68 61 73 20  61 6e 20 69 6e 64 65 78
+  2.3127413753846732e-152   9.041152192173826e+271
+  2.3127413753846732e-152   9.041152192173826e+271
+  20 67 72 65 61 74 65 72  20 74 68 61 6e 20 74 68
+   1.144477254359908e+243  1.4692288291861106e+195
+   1.144477254359908e+243  1.4692288291861106e+195
+  65 20 6d 61 78 69 6d 75  6d 20 6f 75 74 70 75 74
+   4.416220665102427e+257    9.82395831412734e+252
+   4.416220665102427e+257    9.82395831412734e+252
+  20 69 6e 64 65 78 22 5d  2c 0a 5b 5b 5b 22 30 30
+   4.399080144526423e+140   1.3933772679372857e-76
+   4.399080144526423e+140   1.3933772679372857e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 31 30 30 22 2c
+    1.398043286095289e-76    4.257571569454917e-96
+    1.398043286095289e-76    4.257571569454917e-96
+  20 30 2c 20 22 44 55 50  20 48 41 53 48 31 36 30
+    9.849805770138774e+78   1.9165825568371944e-76
+    9.849805770138774e+78   1.9165825568371944e-76
+  20 30 78 31 34 20 30 78  65 35 32 62 34 38 32 66
+    8.51917005130799e+270    1.93541897010541e+184
+    8.51917005130799e+270    1.93541897010541e+184
+  32 66 61 61 38 65 63 62  66 30 64 62 33 34 34 66
+   8.935239124908581e+165  2.1462127413362145e+184
+   8.935239124908581e+165  2.1462127413362145e+184
+  39 33 63 38 34 61 63 39  30 38 35 35 37 66 33 33
+    2.985916036157729e-32    4.715703719816306e-62
+    2.985916036157729e-32    4.715703719816306e-62
+  20 45 51 55 41 4c 56 45  52 49 46 59 20 43 48 45
+   1.0782589228142278e+26    5.866242990764692e+25
+   1.0782589228142278e+26    5.866242990764692e+25
+  43 4b 53 49 47 22 5d 2c  20 5b 22 30 30 30 30 30
+   5.4558196757959444e-95   1.3980432858171544e-76
+   5.4558196757959444e-95   1.3980432858171544e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  32 30 30 22 2c 20 30 2c
+    1.398043286095289e-76    7.549518397495306e-96
+    1.398043286095289e-76    7.549518397495306e-96
+  20 22 31 22 5d 5d 2c 0a  22 30 31 30 30 30 30 30
+  1.1530070992335211e-259   1.3980432861153922e-76
+  1.1530070992335211e-259   1.3980432861153922e-76
+  30 30 32 30 30 30 32 30  30 30 30 30 30 30 30 30
+    1.570766657237393e-76    1.398043286095289e-76
+    1.570766657237393e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 31 35 31 66
+    1.398043286095289e-76   1.827941337524952e+184
+    1.398043286095289e-76   1.827941337524952e+184
+  66 66 66 66 66 66 66 30  30 30 31 30 30 30 30 30
+   1.5476014050729244e-75   1.3980432861153965e-76
+   1.5476014050729244e-75   1.3980432861153965e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 36
+    1.398043286095289e-76    1.107644006727337e-47
+    1.398043286095289e-76    1.107644006727337e-47
+  62 34 38 33 30 34 35 30  32 32 31 30 30 63 39 63
+    1.831201130790608e-76   9.581129762526926e+169
+    1.831201130790608e-76   9.581129762526926e+169
+  64 64 30 38 37 39 38 61  32 38 61 66 39 64 31 62
+  2.1285045517529488e+160   1.001508647637225e+165
+  2.1285045517529488e+160   1.001508647637225e+165
+  61 66 34 34 61 36 63 37  37 62 63 63 37 65 32 37
+    6.892117924542463e-42    8.248772067316336e-43
+    6.892117924542463e-42    8.248772067316336e-43
+  39 66 34 37 64 63 34 38  37 63 38 63 38 39 39 39
+    5.991567563093536e-38    4.857872603087972e-33
+    5.991567563093536e-38    4.857872603087972e-33
+  31 31 62 63 34 38 66 65  61 66 66 63 63 30 32 32
+  2.8812614402798604e+180    6.746681204299738e-67
+  2.8812614402798604e+180    6.746681204299738e-67
+  30 35 30 33 63 35 63 35  30 61 65 33 39 39 38 61
+    1.604372531173315e-51  2.1285072082114646e+160
+    1.604372531173315e-51  2.1285072082114646e+160
+  37 33 33 32 36 33 63 35  63 30 66 37 30 36 31 62
+    1.603662644497493e-51   9.911530764067563e+164
+    1.603662644497493e-51   9.911530764067563e+164
+  34 38 33 65 32 62 35 36  63 34 63 34 31 62 34 35
+   1.4631240174660308e-47     2.12814330713799e-52
+   1.4631240174660308e-47     2.12814330713799e-52
+  36 65 37 64 32 66 35 61  37 38 61 37 34 63 30 37
+  1.8803356430252374e+160    7.348416100912256e-43
+  1.8803356430252374e+160    7.348416100912256e-43
+  37 30 33 32 31 30 32 64  35 63 32 35 61 64 62 35
+   4.498507341000678e+174   1.5361805605348867e-51
+   4.498507341000678e+174   1.5361805605348867e-51
+  31 62 36 31 33 33 39 64  32 62 30 35 33 31 35 37
+   6.232726087821482e+174    9.502905588979993e-43
+   6.232726087821482e+174    9.502905588979993e-43
+  39 31 65 32 31 62 62 65  38 30 65 61 34 37 30 61
+   2.383840051419113e+180  1.4248589850617474e+160
+   2.383840051419113e+180  1.4248589850617474e+160
+  34 39 64 62 30 31 33 35  37 32 30 39 38 33 63 39
+   2.0037533839083256e-52   2.9582402045158424e-32
+   2.0037533839083256e-52   2.9582402045158424e-32
+  30 35 61 61 63 65 30 66  66 66 66 66 66 66 66 30
+  1.7417127703818395e+184   1.5476014050729244e-75
+  1.7417127703818395e+184   1.5476014050729244e-75
+  31 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432860952892e-76    1.398043286095289e-76
+   1.3980432860952892e-76    1.398043286095289e-76
+  30 30 31 35 31 30 30 30  30 30 30 30 30 22 2c 20
+   1.3980446296279274e-76  1.0491479271301769e-153
+   1.3980446296279274e-76  1.0491479271301769e-153
+  22 50 32 53 48 22 5d 2c  0a 0a 5b 22 41 6e 20 69
+    5.455822643446265e-95   2.456420615891624e+198
+    5.455822643446265e-95   2.456420615891624e+198
+  6e 76 61 6c 69 64 20 50  32 53 48 20 54 72 61 6e
+      9.4904548980669e+77   5.045189744103289e+223
+      9.4904548980669e+77   5.045189744103289e+223
+  73 61 63 74 69 6f 6e 22  5d 2c 0a 5b 5b 5b 22 30
+  7.7995270585258335e-143    7.926648032307966e-77
+  7.7995270585258335e-143    7.926648032307966e-77
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 31 30 30 22
+    1.398043286095289e-76   5.185635643610081e-144
+    1.398043286095289e-76   5.185635643610081e-144
+  2c 20 30 2c 20 22 48 41  53 48 31 36 30 20 30 78
+        3163200.345218679   8.519137955491178e+270
+        3163200.345218679   8.519137955491178e+270
+  31 34 20 30 78 37 61 30  35 32 63 38 34 30 62 61
+   1.1894890427564785e-75  1.2785559289638903e+161
+   1.1894890427564785e-75  1.2785559289638903e+161
+  37 33 61 66 32 36 37 35  35 64 65 34 32 63 66 30
+   2.4234152385088695e-52    1.546736738923052e-75
+   2.4234152385088695e-52    1.546736738923052e-75
+  31 63 63 39 65 30 61 34  39 66 65 66 30 20 45 51
+   2.1906982276739074e-56    3.206274613915499e+83
+   2.1906982276739074e-56    3.206274613915499e+83
+  55 41 4c 22 5d 5d 2c 0a  22 30 31 30 30 30 30 30
+  1.1530070994902142e-259   1.3980432861153922e-76
+  1.1530070994902142e-259   1.3980432861153922e-76
+  30 30 31 30 30 30 31 30  30 30 30 30 30 30 30 30
+    1.484404971666341e-76    1.398043286095289e-76
+    1.484404971666341e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 39 30 38 35
+    1.398043286095289e-76    2.525383935230488e-52
+    1.398043286095289e-76    2.525383935230488e-52
+  37 36 38 36 31 37 34 32  30 36 39 37 33 32 30 66
+    7.498380806158792e-67  1.7204721706447573e+184
+    7.498380806158792e-67  1.7204721706447573e+184
+  66 66 66 66 66 66 66 30  31 30 30 30 30 30 30 30
+   1.5476014050729244e-75   1.3980432860952892e-76
+   1.5476014050729244e-75   1.3980432860952892e-76
+  30 30 30 30 30 30 30 30  30 30 31 35 31 30 30 30
+    1.398043286095289e-76   1.3980446296279274e-76
+    1.398043286095289e-76   1.3980446296279274e-76
+  30 30 30 30 30 22 2c 20  22 4e 4f 4e 45 22 5d 2c
+  1.0491479271301769e-153    5.455814016495002e-95
+  1.0491479271301769e-153    5.455814016495002e-95
+  0a 0a 5b 22 41 20 76 61  6c 69 64 20 50 32 53 48
+   3.110716844856841e+161    2.612896964811324e+40
+   3.110716844856841e+161    2.612896964811324e+40
+  20 54 72 61 6e 73 61 63  74 69 6f 6e 20 75 73 69
+    5.26872418366448e+170   9.308608393075139e+199
+    5.26872418366448e+170   9.308608393075139e+199
+  6e 67 20 74 68 65 20 73  74 61 6e 64 61 72 64 20
+  3.5825122906950005e+246  1.2199935258941964e-152
+  3.5825122906950005e+246  1.2199935258941964e-152
+  74 72 61 6e 73 61 63 74  69 6f 6e 20 74 79 70 65
+  4.4403286158739545e+252   4.272556019691877e+180
+  4.4403286158739545e+252   4.272556019691877e+180
+  20 70 75 74 20 66 6f 72  74 68 20 69 6e 20 42 49
+  1.6749482925776018e+243     8.08477155041881e+44
+  1.6749482925776018e+243     8.08477155041881e+44
+  50 20 31 36 22 5d 2c 0a  5b 5b 5b 22 30 30 30 30
+  1.1529705523474614e-259    1.398043214897502e-76
+  1.1529705523474614e-259    1.398043214897502e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 31 30 30 22 2c 20 30
+    1.398043286095289e-76    6.983377179561166e-77
+    1.398043286095289e-76    6.983377179561166e-77
+  2c 20 22 48 41 53 48 31  36 30 20 30 78 31 34 20
+   2.7535167424148395e-71  1.5060806567872225e-153
+   2.7535167424148395e-71  1.5060806567872225e-153
+  30 78 38 66 65 62 62 65  64 34 30 34 38 33 36 36
+   2.383943341427771e+180   1.5189908643137677e-47
+   2.383943341427771e+180   1.5189908643137677e-47
+  31 64 65 36 39 35 38 64  39 35 37 34 31 32 66 38
+   5.987350675301635e+174    5.218269402273609e-37
+   5.987350675301635e+174    5.218269402273609e-37
+  32 64 65 65 64 38 65 32  66 37 20 45 51 55 41 4c
+    6.296832018125097e-66    2.176054151177521e+59
+    6.296832018125097e-66    2.176054151177521e+59
+  22 5d 5d 2c 0a 22 30 31  30 30 30 30 30 30 30 31
+    9.130936148260522e-72    9.162216479754085e-72
+    9.130936148260522e-72    9.162216479754085e-72
+  30 30 30 31 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432912428464e-76    1.398043286095289e-76
+   1.3980432912428464e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  36 65 34 39 33 30 34 36
+    1.398043286095289e-76   1.3813382819587834e-47
+    1.398043286095289e-76   1.3813382819587834e-47
+  30 32 32 31 30 30 63 36  36 63 39 63 64 66 34 63
+   1.0503298724581754e-46   7.698871757977705e+169
+   1.0503298724581754e-46   7.698871757977705e+169
+  34 33 36 30 39 35 38 36  64 31 35 34 32 34 63 35
+   1.6563719982434718e-47    1.603983821822357e-51
+   1.6563719982434718e-47    1.603983821822357e-51
+  34 37 30 37 31 35 36 65  33 31 36 64 38 38 62 30
+  3.5996694559692454e+179   1.2587810158898464e-75
+  3.5996694559692454e+179   1.2587810158898464e-75
+  61 31 35 33 34 63 39 65  36 62 30 64 34 66 33 31
+   4.115073821229468e+179   1.0979579000061427e-71
+   4.115073821229468e+179   1.0979579000061427e-71
+  31 34 30 36 33 31 30 32  32 31 30 30 39 63 30 66
+    6.006016212875422e-67   1.740814477814701e+184
+    6.006016212875422e-67   1.740814477814701e+184
+  65 35 31 64 62 63 39 63  34 61 62 37 63 63 32 35
+   9.581418862728462e+169   1.9198210689358364e-52
+   9.581418862728462e+169   1.9198210689358364e-52
+  64 33 66 64 62 65 63 63  66 36 36 37 39 66 65 36
+   5.855991856509056e+170    1.171360195308999e-46
+   5.855991856509056e+170    1.171360195308999e-46
+  38 32 37 66 30 38 65 64  66 32 62 34 61 39 66 31
+   4.198579690656411e+175   1.0062733744363508e-70
+   4.198579690656411e+175   1.0062733744363508e-70
+  36 65 65 33 65 62 30 65  34 33 38 61 30 31 32 33
+  2.6557477819328377e+179    4.422265349717772e-62
+  2.6557477819328377e+179    4.422265349717772e-62
+  32 31 30 33 33 38 65 38  30 33 34 35 30 39 61 66
+    4.988687822129755e-37  1.4636796436843988e+185
+    4.988687822129755e-37  1.4636796436843988e+185
+  35 36 34 63 36 32 36 34  34 63 30 37 36 39 31 39
+    3.536049489607066e-57    3.317122264652466e-33
+    3.536049489607066e-57    3.317122264652466e-33
+  34 32 65 30 63 30 35 36  37 35 32 30 30 38 61 31
+    1.449811136948061e-47    7.796706636518185e-71
+    1.449811136948061e-47    7.796706636518185e-71
+  37 33 63 38 39 66 36 30  61 62 32 61 38 38 61 63
+   1.9344422196257325e-76    5.19889297502465e+170
+   1.9344422196257325e-76    5.19889297502465e+170
+  32 65 62 66 61 63 66 66  66 66 66 66 66 66 30 31
+  1.9025961988214466e+185     9.28207105579738e-72
+  1.9025961988214466e+185     9.28207105579738e-72
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 31 35 31 30 30 30 30  30 30 30 30 22 2c 20 22
+   1.3980432913434632e-76     2.5902785586997e-144
+   1.3980432913434632e-76     2.5902785586997e-144
+  50 32 53 48 22 5d 2c 0a  0a 5b 22 54 65 73 74 73
+  1.1529705962819529e-259   1.429901101322202e+248
+  1.1529705962819529e-259   1.429901101322202e+248
+  20 66 6f 72 20 43 68 65  63 6b 54 72 61 6e 73 61
+  3.1461385660899335e+180   2.731849332167939e+161
+  3.1461385660899335e+180   2.731849332167939e+161
+  63 74 69 6f 6e 28 29 22  5d 2c 0a 5b 22 4d 41 58
+  4.0294621270696127e-144  1.3634122910806213e+117
+  4.0294621270696127e-144  1.3634122910806213e+117
+  5f 4d 4f 4e 45 59 20 6f  75 74 70 75 74 22 5d 2c
+   1.936468041999203e+227   5.4559487542763184e-95
+   1.936468041999203e+227   5.4559487542763184e-95
+  0a 5b 5b 5b 22 30 30 30  30 30 30 30 30 30 30 30
+   1.3980250594618592e-76    1.398043286095289e-76
+   1.3980250594618592e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 31 30 30 22 2c 20  30 2c 20 22 48 41 53 48
+  1.0491479271388595e-153    2.620855731499427e+40
+  1.0491479271388595e-153    2.620855731499427e+40
+  31 36 30 20 30 78 31 34  20 30 78 33 32 61 66 61
+    2.783049419442401e-57  1.5731908786813003e+161
+    2.783049419442401e-57  1.5731908786813003e+161
+  63 32 38 31 34 36 32 62  38 32 32 61 64 62 65 63
+  1.0487426665422638e+165   6.456296910840029e+170
+  1.0487426665422638e+165   6.456296910840029e+170
+  35 30 39 34 62 38 64 34  64 33 33 37 64 64 35 62
+     2.57701714281223e-56  1.2318906558244022e+165
+     2.57701714281223e-56  1.2318906558244022e+165
+  64 36 61 20 45 51 55 41  4c 22 5d 5d 2c 0a 22 30
+        5588244.505933378    7.789711529715412e-77
+        5588244.505933378    7.789711529715412e-77
+  31 30 30 30 30 30 30 30  31 30 30 30 31 30 30 30
+   1.3980432860952892e-76    1.398044603870032e-76
+   1.3980432860952892e-76    1.398044603870032e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 36 65 34 39 33 30 34  36 30 32 32 31 30 30 65
+    2.580823492577234e-57  2.6239608671416364e+179
+    2.580823492577234e-57  2.6239608671416364e+179
+  31 65 61 64 62 61 30 30  64 39 32 39 36 63 37 34
+    1.414639609869852e-76    3.725851056694263e-57
+    1.414639609869852e-76    3.725851056694263e-57
+  33 63 62 36 65 63 63 37  30 33 66 64 39 64 64 63
+    6.955198297330882e-42   6.156540604840217e+170
+    6.955198297330882e-42   6.156540604840217e+170
+  39 62 33 63 64 31 32 39  30 36 31 37 36 61 32 32
+    3.503832415094906e-33    6.817422059932195e-67
+    3.503832415094906e-33    6.817422059932195e-67
+  36 61 65 34 63 31 38 64  36 62 30 30 37 39 36 30
+   5.983644614715708e+174   1.9192587768357354e-76
+   5.983644614715708e+174   1.9192587768357354e-76
+  32 32 31 30 30 61 37 31  61 65 66 37 64 32 38 37
+   1.3232408175228687e-71   1.0850239068511913e-42
+   1.3232408175228687e-71   1.0850239068511913e-42
+  34 64 65 66 66 36 38 31  62 61 36 30 38 30 66 31
+   1.3703789355872827e-71   1.0046532179582825e-70
+   1.3703789355872827e-71   1.0046532179582825e-70
+  62 32 37 38 62 61 63 37  62 62 39 39 63 36 31 62
+    6.952379318092634e-42   9.911978960699464e+164
+    6.952379318092634e-42   9.911978960699464e+164
+  30 38 61 38 35 66 34 33  31 31 39 37 30 66 66 65
+   4.9587828816530265e-62    2.90455368685183e+180
+   4.9587828816530265e-62    2.90455368685183e+180
+  37 66 36 33 66 30 31 32  33 32 31 30 33 30 63 30
+     6.37577650327146e-67   1.3257058368740933e-75
+     6.37577650327146e-67   1.3257058368740933e-75
+  35 38 38 64 63 34 34 64  39 32 62 64 63 62 66 38
+  4.9972221169829095e+174   5.2625304816092436e-37
+  4.9972221169829095e+174   5.2625304816092436e-37
+  65 37 32 30 39 33 34 36  36 37 36 36 66 64 63 32
+   1.3821463389245497e-47    5.754368839723761e-66
+   1.3821463389245497e-47    5.754368839723761e-66
+  36 35 65 61 64 38 64 62  36 34 35 31 37 62 30 63
+   9.315256749899927e+165   6.183129709229681e+169
+   9.315256749899927e+165   6.183129709229681e+169
+  35 34 32 32 37 35 62 37  30 66 66 66 62 61 63 66
+     6.53175427573403e-42  1.6469873365812152e+185
+     6.53175427573403e-42  1.6469873365812152e+185
+  66 66 66 66 66 66 66 30  31 30 30 34 30 30 37 35
+   1.5476014050729244e-75    2.420964750807373e-52
+   1.5476014050729244e-75    2.420964750807373e-52
+  61 66 30 37 35 30 37 30  30 30 31 35 31 30 30 30
+    2.002581709862774e-76   1.3980446296279274e-76
+    2.002581709862774e-76   1.3980446296279274e-76
+  30 30 30 30 30 22 2c 20  22 50 32 53 48 22 5d 2c
+  1.0491479271301769e-153    5.455822643446265e-95
+  1.0491479271301769e-153    5.455822643446265e-95
+  0a 0a 5b 22 4d 41 58 5f  4d 4f 4e 45 59 20 6f 75
+  1.9849090405214584e+151  4.6736337551908693e+257
+  1.9849090405214584e+151  4.6736337551908693e+257
+  74 70 75 74 20 2b 20 30  20 6f 75 74 70 75 74 22
+    6.981679007274385e-77  1.0485788638568038e-142
+    6.981679007274385e-77  1.0485788638568038e-142
+  5d 2c 0a 5b 5b 5b 22 30  30 30 30 30 30 30 30 30
+    7.926648032307966e-77    1.398043286095289e-76
+    7.926648032307966e-77    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 31 30 30 22  2c 20 30 2c 20 22 48 41
+   5.185635643610081e-144        3163200.345218679
+   5.185635643610081e-144        3163200.345218679
+  53 48 31 36 30 20 30 78  31 34 20 30 78 62 35 35
+   8.519137955491178e+270   2.2326612616308972e-52
+   8.519137955491178e+270   2.2326612616308972e-52
+  38 63 62 66 34 39 33 30  39 35 34 61 61 36 61 33
+   1.6601700458322447e-76   3.3472866801397116e-61
+   1.6601700458322447e-76   3.3472866801397116e-61
+  34 34 33 36 33 61 31 35  36 36 38 64 37 34 37 37
+   1.8145240586078308e-52    1.040502010151644e-42
+   1.8145240586078308e-52    1.040502010151644e-42
+  61 65 37 31 36 20 45 51  55 41 4c 22 5d 5d 2c 0a
+    3.206288027888972e+83  1.1530070994902142e-259
+    3.206288027888972e+83  1.1530070994902142e-259
+  22 30 31 30 30 30 30 30  30 30 31 30 30 30 31 30
+   1.3980432861153922e-76    1.484404971666341e-76
+   1.3980432861153922e-76    1.484404971666341e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 36 64 34 38 33  30 34 35 30 32 32 30 32
+     5.88382548102587e-62    6.007459329508868e-67
+     5.88382548102587e-62    6.007459329508868e-67
+  37 64 65 63 63 63 31 34  61 61 36 36 36 38 65 37
+    2.770105699666968e-57    7.612150003783641e-42
+    2.770105699666968e-57    7.612150003783641e-42
+  38 61 38 63 39 64 61 33  34 38 34 66 62 63 64 34
+    3.382111698218719e-61    2.598424695043341e-56
+    3.382111698218719e-61    2.598424695043341e-56
+  66 39 64 63 63 39 62 62  37 64 31 62 38 35 31 34
+   8.395671795555367e+165   2.7413752907547064e-57
+   8.395671795555367e+165   2.7413752907547064e-57
+  36 33 31 34 62 32 31 62  39 61 65 34 64 38 36 30
+     9.9029721734521e+164   1.9189807480208407e-76
+     9.9029721734521e+164   1.9189807480208407e-76
+  32 32 31 30 30 64 30 62  34 33 64 65 63 65 38 63
+   9.439144568267418e+164   9.206976813975513e+169
+   9.439144568267418e+164   9.206976813975513e+169
+  66 62 30 37 33 34 38 64  65 30 63 61 38 62 63 35
+   5.986361908835906e+174   1.6189998938629599e-51
+   5.986361908835906e+174   1.6189998938629599e-51
+  62 38 36 32 37 36 66 61  38 38 66 37 66 32 31 33
+  1.5613887845594167e+161    4.180328063396017e-62
+  1.5613887845594167e+161    4.180328063396017e-62
+  38 33 38 31 31 32 38 62  37 63 33 36 61 62 32 65
+  1.3933568271220147e+165   2.979918819632362e+179
+  1.3933568271220147e+165   2.979918819632362e+179
+  34 32 32 36 34 30 31 32  33 32 31 30 32 39 62 62
+    6.375493579263029e-67   8.395325941575848e+165
+    6.375493579263029e-67   8.395325941575848e+165
+  31 33 34 36 33 64 64 64  35 64 32 63 63 30 35 64
+  4.0347317909579035e+175   5.240687965855337e+174
+  4.0347317909579035e+175   5.240687965855337e+174
+  61 36 65 38 34 65 33 37  35 33 36 63 62 39 35 32
+     8.69716589996941e-43    7.872477563417427e-67
+     8.69716589996941e-43    7.872477563417427e-67
+  35 37 30 33 63 66 64 38  66 34 33 61 66 64 62 34
+    4.796005471754555e-37    2.344035571241089e-56
+    4.796005471754555e-37    2.344035571241089e-56
+  31 34 39 38 38 39 38 37  61 39 32 66 36 61 63 66
+   1.0862199391867178e-42  1.6469302797097853e+185
+   1.0862199391867178e-42  1.6469302797097853e+185
+  66 66 66 66 66 66 66 30  32 30 30 34 30 30 37 35
+   1.5476014050729244e-75   2.4209647508073732e-52
+   1.5476014050729244e-75   2.4209647508073732e-52
+  61 66 30 37 35 30 37 30  30 30 31 35 31 30 30 30
+    2.002581709862774e-76   1.3980446296279274e-76
+    2.002581709862774e-76   1.3980446296279274e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 31 35
+    1.398043286095289e-76    1.794535496987453e-52
+    1.398043286095289e-76    1.794535496987453e-52
+  31 30 30 30 30 30 30 30  30 22 2c 20 22 50 32 53
+   1.3980432860952892e-76    5.968685125563565e+92
+   1.3980432860952892e-76    5.968685125563565e+92
+  48 22 5d 2c 0a 0a 5b 22  43 6f 69 6e 62 61 73 65
+  3.4646246866285803e-143   5.026206595348782e+180
+  3.4646246866285803e-143   5.026206595348782e+180
+  20 6f 66 20 73 69 7a 65  20 32 22 5d 2c 0a 5b 22
+   6.849790247281998e+180  3.4646915345152325e-143
+   6.849790247281998e+180  3.4646915345152325e-143
+  4e 6f 74 65 20 74 68 65  20 69 6e 70 75 74 20 69
+   3.170958566212628e+180  2.4600438894756224e+198
+   3.170958566212628e+180  2.4600438894756224e+198
+  73 20 6a 75 73 74 20 72  65 71 75 69 72 65 64 20
+   5.486071120085856e+241  1.2169790703660515e-152
+   5.486071120085856e+241  1.2169790703660515e-152
+  74 6f 20 6d 61 6b 65 20  74 68 65 20 74 65 73 74
+  1.2780287706337388e-152    8.88782181971942e+252
+  1.2780287706337388e-152    8.88782181971942e+252
+  65 72 20 68 61 70 70 79  22 5d 2c 0a 5b 5b 5b 22
+    9.10649098444104e+276  3.5053249760825546e-143
+    9.10649098444104e+276  3.5053249760825546e-143
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  22 2c 20 2d 31 2c 20 22  31 22 5d 5d 2c 0a 22 30
+  2.5903151886987755e-144     7.78971152971537e-77
+  2.5903151886987755e-144     7.78971152971537e-77
+  31 30 30 30 30 30 30 30  31 30 30 30 30 30 30 30
+   1.3980432860952892e-76   1.3980432860952892e-76
+   1.3980432860952892e-76   1.3980432860952892e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 66 66 66 66 66 66 66
+    1.398043286095289e-76   1.903598566255277e+185
+    1.398043286095289e-76   1.903598566255277e+185
+  66 30 32 35 31 35 31 66  66 66 66 66 66 66 66 30
+  1.8279413692327297e+184   1.5476014050729244e-75
+  1.8279413692327297e+184   1.5476014050729244e-75
+  31 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432860952892e-76    1.398043286095289e-76
+   1.3980432860952892e-76    1.398043286095289e-76
+  30 30 31 35 31 30 30 30  30 30 30 30 30 22 2c 20
+   1.3980446296279274e-76  1.0491479271301769e-153
+   1.3980446296279274e-76  1.0491479271301769e-153
+  22 50 32 53 48 22 5d 2c  0a 0a 5b 22 43 6f 69 6e
+    5.455822643446265e-95   7.355158185188684e+223
+    5.455822643446265e-95   7.355158185188684e+223
+  62 61 73 65 20 6f 66 20  73 69 7a 65 20 31 30 30
+  1.3385685830467748e-152   1.3983598263466015e-76
+  1.3385685830467748e-152   1.3983598263466015e-76
+  22 5d 2c 0a 5b 22 4e 6f  74 65 20 74 68 65 20 69
+  1.4277311178057263e+228   2.451254380554266e+198
+  1.4277311178057263e+228   2.451254380554266e+198
+  6e 70 75 74 20 69 73 20  6a 75 73 74 20 72 65 71
+  2.3163400399713615e-152  1.7456171315535884e+238
+  2.3163400399713615e-152  1.7456171315535884e+238
+  75 69 72 65 64 20 74 6f  20 6d 61 6b 65 20 74 68
+   7.628614489693244e+228    1.46921884768356e+195
+   7.628614489693244e+228    1.46921884768356e+195
+  65 20 74 65 73 74 65 72  20 68 61 70 70 79 22 5d
+   1.144491905780217e+243   4.400050643855073e+140
+   1.144491905780217e+243   4.400050643855073e+140
+  2c 0a 5b 5b 5b 22 30 30  30 30 30 30 30 30 30 30
+   1.3933772679372857e-76    1.398043286095289e-76
+   1.3933772679372857e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 22 2c  20 2d 31 2c 20 22 31 22
+    4.257571555502434e-96    5.48836754118772e-144
+    4.257571555502434e-96    5.48836754118772e-144
+  5d 5d 2c 0a 22 30 31 30  30 30 30 30 30 30 31 30
+    1.484386327115762e-76   1.4844049716462333e-76
+    1.484386327115762e-76   1.4844049716462333e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 66
+    1.398043286095289e-76   1.719637360272639e+184
+    1.398043286095289e-76   1.719637360272639e+184
+  66 66 66 66 66 66 66 36  34 35 31 35 31 35 31 35
+   1.2261361562842149e-46    1.796576278865475e-52
+   1.2261361562842149e-46    1.796576278865475e-52
+  31 35 31 35 31 35 31 35  31 35 31 35 31 35 31 35
+    1.796576278865474e-52    1.796576278865474e-52
+    1.796576278865474e-52    1.796576278865474e-52
+  31 35 31 35 31 35 31 35  31 35 31 35 31 35 31 35
+    1.796576278865474e-52    1.796576278865474e-52
+    1.796576278865474e-52    1.796576278865474e-52
+  31 35 31 35 31 35 31 35  31 35 31 35 31 35 31 35
+    1.796576278865474e-52    1.796576278865474e-52
+    1.796576278865474e-52    1.796576278865474e-52
+  31 35 31 35 31 35 31 35  31 35 31 35 31 35 31 35
+    1.796576278865474e-52    1.796576278865474e-52
+    1.796576278865474e-52    1.796576278865474e-52
+  31 35 31 35 31 35 31 35  31 35 31 35 31 35 31 35
+    1.796576278865474e-52    1.796576278865474e-52
+    1.796576278865474e-52    1.796576278865474e-52
+  31 35 31 35 31 35 31 35  31 35 31 35 31 35 31 35
+    1.796576278865474e-52    1.796576278865474e-52
+    1.796576278865474e-52    1.796576278865474e-52
+  31 35 31 35 31 35 31 35  31 35 31 35 31 35 31 35
+    1.796576278865474e-52    1.796576278865474e-52
+    1.796576278865474e-52    1.796576278865474e-52
+  31 35 31 35 31 35 31 35  31 35 31 35 31 35 31 35
+    1.796576278865474e-52    1.796576278865474e-52
+    1.796576278865474e-52    1.796576278865474e-52
+  31 35 31 35 31 35 31 35  31 35 31 35 31 35 31 35
+    1.796576278865474e-52    1.796576278865474e-52
+    1.796576278865474e-52    1.796576278865474e-52
+  31 35 31 35 31 35 31 35  31 35 31 35 31 35 31 35
+    1.796576278865474e-52    1.796576278865474e-52
+    1.796576278865474e-52    1.796576278865474e-52
+  31 35 31 35 31 35 31 35  31 35 31 35 31 35 31 35
+    1.796576278865474e-52    1.796576278865474e-52
+    1.796576278865474e-52    1.796576278865474e-52
+  31 35 31 35 31 35 31 35  31 35 31 35 31 35 31 35
+    1.796576278865474e-52    1.796576278865474e-52
+    1.796576278865474e-52    1.796576278865474e-52
+  31 66 66 66 66 66 66 66  66 30 31 30 30 30 30 30
+  1.9035985662552772e+185    1.398043286115413e-76
+  1.9035985662552772e+185    1.398043286115413e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 31 35 31 30
+    1.398043286095289e-76    1.486093041091893e-76
+    1.398043286095289e-76    1.486093041091893e-76
+  30 30 30 30 30 30 30 22  2c 20 22 50 32 53 48 22
+     5.1856307557119e-144  1.5584206141976403e-143
+     5.1856307557119e-144  1.5584206141976403e-143
+  5d 2c 0a 0a 5b 22 53 69  6d 70 6c 65 20 74 72 61
+  2.2884819608695347e+199  2.5944138296106743e+161
+  2.2884819608695347e+199  2.5944138296106743e+161
+  6e 73 61 63 74 69 6f 6e  20 77 69 74 68 20 66 69
+   9.083672062285389e+223   5.292753972019722e+199
+   9.083672062285389e+223   5.292753972019722e+199
+  72 73 74 20 69 6e 70 75  74 20 69 73 20 73 69 67
+   4.934327930436155e+257  1.4173926812870951e+190
+   4.934327930436155e+257  1.4173926812870951e+190
+  6e 65 64 20 77 69 74 68  20 53 49 47 48 41 53 48
+  1.4900547065086273e+195   2.6208560329832514e+40
+  1.4900547065086273e+195   2.6208560329832514e+40
+  5f 41 4c 4c 2c 20 73 65  63 6f 6e 64 20 77 69 74
+  4.9601431284546635e+180   5.834394949860671e+252
+  4.9601431284546635e+180   5.834394949860671e+252
+  68 20 53 49 47 48 41 53  48 5f 41 4e 59 4f 4e 45
+   1.1265517997038198e+93    7.328497787940222e+25
+   1.1265517997038198e+93    7.328497787940222e+25
+  43 41 4e 50 41 59 22 5d  2c 0a 5b 5b 5b 22 30 30
+    4.37010806727148e+140   1.3933772679372857e-76
+    4.37010806727148e+140   1.3933772679372857e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 31 30 30 22 2c
+    1.398043286095289e-76    4.257571569454917e-96
+    1.398043286095289e-76    4.257571569454917e-96
+  20 30 2c 20 22 30 78 32  31 20 30 78 30 33 35 65
+   1.4354936834314724e-65  3.4363108270842297e+179
+   1.4354936834314724e-65  3.4363108270842297e+179
+  37 66 30 64 34 64 30 38  34 31 62 63 64 35 36 63
+    4.817006704485796e-38   8.381428246989895e+169
+    4.817006704485796e-38   8.381428246989895e+169
+  33 39 33 33 37 65 64 30  38 36 62 31 61 36 33 33
+   1.4091030687501516e-75    4.670280725885116e-62
+   1.4091030687501516e-75    4.670280725885116e-62
+  65 65 37 37 30 63 31 66  66 64 64 39 34 61 63 35
+   1.847027532737165e+184   1.6186683316323528e-51
+   1.847027532737165e+184   1.6186683316323528e-51
+  35 32 61 39 35 61 63 32  63 65 30 65 66 63 20 43
+    5.750669650850171e-66       2306445531427505.5
+    5.750669650850171e-66       2306445531427505.5
+  48 45 43 4b 53 49 47 22  5d 2c 0a 20 20 5b 22 30
+  1.4918835928118613e-143     7.92625777022932e-77
+  1.4918835928118613e-143     7.92625777022932e-77
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 32 30 30 22
+    1.398043286095289e-76   5.185640531508263e-144
+    1.398043286095289e-76   5.185640531508263e-144
+  2c 20 30 2c 20 22 30 78  32 31 20 30 78 30 33 35
+   8.523135963328286e+270   2.0034599421921645e-52
+   8.523135963328286e+270   2.0034599421921645e-52
+  65 37 66 30 64 34 64 30  38 34 31 62 63 64 35 36
+   1.3959263640070481e-75   1.4637097165280227e-47
+   1.3959263640070481e-75   1.4637097165280227e-47
+  63 33 39 33 33 37 65 64  30 38 36 62 31 61 36 33
+  4.1978152392787136e+175    5.440193935646366e-62
+  4.1978152392787136e+175    5.440193935646366e-62
+  33 65 65 37 37 30 63 31  66 66 64 64 39 34 61 63
+    8.688173602696566e-71   5.194180186384195e+170
+    8.688173602696566e-71   5.194180186384195e+170
+  35 35 32 61 39 35 61 63  32 63 65 30 65 66 63 20
+   5.195359492126702e+170  1.1575333789798662e-152
+   5.195359492126702e+170  1.1575333789798662e-152
+  43 48 45 43 4b 53 49 47  22 5d 5d 2c 0a 20 22 30
+   2.6299364878383027e+35    7.826594783640787e-77
+   2.6299364878383027e+35    7.826594783640787e-77
+  31 30 30 30 30 30 30 30  32 30 30 30 31 30 30 30
+   1.3980432860952892e-76   1.3980446038700324e-76
+   1.3980432860952892e-76   1.3980446038700324e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 34 39 34 38 33 30 34  35 30 32 32 31 30 30 64
+   2.5808210600795505e-57   4.003846537996881e+174
+   2.5808210600795505e-57   4.003846537996881e+174
+  31 38 30 66 64 32 65 62  39 31 34 30 61 65 62 34
+   9.765148260966538e+165    2.344523316804996e-56
+   9.765148260966538e+165    2.344523316804996e-56
+  32 31 30 63 39 32 30 34  64 33 66 33 35 38 37 36
+    2.580201635374529e-57   1.5887468878829214e-47
+    2.580201635374529e-57   1.5887468878829214e-47
+  36 65 62 35 33 38 34 32  62 32 61 39 34 37 33 64
+    7.499841015944706e-67    4.75261211087007e+174
+    7.499841015944706e-67    4.75261211087007e+174
+  62 36 38 37 66 61 32 34  62 31 32 61 33 63 63 30
+   2.9281771608399055e-57   1.3394699323090674e-75
+   2.9281771608399055e-57   1.3394699323090674e-75
+  32 32 30 37 39 37 38 31  37 39 39 63 64 34 66 30
+   1.3705609994881434e-71    1.534105270185148e-75
+   1.3705609994881434e-71    1.534105270185148e-75
+  33 38 62 38 35 31 33 35  62 62 65 34 39 65 63 32
+    2.003761087952527e-52    5.755324181751681e-66
+    2.003761087952527e-52    5.755324181751681e-66
+  62 35 37 66 33 30 36 62  32 62 62 31 37 31 30 31
+   1.277736681894299e+165    9.164487832433724e-72
+   1.277736681894299e+165    9.164487832433724e-72
+  62 31 37 66 37 31 66 30  30 30 66 63 61 62 32 62
+   1.5332482018138372e-75  1.0586799903613667e+165
+   1.5332482018138372e-75  1.0586799903613667e+165
+  36 66 62 30 31 66 66 66  66 66 66 66 66 30 30 30
+  1.9035295662968858e+185   1.3981147249895865e-76
+  1.9035295662968858e+185   1.3981147249895865e-76
+  32 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432860952895e-76    1.398043286095289e-76
+   1.3980432860952895e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 34 38 34  37 33 30 34 34 30 32 32
+    3.855897405273876e-57    6.746414149942206e-67
+    3.855897405273876e-57    6.746414149942206e-67
+  30 35 66 37 35 33 30 36  35 33 65 65 61 39 62 33
+   1.1084510857927269e-47   3.5440348924152164e-61
+   1.1084510857927269e-47   3.5440348924152164e-61
+  38 36 39 39 65 34 37 36  33 32 30 61 62 31 33 35
+   1.5877279200903752e-47    2.003833031016152e-52
+   1.5877279200903752e-47    2.003833031016152e-52
+  62 37 34 37 37 31 65 31  63 34 38 62 38 31 61 35
+    9.595510192714776e-71    1.435965107678099e-51
+    9.595510192714776e-71    1.435965107678099e-51
+  64 30 34 31 65 32 63 61  38 34 62 39 62 65 37 61
+  1.3494531693245808e+161   2.055795356386173e+160
+  1.3494531693245808e+161   2.055795356386173e+160
+  38 30 32 32 30 30 61 63  38 64 31 66 34 30 66 62
+   5.189420368051225e+170  1.0221900484083246e+166
+   5.189420368051225e+170  1.0221900484083246e+166
+  30 32 36 36 37 34 66 65  35 61 35 65 64 64 33 64
+  2.8792408964239337e+180   4.796269954326942e+174
+  2.8792408964239337e+180   4.796269954326942e+174
+  65 61 37 31 35 63 32 37  62 61 61 39 62 61 63 61
+    8.245253795623704e-43  1.3623558053108882e+161
+    8.245253795623704e-43  1.3623558053108882e+161
+  35 31 65 64 34 35 65 61  37 35 30 61 63 39 64 63
+  1.4908156570051578e+161   6.106021416258785e+170
+  1.4908156570051578e+161   6.106021416258785e+170
+  30 61 35 35 65 38 31 66  66 66 66 66 66 66 66 30
+  1.8292705110172997e+184   1.5476014050729244e-75
+  1.8292705110172997e+184   1.5476014050729244e-75
+  31 30 31 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432861153968e-76    1.398043286095289e-76
+   1.3980432861153968e-76    1.398043286095289e-76
+  30 30 31 35 31 30 30 30  30 30 30 30 30 22 2c 20
+   1.3980446296279274e-76  1.0491479271301769e-153
+   1.3980446296279274e-76  1.0491479271301769e-153
+  22 50 32 53 48 22 5d 2c  0a 0a 5b 22 53 61 6d 65
+    5.455822643446265e-95  3.8097966454571992e+180
+    5.455822643446265e-95  3.8097966454571992e+180
+  20 61 73 20 61 62 6f 76  65 2c 20 62 75 74 20 77
+  3.0882938145318595e+262   6.632264862232415e+265
+  3.0882938145318595e+262   6.632264862232415e+265
+  65 20 63 68 61 6e 67 65  20 74 68 65 20 73 65 71
+  3.0383756431852213e+180  1.7459350142760426e+238
+  3.0383756431852213e+180  1.7459350142760426e+238
+  75 65 6e 63 65 20 6e 75  6d 62 65 72 20 6f 66 20
+   4.523511181573994e+257   1.338568629085722e-152
+   4.523511181573994e+257   1.338568629085722e-152
+  74 68 65 20 66 69 72 73  74 20 69 6e 70 75 74 20
+  1.2873323358344745e+248  2.4414128749173093e-152
+  1.2873323358344745e+248  2.4414128749173093e-152
+  74 6f 20 63 68 65 63 6b  20 74 68 61 74 20 53 49
+  1.9927001676661837e+209    1.706165416615723e+45
+  1.9927001676661837e+209    1.706165416615723e+45
+  47 48 41 53 48 5f 41 4e  59 4f 4e 45 43 41 4e 50
+    9.367070278354942e+68    7.006563738724937e+78
+    9.367070278354942e+68    7.006563738724937e+78
+  41 59 20 69 73 20 62 65  69 6e 67 20 66 6f 6c 6c
+  2.3505399091853957e+180  1.9145313831811639e+214
+  2.3505399091853957e+180  1.9145313831811639e+214
+  6f 77 65 64 22 5d 2c 0a  5b 5b 5b 22 30 30 30 30
+  1.1529706642958124e-259    1.398043214897502e-76
+  1.1529706642958124e-259    1.398043214897502e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 31 30 30 22 2c 20 30
+    1.398043286095289e-76    6.983377179561166e-77
+    1.398043286095289e-76    6.983377179561166e-77
+  2c 20 22 30 78 32 31 20  30 78 30 33 35 65 37 66
+  1.2826217763196715e-153  2.4852311062557085e+184
+  1.2826217763196715e-153  2.4852311062557085e+184
+  30 64 34 64 30 38 34 31  62 63 64 35 36 63 33 39
+   1.1443824877437212e-71   3.7339055210529345e-33
+   1.1443824877437212e-71   3.7339055210529345e-33
+  33 33 37 65 64 30 38 36  62 31 61 36 33 33 65 65
+   1.6550807261498067e-47   2.749054088959487e+180
+   1.6550807261498067e-47   2.749054088959487e+180
+  37 37 30 63 31 66 66 64  64 39 34 61 63 35 35 32
+  4.4320007405141124e+175    7.866687544218582e-67
+  4.4320007405141124e+175    7.866687544218582e-67
+  61 39 35 61 63 32 63 65  30 65 66 63 20 43 48 45
+  2.4892981391391088e+180    5.866243136687448e+25
+  2.4892981391391088e+180    5.866243136687448e+25
+  43 4b 53 49 47 22 5d 2c  0a 20 20 5b 22 30 30 30
+   5.4558196757959444e-95   1.3980250582708738e-76
+   5.4558196757959444e-95   1.3980250582708738e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 32 30 30 22 2c 20
+    1.398043286095289e-76  1.0491479271475422e-153
+    1.398043286095289e-76  1.0491479271475422e-153
+  30 2c 20 22 30 78 32 31  20 30 78 30 33 35 65 37
+   1.0453357749013958e-71     7.60792956412809e-42
+   1.0453357749013958e-71     7.60792956412809e-42
+  66 30 64 34 64 30 38 34  31 62 63 64 35 36 63 33
+    3.853534644071652e-57   3.7360946078593746e-61
+    3.853534644071652e-57   3.7360946078593746e-61
+  39 33 33 37 65 64 30 38  36 62 31 61 36 33 33 65
+    4.817225640046255e-38   3.112144540926055e+179
+    4.817225640046255e-38   3.112144540926055e+179
+  65 37 37 30 63 31 66 66  64 64 39 34 61 63 35 35
+   1.886000455611159e+185   2.2330324775505453e-52
+   1.886000455611159e+185   2.2330324775505453e-52
+  32 61 39 35 61 63 32 63  65 30 65 66 63 20 43 48
+   6.939638350216974e+169    1.301683276314949e+40
+   6.939638350216974e+169    1.301683276314949e+40
+  45 43 4b 53 49 47 22 5d  5d 2c 0a 20 22 30 31 30
+   4.353390819034962e+140   1.4843864396745203e-76
+   4.353390819034962e+140   1.4843864396745203e-76
+  30 30 30 30 30 30 32 30  30 30 31 30 30 30 30 30
+   1.5707666571971778e-76   1.3980432861153965e-76
+   1.5707666571971778e-76   1.3980432861153965e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 34
+    1.398043286095289e-76   2.5789346702567697e-57
+    1.398043286095289e-76   2.5789346702567697e-57
+  39 34 38 33 30 34 35 30  32 32 30 33 61 30 66 35
+   1.8312011307905955e-76   1.8533103476801735e-51
+   1.8312011307905955e-76   1.8533103476801735e-51
+  66 30 65 31 66 32 62 64  62 63 64 30 34 64 62 33
+   3.600511694326406e+175    3.576565499665179e-61
+   3.600511694326406e+175    3.576565499665179e-61
+  30 36 31 64 31 38 66 33  61 66 37 30 65 30 37 66
+    4.321009709266793e-61  2.4633164583339916e+184
+    4.321009709266793e-61  2.4633164583339916e+184
+  34 66 34 36 37 63 62 63  31 62 38 31 31 36 66 32
+   5.551517208534656e+170    6.591018413692433e-66
+   5.551517208534656e+170    6.591018413692433e-66
+  36 37 30 32 35 66 35 33  36 30 62 30 32 32 31 30
+    5.201869326236441e-62     1.48508230886947e-76
+    5.201869326236441e-62     1.48508230886947e-76
+  30 63 37 39 32 62 36 65  32 31 35 61 66 63 35 61
+   3.628164411116311e+179  1.8793756282201043e+160
+   3.628164411116311e+179  1.8793756282201043e+160
+  66 63 37 32 31 61 33 35  31 65 63 34 31 33 65 37
+   2.0233305906096163e-52     7.60511610334697e-42
+   2.0233305906096163e-52     7.60511610334697e-42
+  31 34 33 30 35 63 62 37  34 39 61 61 65 33 64 37
+    6.596203014768002e-42    7.246669297244279e-42
+    6.596203014768002e-42    7.246669297244279e-42
+  66 65 65 37 36 36 32 31  33 31 33 34 31 38 64 66
+    1.030749357967621e-71   1.718295210629285e+185
+    1.030749357967621e-71   1.718295210629285e+185
+  31 30 31 30 31 30 30 30  30 30 30 30 30 30 32 30
+   1.3980446038901397e-76   1.5707666571971778e-76
+   1.3980446038901397e-76   1.5707666571971778e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 34 38 34 37 33  30 34 34 30 32 32 30 35
+    5.640575712685616e-62    1.690949474839413e-52
+    5.640575712685616e-62    1.690949474839413e-52
+  66 37 35 33 30 36 35 33  65 65 61 39 62 33 38 36
+    5.156272069798158e-62    1.655880288691754e-47
+    5.156272069798158e-62    1.655880288691754e-47
+  39 39 65 34 37 36 33 32  30 61 62 31 33 35 62 37
+     7.12604520090409e-67    6.531732363087229e-42
+     7.12604520090409e-67    6.531732363087229e-42
+  34 37 37 31 65 31 63 34  38 62 38 31 61 35 64 30
+   2.4460907125949557e-56   1.3961930849957874e-75
+   2.4460907125949557e-56   1.3961930849957874e-75
+  34 31 65 32 63 61 38 34  62 39 62 65 37 61 38 30
+   3.8840249691139017e-57    2.105476435127687e-76
+   3.8840249691139017e-57    2.105476435127687e-76
+  32 32 30 30 61 63 38 64  31 66 34 30 66 62 30 32
+   6.031943723797772e+174    6.077301254334826e-67
+   6.031943723797772e+174    6.077301254334826e-67
+  36 36 37 34 66 65 35 61  35 65 64 64 33 64 65 61
+   1.880061872343312e+160  1.5037204039685265e+161
+   1.880061872343312e+160  1.5037204039685265e+161
+  37 31 35 63 32 37 62 61  61 39 62 61 63 61 35 31
+   1.280476106473934e+161    1.210089039444909e-71
+   1.280476106473934e+161    1.210089039444909e-71
+  65 64 34 35 65 61 37 35  30 61 63 39 64 63 30 61
+   2.4410329359371152e-52  1.4400256878580956e+160
+   2.4410329359371152e-52  1.4400256878580956e+160
+  35 35 65 38 31 66 66 66  66 66 66 66 66 30 31 30
+  1.9035296068750705e+185    1.484476410540531e-76
+  1.9035296068750705e+185    1.484476410540531e-76
+  31 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432860952892e-76    1.398043286095289e-76
+   1.3980432860952892e-76    1.398043286095289e-76
+  31 35 31 30 30 30 30 30  30 30 30 22 2c 20 22 50
+   1.3980432861157895e-76   1.0494047973278671e+78
+   1.3980432861157895e-76   1.0494047973278671e+78
+  32 53 48 22 5d 2c 0a 0a  5b 22 61 66 64 39 63 31
+   2.659819575045378e-260    8.704403958633341e-71
+   2.659819575045378e-260    8.704403958633341e-71
+  37 66 38 39 31 33 35 37  37 65 63 33 35 30 39 35
+    9.506395258332956e-43   2.6297824542646422e-52
+    9.506395258332956e-43   2.6297824542646422e-52
+  32 30 62 64 36 65 35 64  36 33 65 39 63 30 66 64
+   5.291723277220672e+174  4.3904142008708806e+175
+   5.291723277220672e+174  4.3904142008708806e+175
+  32 61 35 66 37 30 63 37  38 37 39 39 33 62 30 39
+    6.883481302414928e-42    3.155365449126432e-33
+    6.883481302414928e-42    3.155365449126432e-33
+  37 62 61 36 63 61 39 66  61 65 20 77 68 69 63 68
+  2.6961010789675122e+184    7.08519662929263e+194
+  2.6961010789675122e+184    7.08519662929263e+194
+  20 68 61 73 20 73 65 76  65 72 61 6c 20 53 49 47
+  2.1107060000795576e+262   2.6298686060772263e+35
+  2.1107060000795576e+262   2.6298686060772263e+35
+  48 41 53 48 5f 53 49 4e  47 4c 45 20 73 69 67 6e
+   1.3655575676852639e+69   6.770234258054584e+223
+   1.3655575676852639e+69   6.770234258054584e+223
+  61 74 75 72 65 73 22 5d  2c 0a 5b 5b 5b 22 36 33
+  4.3944285758265065e+140    5.380527546166755e-62
+  4.3944285758265065e+140    5.380527546166755e-62
+  63 66 61 35 61 30 39 64  63 35 34 30 62 66 36 33
+   6.230001348396069e+174    5.445122746052488e-62
+   6.230001348396069e+174    5.445122746052488e-62
+  65 35 33 37 31 33 62 38  32 64 39 65 61 33 36 39
+    4.278792318397397e-37   4.2757002326394906e-33
+    4.278792318397397e-37   4.2757002326394906e-33
+  32 63 61 39 37 63 64 36  30 38 63 33 38 34 66 32
+   1.1159788471135032e-46    6.588731893058282e-66
+   1.1159788471135032e-46    6.588731893058282e-66
+  61 61 38 38 65 35 31 61  30 61 61 63 37 30 22 2c
+  1.5121073979531266e+160    4.257597272609266e-96
+  1.5121073979531266e+160    4.257597272609266e-96
+  20 30 2c 20 22 44 55 50  20 48 41 53 48 31 36 30
+    9.849805770138774e+78   1.9165825568371944e-76
+    9.849805770138774e+78   1.9165825568371944e-76
+  20 30 78 31 34 20 30 78  64 63 66 37 32 63 34 66
+    8.51917005130799e+270  2.1657135713985228e+184
+    8.51917005130799e+270  2.1657135713985228e+184
+  64 30 32 66 35 61 39 38  37 63 66 39 62 30 32 66
+    7.458429682040025e-38   1.932173660950739e+184
+    7.458429682040025e-38   1.932173660950739e+184
+  32 66 61 62 66 63 61 63  33 33 34 31 61 38 37 64
+   5.249817533244161e+170   5.743069558924843e+174
+   5.249817533244161e+170   5.743069558924843e+174
+  20 45 51 55 41 4c 56 45  52 49 46 59 20 43 48 45
+   1.0782589228142278e+26    5.866242990764692e+25
+   1.0782589228142278e+26    5.866242990764692e+25
+  43 4b 53 49 47 22 5d 2c  0a 20 5b 22 30 34 65 38
+   5.4558196757959444e-95    4.985003404440566e-37
+   5.4558196757959444e-95    4.985003404440566e-37
+  64 30 66 63 66 33 38 34  36 63 36 37 33 34 34 37
+    3.855406856751563e-57    9.059745003719407e-43
+    3.855406856751563e-57    9.059745003719407e-43
+  37 62 39 38 66 30 66 33  64 34 62 61 64 66 62 37
+    4.315089306604465e-61    6.600665231450365e-42
+    4.315089306604465e-61    6.600665231450365e-42
+  38 66 30 32 30 65 65 30  39 37 61 30 62 65 35 66
+   1.4781850334888713e-75  2.2728488320430285e+184
+   1.4781850334888713e-75  2.2728488320430285e+184
+  65 33 34 37 36 34 35 62  38 31 37 64 22 2c 20 31
+  1.2210528428022837e+165    4.576626945969304e-72
+  1.2210528428022837e+165    4.576626945969304e-72
+  2c 20 22 44 55 50 20 48  41 53 48 31 36 30 20 30
+    2.775649418769176e+39    6.990255991883209e-77
+    2.775649418769176e+39    6.990255991883209e-77
+  78 31 34 20 30 78 64 63  66 37 32 63 34 66 64 30
+    6.18008518078602e+170   1.4093699840081275e-75
+    6.18008518078602e+170   1.4093699840081275e-75
+  32 66 35 61 39 38 37 63  66 39 62 30 32 66 32 66
+   8.762999432548313e+169   1.954503184517883e+184
+   8.762999432548313e+169   1.954503184517883e+184
+  61 62 66 63 61 63 33 33  34 31 61 38 37 64 20 45
+   4.7130115054315165e-62    9.908034197813762e+24
+   4.7130115054315165e-62    9.908034197813762e+24
+  51 55 41 4c 56 45 52 49  46 59 20 43 48 45 43 4b
+    1.629814107787821e+45   3.6915200620834524e+54
+    1.629814107787821e+45   3.6915200620834524e+54
+  53 49 47 22 5d 2c 0a 20  5b 22 65 65 31 33 37 37
+   2.440117005637406e-154   1.0403227456187855e-42
+   2.440117005637406e-154   1.0403227456187855e-42
+  61 66 66 35 64 30 35 37  39 39 30 39 65 31 31 37
+     9.50148924314439e-43    7.709585775420997e-43
+     9.50148924314439e-43    7.709585775420997e-43
+  38 32 65 31 64 32 66 35  66 37 62 38 34 64 32 36
+   1.8539666926214243e-51   1.2583921459949134e-47
+   1.8539666926214243e-51   1.2583921459949134e-47
+  35 33 37 62 65 37 66 35  35 31 36 64 64 34 65 34
+   1.8555995362596684e-51   2.7024773847393558e-56
+   1.8555995362596684e-51   2.7024773847393558e-56
+  33 33 37 33 30 39 31 66  33 66 22 2c 20 31 2c 20
+  1.8295995420163822e+184  1.0513238744606725e-153
+  1.8295995420163822e+184  1.0513238744606725e-153
+  22 44 55 50 20 48 41 53  48 31 36 30 20 30 78 31
+   1.1265130357212166e+93    2.190386854601886e-70
+   1.1265130357212166e+93    2.190386854601886e-70
+  34 20 30 78 64 63 66 37  32 63 34 66 64 30 32 66
+    8.031391451131929e-42  1.9321771864477457e+184
+    8.031391451131929e-42  1.9321771864477457e+184
+  35 61 39 38 37 63 66 39  62 30 32 66 32 66 61 62
+   3.4493499804917805e-32   8.015619100219198e+165
+   3.4493499804917805e-32   8.015619100219198e+165
+  66 63 61 63 33 33 34 31  61 38 37 64 20 45 51 55
+   1.1432796462386903e-71   9.670112205285115e+102
+   1.1432796462386903e-71   9.670112205285115e+102
+  41 4c 56 45 52 49 46 59  20 43 48 45 43 4b 53 49
+  1.1509816729234979e+122   1.7210818849099444e+45
+  1.1509816729234979e+122   1.7210818849099444e+45
+  47 22 5d 5d 2c 0a 20 22  30 31 30 30 30 30 30 30
+   2.569031296580814e-144   1.3980432860953674e-76
+   2.569031296580814e-144   1.3980432860953674e-76
+  30 33 37 30 61 63 30 61  31 61 65 35 38 38 61 61
+  1.4400216174750333e+160    1.21046141413985e+161
+  1.4400216174750333e+160    1.21046141413985e+161
+  66 32 38 34 63 33 30 38  64 36 37 63 61 39 32 63
+    4.760967378132515e-38   6.877722813744487e+169
+    4.760967378132515e-38   6.877722813744487e+169
+  36 39 61 33 39 65 32 64  62 38 31 33 33 37 65 35
+    4.54974267227308e+174   1.7720116812911792e-51
+    4.54974267227308e+174   1.7720116812911792e-51
+  36 33 62 66 34 30 63 35  39 64 61 30 61 35 63 66
+    1.602681559671676e-51  1.6323794714284172e+185
+    1.602681559671676e-51  1.6323794714284172e+185
+  36 33 30 30 30 30 30 30  30 30 36 61 34 37 33 30
+   1.3980432860955263e-76   1.6594953185373452e-76
+   1.3980432860955263e-76   1.6594953185373452e-76
+  34 34 30 32 32 30 33 36  30 64 32 30 62 61 66 66
+   1.3129144327167278e-47  1.9019332985765767e+185
+   1.3129144327167278e-47  1.9019332985765767e+185
+  33 38 32 30 35 39 30 34  30 62 61 39 62 65 39 38
+    2.584547538408904e-57    7.463222458825581e-38
+    2.584547538408904e-57    7.463222458825581e-38
+  39 34 37 66 64 36 37 38  66 62 30 38 61 61 62 32
+    6.821531683076134e-38    5.454132362675666e-66
+    6.821531683076134e-38    5.454132362675666e-66
+  62 62 30 63 31 37 32 65  66 61 39 39 36 66 64 38
+  2.9525744050926257e+179   4.7958441267510385e-37
+  2.9525744050926257e+179   4.7958441267510385e-37
+  65 63 65 39 62 37 30 32  32 30 31 62 34 66 62 30
+    6.014975746282904e-67   1.2711912829920316e-75
+    6.014975746282904e-67   1.2711912829920316e-75
+  64 65 36 37 66 30 31 35  63 39 30 65 37 61 63 38
+    1.794621567662665e-52    4.556157685172875e-37
+    1.794621567662665e-52    4.556157685172875e-37
+  61 31 39 33 61 65 61 62  34 38 36 61 31 66 35 38
+     8.0141485240157e+165    6.288657025801894e-38
+     8.0141485240157e+165    6.288657025801894e-38
+  37 65 30 66 35 34 64 30  66 62 39 35 35 32 65 66
+   1.3958770371854316e-75   1.801290714089214e+185
+   1.3958770371854316e-75   1.801290714089214e+185
+  37 66 35 63 65 36 63 61  65 63 30 33 32 31 30 33
+  1.3505517464670088e+161    3.936099032607062e-62
+  1.3505517464670088e+161    3.936099032607062e-62
+  35 37 39 63 61 32 65 36  64 31 30 37 35 32 32 66
+   1.1602750472688645e-46  1.9329306093574415e+184
+   1.1602750472688645e-46  1.9329306093574415e+184
+  30 31 32 63 64 30 30 62  35 32 62 39 61 36 35 66
+   9.322631481198507e+164  2.2533445449739417e+184
+   9.322631481198507e+164  2.2533445449739417e+184
+  62 34 36 66 30 63 35 37  62 39 62 38 62 36 65 33
+    9.590467526429774e-43    4.125166084078779e-61
+    9.590467526429774e-43    4.125166084078779e-61
+  37 37 63 34 38 66 35 32  36 61 34 34 37 34 31 61
+    7.937439705992987e-67  1.5117024611220943e+160
+    7.937439705992987e-67  1.5117024611220943e+160
+  66 66 66 66 66 66 66 66  37 64 38 31 35 62 36 34
+  1.9035985662552932e+185    3.565917057452104e-57
+  1.9035985662552932e+185    3.565917057452104e-57
+  34 37 65 33 35 66 62 65  61 30 39 37 65 30 30 65
+   2.385874104370608e+180  2.6240895275213236e+179
+   2.385874104370608e+180  2.6240895275213236e+179
+  30 32 38 66 62 37 64 66  62 61 64 34 66 33 66 30
+  1.7180270422062628e+185   1.5338373055034516e-75
+  1.7180270422062628e+185   1.5338373055034516e-75
+  39 38 37 62 34 37 33 34  36 37 36 63 38 34 66 33
+    3.061228552791576e-57    4.317991887777898e-61
+    3.061228552791576e-57    4.317991887777898e-61
+  66 63 64 30 65 38 30 34  30 31 30 30 30 30 30 30
+     2.58404192027844e-57   1.3980432860953674e-76
+     2.58404192027844e-57   1.3980432860953674e-76
+  36 62 34 38 33 30 34 35  30 32 32 31 30 30 63 37
+   2.1077549406132224e-52    6.883441852141898e-42
+   2.1077549406132224e-52    6.883441852141898e-42
+  31 34 33 31 30 62 65 31  65 33 61 39 66 66 31 63
+    9.682127346820055e-71   6.566693606477024e+169
+    9.682127346820055e-71   6.566693606477024e+169
+  35 66 37 63 61 63 63 36  35 63 32 64 38 65 37 38
+      1.0612758423839e-46    6.875287698883159e-38
+      1.0612758423839e-46    6.875287698883159e-38
+  31 66 63 33 61 38 38 63  65 62 30 36 33 63 36 31
+   9.140624988708566e+169   1.2670876061911125e-71
+   9.140624988708566e+169   1.2670876061911125e-71
+  35 33 62 66 39 35 30 36  35 30 38 30 32 31 30 32
+   1.1089900065465766e-47    6.006010421113998e-67
+   1.1089900065465766e-47    6.006010421113998e-67
+  32 30 30 62 32 64 30 39  37 39 63 37 36 65 31 32
+    3.156867613411721e-33    6.452297083793007e-67
+    3.156867613411721e-33    6.452297083793007e-67
+  62 62 34 38 30 64 61 36  33 35 66 31 39 32 63 63
+     9.51972153993237e-47   5.795654530188795e+170
+     9.51972153993237e-47   5.795654530188795e+170
+  38 64 63 36 66 39 30 35  33 38 30 64 64 34 61 63
+   1.6938871748087006e-52   5.194378278888343e+170
+   1.6938871748087006e-52   5.194378278888343e+170
+  31 66 66 33 35 61 34 66  36 38 66 34 36 32 66 66
+  2.1648885056719413e+184   1.886274085485314e+185
+  2.1648885056719413e+184   1.886274085485314e+185
+  66 64 30 33 32 31 30 33  35 37 39 63 61 32 65 36
+    3.936099032607284e-62   1.1602750472688645e-46
+    3.936099032607284e-62   1.1602750472688645e-46
+  64 31 30 37 35 32 32 66  30 31 32 63 64 30 30 62
+  1.9329306093574415e+184   9.322631481198507e+164
+  1.9329306093574415e+184   9.322631481198507e+164
+  35 32 62 39 61 36 35 66  62 34 36 66 30 63 35 37
+  2.2533445449739417e+184    9.590467526429774e-43
+  2.2533445449739417e+184    9.590467526429774e-43
+  62 39 62 38 62 36 65 33  37 37 63 34 38 66 35 32
+    4.125166084078779e-61    7.937439705992987e-67
+    4.125166084078779e-61    7.937439705992987e-67
+  36 61 34 34 37 34 31 61  66 66 66 66 66 66 66 66
+  1.5117024611220943e+160  1.9035985662552932e+185
+  1.5117024611220943e+160  1.9035985662552932e+185
+  33 66 31 66 30 39 37 33  33 33 65 34 64 34 36 64
+   5.6452945474321555e-62   5.491885988863837e+174
+   5.6452945474321555e-62   5.491885988863837e+174
+  35 31 66 35 65 37 37 62  35 33 32 36 34 64 62 38
+  1.3369411654399726e+165    4.323802459418828e-37
+  1.3369411654399726e+165    4.323802459418828e-37
+  66 37 66 35 64 32 65 31  38 32 31 37 65 31 30 39
+    9.597589733397895e-71   3.1186488597600154e-33
+    9.597589733397895e-71   3.1186488597600154e-33
+  39 39 35 37 64 30 66 35  61 66 37 37 31 33 65 65
+   1.8533141911121776e-51   2.749050138140337e+180
+   1.8533141911121776e-51   2.749050138140337e+180
+  30 31 30 30 30 30 30 30  36 63 34 39 33 30 34 36
+   1.3980432860953674e-76    1.381338281958659e-47
+   1.3980432860953674e-76    1.381338281958659e-47
+  30 32 32 31 30 30 62 36  36 33 34 39 39 65 66 37
+    9.955916511954872e-47    8.033957326976032e-42
+    9.955916511954872e-47    8.033957326976032e-42
+  33 32 37 33 61 33 37 38  38 64 65 61 33 34 32 37
+     6.81807350617664e-38    8.162915114020142e-43
+     6.81807350617664e-38    8.162915114020142e-43
+  31 37 63 32 36 34 30 61  63 34 33 63 35 61 31 63
+    1.42383170077498e+160   6.559041354973095e+169
+    1.42383170077498e+160   6.559041354973095e+169
+  66 38 36 32 63 39 65 30  39 62 32 30 36 66 63 62
+   1.4663640670287645e-75   8.937023280777448e+165
+   1.4663640670287645e-75   8.937023280777448e+165
+  33 66 36 62 62 38 30 32  32 31 30 30 62 30 39 39
+    6.016425557329715e-67     4.85122459671529e-33
+    6.016425557329715e-67     4.85122459671529e-33
+  37 32 65 37 35 39 37 32  64 39 31 34 38 66 32 62
+    8.614063133861458e-67  1.0595435846292781e+165
+    8.614063133861458e-67  1.0595435846292781e+165
+  64 64 34 36 32 65 35 63  62 36 39 62 35 37 63 31
+   8.074504853210267e+169    8.700541751894764e-71
+   8.074504853210267e+169    8.700541751894764e-71
+  32 31 34 62 38 38 66 63  35 35 63 61 36 33 38 36
+   6.708477963076008e+170   1.6558345137097742e-47
+   6.708477963076008e+170   1.6558345137097742e-47
+  37 36 63 30 37 63 66 63  31 30 64 38 30 33 32 31
+   6.759185079794331e+170   1.0300809218790435e-71
+   6.759185079794331e+170   1.0300809218790435e-71
+  30 33 35 37 39 63 61 32  65 36 64 31 30 37 35 32
+    5.159532993529108e-66    7.869295654685127e-67
+    5.159532993529108e-66    7.869295654685127e-67
+  32 66 30 31 32 63 64 30  30 62 35 32 62 39 61 36
+   1.4085580288349635e-75    9.428195857759367e-47
+   1.4085580288349635e-75    9.428195857759367e-47
+  35 66 62 34 36 66 30 63  35 37 62 39 62 38 62 36
+   6.189020838363799e+169    9.973440092717564e-47
+   6.189020838363799e+169    9.973440092717564e-47
+  65 33 37 37 63 34 38 66  35 32 36 61 34 34 37 34
+  2.5712006656325414e+184    3.696598403127667e-57
+  2.5712006656325414e+184    3.696598403127667e-57
+  31 61 66 66 66 66 66 66  66 66 30 33 38 30 38 34
+  1.9035985662548907e+185    3.853427674580033e-57
+  1.9035985662548907e+185    3.853427674580033e-57
+  31 65 30 30 30 30 30 30  30 30 30 30 31 39 37 36
+    1.398043286099452e-76   1.5890099750636563e-47
+    1.398043286099452e-76   1.5890099750636563e-47
+  61 39 31 34 62 66 62 32  38 32 63 37 30 63 34 31
+    5.459932454436181e-66   1.1538890308983007e-71
+    5.459932454436181e-66   1.1538890308983007e-71
+  39 31 66 34 35 62 35 61  36 36 36 35 63 61 64 31
+  1.8789664553965954e+160    9.227927169504888e-71
+  1.8789664553965954e+160    9.227927169504888e-71
+  36 38 32 66 32 63 39 63  66 64 66 62 38 38 61 63
+   9.581142494542899e+169   5.198892996676227e+170
+   9.581142494542899e+169   5.198892996676227e+170
+  38 30 38 34 31 65 30 30  30 30 30 30 30 30 30 30
+   1.4159241923328447e-76    1.398043286095289e-76
+   1.4159241923328447e-76    1.398043286095289e-76
+  31 39 37 36 61 39 31 34  39 38 35 37 63 63 30 37
+    2.743963744756248e-57    7.348737683368363e-43
+    2.743963744756248e-57    7.348737683368363e-43
+  62 65 64 33 33 61 35 63  66 31 32 62 39 63 35 65
+   8.068613732265506e+169  3.4667248340818295e+179
+   8.068613732265506e+169  3.4667248340818295e+179
+  30 35 30 30 62 36 37 35  64 35 30 30 63 38 31 31
+    2.423491369686842e-52    9.746323739980576e-72
+    2.423491369686842e-52    9.746323739980576e-72
+  38 38 61 63 65 30 66 64  31 63 30 30 30 30 30 30
+   4.390420734359954e+175    1.398043286099295e-76
+   4.390420734359954e+175    1.398043286099295e-76
+  30 30 30 30 31 39 37 36  61 39 31 34 34 33 63 35
+   1.5890099750636563e-47    1.603660105468834e-51
+   1.5890099750636563e-47    1.603660105468834e-51
+  32 38 35 30 36 30 36 63  38 37 32 34 30 33 63 30
+   8.373791179409952e+169   1.3265123315053362e-75
+   8.373791179409952e+169   1.3265123315053362e-75
+  36 30 31 65 36 39 66 61  33 34 62 32 36 66 36 32
+  1.5622117012585797e+161    8.308348957158319e-67
+  1.5622117012585797e+161    8.308348957158319e-67
+  64 62 34 61 38 38 61 63  30 30 30 30 30 30 30 30
+   5.198892975165245e+170    1.398043286095289e-76
+   5.198892975165245e+170    1.398043286095289e-76
+  22 2c 20 22 50 32 53 48  22 5d 2c 0a 0a 20 5b 22
+    2.612896978874658e+40    3.47563588252752e-143
+    2.612896978874658e+40    3.47563588252752e-143
+  64 64 63 34 35 34 61 31  63 30 63 33 35 63 31 38
+    7.789666545049283e-71    5.109735977824344e-38
+    7.789666545049283e-71    5.109735977824344e-38
+  38 63 39 38 39 37 36 62  31 37 36 37 30 66 36 39
+  1.2793164160258622e+165    4.313923841995844e-33
+  1.2793164160258622e+165    4.313923841995844e-33
+  65 35 38 36 64 39 63 30  66 33 35 39 33 65 61 38
+   1.3281864408712154e-75    4.089618399095091e-37
+   1.3281864408712154e-75    4.089618399095091e-37
+  37 39 39 32 38 33 33 32  66 30 61 30 36 39 65 37
+    7.121704086728578e-67    7.613551177530807e-42
+    7.121704086728578e-67    7.613551177530807e-42
+  2c 20 77 68 69 63 68 20  73 70 65 6e 64 73 20 61
+  1.4551716299578668e-152   7.227589018059303e+159
+  1.4551716299578668e-152   7.227589018059303e+159
+  6e 20 69 6e 70 75 74 20  74 68 61 74 20 70 75 73
+   2.441412874917307e-152  1.4989274542358047e+248
+   2.441412874917307e-152  1.4989274542358047e+248
+  68 65 73 20 75 73 69 6e  67 20 61 20 50 55 53 48
+   7.359897200780258e+223   2.6315061566481994e+40
+   7.359897200780258e+223   2.6315061566481994e+40
+  44 41 54 41 31 20 74 68  61 74 20 69 73 20 6e 65
+   1.469160743104829e+195   3.906608247518967e+180
+   1.469160743104829e+195   3.906608247518967e+180
+  67 61 74 69 76 65 20 77  68 65 6e 20 72 65 61 64
+    6.60865458256206e+265   3.442101685854382e+175
+    6.60865458256206e+265   3.442101685854382e+175
+  20 61 73 20 73 69 67 6e  65 64 22 5d 2c 0a 20 5b
+   6.770234261157235e+223   8.894579888244262e+130
+   6.770234261157235e+223   8.894579888244262e+130
+  5b 5b 22 63 35 35 31 30  61 35 64 64 39 37 61 32
+   1.4860985744381854e-76    5.108532208114241e-66
+   1.4860985744381854e-76    5.108532208114241e-66
+  35 66 34 33 31 37 35 61  66 31 66 65 36 34 39 62
+  1.8642017710480174e+160  1.4513973876435274e+165
+  1.8642017710480174e+160  1.4513973876435274e+165
+  37 30 37 62 31 64 66 38  65 31 61 34 31 34 38 39
+    5.264187794948828e-37    4.661496917871715e-33
+    5.264187794948828e-37    4.661496917871715e-33
+  62 61 63 33 33 61 32 33  30 38 37 30 32 37 61 32
+    4.467854538461815e-62    5.108499590411796e-66
+    4.467854538461815e-62    5.108499590411796e-66
+  66 34 38 22 2c 20 30 2c  20 22 30 78 34 63 20 30
+    7.549518398369125e-96    7.076268974303273e-77
+    7.549518398369125e-96    7.076268974303273e-77
+  78 61 65 20 30 78 36 30  36 35 36 33 36 38 36 66
+   1.9405025421708133e-76   2.360332308678837e+184
+   1.9405025421708133e-76   2.360332308678837e+184
+  32 30 32 32 35 35 33 32  34 36 37 33 36 34 34 37
+    7.124584924027955e-67    9.059765423727841e-43
+    7.124584924027955e-67    9.059765423727841e-43
+  35 36 36 62 35 38 33 31  32 62 35 61 35 33 36 65
+   1.0877888048623137e-71   3.598413423501238e+179
+   1.0877888048623137e-71   3.598413423501238e+179
+  35 38 37 35 37 34 33 35  36 35 34 32 37 39 33 30
+   2.0049877490097818e-52   1.6601737305549133e-76
+   2.0049877490097818e-52   1.6601737305549133e-76
+  36 36 37 39 34 37 37 38  36 32 35 34 35 36 34 31
+    6.822463599104134e-38   1.1439444720804226e-71
+    6.822463599104134e-38   1.1439444720804226e-71
+  35 36 37 35 35 33 34 61  36 63 33 37 36 61 36 61
+  1.7749647751218815e+160  1.9664939810169302e+160
+  1.7749647751218815e+160  1.9664939810169302e+160
+  33 33 34 38 37 38 34 31  36 39 34 35 33 32 35 33
+    1.144388384625041e-71    5.152484999240282e-62
+    1.144388384625041e-71    5.152484999240282e-62
+  36 34 36 36 37 36 35 37  37 33 34 66 35 33 34 37
+    9.511691100827977e-43    9.058008321165346e-43
+    9.511691100827977e-43    9.058008321165346e-43
+  34 66 33 36 36 33 33 33  33 38 35 38 34 64 37 34
+    4.667272629492844e-62    3.726468487106899e-57
+    4.667272629492844e-62    3.726468487106899e-57
+  33 39 34 33 35 63 36 65  35 34 33 32 34 39 35 38
+  3.6288049387686547e+179    6.237012188209097e-38
+  3.6288049387686547e+179    6.237012188209097e-38
+  34 39 36 37 33 30 36 61  34 38 36 39 35 36 33 30
+  1.9496712044652502e+160   1.6591590800762308e-76
+  1.9496712044652502e+160   1.6591590800762308e-76
+  34 66 33 37 36 65 37 37  35 32 33 36 36 34 34 35
+   1.0490841586932106e-42    2.109391033531058e-52
+   1.0490841586932106e-42    2.109391033531058e-52
+  34 36 36 37 33 64 33 64  32 32 32 30 33 65 32 30
+   4.796084352082165e+174   1.5886501782734984e-76
+   4.796084352082165e+174   1.5886501782734984e-76
+  37 34 33 62 32 30 36 66  37 30 36 35 36 65 37 33
+  2.3570065101192996e+184    5.687096591056218e-62
+  2.3570065101192996e+184    5.687096591056218e-62
+  37 33 36 63 32 30 36 35  36 65 36 33 32 30 32 64
+   2.3165633581310758e-52   4.498511129889823e+174
+   2.3165633581310758e-52   4.498511129889823e+174
+  37 30 36 31 37 33 37 33  32 30 37 30 36 31 37 33
+    5.639622403577223e-62    5.637719566389428e-62
+    5.639622403577223e-62    5.637719566389428e-62
+  37 33 33 61 35 62 33 31  34 61 35 36 34 64 37 37
+   1.0970744098795606e-71   1.0489076252775507e-42
+   1.0970744098795606e-71   1.0489076252775507e-42
+  35 31 34 33 32 64 37 30  37 32 36 39 37 36 36 62
+   2.0201199534021048e-76   1.279089716337543e+165
+   2.0201199534021048e-76   1.279089716337543e+165
+  36 35 37 39 32 64 36 38  36 35 37 38 35 64 32 30
+    6.580238509676993e-38   1.5883155047700367e-76
+    6.580238509676993e-38   1.5883155047700367e-76
+  32 64 36 34 32 30 32 64  36 31 36 35 37 33 32 64
+   4.498511144631635e+174   4.501428432316594e+174
+   4.498511144631635e+174   4.501428432316594e+174
+  33 32 33 35 33 36 32 64  36 33 36 32 36 33 32 30
+   4.504311739436622e+174   1.5717866252641838e-76
+   4.504311739436622e+174   1.5717866252641838e-76
+  32 64 36 31 32 30 32 64  36 39 36 65 32 30 37 34
+   4.498511100405513e+174   3.6941043732691224e-57
+   4.498511100405513e+174   3.6941043732691224e-57
+  36 30 20 44 52 4f 50 20  44 55 50 20 48 41 53 48
+   4.865776453998838e-153   2.6208557167997654e+40
+   4.865776453998838e-153   2.6208557167997654e+40
+  31 36 30 20 30 78 31 34  20 30 78 62 66 64 37 34
+    2.783049419442401e-57    3.726590431671888e-57
+    2.783049419442401e-57    3.726590431671888e-57
+  33 36 62 36 32 36 35 61  61 39 64 65 35 30 36 66
+   1.863859888595342e+160  2.3570113930402496e+184
+   1.863859888595342e+160  2.3570113930402496e+184
+  38 61 39 39 34 66 38 38  31 66 66 30 38 63 63 32
+    7.170290540950866e-38    5.753001329390586e-66
+    7.170290540950866e-38    5.753001329390586e-66
+  38 37 32 20 45 51 55 41  4c 56 45 52 49 46 59 20
+        5588244.503064923    7.54025010721777e-153
+        5588244.503064923    7.54025010721777e-153
+  43 48 45 43 4b 53 49 47  22 5d 5d 2c 0a 20 22 30
+   2.6299364878383027e+35    7.826594783640787e-77
+   2.6299364878383027e+35    7.826594783640787e-77
+  31 30 30 30 30 30 30 30  31 34 38 32 66 37 61 30
+   1.3980432860952892e-76   1.1894700754223397e-75
+   1.3980432860952892e-76   1.1894700754223397e-75
+  32 38 37 33 30 61 32 33  33 61 63 39 62 34 38 34
+    4.467843408343945e-62    3.856019035899928e-57
+    4.467843408343945e-62    3.856019035899928e-57
+  31 31 61 38 65 64 66 62  31 30 37 62 37 34 39 65
+  1.0315821081101588e+166  4.0853229013947314e+179
+  1.0315821081101588e+166  4.0853229013947314e+179
+  36 31 66 61 66 37 35 33  31 66 34 32 35 37 61 64
+    5.157422592974785e-62  3.4063639808898244e+175
+    5.157422592974785e-62  3.4063639808898244e+175
+  39 35 64 30 61 35 31 63  35 30 30 30 30 30 30 30
+   6.494428611704254e+169   1.3980432860952904e-76
+   6.494428611704254e+169   1.3980432860952904e-76
+  30 38 62 34 38 33 30 34  35 30 32 32 31 30 30 62
+   2.5808210616009045e-57   9.322181665331313e+164
+   2.5808210616009045e-57   9.322181665331313e+164
+  66 30 62 62 61 65 39 62  64 65 35 31 61 64 32 62
+  1.4624574999355995e+165  1.0591297094666834e+165
+  1.4624574999355995e+165  1.0591297094666834e+165
+  32 32 32 65 38 37 66 62  66 36 37 35 33 30 66 62
+  1.0234525533546295e+166  1.0221892109654477e+166
+  1.0234525533546295e+166  1.0221892109654477e+166
+  61 66 63 32 35 63 39 30  33 35 31 39 61 31 65 35
+   2.1925099232957173e-76   1.7701127456033408e-51
+   2.1925099232957173e-76   1.7701127456033408e-51
+  64 63 63 35 32 61 33 32  66 66 35 38 34 34 65 30
+     7.18831999591939e-67   1.4649651420567786e-75
+     7.18831999591939e-67   1.4649651420567786e-75
+  32 32 30 32 38 63 34 64  39 61 64 34 39 62 30 30
+   5.042467414930018e+174   1.4149226844168233e-76
+   5.042467414930018e+174   1.4149226844168233e-76
+  36 64 64 35 39 39 37 34  33 37 32 61 35 34 32 39
+    3.699721649001811e-57   3.5059512206510115e-33
+    3.699721649001811e-57   3.5059512206510115e-33
+  31 64 35 37 36 34 62 65  35 34 31 35 37 34 62 62
+  2.3605494793753785e+180   8.386363399047576e+165
+  2.3605494793753785e+180   8.386363399047576e+165
+  30 63 34 64 63 32 30 38  65 63 35 31 66 38 30 62
+    4.759820274948968e-38   9.340642994487804e+164
+    4.759820274948968e-38   9.340642994487804e+164
+  37 31 39 30 31 34 31 30  34 39 64 64 34 61 61 64
+   1.4857556909387592e-76  3.4388236687980686e+175
+   1.4857556909387592e-76  3.4388236687980686e+175
+  36 32 37 34 31 64 63 32  37 64 35 66 32 36 37 66
+    5.754128828922165e-66  2.4657238434047183e+184
+    5.754128828922165e-66  2.4657238434047183e+184
+  37 62 37 30 36 38 32 65  65 65 32 32 65 37 65 39
+   2.953219444976089e+179    3.268902138333929e-32
+   2.953219444976089e+179    3.268902138333929e-32
+  63 31 39 32 33 62 39 63  30 39 35 37 62 64 61 65
+   9.579672879975517e+169  2.2552777459305063e+180
+   9.579672879975517e+169  2.2552777459305063e+180
+  30 62 39 36 33 37 34 35  36 39 62 34 36 30 65 62
+   2.1106097489934822e-52    9.76122440290594e+165
+   2.1106097489934822e-52    9.76122440290594e+165
+  38 64 35 62 34 30 64 39  37 32 65 38 63 37 63 30
+    3.110500013501059e-32   1.3276456350764953e-75
+    3.110500013501059e-32   1.3276456350764953e-75
+  61 64 34 34 31 64 65 33  64 39 34 63 34 61 32 39
+   4.1599643240617895e-61    3.539802542267757e-33
+   4.1599643240617895e-61    3.539802542267757e-33
+  38 36 34 62 32 31 32 64  35 36 30 35 30 61 63 62
+   4.499477957020748e+174   8.927983412934524e+165
+   4.499477957020748e+174   8.927983412934524e+165
+  39 38 30 62 37 32 62 32  62 66 66 66 66 66 66 66
+    5.399463970914081e-66   1.903598566255292e+185
+    5.399463970914081e-66   1.903598566255292e+185
+  66 30 31 38 30 39 36 39  38 30 30 30 30 30 30 30
+    4.280069615946201e-33   1.3980432860952913e-76
+    4.280069615946201e-33   1.3980432860952913e-76
+  30 30 30 31 39 37 36 61  39 31 34 65 33 33 36 64
+  1.9520818967830314e+160   5.490735649862098e+174
+  1.9520818967830314e+160   5.490735649862098e+174
+  30 30 31 37 61 39 64 32  38 64 65 39 39 64 31 36
+    6.001240252270726e-66   1.1899745937890248e-47
+    6.001240252270726e-66   1.1899745937890248e-47
+  34 37 32 66 36 63 61 36  64 35 61 33 61 38 65 62
+    9.517634943046247e-47   9.775923170250995e+165
+    9.517634943046247e-47   9.775923170250995e+165
+  63 39 39 38 38 61 63 30  30 30 30 30 30 30 30 22
+   1.3389352741465624e-75     5.1856307557119e-144
+   1.3389352741465624e-75     5.1856307557119e-144
+  2c 20 22 50 32 53 48 22  5d 2c 0a 0a 5b 22 43 6f
+  1.5584206141976403e-143   9.065611035336691e+227
+  1.5584206141976403e-143   9.065611035336691e+227
+  72 72 65 63 74 20 73 69  67 6e 61 74 75 72 65 20
+   9.150375337773256e+199  1.2796785173062013e-152
+   9.150375337773256e+199  1.2796785173062013e-152
+  6f 72 64 65 72 22 5d 2c  0a 5b 22 4e 6f 74 65 20
+   5.4559428602240194e-95  1.2801390649300046e-152
+   5.4559428602240194e-95  1.2801390649300046e-152
+  74 68 65 20 69 6e 70 75  74 20 69 73 20 6a 75 73
+   4.934327929384365e+257  1.4972887189669272e+248
+   4.934327929384365e+257  1.4972887189669272e+248
+  74 20 72 65 71 75 69 72  65 64 20 74 6f 20 6d 61
+  1.3580751151253513e+243  2.0474768020549695e+161
+  1.3580751151253513e+243  2.0474768020549695e+161
+  6b 65 20 74 68 65 20 74  65 73 74 65 72 20 68 61
+  2.3478352548296135e+251  1.6960023182568688e+161
+  2.3478352548296135e+251  1.6960023182568688e+161
+  70 70 79 22 5d 2c 0a 5b  5b 5b 22 62 33 64 61 30
+  3.6284952476658386e+130   1.2015611195582085e-75
+  3.6284952476658386e+130   1.2015611195582085e-75
+  31 64 64 34 61 61 65 36  38 33 63 37 61 65 65 34
+   1.1703244897844192e-46    2.726865430046857e-56
+   1.1703244897844192e-46    2.726865430046857e-56
+  64 35 64 38 62 35 32 61  35 34 30 61 35 30 38 65
+  1.5999727865570864e+160  3.9206948296412744e+179
+  1.5999727865570864e+160  3.9206948296412744e+179
+  31 31 31 35 66 37 37 63  64 37 66 61 39 61 32 39
+   8.761783375779977e+169    3.539817215229996e-33
+   8.761783375779977e+169    3.539817215229996e-33
+  31 32 34 33 66 35 30 31  32 32 33 22 2c 20 30 2c
+    9.173737230339823e-72    7.549518397823168e-96
+    9.173737230339823e-72    7.549518397823168e-96
+  20 22 48 41 53 48 31 36  30 20 30 78 31 34 20 30
+   1.1825180300277662e-47    6.996971879148275e-77
+   1.1825180300277662e-47    6.996971879148275e-77
+  78 62 31 63 65 39 39 32  39 38 64 35 66 30 37 33
+    9.356177002674804e-67    5.636948126504202e-62
+    9.356177002674804e-67    5.636948126504202e-62
+  36 34 62 35 37 62 31 65  35 63 39 63 63 30 30 62
+   2.817724481059819e+179   9.322622695222246e+164
+   2.817724481059819e+179   9.322622695222246e+164
+  65 30 62 30 34 61 39 35  34 20 45 51 55 41 4c 22
+   2.6497645874076065e-52  1.8102167830449426e-143
+   2.6497645874076065e-52  1.8102167830449426e-143
+  5d 5d 2c 0a 22 30 31 30  30 30 30 30 30 30 31 32
+    1.484386327115762e-76    6.375470807240379e-67
+    1.484386327115762e-76    6.375470807240379e-67
+  33 31 32 35 30 33 66 32  34 39 31 61 32 61 39 37
+    6.587536575406359e-66   1.1380639865001749e-42
+    6.587536575406359e-66   1.1380639865001749e-42
+  66 63 64 37 37 35 66 31  31 65 31 30 38 61 35 34
+   1.0055368901014826e-70   3.4059928476520306e-57
+   1.0055368901014826e-70   3.4059928476520306e-57
+  30 61 35 35 32 38 62 35  64 34 64 65 65 37 61 33
+   1.5217649905076187e-51    3.348058243557347e-61
+   1.5217649905076187e-51    3.348058243557347e-61
+  63 36 38 61 65 34 61 64  64 30 31 64 61 62 33 30
+   3.404190733009531e+175   1.6740606981128116e-76
+   3.404190733009531e+175   1.6740606981128116e-76
+  30 30 30 30 30 30 30 66  64 66 65 30 30 30 30 34
+   1.719637360272639e+184   2.5789346722305025e-57
+   1.719637360272639e+184   2.5789346722305025e-57
+  38 33 30 34 35 30 32 32  31 30 30 66 36 36 34 39
+    6.746419809741631e-67    3.892644838339663e-33
+    6.746419809741631e-67    3.892644838339663e-33
+  62 30 65 64 64 66 64 66  64 34 61 64 35 35 34 32
+  1.7336318049520826e+185    7.495506648586687e-67
+  1.7336318049520826e+185    7.495506648586687e-67
+  36 36 36 33 33 38 35 30  39 30 64 35 31 65 65 38
+   1.8325544854114986e-76    5.030006651624863e-37
+   1.8325544854114986e-76    5.030006651624863e-37
+  36 63 33 34 38 31 62 64  63 36 62 30 63 31 38 65
+   3.599599938091167e+175   3.921441295935179e+179
+   3.599599938091167e+175   3.921441295935179e+179
+  61 36 63 30 65 63 65 32  63 30 62 30 32 32 30 35
+    6.346678066059676e-66   1.6909494759572503e-52
+    6.346678066059676e-66   1.6909494759572503e-52
+  36 31 63 33 31 35 62 30  37 63 66 66 61 36 66 37
+   1.2579637944888645e-75    7.968316218424969e-42
+   1.2579637944888645e-75    7.968316218424969e-42
+  64 64 39 64 66 39 36 64  62 61 65 39 32 30 30 63
+    5.49672491378769e+174   6.109390896761388e+169
+    5.49672491378769e+174   6.109390896761388e+169
+  32 64 65 65 30 39 62 66  39 33 63 63 33 35 63 61
+  1.5486619666440824e+185  1.3502235240785035e+161
+  1.5486619666440824e+185  1.3502235240785035e+161
+  30 35 65 36 63 64 66 36  31 33 33 34 30 61 61 30
+   1.2257058515911825e-46   1.2007481269376064e-75
+   1.2257058515911825e-46   1.2007481269376064e-75
+  31 34 38 33 30 34 35 30  32 32 30 37 61 61 63 65
+    1.831201130790593e-76  2.5131008922039227e+180
+    1.831201130790593e-76  2.5131008922039227e+180
+  65 38 32 30 65 30 38 62  30 62 31 37 34 65 32 34
+  1.3929526243232116e+165   2.9305448234306067e-57
+  1.3929526243232116e+165   2.9305448234306067e-57
+  38 61 62 64 38 64 37 61  33 34 65 64 36 33 62 35
+  2.0553960289227306e+160    1.520138997200144e-51
+  2.0553960289227306e+160    1.520138997200144e-51
+  64 61 33 61 62 65 64 62  39 39 39 33 34 64 66 39
+   9.396223133751485e+165   3.4499447347099455e-32
+   9.396223133751485e+165   3.4499447347099455e-32
+  66 64 64 64 36 35 63 30  35 63 34 30 32 32 31 30
+   1.3270586158321518e-75   1.4850823079485238e-76
+   1.3270586158321518e-75   1.4850823079485238e-76
+  30 64 66 65 38 37 38 39  36 61 62 35 65 65 33 64
+    4.663775000901952e-33   4.797239157643542e+174
+    4.663775000901952e-33   4.797239157643542e+174
+  66 34 37 36 63 32 36 35  35 66 39 66 62 65 35 62
+   2.3174568026819546e-52  1.2321140055317817e+165
+   2.3174568026819546e-52  1.2321140055317817e+165
+  64 30 38 39 64 63 63 62  65 66 33 65 34 65 61 30
+    8.93194819140839e+165   1.2018320666736454e-75
+    8.93194819140839e+165   1.2018320666736454e-75
+  35 62 35 64 31 32 31 31  36 39 66 65 37 66 35 66
+    9.732628531555891e-72  2.2731944204073416e+184
+    9.732628531555891e-72  2.2731944204073416e+184
+  34 30 31 34 63 36 39 35  32 32 31 30 33 31 64 31
+   2.6323027306706026e-52    9.142698413799475e-71
+   2.6323027306706026e-52    9.142698413799475e-71
+  31 64 62 33 38 39 37 32  62 37 31 32 61 39 66 65
+    8.614080024583139e-67  2.8818566316832673e+180
+    8.614080024583139e-67  2.8818566316832673e+180
+  31 66 63 30 32 33 35 37  37 63 37 61 65 33 64 64
+     9.50640186455119e-43   3.997010789002377e+175
+     9.50640186455119e-43   3.997010789002377e+175
+  62 34 61 33 30 30 34 31  38 37 64 34 31 63 34 35
+    1.142613635712512e-71   2.1285511386918173e-52
+    1.142613635712512e-71   2.1285511386918173e-52
+  31 32 31 65 65 63 66 64  62 62 35 62 37 32 31 30
+   4.429839038469605e+175   1.4850891542201607e-76
+   4.429839038469605e+175   1.4850891542201607e-76
+  32 30 37 65 63 33 36 39  31 31 62 36 61 64 32 33
+    4.275706110012453e-33    4.470873875668481e-62
+    4.275706110012453e-33    4.470873875668481e-62
+  38 32 38 36 30 64 33 32  39 38 39 63 37 62 38 37
+     7.19265542065683e-67   1.0934010245176636e-42
+     7.19265542065683e-67   1.0934010245176636e-42
+  32 38 65 39 34 38 39 64  37 62 62 63 39 34 61 36
+  6.2375606543211035e+174    9.417163955375257e-47
+  6.2375606543211035e+174    9.417163955375257e-47
+  62 35 35 30 39 65 66 30  30 32 39 62 65 31 32 38
+   1.5472838617490456e-75    5.346428440264864e-38
+   1.5472838617490456e-75    5.346428440264864e-38
+  38 32 31 30 32 34 65 61  39 66 61 63 30 36 66 36
+   1.490538701121588e+161   1.2158276270412889e-46
+   1.490538701121588e+161   1.2158276270412889e-46
+  36 36 61 34 61 64 63 33  66 63 31 33 35 37 62 37
+    3.771168304741017e-61    6.534545946332417e-42
+    3.771168304741017e-61    6.534545946332417e-42
+  62 65 63 31 66 64 30 62  64 65 63 65 32 62 39 64
+   9.439619104136388e+164   6.278131398932721e+174
+   9.439619104136388e+164   6.278131398932721e+174
+  30 38 35 37 39 32 32 36  61 38 65 62 64 65 35 33
+   1.2450335378928692e-47    5.201094800627052e-62
+   1.2450335378928692e-47    5.201094800627052e-62
+  30 35 38 65 34 35 33 61  65 66 66 66 66 66 66 66
+  1.6877807554742056e+160   1.903598566255293e+185
+  1.6877807554742056e+160   1.903598566255293e+185
+  66 30 31 38 30 33 38 30  31 30 30 30 30 30 30 30
+   2.0899488627059795e-76   1.3980432860952892e-76
+   2.0899488627059795e-76   1.3980432860952892e-76
+  30 30 30 31 39 37 36 61  39 31 34 63 39 62 39 39
+  1.9520818967830314e+160    4.888720513401303e-33
+  1.9520818967830314e+160    4.888720513401303e-33
+  63 64 64 66 38 34 37 64  31 30 36 38 35 61 34 66
+  5.7390510730457635e+174  2.1648885361378297e+184
+  5.7390510730457635e+174  2.1648885361378297e+184
+  61 62 61 61 30 62 61 66  35 30 35 66 37 63 33 64
+  1.4772902785187368e+185   4.795134006368089e+174
+  1.4772902785187368e+185   4.795134006368089e+174
+  66 61 62 38 38 61 63 30  30 30 30 30 30 30 30 22
+   1.3389352748086074e-75     5.1856307557119e-144
+   1.3389352748086074e-75     5.1856307557119e-144
+  2c 20 22 50 32 53 48 22  5d 2c 0a 0a 5b 22 63 63
+  1.5584206141976403e-143   5.776940643947191e+170
+  1.5584206141976403e-143   5.776940643947191e+170
+  36 30 62 31 66 38 39 39  65 63 30 61 36 39 62 37
+    4.857254896456351e-33    6.537355000577081e-42
+    4.857254896456351e-33    6.537355000577081e-42
+  63 33 66 32 35 64 64 66  33 32 63 34 35 32 34 30
+  1.7329066832048312e+185   1.7441713394570263e-76
+  1.7329066832048312e+185   1.7441713394570263e-76
+  39 36 61 39 63 35 62 30  31 63 62 64 38 34 63 36
+   1.2580165301549998e-75    1.051192006086631e-46
+   1.2580165301549998e-75    1.051192006086631e-46
+  64 30 33 31 32 61 30 63  34 37 38 39 38 34 2c 20
+    6.18162671193215e+169  1.0517745723279363e-153
+    6.18162671193215e+169  1.0517745723279363e-153
+  77 68 69 63 68 20 69 73  20 61 20 66 61 69 72 6c
+   8.784156227149249e+247   2.479302179937532e+214
+   8.784156227149249e+247   2.479302179937532e+214
+  79 20 73 74 72 61 6e 67  65 20 74 72 61 6e 73 61
+  1.6920156718255162e+190   2.731849333205835e+161
+  1.6920156718255162e+190   2.731849333205835e+161
+  63 74 69 6f 6e 20 77 68  69 63 68 20 72 65 6c 69
+   1.688226039764144e+195   6.792481754618904e+199
+   1.688226039764144e+195   6.792481754618904e+199
+  65 73 20 6f 6e 20 4f 50  5f 43 48 45 43 4b 53 49
+    7.208447795314615e+78   1.7210818849099644e+45
+    7.208447795314615e+78   1.7210818849099644e+45
+  47 20 72 65 74 75 72 6e  69 6e 67 20 30 20 77 68
+  1.0675799966100744e+224  1.6881566356137992e+195
+  1.0675799966100744e+224  1.6881566356137992e+195
+  65 6e 20 63 68 65 63 6b  69 6e 67 20 61 20 63 6f
+  1.9927001676660847e+209   3.624781420874313e+228
+  1.9927001676660847e+209   3.624781420874313e+228
+  6d 70 6c 65 74 65 6c 79  20 69 6e 76 61 6c 69 64
+   7.865166126845558e+276   5.030376296178568e+175
+   7.865166126845558e+276   5.030376296178568e+175
+  20 73 69 67 20 6f 66 20  6c 65 6e 67 74 68 20 30
+  1.3385685900216431e-152    7.085123989292991e-77
+  1.3385685900216431e-152    7.085123989292991e-77
+  22 5d 2c 0a 5b 5b 5b 22  63 62 65 62 63 34 64 61
+  3.5053249760825546e-143   1.420295942040096e+161
+  3.5053249760825546e-143   1.420295942040096e+161
+  37 33 31 65 38 39 39 35  66 65 39 37 66 36 66 61
+   2.6334580272342082e-52   1.561439218918912e+161
+   2.6334580272342082e-52   1.561439218918912e+161
+  64 63 64 37 33 31 62 33  36 61 64 34 30 65 35 65
+   3.5378206970364445e-61   3.467968463473454e+179
+   3.5378206970364445e-61   3.467968463473454e+179
+  63 62 33 31 65 33 38 65  39 30 34 66 36 65 35 39
+   3.922712582092819e+179   4.1205967030304924e-33
+   3.922712582092819e+179   4.1205967030304924e-33
+  38 32 66 61 30 39 66 37  22 2c 20 30 2c 20 22 30
+    7.972251789607182e-42    7.826818902146156e-77
+    7.972251789607182e-42    7.826818902146156e-77
+  78 32 31 30 32 30 38 35  63 36 36 30 30 36 35 37
+   2.5253727836116353e-52    9.511643044519377e-43
+   2.5253727836116353e-52    9.511643044519377e-43
+  35 36 36 61 63 63 32 64  36 33 38 32 61 34 37 62
+   4.547969585590409e+174  1.3362628026805384e+165
+   4.547969585590409e+174  1.3362628026805384e+165
+  63 33 66 33 32 34 30 30  38 64 32 61 61 31 30 39
+   1.3993953395102452e-76    3.118637587006462e-33
+   1.3993953395102452e-76    3.118637587006462e-33
+  34 30 64 64 37 37 30 35  61 34 38 61 61 32 61 35
+   1.6929969227084498e-52   1.4363436213377713e-51
+   1.6929969227084498e-52   1.4363436213377713e-51
+  61 35 65 33 33 61 63 37  63 32 31 30 33 66 35 64
+    6.952121945385188e-42   5.292677320306809e+174
+    6.952121945385188e-42   5.292677320306809e+174
+  30 66 62 39 35 35 66 39  35 64 64 36 62 65 36 31
+    3.421660046218861e-32   1.2675703686986785e-71
+    3.421660046218861e-32   1.2675703686986785e-71
+  31 35 63 65 38 35 36 36  31 64 62 34 31 32 65 63
+   1.5195256179057621e-47   6.399451716777124e+170
+   1.5195256179057621e-47   6.399451716777124e+170
+  36 61 30 38 61 62 63 62  66 63 65 37 64 61 30 62
+   8.930127508935327e+165    9.43285336577361e+164
+   8.930127508935327e+165    9.43285336577361e+164
+  61 38 32 39 37 63 36 63  63 30 65 63 34 61 63 37
+   8.448981547889176e+169    6.952128445547334e-42
+   8.448981547889176e+169    6.952128445547334e-42
+  63 35 33 37 39 61 38 32  30 64 36 38 64 66 39 65
+    9.042962729915374e-67  4.1170920856574375e+179
+    9.042962729915374e-67  4.1170920856574375e+179
+  33 32 61 31 34 37 63 66  66 61 33 36 31 39 33 63
+   1.632985046418211e+185   7.254841630370785e+169
+   1.632985046418211e+185   7.254841630370785e+169
+  36 66 37 63 34 33 61 31  63 38 63 36 39 63 64 61
+    7.787892212593794e-71  1.4331565270137188e+161
+    7.787892212593794e-71  1.4331565270137188e+161
+  35 33 30 65 31 63 36 64  62 33 35 34 62 66 61 62
+  5.5371025519835575e+174   8.015955146117301e+165
+  5.5371025519835575e+174   8.015955146117301e+165
+  64 63 66 65 66 61 66 33  63 38 37 35 33 37 39 61
+    4.352312455812694e-61  2.2156821033408548e+160
+    4.352312455812694e-61  2.2156821033408548e+160
+  38 32 30 66 35 33 31 66  33 30 34 31 64 33 31 33
+  1.8271182599389952e+184      4.1812701119921e-62
+  1.8271182599389952e+184      4.1812701119921e-62
+  36 37 30 31 65 61 30 39  30 36 37 63 35 33 65 37
+    3.154759977296687e-33    7.605138999904619e-42
+    3.154759977296687e-33    7.605138999904619e-42
+  31 35 39 63 38 66 39 62  32 37 34 36 61 35 36 63
+   1.462646422050136e+165   8.381409954865384e+169
+   1.462646422050136e+165   8.381409954865384e+169
+  33 64 38 32 39 36 36 63  35 34 62 62 63 35 35 33
+   8.382653724939948e+169    5.155512366070538e-62
+   8.382653724939948e+169    5.155512366070538e-62
+  32 32 36 38 37 39 61 35  34 37 39 38 32 37 37 30
+    1.438573745859396e-51     2.00493921420265e-76
+    1.438573745859396e-51     2.00493921420265e-76
+  31 32 30 30 31 32 32 61  35 39 61 35 33 37 39 38
+  1.5988773256857027e+160    7.410206223169826e-38
+  1.5988773256857027e+160    7.410206223169826e-38
+  32 37 37 30 31 32 30 30  31 32 32 61 35 39 61 36
+   1.3987193046797025e-76    9.427821533262323e-47
+   1.3987193046797025e-76    9.427821533262323e-47
+  33 35 33 37 39 38 32 37  37 35 33 37 39 38 32 37
+    8.169961532207115e-43    8.169961532207122e-43
+    8.169961532207115e-43    8.169961532207122e-43
+  37 38 37 37 39 36 37 39  61 36 38 22 5d 5d 2c 0a
+    4.470432098645221e-33  1.1530070993005209e-259
+    4.470432098645221e-33  1.1530070993005209e-259
+  22 30 31 30 30 30 30 30  30 30 31 66 37 30 39 66
+   1.3980432861153922e-76  2.6756974356087333e+184
+   1.3980432861153922e-76  2.6756974356087333e+184
+  61 38 32 35 39 36 65 34  66 39 30 38 65 65 33 33
+   2.7033890882648068e-56    4.714924829709199e-62
+   2.7033890882648068e-56    4.714924829709199e-62
+  31 63 62 35 65 30 65 64  34 36 61 62 33 33 31 64
+   4.192555870728174e+175   4.254083600862948e+174
+   4.192555870728174e+175   4.254083600862948e+174
+  37 64 63 66 61 66 36 39  37 66 65 39 35 38 39 31
+   4.3140683816131156e-33   1.4273766326265037e-71
+   4.3140683816131156e-33   1.4273766326265037e-71
+  65 37 33 64 61 63 34 65  62 63 62 30 30 30 30 30
+   3.304733333694316e+179   1.3980432871046924e-76
+   3.304733333694316e+179   1.3980432871046924e-76
+  30 30 30 38 63 32 30 63  61 34 32 30 39 35 38 34
+    6.11262144961044e+169     3.85654158466454e-57
+    6.11262144961044e+169     3.85654158466454e-57
+  30 37 33 35 65 38 39 32  38 33 66 65 63 32 39 38
+    9.354727077185105e-67    7.404682585223664e-38
+    9.354727077185105e-67    7.404682585223664e-38
+  65 36 32 61 63 32 64 64  65 61 39 62 35 66 33 34
+  3.9962318429194835e+175   3.0904791555430156e-57
+  3.9962318429194835e+175   3.0904791555430156e-57
+  61 38 63 62 62 37 30 39  37 61 64 39 36 35 62 38
+     3.12315443771849e-33    4.280646995658412e-37
+     3.12315443771849e-33    4.280646995658412e-37
+  37 35 36 38 31 30 30 32  30 31 62 31 62 30 31 64
+     6.00455602935966e-67   4.251361851651114e+174
+     6.00455602935966e-67   4.251361851651114e+174
+  63 38 32 39 31 37 37 64  61 34 61 31 34 35 35 31
+   5.741922392170018e+174   1.2003205072506461e-71
+   5.741922392170018e+174   1.2003205072506461e-71
+  64 32 66 63 39 36 61 39  64 62 30 30 63 36 35 30
+    2.651899711371713e-32   1.8319430223709427e-76
+    2.651899711371713e-32   1.8319430223709427e-76
+  31 65 64 66 61 31 32 66  32 32 63 64 39 63 65 66
+  1.9325872764784553e+184  1.8175622409113442e+185
+  1.9325872764784553e+184  1.8175622409113442e+185
+  64 33 33 35 63 32 32 37  66 34 38 33 30 34 35 30
+    8.159739115930277e-43   1.8312011307906093e-76
+    8.159739115930277e-43   1.8312011307906093e-76
+  32 32 31 30 30 61 39 64  66 36 30 35 33 36 64 66
+   6.277156932408138e+174   1.717633886591864e+185
+   6.277156932408138e+174   1.717633886591864e+185
+  35 37 33 33 64 64 30 64  65 36 62 63 39 32 31 66
+  4.0542780126809725e+174   1.826709774242264e+184
+  4.0542780126809725e+174   1.826709774242264e+184
+  61 62 30 62 33 65 65 65  36 34 32 36 35 30 31 62
+    2.77438106067602e+180   9.898077916094913e+164
+    2.77438106067602e+180   9.898077916094913e+164
+  34 33 61 32 32 38 61 66  61 32 63 39 30 30 37 32
+  1.4633502615805297e+185    8.600994701035341e-67
+  1.4633502615805297e+185    8.600994701035341e-67
+  65 62 35 63 61 30 32 32  30 31 63 37 38 62 37 34
+    6.746669880467823e-67   3.7252335997223496e-57
+    6.746669880467823e-67   3.7252335997223496e-57
+  32 36 36 66 61 63 37 64  31 64 62 35 64 65 66 66
+   5.784614118741283e+174  1.9032637632822313e+185
+   5.784614118741283e+174  1.9032637632822313e+185
+  30 38 30 64 38 61 34 30  33 37 34 33 32 30 33 66
+   1.7600310045456184e-76  2.0383234168663217e+184
+   1.7600310045456184e-76  2.0383234168663217e+184
+  31 30 39 66 62 63 61 62  66 36 64 35 61 37 36 30
+   8.010557822951094e+165    1.918639449486515e-76
+   8.010557822951094e+165    1.918639449486515e-76
+  62 66 38 37 33 38 36 64  32 30 31 30 30 66 66 66
+   5.495565643874299e+174  1.9035282685995604e+185
+   5.495565643874299e+174  1.9035282685995604e+185
+  66 66 66 66 66 30 31 63  30 37 35 37 39 30 30 30
+   6.487087599290902e+169   1.3980551822019662e-76
+   6.487087599290902e+169   1.3980551822019662e-76
+  30 30 30 30 30 30 30 32  33 32 31 30 33 36 31 31
+    6.004550192171637e-67    9.741487485719858e-72
+    6.004550192171637e-67    9.741487485719858e-72
+  66 39 61 34 35 63 31 38  66 32 38 66 30 36 66 31
+    5.109735995206138e-38   1.0057090489569512e-70
+    5.109735995206138e-38   1.0057090489569512e-70
+  39 30 37 36 61 64 35 37  31 63 33 34 34 63 38 32
+    9.592553138291061e-43    9.045832181913155e-67
+    9.592553138291061e-43    9.045832181913155e-67
+  63 65 38 66 63 66 65 33  34 34 36 34 63 66 38 30
+   4.1616325628918915e-61   2.1072209157718265e-76
+   4.1616325628918915e-61   2.1072209157718265e-76
+  38 35 32 31 37 61 32 64  32 39 34 61 36 61 63 30
+   4.545870554633687e+174     1.33893333446642e-75
+   4.545870554633687e+174     1.33893333446642e-75
+  30 30 30 30 30 30 30 22  2c 20 22 50 32 53 48 22
+     5.1856307557119e-144  1.5584206141976403e-143
+     5.1856307557119e-144  1.5584206141976403e-143
+  5d 2c 0a 0a 5b 22 45 6d  70 74 79 20 70 75 62 6b
+  2.3313781429971447e+218  1.8963963356611848e+209
+  2.3313781429971447e+218  1.8963963356611848e+209
+  65 79 22 5d 2c 0a 5b 5b  5b 22 32 32 39 32 35 37
+  1.1995562572256517e+132    9.504698185726178e-43
+  1.1995562572256517e+132    9.504698185726178e-43
+  63 32 39 35 65 37 66 35  35 35 34 32 31 63 31 62
+     1.85559931226995e-51  1.0012764933064469e+165
+     1.85559931226995e-51  1.0012764933064469e+165
+  66 65 63 38 35 33 38 64  64 33 30 61 34 62 35 63
+  5.9854033400596075e+174   8.070094725111163e+169
+  5.9854033400596075e+174   8.070094725111163e+169
+  33 37 63 31 63 38 38 31  30 62 62 65 38 33 63 61
+   1.3708183377423878e-71  1.3496797117553807e+161
+   1.3708183377423878e-71  1.3496797117553807e+161
+  66 61 37 38 31 31 36 35  32 63 22 2c 20 30 2c 20
+   2.3169693290074516e-52  1.0511782037431644e-153
+   2.3169693290074516e-52  1.0511782037431644e-153
+  22 30 78 30 30 20 43 48  45 43 4b 53 49 47 20 4e
+    1.301630096138019e+40   2.1943324184466933e+68
+    1.301630096138019e+40   2.1943324184466933e+68
+  4f 54 22 5d 5d 2c 0a 22  30 31 30 30 30 30 30 30
+  1.0480224142315354e-144   1.3980432860953674e-76
+  1.0480224142315354e-144   1.3980432860953674e-76
+  30 31 32 63 36 35 31 31  37 38 66 61 63 61 38 33
+     9.73930425569338e-72    5.926552452764425e-62
+     9.73930425569338e-72    5.926552452764425e-62
+  62 65 30 62 38 31 63 38  63 31 33 37 35 63 34 62
+    4.512080192311561e-37  1.1740383149416939e+165
+    4.512080192311561e-37  1.1740383149416939e+165
+  30 61 64 33 38 64 35 33  63 38 66 65 31 62 31 63
+    5.199981357747203e-62   6.560492574078514e+169
+    5.199981357747203e-62   6.560492574078514e+169
+  34 32 35 35 66 35 65 37  39 35 63 32 35 37 39 32
+    7.608208830371694e-42    9.353006435979051e-67
+    7.608208830371694e-42    9.353006435979051e-67
+  32 32 30 30 30 30 30 30  30 30 34 39 34 38 33 30
+   1.3980432860954466e-76   1.6598324629290097e-76
+   1.3980432860954466e-76   1.6598324629290097e-76
+  34 35 30 32 32 31 30 30  64 36 30 34 34 35 36 32
+   1.3983832822744672e-76    8.237341153481307e-67
+   1.3983832822744672e-76    8.237341153481307e-67
+  32 38 34 61 63 37 36 63  39 38 35 30 31 38 66 63
+   8.384370847495899e+169   6.708444815151395e+170
+   8.384370847495899e+169   6.708444815151395e+170
+  34 61 39 30 31 32 37 38  34 37 37 30 38 63 39 65
+    6.816710270631261e-38  4.1150836855378334e+179
+    6.816710270631261e-38  4.1150836855378334e+179
+  64 62 32 38 30 39 39 36  63 35 30 37 62 32 38 62
+   1.7258545168331702e-47  1.3933999036201831e+165
+   1.7258545168331702e-47  1.3933999036201831e+165
+  61 62 64 63 34 62 32 61  30 32 32 30 33 64 37 34
+  1.6153571305887717e+160    3.726465980164867e-57
+  1.6153571305887717e+160    3.726465980164867e-57
+  65 63 61 33 66 31 61 34  64 31 65 65 61 37 66 66
+   2.1911979679503617e-56  1.8879898990090142e+185
+   2.1911979679503617e-56  1.8879898990090142e+185
+  37 37 62 35 32 38 66 64  65 36 64 35 64 63 33 32
+   4.396449474268639e+175     7.19150080326701e-67
+   4.396449474268639e+175     7.19150080326701e-67
+  34 65 63 32 64 62 66 64  62 39 36 34 62 61 38 38
+   4.429062512632424e+175     7.16475700577787e-38
+   4.429062512632424e+175     7.16475700577787e-38
+  35 66 36 34 33 62 39 37  30 34 63 64 30 31 66 66
+   1.1382397128156072e-42  1.8859345869741195e+185
+   1.1382397128156072e-42  1.8859345869741195e+185
+  66 66 66 66 66 66 30 31  30 31 30 30 30 30 30 30
+     9.28207105579738e-72   1.3980432860953674e-76
+     9.28207105579738e-72   1.3980432860953674e-76
+  30 30 30 30 30 30 30 30  32 33 32 31 30 32 63 32
+    1.398043286095289e-76    5.696167901572334e-66
+    1.398043286095289e-76    5.696167901572334e-66
+  34 31 30 66 38 38 39 31  61 65 39 31 38 63 61 62
+   1.4273793745835712e-71   8.010261126418508e+165
+   1.4273793745835712e-71   8.010261126418508e+165
+  34 66 66 63 34 62 62 34  61 33 62 30 38 38 31 62
+    2.342942670894952e-56   9.916099732587483e+164
+    2.342942670894952e-56   9.916099732587483e+164
+  65 36 37 63 37 61 31 65  37 66 61 61 38 62 35 61
+   2.817091758031381e+179  1.8789707133250396e+160
+   2.817091758031381e+179  1.8789707133250396e+160
+  63 66 39 61 62 38 39 33  32 65 63 33 30 63 61 63
+    6.130703447555408e-62   5.249567915651501e+170
+    6.130703447555408e-62   5.249567915651501e+170
+  30 30 30 30 30 30 30 30  22 2c 20 22 50 32 53 48
+    1.398043286095289e-76    2.612896978874658e+40
+    1.398043286095289e-76    2.612896978874658e+40
+  22 5d 2c 0a 0a 5b 22 45  6d 70 74 79 20 73 69 67
+    1.109529265175422e+25  1.4173927013514604e+190
+    1.109529265175422e+25  1.4173927013514604e+190
+  6e 61 74 75 72 65 22 5d  2c 0a 5b 5b 5b 22 39 63
+   4.381450912932857e+140   9.485555088992687e+169
+   4.381450912932857e+140   9.485555088992687e+169
+  61 39 33 63 66 64 38 65  33 38 30 36 62 39 64 39
+   3.953740664018765e+179    3.116024432688206e-32
+   3.953740664018765e+179    3.116024432688206e-32
+  65 32 62 61 31 63 66 36  34 65 33 63 63 36 39 34
+   1.2254504087214528e-46    4.016575657968095e-57
+   1.2254504087214528e-46    4.016575657968095e-57
+  36 65 65 30 31 31 39 36  37 30 62 31 37 39 36 61
+   1.7237173172999413e-47  1.9527656960103952e+160
+   1.7237173172999413e-47  1.9527656960103952e+160
+  30 39 39 32 38 64 31 34  65 61 32 35 66 37 22 2c
+    2.770623007063904e-57    4.264165233897788e-96
+    2.770623007063904e-57    4.264165233897788e-96
+  20 30 2c 20 22 30 78 32  31 20 30 78 30 32 38 61
+   1.4354936834314724e-65     2.1260928222961e+160
+   1.4354936834314724e-65     2.1260928222961e+160
+  31 64 36 36 39 37 35 64  62 64 66 39 37 38 39 37
+   5.247291736937283e+174   1.1308856466538576e-42
+   5.247291736937283e+174   1.1308856466538576e-42
+  65 33 61 34 61 65 66 34  35 30 65 62 65 62 35 62
+   2.8543127600887637e-56  1.2314417914024218e+165
+   2.8543127600887637e-56  1.2314417914024218e+165
+  35 32 39 33 65 34 61 30  62 34 61 36 64 33 61 32
+   1.1886593845345127e-75    5.104089583722372e-66
+   1.1886593845345127e-75    5.104089583722372e-66
+  64 61 61 61 30 62 32 62  31 31 30 65 30 32 20 43
+  1.0586369274211826e+165       2279391532423320.5
+  1.0586369274211826e+165       2279391532423320.5
+  48 45 43 4b 53 49 47 20  4e 4f 54 22 5d 5d 2c 0a
+   3.473562171710332e-153   1.153007099566446e-259
+   3.473562171710332e-153   1.153007099566446e-259
+  22 30 31 30 30 30 30 30  30 30 31 66 37 32 35 65
+   1.3980432861153922e-76   3.435694800520471e+179
+   1.3980432861153922e-76   3.435694800520471e+179
+  61 31 34 38 64 39 32 30  39 36 61 37 39 62 31 37
+    1.573871375752444e-76    7.795114197803268e-43
+    1.573871375752444e-76    7.795114197803268e-43
+  30 39 36 31 31 65 30 36  65 39 34 63 36 33 63 34
+   1.1218107079140014e-47    2.446995374236463e-56
+   1.1218107079140014e-47    2.446995374236463e-56
+  65 66 36 31 63 62 61 65  32 64 39 62 39 30 36 33
+  2.2542666129103572e+180    5.393695327520872e-62
+  2.2542666129103572e+180    5.393695327520872e-62
+  38 38 65 66 64 33 63 61  39 39 63 30 30 30 30 30
+  1.3497269114756517e+161   1.3980432871214885e-76
+  1.3497269114756517e+161   1.3980432871214885e-76
+  30 30 30 30 31 30 30 66  66 66 66 66 66 66 66 30
+   1.719638981177158e+184   1.5476014050729244e-75
+   1.719638981177158e+184   1.5476014050729244e-75
+  31 30 31 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432861153968e-76    1.398043286095289e-76
+   1.3980432861153968e-76    1.398043286095289e-76
+  30 32 33 32 31 30 32 38  61 31 64 36 36 39 37 35
+     5.34504647930881e-38    2.424644806832282e-52
+     5.34504647930881e-38    2.424644806832282e-52
+  64 62 64 66 39 37 38 39  37 65 33 61 34 61 65 66
+    4.663777951027268e-33  1.8168918186604616e+185
+    4.663777951027268e-33  1.8168918186604616e+185
+  34 35 30 65 62 65 62 35  62 35 32 39 33 65 34 61
+   1.5365083391532137e-51  1.7921241085579626e+160
+   1.5365083391532137e-51  1.7921241085579626e+160
+  30 62 34 61 36 64 33 61  32 64 61 61 61 30 62 32
+    1.70391569050916e+160    5.397335872040929e-66
+    1.70391569050916e+160    5.397335872040929e-66
+  62 31 31 30 65 30 32 61  63 30 30 30 30 30 30 30
+  1.5982605665413194e+160   1.3980432860953045e-76
+  1.5982605665413194e+160   1.3980432860953045e-76
+  30 22 2c 20 22 50 32 53  48 22 5d 2c 0a 0a 5b 5b
+    5.968685125563565e+92  1.1995331129399686e+132
+    5.968685125563565e+92  1.1995331129399686e+132
+  5b 22 34 34 34 65 30 30  65 64 37 38 34 30 64 34
+    1.415928145575554e-76   2.5729449875222984e-56
+    1.415928145575554e-76   2.5729449875222984e-56
+  31 66 32 30 65 63 64 39  63 31 31 64 33 66 39 31
+    3.141309261151287e-32   1.4375450018559534e-71
+    3.141309261151287e-32   1.4375450018559534e-71
+  39 38 32 33 32 36 63 37  33 31 61 30 32 66 33 63
+    6.891860633338304e-42   7.321186441287293e+169
+    6.891860633338304e-42   7.321186441287293e+169
+  30 35 37 34 38 34 31 34  61 34 66 61 39 65 35 39
+   2.7407525526465426e-57    4.120605464083744e-33
+   2.7407525526465426e-57    4.120605464083744e-33
+  62 65 22 2c 20 30 2c 20  22 31 20 30 78 30 30 20
+  1.0511782037432386e-153  1.2074556861044643e-153
+  1.0511782037432386e-153  1.2074556861044643e-153
+  30 78 32 31 20 30 78 30  32 31 33 36 62 30 34 37
+    3.342265106080618e-75    9.053060071386442e-43
+    3.342265106080618e-75    9.053060071386442e-43
+  35 38 62 30 62 36 65 33  36 33 65 37 61 36 66 62
+    4.125165991348417e-61  1.0233012922041482e+166
+    4.125165991348417e-61  1.0233012922041482e+166
+  65 38 33 61 61 66 35 32  37 61 31 35 33 64 62 32
+    7.937672748511037e-67    5.457401409831273e-66
+    7.937672748511037e-67    5.457401409831273e-66
+  62 30 36 30 64 33 36 63  63 32 39 66 37 66 38 33
+    8.37847868775595e+169    5.931137101463909e-62
+    8.37847868775595e+169    5.931137101463909e-62
+  30 39 62 61 36 65 34 35  38 20 32 20 43 48 45 43
+     2.12937504719713e-52    1.198085530217688e+16
+     2.12937504719713e-52    1.198085530217688e+16
+  4b 4d 55 4c 54 49 53 49  47 22 5d 5d 2c 0a 22 30
+   1.7204081633126492e+45    7.789711529715404e-77
+   1.7204081633126492e+45    7.789711529715404e-77
+  31 30 30 30 30 30 30 30  31 62 65 35 39 39 65 66
+   1.3980432860952892e-76  1.8036196305728354e+185
+   1.3980432860952892e-76  1.8036196305728354e+185
+  61 61 34 31 34 38 34 37  34 30 35 33 63 32 66 61
+     9.06675817774325e-43  1.5603376165907593e+161
+     9.06675817774325e-43  1.5603376165907593e+161
+  30 33 31 63 37 32 36 32  33 39 38 39 31 33 66 31
+    8.233012446110825e-67   1.0051790122085703e-70
+    8.233012446110825e-67   1.0051790122085703e-70
+  64 63 31 64 39 65 63 32  30 31 66 64 34 34 30 37
+    5.755325027129221e-66    7.266091019396451e-43
+    5.755325027129221e-66    7.266091019396451e-43
+  38 65 64 30 30 34 65 34  34 30 30 30 30 30 30 30
+    2.702375867096489e-56     1.39804328609529e-76
+    2.702375867096489e-56     1.39804328609529e-76
+  30 34 39 30 30 34 37 33  30 34 34 30 32 32 30 32
+     5.64054598159033e-62    6.007459329422506e-67
+     5.64054598159033e-62    6.007459329422506e-67
+  32 62 32 39 37 30 36 63  62 32 65 64 39 65 66 30
+   8.373797140221537e+169   1.5472840766593864e-75
+   8.373797140221537e+169   1.5472840766593864e-75
+  63 62 33 63 39 37 62 37  32 36 37 37 63 61 32 64
+    6.534568868129289e-42  4.5460366977207735e+174
+    6.534568868129289e-42  4.5460366977207735e+174
+  66 64 37 62 34 31 36 30  66 37 62 34 62 65 62 33
+   1.9165562783568445e-76    3.577461690137926e-61
+   1.9165562783568445e-76    3.577461690137926e-61
+  62 61 38 30 36 61 61 38  35 36 63 34 30 31 35 30
+    4.085955615278163e-37   1.8301890858003876e-76
+    4.085955615278163e-37   1.8301890858003876e-76
+  32 32 30 32 64 31 65 35  32 35 38 32 34 31 32 65
+   1.7701165341553668e-51   2.948782356927452e+179
+   1.7701165341553668e-51   2.948782356927452e+179
+  62 61 32 65 64 34 37 34  66 31 66 34 33 37 61 34
+    3.696715122504865e-57   2.1940858437167714e-56
+    3.696715122504865e-57   2.1940858437167714e-56
+  32 37 36 34 30 33 30 36  66 64 33 38 33 38 37 32
+   1.1084458525496474e-47    8.612602923417434e-67
+   1.1084458525496474e-47    8.612602923417434e-67
+  35 66 61 62 31 37 33 61  64 65 37 66 65 34 65 61
+  1.6884631980282886e+160  1.4905936313361744e+161
+  1.6884631980282886e+160  1.4905936313361744e+161
+  65 34 61 30 31 66 66 66  66 66 66 66 66 30 31 30
+   1.903529566273249e+185    1.484476410540531e-76
+   1.903529566273249e+185    1.484476410540531e-76
+  31 30 30 30 30 30 30 30  30 30 30 30 30 30 30 32
+   1.3980432860952892e-76    6.004550192171637e-67
+   1.3980432860952892e-76    6.004550192171637e-67
+  33 32 31 30 33 61 63 34  62 62 61 37 65 37 63 61
+     2.46988984887315e-56   1.350826154735956e+161
+     2.46988984887315e-56   1.350826154735956e+161
+  33 65 38 37 33 65 65 61  34 39 65 30 38 31 33 32
+  1.5039948066074863e+161    7.118806229006081e-67
+  1.5039948066074863e+161    7.118806229006081e-67
+  61 64 33 30 63 37 66 30  33 36 34 30 62 36 35 33
+   1.5349136466532397e-75     5.15645748658157e-62
+   1.5349136466532397e-75     5.15645748658157e-62
+  39 65 39 62 35 39 39 30  33 63 66 31 34 66 64 30
+   2.1783414554981678e-76   1.4093697789450543e-75
+   2.1783414554981678e-76   1.4093697789450543e-75
+  31 36 62 62 62 61 63 30  30 30 30 30 30 30 30 22
+    1.338979724995189e-75     5.1856307557119e-144
+    1.338979724995189e-75     5.1856307557119e-144
+  2c 20 22 50 32 53 48 22  5d 2c 0a 0a 5b 5b 5b 22
+  1.5584206141976403e-143   3.505324975062537e-143
+  1.5584206141976403e-143   3.505324975062537e-143
+  65 31 36 61 62 62 65 38  30 62 66 33 30 63 30 38
+    5.027427979673105e-37    4.815839969561922e-38
+    5.027427979673105e-37    4.815839969561922e-38
+  30 66 36 33 38 33 30 63  38 64 62 66 36 36 39 64
+   6.113847921540291e+169   6.235636596713422e+174
+   6.113847921540291e+169   6.235636596713422e+174
+  65 61 65 66 30 38 39 35  37 34 34 36 65 39 35 39
+   2.6330374584611195e-52    4.087632351685281e-33
+   2.6330374584611195e-52    4.087632351685281e-33
+  34 30 32 32 37 64 38 63  35 65 36 64 62 36 31 32
+   9.205248079460891e+169     6.38444839931008e-67
+   9.205248079460891e+169     6.38444839931008e-67
+  22 2c 20 30 2c 20 22 31  20 30 78 32 31 20 30 78
+    5.129384035710505e-72   8.519145899392357e+270
+    5.129384035710505e-72   8.519145899392357e+270
+  30 33 39 30 35 33 38 30  63 37 30 31 33 65 33 36
+   2.0899554105603135e-76   1.3270811256508142e-47
+   2.0899554105603135e-76   1.3270811256508142e-47
+  65 36 65 31 39 64 33 30  35 33 31 31 63 31 62 38
+   1.6746824263120943e-76    4.277134890489819e-37
+   1.6746824263120943e-76    4.277134890489819e-37
+  31 66 63 65 36 35 38 31  66 35 65 65 31 63 38 36
+   1.3701163926634514e-71   1.6686585804197772e-47
+   1.3701163926634514e-71   1.6686585804197772e-47
+  65 66 30 36 32 37 63 36  38 63 39 33 36 32 66 63
+   1.0518283074641416e-46   6.701391724323436e+170
+   1.0518283074641416e-46   6.701391724323436e+170
+  39 66 20 30 78 30 30 20  32 20 43 48 45 43 4b 4d
+  1.2074556861080656e-153   2.2430511005534937e+64
+  1.2074556861080656e-153   2.2430511005534937e+64
+  55 4c 54 49 53 49 47 22  5d 5d 2c 0a 22 30 31 30
+  1.4918835854285148e-143    1.484386327115762e-76
+  1.4918835854285148e-143    1.484386327115762e-76
+  30 30 30 30 30 30 31 31  32 62 36 36 64 35 65 38
+    9.728196422180755e-72    4.986108578502241e-37
+    9.728196422180755e-72    4.986108578502241e-37
+  63 37 64 32 32 34 30 35  39 65 39 34 36 37 34 39
+   1.6917651515110626e-52    3.893396581165201e-33
+   1.6917651515110626e-52    3.893396581165201e-33
+  35 30 38 65 66 65 61 39  64 36 36 62 66 38 64 30
+   2.6802926186380986e-32   1.3970081986461304e-75
+   2.6802926186380986e-32   1.3970081986461304e-75
+  63 38 33 36 33 30 66 30  38 30 63 66 33 30 62 65
+   1.5329739069371974e-75  2.3585177774460913e+180
+   1.5329739069371974e-75  2.3585177774460913e+180
+  38 62 62 36 61 65 31 30  30 30 30 30 30 30 30 34
+   1.5023491422150122e-76   2.5789346702567697e-57
+   1.5023491422150122e-76   2.5789346702567697e-57
+  39 30 30 34 37 33 30 34  34 30 32 32 30 36 66 66
+   2.5808186288798045e-57  1.8875941389654977e+185
+   2.5808186288798045e-57  1.8875941389654977e+185
+  65 33 66 31 34 63 61 66  33 38 61 64 35 63 31 35
+  1.4776271836183312e+185    1.815343195227433e-52
+  1.4776271836183312e+185    1.815343195227433e-52
+  34 34 34 32 38 65 39 39  64 61 37 36 66 66 61 35
+    4.890973961327113e-33   1.4533155712344588e-51
+    4.890973961327113e-33   1.4533155712344588e-51
+  34 35 35 36 37 35 65 63  38 64 39 37 38 30 66 61
+   6.403017480691857e+170   1.559742326747223e+161
+   6.403017480691857e+170   1.559742326747223e+161
+  63 32 31 35 63 61 31 37  39 35 33 35 32 30 32 32
+    7.793649891916199e-43    6.746402852711711e-67
+    7.793649891916199e-43    6.746402852711711e-67
+  30 37 37 39 35 30 32 39  38 35 65 31 39 34 64 38
+   3.5029414961596314e-33    4.749937030939407e-37
+   3.5029414961596314e-33    4.749937030939407e-37
+  34 62 61 61 33 36 62 39  62 64 34 30 61 30 64 62
+   2.8059599824507164e-32    9.30083778636254e+165
+   2.8059599824507164e-32    9.30083778636254e+165
+  64 39 38 31 31 36 33 66  61 31 39 31 65 62 38 38
+  2.0408114927389585e+184     7.16591834959954e-38
+  2.0408114927389585e+184     7.16591834959954e-38
+  34 61 65 38 33 66 63 35  62 64 31 63 38 36 62 31
+   1.6202983783166155e-51    8.246009863601472e-71
+   1.6202983783166155e-51    8.246009863601472e-71
+  31 30 31 66 66 66 66 66  66 66 66 30 31 30 31 30
+  1.9035985652024226e+185   1.4844062905110472e-76
+  1.9035985652024226e+185   1.4844062905110472e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 32 33 32
+    1.398043286095289e-76    7.120209854683088e-67
+    1.398043286095289e-76    7.120209854683088e-67
+  31 30 33 39 30 35 33 38  30 63 37 30 31 33 65 33
+    5.644655423982253e-38    4.122741652268959e-61
+    5.644655423982253e-38    4.122741652268959e-61
+  36 65 36 65 31 39 64 33  30 35 33 31 31 63 31 62
+    3.932830911646111e-61  1.0012764898606392e+165
+    3.932830911646111e-61  1.0012764898606392e+165
+  38 31 66 63 65 36 35 38  31 66 35 65 65 31 63 38
+    6.233788942486451e-38   4.5122416642074694e-37
+    6.233788942486451e-38   4.5122416642074694e-37
+  36 65 66 30 36 32 37 63  36 38 63 39 33 36 32 66
+    8.75413583435755e+169  1.9345871877013163e+184
+    8.75413583435755e+169  1.9345871877013163e+184
+  63 39 66 61 63 30 30 30  30 30 30 30 30 22 2c 20
+   1.3981107459240343e-76  1.0491479271301769e-153
+   1.3981107459240343e-76  1.0491479271301769e-153
+  22 50 32 53 48 22 5d 2c  0a 0a 5b 5b 5b 22 65 62
+    5.455822643446265e-95   9.736291649248077e+165
+    5.455822643446265e-95   9.736291649248077e+165
+  62 63 66 34 62 66 63 65  31 33 32 39 32 62 64 37
+  2.5156355126071467e+180    7.312250300926814e-42
+  2.5156355126071467e+180    7.312250300926814e-42
+  39 31 64 36 61 36 35 61  32 61 38 35 38 64 35 39
+  1.8639229053331323e+160    4.119849701813251e-33
+  1.8639229053331323e+160    4.119849701813251e-33
+  61 64 62 66 37 33 37 65  33 38 37 65 34 30 33 37
+  3.7605088720240053e+179     8.60433107465013e-43
+  3.7605088720240053e+179     8.60433107465013e-43
+  30 64 34 65 36 34 63 63  37 30 65 66 62 30 22 2c
+   5.798000368313327e+170    4.257750903604999e-96
+   5.798000368313327e+170    4.257750903604999e-96
+  20 30 2c 20 22 32 20 30  78 32 31 20 30 78 30 33
+     6.99349727737949e-77    4.003509869942793e-62
+     6.99349727737949e-77    4.003509869942793e-62
+  33 62 63 61 61 30 61 36  30 32 66 30 64 34 34 63
+    9.408945138766118e-47   7.625160411082189e+169
+    9.408945138766118e-47   7.625160411082189e+169
+  63 39 64 35 36 33 37 63  36 65 35 31 35 62 30 34
+    8.75561015071181e+169   2.6100619106615006e-57
+    8.75561015071181e+169   2.6100619106615006e-57
+  37 31 64 62 35 31 34 63  30 32 30 38 38 33 38 33
+   7.620468268764097e+169    5.882712748159279e-62
+   7.620468268764097e+169    5.882712748159279e-62
+  30 62 37 63 65 66 64 37  33 61 66 30 34 31 39 34
+    7.318135558194448e-42    4.013349417275207e-57
+    7.318135558194448e-42    4.013349417275207e-57
+  20 30 78 32 31 20 30 78  30 33 61 38 38 62 33 32
+   8.519145899392357e+270    7.189802929505338e-67
+   8.519145899392357e+270    7.189802929505338e-67
+  36 66 38 37 36 37 66 34  66 31 39 32 63 65 32 35
+   2.8313284636770717e-56   1.9206366998780657e-52
+   2.8313284636770717e-56   1.9206366998780657e-52
+  32 61 66 65 33 33 63 39  34 64 32 35 61 62 31 64
+   2.9582288555922557e-32   4.299664852941911e+174
+   2.9582288555922557e-32   4.299664852941911e+174
+  32 34 66 32 37 66 31 35  39 62 33 63 62 33 61 61
+   1.8165695649694043e-52   1.209133696761426e+161
+   1.8165695649694043e-52   1.209133696761426e+161
+  36 39 31 66 66 65 31 34  32 33 20 32 20 43 48 45
+    2.771357621870254e-57    5.866242426571383e+25
+    2.771357621870254e-57    5.866242426571383e+25
+  43 4b 4d 55 4c 54 49 53  49 47 20 4e 4f 54 22 5d
+   1.6510935833778456e+93      4.365507147205e+140
+   1.6510935833778456e+93      4.365507147205e+140
+  5d 2c 0a 22 30 31 30 30  30 30 30 30 30 31 62 30
+    1.398380563599275e-76    1.256883206025089e-75
+    1.398380563599275e-76    1.256883206025089e-75
+  65 66 37 30 63 63 36 34  34 65 30 64 33 37 34 30
+     3.56665116925332e-57   1.7458557016397378e-76
+     3.56665116925332e-57   1.7458557016397378e-76
+  37 65 33 38 37 65 37 33  62 66 61 64 35 39 38 64
+    5.687100343571552e-62   5.991200794878974e+174
+    5.687100343571552e-62   5.991200794878974e+174
+  38 35 32 61 35 61 61 36  64 36 39 31 64 37 32 62
+     9.51335000398678e-47  1.0490097895624323e+165
+     9.51335000398678e-47  1.0490097895624323e+165
+  32 39 31 33 63 65 62 66  66 34 62 63 65 62 30 30
+  1.5633341400523735e+185   1.4149809083969818e-76
+  1.5633341400523735e+185   1.4149809083969818e-76
+  30 30 30 30 30 30 34 61  30 30 34 37 33 30 34 34
+    1.77392832523808e+160    3.216178793923122e-57
+    1.77392832523808e+160    3.216178793923122e-57
+  30 32 32 30 36 38 63 64  34 38 35 31 66 63 37 66
+   3.802868526232574e+175  2.4844806149175348e+184
+   3.802868526232574e+175  2.4844806149175348e+184
+  39 61 38 39 32 61 62 39  31 30 64 66 37 61 32 34
+   2.8318369462767933e-32    2.928063358091626e-57
+   2.8318369462767933e-32    2.928063358091626e-57
+  65 36 31 36 66 32 39 33  62 63 62 35 63 35 66 62
+     6.12502032023844e-62  1.0231227360409288e+166
+     6.12502032023844e-62  1.0231227360409288e+166
+  64 66 62 63 33 30 34 61  31 39 34 62 32 36 62 36
+   1.773932615716399e+160    9.968764086300729e-47
+   1.773932615716399e+160    9.968764086300729e-47
+  30 66 62 61 30 32 32 30  37 38 65 36 64 61 31 33
+   1.5714416111054902e-76    4.224949798843101e-62
+   1.5714416111054902e-76    4.224949798843101e-62
+  64 38 63 62 38 38 31 61  32 32 39 33 39 62 39 35
+  1.5130770033147584e+160    2.650180402068974e-52
+  1.5130770033147584e+160    2.650180402068974e-52
+  32 63 32 34 66 38 38 62  39 37 61 66 64 30 36 62
+  1.3947530822669664e+165  1.2777797384684477e+165
+  1.3947530822669664e+165  1.2777797384684477e+165
+  34 63 34 37 61 34 37 64  37 66 38 30 34 63 39 61
+   5.739205109864868e+174  2.2307859728109314e+160
+   5.739205109864868e+174  2.2307859728109314e+160
+  33 35 32 61 36 64 36 64  30 31 30 30 66 66 66 66
+   5.538087497323893e+174  1.9035982916550755e+185
+   5.538087497323893e+174  1.9035982916550755e+185
+  66 66 66 66 30 31 30 31  30 30 30 30 30 30 30 30
+    9.164429167739883e-72    1.398043286095289e-76
+    9.164429167739883e-72    1.398043286095289e-76
+  30 30 30 30 30 30 32 33  32 31 30 33 33 62 63 61
+    4.421315082524506e-62  1.3625799579147754e+161
+    4.421315082524506e-62  1.3625799579147754e+161
+  61 30 61 36 30 32 66 30  64 34 34 63 63 39 64 35
+    1.533510505551966e-75   1.6892017282988096e-51
+    1.533510505551966e-75   1.6892017282988096e-51
+  36 33 37 63 36 65 35 31  35 62 30 34 37 31 64 62
+   1.2109345265264988e-71   9.302342220069391e+165
+   1.2109345265264988e-71   9.302342220069391e+165
+  35 31 34 63 30 32 30 38  38 33 38 33 30 62 37 63
+    4.759591565510001e-38   8.824863141589566e+169
+    4.759591565510001e-38   8.824863141589566e+169
+  65 66 64 37 33 61 66 30  34 31 39 34 61 63 30 30
+   1.5461980449463426e-75   1.4153127448723223e-76
+   1.5461980449463426e-75   1.4153127448723223e-76
+  30 30 30 30 30 30 22 2c  20 22 50 32 53 48 22 5d
+    4.257571555502434e-96   4.354357046338091e+140
+    4.257571555502434e-96   4.354357046338091e+140
+  2c 0a 0a 5b 5b 5b 22 62  61 34 63 64 37 61 65 32
+   5.285500348369868e+164     6.34415245131355e-66
+   5.285500348369868e+164     6.34415245131355e-66
+  61 64 34 64 34 64 31 33  65 62 66 63 38 61 62 31
+    4.227621091006039e-62    8.322063423951602e-71
+    4.227621091006039e-62    8.322063423951602e-71
+  64 39 33 61 36 33 65 34  61 36 35 36 33 66 32 35
+   2.7018900647950727e-56   1.9209680877908806e-52
+   2.7018900647950727e-56   1.9209680877908806e-52
+  30 38 39 61 31 38 62 66  30 66 63 36 38 66 32 38
+  1.5483312809868763e+185     5.40706690166417e-38
+  1.5483312809868763e+185     5.40706690166417e-38
+  32 61 61 38 38 63 31 22  2c 20 30 2c 20 22 32 20
+   5.569819709201293e-144  1.3524435545175009e-153
+   5.569819709201293e-144  1.3524435545175009e-153
+  30 78 32 31 20 30 78 30  33 37 63 36 31 35 64 37
+    3.342265106080618e-75    7.249186336157696e-42
+    3.342265106080618e-75    7.249186336157696e-42
+  36 31 65 37 31 64 33 38  39 30 33 36 30 39 62 66
+    5.698613230519108e-38  1.5486617275803926e+185
+    5.698613230519108e-38  1.5486617275803926e+185
+  34 66 34 36 38 34 37 32  36 36 65 64 63 32 66 62
+    8.606835543673893e-67  1.0225829954740657e+166
+    8.606835543673893e-67  1.0225829954740657e+166
+  33 37 35 33 32 30 34 37  64 37 34 37 62 61 34 37
+    9.052731562087182e-43    9.138889629160915e-43
+    9.052731562087182e-43    9.138889629160915e-43
+  65 61 61 65 35 66 66 65  31 20 30 78 32 31 20 30
+  2.9045639368186937e+180     6.99191821300924e-77
+  2.9045639368186937e+180     6.99191821300924e-77
+  78 30 32 65 64 63 38 32  33 63 64 36 33 34 66 32
+     9.04610493550303e-67    6.588709307001902e-66
+     9.04610493550303e-67    6.588709307001902e-66
+  63 34 30 33 33 64 39 34  66 35 37 35 35 32 30 37
+    4.045084390804195e-57    7.262593354408572e-43
+    4.045084390804195e-57    7.262593354408572e-43
+  63 62 36 62 36 30 63 34  62 31 66 31 66 30 35 36
+   2.4455018430374207e-56   1.4498142731884008e-47
+   2.4455018430374207e-56   1.4498142731884008e-47
+  61 64 37 34 37 31 63 34  37 64 65 35 66 32 65 34
+   2.4460012795449355e-56   2.7014852360466734e-56
+   2.4460012795449355e-56   2.7014852360466734e-56
+  64 35 30 20 32 20 43 48  45 43 4b 4d 55 4c 54 49
+   1.3016321070124915e+40   1.8106578577758274e+45
+   1.3016321070124915e+40   1.8106578577758274e+45
+  53 49 47 20 4e 4f 54 22  5d 5d 2c 0a 22 30 31 30
+   2.602360251909124e-143    1.484386327115762e-76
+   2.602360251909124e-143    1.484386327115762e-76
+  30 30 30 30 30 30 31 63  31 38 38 61 61 38 32 66
+   6.486775414899143e+169  1.9354919046257793e+184
+   6.486775414899143e+169  1.9354919046257793e+184
+  32 36 38 66 63 66 30 38  62 61 31 38 39 35 30 66
+     4.81951338274579e-38  1.7217267568805034e+184
+     4.81951338274579e-38  1.7217267568805034e+184
+  32 36 33 36 35 34 61 33  65 61 36 39 33 31 64 61
+    3.345636326774203e-61    1.41942050778158e+161
+    3.345636326774203e-61    1.41942050778158e+161
+  62 63 38 62 66 33 65 64  31 64 34 64 34 32 61 61
+   4.194878141190532e+175  1.2088097683282713e+161
+   4.194878141190532e+175  1.2088097683282713e+161
+  65 64 37 34 63 62 61 30  30 30 30 30 30 30 30 34
+   1.2010717724818998e-75   2.5789346702567697e-57
+   1.2010717724818998e-75   2.5789346702567697e-57
+  62 30 30 30 30 34 38 33  30 34 35 30 32 32 31 30
+    5.883632515371558e-62   1.4850823079649383e-76
+    5.883632515371558e-62   1.4850823079649383e-76
+  30 39 34 30 33 37 38 35  37 36 65 30 36 39 61 63
+   2.5282291974818597e-52   5.200062246292797e+170
+   2.5282291974818597e-52   5.200062246292797e+170
+  61 32 36 31 61 36 62 32  36 66 62 33 38 33 34 34
+    5.404289781619268e-66    3.218057816564986e-57
+    5.404289781619268e-66    3.218057816564986e-57
+  65 34 34 39 37 63 61 36  37 35 31 62 62 31 30 39
+    9.517641827495957e-47    3.118640537168701e-33
+    9.517641827495957e-47    3.118640537168701e-33
+  30 35 63 37 36 62 62 36  38 39 66 34 32 32 32 62
+   1.0062877416702422e-46  1.0478411373094676e+165
+   1.0062877416702422e-46  1.0478411373094676e+165
+  30 30 32 32 30 34 38 33  33 38 30 36 62 30 31 34
+    5.883632544462884e-62    2.738365461611728e-57
+    5.883632544462884e-62    2.738365461611728e-57
+  63 32 36 66 64 38 30 31  37 32 37 62 37 39 32 62
+    9.180354256203385e-72  1.0494203078678726e+165
+    9.180354256203385e-72  1.0494203078678726e+165
+  31 32 36 30 30 30 33 63  35 35 37 31 30 66 38 37
+   7.241567900391356e+169    1.094096750496226e-42
+   7.241567900391356e+169    1.094096750496226e-42
+  63 35 61 64 62 64 37 61  39 63 62 35 37 34 34 36
+  2.0554523416920748e+160   1.3824115484571172e-47
+  2.0554523416920748e+160   1.3824115484571172e-47
+  64 62 63 39 38 30 31 66  66 66 66 66 66 66 66 30
+   1.825877984323305e+184   1.5476014050729244e-75
+   1.825877984323305e+184   1.5476014050729244e-75
+  31 30 31 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432861153968e-76    1.398043286095289e-76
+   1.3980432861153968e-76    1.398043286095289e-76
+  30 32 33 32 31 30 33 37  63 36 31 35 64 37 36 31
+    8.604309184287082e-43   1.2574021397939832e-71
+    8.604309184287082e-43   1.2574021397939832e-71
+  65 37 31 64 33 38 39 30  33 36 30 39 62 66 34 66
+    2.178001479745153e-76    2.16703624080947e+184
+    2.178001479745153e-76    2.16703624080947e+184
+  34 36 38 34 37 32 36 36  65 64 63 32 66 62 33 37
+   1.5187225439216037e-47    8.692252984055159e-43
+   1.5187225439216037e-47    8.692252984055159e-43
+  35 33 32 30 34 37 64 37  34 37 62 61 34 37 65 61
+    7.252005222166045e-42  1.4913648281994308e+161
+    7.252005222166045e-42  1.4913648281994308e+161
+  61 65 35 66 66 65 31 61  63 30 30 30 30 30 30 30
+  1.5285844939787254e+160   1.3980432860953045e-76
+  1.5285844939787254e+160   1.3980432860953045e-76
+  30 22 2c 20 22 50 32 53  48 22 5d 2c 0a 0a 0a 5b
+    5.968685125563565e+92   3.609907493231361e+130
+    5.968685125563565e+92   3.609907493231361e+130
+  22 4f 50 5f 43 4f 44 45  53 45 50 41 52 41 54 4f
+    4.910565228873733e+25   1.4315108960822492e+74
+    4.910565228873733e+25   1.4315108960822492e+74
+  52 20 74 65 73 74 73 22  5d 2c 0a 0a 5b 22 54 65
+    9.97127628662073e-143  1.3054247375980839e+180
+    9.97127628662073e-143  1.3054247375980839e+180
+  73 74 20 74 68 61 74 20  53 69 67 6e 61 74 75 72
+  2.4320754225893854e-152   2.288954565678813e+243
+  2.4320754225893854e-152   2.288954565678813e+243
+  65 48 61 73 68 28 29 20  72 65 6d 6f 76 65 73 20
+    9.38178855287151e-154   2.314632015022165e-152
+    9.38178855287151e-154   2.314632015022165e-152
+  4f 50 5f 43 4f 44 45 53  45 50 41 52 41 54 4f 52
+   1.3862818207311878e+93   3.1161400419388188e+88
+   1.3862818207311878e+93   3.1161400419388188e+88
+  20 77 69 74 68 20 46 69  6e 64 41 6e 64 44 65 6c
+  1.3231884930049305e+199   1.431912171904085e+214
+  1.3231884930049305e+199   1.431912171904085e+214
+  65 74 65 28 29 22 5d 2c  0a 5b 5b 5b 22 62 63 37
+    5.455733584187885e-95    6.953431043335122e-42
+    5.455733584187885e-95    6.953431043335122e-42
+  66 64 31 33 32 66 63 66  38 31 37 39 31 38 33 33
+  1.6485846406947574e+185    4.672001911016908e-62
+  1.6485846406947574e+185    4.672001911016908e-62
+  34 38 32 32 65 65 36 64  39 62 64 39 35 63 38 38
+   5.539230315063376e+174    7.166851196942475e-38
+   5.539230315063376e+174    7.166851196942475e-38
+  39 30 39 39 63 39 36 65  30 37 63 61 32 63 31 65
+   3.602325804142382e+179  2.8183457055048224e+179
+   3.602325804142382e+179  2.8183457055048224e+179
+  62 32 63 63 37 30 64 62  36 33 32 32 34 22 2c 20
+   9.300543950583882e+165  1.0491502076981217e-153
+   9.300543950583882e+165  1.0491502076981217e-153
+  30 2c 20 22 43 4f 44 45  53 45 50 41 52 41 54 4f
+    4.910564347061241e+25   1.4315108960822492e+74
+    4.910564347061241e+25   1.4315108960822492e+74
+  52 20 30 78 32 31 20 30  78 30 33 38 34 37 39 61
+    6.991918213009291e-77  2.2156834597514552e+160
+    6.991918213009291e-77  2.2156834597514552e+160
+  30 66 61 39 39 38 63 64  33 35 32 35 39 61 32 65
+  3.8028776920596814e+175   2.979186711938135e+179
+  3.8028776920596814e+175   2.979186711938135e+179
+  66 30 61 37 61 35 63 36  38 36 36 32 63 31 34 37
+   1.0514399252266624e-46     9.05481843014918e-43
+   1.0514399252266624e-46     9.05481843014918e-43
+  34 66 38 38 63 63 62 36  64 30 38 61 37 36 37 37
+    1.006539151317854e-46   1.0408523267491937e-42
+    1.006539151317854e-46   1.0408523267491937e-42
+  62 62 65 63 37 66 32 32  30 34 31 20 43 48 45 43
+    6.824673240278423e-67        11980855302056032
+    6.824673240278423e-67        11980855302056032
+  4b 53 49 47 22 5d 5d 2c  0a 22 30 31 30 30 30 30
+     5.49887313059845e-95   1.3980432912417352e-76
+     5.49887313059845e-95   1.3980432912417352e-76
+  30 30 30 31 32 34 33 32  62 36 30 64 63 37 32 63
+    7.123119013695753e-67    6.87478594469889e+169
+    7.123119013695753e-67    6.87478594469889e+169
+  65 62 63 31 61 32 37 63  65 30 39 36 39 63 30 39
+   8.754383476802796e+169    3.156135363486714e-33
+   8.754383476802796e+169    3.156135363486714e-33
+  38 39 63 38 39 35 62 64  64 39 65 36 32 65 38 32
+     3.6026946366578e+175    9.048718728140696e-67
+     3.6026946366578e+175    9.048718728140696e-67
+  33 34 38 33 39 31 31 37  66 38 66 63 33 32 64 31
+     7.70928455567136e-43    9.144468483098841e-71
+     7.70928455567136e-43    9.144468483098841e-71
+  37 66 62 63 30 30 30 30  30 30 30 30 34 61 34 39
+    1.398043549630352e-76    3.924987945512938e-33
+    1.398043549630352e-76    3.924987945512938e-33
+  33 30 34 36 30 32 32 31  30 30 61 35 37 36 62 35
+   1.0298598285844949e-71   1.5211188332804057e-51
+   1.0298598285844949e-71   1.5211188332804057e-51
+  32 30 35 31 39 36 32 63  32 35 65 36 34 32 63 30
+   6.873068732235305e+169   1.3262466771735238e-75
+   6.873068732235305e+169   1.3262466771735238e-75
+  66 64 33 64 37 37 65 65  36 63 39 32 34 38 37 30
+   2.751088488335852e+180   2.0052791692044303e-76
+   2.751088488335852e+180   2.0052791692044303e-76
+  34 38 65 35 64 39 30 38  31 38 62 63 66 35 62 35
+    4.767859545096258e-38   1.5208526973398815e-51
+    4.767859545096258e-38   1.5208526973398815e-51
+  31 61 62 61 63 63 64 37  39 30 30 32 32 31 30 30
+    7.313920675984188e-42    1.398383282274076e-76
+    7.313920675984188e-42    1.398383282274076e-76
+  38 32 30 34 66 38 66 62  31 32 31 62 65 34 65 63
+  1.0236647112778239e+166   6.402050825796297e+170
+  1.0236647112778239e+166   6.402050825796297e+170
+  33 62 32 34 34 38 33 62  31 66 39 32 64 38 39 62
+  1.1067786647111248e+165  1.4523374146781322e+165
+  1.1067786647111248e+165  1.4523374146781322e+165
+  31 62 30 35 34 38 35 31  33 61 31 33 34 65 33 34
+   1.2009837778463393e-71    3.089853976561438e-57
+   1.2009837778463393e-71    3.089853976561438e-57
+  35 63 35 34 34 32 65 38  36 65 38 36 31 37 61 35
+    4.983181293981714e-37   1.4379135586573674e-51
+    4.983181293981714e-37   1.4379135586573674e-51
+  30 31 66 66 66 66 66 66  66 66 30 31 30 30 30 30
+  1.9035985662511804e+185   1.3980432912471045e-76
+  1.9035985662511804e+185   1.3980432912471045e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 31 36 61
+    1.398043286095289e-76  1.9500103852204303e+160
+    1.398043286095289e-76  1.9500103852204303e+160
+  30 30 30 30 30 30 30 30  22 2c 20 22 50 32 53 48
+    1.398043286095289e-76    2.612896978874658e+40
+    1.398043286095289e-76    2.612896978874658e+40
+  22 5d 2c 0a 5b 5b 5b 22  38 33 65 31 39 34 66 39
+  3.5053249760825546e-143    3.421067523698127e-32
+  3.5053249760825546e-143    3.421067523698127e-32
+  30 62 36 65 66 32 31 66  61 32 65 33 61 33 36 35
+   1.826782726524917e+184   2.3178614304763427e-52
+   1.826782726524917e+184   2.3178614304763427e-52
+  62 36 33 37 39 34 66 62  35 64 61 61 38 34 34 62
+  1.0229132603531895e+166  1.1634686483869906e+165
+  1.0229132603531895e+166  1.1634686483869906e+165
+  64 63 39 62 32 35 64 65  33 30 38 39 39 66 63 66
+  2.6203931529907096e+180  1.6485937482864946e+185
+  2.6203931529907096e+180  1.6485937482864946e+185
+  65 37 62 30 31 30 34 37  22 2c 20 30 2c 20 22 43
+    9.052724644324882e-43         2550961869428241
+    9.052724644324882e-43         2550961869428241
+  4f 44 45 53 45 50 41 52  41 54 4f 52 20 43 4f 44
+   1.7220869217380304e+88   1.1533720455709229e+21
+   1.7220869217380304e+88   1.1533720455709229e+21
+  45 53 45 50 41 52 41 54  4f 52 20 30 78 32 31 20
+    7.399618339034245e+97  1.2826217762883418e-153
+    7.399618339034245e+97  1.2826217762883418e-153
+  30 78 30 33 38 34 37 39  61 30 66 61 39 39 38 63
+    4.468924480919858e-33   9.141869883389792e+169
+    4.468924480919858e-33   9.141869883389792e+169
+  64 33 35 32 35 39 61 32  65 66 30 61 37 61 35 63
+    5.110831463008867e-66   8.068637796885444e+169
+    5.110831463008867e-66   8.068637796885444e+169
+  36 38 36 36 32 63 31 34  37 34 66 38 38 63 63 62
+    2.769986158214914e-57   8.931638868561501e+165
+    2.769986158214914e-57   8.931638868561501e+165
+  36 64 30 38 61 37 36 37  37 62 62 65 63 37 66 32
+    9.962145661002394e-43    6.592404855210659e-66
+    9.962145661002394e-43    6.592404855210659e-66
+  32 30 34 31 20 43 48 45  43 4b 53 49 47 22 5d 5d
+    5.866242413285105e+25   5.551068777679023e+141
+    5.866242413285105e+25   5.551068777679023e+141
+  2c 0a 22 30 31 30 30 30  30 30 30 30 31 34 37 31
+   1.3980446035855388e-76   1.3132928149509744e-71
+   1.3980446035855388e-76   1.3132928149509744e-71
+  30 62 30 65 37 63 66 39  66 38 39 33 30 64 65 32
+   3.4493503934287914e-32    6.347597267645589e-66
+   3.4493503934287914e-32    6.347597267645589e-66
+  35 39 62 64 63 34 62 38  34 61 61 35 64 66 62 39
+    4.279890672720231e-37    2.834963725986582e-32
+    4.279890672720231e-37    2.834963725986582e-32
+  34 33 37 62 36 36 35 61  33 65 33 61 32 31 66 66
+  1.8638654812852496e+160  1.8859371642794096e+185
+  1.8638654812852496e+160  1.8859371642794096e+185
+  32 36 65 30 62 66 39 39  34 65 31 38 33 30 30 30
+   4.8918496838571866e-33     1.39804728062425e-76
+   4.8918496838571866e-33     1.39804728062425e-76
+  30 30 30 30 30 34 61 34  39 33 30 34 36 30 32 32
+   2.1925864539849275e-56    6.746425469541057e-67
+   2.1925864539849275e-56    6.746425469541057e-67
+  31 30 30 61 31 36 36 31  32 31 61 36 31 62 34 65
+   1.2571371578399922e-71  3.3039810065871316e+179
+   1.2571371578399922e-71  3.3039810065871316e+179
+  65 62 31 39 64 38 66 39  32 32 62 39 37 38 66 66
+    3.423576100252381e-32  1.8882671749290146e+185
+    3.423576100252381e-32  1.8882671749290146e+185
+  36 61 62 35 38 65 61 64  38 61 35 61 35 35 35 32
+  3.4419268211105726e+175    7.866427193544863e-67
+  3.4419268211105726e+175    7.866427193544863e-67
+  62 66 39 62 65 37 33 64  63 39 63 31 35 36 38 37
+   4.752797637160809e+174    1.085692381308658e-42
+   4.752797637160809e+174    1.085692381308658e-42
+  33 65 61 30 32 32 31 30  30 39 32 61 64 39 62 63
+   1.4850823088535244e-76   5.502192035316746e+170
+   1.4850823088535244e-76   5.502192035316746e+170
+  34 33 65 65 36 34 37 64  61 34 66 36 36 35 32 63
+   5.739043510425396e+174    6.87157736911402e+169
+   5.739043510425396e+174    6.87157736911402e+169
+  33 32 30 38 30 30 64 65  62 63 66 30 38 65 63 32
+   2.617856207494523e+180    5.755319583234008e-66
+   2.617856207494523e+180    5.755319583234008e-66
+  30 61 30 39 34 61 30 61  61 66 30 38 35 66 36 33
+  1.4392748495706256e+160    5.444955947472839e-62
+  1.4392748495706256e+160    5.444955947472839e-62
+  65 63 62 33 37 61 31 37  32 30 31 66 66 66 66 66
+    7.793348783379786e-43   1.903598565202423e+185
+    7.793348783379786e-43   1.903598565202423e+185
+  66 66 66 30 31 30 30 30  30 30 30 30 30 30 30 30
+   1.3980446049601027e-76    1.398043286095289e-76
+   1.3980446049601027e-76    1.398043286095289e-76
+  30 30 30 30 30 30 31 36  61 30 30 30 30 30 30 30
+   1.1760667833056972e-47    1.398043286095304e-76
+   1.1760667833056972e-47    1.398043286095304e-76
+  30 22 2c 20 22 50 32 53  48 22 5d 2c 0a 0a 5b 22
+    5.968685125563565e+92  3.4646246866285803e-143
+    5.968685125563565e+92  3.4646246866285803e-143
+  48 61 73 68 65 64 20 64  61 74 61 20 73 74 61 72
+   2.027141285833265e+174    9.31115224306717e+242
+   2.027141285833265e+174    9.31115224306717e+242
+  74 73 20 61 74 20 74 68  65 20 43 4f 44 45 53 45
+  1.4692355112249475e+195    9.318677580014937e+25
+  1.4692355112249475e+195    9.318677580014937e+25
+  50 41 52 41 54 4f 52 22  5d 2c 0a 5b 5b 5b 22 33
+  2.3461055990408064e-143    2.231153070287452e-62
+  2.3461055990408064e-143    2.231153070287452e-62
+  32 36 38 38 32 61 37 66  32 32 62 35 31 39 31 66
+  2.4835664691643788e+184  1.8296011766476416e+184
+  2.4835664691643788e+184  1.8296011766476416e+184
+  31 61 30 63 63 39 39 36  32 63 61 34 62 38 37 38
+   1.7259079386532501e-47    6.823817729244683e-38
+   1.7259079386532501e-47    6.823817729244683e-38
+  63 64 39 36 39 63 66 33  62 33 61 37 30 38 38 37
+   4.3536976684035856e-61   1.0860393008013727e-42
+   4.3536976684035856e-61   1.0860393008013727e-42
+  61 65 63 65 34 64 38 30  31 61 30 62 61 35 65 22
+   2.1064845328295718e-76   5.435035362578893e-143
+   2.1064845328295718e-76   5.435035362578893e-143
+  2c 20 30 2c 20 22 30 78  32 31 20 30 78 30 33 38
+   8.523135963328286e+270    5.639238405692717e-38
+   8.523135963328286e+270    5.639238405692717e-38
+  34 37 39 61 30 66 61 39  39 38 63 64 33 35 32 35
+    2.680767481658486e-32    1.900984630234711e-52
+    2.680767481658486e-32    1.900984630234711e-52
+  39 61 32 65 66 30 61 37  61 35 63 36 38 36 36 32
+    6.166273736687876e-42    8.238812749952904e-67
+    6.166273736687876e-42    8.238812749952904e-67
+  63 31 34 37 34 66 38 38  63 63 62 36 64 30 38 61
+    7.170290505563506e-38   2.125475718489579e+160
+    7.170290505563506e-38   2.125475718489579e+160
+  37 36 37 37 62 62 65 63  37 66 32 32 30 34 31 20
+   6.456286941599635e+170  1.2831225285843866e-153
+   6.456286941599635e+170  1.2831225285843866e-153
+  43 4f 44 45 53 45 50 41  52 41 54 4f 52 20 43 48
+        4265293.082294288   1.3016655289382176e+40
+        4265293.082294288   1.3016655289382176e+40
+  45 43 4b 53 49 47 22 5d  5d 2c 0a 22 30 31 30 30
+   4.353390819034962e+140    1.398380563599275e-76
+   4.353390819034962e+140    1.398380563599275e-76
+  30 30 30 30 30 31 35 65  62 61 61 30 30 31 64 38
+  3.4350437998142914e+179    4.747149665915555e-37
+  3.4350437998142914e+179    4.747149665915555e-37
+  65 34 65 63 37 61 38 38  37 30 33 61 33 62 63 66
+    7.164565013586564e-38   1.647258325476895e+185
+    7.164565013586564e-38   1.647258325476895e+185
+  36 39 64 39 38 63 38 37  34 62 63 61 36 32 39 39
+   1.0935767592463334e-42     4.85260048989367e-33
+   1.0935767592463334e-42     4.85260048989367e-33
+  63 63 61 30 66 31 39 31  35 31 32 62 66 32 61 37
+   1.4258713180329641e-71    6.169076269454506e-42
+   1.4258713180329641e-71    6.169076269454506e-42
+  38 32 36 38 33 32 30 30  30 30 30 30 30 30 34 39
+   1.3987219813891505e-76    3.888112687727643e-33
+   1.3987219813891505e-76    3.888112687727643e-33
+  34 38 33 30 34 35 30 32  32 30 33 62 66 37 35 34
+    6.011817374894185e-67   3.3799684781356806e-57
+    6.011817374894185e-67   3.3799684781356806e-57
+  64 31 63 36 37 33 32 66  62 66 38 37 63 35 64 63
+  1.9333487976530946e+184   6.101303207986106e+170
+  1.9333487976530946e+184   6.101303207986106e+170
+  64 38 31 32 35 38 61 65  66 64 33 30 66 32 30 36
+  2.2329012310821956e+180   1.1082349383510008e-47
+  2.2329012310821956e+180   1.1082349383510008e-47
+  30 64 37 62 64 38 61 63  34 61 35 36 39 36 66 37
+   5.199095696432207e+170    7.968096235104942e-42
+   5.199095696432207e+170    7.968096235104942e-42
+  39 32 37 30 39 31 64 61  64 31 30 32 32 31 30 30
+  1.4194269058332777e+161   1.3983832822741677e-76
+  1.4194269058332777e+161   1.3983832822741677e-76
+  66 35 62 63 62 37 32 36  63 34 63 66 35 65 64 30
+    1.246412906407816e-47   1.4091011711027438e-75
+    1.246412906407816e-47   1.4091011711027438e-75
+  65 64 33 34 63 63 31 33  64 61 64 65 65 64 66 36
+    4.226845171387797e-62   1.2257076754032372e-46
+    4.226845171387797e-62   1.2257076754032372e-46
+  32 38 61 65 31 30 34 35  62 37 63 62 33 34 34 32
+   2.1077520355549874e-52    7.494046376291776e-67
+   2.1077520355549874e-52    7.494046376291776e-67
+  31 62 63 36 30 62 38 39  66 34 63 65 63 61 65 37
+   4.6961005558811506e-33    7.669850571520072e-42
+   4.6961005558811506e-33    7.669850571520072e-42
+  30 31 66 66 66 66 66 66  66 66 30 31 30 30 30 30
+  1.9035985662511804e+185   1.3980432912471045e-76
+  1.9035985662511804e+185   1.3980432912471045e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 31 36 61
+    1.398043286095289e-76  1.9500103852204303e+160
+    1.398043286095289e-76  1.9500103852204303e+160
+  30 30 30 30 30 30 30 30  22 2c 20 22 50 32 53 48
+    1.398043286095289e-76    2.612896978874658e+40
+    1.398043286095289e-76    2.612896978874658e+40
+  22 5d 2c 0a 0a 5b 22 42  75 74 20 6f 6e 6c 79 20
+         39418397974.1819  3.0338811800777685e-152
+         39418397974.1819  3.0338811800777685e-152
+  69 66 20 65 78 65 63 75  74 69 6f 6e 20 68 61 73
+   2.912371233448788e+257   6.085328292052509e+247
+   2.912371233448788e+257   6.085328292052509e+247
+  20 72 65 61 63 68 65 64  20 69 74 22 5d 2c 0a 5b
+   4.235833171706815e+175   3.628495247503526e+130
+   4.235833171706815e+175   3.628495247503526e+130
+  5b 5b 22 61 39 35 35 30  33 32 66 34 64 36 62 30
+   1.8315505774458196e-76   1.2582874441320882e-75
+   1.8315505774458196e-76   1.2582874441320882e-75
+  63 39 62 66 65 38 63 61  64 38 66 30 30 61 38 39
+   1.351100943583286e+161    4.695348170747205e-33
+   1.351100943583286e+161    4.695348170747205e-33
+  33 33 37 39 30 62 39 63  31 64 63 32 38 63 38 32
+   9.579655761433412e+169    9.045854781039367e-67
+   9.579655761433412e+169    9.045854781039367e-67
+  65 30 66 34 38 65 37 35  62 33 35 64 61 30 65 34
+   2.4425925679055936e-52   2.7004801857441958e-56
+   2.4425925679055936e-52   2.7004801857441958e-56
+  39 34 34 22 2c 20 30 2c  20 22 30 78 32 31 20 30
+    7.549518397933035e-96        6.99191821301e-77
+    7.549518397933035e-96        6.99191821301e-77
+  78 30 33 38 34 37 39 61  30 66 61 39 39 38 63 64
+  2.2156834597514552e+160  3.8028776920596814e+175
+  2.2156834597514552e+160  3.8028776920596814e+175
+  33 35 32 35 39 61 32 65  66 30 61 37 61 35 63 36
+   2.979186711938135e+179   1.0514399252266624e-46
+   2.979186711938135e+179   1.0514399252266624e-46
+  38 36 36 32 63 31 34 37  34 66 38 38 63 63 62 36
+     9.05481843014918e-43    1.006539151317854e-46
+     9.05481843014918e-43    1.006539151317854e-46
+  64 30 38 61 37 36 37 37  62 62 65 63 37 66 32 32
+   1.0408523267491937e-42    6.824673240278423e-67
+   1.0408523267491937e-42    6.824673240278423e-67
+  30 34 31 20 43 48 45 43  4b 53 49 47 56 45 52 49
+        11980855302056032   1.6298140813692505e+45
+        11980855302056032   1.6298140813692505e+45
+  46 59 20 43 4f 44 45 53  45 50 41 52 41 54 4f 52
+    1.386281819775562e+93   3.1161400419388188e+88
+    1.386281819775562e+93   3.1161400419388188e+88
+  20 30 78 32 31 20 30 78  30 33 38 34 37 39 61 30
+   8.519145899392357e+270    1.189960295862729e-75
+   8.519145899392357e+270    1.189960295862729e-75
+  66 61 39 39 38 63 64 33  35 32 35 39 61 32 65 66
+    3.964756280945623e-61   1.801347790106722e+185
+    3.964756280945623e-61   1.801347790106722e+185
+  30 61 37 61 35 63 36 38  36 36 32 63 31 34 37 34
+    6.579104719101262e-38   3.6965911293749856e-57
+    6.579104719101262e-38   3.6965911293749856e-57
+  66 38 38 63 63 62 36 64  30 38 61 37 36 37 37 62
+   5.536325086701819e+174  1.3368998736153734e+165
+   5.536325086701819e+174  1.3368998736153734e+165
+  62 65 63 37 66 32 32 30  34 31 20 43 48 45 43 4b
+   1.5715125547642327e-76    3.691520062076471e+54
+   1.5715125547642327e-76    3.691520062076471e+54
+  53 49 47 56 45 52 49 46  59 20 43 4f 44 45 53 45
+    4.012331313964064e+30    9.318677580014916e+25
+    4.012331313964064e+30    9.318677580014916e+25
+  50 41 52 41 54 4f 52 20  31 22 5d 5d 2c 0a 22 30
+   5.462452767046183e-153     7.78971152971537e-77
+   5.462452767046183e-153     7.78971152971537e-77
+  31 30 30 30 30 30 30 30  31 34 34 34 39 30 65 64
+   1.3980432860952892e-76  4.1924230133295616e+175
+   1.3980432860952892e-76  4.1924230133295616e+175
+  61 33 35 35 62 65 37 34  38 30 66 32 65 63 38 32
+   3.7272025799530575e-57    9.046109472255011e-67
+   3.7272025799530575e-57    9.046109472255011e-67
+  38 64 63 63 31 62 39 39  30 33 37 39 33 61 38 30
+    4.888697005630772e-33    2.105470936671066e-76
+    4.888697005630772e-33    2.105470936671066e-76
+  30 38 66 61 64 38 63 66  65 39 62 30 63 36 62 34
+  1.6333794936323276e+185    2.321128670110722e-56
+  1.6333794936323276e+185    2.321128670110722e-56
+  64 32 66 30 33 35 35 61  39 30 30 30 30 30 30 30
+   1.863517958150109e+160   1.3980432860952916e-76
+   1.863517958150109e+160   1.3980432860952916e-76
+  30 39 32 34 38 33 30 34  35 30 32 32 31 30 30 39
+   2.5808210598206305e-57   3.1177436717571864e-33
+   2.5808210598206305e-57   3.1177436717571864e-33
+  63 30 61 32 37 66 38 38  36 61 31 64 38 63 62 38
+    7.170303873526367e-38    4.322899098305915e-37
+    7.170303873526367e-38    4.322899098305915e-37
+  37 66 36 66 35 39 35 66  62 63 33 31 36 33 64 32
+  2.2545183636871593e+184    5.994090687668748e-66
+  2.2545183636871593e+184    5.994090687668748e-66
+  38 66 37 61 38 31 65 63  33 63 34 62 32 35 32 65
+   6.398305408515778e+170   2.951310537230833e+179
+   6.398305408515778e+170   2.951310537230833e+179
+  65 37 66 33 61 63 37 37  66 64 31 33 66 66 61 30
+    1.048763245710555e-42    1.202154451996107e-75
+    1.048763245710555e-42    1.202154451996107e-75
+  32 32 30 33 63 61 61 38  64 66 61 30 39 37 31 33
+    4.086117086452212e-37    4.184908831295728e-62
+    4.086117086452212e-37    4.184908831295728e-62
+  63 38 63 34 64 37 65 66  35 37 35 63 37 35 65 64
+  1.8030114620891407e+185   4.196282066860042e+175
+  1.8030114620891407e+185   4.196282066860042e+175
+  39 37 38 31 32 30 37 32  34 30 35 64 39 33 32 62
+    8.601005840053539e-67  1.0480723979555873e+165
+    8.601005840053539e-67  1.0480723979555873e+165
+  64 31 31 65 36 61 31 35  39 33 61 39 38 62 36 37
+    1.814529130316398e-52   1.0037184951899389e-42
+    1.814529130316398e-52   1.0037184951899389e-42
+  39 33 37 30 31 34 38 33  30 34 35 30 32 32 30 31
+   5.8836362249745225e-62     9.16665547105235e-72
+   5.8836362249745225e-62     9.16665547105235e-72
+  65 33 38 36 31 65 66 33  39 61 35 32 36 34 30 36
+    4.355193220269599e-61   1.1087193851429998e-47
+    4.355193220269599e-61   1.1087193851429998e-47
+  62 61 64 31 65 32 30 65  63 61 64 30 36 62 65 37
+   2.625355802838831e+179     7.67100441483468e-42
+   2.625355802838831e+179     7.67100441483468e-42
+  33 37 35 61 64 34 30 64  64 62 35 38 32 63 39 62
+   4.007904240653809e+174   1.461966165171938e+165
+   4.007904240653809e+174   1.461966165171938e+165
+  65 34 32 64 32 36 63 33  61 30 64 37 62 32 34 30
+   3.7360857035378715e-61   1.7442306547830944e-76
+   3.7360857035378715e-61   1.7442306547830944e-76
+  32 32 31 30 30 39 64 30  61 33 39 38 35 65 39 36
+    1.397220945061586e-75    1.737619901909741e-47
+    1.397220945061586e-75    1.737619901909741e-47
+  35 32 32 65 35 39 36 33  35 64 31 39 63 63 34 34
+    5.402226544727475e-62     3.24803287226407e-57
+    5.402226544727475e-62     3.24803287226407e-57
+  34 38 35 34 37 34 37 37  33 39 36 63 65 30 65 66
+   1.0405018818276977e-42  1.8006892672742072e+185
+   1.0405018818276977e-42  1.8006892672742072e+185
+  31 37 61 35 38 65 37 64  37 34 63 33 65 66 34 36
+   5.786390935159805e+174   1.3958233901048377e-47
+   5.786390935159805e+174   1.3958233901048377e-47
+  34 32 39 32 33 30 31 66  66 66 66 66 66 66 66 30
+   1.825869834435658e+184   1.5476014050729244e-75
+   1.825869834435658e+184   1.5476014050729244e-75
+  31 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432860952892e-76    1.398043286095289e-76
+   1.3980432860952892e-76    1.398043286095289e-76
+  30 30 31 36 61 30 30 30  30 30 30 30 30 22 2c 20
+   1.3981078879631443e-76  1.0491479271301769e-153
+   1.3981078879631443e-76  1.0491479271301769e-153
+  22 50 32 53 48 22 5d 2c  0a 0a 5b 22 43 4f 44 45
+    5.455822643446265e-95   4.9105643503751364e+25
+    5.455822643446265e-95   4.9105643503751364e+25
+  53 45 50 41 52 41 54 4f  52 20 69 6e 20 61 6e 20
+   1.4315108960822492e+74  1.8126393976389607e-152
+   1.4315108960822492e+74  1.8126393976389607e-152
+  75 6e 65 78 65 63 75 74  65 64 20 49 46 20 62 6c
+   9.800584406797248e+252  1.2204237385486052e+214
+   9.800584406797248e+252  1.2204237385486052e+214
+  6f 63 6b 20 64 6f 65 73  20 6e 6f 74 20 63 68 61
+     7.4936326522669e+247  1.7143120835329264e+161
+     7.4936326522669e+247  1.7143120835329264e+161
+  6e 67 65 20 77 68 61 74  20 69 73 20 68 61 73 68
+   3.988383832286107e+252   1.414757728416494e+195
+   3.988383832286107e+252   1.414757728416494e+195
+  65 64 22 5d 2c 0a 5b 5b  5b 22 61 39 35 35 30 33
+  1.1995562572248044e+132     3.93990847701726e-62
+  1.1995562572248044e+132     3.93990847701726e-62
+  32 66 34 64 36 62 30 63  39 62 66 65 38 63 61 64
+   6.183125097772329e+169   3.440381572380187e+175
+   6.183125097772329e+169   3.440381572380187e+175
+  38 66 30 30 61 38 39 33  33 37 39 30 62 39 63 31
+    6.130699027874599e-62    8.704388679201914e-71
+    6.130699027874599e-62    8.704388679201914e-71
+  64 63 32 38 63 38 32 65  30 66 34 38 65 37 35 62
+  2.9533308207589775e+179  1.2217689819292476e+165
+  2.9533308207589775e+179  1.2217689819292476e+165
+  33 35 64 61 30 65 34 39  34 34 22 2c 20 30 2c 20
+   3.9279860209325875e-33  1.0511782037415706e-153
+   3.9279860209325875e-33  1.0511782037415706e-153
+  22 49 46 20 43 4f 44 45  53 45 50 41 52 41 54 4f
+    4.910564320383778e+25   1.4315108960822492e+74
+    4.910564320383778e+25   1.4315108960822492e+74
+  52 20 45 4e 44 49 46 20  30 78 32 31 20 30 78 30
+  3.3243612422494877e-153    3.342265106080618e-75
+  3.3243612422494877e-153    3.342265106080618e-75
+  33 37 38 64 34 33 30 32  37 34 66 38 63 35 65 63
+    6.008920707667188e-67   6.403220223187303e+170
+    6.008920707667188e-67   6.403220223187303e+170
+  31 33 32 31 33 33 38 31  35 31 65 39 66 32 37 66
+   1.3696714539123554e-71   2.464148040469794e+184
+   1.3696714539123554e-71   2.464148040469794e+184
+  34 63 36 37 36 61 30 30  38 62 64 66 38 36 33 38
+   1.4145813952762878e-76    5.645840032521388e-38
+   1.4145813952762878e-76    5.645840032521388e-38
+  64 30 37 63 30 62 36 62  65 39 61 62 33 35 63 37
+  1.2889813200008976e+165    6.890465817581642e-42
+  1.2889813200008976e+165    6.890465817581642e-42
+  31 20 43 48 45 43 4b 53  49 47 56 45 52 49 46 59
+   1.7771281712245166e+93  1.1509816729232645e+122
+   1.7771281712245166e+93  1.1509816729232645e+122
+  20 43 4f 44 45 53 45 50  41 52 41 54 4f 52 20 31
+    4.938596448638355e+78    4.618827314400896e-72
+    4.938596448638355e+78    4.618827314400896e-72
+  22 5d 5d 2c 0a 22 30 31  30 30 30 30 30 30 30 31
+    9.130936148260522e-72    9.162216479754085e-72
+    9.130936148260522e-72    9.162216479754085e-72
+  34 34 34 39 30 65 64 61  33 35 35 62 65 37 34 38
+  1.4336960690051253e+161    5.941063277614971e-38
+  1.4336960690051253e+161    5.941063277614971e-38
+  30 66 32 65 63 38 32 38  64 63 63 31 62 39 39 30
+    5.354455129952148e-38   2.1784005039756538e-76
+    5.354455129952148e-38   2.1784005039756538e-76
+  33 37 39 33 61 38 30 30  38 66 61 64 38 63 66 65
+   1.4008066753553505e-76  2.9030502670331722e+180
+   1.4008066753553505e-76  2.9030502670331722e+180
+  39 62 30 63 36 62 34 64  32 66 30 33 35 35 61 39
+   5.041494454995213e+174    2.651288011569008e-32
+   5.041494454995213e+174    2.651288011569008e-32
+  30 30 30 30 30 30 30 30  34 61 34 38 33 30 34 35
+    1.398043286095289e-76   2.1077549406131267e-52
+    1.398043286095289e-76   2.1077549406131267e-52
+  30 32 32 30 37 61 36 39  37 34 61 37 37 63 35 39
+     4.31018275068805e-33    4.119094471482346e-33
+     4.31018275068805e-33    4.119094471482346e-33
+  31 66 61 31 33 64 66 66  36 30 63 61 62 62 62 38
+   1.902868242298634e+185    4.322131371642699e-37
+   1.902868242298634e+185    4.322131371642699e-37
+  35 61 30 64 65 39 65 30  32 35 63 30 39 63 36 35
+   1.4663663812767042e-75   2.3373736014864973e-52
+   1.4663663812767042e-75   2.3373736014864973e-52
+  61 34 62 32 32 38 35 65  34 37 63 65 38 65 32 32
+  3.4394809284270056e+179    6.823230035455128e-67
+  3.4394809284270056e+179    6.823230035455128e-67
+  66 37 36 31 30 32 32 31  30 30 66 30 65 66 61 61
+   1.0298598117437043e-71  1.2231408890065723e+161
+   1.0298598117437043e-71  1.2231408890065723e+161
+  63 39 66 66 38 61 63 33  36 62 31 30 37 32 31 65
+   3.7687682863107065e-61  2.7873324711776246e+179
+   3.7687682863107065e-61  2.7873324711776246e+179
+  30 61 61 65 31 66 62 39  37 35 63 39 30 35 30 30
+    2.834844266373178e-32    1.399730085120109e-76
+    2.834844266373178e-32    1.399730085120109e-76
+  62 35 30 63 35 36 65 38  61 30 63 63 35 32 62 30
+    4.986858959478891e-37    1.257158568232161e-75
+    4.986858959478891e-37    1.257158568232161e-75
+  34 30 33 66 30 34 32 35  64 64 30 31 30 30 66 66
+   1.9005720307081815e-52   1.885602366391569e+185
+   1.9005720307081815e-52   1.885602366391569e+185
+  66 66 66 66 66 66 30 31  30 30 30 30 30 30 30 30
+     9.28207105579738e-72    1.398043286095289e-76
+     9.28207105579738e-72    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 31 36 61 30 30 30 30
+    1.398043286095289e-76   1.3980435384463352e-76
+    1.398043286095289e-76   1.3980435384463352e-76
+  30 30 30 30 22 2c 20 22  50 32 53 48 22 5d 2c 0a
+     2.5902785586997e-144  1.1529705962819529e-259
+     2.5902785586997e-144  1.1529705962819529e-259
+  0a 5b 22 41 73 20 61 62  6f 76 65 2c 20 77 69 74
+   7.890105417215866e+165  5.8343941846408034e+252
+   7.890105417215866e+165  5.8343941846408034e+252
+  68 20 74 68 65 20 49 46  20 62 6c 6f 63 6b 20 65
+   3.9814603558938884e+30  1.3307209538595497e+179
+   3.9814603558938884e+30  1.3307209538595497e+179
+  78 65 63 75 74 65 64 22  5d 2c 0a 5b 5b 5b 22 61
+  5.2268933099951655e-143    8.06503349056827e+159
+  5.2268933099951655e-143    8.06503349056827e+159
+  39 35 35 30 33 32 66 34  64 36 62 30 63 39 62 66
+   2.8288333702192255e-56   1.548727831023251e+185
+   2.8288333702192255e-56   1.548727831023251e+185
+  65 38 63 61 64 38 66 30  30 61 38 39 33 33 37 39
+    1.535184783694008e-75    4.468157540087272e-33
+    1.535184783694008e-75    4.468157540087272e-33
+  30 62 39 63 31 64 63 32  38 63 38 32 65 30 66 34
+    5.754129660356332e-66    2.827934937675745e-56
+    5.754129660356332e-66    2.827934937675745e-56
+  38 65 37 35 62 33 35 64  61 30 65 34 39 34 34 22
+    5.24358191718946e+174   6.472013215777062e-144
+    5.24358191718946e+174   6.472013215777062e-144
+  2c 20 30 2c 20 22 49 46  20 43 4f 44 45 53 45 50
+    3.982530894977298e+30    4.938596448638355e+78
+    3.982530894977298e+30    4.938596448638355e+78
+  41 52 41 54 4f 52 20 45  4e 44 49 46 20 30 78 32
+    9.865755264717706e+24   1.4354920071177004e-65
+    9.865755264717706e+24   1.4354920071177004e-65
+  31 20 30 78 30 33 37 38  64 34 33 30 32 37 34 66
+    6.817854990713587e-38  2.1474556573079126e+184
+    6.817854990713587e-38  2.1474556573079126e+184
+  38 63 35 65 63 31 33 32  31 33 33 38 31 35 31 65
+    7.119050768005487e-67   2.789217206196148e+179
+    7.119050768005487e-67   2.789217206196148e+179
+  39 66 32 37 66 34 63 36  37 36 61 30 30 38 62 64
+   1.0512302796483916e-46   3.604986092200413e+175
+   1.0512302796483916e-46   3.604986092200413e+175
+  66 38 36 33 38 64 30 37  63 30 62 36 62 65 39 61
+     7.35019498170337e-43  2.2315341607729353e+160
+     7.35019498170337e-43  2.2315341607729353e+160
+  62 33 35 63 37 31 20 43  48 45 43 4b 53 49 47 56
+         2278856792381873   4.272591087208812e+107
+         2278856792381873   4.272591087208812e+107
+  45 52 49 46 59 20 43 4f  44 45 53 45 50 41 52 41
+    6.758671390232611e+73        4785473.083207432
+    6.758671390232611e+73        4785473.083207432
+  54 4f 52 20 31 22 5d 5d  2c 0a 22 30 31 30 30 30
+   5.551004350196569e+141   1.3980446035855388e-76
+   5.551004350196569e+141   1.3980446035855388e-76
+  30 30 30 30 31 34 34 34  39 30 65 64 61 33 35 35
+    3.218663071686238e-57     2.21345686391591e-52
+    3.218663071686238e-57     2.21345686391591e-52
+  62 65 37 34 38 30 66 32  65 63 38 32 38 64 63 63
+    6.584095400029062e-66   5.854618100963652e+170
+    6.584095400029062e-66   5.854618100963652e+170
+  31 62 39 39 30 33 37 39  33 61 38 30 30 38 66 61
+   4.4681487239246586e-33    1.56193045165525e+161
+   4.4681487239246586e-33    1.56193045165525e+161
+  64 38 63 66 65 39 62 30  63 36 62 34 64 32 66 30
+    1.259098345008357e-75   1.5335653167616423e-75
+    1.259098345008357e-75   1.5335653167616423e-75
+  33 35 35 61 39 30 30 30  30 30 30 30 30 34 61 34
+   1.3980553983992288e-76   2.1925864539849275e-56
+   1.3980553983992288e-76   2.1925864539849275e-56
+  38 33 30 34 35 30 32 32  31 30 30 66 61 34 61 37
+    6.746419809741631e-67    6.171851582633616e-42
+    6.746419809741631e-67    6.171851582633616e-42
+  34 62 61 39 66 64 35 39  63 35 39 66 34 36 63 33
+   4.1199849314200234e-33    3.736091661767375e-61
+   4.1199849314200234e-33    3.736091661767375e-61
+  39 36 30 63 66 39 30 63  62 65 30 64 32 62 37 34
+    6.12295912121332e+169    3.725219439946708e-57
+    6.12295912121332e+169    3.725219439946708e-57
+  33 63 34 37 31 64 32 34  61 33 64 35 64 36 64 62
+   2.9299152294182146e-57   9.311656410551874e+165
+   2.9299152294182146e-57   9.311656410551874e+165
+  36 30 30 32 61 66 35 65  65 62 62 30 32 32 30 34
+   3.468722799905575e+179   2.5801841369049054e-57
+   3.468722799905575e+179   2.5801841369049054e-57
+  64 37 30 65 63 34 39 30  66 64 30 66 37 30 35 35
+   2.1767153367235285e-76   2.2121664706305192e-52
+   2.1767153367235285e-76   2.2121664706305192e-52
+  61 37 63 34 35 66 38 36  35 31 34 33 33 36 65 33
+   1.6694643861584765e-47   4.1250265578869146e-61
+   1.6694643861584765e-47   4.1250265578869146e-61
+  61 37 66 30 33 35 30 33  64 61 63 65 63 61 62 62
+    3.939900928490818e-62   8.467654471095934e+165
+    3.939900928490818e-62   8.467654471095934e+165
+  32 34 37 66 63 32 33 66  31 35 63 38 33 35 31 30
+  2.0392330672900146e+184   1.4860957188477226e-76
+  2.0392330672900146e+184   1.4860957188477226e-76
+  31 35 31 66 66 66 66 66  66 66 66 30 31 30 30 30
+   1.903598565202809e+185   1.3980446049601027e-76
+   1.903598565202809e+185   1.3980446049601027e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 31 36
+    1.398043286095289e-76   1.1760667833056972e-47
+    1.398043286095289e-76   1.1760667833056972e-47
+  61 30 30 30 30 30 30 30  30 22 2c 20 22 50 32 53
+    1.398043286095304e-76    5.968685125563565e+92
+    1.398043286095304e-76    5.968685125563565e+92
+  48 22 5d 2c 0a 0a 0a 5b  22 43 48 45 43 4b 53 49
+   3.609907493231361e+130    1.721081884909945e+45
+   3.609907493231361e+130    1.721081884909945e+45
+  47 20 69 73 20 6c 65 67  61 6c 20 69 6e 20 73 63
+  1.1930943816517483e+190  1.1549342318899572e+171
+  1.1930943816517483e+190  1.1549342318899572e+171
+  72 69 70 74 53 69 67 73  22 5d 2c 0a 5b 5b 5b 22
+   8.184542052095316e+247  3.5053249760825546e-143
+   8.184542052095316e+247  3.5053249760825546e-143
+  63 63 66 37 66 34 30 35  33 61 30 32 65 36 35 33
+   1.6918480234583133e-52   5.1564686429613096e-62
+   1.6918480234583133e-52   5.1564686429613096e-62
+  63 33 36 61 63 37 35 63  38 39 31 62 37 34 39 36
+   8.006974605187833e+169   1.7245256140898775e-47
+   8.006974605187833e+169   1.7245256140898775e-47
+  64 30 64 63 35 63 65 35  32 31 34 66 36 63 39 31
+   1.7863701400228064e-51   1.4368843417480188e-71
+   1.7863701400228064e-51   1.4368843417480188e-71
+  33 64 39 63 66 38 66 31  33 32 39 65 62 65 65 30
+   1.0061000865853109e-70   1.4782379546404435e-75
+   1.0061000865853109e-70   1.4782379546404435e-75
+  22 2c 20 30 2c 20 22 44  55 50 20 48 41 53 48 31
+    1.671798370748492e+20   2.7535167423670866e-71
+    1.671798370748492e+20   2.7535167423670866e-71
+  36 30 20 30 78 31 34 20  30 78 65 65 35 61 36 61
+  1.5060806567872225e-153   1.966492882182297e+160
+  1.5060806567872225e-153   1.966492882182297e+160
+  61 34 30 66 61 63 65 66  62 32 36 35 35 61 63 32
+  1.8176141189776692e+185    5.750669577131884e-66
+  1.8176141189776692e+185    5.750669577131884e-66
+  33 63 30 63 32 38 63 35  37 63 36 35 63 34 31 66
+   1.6052891166078803e-51   1.827607463005638e+184
+   1.6052891166078803e-51   1.827607463005638e+184
+  39 62 20 45 51 55 41 4c  56 45 52 49 46 59 20 43
+    2.176054151182411e+59         2300879020040875
+    2.176054151182411e+59         2300879020040875
+  48 45 43 4b 53 49 47 22  5d 5d 2c 0a 22 30 31 30
+  1.4918835928118613e-143    1.484386327115762e-76
+  1.4918835928118613e-143    1.484386327115762e-76
+  30 30 30 30 30 30 31 65  30 62 65 39 65 33 32 66
+   2.786048826348865e+179  1.9334233783101282e+184
+   2.786048826348865e+179  1.9334233783101282e+184
+  31 66 38 39 63 33 64 39  31 36 63 34 66 32 31 65
+   3.1124156928752614e-32   2.787448756992184e+179
+   3.1124156928752614e-32   2.787448756992184e+179
+  35 35 63 64 63 64 30 39  36 37 34 31 62 38 39 35
+   3.1570116367163677e-33   2.6331167820417368e-52
+   3.1570116367163677e-33   2.6331167820417368e-52
+  63 63 37 36 61 63 33 35  33 65 36 30 32 33 61 30
+   2.0242227469719105e-52   1.1883357266584632e-75
+   2.0242227469719105e-52   1.1883357266584632e-75
+  35 66 34 66 37 63 63 30  30 30 30 30 30 30 30 64
+   1.3394741698139665e-75   4.003842734435198e+174
+   1.3394741698139665e-75   4.003842734435198e+174
+  38 36 31 34 39 33 30 34  36 30 32 32 31 30 30 38
+    2.580823490648451e-57    4.757299303828716e-38
+    2.580823490648451e-57    4.757299303828716e-38
+  36 65 35 66 37 33 36 61  32 63 33 36 32 32 65 62
+  1.9507065333794737e+160   9.764795465624995e+165
+  1.9507065333794737e+160   9.764795465624995e+165
+  62 36 32 62 64 39 64 39  33 64 38 65 35 64 37 36
+   3.1160295388132845e-32   1.6005072557933068e-47
+   3.1160295388132845e-32   1.6005072557933068e-47
+  35 30 38 62 39 38 62 65  39 32 32 62 39 37 31 36
+  2.3625818783885527e+180   1.1779473189889488e-47
+  2.3625818783885527e+180   1.1779473189889488e-47
+  30 65 64 63 33 64 63 63  61 36 64 38 63 34 37 30
+   5.854595951405623e+170   2.0039917350270662e-76
+   5.854595951405623e+170   2.0039917350270662e-76
+  32 32 31 30 30 62 32 33  63 33 31 32 61 63 32 33
+    4.468792921310347e-62    4.469924258164743e-62
+    4.468792921310347e-62    4.469924258164743e-62
+  32 61 34 34 37 33 66 31  39 64 32 61 65 62 39 35
+   1.0051831440349417e-70   2.6502507842063565e-52
+   1.0051831440349417e-70   2.6502507842063565e-52
+  61 62 37 62 64 66 32 62  36 35 35 31 38 39 31 31
+  1.0595824051426397e+165     9.74816327827664e-72
+  1.0595824051426397e+165     9.74816327827664e-72
+  61 30 64 37 32 64 35 30  65 33 38 62 35 64 64 33
+   1.8473966038555483e-76    3.965507499459145e-61
+   1.8473966038555483e-76    3.965507499459145e-61
+  31 64 63 38 32 30 31 32  31 30 33 38 34 37 39 61
+     6.37548230812995e-67   2.215683459751433e+160
+     6.37548230812995e-67   2.215683459751433e+160
+  30 66 61 39 39 38 63 64  33 35 32 35 39 61 32 65
+  3.8028776920596814e+175   2.979186711938135e+179
+  3.8028776920596814e+175   2.979186711938135e+179
+  66 30 61 37 61 35 63 36  38 36 36 32 63 31 34 37
+   1.0514399252266624e-46     9.05481843014918e-43
+   1.0514399252266624e-46     9.05481843014918e-43
+  34 66 38 38 63 63 62 36  64 30 38 61 37 36 37 37
+    1.006539151317854e-46   1.0408523267491937e-42
+    1.006539151317854e-46   1.0408523267491937e-42
+  62 62 65 63 37 66 32 32  30 34 31 61 63 34 37 33
+    6.824673240278423e-67    5.640735860616471e-62
+    6.824673240278423e-67    5.640735860616471e-62
+  30 34 34 30 32 32 30 35  30 38 66 61 37 36 31 38
+    1.690949474839413e-52    5.058088285499616e-38
+    1.690949474839413e-52    5.058088285499616e-38
+  36 35 63 38 61 62 64 38  31 32 34 34 61 31 36 38
+    4.792324950116244e-37    6.521904048378079e-38
+    4.792324950116244e-37    6.521904048378079e-38
+  33 39 32 38 37 36 65 65  31 64 39 34 65 38 65 64
+   2.750581615559047e+180   4.198739117082725e+175
+   2.750581615559047e+180   4.198739117082725e+175
+  38 33 38 39 37 30 36 36  62 35 65 32 64 66 32 34
+    1.518188011370976e-47   2.9312837609393094e-57
+    1.518188011370976e-47   2.9312837609393094e-57
+  30 30 64 61 64 32 34 30  32 32 30 34 33 66 35 65
+    1.744233506529984e-76  3.4686090472438776e+179
+    1.744233506529984e-76  3.4686090472438776e+179
+  65 37 35 33 38 65 38 37  65 39 63 36 61 65 66 37
+   1.0939270673350494e-42    8.034176219642371e-42
+   1.0939270673350494e-42    8.034176219642371e-42
+  65 66 35 35 31 33 33 64  33 65 35 31 64 61 37 63
+   4.748736189969527e+174   8.823688339983944e+169
+   4.748736189969527e+174   8.823688339983944e+169
+  63 35 32 32 38 33 30 61  39 63 34 64 37 33 36 39
+  1.4234911414509393e+160    4.275576794028839e-33
+  1.4234911414509393e+160    4.275576794028839e-33
+  37 37 61 37 36 65 66 37  35 35 63 30 31 32 31 30
+      8.0339408665053e-42   1.4850809911152272e-76
+      8.0339408665053e-42   1.4850809911152272e-76
+  33 38 34 37 39 61 30 66  61 39 39 38 63 64 33 35
+  1.7399846191221417e+184   2.0246337771756416e-52
+  1.7399846191221417e+184   2.0246337771756416e-52
+  32 35 39 61 32 65 66 30  61 37 61 35 63 36 38 36
+   1.5472766840590755e-75   1.6566831458373719e-47
+   1.5472766840590755e-75   1.6566831458373719e-47
+  36 32 63 31 34 37 34 66  38 38 63 63 62 36 64 30
+  2.1474589066355844e+184    1.396464226074296e-75
+  2.1474589066355844e+184    1.396464226074296e-75
+  38 61 37 36 37 37 62 62  65 63 37 66 32 32 30 34
+   8.391762123722653e+165     2.58018464807075e-57
+   8.391762123722653e+165     2.58018464807075e-57
+  31 66 66 66 66 66 66 66  66 30 31 30 30 30 30 30
+  1.9035985662552772e+185    1.398043286115413e-76
+  1.9035985662552772e+185    1.398043286115413e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 31 36 61 30
+    1.398043286095289e-76   1.1891443131408612e-75
+    1.398043286095289e-76   1.1891443131408612e-75
+  30 30 30 30 30 30 30 22  2c 20 22 50 32 53 48 22
+     5.1856307557119e-144  1.5584206141976403e-143
+     5.1856307557119e-144  1.5584206141976403e-143
+  5d 2c 0a 0a 5b 22 53 61  6d 65 20 73 65 6d 61 6e
+   6.725244042402123e+160   5.039618156990561e+223
+   6.725244042402123e+160   5.039618156990561e+223
+  74 69 63 73 20 66 6f 72  20 4f 50 5f 43 4f 44 45
+  1.6749482891741584e+243    4.910565228873731e+25
+  1.6749482891741584e+243    4.910565228873731e+25
+  53 45 50 41 52 41 54 4f  52 22 5d 2c 0a 5b 5b 5b
+   1.4315108960822492e+74  1.2135697532664568e+132
+   1.4315108960822492e+74  1.2135697532664568e+132
+  22 31 30 63 39 66 30 65  66 66 65 38 33 65 39 37
+  2.6581720816038994e+179   1.1387652109214985e-42
+  2.6581720816038994e+179   1.1387652109214985e-42
+  66 38 30 66 30 36 37 64  65 32 62 31 31 63 36 61
+   5.740953147103502e+174  1.9671737264120857e+160
+   5.740953147103502e+174  1.9671737264120857e+160
+  30 30 63 33 30 38 38 61  34 62 63 65 34 32 63 35
+  2.1281519012564878e+160   1.6033340851630803e-51
+  2.1281519012564878e+160   1.6033340851630803e-51
+  61 65 37 36 31 35 31 39  61 66 39 33 30 36 66 33
+    3.314098294269811e-33     4.31948688346111e-61
+    3.314098294269811e-33     4.31948688346111e-61
+  63 22 2c 20 31 2c 20 22  44 55 50 20 48 41 53 48
+  2.5903150650380665e-144   2.6208557167997654e+40
+  2.5903150650380665e-144   2.6208557167997654e+40
+  31 36 30 20 30 78 31 34  20 30 78 65 65 35 61 36
+    2.783049419442401e-57    9.419669740322918e-47
+    2.783049419442401e-57    9.419669740322918e-47
+  61 61 34 30 66 61 63 65  66 62 32 36 35 35 61 63
+  2.5131107314427878e+180   5.195340290775036e+170
+  2.5131107314427878e+180   5.195340290775036e+170
+  32 33 63 30 63 32 38 63  35 37 63 36 35 63 34 31
+   9.131791213993494e+169   1.1538933456093317e-71
+   9.131791213993494e+169   1.1538933456093317e-71
+  66 39 62 20 45 51 55 41  4c 56 45 52 49 46 59 20
+         5588244.50599513    7.54025010721777e-153
+         5588244.50599513    7.54025010721777e-153
+  43 48 45 43 4b 53 49 47  22 5d 5d 2c 0a 22 30 31
+   2.6299364878383027e+35    9.130936148260522e-72
+   2.6299364878383027e+35    9.130936148260522e-72
+  30 30 30 30 30 30 30 31  33 63 36 66 33 30 66 39
+    9.162216479754085e-72    3.418646490384244e-32
+    9.162216479754085e-72    3.418646490384244e-32
+  39 61 35 31 36 31 65 37  35 61 32 63 65 34 62 63
+    7.602340807539204e-42   5.496299861917988e+170
+    7.602340807539204e-42   5.496299861917988e+170
+  61 34 38 38 33 30 30 63  61 30 63 36 31 31 32 62
+   6.109396628906906e+169  1.0476153197497512e+165
+   6.109396628906906e+169  1.0476153197497512e+165
+  64 65 36 37 66 30 38 30  37 66 65 39 38 33 66 65
+    2.089007966496689e-76  2.8787363670172995e+180
+    2.089007966496689e-76  2.8787363670172995e+180
+  65 66 66 30 63 39 31 30  30 31 30 30 30 30 30 30
+   1.4875083322558424e-76   1.3980432860953674e-76
+   1.4875083322558424e-76   1.3980432860953674e-76
+  65 36 30 38 36 34 36 35  36 31 36 34 36 32 36 35
+    2.318200788880513e-52   2.3173851010753118e-52
+    2.318200788880513e-52   2.3173851010753118e-52
+  36 35 36 36 37 35 61 62  36 31 34 39 33 30 34 36
+   7.927474220000093e+165   1.3813382819555474e-47
+   7.927474220000093e+165   1.3813382819555474e-47
+  30 32 32 31 30 30 63 65  31 38 64 33 38 34 32 32
+  2.4881837919238485e+180    6.752232406134247e-67
+  2.4881837919238485e+180    6.752232406134247e-67
+  31 61 37 33 31 63 39 39  33 39 33 39 30 31 35 65
+    4.889448769028763e-33   3.435043886880933e+179
+    4.889448769028763e-33   3.435043886880933e+179
+  33 64 31 62 63 65 62 61  66 62 31 36 65 38 63 30
+  1.2931598885235114e+161    1.327917614713888e-75
+  1.2931598885235114e+161    1.327917614713888e-75
+  62 35 62 35 64 31 34 30  39 37 65 63 38 31 37 37
+   1.7438959296634594e-76   1.0399772052523864e-42
+   1.7438959296634594e-76   1.0399772052523864e-42
+  61 65 36 66 32 38 30 32  32 31 30 30 62 63 61 62
+    6.016153975391439e-67   8.010556339189858e+165
+    6.016153975391439e-67   8.010556339189858e+165
+  32 32 37 61 66 39 30 62  61 62 33 33 63 33 66 65
+   9.342894099178903e+164  2.8788214007909186e+180
+   9.342894099178903e+164  2.8788214007909186e+180
+  30 61 39 61 62 66 65 65  30 33 62 61 39 37 36 65
+  2.7749805821117005e+180  3.6009559817197347e+179
+  2.7749805821117005e+180  3.6009559817197347e+179
+  65 32 35 64 63 36 63 65  35 34 32 35 32 36 65 39
+   2.491324292974378e+180   3.2681804123462805e-32
+   2.491324292974378e+180   3.2681804123462805e-32
+  62 32 65 35 36 65 31 34  62 37 66 31 30 31 32 31
+   2.7712404769787725e-57    1.029638726461225e-71
+   2.7712404769787725e-57    1.029638726461225e-71
+  30 33 38 34 37 39 61 30  66 61 39 39 38 63 64 33
+    1.189960295862729e-75    3.964756280945623e-61
+    1.189960295862729e-75    3.964756280945623e-61
+  35 32 35 39 61 32 65 66  30 61 37 61 35 63 36 38
+   1.801347790106722e+185    6.579104719101262e-38
+   1.801347790106722e+185    6.579104719101262e-38
+  36 36 32 63 31 34 37 34  66 38 38 63 63 62 36 64
+   3.6965911293749856e-57   5.536325086701819e+174
+   3.6965911293749856e-57   5.536325086701819e+174
+  30 38 61 37 36 37 37 62  62 65 63 37 66 32 32 30
+  1.3368998736153734e+165   1.5715125547642327e-76
+  1.3368998736153734e+165   1.5715125547642327e-76
+  34 31 61 63 34 39 33 30  34 36 30 32 32 31 30 30
+   1.6601700303655357e-76   1.3983832822745457e-76
+   1.6601700303655357e-76   1.3983832822745457e-76
+  63 33 62 39 33 65 64 63  63 30 66 64 36 32 35 30
+    6.15769155267732e+170   1.8305345899256585e-76
+    6.15769155267732e+170   1.8305345899256585e-76
+  65 62 33 32 66 32 64 64  38 61 30 62 62 61 31 37
+   3.996240346182559e+175    7.793644252297355e-43
+   3.996240346182559e+175    7.793644252297355e-43
+  35 34 62 30 66 36 63 33  62 65 38 65 64 34 31 30
+   3.7362394059410705e-61   1.4858231702551895e-76
+   3.7362394059410705e-61   1.4858231702551895e-76
+  30 65 64 35 38 32 66 33  64 62 37 33 65 62 61 32
+     4.31647206583113e-61    5.158573020950177e-66
+     4.31647206583113e-61    5.158573020950177e-66
+  30 32 32 31 30 30 62 66  37 35 62 35 62 64 32 65
+  1.5456740510245306e+185  2.9811876166975565e+179
+  1.5456740510245306e+185  2.9811876166975565e+179
+  66 66 34 64 36 62 66 32  62 64 61 32 65 33 34 61
+    6.642043539217394e-66  1.7750291177506255e+160
+    6.642043539217394e-66  1.7750291177506255e+160
+  34 30 66 63 63 30 37 64  34 61 61 33 63 66 38 36
+   5.735348771784325e+174   1.6695124082917865e-47
+   5.735348771784325e+174   1.6695124082917865e-47
+  32 63 65 61 61 37 37 62  34 37 62 38 31 65 66 66
+  1.3369378016783294e+165   1.903197645570355e+185
+  1.3369378016783294e+165   1.903197645570355e+185
+  38 32 39 66 39 61 30 31  61 62 32 31 30 33 38 34
+    9.270628126505033e-72    3.855275113323114e-57
+    9.270628126505033e-72    3.855275113323114e-57
+  37 39 61 30 66 61 39 39  38 63 64 33 35 32 35 39
+    4.888099856699226e-33    4.082225045393815e-33
+    4.888099856699226e-33    4.082225045393815e-33
+  61 32 65 66 30 61 37 61  35 63 36 38 36 36 32 63
+  2.0543555935598498e+160   6.873051613973695e+169
+  2.0543555935598498e+160   6.873051613973695e+169
+  31 34 37 34 66 38 38 63  63 62 36 64 30 38 61 37
+   9.140653800368004e+169    6.177188516960013e-42
+   9.140653800368004e+169    6.177188516960013e-42
+  36 37 37 62 62 65 63 37  66 32 32 30 34 31 66 66
+    6.957985410000452e-42  1.8859395095019228e+185
+    6.957985410000452e-42  1.8859395095019228e+185
+  66 66 66 66 66 66 30 31  30 30 30 30 30 30 30 30
+     9.28207105579738e-72    1.398043286095289e-76
+     9.28207105579738e-72    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 31 36 61 30 30 30 30
+    1.398043286095289e-76   1.3980435384463352e-76
+    1.398043286095289e-76   1.3980435384463352e-76
+  30 30 30 30 22 2c 20 22  50 32 53 48 22 5d 2c 0a
+     2.5902785586997e-144  1.1529705962819529e-259
+     2.5902785586997e-144  1.1529705962819529e-259
+  0a 5b 22 53 69 67 6e 61  74 75 72 65 73 20 61 72
+   2.137261781465788e+161   9.136119060210385e+242
+   2.137261781465788e+161   9.136119060210385e+242
+  65 20 72 65 6d 6f 76 65  64 20 66 72 6f 6d 20 74
+   5.818467070608198e+180   2.352325363646359e+251
+   5.818467070608198e+180   2.352325363646359e+251
+  68 65 20 73 63 72 69 70  74 20 74 68 65 79 20 61
+   3.160533115124523e+233   7.237892762833152e+159
+   3.160533115124523e+233   7.237892762833152e+159
+  72 65 20 69 6e 20 62 79  20 46 69 6e 64 41 6e 64
+   5.020701641656544e+276   5.986471842297154e+175
+   5.020701641656544e+276   5.986471842297154e+175
+  44 65 6c 65 74 65 28 29  20 69 6e 20 74 68 65 20
+  2.0288768904507434e-110  1.2773465768272543e-152
+  2.0288768904507434e-110  1.2773465768272543e-152
+  43 48 45 43 4b 53 49 47  20 63 6f 64 65 3b 20 65
+   2.6299364878383027e+35   1.315527394216349e+179
+   2.6299364878383027e+35   1.315527394216349e+179
+  76 65 6e 20 6d 75 6c 74  69 70 6c 65 20 69 6e 73
+   6.520206972708961e+252  1.0631441649909905e+248
+   6.520206972708961e+252  1.0631441649909905e+248
+  74 61 6e 63 65 73 20 6f  66 20 6f 6e 65 20 73 69
+  1.9485558745447634e+227   9.150266153944404e+199
+  1.9485558745447634e+227   9.150266153944404e+199
+  67 6e 61 74 75 72 65 20  63 61 6e 20 62 65 20 72
+  1.2796785173062013e-152   5.466447748790696e+241
+  1.2796785173062013e-152   5.466447748790696e+241
+  65 6d 6f 76 65 64 2e 22  5d 2c 0a 5b 5b 5b 22 36
+  4.8678124946851836e-144    6.280137584970692e-48
+  4.8678124946851836e-144    6.280137584970692e-48
+  30 35 36 65 62 64 35 34  39 30 30 33 62 31 30 63
+    3.407962352023387e-57   6.111141374455755e+169
+    3.407962352023387e-57   6.111141374455755e+169
+  62 62 64 39 31 35 63 65  61 30 64 38 32 32 30 39
+   2.490718497226014e+180    3.119251314380846e-33
+   2.490718497226014e+180    3.119251314380846e-33
+  66 65 34 30 62 38 36 31  37 31 30 34 62 65 39 31
+    1.257621481649719e-71    1.437364343991805e-71
+    1.257621481649719e-71    1.437364343991805e-71
+  37 61 32 36 66 61 39 32  63 62 65 33 64 36 66 22
+     9.41413801377804e-67   5.692314056518127e-143
+     9.41413801377804e-67   5.692314056518127e-143
+  2c 20 30 2c 20 22 44 55  50 20 48 41 53 48 31 36
+   5.636682558318743e+102   1.1825180300276534e-47
+   5.636682558318743e+102   1.1825180300276534e-47
+  30 20 30 78 31 34 20 30  78 65 65 35 61 36 61 61
+    6.996971879148275e-77  1.2099562079373234e+161
+    6.996971879148275e-77  1.2099562079373234e+161
+  34 30 66 61 63 65 66 62  32 36 35 35 61 63 32 33
+  1.0317607713876512e+166    4.469924301859015e-62
+  1.0317607713876512e+166    4.469924301859015e-62
+  63 30 63 32 38 63 35 37  63 36 35 63 34 31 66 39
+    9.590520879509977e-43    3.419250666887765e-32
+    9.590520879509977e-43    3.419250666887765e-32
+  62 20 45 51 55 41 4c 56  45 52 49 46 59 20 43 48
+  5.1842624521235244e+107   1.3016727614722294e+40
+  5.1842624521235244e+107   1.3016727614722294e+40
+  45 43 4b 53 49 47 22 5d  5d 2c 0a 22 30 31 30 30
+   4.353390819034962e+140    1.398380563599275e-76
+   4.353390819034962e+140    1.398380563599275e-76
+  30 30 30 30 30 31 36 66  33 64 62 65 32 63 61 39
+  2.3574179032096474e+184    2.678966662524333e-32
+  2.3574179032096474e+184    2.678966662524333e-32
+  36 66 61 32 31 37 65 39  34 62 31 30 31 37 38 36
+   3.2687798886076004e-32   1.6568981987190415e-47
+   3.2687798886076004e-32   1.6568981987190415e-47
+  30 62 65 34 39 66 32 30  38 32 30 64 65 61 35 63
+    1.588995456875629e-76   8.068902760395465e+169
+    1.588995456875629e-76   8.068902760395465e+169
+  39 31 62 64 63 62 31 30  33 62 30 30 34 39 64 35
+   1.5013399635457485e-76   1.6891415740696198e-51
+   1.5013399635457485e-76   1.6891415740696198e-51
+  65 62 35 36 36 30 30 30  30 30 30 30 30 30 66 64
+   1.3980512237335736e-76    4.39026011461906e+175
+   1.3980512237335736e-76    4.39026011461906e+175
+  31 64 30 31 34 37 33 30  34 34 30 32 32 30 33 39
+   1.6594950713380197e-76    3.695525593720251e-33
+   1.6594950713380197e-76    3.695525593720251e-33
+  38 39 61 63 38 66 39 61  64 33 36 62 35 64 30 39
+   2.231821323527007e+160    3.156876429888961e-33
+   2.231821323527007e+160    3.156876429888961e-33
+  31 39 64 39 37 66 61 30  61 37 66 37 30 63 35 32
+   1.2021049291917273e-75    7.933047768224671e-67
+   1.2021049291917273e-75    7.933047768224671e-67
+  37 32 61 62 65 65 33 62  31 34 34 37 37 64 63 36
+  1.1169444352777714e+165   1.0614544399264649e-46
+  1.1169444352777714e+165   1.0614544399264649e-46
+  34 36 32 38 38 61 38 62  39 37 36 64 66 35 30 32
+   1.403935449344396e+165     6.01210151477091e-67
+   1.403935449344396e+165     6.01210151477091e-67
+  32 30 32 37 64 31 39 64  61 38 34 61 30 36 36 61
+   6.230978831429443e+174   1.951726841351776e+160
+   6.230978831429443e+174   1.951726841351776e+160
+  66 39 30 35 33 61 64 33  64 31 64 37 34 35 39 64
+    3.963222106502041e-61   6.234662221635642e+174
+    3.963222106502041e-61   6.234662221635642e+174
+  31 37 31 62 37 65 33 61  38 30 62 63 36 63 34 65
+  1.7042602763455725e+160  3.3046269737330434e+179
+  1.7042602763455725e+160  3.3046269737330434e+179
+  66 37 61 33 33 30 36 37  37 61 36 62 65 35 34 38
+    9.949569426126619e-43    5.938767390291208e-38
+    9.949569426126619e-43    5.938767390291208e-38
+  31 34 30 31 34 37 33 30  34 34 30 32 32 30 33 39
+   1.6594950713342495e-76    3.695525593720251e-33
+   1.6594950713342495e-76    3.695525593720251e-33
+  38 39 61 63 38 66 39 61  64 33 36 62 35 64 30 39
+   2.231821323527007e+160    3.156876429888961e-33
+   2.231821323527007e+160    3.156876429888961e-33
+  31 39 64 39 37 66 61 30  61 37 66 37 30 63 35 32
+   1.2021049291917273e-75    7.933047768224671e-67
+   1.2021049291917273e-75    7.933047768224671e-67
+  37 32 61 62 65 65 33 62  31 34 34 37 37 64 63 36
+  1.1169444352777714e+165   1.0614544399264649e-46
+  1.1169444352777714e+165   1.0614544399264649e-46
+  34 36 32 38 38 61 38 62  39 37 36 64 66 35 30 32
+   1.403935449344396e+165     6.01210151477091e-67
+   1.403935449344396e+165     6.01210151477091e-67
+  32 30 32 37 64 31 39 64  61 38 34 61 30 36 36 61
+   6.230978831429443e+174   1.951726841351776e+160
+   6.230978831429443e+174   1.951726841351776e+160
+  66 39 30 35 33 61 64 33  64 31 64 37 34 35 39 64
+    3.963222106502041e-61   6.234662221635642e+174
+    3.963222106502041e-61   6.234662221635642e+174
+  31 37 31 62 37 65 33 61  38 30 62 63 36 63 34 65
+  1.7042602763455725e+160  3.3046269737330434e+179
+  1.7042602763455725e+160  3.3046269737330434e+179
+  66 37 61 33 33 30 36 37  37 61 36 62 65 35 34 38
+    9.949569426126619e-43    5.938767390291208e-38
+    9.949569426126619e-43    5.938767390291208e-38
+  31 34 30 31 32 31 30 33  38 34 37 39 61 30 66 61
+    3.936099003618453e-62  1.5597863127013106e+161
+    3.936099003618453e-62  1.5597863127013106e+161
+  39 39 38 63 64 33 35 32  35 39 61 32 65 66 30 61
+    7.863795431275355e-67   1.441056711581821e+160
+    7.863795431275355e-67   1.441056711581821e+160
+  37 61 35 63 36 38 36 36  32 63 31 34 37 34 66 38
+   1.5203253503346468e-47    5.220127635822582e-37
+   1.5203253503346468e-47    5.220127635822582e-37
+  38 63 63 62 36 64 30 38  61 37 36 37 37 62 62 65
+    4.817015641252267e-38   2.383851960505475e+180
+    4.817015641252267e-38   2.383851960505475e+180
+  63 37 66 32 32 30 34 31  61 63 34 37 33 30 34 34
+    1.142615359638763e-71    3.216178793930539e-57
+    1.142615359638763e-71    3.216178793930539e-57
+  30 32 32 30 33 37 35 37  65 39 33 37 62 61 38 30
+    9.513415194013424e-43   2.1055328617089243e-76
+    9.513415194013424e-43   2.1055328617089243e-76
+  37 65 34 61 35 64 61 38  35 33 34 63 31 37 66 39
+    4.088707779256948e-37   3.4228547325310674e-32
+    4.088707779256948e-37   3.4228547325310674e-32
+  64 31 32 31 31 37 36 30  35 36 34 30 36 61 36 34
+   1.9185761747028495e-76   3.5652971771390586e-57
+   1.9185761747028495e-76   3.5652971771390586e-57
+  36 35 30 35 34 62 64 64  32 36 30 34 35 37 35 31
+   4.033188983141092e+175   1.2007635521724164e-71
+   4.033188983141092e+175   1.2007635521724164e-71
+  35 63 31 61 30 32 32 30  30 66 30 32 65 63 63 66
+   1.5714416101199814e-76  1.6476548847776302e+185
+   1.5714416101199814e-76  1.6476548847776302e+185
+  31 62 65 63 30 66 33 61  30 64 36 35 64 66 33 37
+  1.7045941370677414e+160    8.699245867306105e-43
+  1.7045941370677414e+160    8.699245867306105e-43
+  38 38 39 31 34 33 63 32  65 38 38 61 62 37 61 63
+    5.697345140337563e-66   5.197907101461614e+170
+    5.697345140337563e-66   5.197907101461614e+170
+  65 63 36 31 61 37 62 36  66 35 61 61 32 36 34 31
+    9.971293261961908e-47   1.1439420336174915e-71
+    9.971293261961908e-47   1.1439420336174915e-71
+  33 39 31 34 31 61 32 62  30 31 32 31 30 33 38 34
+  1.0584127053219288e+165   3.8552751133159866e-57
+  1.0584127053219288e+165   3.8552751133159866e-57
+  37 39 61 30 66 61 39 39  38 63 64 33 35 32 35 39
+    4.888099856699226e-33    4.082225045393815e-33
+    4.888099856699226e-33    4.082225045393815e-33
+  61 32 65 66 30 61 37 61  35 63 36 38 36 36 32 63
+  2.0543555935598498e+160   6.873051613973695e+169
+  2.0543555935598498e+160   6.873051613973695e+169
+  31 34 37 34 66 38 38 63  63 62 36 64 30 38 61 37
+   9.140653800368004e+169    6.177188516960013e-42
+   9.140653800368004e+169    6.177188516960013e-42
+  36 37 37 62 62 65 63 37  66 32 32 30 34 31 66 66
+    6.957985410000452e-42  1.8859395095019228e+185
+    6.957985410000452e-42  1.8859395095019228e+185
+  66 66 66 66 66 66 30 31  30 30 30 30 30 30 30 30
+     9.28207105579738e-72    1.398043286095289e-76
+     9.28207105579738e-72    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 31 36 61 30 30 30 30
+    1.398043286095289e-76   1.3980435384463352e-76
+    1.398043286095289e-76   1.3980435384463352e-76
+  30 30 30 30 22 2c 20 22  50 32 53 48 22 5d 2c 0a
+     2.5902785586997e-144  1.1529705962819529e-259
+     2.5902785586997e-144  1.1529705962819529e-259
+  0a 5b 22 54 68 61 74 20  61 6c 73 6f 20 69 6e 63
+  2.4320751950317006e-152   9.181492387674846e+170
+  2.4320751950317006e-152   9.181492387674846e+170
+  6c 75 64 65 73 20 61 68  65 61 64 20 6f 66 20 74
+   6.251186331310975e+194   2.348409188568246e+251
+   6.251186331310975e+194   2.348409188568246e+251
+  68 65 20 6f 70 63 6f 64  65 20 62 65 69 6e 67 20
+   6.210651257107667e+175  1.3980686977736482e-152
+   6.210651257107667e+175  1.3980686977736482e-152
+  65 78 65 63 75 74 65 64  2e 22 5d 2c 0a 5b 5b 5b
+  4.2451624304093674e+175  1.2135697532664511e+132
+  4.2451624304093674e+175  1.2135697532664511e+132
+  22 35 61 36 62 30 30 32  31 61 36 30 34 32 61 36
+     6.00483331902779e-67    9.412844100329681e-47
+     6.00483331902779e-67    9.412844100329681e-47
+  38 36 62 36 62 39 34 61  62 63 33 36 62 33 38 37
+   1.777084555672755e+160   1.0851976974983893e-42
+   1.777084555672755e+160   1.0851976974983893e-42
+  62 65 66 39 31 30 39 38  34 37 37 37 34 65 38 62
+    7.402161719364674e-38  1.4048317139615952e+165
+    7.402161719364674e-38  1.4048317139615952e+165
+  31 65 35 31 65 62 38 63  63 35 35 63 35 33 39 32
+   9.202564545147949e+169    9.347211880717004e-67
+   9.202564545147949e+169    9.347211880717004e-67
+  31 22 2c 20 31 2c 20 22  44 55 50 20 48 41 53 48
+   2.590315065038038e-144   2.6208557167997654e+40
+   2.590315065038038e-144   2.6208557167997654e+40
+  31 36 30 20 30 78 31 34  20 30 78 65 65 35 61 36
+    2.783049419442401e-57    9.419669740322918e-47
+    2.783049419442401e-57    9.419669740322918e-47
+  61 61 34 30 66 61 63 65  66 62 32 36 35 35 61 63
+  2.5131107314427878e+180   5.195340290775036e+170
+  2.5131107314427878e+180   5.195340290775036e+170
+  32 33 63 30 63 32 38 63  35 37 63 36 35 63 34 31
+   9.131791213993494e+169   1.1538933456093317e-71
+   9.131791213993494e+169   1.1538933456093317e-71
+  66 39 62 20 45 51 55 41  4c 56 45 52 49 46 59 20
+         5588244.50599513    7.54025010721777e-153
+         5588244.50599513    7.54025010721777e-153
+  43 48 45 43 4b 53 49 47  22 5d 5d 2c 0a 22 30 31
+   2.6299364878383027e+35    9.130936148260522e-72
+   2.6299364878383027e+35    9.130936148260522e-72
+  30 30 30 30 30 30 30 31  32 31 33 39 63 35 35 35
+    9.162216479754085e-72    2.214275444353235e-52
+    9.162216479754085e-72    2.214275444353235e-52
+  63 63 62 38 31 65 65 35  62 31 65 38 37 34 37 37
+    1.787017358468745e-51   1.0405018930196217e-42
+    1.787017358468745e-51   1.0405018930196217e-42
+  38 34 30 39 39 31 65 66  37 62 33 38 36 62 63 33
+   1.800963959817824e+185    3.769521461500165e-61
+   1.800963959817824e+185    3.769521461500165e-61
+  61 62 39 34 36 62 36 62  36 38 32 61 30 34 61 36
+  1.2889864308721893e+165    9.417088712476356e-47
+  1.2889864308721893e+165    9.417088712476356e-47
+  32 31 30 30 36 62 35 61  30 31 30 30 30 30 30 30
+   1.878967774122917e+160   1.3980432860953674e-76
+   1.878967774122917e+160   1.3980432860953674e-76
+  66 64 62 34 30 31 34 38  33 30 34 35 30 32 32 30
+    5.933937152528596e-38    1.571441383683764e-76
+    5.933937152528596e-38    1.571441383683764e-76
+  31 37 32 33 65 36 39 32  65 35 66 34 30 39 61 37
+    9.351829215576337e-67    6.178588793077157e-42
+    9.351829215576337e-67    6.178588793077157e-42
+  31 35 31 64 62 33 38 36  32 39 31 62 36 33 35 32
+   1.6558804632916278e-47    7.863535057788706e-67
+   1.6558804632916278e-47    7.863535057788706e-67
+  34 63 35 65 62 32 30 33  30 64 66 36 35 32 62 31
+    3.937227356014145e-62    8.238913178642687e-71
+    3.937227356014145e-62    8.238913178642687e-71
+  66 35 33 30 32 32 66 64  38 32 30 37 33 34 39 66
+   4.391811968107291e+175  2.6773504606057335e+184
+   4.391811968107291e+175  2.6773504606057335e+184
+  30 32 32 31 30 30 62 39  30 64 39 62 62 66 32 66
+    2.802341368335733e-32   1.954581303507793e+184
+    2.802341368335733e-32   1.954581303507793e+184
+  33 33 36 36 63 65 31 37  36 65 35 65 37 38 30 61
+    7.800656411487826e-43  1.4252062672590506e+160
+    7.800656411487826e-43  1.4252062672590506e+160
+  30 30 34 33 33 64 61 36  37 64 39 65 35 63 37 39
+    9.519746433943926e-47    4.504275109156888e-33
+    9.519746433943926e-47    4.504275109156888e-33
+  33 31 32 63 36 33 38 38  33 31 32 61 32 39 36 61
+    7.111755115650218e-38  1.9527592425208904e+160
+    7.111755115650218e-38  1.9527592425208904e+160
+  35 38 30 30 33 39 30 31  34 38 33 30 34 35 30 32
+    9.182140120614816e-72    6.011817374894185e-67
+    9.182140120614816e-72    6.011817374894185e-67
+  32 30 31 37 32 33 65 36  39 32 65 35 66 34 30 39
+   1.1604494685549871e-46   3.1209087270223586e-33
+   1.1604494685549871e-46   3.1209087270223586e-33
+  61 37 31 35 31 64 62 33  38 36 32 39 31 62 36 33
+   3.5765566532097824e-61    5.441142898141567e-62
+   3.5765566532097824e-61    5.441142898141567e-62
+  35 32 34 63 35 65 62 32  30 33 30 64 66 36 35 32
+     5.45857040622319e-66    7.868153498247702e-67
+     5.45857040622319e-66    7.868153498247702e-67
+  62 31 66 35 33 30 32 32  66 64 38 32 30 37 33 34
+    6.746408516914286e-67    3.061218373586445e-57
+    6.746408516914286e-67    3.061218373586445e-57
+  39 66 30 32 32 31 30 30  62 39 30 64 39 62 62 66
+   1.3983832822783174e-76   1.562284042105233e+185
+   1.3983832822783174e-76   1.562284042105233e+185
+  32 66 33 33 36 36 63 65  31 37 36 65 35 65 37 38
+   2.491234875250896e+180    6.875274264196059e-38
+   2.491234875250896e+180    6.875274264196059e-38
+  30 61 30 30 34 33 33 64  61 36 37 64 39 65 35 63
+   4.748747437857496e+174   8.074546198475854e+169
+   4.748747437857496e+174   8.074546198475854e+169
+  37 39 33 31 32 63 36 33  38 38 33 31 32 61 32 39
+    5.442096048266862e-62   3.5397960907791054e-33
+    5.442096048266862e-62   3.5397960907791054e-33
+  36 61 35 38 30 30 33 39  30 31 32 31 30 33 38 34
+   3.6955197853572105e-33   3.8552751133159866e-57
+   3.6955197853572105e-33   3.8552751133159866e-57
+  37 39 61 30 66 61 39 39  38 63 64 33 35 32 35 39
+    4.888099856699226e-33    4.082225045393815e-33
+    4.888099856699226e-33    4.082225045393815e-33
+  61 32 65 66 30 61 37 61  35 63 36 38 36 36 32 63
+  2.0543555935598498e+160   6.873051613973695e+169
+  2.0543555935598498e+160   6.873051613973695e+169
+  31 34 37 34 66 38 38 63  63 62 36 64 30 38 61 37
+   9.140653800368004e+169    6.177188516960013e-42
+   9.140653800368004e+169    6.177188516960013e-42
+  36 37 37 62 62 65 63 37  66 32 32 30 34 31 34 38
+    6.957985410000452e-42    5.933955015786359e-38
+    6.957985410000452e-42    5.933955015786359e-38
+  33 30 34 35 30 32 32 30  31 37 32 33 65 36 39 32
+    1.571441383683764e-76    9.351829215576337e-67
+    1.571441383683764e-76    9.351829215576337e-67
+  65 35 66 34 30 39 61 37  31 35 31 64 62 33 38 36
+    6.178588793077157e-42   1.6558804632916278e-47
+    6.178588793077157e-42   1.6558804632916278e-47
+  32 39 31 62 36 33 35 32  34 63 35 65 62 32 30 33
+    7.863535057788706e-67    3.937227356014145e-62
+    7.863535057788706e-67    3.937227356014145e-62
+  30 64 66 36 35 32 62 31  66 35 33 30 32 32 66 64
+    8.238913178642687e-71   4.391811968107291e+175
+    8.238913178642687e-71   4.391811968107291e+175
+  38 32 30 37 33 34 39 66  30 32 32 31 30 30 62 39
+  2.6773504606057335e+184    2.802341368335733e-32
+  2.6773504606057335e+184    2.802341368335733e-32
+  30 64 39 62 62 66 32 66  33 33 36 36 63 65 31 37
+   1.954581303507793e+184    7.800656411487826e-43
+   1.954581303507793e+184    7.800656411487826e-43
+  36 65 35 65 37 38 30 61  30 30 34 33 33 64 61 36
+  1.4252062672590506e+160    9.519746433943926e-47
+  1.4252062672590506e+160    9.519746433943926e-47
+  37 64 39 65 35 63 37 39  33 31 32 63 36 33 38 38
+    4.504275109156888e-33    7.111755115650218e-38
+    4.504275109156888e-33    7.111755115650218e-38
+  33 31 32 61 32 39 36 61  35 38 30 30 33 39 30 31
+  1.9527592425208904e+160    9.182140120614816e-72
+  1.9527592425208904e+160    9.182140120614816e-72
+  37 35 61 63 34 38 33 30  34 35 30 32 32 30 36 34
+   1.6598326800316675e-76    3.534794697658789e-57
+   1.6598326800316675e-76    3.534794697658789e-57
+  36 62 37 32 63 33 35 62  65 65 65 63 35 31 66 34
+  1.2208674212277602e+165    2.828339807230628e-56
+  1.2208674212277602e+165    2.828339807230628e-56
+  64 35 62 63 31 63 62 61  65 30 31 38 36 33 38 32
+  1.2925570784679092e+161     8.97629597443112e-67
+  1.2925570784679092e+161     8.97629597443112e-67
+  35 37 35 30 64 37 66 34  39 30 38 36 34 61 66 33
+   2.8314178662520422e-56    4.352163540685157e-61
+   2.8314178662520422e-56    4.352163540685157e-61
+  35 34 65 36 65 61 34 66  36 32 35 65 39 63 30 32
+  2.1649663280542705e+184    6.078496643837522e-67
+  2.1649663280542705e+184    6.078496643837522e-67
+  32 31 30 30 66 30 34 62  39 38 34 33 32 64 66 33
+  1.1626091167095078e+165    4.354436507260792e-61
+  1.1626091167095078e+165    4.354436507260792e-61
+  61 39 36 34 31 37 31 39  64 62 63 65 64 35 33 33
+   3.3156029040274406e-33    4.669343050227855e-62
+   3.3156029040274406e-33    4.669343050227855e-62
+  39 33 30 32 32 65 37 32  34 39 66 62 35 39 64 62
+    8.677798020058338e-67   9.316725954004083e+165
+    8.677798020058338e-67   9.316725954004083e+165
+  39 39 33 61 66 31 31 31  38 35 33 39 38 33 30 61
+    9.730875287849455e-72  1.4234911781333594e+160
+    9.730875287849455e-72  1.4234911781333594e+160
+  61 62 38 37 30 31 34 38  33 30 34 35 30 32 32 30
+    5.933937202202992e-38    1.571441383683764e-76
+    5.933937202202992e-38    1.571441383683764e-76
+  31 37 32 33 65 36 39 32  65 35 66 34 30 39 61 37
+    9.351829215576337e-67    6.178588793077157e-42
+    9.351829215576337e-67    6.178588793077157e-42
+  31 35 31 64 62 33 38 36  32 39 31 62 36 33 35 32
+   1.6558804632916278e-47    7.863535057788706e-67
+   1.6558804632916278e-47    7.863535057788706e-67
+  34 63 35 65 62 32 30 33  30 64 66 36 35 32 62 31
+    3.937227356014145e-62    8.238913178642687e-71
+    3.937227356014145e-62    8.238913178642687e-71
+  66 35 33 30 32 32 66 64  38 32 30 37 33 34 39 66
+   4.391811968107291e+175  2.6773504606057335e+184
+   4.391811968107291e+175  2.6773504606057335e+184
+  30 32 32 31 30 30 62 39  30 64 39 62 62 66 32 66
+    2.802341368335733e-32   1.954581303507793e+184
+    2.802341368335733e-32   1.954581303507793e+184
+  33 33 36 36 63 65 31 37  36 65 35 65 37 38 30 61
+    7.800656411487826e-43  1.4252062672590506e+160
+    7.800656411487826e-43  1.4252062672590506e+160
+  30 30 34 33 33 64 61 36  37 64 39 65 35 63 37 39
+    9.519746433943926e-47    4.504275109156888e-33
+    9.519746433943926e-47    4.504275109156888e-33
+  33 31 32 63 36 33 38 38  33 31 32 61 32 39 36 61
+    7.111755115650218e-38  1.9527592425208904e+160
+    7.111755115650218e-38  1.9527592425208904e+160
+  35 38 30 30 33 39 30 31  37 35 32 31 30 33 38 34
+    9.182140120614816e-72     3.85527511331657e-57
+    9.182140120614816e-72     3.85527511331657e-57
+  37 39 61 30 66 61 39 39  38 63 64 33 35 32 35 39
+    4.888099856699226e-33    4.082225045393815e-33
+    4.888099856699226e-33    4.082225045393815e-33
+  61 32 65 66 30 61 37 61  35 63 36 38 36 36 32 63
+  2.0543555935598498e+160   6.873051613973695e+169
+  2.0543555935598498e+160   6.873051613973695e+169
+  31 34 37 34 66 38 38 63  63 62 36 64 30 38 61 37
+   9.140653800368004e+169    6.177188516960013e-42
+   9.140653800368004e+169    6.177188516960013e-42
+  36 37 37 62 62 65 63 37  66 32 32 30 34 31 66 66
+    6.957985410000452e-42  1.8859395095019228e+185
+    6.957985410000452e-42  1.8859395095019228e+185
+  66 66 66 66 66 66 30 31  30 30 30 30 30 30 30 30
+     9.28207105579738e-72    1.398043286095289e-76
+     9.28207105579738e-72    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 31 36 61 30 30 30 30
+    1.398043286095289e-76   1.3980435384463352e-76
+    1.398043286095289e-76   1.3980435384463352e-76
+  30 30 30 30 22 2c 20 22  50 32 53 48 22 5d 2c 0a
+     2.5902785586997e-144  1.1529705962819529e-259
+     2.5902785586997e-144  1.1529705962819529e-259
+  0a 5b 22 46 69 6e 61 6c  6c 79 20 43 48 45 43 4b
+  1.1736444749763735e+214   3.6915200620890535e+54
+  1.1736444749763735e+214   3.6915200620890535e+54
+  4d 55 4c 54 49 53 49 47  20 72 65 6d 6f 76 65 73
+   2.6299334241071866e+35    7.50325220029215e+247
+   2.6299334241071866e+35    7.50325220029215e+247
+  20 61 6c 6c 20 73 69 67  6e 61 74 75 72 65 73 20
+  1.4173926580919855e+190  2.3146247743573184e-152
+  1.4173926580919855e+190  2.3146247743573184e-152
+  70 72 69 6f 72 20 74 6f  20 68 61 73 68 69 6e 67
+   7.628695684951427e+228  1.6937476030430999e+190
+   7.628695684951427e+228  1.6937476030430999e+190
+  20 74 68 65 20 73 63 72  69 70 74 20 63 6f 6e 74
+  1.0375277400298696e+243   6.973024681642683e+252
+  1.0375277400298696e+243   6.973024681642683e+252
+  61 69 6e 69 6e 67 20 74  68 6f 73 65 20 73 69 67
+  2.3489669805791434e+251  1.4173926349461924e+190
+  2.3489669805791434e+251  1.4173926349461924e+190
+  6e 61 74 75 72 65 73 2e  20 49 6e 20 63 6f 6e 6a
+    6.240216047113889e-85   4.771137098449688e+204
+    6.240216047113889e-85   4.771137098449688e+204
+  75 6e 63 74 69 6f 6e 20  77 69 74 68 20 74 68 65
+  1.8159689052330482e-152  3.1709585893991644e+180
+  1.8159689052330482e-152  3.1709585893991644e+180
+  20 53 49 47 48 41 53 48  5f 53 49 4e 47 4c 45 20
+   2.6208560329832514e+40  3.1769493046950853e-153
+   2.6208560329832514e+40  3.1769493046950853e-153
+  62 75 67 20 74 68 69 73  20 6c 65 74 73 20 75 73
+    8.88254271743507e+247  1.4771662558391635e+248
+    8.88254271743507e+247  1.4771662558391635e+248
+  20 74 65 73 74 20 77 68  65 74 68 65 72 20 6f 72
+   1.688232740363094e+195  1.6604287084127238e+243
+   1.688232740363094e+195  1.6604287084127238e+243
+  20 6e 6f 74 20 46 69 6e  64 41 6e 64 44 65 6c 65
+   7.308691332761312e+223  3.6821212456294824e+180
+   7.308691332761312e+223  3.6821212456294824e+180
+  74 65 28 29 20 69 73 20  61 63 74 75 61 6c 6c 79
+   2.316339504368665e-152   7.872659721135078e+276
+   2.316339504368665e-152   7.872659721135078e+276
+  20 70 72 65 73 65 6e 74  20 69 6e 20 73 63 72 69
+   6.964131901691083e+252   8.797167525395842e+199
+   6.964131901691083e+252   8.797167525395842e+199
+  70 74 50 75 62 4b 65 79  2f 72 65 64 65 65 6d 53
+   5.898110305601355e+276    7.664751258427263e+93
+   5.898110305601355e+276    7.664751258427263e+93
+  63 72 69 70 74 20 65 76  61 6c 75 61 74 69 6f 6e
+   2.078928165435058e+262   9.083672029157303e+223
+   2.078928165435058e+262   9.083672029157303e+223
+  20 62 79 20 69 6e 63 6c  75 64 69 6e 67 20 61 20
+   1.308303802920017e+214  1.0218868483684354e-152
+   1.308303802920017e+214  1.0218868483684354e-152
+  73 69 67 6e 61 74 75 72  65 20 6f 66 20 74 68 65
+  2.2889545656788252e+243   3.170958573781438e+180
+  2.2889545656788252e+243   3.170958573781438e+180
+  20 64 69 67 65 73 74 20  30 78 30 31 20 57 65 20
+  2.4404605028198146e-152  1.2733079157857023e-152
+  2.4404605028198146e-152  1.2733079157857023e-152
+  63 61 6e 20 63 6f 6d 70  75 74 65 20 69 6e 20 61
+  3.6558828067567588e+233   7.219039497909827e+159
+  3.6558828067567588e+233   7.219039497909827e+159
+  64 76 61 6e 63 65 20 66  6f 72 20 6f 75 72 20 70
+   8.708564263498483e+183  1.2767213575024473e+232
+   8.708564263498483e+183  1.2767213575024473e+232
+  75 62 6b 65 79 2c 20 65  6d 62 65 64 20 69 74 20
+  1.3108033883033562e+179  2.4356733774192452e-152
+  1.3108033883033562e+179  2.4356733774192452e-152
+  69 74 20 69 6e 20 74 68  65 20 73 63 72 69 70 74
+   1.469228862771047e+195   7.520302005152578e+252
+   1.469228862771047e+195   7.520302005152578e+252
+  50 75 62 4b 65 79 2c 20  61 6e 64 20 74 68 65 6e
+  1.0618514983861973e-153   6.190751008345659e+223
+  1.0618514983861973e-153   6.190751008345659e+223
+  20 61 6c 73 6f 20 75 73  69 6e 67 20 61 20 6e 6f
+  1.4771619842556732e+248  5.7094614764538784e+228
+  1.4771619842556732e+248  5.7094614764538784e+228
+  72 6d 61 6c 20 53 49 47  48 41 53 48 5f 41 4c 4c
+    2.629868606076759e+35   3.5472354041135396e+59
+    2.629868606076759e+35   3.5472354041135396e+59
+  20 73 69 67 6e 61 74 75  72 65 2e 20 49 66 20 46
+   6.120305160691695e+257     6.49653237393213e+29
+   6.120305160691695e+257     6.49653237393213e+29
+  69 6e 64 41 6e 64 44 65  6c 65 74 65 28 29 20 77
+   6.610796632369195e+179    6.51370835056463e+265
+   6.610796632369195e+179    6.51370835056463e+265
+  61 73 6e 27 74 20 72 75  6e 2c 20 74 68 65 20 27
+   5.443481944736042e+257   3.174775072085501e-120
+   5.443481944736042e+257   3.174775072085501e-120
+  62 75 67 67 65 64 27 20  73 69 67 6e 61 74 75 72
+   8.723339573213214e-154  2.2889545656788252e+243
+   8.723339573213214e-154  2.2889545656788252e+243
+  65 20 77 6f 75 6c 64 20  73 74 69 6c 6c 20 62 65
+  1.2186133350888258e-152  2.3505260840773397e+180
+  1.2186133350888258e-152  2.3505260840773397e+180
+  20 69 6e 20 74 68 65 20  68 61 73 68 65 64 20 73
+  1.2773465768272543e-152   3.581648630765609e+246
+  1.2773465768272543e-152   3.581648630765609e+246
+  63 72 69 70 74 2c 20 61  6e 64 20 74 68 65 20 6e
+   7.105846174839622e+159   2.963384711095348e+222
+   7.105846174839622e+159   2.963384711095348e+222
+  6f 72 6d 61 6c 20 73 69  67 6e 61 74 75 72 65 20
+    9.15031688239394e+199  1.2796785173062013e-152
+    9.15031688239394e+199  1.2796785173062013e-152
+  77 6f 75 6c 64 20 66 61  69 6c 2e 22 5d 2c 0a 0a
+   1.555396274778208e+161  2.6598195744325212e-260
+   1.555396274778208e+161  2.6598195744325212e-260
+  5b 22 48 65 72 65 27 73  20 61 6e 20 65 78 61 6d
+   5.112027915992619e+246   7.708804921016175e+218
+   5.112027915992619e+246   7.708804921016175e+218
+  70 6c 65 20 6f 6e 20 6d  61 69 6e 6e 65 74 20 77
+   4.531489784665793e+217   6.632166755338667e+265
+   4.531489784665793e+217   6.632166755338667e+265
+  69 74 68 69 6e 20 61 20  50 32 53 48 20 72 65 64
+  1.0218932036672254e-152  4.2433596666853416e+175
+  1.0218932036672254e-152  4.2433596666853416e+175
+  65 65 6d 53 63 72 69 70  74 2e 20 52 65 6d 61 72
+  3.1605328804557394e+233    9.29645358784197e+242
+  3.1605328804557394e+233    9.29645358784197e+242
+  6b 61 62 6c 79 20 69 74  27 73 20 61 20 73 74 61
+   5.756844178873664e+252  2.8750467219498656e+161
+   5.756844178873664e+252  2.8750467219498656e+161
+  6e 64 61 72 64 20 74 72  61 6e 73 61 63 74 69 6f
+  2.1472641680666894e+243  4.8240712098384304e+228
+  2.1472641680666894e+243  4.8240712098384304e+228
+  6e 20 69 6e 20 3c 30 2e  39 22 5d 2c 0a 5b 5b 5b
+   3.2644502958354345e-86  1.2135697532664528e+132
+   3.2644502958354345e-86  1.2135697532664528e+132
+  22 62 35 62 35 39 38 64  65 39 31 37 38 37 34 33
+   5.991200762860149e+174    4.914164823660884e-62
+   5.991200762860149e+174    4.914164823660884e-62
+  39 61 66 64 35 39 33 38  31 31 36 36 35 34 65 30
+    5.649270376266173e-38   1.4649661880532235e-75
+    5.649270376266173e-38   1.4649661880532235e-75
+  62 31 36 62 37 61 30 64  30 66 38 32 37 34 32 62
+   4.051210474276955e+174  1.0482954146802228e+165
+   4.051210474276955e+174  1.0482954146802228e+165
+  61 33 37 35 36 34 32 31  39 63 35 61 66 63 62 66
+   1.0303071787818424e-71   1.562674340819617e+185
+   1.0303071787818424e-71   1.562674340819617e+185
+  39 22 2c 20 30 2c 20 22  44 55 50 20 48 41 53 48
+   2.590312621088952e-144   2.6208557167997654e+40
+   2.590312621088952e-144   2.6208557167997654e+40
+  31 36 30 20 30 78 31 34  20 30 78 66 36 66 33 36
+    2.783049419442401e-57   1.3273517515652528e-47
+    2.783049419442401e-57   1.3273517515652528e-47
+  35 63 34 30 66 30 37 33  39 62 36 31 64 65 38 32
+    5.636948051351569e-62    9.049001603523728e-67
+    5.636948051351569e-62    9.049001603523728e-67
+  37 61 34 34 37 35 31 65  35 65 39 39 30 33 32 65
+  2.7892320074193853e+179  2.9500388630411594e+179
+  2.7892320074193853e+179  2.9500388630411594e+179
+  64 38 66 20 45 51 55 41  4c 56 45 52 49 46 59 20
+       5588244.5062390305    7.54025010721777e-153
+       5588244.5062390305    7.54025010721777e-153
+  43 48 45 43 4b 53 49 47  22 5d 2c 0a 20 20 5b 22
+   2.6299364878383027e+35   3.475678896031518e-143
+   2.6299364878383027e+35   3.475678896031518e-143
+  61 62 39 38 30 35 63 36  64 35 37 64 37 30 37 30
+   1.0513990012723902e-46   2.0025845771892572e-76
+   1.0513990012723902e-46   2.0025845771892572e-76
+  64 39 61 34 32 63 35 31  37 36 65 34 37 62 62 37
+   1.2104887422281823e-71    6.594812753653255e-42
+   1.2104887422281823e-71    6.594812753653255e-42
+  30 35 30 32 33 65 36 62  36 37 32 34 39 66 62 36
+  1.2896586248712345e+165   1.0071455216820394e-46
+  1.2896586248712345e+165   1.0071455216820394e-46
+  37 36 30 38 38 30 35 34  38 32 39 38 65 37 34 32
+   3.3755001487111544e-57     7.49867516003105e-67
+   3.3755001487111544e-57     7.49867516003105e-67
+  22 2c 20 30 2c 20 22 48  41 53 48 31 36 30 20 30
+    3.083923668804203e+39    6.990255991883209e-77
+    3.083923668804203e+39    6.990255991883209e-77
+  78 31 34 20 30 78 64 38  64 61 63 64 61 64 62 37
+    4.812352641506509e-37    6.597846277299896e-42
+    4.812352641506509e-37    6.597846277299896e-42
+  34 36 32 61 65 31 35 63  64 39 30 36 66 31 38 37
+   7.998140897623461e+169   1.0848501097603372e-42
+   7.998140897623461e+169   1.0848501097603372e-42
+  38 37 30 36 64 30 64 61  38 36 36 30 65 36 20 45
+   1.419198461811542e+161    9.799843749542125e+24
+   1.419198461811542e+161    9.799843749542125e+24
+  51 55 41 4c 22 5d 5d 2c  0a 22 30 31 30 30 30 30
+   5.4988731860599135e-95   1.3980432912417352e-76
+   5.4988731860599135e-95   1.3980432912417352e-76
+  30 30 30 32 66 39 63 62  61 66 63 35 31 39 34 32
+   8.856380305693154e+165    7.501278605085225e-67
+   8.856380305693154e+165    7.501278605085225e-67
+  35 36 33 37 62 61 34 32  32 37 66 38 64 30 61 30
+    7.559512321417077e-67   1.1875788305597507e-75
+    7.559512321417077e-67   1.1875788305597507e-75
+  62 37 31 36 30 62 34 65  36 35 31 36 38 31 39 33
+   3.303978531472527e+179    6.123900139980671e-62
+   3.303978531472527e+179    6.123900139980671e-62
+  64 35 61 66 33 39 37 34  37 38 39 31 64 65 39 38
+    3.699707528974513e-57    7.463231284257777e-38
+    3.699707528974513e-57    7.463231284257777e-38
+  62 35 62 35 30 30 30 30  30 30 30 30 36 62 34 38
+   1.3980433128388672e-76    5.990213225355863e-38
+   1.3980433128388672e-76    5.990213225355863e-38
+  33 30 34 35 30 32 32 31  30 30 38 64 64 36 31 39
+   1.0298598252109915e-71    3.315001014273694e-33
+   1.0298598252109915e-71    3.315001014273694e-33
+  63 35 36 33 65 35 32 37  63 34 37 64 39 62 64 35
+    8.165007616585545e-43   1.7025250796067452e-51
+    8.165007616585545e-43   1.7025250796067452e-51
+  33 35 33 34 61 37 37 30  62 31 30 32 65 34 30 66
+    2.005001128904533e-76  1.7213830871031352e+184
+    2.005001128904533e-76  1.7213830871031352e+184
+  61 61 38 37 66 36 31 34  33 33 35 38 30 65 30 34
+    2.742109004038087e-57   2.6119167273798724e-57
+    2.742109004038087e-57   2.6119167273798724e-57
+  65 32 37 31 65 66 32 66  39 36 30 32 32 30 30 32
+  1.9545858559158178e+184    6.004561555989705e-67
+  1.9545858559158178e+184    6.004561555989705e-67
+  39 38 38 36 34 33 34 65  31 38 31 32 32 62 35 33
+   3.274229631047643e+179    5.198059971576499e-62
+   3.274229631047643e+179    5.198059971576499e-62
+  64 35 64 65 63 64 32 35  66 31 66 34 61 63 62 32
+    1.920229186768246e-52    5.456450549489954e-66
+    1.920229186768246e-52    5.456450549489954e-66
+  34 38 30 36 35 39 66 65  61 32 30 61 61 62 64 38
+   2.881769602268154e+180     4.79232552185636e-37
+   2.881769602268154e+180     4.79232552185636e-37
+  35 36 39 38 37 62 61 33  63 33 39 30 37 65 30 31
+    3.380585974262651e-61    9.279452469077136e-72
+    3.380585974262651e-61    9.279452469077136e-72
+  32 31 30 32 32 62 37 38  62 37 35 36 65 32 32 35
+    6.871816086884967e-38   1.8998405028655374e-52
+    6.871816086884967e-38   1.8998405028655374e-52
+  38 61 66 31 33 37 37 39  63 31 61 31 66 33 37 65
+    4.471166715852598e-33   3.760624605216219e+179
+    4.471166715852598e-33   3.760624605216219e+179
+  61 36 38 30 30 32 35 39  37 31 36 63 61 34 62 37
+    4.082210315295236e-33    6.530583925855894e-42
+    4.082210315295236e-33    6.530583925855894e-42
+  66 30 62 38 37 36 31 30  65 30 62 66 33 61 62 35
+   1.4864383402603935e-76   1.5351433839541485e-51
+   1.4864383402603935e-76   1.5351433839541485e-51
+  32 61 30 31 66 66 66 66  66 66 66 66 34 32 65 37
+  1.9035982967241127e+185    7.603732295705873e-42
+  1.9035982967241127e+185    7.603732295705873e-42
+  39 38 38 32 35 34 38 30  30 38 37 36 62 36 39 66
+      2.0902927711699e-76  2.6782565400739568e+184
+      2.0902927711699e-76  2.6782565400739568e+184
+  32 34 36 37 36 62 33 65  30 32 30 35 62 37 37 62
+  3.1419029292367737e+179  1.3369385286337008e+165
+  3.1419029292367737e+179  1.3369385286337008e+165
+  65 34 37 36 35 31 32 63  61 34 64 39 37 30 37 30
+   6.865674790085722e+169   2.0025843567490455e-76
+   6.865674790085722e+169   2.0025843567490455e-76
+  37 64 64 35 63 36 30 35  39 38 61 62 30 30 30 30
+   1.6926588947465104e-52   1.3980435444590742e-76
+   1.6926588947465104e-52   1.3980435444590742e-76
+  30 30 30 30 66 64 32 36  30 31 30 30 34 38 33 30
+   1.2584443150071403e-47   1.6598324165206394e-76
+   1.2584443150071403e-47   1.6598324165206394e-76
+  34 35 30 32 32 30 31 35  62 64 30 31 33 39 62 63
+    1.794538695617782e-52   5.501965433898013e+170
+    1.794538695617782e-52   5.501965433898013e+170
+  63 63 66 39 39 30 61 36  61 66 36 65 63 35 63 31
+    9.408609738499396e-47    8.697322268925005e-71
+    9.408609738499396e-47    8.697322268925005e-71
+  63 35 32 65 64 38 32 32  32 65 30 33 61 30 64 35
+    6.758278173029908e-67   1.6862625533032855e-51
+    6.758278173029908e-67   1.6862625533032855e-51
+  31 63 33 33 34 64 66 31  33 39 39 36 38 35 32 35
+   1.0138476365136342e-70   1.9009923084146932e-52
+   1.0138476365136342e-70   1.9009923084146932e-52
+  64 32 66 63 64 32 30 32  32 31 30 30 39 66 39 65
+    6.007743451249364e-67  4.1169856560600985e+179
+    6.007743451249364e-67  4.1169856560600985e+179
+  66 65 33 32 35 34 37 36  65 62 36 34 63 33 39 35
+   1.5876777771112044e-47    2.631079236209162e-52
+   1.5876777771112044e-47    2.631079236209162e-52
+  38 65 34 37 31 33 65 39  65 65 66 65 34 39 62 66
+   3.2663725204804295e-32  1.5486671535584227e+185
+   3.2663725204804295e-32  1.5486671535584227e+185
+  31 64 38 32 30 65 64 35  38 64 32 31 31 32 37 32
+    1.703492156117652e-51    8.603897997056349e-67
+    1.703492156117652e-51    8.603897997056349e-67
+  31 62 31 33 34 65 32 61  31 61 35 33 30 33 34 39
+  1.6163865977979844e+160    3.890369671552324e-33
+  1.6163865977979844e+160    3.890369671552324e-33
+  33 30 34 36 30 32 32 31  30 30 38 34 33 31 62 64
+   1.0298598285844949e-71    3.59958484246263e+175
+   1.0298598285844949e-71    3.59958484246263e+175
+  66 61 37 32 62 63 36 37  66 39 64 34 31 66 65 37
+   1.0039223759181721e-42    7.676582325096771e-42
+   1.0039223759181721e-42    7.676582325096771e-42
+  32 65 39 34 63 38 38 66  62 38 66 33 35 39 66 66
+  2.5728604529193965e+184  1.8885965124149588e+185
+  2.5728604529193965e+184  1.8885965124149588e+185
+  61 33 30 62 33 33 63 37  32 63 31 32 31 63 35 61
+    6.887663216558359e-42   1.879304320601263e+160
+    6.887663216558359e-42   1.879304320601263e+160
+  38 37 37 64 39 32 32 65  31 30 30 32 32 31 30 30
+  2.9494283723050457e+179   1.3983832822740735e-76
+  2.9494283723050457e+179   1.3983832822740735e-76
+  38 39 65 66 35 66 63 32  32 64 64 38 62 66 63 36
+    5.756466081648164e-66   1.0619180014326608e-46
+    5.756466081648164e-66   1.0619180014326608e-46
+  62 66 39 66 66 64 62 30  31 61 39 38 36 32 64 32
+   1.2707042500513325e-75    5.992931684968716e-66
+   1.2707042500513325e-75    5.992931684968716e-66
+  37 36 38 37 64 34 32 34  64 31 66 65 66 62 61 62
+     2.90016873035882e-57   8.008786353012615e+165
+     2.90016873035882e-57   8.008786353012615e+165
+  39 65 39 63 37 31 37 36  38 34 34 61 31 38 37 61
+   1.5868782357286304e-47  2.0402840719479214e+160
+   1.5868782357286304e-47  2.0402840719479214e+160
+  30 31 34 63 39 30 35 32  34 38 33 30 34 35 30 32
+    7.859205333594117e-67    6.011817374894185e-67
+    7.859205333594117e-67    6.011817374894185e-67
+  32 30 31 35 62 64 30 31  33 39 62 63 63 63 66 39
+    9.277613132794206e-72    3.449453820352483e-32
+    9.277613132794206e-72    3.449453820352483e-32
+  39 30 61 36 61 66 36 65  63 35 63 31 63 35 32 65
+  3.6308132923096075e+179   2.951431257488717e+179
+  3.6308132923096075e+179   2.951431257488717e+179
+  64 38 32 32 32 65 30 33  61 30 64 35 31 63 33 33
+    3.985475970499615e-62    4.712832796914053e-62
+    3.985475970499615e-62    4.712832796914053e-62
+  34 64 66 31 33 39 39 36  38 35 32 35 64 32 66 63
+   1.7258576212596283e-47   6.701603676645425e+170
+   1.7258576212596283e-47   6.701603676645425e+170
+  64 32 30 32 32 31 30 30  39 66 39 65 66 65 33 32
+   1.3983832822742463e-76    7.194410997686058e-67
+   1.3983832822742463e-76    7.194410997686058e-67
+  35 34 37 36 65 62 36 34  63 33 39 35 38 65 34 37
+   3.5660337864223545e-57    9.145608692886007e-43
+   3.5660337864223545e-57    9.145608692886007e-43
+  31 33 65 39 65 65 66 65  34 39 62 66 31 64 38 32
+  2.9041520390666582e+180    9.047265220641904e-67
+  2.9041520390666582e+180    9.047265220641904e-67
+  30 65 64 35 38 64 32 31  31 32 37 32 31 62 31 33
+    1.040921030531616e-71    4.225710125542807e-62
+    1.040921030531616e-71    4.225710125542807e-62
+  34 65 32 61 31 61 35 33  30 33 32 31 30 33 37 38
+    5.197107386649389e-62    6.817853747203122e-38
+    5.197107386649389e-62    6.817853747203122e-38
+  64 34 33 30 32 37 34 66  38 63 35 65 63 31 33 32
+  2.1474556573079126e+184    7.119050768005487e-67
+  2.1474556573079126e+184    7.119050768005487e-67
+  31 33 33 38 31 35 31 65  39 66 32 37 66 34 63 36
+   2.789217206196148e+179   1.0512302796483916e-46
+   2.789217206196148e+179   1.0512302796483916e-46
+  37 36 61 30 30 38 62 64  66 38 36 33 38 64 30 37
+   3.604986092200413e+175     7.35019498170337e-43
+   3.604986092200413e+175     7.35019498170337e-43
+  63 30 62 36 62 65 39 61  62 33 35 63 37 31 32 31
+  2.2315341607729353e+160    1.029644939808465e-71
+  2.2315341607729353e+160    1.029644939808465e-71
+  30 33 37 38 64 34 33 30  32 37 34 66 38 63 35 65
+   1.6585463096929366e-76   3.466722399499524e+179
+   1.6585463096929366e-76   3.466722399499524e+179
+  63 31 33 32 31 33 33 38  31 35 31 65 39 66 32 37
+    5.642363898120093e-38    8.250537423168746e-43
+    5.642363898120093e-38    8.250537423168746e-43
+  66 34 63 36 37 36 61 30  30 38 62 64 66 38 36 33
+   1.1891506639885601e-75    5.401458727283222e-62
+   1.1891506639885601e-75    5.401458727283222e-62
+  38 64 30 37 63 30 62 36  62 65 39 61 62 33 35 63
+     9.95634267935969e-47   8.001072030570161e+169
+     9.95634267935969e-47   8.001072030570161e+169
+  37 31 35 33 61 65 66 66  66 66 66 66 66 66 30 31
+  1.9032598620864028e+185     9.28207105579738e-72
+  1.9032598620864028e+185     9.28207105579738e-72
+  61 30 38 36 30 31 30 30  30 30 30 30 30 30 30 30
+    1.398380667475694e-76    1.398043286095289e-76
+    1.398380667475694e-76    1.398043286095289e-76
+  31 37 61 39 31 34 64 38  64 61 63 64 61 64 62 37
+    4.749908444232204e-37    6.597846277299896e-42
+    4.749908444232204e-37    6.597846277299896e-42
+  34 36 32 61 65 31 35 63  64 39 30 36 66 31 38 37
+   7.998140897623461e+169   1.0848501097603372e-42
+   7.998140897623461e+169   1.0848501097603372e-42
+  38 37 30 36 64 30 64 61  38 36 36 30 65 36 38 37
+   1.419198461811542e+161   1.0857252210986998e-42
+   1.419198461811542e+161   1.0857252210986998e-42
+  30 30 30 30 30 30 30 30  22 2c 20 22 50 32 53 48
+    1.398043286095289e-76    2.612896978874658e+40
+    1.398043286095289e-76    2.612896978874658e+40
+  22 5d 2c 0a 0a 5b 22 53  61 6d 65 20 69 64 65 61
+   2.9912849814772217e+92  1.5037780407997548e+161
+   2.9912849814772217e+92  1.5037780407997548e+161
+  2c 20 62 75 74 20 77 69  74 68 20 62 61 72 65 20
+  1.1064002143903389e+200   1.279660243547755e-152
+  1.1064002143903389e+200   1.279660243547755e-152
+  43 48 45 43 4b 4d 55 4c  54 49 53 49 47 22 5d 2c
+    5.348575187649885e+59    5.455819675795615e-95
+    5.348575187649885e+59    5.455819675795615e-95
+  0a 5b 5b 5b 22 63 65 61  66 65 35 38 65 30 66 36
+  1.5034275395859241e+161      1.2145888267911e-46
+  1.5034275395859241e+161      1.2145888267911e-46
+  65 37 64 36 37 63 30 34  30 39 66 62 62 66 36 37
+      2.6106891231345e-57    1.004447991624063e-42
+      2.6106891231345e-57    1.004447991624063e-42
+  33 63 38 34 63 31 36 36  65 33 63 35 64 33 63 32
+   1.5185012055968493e-47    5.697562550283398e-66
+   1.5185012055968493e-47    5.697562550283398e-66
+  34 61 66 35 38 66 37 31  37 35 62 31 38 64 66 33
+    1.324353173601122e-71    4.354454290350051e-61
+    1.324353173601122e-71    4.354454290350051e-61
+  62 62 33 64 62 22 2c 20  30 2c 20 22 44 55 50 20
+  1.0491764940533756e-153   4.872704312904001e-153
+  1.0491764940533756e-153   4.872704312904001e-153
+  48 41 53 48 31 36 30 20  30 78 31 34 20 30 78 66
+   1.209123040566424e-153   4.111091583464773e+185
+   1.209123040566424e-153   4.111091583464773e+185
+  36 66 33 36 35 63 34 30  66 30 37 33 39 62 36 31
+    1.760701515166045e-76   1.2668716919463958e-71
+    1.760701515166045e-76   1.2668716919463958e-71
+  64 65 38 32 37 61 34 34  37 35 31 65 35 65 39 39
+    3.246681244924251e-57   4.8909657304364225e-33
+    3.246681244924251e-57   4.8909657304364225e-33
+  30 33 32 65 64 38 66 20  45 51 55 41 4c 56 45 52
+  1.3258114690644195e-152   2.1222872311647527e+88
+  1.3258114690644195e-152   2.1222872311647527e+88
+  49 46 59 20 43 48 45 43  4b 53 49 47 22 5d 2c 0a
+        11980855307308178  1.1529705937656371e-259
+        11980855307308178  1.1529705937656371e-259
+  20 20 5b 22 63 65 61 66  65 35 38 65 30 66 36 65
+  1.4783519759202306e+185  3.6306925529494824e+179
+  1.4783519759202306e+185  3.6306925529494824e+179
+  37 64 36 37 63 30 34 30  39 66 62 62 66 36 37 33
+   1.7435572709685903e-76   5.6426461190575255e-62
+   1.7435572709685903e-76   5.6426461190575255e-62
+  63 38 34 63 31 36 36 65  33 63 35 64 33 63 32 34
+   3.600303047047277e+179    2.929298216958755e-57
+   3.600303047047277e+179    2.929298216958755e-57
+  61 66 35 38 66 37 31 37  35 62 31 38 64 66 33 62
+    7.720102329993884e-43   1.117168357471586e+165
+    7.720102329993884e-43   1.117168357471586e+165
+  62 33 64 62 22 2c 20 31  2c 20 22 32 20 30 78 34
+    4.576626915199821e-72    6.165390918058834e-56
+    4.576626915199821e-72    6.165390918058834e-56
+  38 20 30 78 33 30 34 35  30 32 32 30 31 35 62 64
+   2.1077553387826992e-52  3.6026703866905804e+175
+   2.1077553387826992e-52  3.6026703866905804e+175
+  30 31 33 39 62 63 63 63  66 39 39 30 61 36 61 66
+   5.853632352594693e+170   1.462747274177795e+185
+   5.853632352594693e+170   1.462747274177795e+185
+  36 65 63 35 63 31 63 35  32 65 64 38 32 32 32 65
+   1.6030674812319808e-51   2.949410635782876e+179
+   1.6030674812319808e-51   2.949410635782876e+179
+  30 33 61 30 64 35 31 63  33 33 34 64 66 31 33 39
+   6.494445887268918e+169   3.6964312985214255e-33
+   6.494445887268918e+169   3.6964312985214255e-33
+  39 36 38 35 32 35 64 32  66 63 64 32 30 32 32 31
+    5.996390901235522e-66    1.029859815725649e-71
+    5.996390901235522e-66    1.029859815725649e-71
+  30 30 39 66 39 65 66 65  33 32 35 34 37 36 65 62
+  2.9040653252449277e+180   9.772028820735898e+165
+  2.9040653252449277e+180   9.772028820735898e+165
+  36 34 63 33 39 35 38 65  34 37 31 33 65 39 65 65
+  3.9238701094990953e+179  2.7521921924576373e+180
+  3.9238701094990953e+179  2.7521921924576373e+180
+  66 65 34 39 62 66 31 64  38 32 30 65 64 35 38 64
+   4.303533223510957e+174   5.987513645498512e+174
+   4.303533223510957e+174   5.987513645498512e+174
+  32 31 31 32 37 32 31 62  31 33 34 65 32 61 31 61
+   9.902594266339855e+164   1.527141808583569e+160
+   9.902594266339855e+164   1.527141808583569e+160
+  35 33 30 33 20 30 78 32  31 20 30 78 30 33 37 38
+   1.4354919395612127e-65    6.817854990713587e-38
+   1.4354919395612127e-65    6.817854990713587e-38
+  64 34 33 30 32 37 34 66  38 63 35 65 63 31 33 32
+  2.1474556573079126e+184    7.119050768005487e-67
+  2.1474556573079126e+184    7.119050768005487e-67
+  31 33 33 38 31 35 31 65  39 66 32 37 66 34 63 36
+   2.789217206196148e+179   1.0512302796483916e-46
+   2.789217206196148e+179   1.0512302796483916e-46
+  37 36 61 30 30 38 62 64  66 38 36 33 38 64 30 37
+   3.604986092200413e+175     7.35019498170337e-43
+   3.604986092200413e+175     7.35019498170337e-43
+  63 30 62 36 62 65 39 61  62 33 35 63 37 31 20 30
+  2.2315341607729353e+160    6.991950617394494e-77
+  2.2315341607729353e+160    6.991950617394494e-77
+  78 32 31 20 30 78 30 33  37 38 64 34 33 30 32 37
+    4.003509869942793e-62    8.155907418832048e-43
+    4.003509869942793e-62    8.155907418832048e-43
+  34 66 38 63 35 65 63 31  33 32 31 33 33 38 31 35
+    8.781901395520896e-71    1.797802947190731e-52
+    8.781901395520896e-71    1.797802947190731e-52
+  31 65 39 66 32 37 66 34  63 36 37 36 61 30 30 38
+    2.831321041970877e-56    4.757514613681524e-38
+    2.831321041970877e-56    4.757514613681524e-38
+  62 64 66 38 36 33 38 64  30 37 63 30 62 36 62 65
+   5.985407114194562e+174   2.361649552281116e+180
+   5.985407114194562e+174   2.361649552281116e+180
+  39 61 62 33 35 63 37 31  20 33 20 43 48 45 43 4b
+   1.3236873182058075e-71    3.691520062076806e+54
+   1.3236873182058075e-71    3.691520062076806e+54
+  4d 55 4c 54 49 53 49 47  22 5d 5d 2c 0a 22 30 31
+   2.6299334241071866e+35    9.130936148260522e-72
+   2.6299334241071866e+35    9.130936148260522e-72
+  30 30 30 30 30 30 30 32  64 62 62 33 33 62 64 66
+    6.004550192171637e-67  1.7322401722563935e+185
+    6.004550192171637e-67  1.7322401722563935e+185
+  31 38 35 62 31 37 66 37  35 38 61 66 32 34 33 63
+    7.969454683792054e-42   7.247477452386627e+169
+    7.969454683792054e-42   7.247477452386627e+169
+  35 64 33 63 36 65 31 36  34 63 63 38 37 33 66 36
+    1.190238908606585e-47   1.2151918699149632e-46
+    1.190238908606585e-47   1.2151918699149632e-46
+  62 62 39 66 34 30 63 30  36 37 37 64 36 65 30 66
+    1.325707113600092e-75   1.741639847634863e+184
+    1.325707113600092e-75   1.741639847634863e+184
+  38 65 65 35 61 66 63 65  30 30 30 30 30 30 30 30
+   2.515633541663035e+180    1.398043286095289e-76
+   2.515633541663035e+180    1.398043286095289e-76
+  36 62 34 38 33 30 34 35  30 32 32 31 30 30 39 36
+   2.1077549406132224e-52   1.7234490000428804e-47
+   2.1077549406132224e-52   1.7234490000428804e-47
+  32 37 34 34 34 33 32 30  64 63 35 65 66 38 64 37
+    1.571783999969911e-76    7.253681345255213e-42
+    1.571783999969911e-76    7.253681345255213e-42
+  66 36 38 66 33 35 30 31  30 62 34 63 30 35 30 61
+    9.173298506759493e-72  1.4241671516489298e+160
+    9.173298506759493e-72  1.4241671516489298e+160
+  36 65 64 30 64 39 36 62  36 37 61 38 34 64 62 39
+  1.2798040643690874e+165    2.833647199858426e-32
+  1.2798040643690874e+165    2.833647199858426e-32
+  39 66 64 61 39 63 39 64  65 35 38 62 31 65 30 32
+  6.2791238921400596e+174    6.081349116681737e-67
+  6.2791238921400596e+174    6.081349116681737e-67
+  32 30 33 65 34 62 34 61  61 61 30 31 39 65 30 31
+   1.791095960156479e+160    9.279469773986957e-72
+   1.791095960156479e+160    9.279469773986957e-72
+  32 65 36 35 64 36 39 62  34 38 37 66 64 66 38 37
+  1.4518875335555988e+165   1.0941324719966987e-42
+  1.4518875335555988e+165   1.0941324719966987e-42
+  31 39 64 66 37 32 66 34  38 38 66 61 39 31 35 30
+    2.828841560591971e-56   1.8302011774736462e-76
+    2.828841560591971e-56   1.8302011774736462e-76
+  36 61 38 30 63 34 39 61  33 33 39 32 39 66 31 66
+  2.2147167150064953e+160  1.8482869439348263e+184
+  2.2147167150064953e+160  1.8482869439348263e+184
+  64 35 30 31 32 31 30 32  32 62 37 38 62 37 35 36
+    6.006010442533445e-67   1.4516810600930973e-47
+    6.006010442533445e-67   1.4516810600930973e-47
+  65 32 32 35 38 61 66 31  33 37 37 39 63 31 61 31
+   1.0133197992766005e-70    7.784678424374817e-71
+   1.0133197992766005e-70    7.784678424374817e-71
+  66 33 37 65 61 36 38 30  30 32 35 39 37 31 36 63
+    2.091025716431905e-76   8.375271344540863e+169
+    2.091025716431905e-76   8.375271344540863e+169
+  61 34 62 37 66 30 62 38  37 36 31 30 65 30 62 66
+    4.276227384260776e-37  1.5457427722913384e+185
+    4.276227384260776e-37  1.5457427722913384e+185
+  33 61 62 35 32 61 30 31  66 66 66 66 66 66 66 66
+     9.27056602573557e-72  1.9035985662552932e+185
+     9.27056602573557e-72  1.9035985662552932e+185
+  64 62 62 33 33 62 64 66  31 38 35 62 31 37 66 37
+  1.7322401722563935e+185    7.969454683792054e-42
+  1.7322401722563935e+185    7.969454683792054e-42
+  35 38 61 66 32 34 33 63  35 64 33 63 36 65 31 36
+   7.247477452386627e+169    1.190238908606585e-47
+   7.247477452386627e+169    1.190238908606585e-47
+  34 63 63 38 37 33 66 36  62 62 39 66 34 30 63 30
+   1.2151918699149632e-46    1.325707113600092e-75
+   1.2151918699149632e-46    1.325707113600092e-75
+  36 37 37 64 36 65 30 66  38 65 65 35 61 66 63 65
+   1.741639847634863e+184   2.515633541663035e+180
+   1.741639847634863e+184   2.515633541663035e+180
+  30 31 30 30 30 30 30 30  39 33 30 30 34 38 33 30
+   1.3980432860953674e-76   1.6598324165207992e-76
+   1.3980432860953674e-76   1.6598324165207992e-76
+  34 35 30 32 32 30 31 35  62 64 30 31 33 39 62 63
+    1.794538695617782e-52   5.501965433898013e+170
+    1.794538695617782e-52   5.501965433898013e+170
+  63 63 66 39 39 30 61 36  61 66 36 65 63 35 63 31
+    9.408609738499396e-47    8.697322268925005e-71
+    9.408609738499396e-47    8.697322268925005e-71
+  63 35 32 65 64 38 32 32  32 65 30 33 61 30 64 35
+    6.758278173029908e-67   1.6862625533032855e-51
+    6.758278173029908e-67   1.6862625533032855e-51
+  31 63 33 33 34 64 66 31  33 39 39 36 38 35 32 35
+   1.0138476365136342e-70   1.9009923084146932e-52
+   1.0138476365136342e-70   1.9009923084146932e-52
+  64 32 66 63 64 32 30 32  32 31 30 30 39 66 39 65
+    6.007743451249364e-67  4.1169856560600985e+179
+    6.007743451249364e-67  4.1169856560600985e+179
+  66 65 33 32 35 34 37 36  65 62 36 34 63 33 39 35
+   1.5876777771112044e-47    2.631079236209162e-52
+   1.5876777771112044e-47    2.631079236209162e-52
+  38 65 34 37 31 33 65 39  65 65 66 65 34 39 62 66
+   3.2663725204804295e-32  1.5486671535584227e+185
+   3.2663725204804295e-32  1.5486671535584227e+185
+  31 64 38 32 30 65 64 35  38 64 32 31 31 32 37 32
+    1.703492156117652e-51    8.603897997056349e-67
+    1.703492156117652e-51    8.603897997056349e-67
+  31 62 31 33 34 65 32 61  31 61 35 33 30 33 34 38
+  1.6163865977979844e+160    5.936233019336432e-38
+  1.6163865977979844e+160    5.936233019336432e-38
+  33 30 34 35 30 32 32 30  31 35 62 64 30 31 33 39
+    1.571441383683764e-76    3.696272608847125e-33
+    1.571441383683764e-76    3.696272608847125e-33
+  62 63 63 63 66 39 39 30  61 36 61 66 36 65 63 35
+   2.1784060324525043e-76   1.6199761654397237e-51
+   2.1784060324525043e-76   1.6199761654397237e-51
+  63 31 63 35 32 65 64 38  32 32 32 65 30 33 61 30
+    4.794911368729985e-37    1.188333836407767e-75
+    4.794911368729985e-37    1.188333836407767e-75
+  64 35 31 63 33 33 34 64  66 31 33 39 39 36 38 35
+   4.996074817259987e+174   2.5278309804861658e-52
+   4.996074817259987e+174   2.5278309804861658e-52
+  32 35 64 32 66 63 64 32  30 32 32 31 30 30 39 66
+    6.049946137286738e-66   2.675685753724137e+184
+    6.049946137286738e-66   2.675685753724137e+184
+  39 65 66 65 33 32 35 34  37 36 65 62 36 34 63 33
+    3.376733026750343e-57    3.734578261285214e-61
+    3.376733026750343e-57    3.734578261285214e-61
+  39 35 38 65 34 37 31 33  65 39 65 65 66 65 34 39
+    4.184891050855173e-62    3.928144758633273e-33
+    4.184891050855173e-62    3.928144758633273e-33
+  62 66 31 64 38 32 30 65  64 35 38 64 32 31 31 32
+  2.6252449949627186e+179    6.376932185831247e-67
+  2.6252449949627186e+179    6.376932185831247e-67
+  37 32 31 62 31 33 34 65  32 61 31 61 35 33 30 33
+  3.2742226359696635e+179    3.938009940328758e-62
+  3.2742226359696635e+179    3.938009940328758e-62
+  66 66 66 66 66 66 66 66  30 31 61 30 38 36 30 31
+  1.9035985662552932e+185    9.175550730460762e-72
+  1.9035985662552932e+185    9.175550730460762e-72
+  30 30 30 30 30 30 30 30  30 30 31 39 37 36 61 39
+    1.398043286095289e-76    2.651894621783635e-32
+    1.398043286095289e-76    2.651894621783635e-32
+  31 34 39 62 63 30 62 62  64 64 33 30 32 34 64 61
+   8.379475673821353e+165  1.4202431731177922e+161
+   8.379475673821353e+165  1.4202431731177922e+161
+  34 64 30 63 33 38 65 64  31 61 65 63 66 35 63 36
+   4.198588712471846e+175   1.0514442450316283e-46
+   4.198588712471846e+175   1.0514442450316283e-46
+  38 64 64 31 64 33 66 61  31 32 38 38 61 63 30 30
+  1.5606132735144913e+161   1.4153127654425226e-76
+  1.5606132735144913e+161   1.4153127654425226e-76
+  30 30 30 30 30 30 22 2c  20 22 50 32 53 48 22 5d
+    4.257571555502434e-96   4.354357046338091e+140
+    4.257571555502434e-96   4.354357046338091e+140
+  2c 0a 0a 0a 5b 22 43 48  45 43 4b 4c 4f 43 4b 54
+    1.302206285197634e+40    1.164665247074938e+98
+    1.302206285197634e+40    1.164665247074938e+98
+  49 4d 45 56 45 52 49 46  59 20 74 65 73 74 73 22
+    4.012331313890848e+30   9.971276286620743e-143
+    4.012331313890848e+30   9.971276286620743e-143
+  5d 2c 0a 0a 5b 22 42 79  2d 68 65 69 67 68 74 20
+  1.2556959163699537e+276  2.4353365494500073e-152
+  1.2556959163699537e+276  2.4353365494500073e-152
+  6c 6f 63 6b 73 2c 20 77  69 74 68 20 61 72 67 75
+   6.518893076131001e+265   3.520544090941846e+257
+   6.518893076131001e+265   3.520544090941846e+257
+  6d 65 6e 74 20 3d 3d 20  30 20 61 6e 64 20 3d 3d
+  2.1807275748480677e-153   1.0347823027967359e-13
+  2.1807275748480677e-153   1.0347823027967359e-13
+  20 74 78 20 6e 4c 6f 63  6b 54 69 6d 65 22 5d 2c
+   9.449565763125068e+170    5.455905802642588e-95
+   9.449565763125068e+170    5.455905802642588e-95
+  0a 5b 5b 5b 22 30 30 30  30 30 30 30 30 30 30 30
+   1.3980250594618592e-76    1.398043286095289e-76
+   1.3980250594618592e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 31 30 30 22 2c 20  30 2c 20 22 30 20 43 48
+  1.0491479271388595e-153   1.3016300379526122e+40
+  1.0491479271388595e-153   1.3016300379526122e+40
+  45 43 4b 4c 4f 43 4b 54  49 4d 45 56 45 52 49 46
+    1.164665247074938e+98    4.012331313890848e+30
+    1.164665247074938e+98    4.012331313890848e+30
+  59 20 31 22 5d 5d 2c 0a  22 30 31 30 30 30 30 30
+  1.1530070992334554e-259   1.3980432861153922e-76
+  1.1530070992334554e-259   1.3980432861153922e-76
+  30 30 31 30 30 30 31 30  30 30 30 30 30 30 30 30
+    1.484404971666341e-76    1.398043286095289e-76
+    1.484404971666341e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 31 30  30 30 30 30 30 30 30 30
+   1.4844049716462333e-76    1.398043286095289e-76
+   1.4844049716462333e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 22 2c 20 22 50 32 53  48 2c 43 48 45 43 4b 4c
+    5.968685125563565e+92   3.4226243599768038e+59
+    5.968685125563565e+92   3.4226243599768038e+59
+  4f 43 4b 54 49 4d 45 56  45 52 49 46 59 22 5d 2c
+   3.908470283878822e+107    5.455871076307772e-95
+   3.908470283878822e+107    5.455871076307772e-95
+  0a 5b 5b 5b 22 30 30 30  30 30 30 30 30 30 30 30
+   1.3980250594618592e-76    1.398043286095289e-76
+   1.3980250594618592e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 31 30 30 22 2c 20  30 2c 20 22 34 39 39 39
+  1.0491479271388595e-153    4.857860100895222e-33
+  1.0491479271388595e-153    4.857860100895222e-33
+  39 39 39 39 39 20 43 48  45 43 4b 4c 4f 43 4b 54
+   1.3016394777829894e+40    1.164665247074938e+98
+   1.3016394777829894e+40    1.164665247074938e+98
+  49 4d 45 56 45 52 49 46  59 20 31 22 5d 5d 2c 0a
+    4.012331313890848e+30  1.1530070992334554e-259
+    4.012331313890848e+30  1.1530070992334554e-259
+  22 30 31 30 30 30 30 30  30 30 31 30 30 30 31 30
+   1.3980432861153922e-76    1.484404971666341e-76
+   1.3980432861153922e-76    1.484404971666341e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 31 30
+    1.398043286095289e-76   1.4844049716462333e-76
+    1.398043286095289e-76   1.4844049716462333e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 66 66 36 34 63 64 31  64 22 2c 20 22 50 32 53
+    9.231139856275422e-71    5.968685125563626e+92
+    9.231139856275422e-71    5.968685125563626e+92
+  48 2c 43 48 45 43 4b 4c  4f 43 4b 54 49 4d 45 56
+   3.4226243599768038e+59   3.908470283878822e+107
+   3.4226243599768038e+59   3.908470283878822e+107
+  45 52 49 46 59 22 5d 2c  0a 5b 5b 5b 22 30 30 30
+    5.455871076307772e-95   1.3980250594618592e-76
+    5.455871076307772e-95   1.3980250594618592e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 31 30 30 22 2c 20
+    1.398043286095289e-76  1.0491479271388595e-153
+    1.398043286095289e-76  1.0491479271388595e-153
+  30 2c 20 22 30 20 43 48  45 43 4b 4c 4f 43 4b 54
+   1.3016300379526122e+40    1.164665247074938e+98
+   1.3016300379526122e+40    1.164665247074938e+98
+  49 4d 45 56 45 52 49 46  59 20 31 22 5d 5d 2c 0a
+    4.012331313890848e+30  1.1530070992334554e-259
+    4.012331313890848e+30  1.1530070992334554e-259
+  22 30 31 30 30 30 30 30  30 30 31 30 30 30 31 30
+   1.3980432861153922e-76    1.484404971666341e-76
+   1.3980432861153922e-76    1.484404971666341e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 31 30
+    1.398043286095289e-76   1.4844049716462333e-76
+    1.398043286095289e-76   1.4844049716462333e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 66 66 36 34 63 64 31  64 22 2c 20 22 50 32 53
+    9.231139856275422e-71    5.968685125563626e+92
+    9.231139856275422e-71    5.968685125563626e+92
+  48 2c 43 48 45 43 4b 4c  4f 43 4b 54 49 4d 45 56
+   3.4226243599768038e+59   3.908470283878822e+107
+   3.4226243599768038e+59   3.908470283878822e+107
+  45 52 49 46 59 22 5d 2c  0a 0a 5b 22 42 79 2d 74
+    5.455871076307772e-95   4.220467354405173e+251
+    5.455871076307772e-95   4.220467354405173e+251
+  69 6d 65 20 6c 6f 63 6b  73 2c 20 77 69 74 68 20
+  1.9967191948137463e+209   1.459133925609568e-152
+  1.9967191948137463e+209   1.459133925609568e-152
+  61 72 67 75 6d 65 6e 74  20 6a 75 73 74 20 62 65
+   6.964111143842559e+252   2.350541967687642e+180
+   6.964111143842559e+252   2.350541967687642e+180
+  79 6f 6e 64 20 74 78 20  6e 4c 6f 63 6b 54 69 6d
+   2.918134793720235e-152  1.1176813441525232e+219
+   2.918134793720235e-152  1.1176813441525232e+219
+  65 20 28 62 75 74 20 77  69 74 68 69 6e 20 6e 75
+   6.632264862978768e+265  4.5235318550750447e+257
+   6.632264862978768e+265  4.5235318550750447e+257
+  6d 65 72 69 63 61 6c 20  62 6f 75 6e 64 61 72 69
+  1.6933669278993816e-152     8.7933227004393e+199
+  1.6933669278993816e-152     8.7933227004393e+199
+  65 73 29 22 5d 2c 0a 5b  5b 5b 22 30 30 30 30 30
+  3.6284952450839615e+130   1.3980432858171725e-76
+  3.6284952450839615e+130   1.3980432858171725e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  31 30 30 22 2c 20 30 2c
+    1.398043286095289e-76    7.549518397495304e-96
+    1.398043286095289e-76    7.549518397495304e-96
+  20 22 35 30 30 30 30 30  30 30 30 20 43 48 45 43
+   1.3980432861947225e-76        11980855301922912
+   1.3980432861947225e-76        11980855301922912
+  4b 4c 4f 43 4b 54 49 4d  45 56 45 52 49 46 59 20
+   2.0839717424071816e+64   7.540250107217763e-153
+   2.0839717424071816e+64   7.540250107217763e-153
+  31 22 5d 5d 2c 0a 22 30  31 30 30 30 30 30 30 30
+     7.78971152971537e-77   1.3980432860952892e-76
+     7.78971152971537e-77   1.3980432860952892e-76
+  31 30 30 30 31 30 30 30  30 30 30 30 30 30 30 30
+    1.398044603870032e-76    1.398043286095289e-76
+    1.398044603870032e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 31 30 30 30  30 30 30 30 30 30 30 30
+   1.3980446038700318e-76    1.398043286095289e-76
+   1.3980446038700318e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 36 35 63 64 31 64 22
+    1.398043286095289e-76   5.174776306723718e-143
+    1.398043286095289e-76   5.174776306723718e-143
+  2c 20 22 50 32 53 48 2c  43 48 45 43 4b 4c 4f 43
+   2.2776342793000827e-95        17619220825804934
+   2.2776342793000827e-95        17619220825804934
+  4b 54 49 4d 45 56 45 52  49 46 59 22 5d 2c 0a 5b
+   2.1222766780592805e+88   3.628495246627624e+130
+   2.1222766780592805e+88   3.628495246627624e+130
+  5b 5b 22 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432858171725e-76    1.398043286095289e-76
+   1.3980432858171725e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  31 30 30 22 2c 20 30 2c  20 22 34 32 39 34 39 36
+    7.549518397495304e-96   1.7245275064745288e-47
+    7.549518397495304e-96   1.7245275064745288e-47
+  37 32 39 35 20 43 48 45  43 4b 4c 4f 43 4b 54 49
+    5.866242471213099e+25   1.8102849189569236e+45
+    5.866242471213099e+25   1.8102849189569236e+45
+  4d 45 56 45 52 49 46 59  20 31 22 5d 5d 2c 0a 22
+  1.1509816729231713e+122  1.0480224142302541e-144
+  1.1509816729231713e+122  1.0480224142302541e-144
+  30 31 30 30 30 30 30 30  30 31 30 30 30 31 30 30
+   1.3980432860953674e-76   1.3983806364295508e-76
+   1.3980432860953674e-76   1.3983806364295508e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 31 30 30
+    1.398043286095289e-76   1.3983806364294722e-76
+    1.398043286095289e-76   1.3983806364294722e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  66 66 66 66 66 66 66 66  22 2c 20 22 50 32 53 48
+  1.9035985662552932e+185    2.612896978874658e+40
+  1.9035985662552932e+185    2.612896978874658e+40
+  2c 43 48 45 43 4b 4c 4f  43 4b 54 49 4d 45 56 45
+     9.99823248050118e+73   1.0769454800825815e+26
+     9.99823248050118e+73   1.0769454800825815e+26
+  52 49 46 59 22 5d 2c 0a  5b 5b 5b 22 30 30 30 30
+   1.152970637348911e-259    1.398043214897502e-76
+   1.152970637348911e-259    1.398043214897502e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 31 30 30 22 2c 20 30
+    1.398043286095289e-76    6.983377179561166e-77
+    1.398043286095289e-76    6.983377179561166e-77
+  2c 20 22 35 30 30 30 30  30 30 30 30 20 43 48 45
+   1.3980433115503118e-76    5.866242398648404e+25
+   1.3980433115503118e-76    5.866242398648404e+25
+  43 4b 4c 4f 43 4b 54 49  4d 45 56 45 52 49 46 59
+   1.8102849189569236e+45  1.1509816729231713e+122
+   1.8102849189569236e+45  1.1509816729231713e+122
+  20 31 22 5d 5d 2c 0a 22  30 31 30 30 30 30 30 30
+  1.0480224142302541e-144   1.3980432860953674e-76
+  1.0480224142302541e-144   1.3980432860953674e-76
+  30 31 30 30 30 31 30 30  30 30 30 30 30 30 30 30
+   1.3983806364295508e-76    1.398043286095289e-76
+   1.3983806364295508e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 31 30 30  30 30 30 30 30 30 30 30
+   1.3983806364294722e-76    1.398043286095289e-76
+   1.3983806364294722e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  66 66 66 66 66 66 66 66
+    1.398043286095289e-76  1.9035985662552932e+185
+    1.398043286095289e-76  1.9035985662552932e+185
+  22 2c 20 22 50 32 53 48  2c 43 48 45 43 4b 4c 4f
+    2.612896978874658e+40     9.99823248050118e+73
+    2.612896978874658e+40     9.99823248050118e+73
+  43 4b 54 49 4d 45 56 45  52 49 46 59 22 5d 2c 0a
+   1.0769454800825815e+26   1.152970637348911e-259
+   1.0769454800825815e+26   1.152970637348911e-259
+  0a 5b 22 41 6e 79 20 6e  6f 6e 2d 6d 61 78 69 6e
+   2.977520778517622e+222   7.365458300754583e+223
+   2.977520778517622e+222   7.365458300754583e+223
+  74 20 6e 53 65 71 75 65  6e 63 65 20 69 73 20 66
+   5.561116541422394e+180   8.737657030754996e+183
+   5.561116541422394e+180   8.737657030754996e+183
+  69 6e 65 22 5d 2c 0a 5b  5b 5b 22 30 30 30 30 30
+  3.6284952470200205e+130   1.3980432858171725e-76
+  3.6284952470200205e+130   1.3980432858171725e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  31 30 30 22 2c 20 30 2c
+    1.398043286095289e-76    7.549518397495304e-96
+    1.398043286095289e-76    7.549518397495304e-96
+  20 22 30 20 43 48 45 43  4b 4c 4f 43 4b 54 49 4d
+        11980855301915712   2.0839717424071816e+64
+        11980855301915712   2.0839717424071816e+64
+  45 56 45 52 49 46 59 20  31 22 5d 5d 2c 0a 22 30
+   7.540250107217763e-153     7.78971152971537e-77
+   7.540250107217763e-153     7.78971152971537e-77
+  31 30 30 30 30 30 30 30  31 30 30 30 31 30 30 30
+   1.3980432860952892e-76    1.398044603870032e-76
+   1.3980432860952892e-76    1.398044603870032e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 66 65 66 66 66  66 66 66 30 31 30 30 30
+  1.9035972684590205e+185   1.3980446049601027e-76
+  1.9035972684590205e+185   1.3980446049601027e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 22  2c 20 22 50 32 53 48 2c
+     5.1856307557119e-144   2.2776342793000827e-95
+     5.1856307557119e-144   2.2776342793000827e-95
+  43 48 45 43 4b 4c 4f 43  4b 54 49 4d 45 56 45 52
+        17619220825804934   2.1222766780592805e+88
+        17619220825804934   2.1222766780592805e+88
+  49 46 59 22 5d 2c 0a 0a  5b 22 54 68 65 20 61 72
+  2.6598195754464224e-260   9.136005196505957e+242
+  2.6598195754464224e-260   9.136005196505957e+242
+  67 75 6d 65 6e 74 20 63  61 6e 20 62 65 20 63 61
+  3.1049916403604965e+169  1.3445107199929698e+161
+  3.1049916403604965e+169  1.3445107199929698e+161
+  6c 63 75 6c 61 74 65 64  20 72 61 74 68 65 72 20
+   4.245102153886591e+175   2.195273106179518e-152
+   4.245102153886591e+175   2.195273106179518e-152
+  74 68 61 6e 20 63 72 65  61 74 65 64 20 64 69 72
+  4.7686268215539585e+180   1.354466797825885e+243
+  4.7686268215539585e+180   1.354466797825885e+243
+  65 63 74 6c 79 20 62 79  20 61 20 50 55 53 48 44
+   5.020748186519462e+276    8.974533030943927e+20
+   5.020748186519462e+276    8.974533030943927e+20
+  41 54 41 22 5d 2c 0a 5b  5b 5b 22 30 30 30 30 30
+    3.62849524585471e+130   1.3980432858171725e-76
+    3.62849524585471e+130   1.3980432858171725e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  31 30 30 22 2c 20 30 2c
+    1.398043286095289e-76    7.549518397495304e-96
+    1.398043286095289e-76    7.549518397495304e-96
+  20 22 34 39 39 39 39 39  39 39 39 20 31 41 44 44
+    4.857875059496727e-33    7.472649055813209e+20
+    4.857875059496727e-33    7.472649055813209e+20
+  20 43 48 45 43 4b 4c 4f  43 4b 54 49 4d 45 56 45
+    9.998232480501165e+73   1.0769454800825815e+26
+    9.998232480501165e+73   1.0769454800825815e+26
+  52 49 46 59 20 31 22 5d  5d 2c 0a 22 30 31 30 30
+   4.332774123520774e+140    1.398380563599275e-76
+   4.332774123520774e+140    1.398380563599275e-76
+  30 30 30 30 30 31 30 30  30 31 30 30 30 30 30 30
+   1.3983806364294722e-76   1.3980432860953674e-76
+   1.3983806364294722e-76   1.3980432860953674e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 31 30 30 30 30 30 30
+    1.398043286095289e-76   1.3980432860953674e-76
+    1.398043286095289e-76   1.3980432860953674e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 36 35
+    1.398043286095289e-76    2.316559854427335e-52
+    1.398043286095289e-76    2.316559854427335e-52
+  63 64 31 64 22 2c 20 22  50 32 53 48 2c 43 48 45
+  2.5902790551717545e-144   5.8662870186814245e+25
+  2.5902790551717545e-144   5.8662870186814245e+25
+  43 4b 4c 4f 43 4b 54 49  4d 45 56 45 52 49 46 59
+   1.8102849189569236e+45  1.1509816729231713e+122
+   1.8102849189569236e+45  1.1509816729231713e+122
+  22 5d 2c 0a 0a 5b 22 50  65 72 68 61 70 73 20 65
+   1.0627179070884628e+78  1.3332696259430434e+179
+   1.0627179070884628e+78  1.3332696259430434e+179
+  76 65 6e 20 62 79 20 61  6e 20 41 44 44 20 70 72
+    7.23787076506208e+159  1.7204588571788855e+243
+    7.23787076506208e+159  1.7204588571788855e+243
+  6f 64 75 63 69 6e 67 20  61 20 35 2d 62 79 74 65
+   1.398068690928465e-152   5.309863878251957e+180
+   1.398068690928465e-152   5.309863878251957e+180
+  20 72 65 73 75 6c 74 20  74 68 61 74 20 69 73 20
+  2.4372266981377133e-152   2.316340039414806e-152
+  2.4372266981377133e-152   2.316340039414806e-152
+  6f 75 74 20 6f 66 20 62  6f 75 6e 64 73 20 66 6f
+   4.722098259589954e+164   4.193383347608638e+228
+   4.722098259589954e+164   4.193383347608638e+228
+  72 20 6f 74 68 65 72 20  6f 70 63 6f 64 65 73 22
+   2.195273106559636e-152   9.941128034138938e-143
+   2.195273106559636e-152   9.941128034138938e-143
+  5d 2c 0a 5b 5b 5b 22 30  30 30 30 30 30 30 30 30
+    7.926648032307966e-77    1.398043286095289e-76
+    7.926648032307966e-77    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 31 30 30 22  2c 20 30 2c 20 22 32 31
+   5.185635643610081e-144   1.0263086022860706e-71
+   5.185635643610081e-144   1.0263086022860706e-71
+  34 37 34 38 33 36 34 37  20 32 31 34 37 34 38 33
+    9.063248276381109e-43    5.883658537827942e-62
+    9.063248276381109e-43    5.883658537827942e-62
+  36 34 37 20 41 44 44 20  43 48 45 43 4b 4c 4f 43
+   3.023106960867336e-153        17619220825804934
+   3.023106960867336e-153        17619220825804934
+  4b 54 49 4d 45 56 45 52  49 46 59 20 31 22 5d 5d
+   2.1222766780592805e+88   5.551004350505541e+141
+   2.1222766780592805e+88   5.551004350505541e+141
+  2c 0a 22 30 31 30 30 30  30 30 30 30 31 30 30 30
+   1.3980446035855388e-76   1.3980446038700318e-76
+   1.3980446035855388e-76   1.3980446038700318e-76
+  31 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432860952892e-76    1.398043286095289e-76
+   1.3980432860952892e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  31 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432860952892e-76    1.398043286095289e-76
+   1.3980432860952892e-76    1.398043286095289e-76
+  30 30 30 66 65 66 66 66  66 66 66 22 2c 20 22 50
+  1.9035972684590205e+185   1.0494047980586402e+78
+  1.9035972684590205e+185   1.0494047980586402e+78
+  32 53 48 2c 43 48 45 43  4b 4c 4f 43 4b 54 49 4d
+        11980855707739748   2.0839717424071816e+64
+        11980855707739748   2.0839717424071816e+64
+  45 56 45 52 49 46 59 22  5d 2c 0a 0a 5b 22 35 20
+  3.2385127614160786e-143   1.576260769743162e-153
+  3.2385127614160786e-143   1.576260769743162e-153
+  62 79 74 65 20 6e 6f 6e  2d 6d 69 6e 69 6d 61 6c
+   9.088949474124382e+223  1.1733816298220414e+214
+   9.088949474124382e+223  1.1733816298220414e+214
+  6c 79 2d 65 6e 63 6f 64  65 64 20 61 72 67 75 6d
+   6.210645101433959e+175   1.888920194550895e+219
+   6.210645101433959e+175   1.888920194550895e+219
+  65 6e 74 73 20 61 72 65  20 76 61 6c 69 64 22 5d
+   4.766600769344527e+180   4.380487722809414e+140
+   4.766600769344527e+180   4.380487722809414e+140
+  2c 0a 5b 5b 5b 22 30 30  30 30 30 30 30 30 30 30
+   1.3933772679372857e-76    1.398043286095289e-76
+   1.3933772679372857e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 31 30 30 22 2c  20 30 2c 20 22 30 78 30
+    4.257571569454917e-96    3.342269182744139e-75
+    4.257571569454917e-96    3.342269182744139e-75
+  35 20 30 78 30 30 30 30  30 30 30 30 30 30 20 43
+     1.39804365671818e-76         2278291576199192
+     1.39804365671818e-76         2278291576199192
+  48 45 43 4b 4c 4f 43 4b  54 49 4d 45 56 45 52 49
+    3.699014735381107e+54    1.629814070817695e+45
+    3.699014735381107e+54    1.629814070817695e+45
+  46 59 20 31 22 5d 5d 2c  0a 22 30 31 30 30 30 30
+    5.498872883248109e-95   1.3980432912417352e-76
+    5.498872883248109e-95   1.3980432912417352e-76
+  30 30 30 31 30 30 30 31  30 30 30 30 30 30 30 30
+    9.162216513489118e-72    1.398043286095289e-76
+    9.162216513489118e-72    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 31  30 30 30 30 30 30 30 30
+    9.162216479754085e-72    1.398043286095289e-76
+    9.162216479754085e-72    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 22 2c 20 22 50 32  53 48 2c 43 48 45 43 4b
+    2.393669929840339e-66   3.6915200626157174e+54
+    2.393669929840339e-66   3.6915200626157174e+54
+  4c 4f 43 4b 54 49 4d 45  56 45 52 49 46 59 22 5d
+    7.081027294368297e+25   4.370126139089802e+140
+    7.081027294368297e+25   4.370126139089802e+140
+  2c 0a 0a 5b 22 56 61 6c  69 64 20 43 48 45 43 4b
+  1.1672594524989764e+214    3.691520062085393e+54
+  1.1672594524989764e+214    3.691520062085393e+54
+  4c 4f 43 4b 54 49 4d 45  56 45 52 49 46 59 20 69
+    7.081027294368297e+25   2.444168528837441e+198
+    7.081027294368297e+25   2.444168528837441e+198
+  6e 20 73 63 72 69 70 74  53 69 67 22 5d 2c 0a 5b
+   7.520302005152593e+252  3.6284952470839355e+130
+   7.520302005152593e+252  3.6284952470839355e+130
+  5b 5b 22 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432858171725e-76    1.398043286095289e-76
+   1.3980432858171725e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  31 30 30 22 2c 20 30 2c  20 22 31 22 5d 5d 2c 0a
+    7.549518397495304e-96  1.1530070992335211e-259
+    7.549518397495304e-96  1.1530070992335211e-259
+  22 30 31 30 30 30 30 30  30 30 31 30 30 30 31 30
+   1.3980432861153922e-76    1.484404971666341e-76
+   1.3980432861153922e-76    1.484404971666341e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 32 35 31 62  31 30 30 30 30 30 30 30
+   9.909298633544062e+164   1.3980432860952892e-76
+   9.909298633544062e+164   1.3980432860952892e-76
+  30 30 31 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432861153965e-76    1.398043286095289e-76
+   1.3980432861153965e-76    1.398043286095289e-76
+  30 30 30 30 30 30 31 30  30 30 30 30 30 22 2c 20
+   1.4844049716462333e-76  1.0491479271301769e-153
+   1.4844049716462333e-76  1.0491479271301769e-153
+  22 50 32 53 48 2c 43 48  45 43 4b 4c 4f 43 4b 54
+   1.3048453072224773e+40    1.164665247074938e+98
+   1.3048453072224773e+40    1.164665247074938e+98
+  49 4d 45 56 45 52 49 46  59 22 5d 2c 0a 0a 5b 22
+    4.012331313890848e+30   3.464624686628588e-143
+    4.012331313890848e+30   3.464624686628588e-143
+  56 61 6c 69 64 20 43 48  45 43 4b 4c 4f 43 4b 54
+    1.301684327057715e+40    1.164665247074938e+98
+    1.301684327057715e+40    1.164665247074938e+98
+  49 4d 45 56 45 52 49 46  59 20 69 6e 20 72 65 64
+    4.012331313890848e+30   4.243360115853662e+175
+    4.012331313890848e+30   4.243360115853662e+175
+  65 65 6d 53 63 72 69 70  74 22 5d 2c 0a 5b 5b 5b
+  3.1605328804557394e+233  1.2135697532664621e+132
+  3.1605328804557394e+233  1.2135697532664621e+132
+  22 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432860952846e-76    1.398043286095289e-76
+   1.3980432860952846e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 31 30
+    1.398043286095289e-76   1.4844049716462333e-76
+    1.398043286095289e-76   1.4844049716462333e-76
+  30 22 2c 20 30 2c 20 22  48 41 53 48 31 36 30 20
+  2.5903126210889466e-144   1.209123040566424e-153
+  2.5903126210889466e-144   1.209123040566424e-153
+  30 78 31 34 20 30 78 63  35 62 39 33 30 36 34 31
+   1.460553130337691e+171   1.1439401506778234e-71
+   1.460553130337691e+171   1.1439401506778234e-71
+  35 39 62 33 62 32 64 36  61 62 35 30 36 61 34 31
+   1.1055375051604747e-46   1.1534520165511922e-71
+   1.1055375051604747e-46   1.1534520165511922e-71
+  62 31 66 35 30 34 36 33  37 37 31 62 39 38 38 20
+    5.397459522290602e-62  1.8063822013442552e-153
+    5.397459522290602e-62  1.8063822013442552e-153
+  45 51 55 41 4c 22 5d 5d  2c 0a 22 30 31 30 30 30
+   5.551083223688435e+141   1.3980446035855388e-76
+   5.551083223688435e+141   1.3980446035855388e-76
+  30 30 30 30 31 30 30 30  31 30 30 30 30 30 30 30
+   1.3980446038700318e-76   1.3980432860952892e-76
+   1.3980446038700318e-76   1.3980432860952892e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 33 30
+    1.398043286095289e-76   1.6571283427481222e-76
+    1.398043286095289e-76   1.6571283427481222e-76
+  32 35 31 62 31 30 30 30  30 30 30 30 30 30 31 30
+   1.3980448612684122e-76   1.4844049716462333e-76
+   1.3980448612684122e-76   1.4844049716462333e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 31 30 30 30 30 30  30 22 2c 20 22 50 32 53
+   1.3980432861153965e-76    5.968685125563565e+92
+   1.3980432861153965e-76    5.968685125563565e+92
+  48 2c 43 48 45 43 4b 4c  4f 43 4b 54 49 4d 45 56
+   3.4226243599768038e+59   3.908470283878822e+107
+   3.4226243599768038e+59   3.908470283878822e+107
+  45 52 49 46 59 22 5d 2c  0a 0a 5b 22 41 20 74 72
+    5.455871076307772e-95   2.147206681517358e+243
+    5.455871076307772e-95   2.147206681517358e+243
+  61 6e 73 61 63 74 69 6f  6e 20 77 69 74 68 20 61
+  4.8240712098384304e+228   7.208817957831067e+159
+  4.8240712098384304e+228   7.208817957831067e+159
+  20 6e 6f 6e 2d 73 74 61  6e 64 61 72 64 20 44 45
+   2.875074721714135e+161      4.8662970072262e+25
+   2.875074721714135e+161      4.8662970072262e+25
+  52 20 73 69 67 6e 61 74  75 72 65 2e 22 5d 2c 0a
+   3.993698689038436e+252   1.152970533459521e-259
+   3.993698689038436e+252   1.152970533459521e-259
+  5b 5b 5b 22 62 31 64 62  63 38 31 36 39 36 63 38
+   9.302644001183946e+165    4.516674937917322e-37
+   9.302644001183946e+165    4.516674937917322e-37
+  61 39 63 30 66 63 63 64  30 36 39 33 61 62 36 36
+  3.8362484713463044e+175   1.5315956605136858e-47
+  3.8362484713463044e+175   1.5315956605136858e-47
+  64 37 63 33 36 38 64 62  63 33 38 63 30 64 65 66
+   9.314932127134563e+165   1.817882525728266e+185
+   9.314932127134563e+165   1.817882525728266e+185
+  34 65 38 30 30 36 38 35  35 36 30 64 64 64 31 62
+   2.5278165867782905e-52   1.001546423961662e+165
+   2.5278165867782905e-52   1.001546423961662e+165
+  32 31 33 32 22 2c 20 30  2c 20 22 44 55 50 20 48
+     6.98337723133836e-77    2.775649418769176e+39
+     6.98337723133836e-77    2.775649418769176e+39
+  41 53 48 31 36 30 20 30  78 31 34 20 30 78 34 62
+    6.990255991883209e-77  1.1787577020237008e+165
+    6.990255991883209e-77  1.1787577020237008e+165
+  33 62 64 37 65 62 61 33  62 63 30 32 38 34 66 64
+    3.380722463412479e-61   4.393375921593471e+175
+    3.380722463412479e-61   4.393375921593471e+175
+  33 30 30 37 62 65 37 66  33 62 65 32 37 35 65 39
+  2.4853040722787458e+184    3.267590288467499e-32
+  2.4853040722787458e+184    3.267590288467499e-32
+  34 66 35 38 32 36 20 45  51 55 41 4c 56 45 52 49
+    9.799373645684263e+24    1.629814107787821e+45
+    9.799373645684263e+24    1.629814107787821e+45
+  46 59 20 43 48 45 43 4b  53 49 47 22 5d 5d 2c 0a
+   3.6915200620834524e+54  1.1530070994431875e-259
+   3.6915200620834524e+54  1.1530070994431875e-259
+  22 30 31 30 30 30 30 30  30 30 31 33 32 32 31 31
+   1.3980432861153922e-76     9.73263551415495e-72
+   1.3980432861153922e-76     9.73263551415495e-72
+  62 64 64 30 64 35 36 38  35 30 36 38 30 34 65 65
+    6.526509208884021e-38  2.7495546998518367e+180
+    6.526509208884021e-38  2.7495546998518367e+180
+  66 30 64 38 63 63 33 64  62 36 38 63 33 64 37 36
+   4.795299385287498e+174   1.6005051595363953e-47
+   4.795299385287498e+174   1.6005051595363953e-47
+  36 61 62 39 33 30 36 63  64 66 63 63 30 61 39 63
+   8.373774110000303e+169   9.578182506016938e+169
+   8.373774110000303e+169   9.578182506016938e+169
+  38 39 36 31 36 63 38 64  62 62 31 30 30 30 30 30
+   6.031781458502642e+174    1.398043286119339e-76
+   6.031781458502642e+174    1.398043286119339e-76
+  30 30 30 36 63 34 39 33  30 34 35 30 32 32 31 30
+     6.12690830611117e-62   1.4850823079649383e-76
+     6.12690830611117e-62   1.4850823079649383e-76
+  30 63 37 62 62 30 66 61  65 61 30 35 32 32 65 37
+   1.559787557116487e+161    7.603720295825931e-42
+   1.559787557116487e+161    7.603720295825931e-42
+  34 66 66 32 32 30 63 32  30 63 30 32 32 64 32 63
+    5.693858724700519e-66   6.940841831361442e+169
+    5.693858724700519e-66   6.940841831361442e+169
+  62 36 30 33 33 66 38 64  31 36 37 66 62 38 39 65
+   6.034668568895557e+174   4.087961955424709e+179
+   6.034668568895557e+174   4.087961955424709e+179
+  37 35 61 35 30 65 32 33  37 61 33 35 66 64 36 64
+    4.471641666796879e-62    5.53826799893798e+174
+    4.471641666796879e-62    5.53826799893798e+174
+  32 30 32 32 30 33 30 36  34 37 31 33 34 39 31 62
+   1.1084458443288575e-47   9.918314138124876e+164
+   1.1084458443288575e-47   9.918314138124876e+164
+  31 66 38 61 64 35 66 37  39 65 36 32 33 64 30 32
+    7.966931230675307e-42    6.079910466258993e-67
+    7.966931230675307e-42    6.079910466258993e-67
+  31 39 61 64 33 32 35 31  30 62 66 61 61 31 30 30
+   1.1996565579376775e-71   1.3984454607119366e-76
+   1.1996565579376775e-71   1.3984454607119366e-76
+  39 61 62 33 30 63 62 65  65 37 37 62 35 39 33 31
+   2.384344613082279e+180    1.088009890790563e-71
+   2.384344613082279e+180    1.088009890790563e-71
+  37 64 36 65 33 30 30 30  31 32 31 30 32 33 37 61
+   1.3980475123648022e-76    2.03856895661832e+160
+   1.3980475123648022e-76    2.03856895661832e+160
+  66 31 33 65 62 32 64 38  34 65 34 35 34 35 61 66
+    4.748248127240536e-37  1.4623569856006837e+185
+    4.748248127240536e-37  1.4623569856006837e+185
+  32 38 37 62 39 31 39 63  32 32 38 32 30 31 39 63
+   9.507472511661768e+169   9.507419604521355e+169
+   9.507472511661768e+169   9.507419604521355e+169
+  39 36 39 31 63 63 35 30  39 65 37 38 65 31 39 36
+   1.8471237927342518e-76   1.7237716397268159e-47
+   1.8471237927342518e-76   1.7237716397268159e-47
+  61 39 64 38 32 37 34 65  64 31 62 65 30 66 66 66
+     3.2767573687341e+179   1.903528538031499e+185
+     3.2767573687341e+179   1.903528538031499e+185
+  66 66 66 66 66 30 31 30  30 30 30 30 30 30 30 30
+    1.484476410540531e-76    1.398043286095289e-76
+    1.484476410540531e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 31  39 37 36 61 39 31 34 66
+    9.162216479754085e-72   2.144977604623946e+184
+    9.162216479754085e-72   2.144977604623946e+184
+  31 62 33 65 64 32 65 64  61 39 61 32 65 62 65 35
+   4.194099230496388e+175    1.786104805528937e-51
+   4.194099230496388e+175    1.786104805528937e-51
+  61 39 33 37 34 66 36 39  32 38 37 37 63 64 66 38
+   4.3139355968052105e-33    5.264366558595628e-37
+   4.3139355968052105e-33    5.264366558595628e-37
+  37 63 30 66 39 35 62 38  38 61 63 30 30 30 30 30
+    4.280658385368967e-37     1.39804328712463e-76
+    4.280658385368967e-37     1.39804328712463e-76
+  30 30 30 22 2c 20 22 50  32 53 48 22 5d 2c 0a 0a
+   1.0494047973278671e+78   2.659819575045378e-260
+   1.0494047973278671e+78   2.659819575045378e-260
+  5b 22 43 48 45 43 4b 53  45 51 55 45 4e 43 45 56
+   1.7771281712246449e+93  3.9013169354942144e+107
+   1.7771281712246449e+93  3.9013169354942144e+107
+  45 52 49 46 59 20 74 65  73 74 73 22 5d 2c 0a 0a
+   5.219665836472721e+180  2.6598195760658763e-260
+   5.219665836472721e+180  2.6598195760658763e-260
+  5b 22 42 79 2d 68 65 69  67 68 74 20 6c 6f 63 6b
+   5.120611331638222e+199  1.9967191951720833e+209
+   5.120611331638222e+199  1.9967191951720833e+209
+  73 2c 20 77 69 74 68 20  61 72 67 75 6d 65 6e 74
+   1.459133925609568e-152   6.964111143842559e+252
+   1.459133925609568e-152   6.964111143842559e+252
+  20 3d 3d 20 30 20 61 6e  64 20 3d 3d 20 74 78 69
+    4.95240323472605e+223  1.1698771081081452e+200
+    4.95240323472605e+223  1.1698771081081452e+200
+  6e 2e 6e 53 65 71 75 65  6e 63 65 22 5d 2c 0a 5b
+    5.56111654142569e+180   3.628495247018636e+130
+    5.56111654142569e+180   3.628495247018636e+130
+  5b 5b 22 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432858171725e-76    1.398043286095289e-76
+   1.3980432858171725e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  31 30 30 22 2c 20 30 2c  20 22 30 20 43 48 45 43
+    7.549518397495304e-96        11980855301915712
+    7.549518397495304e-96        11980855301915712
+  4b 53 45 51 55 45 4e 43  45 56 45 52 49 46 59 20
+        17040964078708374   7.540250107217763e-153
+        17040964078708374   7.540250107217763e-153
+  31 22 5d 5d 2c 0a 22 30  32 30 30 30 30 30 30 30
+     7.78971152971537e-77   1.3980432860952895e-76
+     7.78971152971537e-77   1.3980432860952895e-76
+  31 30 30 30 31 30 30 30  30 30 30 30 30 30 30 30
+    1.398044603870032e-76    1.398043286095289e-76
+    1.398044603870032e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 31 30 30 30  30 30 30 30 30 30 30 30
+   1.3980446038700318e-76    1.398043286095289e-76
+   1.3980446038700318e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 22
+    1.398043286095289e-76     5.1856307557119e-144
+    1.398043286095289e-76     5.1856307557119e-144
+  2c 20 22 50 32 53 48 2c  43 48 45 43 4b 53 45 51
+   2.2776342793000827e-95   3.2365724542314233e+83
+   2.2776342793000827e-95   3.2365724542314233e+83
+  55 45 4e 43 45 56 45 52  49 46 59 22 5d 2c 0a 5b
+   2.1222766188881694e+88   3.628495246627624e+130
+   2.1222766188881694e+88   3.628495246627624e+130
+  5b 5b 22 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432858171725e-76    1.398043286095289e-76
+   1.3980432858171725e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  31 30 30 22 2c 20 30 2c  20 22 36 35 35 33 35 20
+    7.549518397495304e-96   1.581170520061376e-153
+    7.549518397495304e-96   1.581170520061376e-153
+  43 48 45 43 4b 53 45 51  55 45 4e 43 45 56 45 52
+   3.2365724542314233e+83   2.1222766188881694e+88
+   3.2365724542314233e+83   2.1222766188881694e+88
+  49 46 59 20 31 22 5d 5d  2c 0a 22 30 32 30 30 30
+   5.551004350505541e+141   1.3980459213602817e-76
+   5.551004350505541e+141   1.3980459213602817e-76
+  30 30 30 30 31 30 30 30  31 30 30 30 30 30 30 30
+   1.3980446038700318e-76   1.3980432860952892e-76
+   1.3980446038700318e-76   1.3980432860952892e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 66
+    1.398043286095289e-76   1.719637360272639e+184
+    1.398043286095289e-76   1.719637360272639e+184
+  66 66 66 30 30 30 30 30  31 30 30 30 30 30 30 30
+   1.3980432871853598e-76   1.3980432860952892e-76
+   1.3980432871853598e-76   1.3980432860952892e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 22 2c 20 22 50  32 53 48 2c 43 48 45 43
+   1.0494047973278671e+78        11980855707739748
+   1.0494047973278671e+78        11980855707739748
+  4b 53 45 51 55 45 4e 43  45 56 45 52 49 46 59 22
+        17040964078708374  3.2385127614160786e-143
+        17040964078708374  3.2385127614160786e-143
+  5d 2c 0a 5b 5b 5b 22 30  30 30 30 30 30 30 30 30
+    7.926648032307966e-77    1.398043286095289e-76
+    7.926648032307966e-77    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 31 30 30 22  2c 20 30 2c 20 22 36 35
+   5.185635643610081e-144   2.3108246986536762e-52
+   5.185635643610081e-144   2.3108246986536762e-52
+  35 33 35 20 43 48 45 43  4b 53 45 51 55 45 4e 43
+        11980855302579818        17040964078708374
+        11980855302579818        17040964078708374
+  45 56 45 52 49 46 59 20  31 22 5d 5d 2c 0a 22 30
+   7.540250107217763e-153     7.78971152971537e-77
+   7.540250107217763e-153     7.78971152971537e-77
+  32 30 30 30 30 30 30 30  31 30 30 30 31 30 30 30
+   1.3980432860952895e-76    1.398044603870032e-76
+   1.3980432860952895e-76    1.398044603870032e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 66 66 66 66 62  66 37 66 30 31 30 30 30
+  1.0319428499556514e+166    1.398044604956411e-76
+  1.0319428499556514e+166    1.398044604956411e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 22  2c 20 22 50 32 53 48 2c
+     5.1856307557119e-144   2.2776342793000827e-95
+     5.1856307557119e-144   2.2776342793000827e-95
+  43 48 45 43 4b 53 45 51  55 45 4e 43 45 56 45 52
+   3.2365724542314233e+83   2.1222766188881694e+88
+   3.2365724542314233e+83   2.1222766188881694e+88
+  49 46 59 22 5d 2c 0a 5b  5b 5b 22 30 30 30 30 30
+   3.628495246627624e+130   1.3980432858171725e-76
+   3.628495246627624e+130   1.3980432858171725e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  31 30 30 22 2c 20 30 2c
+    1.398043286095289e-76    7.549518397495304e-96
+    1.398043286095289e-76    7.549518397495304e-96
+  20 22 30 20 43 48 45 43  4b 53 45 51 55 45 4e 43
+        11980855301915712        17040964078708374
+        11980855301915712        17040964078708374
+  45 56 45 52 49 46 59 20  31 22 5d 5d 2c 0a 22 30
+   7.540250107217763e-153     7.78971152971537e-77
+   7.540250107217763e-153     7.78971152971537e-77
+  32 30 30 30 30 30 30 30  31 30 30 30 31 30 30 30
+   1.3980432860952895e-76    1.398044603870032e-76
+   1.3980432860952895e-76    1.398044603870032e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 66 66 66 66 62  66 37 66 30 31 30 30 30
+  1.0319428499556514e+166    1.398044604956411e-76
+  1.0319428499556514e+166    1.398044604956411e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 22  2c 20 22 50 32 53 48 2c
+     5.1856307557119e-144   2.2776342793000827e-95
+     5.1856307557119e-144   2.2776342793000827e-95
+  43 48 45 43 4b 53 45 51  55 45 4e 43 45 56 45 52
+   3.2365724542314233e+83   2.1222766188881694e+88
+   3.2365724542314233e+83   2.1222766188881694e+88
+  49 46 59 22 5d 2c 0a 0a  5b 22 42 79 2d 74 69 6d
+  2.6598195754464224e-260  1.1231553093746003e+219
+  2.6598195754464224e-260  1.1231553093746003e+219
+  65 20 6c 6f 63 6b 73 2c  20 77 69 74 68 20 61 72
+   1.4546519756781506e-94   9.136029999700328e+242
+   1.4546519756781506e-94   9.136029999700328e+242
+  67 75 6d 65 6e 74 20 3d  3d 20 30 20 61 6e 64 20
+    2.922961341829356e-14  1.2190609906017864e-152
+    2.922961341829356e-14  1.2190609906017864e-152
+  3d 3d 20 74 78 69 6e 2e  6e 53 65 71 75 65 6e 63
+    4.892109115331753e-85   9.177166555100818e+170
+    4.892109115331753e-85   9.177166555100818e+170
+  65 22 5d 2c 0a 5b 5b 5b  22 30 30 30 30 30 30 30
+  1.2135697532664598e+132   1.3980432860952846e-76
+  1.2135697532664598e+132   1.3980432860952846e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 31 30  30 22 2c 20 30 2c 20 22
+   1.4844049716462333e-76  2.5903126210889466e-144
+   1.4844049716462333e-76  2.5903126210889466e-144
+  34 31 39 34 33 30 34 20  43 48 45 43 4b 53 45 51
+   1.505710807947578e-153   3.2365724542314233e+83
+   1.505710807947578e-153   3.2365724542314233e+83
+  55 45 4e 43 45 56 45 52  49 46 59 20 31 22 5d 5d
+   2.1222766188881694e+88   5.551004350505541e+141
+   2.1222766188881694e+88   5.551004350505541e+141
+  2c 0a 22 30 32 30 30 30  30 30 30 30 31 30 30 30
+   1.3980459213602817e-76   1.3980446038700318e-76
+   1.3980459213602817e-76   1.3980446038700318e-76
+  31 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432860952892e-76    1.398043286095289e-76
+   1.3980432860952892e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 34 30 30 30 30
+    1.398043286095289e-76   1.3980433066855192e-76
+    1.398043286095289e-76   1.3980433066855192e-76
+  31 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432860952892e-76    1.398043286095289e-76
+   1.3980432860952892e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 22 2c 20 22 50
+    1.398043286095289e-76   1.0494047973278671e+78
+    1.398043286095289e-76   1.0494047973278671e+78
+  32 53 48 2c 43 48 45 43  4b 53 45 51 55 45 4e 43
+        11980855707739748        17040964078708374
+        11980855707739748        17040964078708374
+  45 56 45 52 49 46 59 22  5d 2c 0a 5b 5b 5b 22 30
+  3.2385127614160786e-143    7.926648032307966e-77
+  3.2385127614160786e-143    7.926648032307966e-77
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 31 30 30 22
+    1.398043286095289e-76   5.185635643610081e-144
+    1.398043286095289e-76   5.185635643610081e-144
+  2c 20 30 2c 20 22 34 32  35 39 38 33 39 20 43 48
+    7.467857286079477e-67   1.3016394534282512e+40
+    7.467857286079477e-67   1.3016394534282512e+40
+  45 43 4b 53 45 51 55 45  4e 43 45 56 45 52 49 46
+   1.0308493089730253e+26   4.0123313138894097e+30
+   1.0308493089730253e+26   4.0123313138894097e+30
+  59 20 31 22 5d 5d 2c 0a  22 30 32 30 30 30 30 30
+  1.1530070992334554e-259      1.3980432861355e-76
+  1.1530070992334554e-259      1.3980432861355e-76
+  30 30 31 30 30 30 31 30  30 30 30 30 30 30 30 30
+    1.484404971666341e-76    1.398043286095289e-76
+    1.484404971666341e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 66 66 66
+    1.398043286095289e-76  1.9035282685797734e+185
+    1.398043286095289e-76  1.9035282685797734e+185
+  66 34 30 30 30 30 31 30  30 30 30 30 30 30 30 30
+    1.484404971646564e-76    1.398043286095289e-76
+    1.484404971646564e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 22 2c 20 22 50 32 53  48 2c 43 48 45 43 4b 53
+    5.968685125563565e+92   1.7771281712252333e+93
+    5.968685125563565e+92   1.7771281712252333e+93
+  45 51 55 45 4e 43 45 56  45 52 49 46 59 22 5d 2c
+  3.9013169354942144e+107    5.455871076307772e-95
+  3.9013169354942144e+107    5.455871076307772e-95
+  0a 5b 5b 5b 22 30 30 30  30 30 30 30 30 30 30 30
+   1.3980250594618592e-76    1.398043286095289e-76
+   1.3980250594618592e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 31 30 30 22 2c 20  30 2c 20 22 34 32 35 39
+  1.0491479271388595e-153    4.082221908448644e-33
+  1.0491479271388595e-153    4.082221908448644e-33
+  38 33 39 20 43 48 45 43  4b 53 45 51 55 45 4e 43
+        11980855303104112        17040964078708374
+        11980855303104112        17040964078708374
+  45 56 45 52 49 46 59 20  31 22 5d 5d 2c 0a 22 30
+   7.540250107217763e-153     7.78971152971537e-77
+   7.540250107217763e-153     7.78971152971537e-77
+  32 30 30 30 30 30 30 30  31 30 30 30 31 30 30 30
+   1.3980432860952895e-76    1.398044603870032e-76
+   1.3980432860952895e-76    1.398044603870032e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 66 66 66 66 66  66 37 66 30 31 30 30 30
+  1.9035985651826358e+185    1.398044604956411e-76
+  1.9035985651826358e+185    1.398044604956411e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 22  2c 20 22 50 32 53 48 2c
+     5.1856307557119e-144   2.2776342793000827e-95
+     5.1856307557119e-144   2.2776342793000827e-95
+  43 48 45 43 4b 53 45 51  55 45 4e 43 45 56 45 52
+   3.2365724542314233e+83   2.1222766188881694e+88
+   3.2365724542314233e+83   2.1222766188881694e+88
+  49 46 59 22 5d 2c 0a 5b  5b 5b 22 30 30 30 30 30
+   3.628495246627624e+130   1.3980432858171725e-76
+   3.628495246627624e+130   1.3980432858171725e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  31 30 30 22 2c 20 30 2c
+    1.398043286095289e-76    7.549518397495304e-96
+    1.398043286095289e-76    7.549518397495304e-96
+  20 22 34 31 39 34 33 30  34 20 43 48 45 43 4b 53
+   1.6584896092844255e-76   1.7771281712245173e+93
+   1.6584896092844255e-76   1.7771281712245173e+93
+  45 51 55 45 4e 43 45 56  45 52 49 46 59 20 31 22
+  3.9013169354942144e+107   5.486144045743075e-144
+  3.9013169354942144e+107   5.486144045743075e-144
+  5d 5d 2c 0a 22 30 32 30  30 30 30 30 30 30 31 30
+   1.5707480126667065e-76   1.4844049716462333e-76
+   1.5707480126667065e-76   1.4844049716462333e-76
+  30 30 31 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432861153965e-76    1.398043286095289e-76
+   1.3980432861153965e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 66 66 66 66 66 66 37
+    1.398043286095289e-76    8.035605913824162e-42
+    1.398043286095289e-76    8.035605913824162e-42
+  66 30 31 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286115413e-76    1.398043286095289e-76
+    1.398043286115413e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 22 2c 20
+    1.398043286095289e-76  1.0491479271301769e-153
+    1.398043286095289e-76  1.0491479271301769e-153
+  22 50 32 53 48 2c 43 48  45 43 4b 53 45 51 55 45
+   1.3048453072224773e+40   1.0308493089730253e+26
+   1.3048453072224773e+40   1.0308493089730253e+26
+  4e 43 45 56 45 52 49 46  59 22 5d 2c 0a 0a 5b 22
+   4.0123313138894097e+30   3.464624686628588e-143
+   4.0123313138894097e+30   3.464624686628588e-143
+  55 70 70 65 72 20 73 65  71 75 65 6e 63 65 20 77
+   4.960420527142945e+180   6.608537848284079e+265
+   4.960420527142945e+180   6.608537848284079e+265
+  69 74 68 20 75 70 70 65  72 20 73 65 71 75 65 6e
+   4.263442388697275e+180   6.205423833667479e+223
+   4.263442388697275e+180   6.205423833667479e+223
+  63 65 20 69 73 20 66 69  6e 65 22 5d 2c 0a 5b 5b
+    5.29279396059375e+199  1.1995562572248462e+132
+    5.29279396059375e+199  1.1995562572248462e+132
+  5b 22 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432860942024e-76    1.398043286095289e-76
+   1.3980432860942024e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 31
+    1.398043286095289e-76    9.162216479754085e-72
+    1.398043286095289e-76    9.162216479754085e-72
+  30 30 22 2c 20 30 2c 20  22 32 31 34 37 34 38 33
+  1.0511782037414344e-153    5.883658537827944e-62
+  1.0511782037414344e-153    5.883658537827944e-62
+  36 34 38 20 43 48 45 43  4b 53 45 51 55 45 4e 43
+        11980855302973548        17040964078708374
+        11980855302973548        17040964078708374
+  45 56 45 52 49 46 59 20  31 22 5d 5d 2c 0a 22 30
+   7.540250107217763e-153     7.78971152971537e-77
+   7.540250107217763e-153     7.78971152971537e-77
+  32 30 30 30 30 30 30 30  31 30 30 30 31 30 30 30
+   1.3980432860952895e-76    1.398044603870032e-76
+   1.3980432860952895e-76    1.398044603870032e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 38 30 30 31 30 30 30
+    1.398043286095289e-76     1.39804460387066e-76
+    1.398043286095289e-76     1.39804460387066e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 22  2c 20 22 50 32 53 48 2c
+     5.1856307557119e-144   2.2776342793000827e-95
+     5.1856307557119e-144   2.2776342793000827e-95
+  43 48 45 43 4b 53 45 51  55 45 4e 43 45 56 45 52
+   3.2365724542314233e+83   2.1222766188881694e+88
+   3.2365724542314233e+83   2.1222766188881694e+88
+  49 46 59 22 5d 2c 0a 5b  5b 5b 22 30 30 30 30 30
+   3.628495246627624e+130   1.3980432858171725e-76
+   3.628495246627624e+130   1.3980432858171725e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  31 30 30 22 2c 20 30 2c
+    1.398043286095289e-76    7.549518397495304e-96
+    1.398043286095289e-76    7.549518397495304e-96
+  20 22 34 32 39 34 39 36  37 32 39 35 20 43 48 45
+   1.7245275064745288e-47    5.866242471213099e+25
+   1.7245275064745288e-47    5.866242471213099e+25
+  43 4b 53 45 51 55 45 4e  43 45 56 45 52 49 46 59
+    1.150287715341693e+69  1.1509816729231695e+122
+    1.150287715341693e+69  1.1509816729231695e+122
+  20 31 22 5d 5d 2c 0a 22  30 32 30 30 30 30 30 30
+  1.0480224142302541e-144    1.398043286095446e-76
+  1.0480224142302541e-144    1.398043286095446e-76
+  30 31 30 30 30 31 30 30  30 30 30 30 30 30 30 30
+   1.3983806364295508e-76    1.398043286095289e-76
+   1.3983806364295508e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 38 30 30 31 30 30  30 30 30 30 30 30 30 30
+   1.3983806365903334e-76    1.398043286095289e-76
+   1.3983806365903334e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  22 2c 20 22 50 32 53 48  2c 43 48 45 43 4b 53 45
+    2.612896978874658e+40    9.330003593224064e+25
+    2.612896978874658e+40    9.330003593224064e+25
+  51 55 45 4e 43 45 56 45  52 49 46 59 22 5d 2c 0a
+    1.076938115628028e+26   1.152970637348911e-259
+    1.076938115628028e+26   1.152970637348911e-259
+  5b 5b 5b 22 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043214897502e-76    1.398043286095289e-76
+    1.398043214897502e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 31 30 30 22 2c 20 30  2c 20 22 32 31 34 37 34
+    6.983377179561166e-77      3.6965906634955e-57
+    6.983377179561166e-77      3.6965906634955e-57
+  38 33 36 34 38 20 43 48  45 43 4b 53 45 51 55 45
+   1.3016384189932995e+40   1.0308493089730253e+26
+   1.3016384189932995e+40   1.0308493089730253e+26
+  4e 43 45 56 45 52 49 46  59 20 31 22 5d 5d 2c 0a
+   4.0123313138894097e+30  1.1530070992334554e-259
+   4.0123313138894097e+30  1.1530070992334554e-259
+  22 30 32 30 30 30 30 30  30 30 31 30 30 30 31 30
+      1.3980432861355e-76    1.484404971666341e-76
+      1.3980432861355e-76    1.484404971666341e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 66 65 66  66 66 66 66 66 30 31 30
+  1.8185461897290906e+185    1.484476410540531e-76
+  1.8185461897290906e+185    1.484476410540531e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 22 2c 20 22 50 32 53
+    1.398043286095289e-76    5.968685125563565e+92
+    1.398043286095289e-76    5.968685125563565e+92
+  48 2c 43 48 45 43 4b 53  45 51 55 45 4e 43 45 56
+   1.7771281712252333e+93  3.9013169354942144e+107
+   1.7771281712252333e+93  3.9013169354942144e+107
+  45 52 49 46 59 22 5d 2c  0a 5b 5b 5b 22 30 30 30
+    5.455871076307772e-95   1.3980250594618592e-76
+    5.455871076307772e-95   1.3980250594618592e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 31 30 30 22 2c 20
+    1.398043286095289e-76  1.0491479271388595e-153
+    1.398043286095289e-76  1.0491479271388595e-153
+  30 2c 20 22 34 32 39 34  39 36 37 32 39 35 20 43
+   4.0139715832609196e-57       2281059699628828.5
+   4.0139715832609196e-57       2281059699628828.5
+  48 45 43 4b 53 45 51 55  45 4e 43 45 56 45 52 49
+   9.670547113841522e+102    1.629814070610404e+45
+   9.670547113841522e+102    1.629814070610404e+45
+  46 59 20 31 22 5d 5d 2c  0a 22 30 32 30 30 30 30
+    5.498872883248109e-95   1.3980432963892927e-76
+    5.498872883248109e-95   1.3980432963892927e-76
+  30 30 30 31 30 30 30 31  30 30 30 30 30 30 30 30
+    9.162216513489118e-72    1.398043286095289e-76
+    9.162216513489118e-72    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 66 65
+    1.398043286095289e-76  2.8772008687167472e+180
+    1.398043286095289e-76  2.8772008687167472e+180
+  66 66 66 66 66 66 30 31  30 30 30 30 30 30 30 30
+     9.28207105579738e-72    1.398043286095289e-76
+     9.28207105579738e-72    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 22 2c 20 22 50 32  53 48 2c 43 48 45 43 4b
+    2.393669929840339e-66   3.6915200626157174e+54
+    2.393669929840339e-66   3.6915200626157174e+54
+  53 45 51 55 45 4e 43 45  56 45 52 49 46 59 22 5d
+    4.667842826290812e+25   4.370126139089802e+140
+    4.667842826290812e+25   4.370126139089802e+140
+  2c 0a 5b 5b 5b 22 30 30  30 30 30 30 30 30 30 30
+   1.3933772679372857e-76    1.398043286095289e-76
+   1.3933772679372857e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 31 30 30 22 2c  20 30 2c 20 22 32 31 34
+    4.257571569454917e-96    2.739454280233325e-57
+    4.257571569454917e-96    2.739454280233325e-57
+  37 34 38 33 36 34 38 20  43 48 45 43 4b 53 45 51
+   1.805213212629597e-153   3.2365724542314233e+83
+   1.805213212629597e-153   3.2365724542314233e+83
+  55 45 4e 43 45 56 45 52  49 46 59 20 31 22 5d 5d
+   2.1222766188881694e+88   5.551004350505541e+141
+   2.1222766188881694e+88   5.551004350505541e+141
+  2c 0a 22 30 32 30 30 30  30 30 30 30 31 30 30 30
+   1.3980459213602817e-76   1.3980446038700318e-76
+   1.3980459213602817e-76   1.3980446038700318e-76
+  31 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432860952892e-76    1.398043286095289e-76
+   1.3980432860952892e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 66  66 66 66 66 66 66 66 30
+   1.719637360272639e+184   1.5476014050729244e-75
+   1.719637360272639e+184   1.5476014050729244e-75
+  31 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432860952892e-76    1.398043286095289e-76
+   1.3980432860952892e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 22 2c 20 22 50
+    1.398043286095289e-76   1.0494047973278671e+78
+    1.398043286095289e-76   1.0494047973278671e+78
+  32 53 48 2c 43 48 45 43  4b 53 45 51 55 45 4e 43
+        11980855707739748        17040964078708374
+        11980855707739748        17040964078708374
+  45 56 45 52 49 46 59 22  5d 2c 0a 5b 5b 5b 22 30
+  3.2385127614160786e-143    7.926648032307966e-77
+  3.2385127614160786e-143    7.926648032307966e-77
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 31 30 30 22
+    1.398043286095289e-76   5.185635643610081e-144
+    1.398043286095289e-76   5.185635643610081e-144
+  2c 20 30 2c 20 22 34 32  39 34 39 36 37 32 39 35
+    7.467857286079477e-67   2.6306013211503946e-52
+    7.467857286079477e-67   2.6306013211503946e-52
+  20 43 48 45 43 4b 53 45  51 55 45 4e 43 45 56 45
+    9.330003593224043e+25    1.076938115628028e+26
+    9.330003593224043e+25    1.076938115628028e+26
+  52 49 46 59 20 31 22 5d  5d 2c 0a 22 30 32 30 30
+   4.332774123520774e+140   1.3987179139334584e-76
+   4.332774123520774e+140   1.3987179139334584e-76
+  30 30 30 30 30 31 30 30  30 31 30 30 30 30 30 30
+   1.3983806364294722e-76   1.3980432860953674e-76
+   1.3983806364294722e-76   1.3980432860953674e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  66 66 66 66 66 66 66 66  30 31 30 30 30 30 30 30
+  1.9035985662552932e+185   1.3980432860953674e-76
+  1.9035985662552932e+185   1.3980432860953674e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 22 2c 20 22  50 32 53 48 2c 43 48 45
+     2.5902785586997e-144   5.8662870186814245e+25
+     2.5902785586997e-144   5.8662870186814245e+25
+  43 4b 53 45 51 55 45 4e  43 45 56 45 52 49 46 59
+    1.150287715341693e+69  1.1509816729231695e+122
+    1.150287715341693e+69  1.1509816729231695e+122
+  22 5d 2c 0a 0a 5b 22 41  72 67 75 6d 65 6e 74 20
+        601477.0198697189  2.4381298143520567e-152
+        601477.0198697189  2.4381298143520567e-152
+  32 5e 33 31 20 77 69 74  68 20 76 61 72 69 6f 75
+   5.834394250249015e+252  4.7165075918953724e+257
+   5.834394250249015e+252  4.7165075918953724e+257
+  73 20 6e 53 65 71 75 65  6e 63 65 22 5d 2c 0a 5b
+   5.561116541422393e+180   3.628495247018636e+130
+   5.561116541422393e+180   3.628495247018636e+130
+  5b 5b 22 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432858171725e-76    1.398043286095289e-76
+   1.3980432858171725e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  31 30 30 22 2c 20 30 2c  20 22 32 31 34 37 34 38
+    7.549518397495304e-96    5.940842695510089e-38
+    7.549518397495304e-96    5.940842695510089e-38
+  33 36 34 38 20 43 48 45  43 4b 53 45 51 55 45 4e
+   5.8662425141670565e+25    1.150287715341693e+69
+   5.8662425141670565e+25    1.150287715341693e+69
+  43 45 56 45 52 49 46 59  20 31 22 5d 5d 2c 0a 22
+  1.1509816729231695e+122  1.0480224142302541e-144
+  1.1509816729231695e+122  1.0480224142302541e-144
+  30 32 30 30 30 30 30 30  30 31 30 30 30 31 30 30
+    1.398043286095446e-76   1.3983806364295508e-76
+    1.398043286095446e-76   1.3983806364295508e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 66 66 66 66  62 66 37 66 30 31 30 30
+  1.9035982916549982e+185   1.3983809145425924e-76
+  1.9035982916549982e+185   1.3983809145425924e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  22 2c 20 22 50 32 53 48
+    1.398043286095289e-76    2.612896978874658e+40
+    1.398043286095289e-76    2.612896978874658e+40
+  2c 43 48 45 43 4b 53 45  51 55 45 4e 43 45 56 45
+    9.330003593224064e+25    1.076938115628028e+26
+    9.330003593224064e+25    1.076938115628028e+26
+  52 49 46 59 22 5d 2c 0a  5b 5b 5b 22 30 30 30 30
+   1.152970637348911e-259    1.398043214897502e-76
+   1.152970637348911e-259    1.398043214897502e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 31 30 30 22 2c 20 30
+    1.398043286095289e-76    6.983377179561166e-77
+    1.398043286095289e-76    6.983377179561166e-77
+  2c 20 22 32 31 34 37 34  38 33 36 34 38 20 43 48
+      3.6965906634955e-57   1.3016384189932995e+40
+      3.6965906634955e-57   1.3016384189932995e+40
+  45 43 4b 53 45 51 55 45  4e 43 45 56 45 52 49 46
+   1.0308493089730253e+26   4.0123313138894097e+30
+   1.0308493089730253e+26   4.0123313138894097e+30
+  59 20 31 22 5d 5d 2c 0a  22 30 32 30 30 30 30 30
+  1.1530070992334554e-259      1.3980432861355e-76
+  1.1530070992334554e-259      1.3980432861355e-76
+  30 30 31 30 30 30 31 30  30 30 30 30 30 30 30 30
+    1.484404971666341e-76    1.398043286095289e-76
+    1.484404971666341e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 66 66 66
+    1.398043286095289e-76  1.9035282685797734e+185
+    1.398043286095289e-76  1.9035282685797734e+185
+  66 66 66 37 66 30 31 30  30 30 30 30 30 30 30 30
+   1.4844761686053242e-76    1.398043286095289e-76
+   1.4844761686053242e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 22 2c 20 22 50 32 53  48 2c 43 48 45 43 4b 53
+    5.968685125563565e+92   1.7771281712252333e+93
+    5.968685125563565e+92   1.7771281712252333e+93
+  45 51 55 45 4e 43 45 56  45 52 49 46 59 22 5d 2c
+  3.9013169354942144e+107    5.455871076307772e-95
+  3.9013169354942144e+107    5.455871076307772e-95
+  0a 5b 5b 5b 22 30 30 30  30 30 30 30 30 30 30 30
+   1.3980250594618592e-76    1.398043286095289e-76
+   1.3980250594618592e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 31 30 30 22 2c 20  30 2c 20 22 32 31 34 37
+  1.0491479271388595e-153    9.054482728600594e-43
+  1.0491479271388595e-153    9.054482728600594e-43
+  34 38 33 36 34 38 20 43  48 45 43 4b 53 45 51 55
+         2282698263075866   9.670547113841522e+102
+         2282698263075866   9.670547113841522e+102
+  45 4e 43 45 56 45 52 49  46 59 20 31 22 5d 5d 2c
+    1.629814070610404e+45    5.498872883248109e-95
+    1.629814070610404e+45    5.498872883248109e-95
+  0a 22 30 32 30 30 30 30  30 30 30 31 30 30 30 31
+   1.3980432963892927e-76    9.162216513489118e-72
+   1.3980432963892927e-76    9.162216513489118e-72
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 66 66  66 66 66 66 66 66 30 31
+  1.8856023613222075e+185     9.28207105579738e-72
+  1.8856023613222075e+185     9.28207105579738e-72
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 22 2c 20 22 50 32
+    1.398043286095289e-76    2.393669929840339e-66
+    1.398043286095289e-76    2.393669929840339e-66
+  53 48 2c 43 48 45 43 4b  53 45 51 55 45 4e 43 45
+   3.6915200626157174e+54    4.667842826290812e+25
+   3.6915200626157174e+54    4.667842826290812e+25
+  56 45 52 49 46 59 22 5d  2c 0a 0a 5b 22 41 72 67
+   4.370126139089802e+140  2.0333192151259715e+190
+   4.370126139089802e+140  2.0333192151259715e+190
+  75 6d 65 6e 74 20 32 5e  33 32 2d 31 20 77 69 74
+   5.658723857188303e+145   5.834394249919782e+252
+   5.658723857188303e+145   5.834394249919782e+252
+  68 20 76 61 72 69 6f 75  73 20 6e 53 65 71 75 65
+  4.7165075918953724e+257   5.561116541422393e+180
+  4.7165075918953724e+257   5.561116541422393e+180
+  6e 63 65 22 5d 2c 0a 5b  5b 5b 22 30 30 30 30 30
+   3.628495247018636e+130   1.3980432858171725e-76
+   3.628495247018636e+130   1.3980432858171725e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  31 30 30 22 2c 20 30 2c
+    1.398043286095289e-76    7.549518397495304e-96
+    1.398043286095289e-76    7.549518397495304e-96
+  20 22 34 32 39 34 39 36  37 32 39 35 20 43 48 45
+   1.7245275064745288e-47    5.866242471213099e+25
+   1.7245275064745288e-47    5.866242471213099e+25
+  43 4b 53 45 51 55 45 4e  43 45 56 45 52 49 46 59
+    1.150287715341693e+69  1.1509816729231695e+122
+    1.150287715341693e+69  1.1509816729231695e+122
+  20 31 22 5d 5d 2c 0a 22  30 32 30 30 30 30 30 30
+  1.0480224142302541e-144    1.398043286095446e-76
+  1.0480224142302541e-144    1.398043286095446e-76
+  30 31 30 30 30 31 30 30  30 30 30 30 30 30 30 30
+   1.3983806364295508e-76    1.398043286095289e-76
+   1.3983806364295508e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 66 66 66 66
+    1.398043286095289e-76  1.9035982916549982e+185
+    1.398043286095289e-76  1.9035982916549982e+185
+  62 66 37 66 30 31 30 30  30 30 30 30 30 30 30 30
+   1.3983809145425924e-76    1.398043286095289e-76
+   1.3983809145425924e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  22 2c 20 22 50 32 53 48  2c 43 48 45 43 4b 53 45
+    2.612896978874658e+40    9.330003593224064e+25
+    2.612896978874658e+40    9.330003593224064e+25
+  51 55 45 4e 43 45 56 45  52 49 46 59 22 5d 2c 0a
+    1.076938115628028e+26   1.152970637348911e-259
+    1.076938115628028e+26   1.152970637348911e-259
+  5b 5b 5b 22 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043214897502e-76    1.398043286095289e-76
+    1.398043214897502e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 31 30 30 22 2c 20 30  2c 20 22 34 32 39 34 39
+    6.983377179561166e-77   3.8948894579472946e-33
+    6.983377179561166e-77   3.8948894579472946e-33
+  36 37 32 39 35 20 43 48  45 43 4b 53 45 51 55 45
+   1.3016353238344586e+40   1.0308493089730253e+26
+   1.3016353238344586e+40   1.0308493089730253e+26
+  4e 43 45 56 45 52 49 46  59 20 31 22 5d 5d 2c 0a
+   4.0123313138894097e+30  1.1530070992334554e-259
+   4.0123313138894097e+30  1.1530070992334554e-259
+  22 30 32 30 30 30 30 30  30 30 31 30 30 30 31 30
+      1.3980432861355e-76    1.484404971666341e-76
+      1.3980432861355e-76    1.484404971666341e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 66 66 66  66 66 66 37 66 30 31 30
+  1.9035282685797734e+185   1.4844761686053242e-76
+  1.9035282685797734e+185   1.4844761686053242e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 22 2c 20 22 50 32 53
+    1.398043286095289e-76    5.968685125563565e+92
+    1.398043286095289e-76    5.968685125563565e+92
+  48 2c 43 48 45 43 4b 53  45 51 55 45 4e 43 45 56
+   1.7771281712252333e+93  3.9013169354942144e+107
+   1.7771281712252333e+93  3.9013169354942144e+107
+  45 52 49 46 59 22 5d 2c  0a 5b 5b 5b 22 30 30 30
+    5.455871076307772e-95   1.3980250594618592e-76
+    5.455871076307772e-95   1.3980250594618592e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 31 30 30 22 2c 20
+    1.398043286095289e-76  1.0491479271388595e-153
+    1.398043286095289e-76  1.0491479271388595e-153
+  30 2c 20 22 34 32 39 34  39 36 37 32 39 35 20 43
+   4.0139715832609196e-57       2281059699628828.5
+   4.0139715832609196e-57       2281059699628828.5
+  48 45 43 4b 53 45 51 55  45 4e 43 45 56 45 52 49
+   9.670547113841522e+102    1.629814070610404e+45
+   9.670547113841522e+102    1.629814070610404e+45
+  46 59 20 31 22 5d 5d 2c  0a 22 30 32 30 30 30 30
+    5.498872883248109e-95   1.3980432963892927e-76
+    5.498872883248109e-95   1.3980432963892927e-76
+  30 30 30 31 30 30 30 31  30 30 30 30 30 30 30 30
+    9.162216513489118e-72    1.398043286095289e-76
+    9.162216513489118e-72    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 66 66
+    1.398043286095289e-76  1.8856023613222075e+185
+    1.398043286095289e-76  1.8856023613222075e+185
+  66 66 66 66 66 66 30 31  30 30 30 30 30 30 30 30
+     9.28207105579738e-72    1.398043286095289e-76
+     9.28207105579738e-72    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 22 2c 20 22 50 32  53 48 2c 43 48 45 43 4b
+    2.393669929840339e-66   3.6915200626157174e+54
+    2.393669929840339e-66   3.6915200626157174e+54
+  53 45 51 55 45 4e 43 45  56 45 52 49 46 59 22 5d
+    4.667842826290812e+25   4.370126139089802e+140
+    4.667842826290812e+25   4.370126139089802e+140
+  2c 0a 0a 5b 22 41 72 67  75 6d 65 6e 74 20 33 3c
+  2.0333192151259715e+190    1.036864637099685e-18
+  2.0333192151259715e+190    1.036864637099685e-18
+  3c 33 31 20 77 69 74 68  20 76 61 72 69 6f 75 73
+  1.4900547056384775e+195  1.4987322064390613e+248
+  1.4900547056384775e+195  1.4987322064390613e+248
+  20 6e 53 65 71 75 65 6e  63 65 22 5d 2c 0a 5b 5b
+   6.205423831533357e+223  1.1995562572248444e+132
+   6.205423831533357e+223  1.1995562572248444e+132
+  5b 22 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432860942024e-76    1.398043286095289e-76
+   1.3980432860942024e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 31
+    1.398043286095289e-76    9.162216479754085e-72
+    1.398043286095289e-76    9.162216479754085e-72
+  30 30 22 2c 20 30 2c 20  22 36 34 34 32 34 35 30
+  1.0511782037414344e-153   1.8312037714073583e-76
+  1.0511782037414344e-153   1.8312037714073583e-76
+  39 34 34 20 43 48 45 43  4b 53 45 51 55 45 4e 43
+        11980855302449266        17040964078708374
+        11980855302449266        17040964078708374
+  45 56 45 52 49 46 59 20  31 22 5d 5d 2c 0a 22 30
+   7.540250107217763e-153     7.78971152971537e-77
+   7.540250107217763e-153     7.78971152971537e-77
+  32 30 30 30 30 30 30 30  31 30 30 30 31 30 30 30
+   1.3980432860952895e-76    1.398044603870032e-76
+   1.3980432860952895e-76    1.398044603870032e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 66 66 66 66 62  66 37 66 30 31 30 30 30
+  1.0319428499556514e+166    1.398044604956411e-76
+  1.0319428499556514e+166    1.398044604956411e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 22  2c 20 22 50 32 53 48 2c
+     5.1856307557119e-144   2.2776342793000827e-95
+     5.1856307557119e-144   2.2776342793000827e-95
+  43 48 45 43 4b 53 45 51  55 45 4e 43 45 56 45 52
+   3.2365724542314233e+83   2.1222766188881694e+88
+   3.2365724542314233e+83   2.1222766188881694e+88
+  49 46 59 22 5d 2c 0a 5b  5b 5b 22 30 30 30 30 30
+   3.628495246627624e+130   1.3980432858171725e-76
+   3.628495246627624e+130   1.3980432858171725e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  31 30 30 22 2c 20 30 2c
+    1.398043286095289e-76    7.549518397495304e-96
+    1.398043286095289e-76    7.549518397495304e-96
+  20 22 36 34 34 32 34 35  30 39 34 34 20 43 48 45
+   2.1085721719141042e-52   5.8662424565216384e+25
+   2.1085721719141042e-52   5.8662424565216384e+25
+  43 4b 53 45 51 55 45 4e  43 45 56 45 52 49 46 59
+    1.150287715341693e+69  1.1509816729231695e+122
+    1.150287715341693e+69  1.1509816729231695e+122
+  20 31 22 5d 5d 2c 0a 22  30 32 30 30 30 30 30 30
+  1.0480224142302541e-144    1.398043286095446e-76
+  1.0480224142302541e-144    1.398043286095446e-76
+  30 31 30 30 30 31 30 30  30 30 30 30 30 30 30 30
+   1.3983806364295508e-76    1.398043286095289e-76
+   1.3983806364295508e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 66 66 66 66
+    1.398043286095289e-76  1.9035982916549982e+185
+    1.398043286095289e-76  1.9035982916549982e+185
+  66 66 37 66 30 31 30 30  30 30 30 30 30 30 30 30
+   1.3983809145425936e-76    1.398043286095289e-76
+   1.3983809145425936e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  22 2c 20 22 50 32 53 48  2c 43 48 45 43 4b 53 45
+    2.612896978874658e+40    9.330003593224064e+25
+    2.612896978874658e+40    9.330003593224064e+25
+  51 55 45 4e 43 45 56 45  52 49 46 59 22 5d 2c 0a
+    1.076938115628028e+26   1.152970637348911e-259
+    1.076938115628028e+26   1.152970637348911e-259
+  5b 5b 5b 22 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043214897502e-76    1.398043286095289e-76
+    1.398043214897502e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 31 30 30 22 2c 20 30  2c 20 22 36 34 34 32 34
+    6.983377179561166e-77   2.9000520385075734e-57
+    6.983377179561166e-77   2.9000520385075734e-57
+  35 30 39 34 34 20 43 48  45 43 4b 53 45 51 55 45
+   1.3016342652031632e+40   1.0308493089730253e+26
+   1.3016342652031632e+40   1.0308493089730253e+26
+  4e 43 45 56 45 52 49 46  59 20 31 22 5d 5d 2c 0a
+   4.0123313138894097e+30  1.1530070992334554e-259
+   4.0123313138894097e+30  1.1530070992334554e-259
+  22 30 32 30 30 30 30 30  30 30 31 30 30 30 31 30
+      1.3980432861355e-76    1.484404971666341e-76
+      1.3980432861355e-76    1.484404971666341e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 66 66 66  66 66 66 66 66 30 31 30
+  1.9035282685797734e+185    1.484476410540531e-76
+  1.9035282685797734e+185    1.484476410540531e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 22 2c 20 22 50 32 53
+    1.398043286095289e-76    5.968685125563565e+92
+    1.398043286095289e-76    5.968685125563565e+92
+  48 2c 43 48 45 43 4b 53  45 51 55 45 4e 43 45 56
+   1.7771281712252333e+93  3.9013169354942144e+107
+   1.7771281712252333e+93  3.9013169354942144e+107
+  45 52 49 46 59 22 5d 2c  0a 0a 5b 22 35 20 62 79
+    5.455871076307772e-95   5.020459570978685e+276
+    5.455871076307772e-95   5.020459570978685e+276
+  74 65 20 6e 6f 6e 2d 6d  69 6e 69 6d 61 6c 6c 79
+   8.116665033407924e+217   7.872659588354844e+276
+   8.116665033407924e+217   7.872659588354844e+276
+  2d 65 6e 63 6f 64 65 64  20 6f 70 65 72 61 6e 64
+  4.2327777957272344e+175  6.0112470450107896e+175
+  4.2327777957272344e+175  6.0112470450107896e+175
+  73 73 20 61 72 65 20 76  61 6c 69 64 22 5d 2c 0a
+  1.0083968783359081e+261  1.1529706643332613e-259
+  1.0083968783359081e+261  1.1529706643332613e-259
+  5b 5b 5b 22 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043214897502e-76    1.398043286095289e-76
+    1.398043214897502e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 31 30 30 22 2c 20 30  2c 20 22 30 78 30 35 20
+    6.983377179561166e-77  1.5803727226980547e-153
+    6.983377179561166e-77  1.5803727226980547e-153
+  30 78 30 30 30 30 30 30  30 30 30 30 20 43 48 45
+    1.398043286100944e-76    5.866242398648404e+25
+    1.398043286100944e-76    5.866242398648404e+25
+  43 4b 53 45 51 55 45 4e  43 45 56 45 52 49 46 59
+    1.150287715341693e+69  1.1509816729231695e+122
+    1.150287715341693e+69  1.1509816729231695e+122
+  20 31 22 5d 5d 2c 0a 22  30 32 30 30 30 30 30 30
+  1.0480224142302541e-144    1.398043286095446e-76
+  1.0480224142302541e-144    1.398043286095446e-76
+  30 31 30 30 30 31 30 30  30 30 30 30 30 30 30 30
+   1.3983806364295508e-76    1.398043286095289e-76
+   1.3983806364295508e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 31 30 30  30 30 30 30 30 30 30 30
+   1.3983806364294722e-76    1.398043286095289e-76
+   1.3983806364294722e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  22 2c 20 22 50 32 53 48  2c 43 48 45 43 4b 53 45
+    2.612896978874658e+40    9.330003593224064e+25
+    2.612896978874658e+40    9.330003593224064e+25
+  51 55 45 4e 43 45 56 45  52 49 46 59 22 5d 2c 0a
+    1.076938115628028e+26   1.152970637348911e-259
+    1.076938115628028e+26   1.152970637348911e-259
+  0a 5b 22 54 68 65 20 61  72 67 75 6d 65 6e 74 20
+   7.203588354137243e+159  2.4381298143520567e-152
+   7.203588354137243e+159  2.4381298143520567e-152
+  63 61 6e 20 62 65 20 63  61 6c 63 75 6c 61 74 65
+   3.093899782138955e+169    5.28559099911215e+180
+   3.093899782138955e+169    5.28559099911215e+180
+  64 20 72 61 74 68 65 72  20 74 68 61 6e 20 63 72
+   1.141992201591424e+243  1.0202960542715942e+243
+   1.141992201591424e+243  1.0202960542715942e+243
+  65 61 74 65 64 20 64 69  72 65 63 74 6c 79 20 62
+   4.814332585646865e+199   4.743456360166185e+164
+   4.814332585646865e+199   4.743456360166185e+164
+  79 20 61 20 50 55 53 48  44 41 54 41 22 5d 2c 0a
+    2.631506156648208e+40   1.152970579331734e-259
+    2.631506156648208e+40   1.152970579331734e-259
+  5b 5b 5b 22 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043214897502e-76    1.398043286095289e-76
+    1.398043214897502e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 31 30 30 22 2c 20 30  2c 20 22 34 31 39 34 33
+    6.983377179561166e-77    4.916037928445175e-62
+    6.983377179561166e-77    4.916037928445175e-62
+  30 33 20 31 41 44 44 20  43 48 45 43 4b 53 45 51
+   3.023107111215988e-153   3.2365724542314233e+83
+   3.023107111215988e-153   3.2365724542314233e+83
+  55 45 4e 43 45 56 45 52  49 46 59 20 31 22 5d 5d
+   2.1222766188881694e+88   5.551004350505541e+141
+   2.1222766188881694e+88   5.551004350505541e+141
+  2c 0a 22 30 32 30 30 30  30 30 30 30 31 30 30 30
+   1.3980459213602817e-76   1.3980446038700318e-76
+   1.3980459213602817e-76   1.3980446038700318e-76
+  31 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432860952892e-76    1.398043286095289e-76
+   1.3980432860952892e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 34 30 30 30 30
+    1.398043286095289e-76   1.3980433066855192e-76
+    1.398043286095289e-76   1.3980433066855192e-76
+  31 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432860952892e-76    1.398043286095289e-76
+   1.3980432860952892e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 22 2c 20 22 50
+    1.398043286095289e-76   1.0494047973278671e+78
+    1.398043286095289e-76   1.0494047973278671e+78
+  32 53 48 2c 43 48 45 43  4b 53 45 51 55 45 4e 43
+        11980855707739748        17040964078708374
+        11980855707739748        17040964078708374
+  45 56 45 52 49 46 59 22  5d 2c 0a 5b 5b 5b 22 30
+  3.2385127614160786e-143    7.926648032307966e-77
+  3.2385127614160786e-143    7.926648032307966e-77
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 31 30 30 22
+    1.398043286095289e-76   5.185635643610081e-144
+    1.398043286095289e-76   5.185635643610081e-144
+  2c 20 30 2c 20 22 34 31  39 34 33 30 34 20 31 53
+   1.1395045907714045e-71    5.581738119606134e+92
+   1.1395045907714045e-71    5.581738119606134e+92
+  55 42 20 43 48 45 43 4b  53 45 51 55 45 4e 43 45
+   3.6915200620794555e+54    4.667842826290812e+25
+   3.6915200620794555e+54    4.667842826290812e+25
+  56 45 52 49 46 59 20 31  22 5d 5d 2c 0a 22 30 32
+    4.626526274241862e-72    5.984050314124015e-67
+    4.626526274241862e-72    5.984050314124015e-67
+  30 30 30 30 30 30 30 31  30 30 30 31 30 30 30 30
+    9.162216479754085e-72   1.3980432912428464e-76
+    9.162216479754085e-72   1.3980432912428464e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 66 66 66 66 30 30  30 30 30 31 30 30 30 30
+   1.4163316430312308e-76   1.3980432912428464e-76
+   1.4163316430312308e-76   1.3980432912428464e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 22 2c  20 22 50 32 53 48 2c 43
+    4.257571555502434e-96         3980410755748112
+    4.257571555502434e-96         3980410755748112
+  48 45 43 4b 53 45 51 55  45 4e 43 45 56 45 52 49
+   9.670547113841522e+102    1.629814070610404e+45
+   9.670547113841522e+102    1.629814070610404e+45
+  46 59 22 5d 2c 0a 0a 5b  22 41 6e 20 41 44 44 20
+   3.609979819120071e+130  3.0231069627792724e-153
+   3.609979819120071e+130  3.0231069627792724e-153
+  70 72 6f 64 75 63 69 6e  67 20 61 20 35 2d 62 79
+    7.34182468325474e+223   5.034524851949801e+276
+    7.34182468325474e+223   5.034524851949801e+276
+  74 65 20 72 65 73 75 6c  74 20 74 68 61 74 20 73
+  2.8885490683568366e+214  3.5952913883332465e+246
+  2.8885490683568366e+214  3.5952913883332465e+246
+  65 74 73 20 43 54 78 49  6e 3a 3a 53 45 51 55 45
+    8.680930541381717e+45   1.0308493087812335e+26
+    8.680930541381717e+45   1.0308493087812335e+26
+  4e 43 45 5f 4c 4f 43 4b  54 49 4d 45 5f 44 49 53
+    3.699014963829596e+54    1.647038347542641e+93
+    3.699014963829596e+54    1.647038347542641e+93
+  41 42 4c 45 5f 46 4c 41  47 22 5d 2c 0a 5b 5b 5b
+        3706046.541389734   1.213569753266455e+132
+        3706046.541389734   1.213569753266455e+132
+  22 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432860952846e-76    1.398043286095289e-76
+   1.3980432860952846e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 31 30
+    1.398043286095289e-76   1.4844049716462333e-76
+    1.398043286095289e-76   1.4844049716462333e-76
+  30 22 2c 20 30 2c 20 22  32 31 34 37 34 38 33 36
+  2.5903126210889466e-144   1.3150547530373443e-47
+  2.5903126210889466e-144   1.3150547530373443e-47
+  34 37 20 36 35 35 33 36  20 43 48 45 43 4b 53 45
+   1.3142539632764717e-47    9.330003593224043e+25
+   1.3142539632764717e-47    9.330003593224043e+25
+  51 55 45 4e 43 45 56 45  52 49 46 59 20 31 22 5d
+    1.076938115628028e+26   4.332774123520774e+140
+    1.076938115628028e+26   4.332774123520774e+140
+  5d 2c 0a 22 30 32 30 30  30 30 30 30 30 31 30 30
+   1.3987179139334584e-76   1.3983806364294722e-76
+   1.3987179139334584e-76   1.3983806364294722e-76
+  30 31 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432860953674e-76    1.398043286095289e-76
+   1.3980432860953674e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 31 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432860953674e-76    1.398043286095289e-76
+   1.3980432860953674e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 22 2c 20 22
+    1.398043286095289e-76     2.5902785586997e-144
+    1.398043286095289e-76     2.5902785586997e-144
+  50 32 53 48 2c 43 48 45  43 4b 53 45 51 55 45 4e
+   5.8662870186814245e+25    1.150287715341693e+69
+   5.8662870186814245e+25    1.150287715341693e+69
+  43 45 56 45 52 49 46 59  22 5d 2c 0a 5b 5b 5b 22
+  1.1509816729231695e+122  3.5053249760825546e-143
+  1.1509816729231695e+122  3.5053249760825546e-143
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 31 30 30
+    1.398043286095289e-76   1.3983806364294722e-76
+    1.398043286095289e-76   1.3983806364294722e-76
+  22 2c 20 30 2c 20 22 32  31 34 37 34 38 33 36 34
+   3.3615931216432366e-67    3.536676206684838e-57
+   3.3615931216432366e-67    3.536676206684838e-57
+  37 20 34 32 35 39 38 34  30 20 41 44 44 20 43 48
+   3.8590210863767106e-57   1.3016509455825947e+40
+   3.8590210863767106e-57   1.3016509455825947e+40
+  45 43 4b 53 45 51 55 45  4e 43 45 56 45 52 49 46
+   1.0308493089730253e+26   4.0123313138894097e+30
+   1.0308493089730253e+26   4.0123313138894097e+30
+  59 20 31 22 5d 5d 2c 0a  22 30 32 30 30 30 30 30
+  1.1530070992334554e-259      1.3980432861355e-76
+  1.1530070992334554e-259      1.3980432861355e-76
+  30 30 31 30 30 30 31 30  30 30 30 30 30 30 30 30
+    1.484404971666341e-76    1.398043286095289e-76
+    1.484404971666341e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 34 30 30 30 30 31 30  30 30 30 30 30 30 30 30
+   1.4844049716465475e-76    1.398043286095289e-76
+   1.4844049716465475e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 22 2c 20 22 50 32 53  48 2c 43 48 45 43 4b 53
+    5.968685125563565e+92   1.7771281712252333e+93
+    5.968685125563565e+92   1.7771281712252333e+93
+  45 51 55 45 4e 43 45 56  45 52 49 46 59 22 5d 2c
+  3.9013169354942144e+107    5.455871076307772e-95
+  3.9013169354942144e+107    5.455871076307772e-95
+  0a 0a 5b 22 56 61 6c 69  64 20 43 48 45 43 4b 53
+   6.788642032366904e+199   1.7771281712245284e+93
+   6.788642032366904e+199   1.7771281712245284e+93
+  45 51 55 45 4e 43 45 56  45 52 49 46 59 20 69 6e
+  3.9013169354942144e+107   7.266017038891276e+223
+  3.9013169354942144e+107   7.266017038891276e+223
+  20 73 63 72 69 70 74 53  69 67 22 5d 2c 0a 5b 5b
+   1.0658611286722125e+94   1.199556257224926e+132
+   1.0658611286722125e+94   1.199556257224926e+132
+  5b 22 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432860942024e-76    1.398043286095289e-76
+   1.3980432860942024e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 31
+    1.398043286095289e-76    9.162216479754085e-72
+    1.398043286095289e-76    9.162216479754085e-72
+  30 30 22 2c 20 30 2c 20  22 31 22 5d 5d 2c 0a 22
+  1.0511782037414344e-153  1.0480224142302544e-144
+  1.0511782037414344e-153  1.0480224142302544e-144
+  30 32 30 30 30 30 30 30  30 31 30 30 30 31 30 30
+    1.398043286095446e-76   1.3983806364295508e-76
+    1.398043286095446e-76   1.3983806364295508e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 32 35 31 62 32  30 31 30 30 30 30 30 30
+     5.39829493934083e-66   1.3980432860953674e-76
+     5.39829493934083e-66   1.3980432860953674e-76
+  30 31 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+   1.3980432860953674e-76    1.398043286095289e-76
+   1.3980432860953674e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 22 2c 20 22
+    1.398043286095289e-76     2.5902785586997e-144
+    1.398043286095289e-76     2.5902785586997e-144
+  50 32 53 48 2c 43 48 45  43 4b 53 45 51 55 45 4e
+   5.8662870186814245e+25    1.150287715341693e+69
+   5.8662870186814245e+25    1.150287715341693e+69
+  43 45 56 45 52 49 46 59  22 5d 2c 0a 0a 5b 22 56
+  1.1509816729231695e+122    8.41971870496236e+106
+  1.1509816729231695e+122    8.41971870496236e+106
+  61 6c 69 64 20 43 48 45  43 4b 53 45 51 55 45 4e
+    5.866243151269433e+25    1.150287715341693e+69
+    5.866243151269433e+25    1.150287715341693e+69
+  43 45 56 45 52 49 46 59  20 69 6e 20 72 65 64 65
+  1.1509816729231695e+122  2.6448328454245593e+180
+  1.1509816729231695e+122  2.6448328454245593e+180
+  65 6d 53 63 72 69 70 74  22 5d 2c 0a 5b 5b 5b 22
+   7.520302001770645e+252  3.5053249760825546e-143
+   7.520302001770645e+252  3.5053249760825546e-143
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 31 30 30
+    1.398043286095289e-76   1.3983806364294722e-76
+    1.398043286095289e-76   1.3983806364294722e-76
+  22 2c 20 30 2c 20 22 48  41 53 48 31 36 30 20 30
+    3.083923668804203e+39    6.990255991883209e-77
+    3.083923668804203e+39    6.990255991883209e-77
+  78 31 34 20 30 78 37 63  31 37 61 66 66 35 33 32
+   8.857295203428988e+169    7.124863407907862e-67
+   8.857295203428988e+169    7.124863407907862e-67
+  66 32 32 62 65 62 35 34  30 36 39 39 34 32 66 39
+    3.406725012928368e-57   3.4198521344297673e-32
+    3.406725012928368e-57   3.4198521344297673e-32
+  62 66 35 36 37 61 36 36  31 33 33 65 61 66 20 45
+    1.531284546170873e-47    9.913145560745214e+24
+    1.531284546170873e-47    9.913145560745214e+24
+  51 55 41 4c 22 5d 5d 2c  0a 22 30 32 30 30 30 30
+   5.4988731860599135e-95   1.3980432963892927e-76
+   5.4988731860599135e-95   1.3980432963892927e-76
+  30 30 30 31 30 30 30 31  30 30 30 30 30 30 30 30
+    9.162216513489118e-72    1.398043286095289e-76
+    9.162216513489118e-72    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 33 30 32
+    1.398043286095289e-76    6.008896918129474e-67
+    1.398043286095289e-76    6.008896918129474e-67
+  35 31 62 32 30 31 30 30  30 30 30 30 30 31 30 30
+   1.3983806477300498e-76   1.3983806364294722e-76
+   1.3983806477300498e-76   1.3983806364294722e-76
+  30 30 30 30 30 30 30 30  30 30 30 30 30 30 30 30
+    1.398043286095289e-76    1.398043286095289e-76
+    1.398043286095289e-76    1.398043286095289e-76
+  30 30 30 30 30 30 30 30  22 2c 20 22 50 32 53 48
+    1.398043286095289e-76    2.612896978874658e+40
+    1.398043286095289e-76    2.612896978874658e+40
+  2c 43 48 45 43 4b 53 45  51 55 45 4e 43 45 56 45
+    9.330003593224064e+25    1.076938115628028e+26
+    9.330003593224064e+25    1.076938115628028e+26
+  52 49 46 59 22 5d 2c 0a  0a 5b 22 4d 61 6b 65 20
+   1.152970637348911e-259  1.2780286568551675e-152
+   1.152970637348911e-259  1.2780286568551675e-152
+  64 69 66 66 73 20 63 6c  65 61 6e 65 72 20 62 79
+  1.2877998272310685e+214   5.020718486073852e+276
+  1.2877998272310685e+214   5.020718486073852e+276
+  20 6c 65 61 76 69 6e 67  20 61 20 63 6f 6d 6d 65
+  1.6937594408331863e+190  3.8159309400325706e+180
+  1.6937594408331863e+190  3.8159309400325706e+180
+  6e 74 20 68 65 72 65 20  77 69 74 68 6f 75 74 20
+   1.279663906654824e-152  2.4414110116699273e-152
+   1.279663906654824e-152  2.4414110116699273e-152
+  63 6f 6d 6d 61 20 61 74  20 74 68 65 20 65 6e 64
+   3.923870439298232e+252   6.014091102726484e+175
+   3.923870439298232e+252   6.014091102726484e+175
+  22 5d 0a 5d 0a
+       2.19911747635e-313
+       2.19911747635e-313
+};};
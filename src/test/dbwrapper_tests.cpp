@@ -131,6 +131,88 @@ BOOST_AUTO_TEST_CASE(dbwrapper_iterator)
     }
 }
 
+// Test batched reads
+// Keys longer than the inline key buffer must round trip as well
+BOOST_AUTO_TEST_CASE(dbwrapper_large_key)
+{
+    for (int i = 0; i < 2; i++)
+    {
+        bool obfuscate = (bool)i;
+        fs::path ph = fs::temp_directory_path() / fs::unique_path();
+        CDBWrapper dbw(ph, (1 << 20), true, false, obfuscate);
+
+        std::string keyShort(DBWRAPPER_PREALLOC_KEY_SIZE - 1, 'a');
+        std::string keyLong(3 * DBWRAPPER_PREALLOC_KEY_SIZE, 'a');
+        uint256 inShort = GetRandHash();
+        uint256 inLong = GetRandHash();
+        uint256 res;
+
+        CDBBatch batch(dbw);
+        batch.Write(keyShort, inShort);
+        batch.Write(keyLong, inLong);
+        BOOST_CHECK(dbw.WriteBatch(batch));
+
+        BOOST_CHECK(dbw.Read(keyShort, res));
+        BOOST_CHECK_EQUAL(res.ToString(), inShort.ToString());
+        BOOST_CHECK(dbw.Read(keyLong, res));
+        BOOST_CHECK_EQUAL(res.ToString(), inLong.ToString());
+        BOOST_CHECK(dbw.Exists(keyLong));
+
+        std::unique_ptr<CDBIterator> it(dbw.NewIterator());
+        it->Seek(keyLong);
+        BOOST_REQUIRE(it->Valid());
+        std::string keyRead;
+        BOOST_CHECK(it->GetKey(keyRead));
+        BOOST_CHECK(keyRead == keyLong);
+        BOOST_CHECK(it->GetValue(res));
+        BOOST_CHECK_EQUAL(res.ToString(), inLong.ToString());
+
+        batch.Clear();
+        batch.Erase(keyLong);
+        BOOST_CHECK(dbw.WriteBatch(batch));
+        BOOST_CHECK(!dbw.Exists(keyLong));
+        BOOST_CHECK(dbw.Exists(keyShort));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(dbwrapper_readmany)
+{
+    // Perform tests both obfuscated and non-obfuscated.
+    for (int i = 0; i < 2; i++)
+    {
+        bool obfuscate = (bool)i;
+        fs::path ph = fs::temp_directory_path() / fs::unique_path();
+        CDBWrapper dbw(ph, (1 << 20), true, false, obfuscate);
+
+        // Only write the even keys, so lookups alternate between hits and misses
+        for (uint32_t x = 0; x < 100; x += 2)
+            BOOST_CHECK(dbw.Write(std::make_pair('m', x), x * x));
+
+        // Unsorted keys, with a duplicate and keys beyond the last entry
+        std::vector<std::pair<char, uint32_t> > keys;
+        for (uint32_t x = 0; x < 110; x++)
+            keys.push_back(std::make_pair('m', (x * 37) % 110));
+        keys.push_back(std::make_pair('m', 4));
+
+        std::vector<uint32_t> values;
+        std::vector<bool> vfFound;
+        BOOST_CHECK_EQUAL(dbw.ReadMany(keys, values, vfFound), 51);
+        BOOST_CHECK_EQUAL(values.size(), keys.size());
+        BOOST_CHECK_EQUAL(vfFound.size(), keys.size());
+        for (size_t n = 0; n < keys.size(); n++)
+        {
+            uint32_t x = keys[n].second;
+            bool fExpected = x < 100 && x % 2 == 0;
+            BOOST_CHECK_EQUAL(vfFound[n], fExpected);
+            BOOST_CHECK_EQUAL(values[n], fExpected ? x * x : 0);
+        }
+
+        keys.clear();
+        BOOST_CHECK_EQUAL(dbw.ReadMany(keys, values, vfFound), 0);
+        BOOST_CHECK(values.empty());
+    }
+}
+
 // Test that we do not obfuscation if there is existing data.
 BOOST_AUTO_TEST_CASE(existing_data_no_obfuscate)
 {
@@ -0,0 +1,77 @@
+// Copyright (c) 2018 The Eccoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "coins.h"
+#include "consensus/validation.h"
+#include "main.h"
+#include "random.h"
+#include "script/interpreter.h"
+#include "script/script.h"
+#include "test/test_bitcoin.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+//! A transaction spending a single coin with scriptPubKey, added to view
+CTransaction SpendCoin(CCoinsViewCache &view, const CScript &scriptPubKey)
+{
+    COutPoint prevout(GetRandHash(), 0);
+    view.AddCoin(prevout, Coin(CTxOut(10000, scriptPubKey), 1, false, false, 0), false);
+
+    CTransaction tx;
+    tx.vin.emplace_back(prevout);
+    tx.vout.emplace_back(9000, CScript() << OP_TRUE);
+    return tx;
+}
+
+//! Number of script checks CheckInputs hands out for tx, 0 when the cache answered
+size_t CountChecks(const CTransaction &tx, const CCoinsViewCache &view, unsigned int flags)
+{
+    CValidationState state;
+    std::vector<CScriptCheck> vChecks;
+    BOOST_CHECK(CheckInputs(tx, state, view, true, flags, false, false, &vChecks));
+    return vChecks.size();
+}
+}
+
+BOOST_FIXTURE_TEST_SUITE(scriptcache_tests, TestingSetup)
+
+BOOST_AUTO_TEST_CASE(script_execution_cache)
+{
+    CCoinsView coinsDummy;
+    CCoinsViewCache view(&coinsDummy);
+    const unsigned int flags = SCRIPT_VERIFY_P2SH | SCRIPT_VERIFY_DERSIG;
+    CTransaction tx = SpendCoin(view, CScript() << OP_TRUE);
+    CValidationState state;
+
+    // Nothing is stored without cacheFullScriptStore or for deferred checks
+    BOOST_CHECK(CheckInputs(tx, state, view, true, flags, true, false, nullptr));
+    std::vector<CScriptCheck> vChecks;
+    BOOST_CHECK(CheckInputs(tx, state, view, true, flags, true, true, &vChecks));
+    BOOST_CHECK_EQUAL(vChecks.size(), 1);
+    BOOST_CHECK_EQUAL(CountChecks(tx, view, flags), 1);
+
+    // An inline pass is stored, but only serves the same flags
+    BOOST_CHECK(CheckInputs(tx, state, view, true, flags, true, true, nullptr));
+    BOOST_CHECK_EQUAL(CountChecks(tx, view, flags | SCRIPT_VERIFY_CLEANSTACK), 1);
+    BOOST_CHECK_EQUAL(CountChecks(tx, view, flags), 0);
+
+    // Without cacheFullScriptStore the hit lets the entry be evicted first,
+    // but it stays until its slot is reused
+    BOOST_CHECK_EQUAL(CountChecks(tx, view, flags), 0);
+}
+
+BOOST_AUTO_TEST_CASE(script_execution_cache_failure)
+{
+    CCoinsView coinsDummy;
+    CCoinsViewCache view(&coinsDummy);
+    CTransaction tx = SpendCoin(view, CScript() << OP_FALSE);
+
+    CValidationState state;
+    BOOST_CHECK(!CheckInputs(tx, state, view, true, SCRIPT_VERIFY_P2SH, true, true, nullptr));
+    BOOST_CHECK_EQUAL(CountChecks(tx, view, SCRIPT_VERIFY_P2SH), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,88 @@
+// Copyright (c) 2018 The Eccoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "chain/tx.h"
+#include "random.h"
+#include "script/interpreter.h"
+#include "script/script.h"
+#include "test/test_bitcoin.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+void RandomScript(CScript &script)
+{
+    static const opcodetype oplist[] = {
+        OP_FALSE, OP_1, OP_2, OP_3, OP_CHECKSIG, OP_IF, OP_VERIF, OP_RETURN, OP_CODESEPARATOR};
+    script = CScript();
+    int ops = (insecure_rand() % 10);
+    for (int i = 0; i < ops; i++)
+        script << oplist[insecure_rand() % (sizeof(oplist) / sizeof(oplist[0]))];
+}
+
+void RandomTransaction(CTransaction &tx, int nInputs, int nOutputs)
+{
+    tx.nVersion = insecure_rand();
+    tx.nTime = insecure_rand();
+    tx.nLockTime = (insecure_rand() % 2) ? insecure_rand() : 0;
+    tx.vin.resize(nInputs);
+    tx.vout.resize(nOutputs);
+    for (CTxIn &txin : tx.vin)
+    {
+        txin.prevout.hash = GetRandHash();
+        txin.prevout.n = insecure_rand() % 4;
+        RandomScript(txin.scriptSig);
+        txin.nSequence = (insecure_rand() % 2) ? insecure_rand() : (unsigned int)-1;
+    }
+    for (CTxOut &txout : tx.vout)
+    {
+        txout.nValue = insecure_rand() % 100000000;
+        RandomScript(txout.scriptPubKey);
+    }
+}
+}
+
+BOOST_FIXTURE_TEST_SUITE(sighashcache_tests, BasicTestingSetup)
+
+BOOST_AUTO_TEST_CASE(sighash_cache_matches)
+{
+    for (int i = 0; i < 2000; i++)
+    {
+        CTransaction txTo;
+        int nInputs = 1 + insecure_rand() % (i % 10 == 0 ? 300 : 8);
+        RandomTransaction(txTo, nInputs, 1 + insecure_rand() % 8);
+        const PrecomputedTransactionData txdata(txTo);
+
+        // All base types, with and without ANYONECANPAY, and random ones
+        int nHashType = insecure_rand();
+        if (i % 2)
+            nHashType = (1 + i / 2 % 3) | ((i / 6 % 2) ? SIGHASH_ANYONECANPAY : 0);
+        CScript scriptCode;
+        RandomScript(scriptCode);
+        unsigned int nIn = insecure_rand() % txTo.vin.size();
+
+        BOOST_CHECK(SignatureHash(scriptCode, txTo, nIn, nHashType, &txdata) ==
+                    SignatureHash(scriptCode, txTo, nIn, nHashType));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(sighash_cache_ignores_scriptsigs)
+{
+    CTransaction txTo;
+    RandomTransaction(txTo, 20, 3);
+    const PrecomputedTransactionData txdata(txTo);
+
+    // Inputs are signed one after another after txdata was computed
+    CScript scriptCode;
+    scriptCode << OP_DUP << OP_HASH160 << ToByteVector(GetRandHash()) << OP_EQUALVERIFY << OP_CHECKSIG;
+    for (unsigned int nIn = 0; nIn < txTo.vin.size(); nIn++)
+    {
+        BOOST_CHECK(SignatureHash(scriptCode, txTo, nIn, SIGHASH_ALL, &txdata) ==
+                    SignatureHash(scriptCode, txTo, nIn, SIGHASH_ALL));
+        txTo.vin[nIn].scriptSig = CScript() << std::vector<unsigned char>(72, nIn);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
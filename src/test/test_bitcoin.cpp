@@ -20,6 +20,7 @@
 #include "pubkey.h"
 #include "random.h"
 #include "rpc/rpcserver.h"
+#include "script/sigcache.h"
 #include "test/testutil.h"
 #include "txdb.h"
 #include "txmempool.h"
@@ -36,6 +37,8 @@ BasicTestingSetup::BasicTestingSetup(const std::string &chainName)
 {
     ECC_Start();
     SetupEnvironment();
+    InitSignatureCache();
+    InitScriptExecutionCache();
     SetupNetworking();
     g_logger->fPrintToDebugLog = false; // don't want to write to debug.log file
     fCheckBlockIndex = true;
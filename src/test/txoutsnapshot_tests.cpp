@@ -0,0 +1,127 @@
+// This file is part of the Eccoin project
+// Copyright (c) 2018 The Eccoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "txoutsnapshot.h"
+#include "coins.h"
+#include "random.h"
+#include "test/test_bitcoin.h"
+#include "txdb.h"
+#include "util/util.h"
+
+#include <memory>
+#include <stdio.h>
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+void AddRandomCoins(CCoinsViewDB &db, int nTransactions)
+{
+    CCoinsViewCache cache(&db);
+    for (int i = 0; i < nTransactions; i++)
+    {
+        uint256 hash = GetRandHash();
+        // a few outputs per transaction, some of them spent
+        for (uint32_t n = 0; n < 1 + insecure_rand() % 4; n++)
+        {
+            CScript script;
+            if (insecure_rand() % 2)
+                script << OP_DUP << OP_HASH160 << ToByteVector(GetRandHash()) << OP_EQUALVERIFY << OP_CHECKSIG;
+            else
+                script << OP_RETURN << std::vector<uint8_t>(insecure_rand() % 100, 0x01);
+            CTxOut txout(insecure_rand() % 100000, script);
+            cache.AddCoin(COutPoint(hash, n * 2), Coin(txout, i, i % 7 == 0, i % 7 == 1, insecure_rand()), false);
+        }
+    }
+    cache.SetBestBlock(GetRandHash());
+    BOOST_REQUIRE(cache.Flush());
+}
+
+bool SameCoins(const CCoinsView &a, const CCoinsView &b)
+{
+    std::unique_ptr<CCoinsViewCursor> pcursorA(a.Cursor());
+    std::unique_ptr<CCoinsViewCursor> pcursorB(b.Cursor());
+    for (; pcursorA->Valid(); pcursorA->Next(), pcursorB->Next())
+    {
+        COutPoint keyA, keyB;
+        Coin coinA, coinB;
+        if (!pcursorB->Valid() || !pcursorA->GetKey(keyA) || !pcursorB->GetKey(keyB) || !(keyA == keyB))
+            return false;
+        if (!pcursorA->GetValue(coinA) || !pcursorB->GetValue(coinB))
+            return false;
+        if (coinA.out != coinB.out || coinA.nHeight != coinB.nHeight || coinA.nTime != coinB.nTime)
+            return false;
+    }
+    return !pcursorB->Valid();
+}
+}
+
+BOOST_FIXTURE_TEST_SUITE(txoutsnapshot_tests, TestingSetup)
+
+BOOST_AUTO_TEST_CASE(snapshot_roundtrip)
+{
+    CCoinsViewDB source(1 << 20, true);
+    AddRandomCoins(source, 2000);
+    fs::path path = GetDataDir() / "utxo.dat";
+
+    CTxOutSnapshotInfo info;
+    BOOST_REQUIRE(DumpTxOutSet(&source, path, info));
+    BOOST_CHECK(info.hashBlock == source.GetBestBlock());
+    CUTXOCommitment commitment;
+    BOOST_CHECK(source.GetCommitment(commitment));
+    BOOST_CHECK(info.commitment == commitment);
+
+    CTxOutSnapshotInfo infoRead;
+    BOOST_CHECK(VerifyTxOutSnapshot(path, infoRead));
+    BOOST_CHECK(infoRead.hashBlock == info.hashBlock);
+    BOOST_CHECK(infoRead.commitment == info.commitment);
+
+    CCoinsViewDB dest(1 << 20, true);
+    uint64_t nCoins = 0;
+    BOOST_CHECK(LoadTxOutSnapshot(&dest, path, nCoins));
+    BOOST_CHECK_EQUAL(nCoins, (uint64_t)commitment.nTransactionOutputs);
+    BOOST_CHECK(SameCoins(source, dest));
+    // The best block is left to the caller
+    BOOST_CHECK(dest.GetBestBlock().IsNull());
+}
+
+BOOST_AUTO_TEST_CASE(snapshot_empty)
+{
+    CCoinsViewDB source(1 << 20, true);
+    fs::path path = GetDataDir() / "empty.dat";
+    CTxOutSnapshotInfo info;
+    BOOST_REQUIRE(DumpTxOutSet(&source, path, info));
+    BOOST_CHECK(VerifyTxOutSnapshot(path, info));
+    BOOST_CHECK_EQUAL(info.commitment.nTransactionOutputs, 0);
+    BOOST_CHECK(info.commitment.GetHash().IsNull());
+}
+
+BOOST_AUTO_TEST_CASE(snapshot_corrupted)
+{
+    CCoinsViewDB source(1 << 20, true);
+    AddRandomCoins(source, 100);
+    fs::path path = GetDataDir() / "utxo.dat";
+    CTxOutSnapshotInfo info;
+    BOOST_REQUIRE(DumpTxOutSet(&source, path, info));
+    uint64_t nSize = fs::file_size(path);
+
+    // Flip a bit in the middle of the coins
+    FILE *file = fopen(path.string().c_str(), "r+b");
+    BOOST_REQUIRE(file);
+    BOOST_REQUIRE(fseek(file, nSize / 2, SEEK_SET) == 0);
+    int ch = fgetc(file);
+    BOOST_REQUIRE(fseek(file, nSize / 2, SEEK_SET) == 0);
+    fputc(ch ^ 0x10, file);
+    fclose(file);
+    BOOST_CHECK(!VerifyTxOutSnapshot(path, info));
+
+    // Truncated
+    fs::resize_file(path, nSize / 2);
+    BOOST_CHECK(!VerifyTxOutSnapshot(path, info));
+
+    BOOST_CHECK(!VerifyTxOutSnapshot(GetDataDir() / "missing.dat", info));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,76 @@
+// Copyright (c) 2018 The Eccoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "blockstorage/blockstorage.h"
+#include "random.h"
+#include "test/test_bitcoin.h"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+//! Undo data told apart by its number of transactions
+CBlockUndo UndoWithTxs(size_t nTxs)
+{
+    CBlockUndo blockundo;
+    blockundo.vtxundo.resize(nTxs);
+    return blockundo;
+}
+}
+
+BOOST_FIXTURE_TEST_SUITE(undocache_tests, BasicTestingSetup)
+
+BOOST_AUTO_TEST_CASE(undocache_add_get)
+{
+    CUndoCache cache(10);
+    std::vector<uint256> hashes;
+    for (size_t i = 0; i < 10; i++)
+    {
+        hashes.push_back(GetRandHash());
+        cache.Add(hashes.back(), UndoWithTxs(i));
+    }
+    BOOST_CHECK_EQUAL(cache.Size(), 10);
+    for (size_t i = 0; i < 10; i++)
+    {
+        CBlockUndo blockundo;
+        BOOST_CHECK(cache.Get(hashes[i], blockundo));
+        BOOST_CHECK_EQUAL(blockundo.vtxundo.size(), i);
+    }
+    CBlockUndo blockundo;
+    BOOST_CHECK(!cache.Get(GetRandHash(), blockundo));
+
+    // A block connected again is updated, not added twice
+    cache.Add(hashes[3], UndoWithTxs(42));
+    BOOST_CHECK_EQUAL(cache.Size(), 10);
+    BOOST_CHECK(cache.Get(hashes[3], blockundo));
+    BOOST_CHECK_EQUAL(blockundo.vtxundo.size(), 42);
+}
+
+BOOST_AUTO_TEST_CASE(undocache_eviction)
+{
+    CUndoCache cache(4);
+    std::vector<uint256> hashes;
+    for (size_t i = 0; i < 6; i++)
+    {
+        hashes.push_back(GetRandHash());
+        cache.Add(hashes.back(), UndoWithTxs(i));
+    }
+    // The two oldest blocks are gone
+    BOOST_CHECK_EQUAL(cache.Size(), 4);
+    CBlockUndo blockundo;
+    BOOST_CHECK(!cache.Get(hashes[0], blockundo));
+    BOOST_CHECK(!cache.Get(hashes[1], blockundo));
+    BOOST_CHECK(cache.Get(hashes[2], blockundo));
+    BOOST_CHECK(cache.Get(hashes[5], blockundo));
+
+    // Shrinking drops the oldest ones, a size of 0 turns the cache off
+    cache.SetMaxBlocks(1);
+    BOOST_CHECK_EQUAL(cache.Size(), 1);
+    BOOST_CHECK(cache.Get(hashes[5], blockundo));
+    cache.SetMaxBlocks(0);
+    cache.Add(GetRandHash(), UndoWithTxs(1));
+    BOOST_CHECK_EQUAL(cache.Size(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
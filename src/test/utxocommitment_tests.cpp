@@ -0,0 +1,204 @@
+// This file is part of the Eccoin project
+// Copyright (c) 2018 The Eccoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "utxocommitment.h"
+#include "clientversion.h"
+#include "coins.h"
+#include "random.h"
+#include "streams.h"
+#include "test/test_bitcoin.h"
+#include "txdb.h"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+COutPoint RandomOutPoint() { return COutPoint(GetRandHash(), insecure_rand() % 8); }
+Coin RandomCoin()
+{
+    CScript script;
+    script << OP_DUP << OP_HASH160 << ToByteVector(GetRandHash()) << OP_EQUALVERIFY << OP_CHECKSIG;
+    return Coin(CTxOut(insecure_rand() % 100000, script), insecure_rand() % 1000, false, false, insecure_rand());
+}
+
+//! Commitment computed from scratch by walking the whole view
+CUTXOCommitment WalkCommitment(const CCoinsView &view)
+{
+    CUTXOCommitment commitment;
+    std::unique_ptr<CCoinsViewCursor> pcursor(view.Cursor());
+    for (; pcursor->Valid(); pcursor->Next())
+    {
+        COutPoint key;
+        Coin coin;
+        BOOST_REQUIRE(pcursor->GetKey(key));
+        BOOST_REQUIRE(pcursor->GetValue(coin));
+        commitment.AddCoin(key, coin);
+    }
+    return commitment;
+}
+
+void CheckCommitmentsEqual(const CUTXOCommitment &a, const CUTXOCommitment &b)
+{
+    BOOST_CHECK(a.GetHash() == b.GetHash());
+    BOOST_CHECK_EQUAL(a.nTransactionOutputs, b.nTransactionOutputs);
+    BOOST_CHECK_EQUAL(a.nSerializedSize, b.nSerializedSize);
+    BOOST_CHECK_EQUAL(a.nTotalAmount, b.nTotalAmount);
+}
+}
+
+BOOST_FIXTURE_TEST_SUITE(utxocommitment_tests, TestingSetup)
+
+BOOST_AUTO_TEST_CASE(multiset_basics)
+{
+    CECMultiSet empty;
+    BOOST_CHECK(empty.IsEmpty());
+    BOOST_CHECK(empty.GetHash().IsNull());
+
+    std::vector<uint256> vElements;
+    for (int i = 0; i < 600; i++)
+        vElements.push_back(GetRandHash());
+
+    // Order independence, across several folds
+    CECMultiSet set1, set2;
+    for (const uint256 &hash : vElements)
+        set1.Add(hash);
+    std::vector<uint256> vShuffled(vElements.rbegin(), vElements.rend());
+    std::swap(vShuffled[0], vShuffled[300]);
+    for (const uint256 &hash : vShuffled)
+        set2.Add(hash);
+    BOOST_CHECK(!set1.IsEmpty());
+    BOOST_CHECK(set1.GetHash() == set2.GetHash());
+
+    // Removing is the inverse of adding, in any order
+    CECMultiSet set3 = set1;
+    set3.Add(vElements[0]);
+    BOOST_CHECK(set3.GetHash() != set1.GetHash());
+    set3.Remove(vElements[0]);
+    BOOST_CHECK(set3.GetHash() == set1.GetHash());
+    for (const uint256 &hash : vElements)
+        set3.Remove(hash);
+    BOOST_CHECK(set3.IsEmpty());
+    BOOST_CHECK(set3.GetHash().IsNull());
+
+    // A removal recorded before the matching addition cancels out
+    CECMultiSet delta;
+    delta.Remove(vElements[1]);
+    delta.Add(vElements[2]);
+    CECMultiSet set4;
+    set4.Add(vElements[1]);
+    set4.Combine(delta);
+    CECMultiSet set5;
+    set5.Add(vElements[2]);
+    BOOST_CHECK(set4.GetHash() == set5.GetHash());
+
+    // Combining two halves gives the whole
+    CECMultiSet half1, half2;
+    for (size_t i = 0; i < vElements.size(); i++)
+        (i % 2 ? half1 : half2).Add(vElements[i]);
+    half1.Combine(half2);
+    BOOST_CHECK(half1.GetHash() == set1.GetHash());
+}
+
+BOOST_AUTO_TEST_CASE(multiset_serialization)
+{
+    CECMultiSet set;
+    for (int i = 0; i < 10; i++)
+        set.Add(GetRandHash());
+
+    CDataStream ss(SER_DISK, CLIENT_VERSION);
+    ss << set;
+    BOOST_CHECK_EQUAL(ss.size(), 33U);
+    CECMultiSet set2;
+    ss >> set2;
+    BOOST_CHECK(set.GetHash() == set2.GetHash());
+
+    CECMultiSet empty;
+    ss << empty;
+    ss >> set2;
+    BOOST_CHECK(set2.IsEmpty());
+
+    // Not a point on the curve
+    ss << (unsigned char)0x05;
+    for (int i = 0; i < 32; i++)
+        ss << (unsigned char)0xff;
+    BOOST_CHECK_THROW(ss >> set2, std::ios_base::failure);
+}
+
+BOOST_AUTO_TEST_CASE(commitment_follows_views)
+{
+    CCoinsViewDB db(1 << 20, true);
+    CUTXOCommitment commitment;
+    BOOST_CHECK(db.GetCommitment(commitment));
+    BOOST_CHECK(commitment.GetHash().IsNull());
+
+    std::vector<COutPoint> vOutPoints;
+    {
+        CCoinsViewCache cache(&db);
+        for (int i = 0; i < 500; i++)
+        {
+            vOutPoints.push_back(RandomOutPoint());
+            cache.AddCoin(vOutPoints.back(), RandomCoin(), false);
+        }
+        // Overwriting a coin replaces it in the commitment
+        cache.AddCoin(vOutPoints[0], RandomCoin(), true);
+
+        BOOST_CHECK(cache.GetCommitment(commitment));
+        CUTXOCommitment dbCommitment;
+        BOOST_CHECK(db.GetCommitment(dbCommitment));
+        BOOST_CHECK(dbCommitment.GetHash().IsNull());
+
+        cache.SetBestBlock(GetRandHash());
+        BOOST_CHECK(cache.Flush());
+    }
+    CUTXOCommitment walked = WalkCommitment(db);
+    BOOST_CHECK_EQUAL(walked.nTransactionOutputs, 500);
+    BOOST_CHECK(db.GetCommitment(commitment));
+    CheckCommitmentsEqual(commitment, walked);
+
+    // Spend and add through two layers of caches
+    {
+        CCoinsViewCache cache(&db);
+        CCoinsViewCache child(&cache);
+        for (int i = 0; i < 100; i++)
+        {
+            BOOST_CHECK(child.SpendCoin(vOutPoints[i]));
+            child.AddCoin(RandomOutPoint(), RandomCoin(), false);
+        }
+        // Spending a coin and restoring it from undo data leaves no trace
+        CUTXOCommitment before;
+        BOOST_CHECK(child.GetCommitment(before));
+        Coin undo;
+        BOOST_CHECK(child.SpendCoin(vOutPoints[200], &undo));
+        BOOST_CHECK(child.GetCommitment(commitment));
+        BOOST_CHECK(commitment.GetHash() != before.GetHash());
+        child.AddCoin(vOutPoints[200], std::move(undo), false);
+        BOOST_CHECK(child.GetCommitment(commitment));
+        CheckCommitmentsEqual(commitment, before);
+
+        BOOST_CHECK(child.Flush());
+        BOOST_CHECK(cache.GetCommitment(commitment));
+        CheckCommitmentsEqual(commitment, before);
+        cache.SetBestBlock(GetRandHash());
+        BOOST_CHECK(cache.Flush());
+    }
+    walked = WalkCommitment(db);
+    BOOST_CHECK_EQUAL(walked.nTransactionOutputs, 500);
+    BOOST_CHECK(db.GetCommitment(commitment));
+    CheckCommitmentsEqual(commitment, walked);
+
+    // A stored commitment is only replaced for the current best block
+    CUTXOCommitment wrong;
+    BOOST_CHECK(!db.WriteCommitment(wrong, GetRandHash()));
+    BOOST_CHECK(db.WriteCommitment(walked, db.GetBestBlock()));
+    BOOST_CHECK(db.WriteCommitment(wrong, db.GetBestBlock()));
+    BOOST_CHECK(db.GetCommitment(commitment));
+    CheckCommitmentsEqual(commitment, wrong);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,70 @@
+// Copyright (c) 2018 The Eccoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "test/test_bitcoin.h"
+#include "util/utiltime.h"
+#include "validationstats.h"
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_FIXTURE_TEST_SUITE(validationstats_tests, BasicTestingSetup)
+
+BOOST_AUTO_TEST_CASE(validationstats_histogram)
+{
+    CStageHistogram hist;
+    hist.Add(0);
+    hist.Add(1);
+    hist.Add(1000);
+    hist.Add(1023);
+    hist.Add(1024);
+    hist.Add((int64_t)1 << 40);
+    BOOST_CHECK_EQUAL(hist.nCount, 6);
+    BOOST_CHECK_EQUAL(hist.nMax, (int64_t)1 << 40);
+    BOOST_CHECK_EQUAL(hist.vBuckets[0], 1); // 0
+    BOOST_CHECK_EQUAL(hist.vBuckets[1], 1); // 1
+    BOOST_CHECK_EQUAL(hist.vBuckets[10], 2); // 512 to 1023
+    BOOST_CHECK_EQUAL(hist.vBuckets[11], 1); // 1024 to 2047
+    BOOST_CHECK_EQUAL(hist.vBuckets[CStageHistogram::NUM_BUCKETS - 1], 1); // everything beyond
+}
+
+BOOST_AUTO_TEST_CASE(validationstats_recent)
+{
+    CValidationStats stats(3);
+    for (int i = 0; i < 5; i++)
+    {
+        CBlockValidationTiming timing;
+        timing.nHeight = i;
+        timing.nStageTime[STAGE_SCRIPTS] = 100 * i;
+        timing.nStageTime[STAGE_READ] = 1;
+        stats.Add(timing);
+    }
+    // Only the last three are kept, the newest first
+    std::vector<CBlockValidationTiming> recent = stats.GetRecent(10);
+    BOOST_CHECK_EQUAL(recent.size(), 3);
+    BOOST_CHECK_EQUAL(recent[0].nHeight, 4);
+    BOOST_CHECK_EQUAL(recent[2].nHeight, 2);
+    BOOST_CHECK_EQUAL(recent[0].Total(), 401);
+    BOOST_CHECK_EQUAL(stats.GetRecent(1).size(), 1);
+
+    // The histograms cover all blocks
+    BOOST_CHECK_EQUAL(stats.GetHistogram(STAGE_SCRIPTS).nCount, 5);
+    BOOST_CHECK_EQUAL(stats.GetHistogram(STAGE_SCRIPTS).nTotal, 1000);
+    BOOST_CHECK_EQUAL(stats.GetHistogram(STAGE_READ).nTotal, 5);
+    BOOST_CHECK_EQUAL(stats.GetTotalHistogram().nTotal, 1005);
+}
+
+BOOST_AUTO_TEST_CASE(validationstats_timer)
+{
+    CBlockValidationTiming timing;
+    {
+        CValidationStageTimer timer(&timing, STAGE_UNDO);
+        MilliSleep(2);
+    }
+    BOOST_CHECK(timing.nStageTime[STAGE_UNDO] >= 2000);
+    BOOST_CHECK_EQUAL(timing.Total(), timing.nStageTime[STAGE_UNDO]);
+    // Without a timing nothing happens
+    CValidationStageTimer timer(nullptr, STAGE_UNDO);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
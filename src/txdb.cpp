@@ -28,6 +28,7 @@ static const char DB_TXINDEX = 't';
 static const char DB_BLOCK_INDEX = 'b';
 
 static const char DB_BEST_BLOCK = 'B';
+static const char DB_UTXO_COMMITMENT = 'U';
 static const char DB_FLAG = 'F';
 static const char DB_REINDEX_FLAG = 'R';
 static const char DB_LAST_BLOCK = 'l';
@@ -61,10 +62,26 @@ struct CoinEntry
 CCoinsViewDB::CCoinsViewDB(size_t nCacheSize, bool fMemory, bool fWipe)
     : db(GetDataDir() / "chainstate", nCacheSize, fMemory, fWipe, true)
 {
+    fCommitmentValid = db.Read(DB_UTXO_COMMITMENT, commitment);
+    if (!fCommitmentValid && GetBestBlock().IsNull())
+    {
+        // A new chainstate starts out with the commitment to the empty set
+        commitment.SetNull();
+        fCommitmentValid = true;
+    }
 }
 
 bool CCoinsViewDB::GetCoin(const COutPoint &outpoint, Coin &coin) const { return db.Read(CoinEntry(&outpoint), coin); }
 bool CCoinsViewDB::HaveCoin(const COutPoint &outpoint) const { return db.Exists(CoinEntry(&outpoint)); }
+size_t CCoinsViewDB::GetCoins(const std::vector<COutPoint> &outpoints, std::vector<Coin> &coins) const
+{
+    std::vector<CoinEntry> entries;
+    entries.reserve(outpoints.size());
+    for (const COutPoint &outpoint : outpoints)
+        entries.emplace_back(&outpoint);
+    std::vector<bool> vfFound;
+    return db.ReadMany(entries, coins, vfFound);
+}
 uint256 CCoinsViewDB::GetBestBlock() const
 {
     uint256 hashBestChain;
@@ -122,6 +139,14 @@ bool CCoinsViewDB::BatchWrite(CCoinsMap &mapCoins,
     }
     if (!hashBlock.IsNull())
         batch.Write(DB_BEST_BLOCK, hashBlock);
+    // Without a valid commitment the pending changes are simply dropped; a
+    // full walk of the database will pick them up.
+    if (fCommitmentValid)
+    {
+        commitment.Combine(commitmentPending);
+        batch.Write(DB_UTXO_COMMITMENT, commitment);
+    }
+    commitmentPending.SetNull();
 
     bool ret = db.WriteBatch(batch);
     LogPrint("COINDB", "Committing %u changed transactions (out of %u) to coin database with %u batch writes...\n",
@@ -129,6 +154,57 @@ bool CCoinsViewDB::BatchWrite(CCoinsMap &mapCoins,
     return ret;
 }
 
+void CCoinsViewDB::UpdateCommitment(const CUTXOCommitment &delta)
+{
+    WRITELOCK(cs_utxo);
+    commitmentPending.Combine(delta);
+}
+
+bool CCoinsViewDB::GetCommitment(CUTXOCommitment &commitmentOut) const
+{
+    READLOCK(cs_utxo);
+    if (!fCommitmentValid)
+        return false;
+    commitmentOut = commitment;
+    commitmentOut.Combine(commitmentPending);
+    return true;
+}
+
+bool CCoinsViewDB::WriteCommitment(const CUTXOCommitment &commitmentIn, const uint256 &hashBlock)
+{
+    WRITELOCK(cs_utxo);
+    if (GetBestBlock() != hashBlock)
+        return false;
+    if (fCommitmentValid)
+    {
+        if (commitment == commitmentIn)
+            return true;
+        LogPrintf("UTXO set commitment does not match the coin database, replacing it\n");
+    }
+    if (!db.Write(DB_UTXO_COMMITMENT, commitmentIn))
+        return false;
+    commitment = commitmentIn;
+    fCommitmentValid = true;
+    return true;
+}
+
+bool CCoinsViewDB::WriteCoins(const std::vector<std::pair<COutPoint, Coin> > &vCoins)
+{
+    WRITELOCK(cs_utxo);
+    CDBBatch batch(db);
+    for (const auto &entry : vCoins)
+    {
+        batch.Write(CoinEntry(&entry.first), entry.second);
+        if (batch.SizeEstimate() > nMaxDBBatchSize)
+        {
+            if (!db.WriteBatch(batch))
+                return false;
+            batch.Clear();
+        }
+    }
+    return db.WriteBatch(batch);
+}
+
 CCoinsViewCursor *CCoinsViewDB::Cursor() const
 {
     CCoinsViewDBCursor *i = new CCoinsViewDBCursor(const_cast<CDBWrapper &>(db).NewIterator(), GetBestBlock());
@@ -233,6 +309,17 @@ bool CBlockTreeDB::ReadTxIndex(const uint256 &txid, CDiskTxPos &pos)
     return Read(std::make_pair(DB_TXINDEX, txid), pos);
 }
 
+size_t CBlockTreeDB::ReadTxIndex(const std::vector<uint256> &vTxid,
+    std::vector<CDiskTxPos> &vPos,
+    std::vector<bool> &vfFound)
+{
+    std::vector<std::pair<char, uint256> > keys;
+    keys.reserve(vTxid.size());
+    for (const uint256 &txid : vTxid)
+        keys.push_back(std::make_pair(DB_TXINDEX, txid));
+    return ReadMany(keys, vPos, vfFound);
+}
+
 bool CBlockTreeDB::WriteTxIndex(const std::vector<std::pair<uint256, CDiskTxPos> > &vect)
 {
     CDBBatch batch(*this);
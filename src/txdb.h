@@ -51,17 +51,41 @@ class CCoinsViewDB : public CCoinsView
 protected:
     CDBWrapper db;
 
+    //! Commitment to the coins in the database, only meaningful if fCommitmentValid
+    CUTXOCommitment commitment;
+    //! Changes handed over by UpdateCommitment, applied by the next BatchWrite
+    CUTXOCommitment commitmentPending;
+    //! False for a chainstate written by a version that did not keep a commitment
+    bool fCommitmentValid;
+
 public:
     CCoinsViewDB(size_t nCacheSize, bool fMemory = false, bool fWipe = false);
 
     bool GetCoin(const COutPoint &outpoint, Coin &coin) const override;
     bool HaveCoin(const COutPoint &outpoint) const override;
+    size_t GetCoins(const std::vector<COutPoint> &outpoints, std::vector<Coin> &coins) const override;
     uint256 GetBestBlock() const;
     bool BatchWrite(CCoinsMap &mapCoins,
         const uint256 &hashBlock,
         const uint64_t nBestCoinHeight,
         size_t &nChildCachedCoinsUsage) override;
     CCoinsViewCursor *Cursor() const override;
+    void UpdateCommitment(const CUTXOCommitment &delta) override;
+    bool GetCommitment(CUTXOCommitment &commitmentOut) const override;
+
+    /**
+     * Store a commitment computed by walking the whole database with Cursor().
+     * It is only accepted if the best block is still hashBlock, i.e. nothing
+     * was written to the database since the cursor was created.
+     */
+    bool WriteCommitment(const CUTXOCommitment &commitmentIn, const uint256 &hashBlock);
+
+    /**
+     * Write coins straight to the database, bypassing the caches and the
+     * commitment. Used to load UTXO snapshots, where the coins arrive in key
+     * order. Nothing is synced to disk; the best block written afterwards is.
+     */
+    bool WriteCoins(const std::vector<std::pair<COutPoint, Coin> > &vCoins);
 
     //! Attempt to update from an older database format. Returns whether an error occurred.
     bool Upgrade();
@@ -109,6 +133,7 @@ public:
     bool WriteReindexing(bool fReindex);
     bool ReadReindexing(bool &fReindex);
     bool ReadTxIndex(const uint256 &txid, CDiskTxPos &pos);
+    size_t ReadTxIndex(const std::vector<uint256> &vTxid, std::vector<CDiskTxPos> &vPos, std::vector<bool> &vfFound);
     bool WriteTxIndex(const std::vector<std::pair<uint256, CDiskTxPos> > &list);
     bool WriteFlag(const std::string &name, bool fValue);
     bool ReadFlag(const std::string &name, bool &fValue);
@@ -0,0 +1,269 @@
+// This file is part of the Eccoin project
+// Copyright (c) 2018 The Eccoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "txoutsnapshot.h"
+
+#include "clientversion.h"
+#include "coins.h"
+#include "crypto/hash.h"
+#include "init.h"
+#include "networks/netman.h"
+#include "random.h"
+#include "streams.h"
+#include "threadgroup.h"
+#include "txdb.h"
+#include "util/util.h"
+
+#include <memory>
+#include <string.h>
+
+namespace
+{
+const uint8_t SNAPSHOT_MAGIC[5] = {'u', 't', 'x', 'o', 0xff};
+
+//! Size of the chunks written to the snapshot file
+const size_t DUMP_BUFFER_SIZE = 1 << 20;
+//! Number of coins handed to the database at once while loading
+const size_t LOAD_CHUNK_SIZE = 100000;
+
+/** A coin as stored in a snapshot file */
+class CSnapshotCoin
+{
+private:
+    Coin &coin;
+
+public:
+    CSnapshotCoin(Coin &coinIn) : coin(coinIn) {}
+    template <typename Stream>
+    void Serialize(Stream &s) const
+    {
+        uint8_t code = (coin.fCoinBase ? 1 : 0) | (coin.fCoinStake ? 2 : 0);
+        s << code;
+        s << VARINT(coin.nHeight);
+        s << VARINT(coin.nTime);
+        s << coin.out;
+    }
+
+    template <typename Stream>
+    void Unserialize(Stream &s)
+    {
+        uint8_t code = 0;
+        s >> code;
+        if (code > 2)
+            throw std::ios_base::failure("CSnapshotCoin: invalid coin flags");
+        coin.fCoinBase = code & 1;
+        coin.fCoinStake = (code & 2) >> 1;
+        s >> VARINT(coin.nHeight);
+        s >> VARINT(coin.nTime);
+        s >> coin.out;
+        if (coin.IsSpent())
+            throw std::ios_base::failure("CSnapshotCoin: spent coin");
+    }
+};
+
+template <typename Stream>
+void WriteHeader(Stream &s, const uint256 &hashBlock)
+{
+    s << FLATDATA(SNAPSHOT_MAGIC);
+    s << TXOUT_SNAPSHOT_VERSION;
+    s << FLATDATA(pnetMan->getActivePaymentNetwork()->MessageStart());
+    s << hashBlock;
+}
+
+template <typename Stream>
+bool ReadHeader(Stream &s, uint256 &hashBlock)
+{
+    uint8_t magic[sizeof(SNAPSHOT_MAGIC)];
+    s >> FLATDATA(magic);
+    if (memcmp(magic, SNAPSHOT_MAGIC, sizeof(magic)))
+        return error("%s: Not a UTXO snapshot file", __func__);
+    uint16_t nVersion = 0;
+    s >> nVersion;
+    if (nVersion != TXOUT_SNAPSHOT_VERSION)
+        return error("%s: Unsupported snapshot version %u", __func__, nVersion);
+    uint8_t pchMsgTmp[4];
+    s >> FLATDATA(pchMsgTmp);
+    if (memcmp(pchMsgTmp, std::begin(pnetMan->getActivePaymentNetwork()->MessageStart()), sizeof(pchMsgTmp)))
+        return error("%s: Invalid network magic number", __func__);
+    s >> hashBlock;
+    return true;
+}
+
+/**
+ * Read the coins of a snapshot, calling fn(outpoint, coin) for each of them.
+ * Every transaction starts with its number of unspent outputs, a zero count
+ * ends the list.
+ */
+template <typename Stream, typename Callback>
+void ReadCoins(Stream &s, Callback fn)
+{
+    while (true)
+    {
+        uint64_t nOutputs = 0;
+        s >> VARINT(nOutputs);
+        if (nOutputs == 0)
+            break;
+        COutPoint outpoint;
+        s >> outpoint.hash;
+        for (uint64_t i = 0; i < nOutputs; i++)
+        {
+            Coin coin;
+            s >> VARINT(outpoint.n);
+            s >> REF(CSnapshotCoin(coin));
+            fn(outpoint, coin);
+        }
+    }
+}
+}
+
+bool DumpTxOutSet(CCoinsViewDB *view, const fs::path &path, CTxOutSnapshotInfo &info)
+{
+    // Write to a temporary file next to the destination
+    unsigned short randv = 0;
+    GetRandBytes((uint8_t *)&randv, sizeof(randv));
+    fs::path pathTmp = path.string() + strprintf(".%04x", randv);
+
+    FILE *file = fopen(pathTmp.string().c_str(), "wb");
+    CAutoFile fileout(file, SER_DISK, CLIENT_VERSION);
+    if (fileout.IsNull())
+        return error("%s: Failed to open file %s", __func__, pathTmp.string());
+
+    std::unique_ptr<CCoinsViewCursor> pcursor(view->Cursor());
+    info.hashBlock = pcursor->GetBestBlock();
+    info.commitment.SetNull();
+
+    CHashWriter hasher(SER_DISK, CLIENT_VERSION);
+    CDataStream ssBuf(SER_DISK, CLIENT_VERSION);
+    // The outputs of a transaction are adjacent in the database
+    std::vector<std::pair<uint32_t, Coin> > vOutputs;
+    uint256 hashTx;
+    try
+    {
+        WriteHeader(ssBuf, info.hashBlock);
+        while (true)
+        {
+            COutPoint key;
+            Coin coin;
+            bool fValid = pcursor->Valid();
+            if (fValid && !(pcursor->GetKey(key) && pcursor->GetValue(coin)))
+                return error("%s: Unable to read coin database", __func__);
+            if ((!fValid || key.hash != hashTx) && !vOutputs.empty())
+            {
+                uint64_t nOutputs = vOutputs.size();
+                ssBuf << VARINT(nOutputs);
+                ssBuf << hashTx;
+                for (auto &output : vOutputs)
+                {
+                    ssBuf << VARINT(output.first);
+                    ssBuf << CSnapshotCoin(output.second);
+                }
+                vOutputs.clear();
+            }
+            if (ssBuf.size() >= DUMP_BUFFER_SIZE)
+            {
+                hasher.write(ssBuf.data(), ssBuf.size());
+                fileout.write(ssBuf.data(), ssBuf.size());
+                ssBuf.clear();
+            }
+            if (!fValid)
+                break;
+
+            if (shutdown_threads.load())
+                return error("%s: Interrupted", __func__);
+            info.commitment.AddCoin(key, coin);
+            hashTx = key.hash;
+            vOutputs.emplace_back(key.n, std::move(coin));
+            pcursor->Next();
+        }
+
+        uint64_t nEnd = 0;
+        ssBuf << VARINT(nEnd);
+        ssBuf << info.commitment;
+        hasher.write(ssBuf.data(), ssBuf.size());
+        ssBuf << hasher.GetHash();
+        fileout.write(ssBuf.data(), ssBuf.size());
+    }
+    catch (const std::exception &e)
+    {
+        return error("%s: Serialize or I/O error - %s", __func__, e.what());
+    }
+    FileCommit(fileout.Get());
+    fileout.fclose();
+
+    if (!RenameOver(pathTmp, path))
+        return error("%s: Rename-into-place failed", __func__);
+    return true;
+}
+
+bool VerifyTxOutSnapshot(const fs::path &path, CTxOutSnapshotInfo &info)
+{
+    FILE *file = fopen(path.string().c_str(), "rb");
+    CAutoFile filein(file, SER_DISK, CLIENT_VERSION);
+    if (filein.IsNull())
+        return error("%s: Failed to open file %s", __func__, path.string());
+
+    CHashVerifier<CAutoFile> verifier(&filein);
+    CUTXOCommitment commitment;
+    uint256 hashIn;
+    try
+    {
+        if (!ReadHeader(verifier, info.hashBlock))
+            return false;
+        ReadCoins(verifier, [&commitment](const COutPoint &outpoint, const Coin &coin) {
+            commitment.AddCoin(outpoint, coin);
+        });
+        verifier >> info.commitment;
+        filein >> hashIn;
+    }
+    catch (const std::exception &e)
+    {
+        return error("%s: Deserialize or I/O error - %s", __func__, e.what());
+    }
+
+    if (hashIn != verifier.GetHash())
+        return error("%s: Checksum mismatch, data corrupted", __func__);
+    if (commitment != info.commitment)
+        return error("%s: Coins do not match the snapshot commitment", __func__);
+    return true;
+}
+
+bool LoadTxOutSnapshot(CCoinsViewDB *view, const fs::path &path, uint64_t &nCoins)
+{
+    FILE *file = fopen(path.string().c_str(), "rb");
+    CAutoFile filein(file, SER_DISK, CLIENT_VERSION);
+    if (filein.IsNull())
+        return error("%s: Failed to open file %s", __func__, path.string());
+
+    // The coins come in database order, so every chunk is a sorted run of keys
+    std::vector<std::pair<COutPoint, Coin> > vCoins;
+    vCoins.reserve(LOAD_CHUNK_SIZE);
+    bool fWriteFailed = false;
+    nCoins = 0;
+    try
+    {
+        uint256 hashBlock;
+        if (!ReadHeader(filein, hashBlock))
+            return false;
+        ReadCoins(filein, [&](const COutPoint &outpoint, Coin &coin) {
+            vCoins.emplace_back(outpoint, std::move(coin));
+            if (vCoins.size() >= LOAD_CHUNK_SIZE && !fWriteFailed)
+            {
+                fWriteFailed = !view->WriteCoins(vCoins);
+                nCoins += vCoins.size();
+                vCoins.clear();
+            }
+        });
+    }
+    catch (const std::exception &e)
+    {
+        return error("%s: Deserialize or I/O error - %s", __func__, e.what());
+    }
+    if (!fWriteFailed)
+        fWriteFailed = !view->WriteCoins(vCoins);
+    nCoins += vCoins.size();
+    if (fWriteFailed)
+        return error("%s: Failed to write coins", __func__);
+    return true;
+}
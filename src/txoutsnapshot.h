@@ -0,0 +1,55 @@
+// This file is part of the Eccoin project
+// Copyright (c) 2018 The Eccoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef BITCOIN_TXOUTSNAPSHOT_H
+#define BITCOIN_TXOUTSNAPSHOT_H
+
+#include "fs.h"
+#include "uint256.h"
+#include "utxocommitment.h"
+
+#include <stdint.h>
+
+class CCoinsViewDB;
+
+//! Version of the snapshot file format written by DumpTxOutSet
+static const uint16_t TXOUT_SNAPSHOT_VERSION = 1;
+
+/** What a UTXO snapshot file claims to contain, checked by VerifyTxOutSnapshot */
+struct CTxOutSnapshotInfo
+{
+    //! best block of the chainstate the snapshot was taken from
+    uint256 hashBlock;
+    //! commitment to all coins in the snapshot, see CUTXOCommitment
+    CUTXOCommitment commitment;
+};
+
+/**
+ * Write all coins in view to a snapshot file.
+ *
+ * Layout: magic, format version, network magic and best block, then the coins
+ * grouped by transaction in database order, then the commitment to the set
+ * and a checksum over everything before it. The coins are written with their
+ * outputs compressed, which makes the file considerably smaller than the
+ * chainstate itself. The file is written to a temporary name and moved into
+ * place once it is complete.
+ */
+bool DumpTxOutSet(CCoinsViewDB *view, const fs::path &path, CTxOutSnapshotInfo &info);
+
+/**
+ * Read a snapshot file completely and check the checksum, the network and that
+ * the coins match the stored commitment. Nothing is written anywhere.
+ */
+bool VerifyTxOutSnapshot(const fs::path &path, CTxOutSnapshotInfo &info);
+
+/**
+ * Write the coins of a snapshot file that passed VerifyTxOutSnapshot into a
+ * chainstate that holds no coins yet. The best block and the commitment are
+ * left to the caller, so an interrupted load is never mistaken for a complete
+ * chainstate.
+ */
+bool LoadTxOutSnapshot(CCoinsViewDB *view, const fs::path &path, uint64_t &nCoins);
+
+#endif // BITCOIN_TXOUTSNAPSHOT_H
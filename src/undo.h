@@ -38,7 +38,7 @@ public:
             // Required to maintain compatibility with older undo format
             ::Serialize(s, (unsigned char)0);
         }
-        ::Serialize(s, CTxOutCompressor(REF(txout->out)));
+        ::Serialize(s, txout->out);
     }
 
     TxInUndoSerializer(const Coin *coin) : txout(coin) {}
@@ -67,7 +67,7 @@ public:
             unsigned int nVersionDummy;
             ::Unserialize(s, VARINT(nVersionDummy));
         }
-        ::Unserialize(s, REF(CTxOutCompressor(REF(txout->out))));
+        ::Unserialize(s, REF(txout->out));
     }
 
     TxInUndoDeserializer(Coin *coin) : txout(coin) {}
@@ -0,0 +1,200 @@
+// This file is part of the Eccoin project
+// Copyright (c) 2018 The Eccoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "utxocommitment.h"
+
+#include "clientversion.h"
+#include "coins.h"
+#include "crypto/hash.h"
+#include "crypto/sha256.h"
+
+#include <secp256k1.h>
+
+#include <assert.h>
+
+namespace
+{
+/** secp256k1 context for the point arithmetic. No precomputed tables are needed. */
+class CMultiSetContext
+{
+public:
+    secp256k1_context *ctx;
+
+    CMultiSetContext() { ctx = secp256k1_context_create(SECP256K1_CONTEXT_NONE); }
+    ~CMultiSetContext() { secp256k1_context_destroy(ctx); }
+};
+
+const secp256k1_context *GetContext()
+{
+    static CMultiSetContext context;
+    return context.ctx;
+}
+
+// Valid compressed points start with 0x02 or 0x03
+bool IsInfinity(const CECMultiSet::Point &point) { return point[0] == 0; }
+
+void ParsePoint(const CECMultiSet::Point &point, secp256k1_pubkey &pubkey)
+{
+    bool fValid = secp256k1_ec_pubkey_parse(GetContext(), &pubkey, point.data(), point.size());
+    assert(fValid);
+}
+
+/**
+ * Map an element onto the curve. Successive hashes of the element are tried
+ * as x coordinate until one of them is on the curve, which takes two tries on
+ * average.
+ */
+void HashToPoint(const uint256 &hash, secp256k1_pubkey &pubkey)
+{
+    uint8_t buf[33];
+    buf[0] = 0x02;
+    CSHA256().Write(hash.begin(), hash.size()).Finalize(buf + 1);
+    while (!secp256k1_ec_pubkey_parse(GetContext(), &pubkey, buf, sizeof(buf)))
+        CSHA256().Write(buf + 1, 32).Finalize(buf + 1);
+}
+
+CECMultiSet::Point SumPoints(const CECMultiSet::Point &point,
+    const std::vector<uint256> &vAdded,
+    const std::vector<uint256> &vRemoved,
+    const std::vector<CECMultiSet::Point> &vCombined)
+{
+    std::vector<secp256k1_pubkey> vPubKeys(1 + vAdded.size() + vRemoved.size() + vCombined.size());
+    size_t n = 0;
+    if (!IsInfinity(point))
+        ParsePoint(point, vPubKeys[n++]);
+    for (const uint256 &hash : vAdded)
+        HashToPoint(hash, vPubKeys[n++]);
+    for (const uint256 &hash : vRemoved)
+    {
+        HashToPoint(hash, vPubKeys[n]);
+        bool fNegated = secp256k1_ec_pubkey_negate(GetContext(), &vPubKeys[n++]);
+        assert(fNegated);
+    }
+    for (const CECMultiSet::Point &other : vCombined)
+    {
+        if (!IsInfinity(other))
+            ParsePoint(other, vPubKeys[n++]);
+    }
+
+    CECMultiSet::Point sum;
+    sum.fill(0);
+    if (n == 0)
+        return sum;
+
+    // Adding everything in one call only needs a single conversion back to
+    // affine coordinates.
+    std::vector<const secp256k1_pubkey *> vIns(n);
+    for (size_t i = 0; i < n; i++)
+        vIns[i] = &vPubKeys[i];
+    secp256k1_pubkey result;
+    if (!secp256k1_ec_pubkey_combine(GetContext(), &result, vIns.data(), n))
+        return sum; // the elements cancelled out
+    size_t nSize = sum.size();
+    secp256k1_ec_pubkey_serialize(GetContext(), sum.data(), &nSize, &result, SECP256K1_EC_COMPRESSED);
+    assert(nSize == sum.size());
+    return sum;
+}
+}
+
+void CECMultiSet::SetNull()
+{
+    point.fill(0);
+    vAdded.clear();
+    vRemoved.clear();
+    vCombined.clear();
+}
+
+void CECMultiSet::Fold()
+{
+    point = SumPoints(point, vAdded, vRemoved, vCombined);
+    vAdded.clear();
+    vRemoved.clear();
+    vCombined.clear();
+}
+
+CECMultiSet::Point CECMultiSet::GetPoint() const
+{
+    if (vAdded.empty() && vRemoved.empty() && vCombined.empty())
+        return point;
+    return SumPoints(point, vAdded, vRemoved, vCombined);
+}
+
+void CECMultiSet::Add(const uint256 &hash)
+{
+    vAdded.push_back(hash);
+    if (vAdded.size() + vRemoved.size() + vCombined.size() >= FOLD_THRESHOLD)
+        Fold();
+}
+
+void CECMultiSet::Remove(const uint256 &hash)
+{
+    vRemoved.push_back(hash);
+    if (vAdded.size() + vRemoved.size() + vCombined.size() >= FOLD_THRESHOLD)
+        Fold();
+}
+
+void CECMultiSet::Combine(const CECMultiSet &other)
+{
+    assert(&other != this);
+    vAdded.insert(vAdded.end(), other.vAdded.begin(), other.vAdded.end());
+    vRemoved.insert(vRemoved.end(), other.vRemoved.begin(), other.vRemoved.end());
+    vCombined.insert(vCombined.end(), other.vCombined.begin(), other.vCombined.end());
+    if (!IsInfinity(other.point))
+        vCombined.push_back(other.point);
+    if (vAdded.size() + vRemoved.size() + vCombined.size() >= FOLD_THRESHOLD)
+        Fold();
+}
+
+bool CECMultiSet::IsEmpty() const { return IsInfinity(GetPoint()); }
+uint256 CECMultiSet::GetHash() const
+{
+    Point sum = GetPoint();
+    if (IsInfinity(sum))
+        return uint256();
+    return Hash(sum.begin(), sum.end());
+}
+
+void CECMultiSet::CheckPoint() const
+{
+    secp256k1_pubkey pubkey;
+    if (!IsInfinity(point) && !secp256k1_ec_pubkey_parse(GetContext(), &pubkey, point.data(), point.size()))
+        throw std::ios_base::failure("CECMultiSet: invalid point");
+}
+
+static uint256 CoinHash(const COutPoint &outpoint, const Coin &coin)
+{
+    CHashWriter ss(SER_DISK, CLIENT_VERSION);
+    ss << outpoint << coin;
+    return ss.GetHash();
+}
+
+static int64_t CoinSize(const COutPoint &outpoint, const Coin &coin)
+{
+    return ::GetSerializeSize(outpoint, SER_DISK, CLIENT_VERSION) + ::GetSerializeSize(coin, SER_DISK, CLIENT_VERSION);
+}
+
+void CUTXOCommitment::AddCoin(const COutPoint &outpoint, const Coin &coin)
+{
+    multiset.Add(CoinHash(outpoint, coin));
+    nTransactionOutputs++;
+    nSerializedSize += CoinSize(outpoint, coin);
+    nTotalAmount += coin.out.nValue;
+}
+
+void CUTXOCommitment::SpendCoin(const COutPoint &outpoint, const Coin &coin)
+{
+    multiset.Remove(CoinHash(outpoint, coin));
+    nTransactionOutputs--;
+    nSerializedSize -= CoinSize(outpoint, coin);
+    nTotalAmount -= coin.out.nValue;
+}
+
+void CUTXOCommitment::Combine(const CUTXOCommitment &other)
+{
+    multiset.Combine(other.multiset);
+    nTransactionOutputs += other.nTransactionOutputs;
+    nSerializedSize += other.nSerializedSize;
+    nTotalAmount += other.nTotalAmount;
+}
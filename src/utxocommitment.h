@@ -0,0 +1,138 @@
+// This file is part of the Eccoin project
+// Copyright (c) 2018 The Eccoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef BITCOIN_UTXOCOMMITMENT_H
+#define BITCOIN_UTXOCOMMITMENT_H
+
+#include "amount.h"
+#include "serialize.h"
+#include "uint256.h"
+
+#include <array>
+#include <stdint.h>
+#include <vector>
+
+class COutPoint;
+class Coin;
+
+/**
+ * Order independent hash of a multiset.
+ *
+ * Every element (given as a 256-bit hash) is mapped onto a point of the
+ * secp256k1 curve and the set is represented by the sum of those points.
+ * Elements can therefore be added and removed in any order, and the changes
+ * recorded in one set can be merged into another with Combine. Removing an
+ * element that is not in the set is allowed; it cancels out once the element
+ * is added, which is what makes it possible to keep deltas.
+ *
+ * Mapping an element to the curve is the expensive part, so additions and
+ * removals are queued and folded into the sum in groups.
+ */
+class CECMultiSet
+{
+public:
+    //! Compressed encoding of a curve point. All zeros encode the point at
+    //! infinity, i.e. the empty set.
+    typedef std::array<uint8_t, 33> Point;
+
+private:
+    //! sum of all elements folded in so far
+    Point point;
+    //! elements added or removed since the last fold
+    std::vector<uint256> vAdded;
+    std::vector<uint256> vRemoved;
+    //! sums of other sets merged in since the last fold
+    std::vector<Point> vCombined;
+
+    //! number of queued changes that triggers a fold
+    static const size_t FOLD_THRESHOLD = 256;
+
+    void Fold();
+    //! Sum of the folded point and everything still queued
+    Point GetPoint() const;
+    //! Throw if the folded point is not a valid encoding
+    void CheckPoint() const;
+
+public:
+    CECMultiSet() { SetNull(); }
+    void SetNull();
+
+    void Add(const uint256 &hash);
+    void Remove(const uint256 &hash);
+    void Combine(const CECMultiSet &other);
+
+    bool IsEmpty() const;
+    //! Hash of the set, zero for the empty set
+    uint256 GetHash() const;
+
+    template <typename Stream>
+    void Serialize(Stream &s) const
+    {
+        Point sum = GetPoint();
+        s.write((const char *)sum.data(), sum.size());
+    }
+
+    template <typename Stream>
+    void Unserialize(Stream &s)
+    {
+        SetNull();
+        s.read((char *)point.data(), point.size());
+        CheckPoint();
+    }
+};
+
+/**
+ * Rolling commitment to the UTXO set: a CECMultiSet over all (outpoint, coin)
+ * pairs plus running totals.
+ *
+ * A CCoinsViewCache records the changes made through it in a delta of this
+ * type which is handed to its base on Flush, and CCoinsViewDB finally adds it
+ * to the commitment it stores next to the best block. Disconnecting a block
+ * restores coins from the undo data through the same AddCoin and SpendCoin
+ * calls, so the commitment follows reorgs without any extra bookkeeping.
+ */
+class CUTXOCommitment
+{
+public:
+    CECMultiSet multiset;
+    int64_t nTransactionOutputs;
+    //! sum of the serialized sizes of the outpoints and coins
+    int64_t nSerializedSize;
+    CAmount nTotalAmount;
+
+    CUTXOCommitment() { SetNull(); }
+    void SetNull()
+    {
+        multiset.SetNull();
+        nTransactionOutputs = 0;
+        nSerializedSize = 0;
+        nTotalAmount = 0;
+    }
+
+    void AddCoin(const COutPoint &outpoint, const Coin &coin);
+    void SpendCoin(const COutPoint &outpoint, const Coin &coin);
+    void Combine(const CUTXOCommitment &other);
+
+    uint256 GetHash() const { return multiset.GetHash(); }
+    friend bool operator==(const CUTXOCommitment &a, const CUTXOCommitment &b)
+    {
+        return a.GetHash() == b.GetHash() && a.nTransactionOutputs == b.nTransactionOutputs &&
+               a.nSerializedSize == b.nSerializedSize && a.nTotalAmount == b.nTotalAmount;
+    }
+    friend bool operator!=(const CUTXOCommitment &a, const CUTXOCommitment &b) { return !(a == b); }
+
+    ADD_SERIALIZE_METHODS
+
+    template <typename Stream, typename Operation>
+    inline void SerializationOp(Stream &s, Operation ser_action)
+    {
+        READWRITE(multiset);
+        READWRITE(nTransactionOutputs);
+        READWRITE(nSerializedSize);
+        READWRITE(nTotalAmount);
+    }
+};
+
+#endif // BITCOIN_UTXOCOMMITMENT_H
@@ -0,0 +1,99 @@
+// This file is part of the Eccoin project
+// Copyright (c) 2018 The Eccoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#include "validationstats.h"
+
+#include "util/utiltime.h"
+
+#include <algorithm>
+
+CValidationStats validationStats(VALIDATION_STATS_RECENT_BLOCKS);
+
+const char *ValidationStageName(int nStage)
+{
+    switch (nStage)
+    {
+    case STAGE_READ:
+        return "read";
+    case STAGE_CHECKBLOCK:
+        return "checkblock";
+    case STAGE_INPUTS:
+        return "inputs";
+    case STAGE_SCRIPTS:
+        return "scripts";
+    case STAGE_UNDO:
+        return "undo";
+    case STAGE_FLUSH:
+        return "flush";
+    case STAGE_MEMPOOL:
+        return "mempool";
+    case STAGE_SIGNALS:
+        return "signals";
+    }
+    return "unknown";
+}
+
+int64_t CBlockValidationTiming::Total() const
+{
+    int64_t nTotal = 0;
+    for (int64_t nTime : nStageTime)
+        nTotal += nTime;
+    return nTotal;
+}
+
+CValidationStageTimer::CValidationStageTimer(CBlockValidationTiming *ptiming, ValidationStage stage)
+    : pnTime(ptiming ? &ptiming->nStageTime[stage] : nullptr), nStart(ptiming ? GetTimeMicros() : 0)
+{
+}
+
+CValidationStageTimer::~CValidationStageTimer()
+{
+    if (pnTime)
+        *pnTime += GetTimeMicros() - nStart;
+}
+
+void CStageHistogram::Add(int64_t nTime)
+{
+    nTime = std::max<int64_t>(nTime, 0);
+    nCount++;
+    nTotal += nTime;
+    nMax = std::max(nMax, nTime);
+    int nBucket = 0;
+    while (nBucket < NUM_BUCKETS - 1 && nTime >= BucketLimit(nBucket))
+        nBucket++;
+    vBuckets[nBucket]++;
+}
+
+void CValidationStats::Add(const CBlockValidationTiming &timing)
+{
+    LOCK(cs_stats);
+    for (int i = 0; i < VALIDATION_STAGE_COUNT; i++)
+        vHistograms[i].Add(timing.nStageTime[i]);
+    histTotal.Add(timing.Total());
+    if (nMaxRecent == 0)
+        return;
+    if (recent.size() == nMaxRecent)
+        recent.pop_front();
+    recent.push_back(timing);
+}
+
+std::vector<CBlockValidationTiming> CValidationStats::GetRecent(size_t nCount) const
+{
+    LOCK(cs_stats);
+    nCount = std::min(nCount, recent.size());
+    return std::vector<CBlockValidationTiming>(recent.rbegin(), recent.rbegin() + nCount);
+}
+
+CStageHistogram CValidationStats::GetHistogram(int nStage) const
+{
+    LOCK(cs_stats);
+    return vHistograms[nStage];
+}
+
+CStageHistogram CValidationStats::GetTotalHistogram() const
+{
+    LOCK(cs_stats);
+    return histTotal;
+}
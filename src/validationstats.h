@@ -0,0 +1,118 @@
+// This file is part of the Eccoin project
+// Copyright (c) 2018 The Eccoin developers
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+#ifndef BITCOIN_VALIDATIONSTATS_H
+#define BITCOIN_VALIDATIONSTATS_H
+
+#include "sync.h"
+#include "uint256.h"
+
+#include <deque>
+#include <stdint.h>
+#include <vector>
+
+/** The stages the time spent connecting a block is broken down into */
+enum ValidationStage
+{
+    //! Reading the block from disk
+    STAGE_READ,
+    //! The context-free CheckBlock, or the merkle root check of a block checked before
+    STAGE_CHECKBLOCK,
+    //! Fetching and checking the inputs and applying the transactions to the view
+    STAGE_INPUTS,
+    //! Script verification, including the wait for the script check threads
+    STAGE_SCRIPTS,
+    //! Writing the undo data
+    STAGE_UNDO,
+    //! Flushing the view to pcoinsTip and, if needed, the chain state to disk
+    STAGE_FLUSH,
+    //! Removing the block's transactions and conflicts from the mempool, and reorg updates
+    STAGE_MEMPOOL,
+    //! Wallet and block tip notifications
+    STAGE_SIGNALS,
+    VALIDATION_STAGE_COUNT
+};
+
+/** Name of the stage, as reported by getvalidationstats */
+const char *ValidationStageName(int nStage);
+
+/** Time spent in each stage while connecting one block, in microseconds */
+struct CBlockValidationTiming
+{
+    uint256 hashBlock;
+    int nHeight;
+    int64_t nStageTime[VALIDATION_STAGE_COUNT];
+
+    CBlockValidationTiming() : nHeight(-1)
+    {
+        for (int64_t &nTime : nStageTime)
+            nTime = 0;
+    }
+    int64_t Total() const;
+};
+
+/** Adds the time from its construction to its destruction to a stage of a CBlockValidationTiming */
+class CValidationStageTimer
+{
+private:
+    int64_t *pnTime;
+    int64_t nStart;
+
+public:
+    //! ptiming may be nullptr, then nothing is timed
+    CValidationStageTimer(CBlockValidationTiming *ptiming, ValidationStage stage);
+    ~CValidationStageTimer();
+};
+
+/** Cumulative distribution of the time spent in a stage */
+struct CStageHistogram
+{
+    //! Bucket i counts times below 2^i microseconds that do not fit into a lower one, the last bucket all others
+    static const int NUM_BUCKETS = 28;
+
+    uint64_t nCount;
+    int64_t nTotal;
+    int64_t nMax;
+    uint64_t vBuckets[NUM_BUCKETS];
+
+    CStageHistogram() : nCount(0), nTotal(0), nMax(0)
+    {
+        for (uint64_t &nBucket : vBuckets)
+            nBucket = 0;
+    }
+    void Add(int64_t nTime);
+    //! Upper bound of bucket nBucket in microseconds, exclusive
+    static int64_t BucketLimit(int nBucket) { return (int64_t)1 << nBucket; }
+};
+
+/**
+ * Timings of the most recently connected blocks, and histograms of each stage
+ * over all blocks connected since startup.
+ */
+class CValidationStats
+{
+private:
+    mutable CCriticalSection cs_stats;
+    size_t nMaxRecent;
+    //! The oldest block first
+    std::deque<CBlockValidationTiming> recent;
+    CStageHistogram vHistograms[VALIDATION_STAGE_COUNT];
+    CStageHistogram histTotal;
+
+public:
+    explicit CValidationStats(size_t nMaxRecentIn) : nMaxRecent(nMaxRecentIn) {}
+    void Add(const CBlockValidationTiming &timing);
+    //! The timings of the last nCount blocks, the most recent one first
+    std::vector<CBlockValidationTiming> GetRecent(size_t nCount) const;
+    CStageHistogram GetHistogram(int nStage) const;
+    CStageHistogram GetTotalHistogram() const;
+};
+
+/** Number of blocks getvalidationstats can report the stages of */
+static const size_t VALIDATION_STATS_RECENT_BLOCKS = 1000;
+
+extern CValidationStats validationStats;
+
+#endif // BITCOIN_VALIDATIONSTATS_H
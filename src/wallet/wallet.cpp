@@ -2329,14 +2329,16 @@ bool CWallet::CreateTransaction(const std::vector<CRecipient> &vecSend,
                 // Sign
                 int nIn = 0;
                 CTransaction txNewConst(txNew);
+                const PrecomputedTransactionData txdata(txNewConst);
                 for (auto const &coin : setCoins)
                 {
                     bool signSuccess;
                     const CScript &scriptPubKey = coin.first->tx->vout[coin.second].scriptPubKey;
                     CScript &scriptSigRes = txNew.vin[nIn].scriptSig;
                     if (sign)
-                        signSuccess = ProduceSignature(TransactionSignatureCreator(this, &txNewConst, nIn, SIGHASH_ALL),
-                            scriptPubKey, scriptSigRes);
+                        signSuccess = ProduceSignature(
+                            TransactionSignatureCreator(this, &txNewConst, nIn, SIGHASH_ALL, &txdata), scriptPubKey,
+                            scriptSigRes);
                     else
                         signSuccess = ProduceSignature(DummySignatureCreator(this), scriptPubKey, scriptSigRes);
 
@@ -3437,9 +3439,10 @@ bool CWallet::CreateCoinStake(const CKeyStore &keystore,
         txNew.vout[1].nValue = nCredit;
     // Sign
     int nIn = 0;
+    const PrecomputedTransactionData txdata(txNew);
     for (auto const *pcoin : vwtxPrev)
     {
-        if (!SignSignature(*this, *(pcoin->tx), txNew, nIn++))
+        if (!SignSignature(*this, *(pcoin->tx), txNew, nIn++, SIGHASH_ALL, &txdata))
             return error("CreateCoinStake : failed to sign coinstake");
     }
 